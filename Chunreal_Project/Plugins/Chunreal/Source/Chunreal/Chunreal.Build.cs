@@ -19,6 +19,9 @@ public class Chunreal : ModuleRules
         PublicDefinitions.Add("__DISABLE_SERIAL__");
         PublicDefinitions.Add("__DISABLE_FILEIO__");
         PublicDefinitions.Add("__DISABLE_THREADS__");
+        // helper threads for VM_UGEN_THREADS despite __DISABLE_THREADS__
+        // (std::thread only; none are started unless VM_UGEN_THREADS > 0)
+        PublicDefinitions.Add("__ENABLE_UGEN_THREADS__");
         PublicDefinitions.Add("__DISABLE_NETWORK__");
         PublicDefinitions.Add("__DISABLE_SHELL__");
         PublicDefinitions.Add("__DISABLE_WORDEXP__");
@@ -29,6 +32,8 @@ public class Chunreal : ModuleRules
 	PublicDefinitions.Add("__USE_CHUCK_YACC__");
 
         PublicDefinitions.Add("__CHUNREAL_ENGINE__");
+        // per-VM shred statistics (lock-free; cheap enough to leave on)
+        PublicDefinitions.Add("__CHUCK_STAT_TRACK__");
 
         PublicDependencyModuleNames.AddRange(
             new string[]
@@ -82,6 +82,7 @@ namespace Metasound
         delete outBufferInterleaved;
 
         // Delete ChucK
+        FChunrealModule::RemoveChuckCompilerMutex(theChuck);
         delete theChuck;
         theChuck = nullptr;
     }
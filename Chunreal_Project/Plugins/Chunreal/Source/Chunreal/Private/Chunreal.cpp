@@ -11,11 +11,18 @@
 #include "Chunreal.h"
 #include "MetasoundFrontendRegistries.h"
 #include "AudioDevice.h"
+#include <type_traits>
 #define LOCTEXT_NAMESPACE "FChunrealModule"
 
 // Define custom log category "LogChunreal"
 DEFINE_LOG_CATEGORY(LogChunreal);
 
+// Every ChucK instance compiles on its own thread, which needs the pure parser /
+// reentrant scanner in chuck/chuck_yacc.c (no parser state in globals); a copy of
+// the upstream core (scripts/CopyChuckCore.sh) brings back the global one
+static_assert(std::is_same<decltype(&yyparse), int (*)(void*)>::value,
+    "chuck_yacc.c must be the reentrant parser: regenerate it with scripts/GenerateChuckYacc.sh");
+
 void FChunrealModule::StartupModule()
 {
     // Create Chuck
@@ -62,6 +69,7 @@ void FChunrealModule::ShutdownModule()
 {
     // Clear array
     ChuckMap.Empty();
+    compilerMutexes.Empty();
 
     // Delete ChucK parent
     delete chuckParent;
@@ -109,16 +117,37 @@ void FChunrealModule::printThisFromChuck(const char* msg)
 }
 
 /// <summary>
-/// Compile ChucK code with a mutex
+/// Compile ChucK code with a mutex per ChucK instance
 /// </summary>
 /// <param name="chuckRef"></param>
 /// <param name="code"></param>
 /// <param name="shredIDs"></param>
 void FChunrealModule::CompileChuckCode(ChucK* chuckRef, const std::string& code, std::vector<t_CKUINT>* shredIDs)
 {
-    compilerMutex.Lock();
+    // the compiler front end keeps its scanner/parser/error state per thread,
+    // so compiles for different ChucK instances may run concurrently; compiles
+    // into the same instance (e.g., sub nodes sharing chuckParent) share its
+    // compiler, type system and VM, and must take turns
+    compilerMapMutex.Lock();
+    TSharedPtr<FCriticalSection>& found = compilerMutexes.FindOrAdd(chuckRef);
+    if (!found.IsValid()) found = MakeShared<FCriticalSection>();
+    TSharedPtr<FCriticalSection> compilerMutex = found;
+    compilerMapMutex.Unlock();
+
+    compilerMutex->Lock();
     chuckRef->compileCode(code, "", 1, false, shredIDs);
-    compilerMutex.Unlock();
+    compilerMutex->Unlock();
+}
+
+/// <summary>
+/// Forget the compile mutex of a ChucK instance about to be deleted
+/// </summary>
+/// <param name="chuckRef"></param>
+void FChunrealModule::RemoveChuckCompilerMutex(ChucK* chuckRef)
+{
+    compilerMapMutex.Lock();
+    compilerMutexes.Remove(chuckRef);
+    compilerMapMutex.Unlock();
 }
 
 /// <summary>
@@ -344,8 +373,52 @@ bool FChunrealModule::SetChuckGlobalFloatArray(FString id, FString paramName, t_
     else
     {
         ChucK* chuck = *ChuckMap.Find(id);
-        chuck->globals()->setGlobalFloatArray(TCHAR_TO_ANSI(*paramName), floatArray, arraySize);
-        return true;
+        // copy once into the shared buffer; the VM swaps it in
+        t_CKFLOAT* buffer = chuck->globals()->getGlobalFloatArrayBuffer(TCHAR_TO_ANSI(*paramName), arraySize);
+        if (arraySize > 0)
+        {
+            FMemory::Memcpy(buffer, floatArray, arraySize * sizeof(t_CKFLOAT));
+        }
+        return chuck->globals()->publishGlobalFloatArrayBuffer(TCHAR_TO_ANSI(*paramName));
+    }
+}
+
+/// <summary>
+/// Get the shared buffer for a global float array; fill it, then call PublishChuckGlobalFloatArrayBuffer()
+/// </summary>
+/// <param name="id"></param>
+/// <param name="paramName"></param>
+/// <param name="arraySize"></param>
+/// <returns>buffer of arraySize floats, or nullptr</returns>
+t_CKFLOAT* FChunrealModule::GetChuckGlobalFloatArrayBuffer(FString id, FString paramName, t_CKUINT arraySize)
+{
+    if (!ChuckMap.Contains(id))
+    {
+        return nullptr;
+    }
+    else
+    {
+        ChucK* chuck = *ChuckMap.Find(id);
+        return chuck->globals()->getGlobalFloatArrayBuffer(TCHAR_TO_ANSI(*paramName), arraySize);
+    }
+}
+
+/// <summary>
+/// Publish the shared buffer of a global float array; ChucK sees it from the next block
+/// </summary>
+/// <param name="id"></param>
+/// <param name="paramName"></param>
+/// <returns></returns>
+bool FChunrealModule::PublishChuckGlobalFloatArrayBuffer(FString id, FString paramName)
+{
+    if (!ChuckMap.Contains(id))
+    {
+        return false;
+    }
+    else
+    {
+        ChucK* chuck = *ChuckMap.Find(id);
+        return chuck->globals()->publishGlobalFloatArrayBuffer(TCHAR_TO_ANSI(*paramName));
     }
 }
 
@@ -64,9 +64,9 @@ bool UChunrealBlueprint::SetChuckGlobalIntArray(FString id, FString paramName, T
 	return FChunrealModule::SetChuckGlobalIntArray(id, paramName, (t_CKINT *)intArray.GetData(), arraySize);
 }
 // Set ChucK global float array variable
-bool UChunrealBlueprint::SetChuckGlobalFloatArray(FString id, FString paramName, TArray<double> floatArray, int arraySize)
+bool UChunrealBlueprint::SetChuckGlobalFloatArray(FString id, FString paramName, const TArray<double>& floatArray, int arraySize)
 {
-	return FChunrealModule::SetChuckGlobalFloatArray(id, paramName, floatArray.GetData(), arraySize);
+	return FChunrealModule::SetChuckGlobalFloatArray(id, paramName, (t_CKFLOAT *)floatArray.GetData(), FMath::Clamp(arraySize, 0, floatArray.Num()));
 }
 // Broadcast ChucK global event
 bool UChunrealBlueprint::BroadcastChuckGlobalEvent(FString id, FString paramName)
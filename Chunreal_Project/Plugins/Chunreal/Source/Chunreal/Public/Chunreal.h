@@ -43,8 +43,10 @@ public:
     // Receive message from Chuck with a mutex
     static void printThisFromChuck(const char* msg);
 
-    // Compile ChucK code with a mutex
+    // Compile ChucK code with a mutex per ChucK instance
     static void CompileChuckCode(ChucK* chuckRef, const std::string& code, std::vector<t_CKUINT>* shredIDs = nullptr);
+    // Forget the compile mutex of a ChucK instance about to be deleted
+    static void RemoveChuckCompilerMutex(ChucK* chuckRef);
 
     // Run ChucK with a mutex
     static void RunChuck(ChucK* chuckRef, const float* input, float* output, t_CKINT numFrames);
@@ -69,6 +71,9 @@ public:
     static bool SetChuckGlobalIntArray(FString id, FString paramName, t_CKINT intArray[], t_CKUINT arraySize);
     // Global float array
     static bool SetChuckGlobalFloatArray(FString id, FString paramName, t_CKFLOAT floatArray[], t_CKUINT arraySize);
+    // Global float array, shared buffer: fill the returned buffer, then publish (no copy into ChucK)
+    static t_CKFLOAT* GetChuckGlobalFloatArrayBuffer(FString id, FString paramName, t_CKUINT arraySize);
+    static bool PublishChuckGlobalFloatArrayBuffer(FString id, FString paramName);
     // Global event
     static bool BroadcastChuckGlobalEvent(FString id, FString paramName);
 
@@ -81,6 +86,8 @@ private:
 
     inline static FCriticalSection printMutex;
     inline static FCriticalSection refMutex;
-    inline static FCriticalSection compilerMutex;
     inline static FCriticalSection runMutex;
+    // compile mutex per ChucK instance, and a mutex for the map itself
+    inline static TMap<ChucK*, TSharedPtr<FCriticalSection>> compilerMutexes;
+    inline static FCriticalSection compilerMapMutex;
 };
@@ -105,7 +105,7 @@ class UChunrealBlueprint : public UBlueprintFunctionLibrary
         * @param arraySize size of array
         */
         UFUNCTION(BlueprintCallable, Category = "Chunreal", meta = (keywords = "Set ChucK Float Array"))
-            static bool SetChuckGlobalFloatArray(FString id, FString paramName, TArray<double> floarArray, int arraySize);
+            static bool SetChuckGlobalFloatArray(FString id, FString paramName, const TArray<double>& floarArray, int arraySize);
 
         /**
         * Broadcast ChucK global event
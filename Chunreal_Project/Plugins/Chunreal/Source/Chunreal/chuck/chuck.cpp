@@ -49,6 +49,7 @@
 #include "chuck_errmsg.h"
 #include "chuck_io.h"
 #include "chuck_globals.h" // added 1.4.1.0
+#include "chuck_bytecode.h" // added 1.5.5.3
 
 #ifndef __DISABLE_OTF_SERVER__
 #include "chuck_otf.h"
@@ -81,6 +82,8 @@
 #define CHUCK_PARAM_OUTPUT_CHANNELS_DEFAULT        "2"
 #define CHUCK_PARAM_VM_ADAPTIVE_DEFAULT            "0"
 #define CHUCK_PARAM_VM_HALT_DEFAULT                "0"
+#define CHUCK_PARAM_VM_UGEN_THREADS_DEFAULT        "0"
+#define CHUCK_PARAM_VM_UGEN_PARALLEL_MIN_DEFAULT   "64"
 #define CHUCK_PARAM_OTF_ENABLE_DEFAULT             "0"
 #define CHUCK_PARAM_OTF_PORT_DEFAULT               "8888"
 #define CHUCK_PARAM_OTF_PRINT_WARNINGS_DEFAULT     "0"
@@ -99,6 +102,7 @@
 #define CHUCK_PARAM_IMPORT_PATH_SYSTEM_DEFAULT     std::list<std::string>()
 #define CHUCK_PARAM_IMPORT_PATH_PACKAGES_DEFAULT   std::list<std::string>()
 #define CHUCK_PARAM_IMPORT_PATH_USER_DEFAULT       std::list<std::string>()
+#define CHUCK_PARAM_IMPORT_AUTO_RELOAD_DEFAULT     "0"
 
 
 
@@ -192,6 +196,8 @@ void ChucK::initDefaultParams()
     initParam( CHUCK_PARAM_OUTPUT_CHANNELS, CHUCK_PARAM_OUTPUT_CHANNELS_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_VM_ADAPTIVE, CHUCK_PARAM_VM_ADAPTIVE_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_VM_HALT, CHUCK_PARAM_VM_HALT_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_UGEN_THREADS, CHUCK_PARAM_VM_UGEN_THREADS_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_VM_UGEN_PARALLEL_MIN, CHUCK_PARAM_VM_UGEN_PARALLEL_MIN_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_OTF_ENABLE, CHUCK_PARAM_OTF_ENABLE_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_OTF_PORT, CHUCK_PARAM_OTF_PORT_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_OTF_PRINT_WARNINGS, CHUCK_PARAM_OTF_PRINT_WARNINGS_DEFAULT, ck_param_int );
@@ -204,6 +210,7 @@ void ChucK::initDefaultParams()
     initParam( CHUCK_PARAM_COMPILER_HIGHLIGHT_ON_ERROR, CHUCK_PARAM_COMPILER_HIGHLIGHT_ON_ERROR_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_TTY_COLOR, CHUCK_PARAM_TTY_COLOR_DEFAULT, ck_param_int );
     initParam( CHUCK_PARAM_TTY_WIDTH_HINT, CHUCK_PARAM_TTY_WIDTH_HINT_DEFAULT, ck_param_int );
+    initParam( CHUCK_PARAM_IMPORT_AUTO_RELOAD, CHUCK_PARAM_IMPORT_AUTO_RELOAD_DEFAULT, ck_param_int );
 
     // initialize list params manually (take care to use tolower())
     m_listParams[tolower(CHUCK_PARAM_USER_CHUGINS)]      = CHUCK_PARAM_USER_CHUGINS_DEFAULT;
@@ -555,6 +562,8 @@ t_CKBOOL ChucK::initVM()
     t_CKUINT ins = getParamInt( CHUCK_PARAM_INPUT_CHANNELS );
     t_CKUINT adaptiveSize = getParamInt( CHUCK_PARAM_VM_ADAPTIVE );
     t_CKBOOL halt = getParamInt( CHUCK_PARAM_VM_HALT ) != 0;
+    t_CKINT ugenThreads = getParamInt( CHUCK_PARAM_VM_UGEN_THREADS );
+    t_CKINT parallelMin = getParamInt( CHUCK_PARAM_VM_UGEN_PARALLEL_MIN );
 
     // instantiate VM
     m_carrier->vm = new Chuck_VM();
@@ -568,6 +577,9 @@ t_CKBOOL ChucK::initVM()
         EM_error2( 0, "%s", m_carrier->vm->last_error() );
         return false;
     }
+    // tick independent ugen subgraphs in parallel (block mode only) | 1.5.5.3
+    m_carrier->vm->shreduler()->m_ugen_schedule.set_parallel(
+        ugenThreads > 0 ? ugenThreads : 0, parallelMin > 0 ? parallelMin : 0 );
 
     return true;
 }
@@ -1342,6 +1354,144 @@ error: // 1.5.0.0 (ge) added
 
 
 
+//-----------------------------------------------------------------------------
+// name: compileCodeToBytecode() | 1.5.5.3 (added)
+// desc: compile code and save it as a bytecode image without running it
+//-----------------------------------------------------------------------------
+t_CKBOOL ChucK::compileCodeToBytecode( const std::string & code, std::string & image,
+                                       const std::string & optFilepath )
+{
+    // sanity check
+    if( !m_carrier->compiler )
+    {
+        // error
+        EM_error2( 0, "compileCodeToBytecode() invoked before initialization..." );
+        return FALSE;
+    }
+
+    // return value
+    t_CKBOOL ret = FALSE;
+
+    //-------------------------------------------------------------------------
+    // set origin hint
+    m_carrier->compiler->m_originHint = ckte_origin_USERDEFINED;
+    //-------------------------------------------------------------------------
+
+    // log
+    EM_log( CK_LOG_FINE, "compiling code from string to bytecode..." );
+    // push indent
+    EM_pushlog();
+
+    // parse, type-check, and emit
+    if( m_carrier->compiler->compileCode( code, optFilepath ) )
+    {
+        // name it as compileCode() would
+        m_carrier->compiler->output()->name = CHUCK_CODE_LITERAL_SIGNIFIER;
+        // save; if the code can't be represented (e.g., it defines classes
+        // or uses @import), ship the source, which loadBytecode() compiles
+        if( !m_carrier->compiler->saveBytecode( image ) )
+        {
+            EM_log( CK_LOG_WARNING, "bytecode: program not precompiled; saving source image (compiled when loaded)" );
+            bytecode_wrap_source( code, optFilepath, image );
+        }
+        ret = TRUE;
+    }
+
+    // pop indent
+    EM_poplog();
+    // unset origin hint
+    m_carrier->compiler->m_originHint = ckte_origin_UNKNOWN;
+
+    return ret;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: loadBytecode() | 1.5.5.3 (added)
+// desc: load a bytecode image and spork it as new shred(s)
+//-----------------------------------------------------------------------------
+t_CKBOOL ChucK::loadBytecode( const std::string & image, const std::string & argsTogether,
+                              t_CKUINT count, t_CKBOOL immediate,
+                              std::vector<t_CKUINT> * shredIDs )
+{
+    // clear
+    if( shredIDs ) shredIDs->clear();
+
+    // sanity check
+    if( !m_carrier->compiler )
+    {
+        // error
+        EM_error2( 0, "loadBytecode() invoked before initialization..." );
+        return FALSE;
+    }
+
+    std::vector<std::string> args;
+    Chuck_VM_Code * vm_code = NULL;
+    Chuck_VM_Shred * shred = NULL;
+
+    // same argument handling as compileCode()
+    std::string theThing = std::string(CHUCK_CODE_LITERAL_SIGNIFIER) + ":" + argsTogether;
+    std::string fakefakeFilename = "<result file name goes here>";
+
+    // parse out command line arguments
+    if( !extract_args( theThing, fakefakeFilename, args ) )
+    {
+        // error
+        EM_error2( 0, "malformed filename with argument list..." );
+        EM_error2( 0, "    -->  '%s'", theThing.c_str() );
+        return FALSE;
+    }
+
+    // source image (see compileCodeToBytecode()); compile it
+    std::string source, filepath;
+    if( bytecode_unwrap_source( image, source, filepath ) )
+        return this->compileCode( source, argsTogether, count, immediate, shredIDs, filepath );
+
+    // load in place of parse, type-check, and emit
+    if( !m_carrier->compiler->loadBytecode( image ) )
+        return FALSE;
+
+    // get the code
+    vm_code = m_carrier->compiler->output();
+
+    // log
+    EM_log( CK_LOG_FINE, "sporking %d %s from bytecode...", count,
+            count == 1 ? "instance" : "instances" );
+
+    // spork it
+    while( count > 0 )
+    {
+        // spork shred from code; shredule immediately or deferred
+        shred = m_carrier->vm->spork( vm_code, NULL, immediate );
+        // add args
+        shred->args = args;
+        // append the new ID
+        if( shredIDs ) shredIDs->push_back( shred->xid );
+        // decrement count
+        count--;
+    }
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: isSourceImage() | 1.5.5.3 (added)
+// desc: whether an image from compileCodeToBytecode() holds only source,
+//       i.e., was not precompiled
+//-----------------------------------------------------------------------------
+t_CKBOOL ChucK::isSourceImage( const std::string & image )
+{
+    return bytecode_is_source( image );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: start()
 // desc: start chuck instance
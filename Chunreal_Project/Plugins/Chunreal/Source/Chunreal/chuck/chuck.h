@@ -89,6 +89,8 @@
 #define CHUCK_PARAM_OUTPUT_CHANNELS             "OUTPUT_CHANNELS"
 #define CHUCK_PARAM_VM_ADAPTIVE                 "VM_ADAPTIVE"
 #define CHUCK_PARAM_VM_HALT                     "VM_HALT"
+#define CHUCK_PARAM_VM_UGEN_THREADS             "VM_UGEN_THREADS"
+#define CHUCK_PARAM_VM_UGEN_PARALLEL_MIN        "VM_UGEN_PARALLEL_MIN"
 #define CHUCK_PARAM_OTF_ENABLE                  "OTF_ENABLE"
 #define CHUCK_PARAM_OTF_PORT                    "OTF_PORT"
 #define CHUCK_PARAM_OTF_PRINT_WARNINGS          "OTF_PRINT_WARNINGS"
@@ -107,6 +109,7 @@
 #define CHUCK_PARAM_IMPORT_PATH_SYSTEM          "IMPORT_PATH_SYSTEM"
 #define CHUCK_PARAM_IMPORT_PATH_PACKAGES        "IMPORT_PATH_PACKAGES"
 #define CHUCK_PARAM_IMPORT_PATH_USER            "IMPORT_PATH_USER"
+#define CHUCK_PARAM_IMPORT_AUTO_RELOAD          "IMPORT_AUTO_RELOAD"
 
 // code literal signifier
 #define CHUCK_CODE_LITERAL_SIGNIFIER            "<compiled.code>"
@@ -170,6 +173,21 @@ public:
                           t_CKUINT count = 1, t_CKBOOL immediate = FALSE, std::vector<t_CKUINT> * shredIDs = NULL,
                           const std::string & optFilepath = "" );
 
+public: // precompiled bytecode images | 1.5.5.3 (added)
+    // compile code/text -> generate chuck bytecode -> save as a bytecode image (no shreds sporked)
+    // returns FALSE if compilation fails; only self-contained programs are precompiled: one that
+    // defines classes or uses @import is saved as a source image instead, which is NOT compiled
+    // ahead of time (loading it runs the full compiler); see isSourceImage()
+    t_CKBOOL compileCodeToBytecode( const std::string & code, std::string & image,
+                                    const std::string & optFilepath = "" );
+    // load a bytecode image from compileCodeToBytecode() -> spork as new shred(s)
+    // the image must come from the same chuck version, platform, and sample rate; arguments as in compileCode()
+    // a source image is compiled, as by compileCode()
+    t_CKBOOL loadBytecode( const std::string & image, const std::string & argsTogether = "",
+                           t_CKUINT count = 1, t_CKBOOL immediate = FALSE, std::vector<t_CKUINT> * shredIDs = NULL );
+    // whether an image from compileCodeToBytecode() holds only source (e.g., for a cook step to report it)
+    static t_CKBOOL isSourceImage( const std::string & image );
+
 public:
     // run ChucK and synthesize audio for `numFrames`...
     //   |- (NOTE this function is often called from audio callback)
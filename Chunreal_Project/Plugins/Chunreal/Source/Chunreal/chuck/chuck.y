@@ -43,16 +43,6 @@
 #include <stdio.h>
 #include <string.h>
 
-// function
-int yylex( void );
-
-void yyerror( char * s )
-{
-    EM_error( EM_tokPos, "%s", s );
-}
-
-a_Program g_program = NULL;
-
 %}
 
 //-----------------------------------------------------------------------------
@@ -66,6 +56,15 @@ a_Program g_program = NULL;
 // advanced uses of bison / make things less singleton-esque
 // https://www.lrde.epita.fr/~tiger/doc/gnuprog2/Advanced-Use-of-Bison.html
 //-----------------------------------------------------------------------------
+// pure parser | 1.5.5.3
+// no globals: yyparse() takes the scanner and passes it to every yylex();
+// the program is left in the scanner's parse state (see a_Parse), so any
+// number of parses can run at once
+%define api.pure full
+%param { void * scanner }
+// same initial location as the non-pure parser
+%initial-action { @$.first_column = @$.last_column = 0; }
+//-----------------------------------------------------------------------------
 // uncomment line below for more informative error messages
 // %error-verbose
 // [test1.ck]:line(5).char(9): syntax error, unexpected ID, expecting COMMA or SEMICOLON
@@ -102,6 +101,19 @@ a_Program g_program = NULL;
     a_Doc doc; // 1.5.4.4 (ge) added
 };
 
+%code
+{
+// the scanner (chuck.lex)
+int yylex( YYSTYPE * lval, YYLTYPE * lloc, void * scanner );
+// the parse state the scanner was made with
+a_Parse yyget_extra( void * scanner );
+
+void yyerror( YYLTYPE * loc, void * scanner, const char * s )
+{
+    EM_error( EM_tokPos, "%s", s );
+}
+}
+
 // expect shift/reduce conflicts
 // 1.3.3.0: changed to 38 for char literal - spencer
 // 1.3.5.3: changed to 39 for vec literal
@@ -213,8 +225,8 @@ a_Program g_program = NULL;
 %%
 
 program
-        : program_section                   { $$ = g_program = new_program( $1, @1.first_line, @1.first_column ); }
-        | program program_section           { $$ = g_program = append_program( $1, $2, @1.first_line, @1.first_column ); }
+        : program_section                   { $$ = yyget_extra( scanner )->program = new_program( $1, @1.first_line, @1.first_column ); }
+        | program program_section           { $$ = yyget_extra( scanner )->program = append_program( $1, $2, @1.first_line, @1.first_column ); }
         ;
         
 program_section
@@ -38,6 +38,124 @@
 #include <string> // 1.5.1.5 for string concat
 
 
+
+
+//-----------------------------------------------------------------------------
+// AST arena | 1.5.5.3
+//-----------------------------------------------------------------------------
+// size of the first chunk; each further chunk doubles, up to the max
+#define CK_ARENA_CHUNK_MIN      (16*1024)
+#define CK_ARENA_CHUNK_MAX      (1024*1024)
+// alignment of every allocation
+#define CK_ARENA_ALIGN          16
+#define CK_ARENA_ROUND(n)       ( ((n) + (CK_ARENA_ALIGN-1)) & ~((size_t)CK_ARENA_ALIGN-1) )
+// free AST memory, unless it belongs to the current arena
+#define CK_AST_FREE(x)          do { if(x){ ast_free(x); (x) = NULL; } } while(0)
+
+// a contiguous block of arena memory; the header sits in front of the block
+struct a_Arena_Chunk_ { struct a_Arena_Chunk_ * prev; char * begin; char * end; };
+// the arena: a stack of chunks, bump-allocated from the most recent
+struct a_Arena_ { struct a_Arena_Chunk_ * chunks; char * next; char * end;
+                  size_t chunk_size; size_t used; size_t reserved; size_t allocs; };
+
+// arena current on this thread (NULL: allocate AST nodes from the heap)
+static CK_THREAD_LOCAL a_Arena g_ast_arena = NULL;
+
+a_Arena new_arena( void )
+{
+    a_Arena arena = (a_Arena)checked_malloc( sizeof( struct a_Arena_ ) );
+    arena->chunk_size = CK_ARENA_CHUNK_MIN;
+    return arena;
+}
+
+void delete_arena( a_Arena arena )
+{
+    if( !arena ) return;
+    // should not be current while deleted
+    if( g_ast_arena == arena ) g_ast_arena = NULL;
+
+    // log
+    EM_log( CK_LOG_FINE, "releasing AST arena [%p]: %lu allocations, %lu/%lu bytes used...",
+            (void *)arena, (unsigned long)arena->allocs, (unsigned long)arena->used,
+            (unsigned long)arena->reserved );
+
+    // one free per chunk
+    struct a_Arena_Chunk_ * chunk = arena->chunks, * prev = NULL;
+    while( chunk )
+    {
+        prev = chunk->prev;
+        free( chunk );
+        chunk = prev;
+    }
+    free( arena );
+}
+
+a_Arena arena_make_current( a_Arena arena )
+{
+    a_Arena prev = g_ast_arena;
+    g_ast_arena = arena;
+    return prev;
+}
+
+size_t arena_used( a_Arena arena ) { return arena ? arena->used : 0; }
+size_t arena_reserved( a_Arena arena ) { return arena ? arena->reserved : 0; }
+size_t arena_allocs( a_Arena arena ) { return arena ? arena->allocs : 0; }
+
+// bump-allocate len zeroed bytes from arena
+static void * arena_alloc( a_Arena arena, size_t len )
+{
+    len = CK_ARENA_ROUND( len );
+
+    // need a new chunk?
+    if( (size_t)(arena->end - arena->next) < len )
+    {
+        // oversized requests get a chunk of their own
+        size_t size = len > arena->chunk_size ? len : arena->chunk_size;
+        size_t header = CK_ARENA_ROUND( sizeof( struct a_Arena_Chunk_ ) );
+        // calloc: memory handed out must be zeroed, like checked_malloc()
+        struct a_Arena_Chunk_ * chunk = (struct a_Arena_Chunk_ *)checked_malloc( (t_CKINT)(header + size) );
+        chunk->begin = (char *)chunk + header;
+        chunk->end = chunk->begin + size;
+        chunk->prev = arena->chunks;
+        arena->chunks = chunk;
+        arena->next = chunk->begin;
+        arena->end = chunk->end;
+        arena->reserved += header + size;
+        // grow geometrically, so the chunk count stays logarithmic
+        if( arena->chunk_size < CK_ARENA_CHUNK_MAX ) arena->chunk_size *= 2;
+    }
+
+    void * p = arena->next;
+    arena->next += len;
+    arena->used += len;
+    arena->allocs++;
+    return p;
+}
+
+// does arena own p?
+static t_CKBOOL arena_owns( a_Arena arena, void * p )
+{
+    for( struct a_Arena_Chunk_ * chunk = arena->chunks; chunk; chunk = chunk->prev )
+        if( (char *)p >= chunk->begin && (char *)p < chunk->end ) return TRUE;
+    return FALSE;
+}
+
+void * ast_malloc( size_t len )
+{
+    // same contract as checked_malloc()
+    if( !len ) return NULL;
+    return g_ast_arena ? arena_alloc( g_ast_arena, len ) : checked_malloc( (t_CKINT)len );
+}
+
+void ast_free( void * p )
+{
+    if( !p ) return;
+    // arena memory is reclaimed with the arena
+    if( g_ast_arena && arena_owns( g_ast_arena, p ) ) return;
+    free( p );
+}
+
+
 // 1.5.0.5 (ge) option to include in case we need something from flex/bison
 // #include "chuck_yacc.h"
 // ASSUME: on systems where the lexer/parser is generated using flex/bison,
@@ -49,8 +167,8 @@
 //-----------------------------------------------------------------------------
 a_Program new_program( a_Section section, uint32_t lineNum, uint32_t posNum )
 {
-    // NB checked_malloc() zeros the allocated memory
-    a_Program a = (a_Program)checked_malloc( sizeof( struct a_Program_ ) );
+    // NB ast_malloc() zeros the allocated memory
+    a_Program a = (a_Program)ast_malloc( sizeof( struct a_Program_ ) );
     a->section = section;
     a->line = lineNum; a->where = posNum;
 
@@ -79,7 +197,7 @@ a_Program append_program( a_Program program, a_Section section, uint32_t lineNum
 
 a_Section new_section_stmt( a_Stmt_List list, uint32_t lineNum, uint32_t posNum )
 {
-    a_Section a = (a_Section)checked_malloc( sizeof( struct a_Section_ ) );
+    a_Section a = (a_Section)ast_malloc( sizeof( struct a_Section_ ) );
     a->s_type = ae_section_stmt;
     a->stmt_list = list;
     a->line = lineNum; a->where = posNum;
@@ -89,7 +207,7 @@ a_Section new_section_stmt( a_Stmt_List list, uint32_t lineNum, uint32_t posNum
 
 a_Section new_section_func_def( a_Func_Def func_def, uint32_t lineNum, uint32_t posNum )
 {
-    a_Section a = (a_Section)checked_malloc( sizeof( struct a_Section_) );
+    a_Section a = (a_Section)ast_malloc( sizeof( struct a_Section_) );
     a->s_type = ae_section_func;
     a->func_def = func_def;
     a->line = lineNum; a->where = posNum;
@@ -99,7 +217,7 @@ a_Section new_section_func_def( a_Func_Def func_def, uint32_t lineNum, uint32_t
 
 a_Section new_section_class_def( a_Class_Def class_def, uint32_t lineNum, uint32_t posNum )
 {
-    a_Section a = (a_Section)checked_malloc( sizeof( struct a_Section_) );
+    a_Section a = (a_Section)ast_malloc( sizeof( struct a_Section_) );
     a->s_type = ae_section_class;
     a->class_def = class_def;
     a->line = lineNum; a->where = posNum;
@@ -109,7 +227,7 @@ a_Section new_section_class_def( a_Class_Def class_def, uint32_t lineNum, uint32
 
 a_Stmt_List new_stmt_list( a_Stmt stmt, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt_List a = (a_Stmt_List)checked_malloc( sizeof( struct a_Stmt_List_ ) );
+    a_Stmt_List a = (a_Stmt_List)ast_malloc( sizeof( struct a_Stmt_List_ ) );
     a->stmt = stmt;
     a->next = NULL;
     a->line = lineNum; a->where = posNum;
@@ -142,7 +260,7 @@ a_Stmt_List append_stmt_list( a_Stmt_List stmt_list, a_Stmt stmt, uint32_t lineN
 
 a_Stmt new_stmt_from_expression( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_exp;
     a->stmt_exp = exp;
     a->line = lineNum; a->where = posNum;
@@ -152,7 +270,7 @@ a_Stmt new_stmt_from_expression( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 
 a_Stmt new_stmt_from_code( a_Stmt_List stmt_list, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_code;
     a->stmt_code.stmt_list = stmt_list;
     a->line = lineNum; a->where = posNum;
@@ -164,7 +282,7 @@ a_Stmt new_stmt_from_code( a_Stmt_List stmt_list, uint32_t lineNum, uint32_t pos
 
 a_Stmt new_stmt_from_if( a_Exp cond, a_Stmt if_body, a_Stmt else_body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_if;
     a->stmt_if.cond = cond;
     a->stmt_if.if_body = if_body;
@@ -178,7 +296,7 @@ a_Stmt new_stmt_from_if( a_Exp cond, a_Stmt if_body, a_Stmt else_body, uint32_t
 
 a_Stmt new_stmt_from_while( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_while;
     a->stmt_while.is_do = 0;
     a->stmt_while.cond = cond;
@@ -192,7 +310,7 @@ a_Stmt new_stmt_from_while( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32_t
 
 a_Stmt new_stmt_from_do_while( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_while;
     a->stmt_while.is_do = 1;
     a->stmt_while.cond = cond;
@@ -206,7 +324,7 @@ a_Stmt new_stmt_from_do_while( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32
 
 a_Stmt new_stmt_from_until( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_until;
     a->stmt_until.is_do = 0;
     a->stmt_until.cond = cond;
@@ -220,7 +338,7 @@ a_Stmt new_stmt_from_until( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32_t
 
 a_Stmt new_stmt_from_do_until( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_until;
     a->stmt_until.is_do = 1;
     a->stmt_until.cond = cond;
@@ -234,7 +352,7 @@ a_Stmt new_stmt_from_do_until( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32
 
 a_Stmt new_stmt_from_for( a_Stmt c1, a_Stmt c2, a_Exp c3, a_Stmt body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_for;
     a->stmt_for.c1 = c1;
     a->stmt_for.c2 = c2;
@@ -249,7 +367,7 @@ a_Stmt new_stmt_from_for( a_Stmt c1, a_Stmt c2, a_Exp c3, a_Stmt body, uint32_t
 
 a_Stmt new_stmt_from_foreach( a_Exp iter, a_Exp array, a_Stmt body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_foreach;
     a->stmt_foreach.theIter = iter;
     a->stmt_foreach.theArray = array;
@@ -263,7 +381,7 @@ a_Stmt new_stmt_from_foreach( a_Exp iter, a_Exp array, a_Stmt body, uint32_t lin
 
 a_Stmt new_stmt_from_loop( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_loop;
     a->stmt_loop.cond = cond;
     a->stmt_loop.body = body;
@@ -276,7 +394,7 @@ a_Stmt new_stmt_from_loop( a_Exp cond, a_Stmt body, uint32_t lineNum, uint32_t p
 
 a_Stmt new_stmt_from_switch( a_Exp val, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_switch;
     a->stmt_switch.val = val;
     a->line = lineNum; a->where = posNum;
@@ -288,7 +406,7 @@ a_Stmt new_stmt_from_switch( a_Exp val, uint32_t lineNum, uint32_t posNum )
 
 a_Stmt new_stmt_from_break( uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_break;
     a->line = lineNum; a->where = posNum;
     a->stmt_break.line = lineNum; a->stmt_break.where = posNum;
@@ -299,7 +417,7 @@ a_Stmt new_stmt_from_break( uint32_t lineNum, uint32_t posNum )
 
 a_Stmt new_stmt_from_continue( uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_continue;
     a->line = lineNum; a->where = posNum;
     a->stmt_continue.line = lineNum; a->stmt_continue.where = posNum;
@@ -310,7 +428,7 @@ a_Stmt new_stmt_from_continue( uint32_t lineNum, uint32_t posNum )
 
 a_Stmt new_stmt_from_return( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_return;
     a->stmt_return.val = exp;
     a->line = lineNum; a->where = posNum;
@@ -322,7 +440,7 @@ a_Stmt new_stmt_from_return( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 
 a_Stmt new_stmt_from_label( c_str xid, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_gotolabel;
     a->stmt_gotolabel.name = insert_symbol( xid );
     a->line = lineNum; a->where = posNum;
@@ -334,7 +452,7 @@ a_Stmt new_stmt_from_label( c_str xid, uint32_t lineNum, uint32_t posNum )
 
 a_Stmt new_stmt_from_case( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof( struct a_Stmt_ ) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof( struct a_Stmt_ ) );
     a->s_type = ae_stmt_case;
     a->stmt_case.exp = exp;
     a->line = lineNum; a->where = posNum;
@@ -346,7 +464,7 @@ a_Stmt new_stmt_from_case( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 
 a_Stmt new_stmt_from_import( a_Import list, uint32_t line, uint32_t where ) // 1.5.4.0 (ge) added
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof(struct a_Stmt_) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof(struct a_Stmt_) );
     a->s_type = ae_stmt_import;
     a->stmt_import.list = list;
     a->line = line; a->where = where;
@@ -358,7 +476,7 @@ a_Stmt new_stmt_from_import( a_Import list, uint32_t line, uint32_t where ) // 1
 
 a_Stmt new_stmt_from_doc( a_Doc list, uint32_t line, uint32_t where ) // 1.5.4.4 (ge) added
 {
-    a_Stmt a = (a_Stmt)checked_malloc( sizeof(struct a_Stmt_) );
+    a_Stmt a = (a_Stmt)ast_malloc( sizeof(struct a_Stmt_) );
     a->s_type = ae_stmt_doc;
     a->stmt_doc.list = list;
     a->line = line; a->where = where;
@@ -370,7 +488,7 @@ a_Stmt new_stmt_from_doc( a_Doc list, uint32_t line, uint32_t where ) // 1.5.4.4
 
 a_Import new_import( c_str str, a_Id_List list, uint32_t line, uint32_t where ) // 1.5.4.0 (ge) added
 {
-    a_Import a = (a_Import)checked_malloc( sizeof(struct a_Import_) );
+    a_Import a = (a_Import)ast_malloc( sizeof(struct a_Import_) );
 
     // check which option
     if( str )
@@ -395,7 +513,7 @@ a_Import new_import( c_str str, a_Id_List list, uint32_t line, uint32_t where )
         // sum of string lengths, +1 for null terminator
         size_t len = result.length() + 1;
         // allocate
-        char * sc = (char *)checked_malloc( len );
+        char * sc = (char *)ast_malloc( len );
         // copy
         strncpy( sc, result.c_str(), len );
         // set
@@ -418,7 +536,7 @@ a_Import prepend_import( a_Import target, a_Import list, uint32_t lineNum, uint3
 
 a_Doc new_doc( c_str str, uint32_t line, uint32_t where ) // 1.5.4.4 (ge) added
 {
-    a_Doc a = (a_Doc)checked_malloc( sizeof(struct a_Doc_) );
+    a_Doc a = (a_Doc)ast_malloc( sizeof(struct a_Doc_) );
 
     // copy allocated string pointer
     a->desc = str; // no strdup( str ); <-- str should have been allocated in alloc_str()
@@ -460,7 +578,7 @@ a_Exp append_expression( a_Exp list, a_Exp exp, uint32_t lineNum, uint32_t posNu
 
 a_Exp new_exp_from_binary( a_Exp lhs, ae_Operator oper, a_Exp rhs, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_binary;
     a->s_meta = ae_meta_value;
     a->binary.lhs = lhs;
@@ -475,7 +593,7 @@ a_Exp new_exp_from_binary( a_Exp lhs, ae_Operator oper, a_Exp rhs, uint32_t line
 
 a_Exp new_exp_from_unary( ae_Operator oper, a_Exp exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_unary;
     a->s_meta = exp->s_meta;
     a->unary.op = oper;
@@ -491,7 +609,7 @@ a_Exp new_exp_from_unary2( ae_Operator oper, a_Type_Decl type,
                            int ctor_invoked, a_Exp ctor_args, a_Array_Sub array,
                            uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_unary;
     a->s_meta = ae_meta_value;
     a->unary.op = oper;
@@ -508,7 +626,7 @@ a_Exp new_exp_from_unary2( ae_Operator oper, a_Type_Decl type,
 
 a_Exp new_exp_from_unary3( ae_Operator oper, a_Stmt code, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_unary;
     a->s_meta = ae_meta_value;
     a->unary.op = oper;
@@ -522,7 +640,7 @@ a_Exp new_exp_from_unary3( ae_Operator oper, a_Stmt code, uint32_t lineNum, uint
 
 a_Exp new_exp_from_cast( a_Type_Decl type, a_Exp exp, uint32_t lineNum, uint32_t posNum, uint32_t castPos )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_cast;
     a->s_meta = ae_meta_value;
     a->cast.type = type;
@@ -536,7 +654,7 @@ a_Exp new_exp_from_cast( a_Type_Decl type, a_Exp exp, uint32_t lineNum, uint32_t
 
 a_Exp new_exp_from_array( a_Exp base, a_Array_Sub indices, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_array;
     a->s_meta = ae_meta_var;
     a->array.base = base;
@@ -550,7 +668,7 @@ a_Exp new_exp_from_array( a_Exp base, a_Array_Sub indices, uint32_t lineNum, uin
 
 a_Exp new_exp_from_func_call( a_Exp base, a_Exp args, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_func_call;
     a->s_meta = ae_meta_value;
     a->func_call.func = base;
@@ -564,7 +682,7 @@ a_Exp new_exp_from_func_call( a_Exp base, a_Exp args, uint32_t lineNum, uint32_t
 
 a_Exp new_exp_from_member_dot( a_Exp base, c_str xid, uint32_t lineNum, uint32_t posNum, uint32_t memberPos )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_dot_member;
     a->s_meta = ae_meta_var;
     a->dot_member.base = base;
@@ -578,7 +696,7 @@ a_Exp new_exp_from_member_dot( a_Exp base, c_str xid, uint32_t lineNum, uint32_t
 
 a_Exp new_exp_from_postfix( a_Exp base, ae_Operator op, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_postfix;
     a->s_meta = ae_meta_var;
     a->postfix.exp = base;
@@ -592,7 +710,7 @@ a_Exp new_exp_from_postfix( a_Exp base, ae_Operator op, uint32_t lineNum, uint32
 
 a_Exp new_exp_from_dur( a_Exp base, a_Exp unit, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_dur;
     a->s_meta = ae_meta_value;
     a->dur.base = base;
@@ -606,7 +724,7 @@ a_Exp new_exp_from_dur( a_Exp base, a_Exp unit, uint32_t lineNum, uint32_t posNu
 
 a_Exp new_exp_from_id( c_str xid, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_var;
     a->primary.s_type = ae_primary_var;
@@ -620,7 +738,7 @@ a_Exp new_exp_from_id( c_str xid, uint32_t lineNum, uint32_t posNum )
 
 a_Exp new_exp_from_int( t_CKINT num, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_num;
@@ -634,7 +752,7 @@ a_Exp new_exp_from_int( t_CKINT num, uint32_t lineNum, uint32_t posNum )
 
 a_Exp new_exp_from_float( t_CKFLOAT num, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_float;
@@ -648,7 +766,7 @@ a_Exp new_exp_from_float( t_CKFLOAT num, uint32_t lineNum, uint32_t posNum )
 
 a_Exp new_exp_from_str( c_str str, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_str;
@@ -662,7 +780,7 @@ a_Exp new_exp_from_str( c_str str, uint32_t lineNum, uint32_t posNum )
 
 a_Exp new_exp_from_char( c_str chr, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_char;
@@ -676,7 +794,7 @@ a_Exp new_exp_from_char( c_str chr, uint32_t lineNum, uint32_t posNum )
 
 a_Exp new_exp_from_array_lit( a_Array_Sub exp_list, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_array;
@@ -690,7 +808,7 @@ a_Exp new_exp_from_array_lit( a_Array_Sub exp_list, uint32_t lineNum, uint32_t p
 
 a_Exp new_exp_from_if( a_Exp cond, a_Exp if_exp, a_Exp else_exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_if;
     a->s_meta = ( ( if_exp->s_meta == ae_meta_var &&
         else_exp->s_meta == ae_meta_var ) ? ae_meta_var : ae_meta_value );
@@ -723,7 +841,7 @@ a_Exp new_exp_decl_global( a_Type_Decl type, a_Var_Decl_List var_decl_list, int
 
 a_Exp new_exp_decl( a_Type_Decl type, a_Var_Decl_List var_decl_list, int is_static, int is_const, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_decl;
     a->s_meta = ae_meta_var;
     a->decl.type = type;
@@ -739,7 +857,7 @@ a_Exp new_exp_decl( a_Type_Decl type, a_Var_Decl_List var_decl_list, int is_stat
 
 a_Exp new_exp_from_hack( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_hack;
@@ -753,7 +871,7 @@ a_Exp new_exp_from_hack( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 
 a_Exp new_exp_from_complex( a_Complex exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_complex;
@@ -768,7 +886,7 @@ a_Exp new_exp_from_complex( a_Complex exp, uint32_t lineNum, uint32_t posNum )
 
 a_Exp new_exp_from_polar( a_Polar exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_polar;
@@ -783,7 +901,7 @@ a_Exp new_exp_from_polar( a_Polar exp, uint32_t lineNum, uint32_t posNum )
 
 a_Exp new_exp_from_vec( a_Vec exp, uint32_t lineNum, uint32_t posNum ) // ge: added 1.3.5.3
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_vec;
@@ -798,7 +916,7 @@ a_Exp new_exp_from_vec( a_Vec exp, uint32_t lineNum, uint32_t posNum ) // ge: ad
 
 a_Exp new_exp_from_nil( uint32_t lineNum, uint32_t posNum )
 {
-    a_Exp a = (a_Exp)checked_malloc( sizeof( struct a_Exp_ ) );
+    a_Exp a = (a_Exp)ast_malloc( sizeof( struct a_Exp_ ) );
     a->s_type = ae_exp_primary;
     a->s_meta = ae_meta_value;
     a->primary.s_type = ae_primary_nil;
@@ -811,7 +929,7 @@ a_Exp new_exp_from_nil( uint32_t lineNum, uint32_t posNum )
 
 a_Var_Decl new_var_decl( c_constr xid, int ctor_invoked, a_Exp ctor_args, a_Array_Sub array, uint32_t lineNum, uint32_t posNum )
 {
-    a_Var_Decl a = (a_Var_Decl)checked_malloc( sizeof( struct a_Var_Decl_ ) );
+    a_Var_Decl a = (a_Var_Decl)ast_malloc( sizeof( struct a_Var_Decl_ ) );
     a->xid = insert_symbol(xid);
     a->ctor.invoked = ctor_invoked;
     a->ctor.args = ctor_args;
@@ -823,7 +941,7 @@ a_Var_Decl new_var_decl( c_constr xid, int ctor_invoked, a_Exp ctor_args, a_Arra
 
 a_Var_Decl_List new_var_decl_list( a_Var_Decl var_decl, uint32_t lineNum, uint32_t posNum )
 {
-    a_Var_Decl_List a = (a_Var_Decl_List)checked_malloc(
+    a_Var_Decl_List a = (a_Var_Decl_List)ast_malloc(
         sizeof( struct a_Var_Decl_List_ ) );
     a->var_decl = var_decl;
     a->line = lineNum; a->where = posNum;
@@ -841,7 +959,7 @@ a_Var_Decl_List prepend_var_decl_list( a_Var_Decl var_decl, a_Var_Decl_List list
 
 a_Type_Decl new_type_decl( a_Id_List type, int ref, uint32_t lineNum, uint32_t posNum )
 {
-    a_Type_Decl a = (a_Type_Decl)checked_malloc(
+    a_Type_Decl a = (a_Type_Decl)ast_malloc(
         sizeof( struct a_Type_Decl_ ) );
     a->xid = type;
     a->ref = ref;
@@ -860,7 +978,7 @@ a_Type_Decl add_type_decl_array( a_Type_Decl a, a_Array_Sub array, uint32_t line
 
 a_Arg_List new_arg_list( a_Type_Decl type_decl, a_Var_Decl var_decl, uint32_t lineNum, uint32_t posNum )
 {
-    a_Arg_List a = (a_Arg_List)checked_malloc(
+    a_Arg_List a = (a_Arg_List)ast_malloc(
         sizeof( struct a_Arg_List_ ) );
     a->type_decl = type_decl;
     a->var_decl = var_decl;
@@ -885,7 +1003,7 @@ a_Func_Def new_func_def( ae_Keyword func_decl, ae_Keyword static_decl,
                          a_Arg_List arg_list, a_Stmt code,
                          uint32_t is_from_ast, uint32_t lineNum, uint32_t posNum )
 {
-    a_Func_Def a = (a_Func_Def)checked_malloc(
+    a_Func_Def a = (a_Func_Def)ast_malloc(
         sizeof( struct a_Func_Def_ ) );
     a->func_decl = func_decl;
     a->static_decl = static_decl;
@@ -908,7 +1026,7 @@ a_Func_Def new_op_overload( ae_Keyword func_decl, ae_Keyword static_decl,
                             uint32_t is_from_ast, uint32_t overload_post,
                             uint32_t lineNum, uint32_t posNum, uint32_t operPos )
 {
-    a_Func_Def a = (a_Func_Def)checked_malloc(
+    a_Func_Def a = (a_Func_Def)ast_malloc(
         sizeof( struct a_Func_Def_ ) );
     a->func_decl = func_decl;
     a->static_decl = static_decl;
@@ -930,7 +1048,7 @@ a_Func_Def new_op_overload( ae_Keyword func_decl, ae_Keyword static_decl,
 a_Class_Def new_class_def( ae_Keyword class_decl, a_Id_List name,
                            a_Class_Ext ext, a_Class_Body body, uint32_t lineNum, uint32_t posNum )
 {
-    a_Class_Def a = (a_Class_Def)checked_malloc( sizeof( struct a_Class_Def_ ) );
+    a_Class_Def a = (a_Class_Def)ast_malloc( sizeof( struct a_Class_Def_ ) );
     a->decl = class_decl;
     a->name = name;
     a->ext = ext;
@@ -951,7 +1069,7 @@ a_Class_Def new_iface_def( ae_Keyword class_decl, a_Id_List name,
 
 a_Class_Body new_class_body( a_Section section, uint32_t lineNum, uint32_t posNum )
 {
-    a_Class_Body a = (a_Class_Body)checked_malloc( sizeof( struct a_Class_Body_ ) );
+    a_Class_Body a = (a_Class_Body)ast_malloc( sizeof( struct a_Class_Body_ ) );
     a->section = section;
     a->line = lineNum; a->where = posNum;
 
@@ -969,7 +1087,7 @@ a_Class_Body prepend_class_body( a_Section section, a_Class_Body body, uint32_t
 
 a_Class_Ext new_class_ext( a_Id_List extend_id, a_Id_List impl_list, uint32_t lineNum, uint32_t posNum )
 {
-    a_Class_Ext a = (a_Class_Ext)checked_malloc( sizeof( struct a_Class_Ext_ ) );
+    a_Class_Ext a = (a_Class_Ext)ast_malloc( sizeof( struct a_Class_Ext_ ) );
     a->extend_id = extend_id;
     a->impl_list = impl_list;
     a->line = lineNum; a->where = posNum;
@@ -979,7 +1097,7 @@ a_Class_Ext new_class_ext( a_Id_List extend_id, a_Id_List impl_list, uint32_t li
 
 a_Id_List new_id_list( c_constr xid, uint32_t lineNum, uint32_t posNum /*, YYLTYPE * loc*/ )
 {
-    a_Id_List a = (a_Id_List)checked_malloc( sizeof( struct a_Id_List_ ) );
+    a_Id_List a = (a_Id_List)ast_malloc( sizeof( struct a_Id_List_ ) );
     a->xid = insert_symbol( xid );
     a->next = NULL;
     a->line = lineNum; a->where = posNum;
@@ -1001,7 +1119,7 @@ a_Id_List prepend_id_list( c_constr xid, a_Id_List list, uint32_t lineNum, uint3
 
 a_Array_Sub new_array_sub( a_Exp exp, uint32_t lineNum, uint32_t posNum )
 {
-    a_Array_Sub a = (a_Array_Sub)checked_malloc( sizeof( struct a_Array_Sub_ ) );
+    a_Array_Sub a = (a_Array_Sub)ast_malloc( sizeof( struct a_Array_Sub_ ) );
     a->exp_list = exp;
     a->depth = 1;
     a->line = lineNum; a->where = posNum;
@@ -1070,7 +1188,7 @@ error:
 
 a_Complex new_complex( a_Exp re, uint32_t lineNum, uint32_t posNum )
 {
-    a_Complex a = (a_Complex)checked_malloc( sizeof( struct a_Complex_ ) );
+    a_Complex a = (a_Complex)ast_malloc( sizeof( struct a_Complex_ ) );
     a->re = re;
     // NOTE: if this ever changes, make sure to also update delete_complex | 1.5.1.0
     if( re ) a->im = re->next;
@@ -1081,7 +1199,7 @@ a_Complex new_complex( a_Exp re, uint32_t lineNum, uint32_t posNum )
 
 a_Polar new_polar( a_Exp mod, uint32_t lineNum, uint32_t posNum )
 {
-    a_Polar a = (a_Polar)checked_malloc( sizeof( struct a_Polar_ ) );
+    a_Polar a = (a_Polar)ast_malloc( sizeof( struct a_Polar_ ) );
     a->mod = mod;
     // NOTE: if this ever changes, make sure to also update delete_polar | 1.5.1.0
     if( mod ) a->phase = mod->next;
@@ -1092,7 +1210,7 @@ a_Polar new_polar( a_Exp mod, uint32_t lineNum, uint32_t posNum )
 
 a_Vec new_vec( a_Exp e, uint32_t lineNum, uint32_t posNum ) // ge: added 1.3.5.3
 {
-    a_Vec a = (a_Vec)checked_malloc( sizeof( struct a_Vec_ ) );
+    a_Vec a = (a_Vec)ast_malloc( sizeof( struct a_Vec_ ) );
     a->args = e;
     while( e ) // count number of dims
     {
@@ -1239,7 +1357,7 @@ void delete_program( a_Program program )
         // get the next node before we delete this one
         next = program->next;
         // delete this one
-        CK_SAFE_FREE( program );
+        CK_AST_FREE( program );
         // move to the next one
         program = next;
     }
@@ -1257,7 +1375,7 @@ void delete_section( a_Section section )
     case ae_section_class: delete_class_def( section->class_def ); break;
     case ae_section_func: delete_func_def( section->func_def ); break;
     }
-    CK_SAFE_FREE( section );
+    CK_AST_FREE( section );
 }
 
 // delete stmt list
@@ -1277,7 +1395,7 @@ void delete_stmt_list( a_Stmt_List list )
         // get the next node before we delete this one
         next = list->next;
         // delete this one
-        CK_SAFE_FREE( list );
+        CK_AST_FREE( list );
         // move to the next
         list = next;
     }
@@ -1296,7 +1414,7 @@ void delete_class_def( a_Class_Def def )
     delete_id_list( def->name );
     delete_class_ext( def->ext );
     delete_class_body( def->body );
-    CK_SAFE_FREE( def );
+    CK_AST_FREE( def );
 }
 
 void delete_class_body( a_Class_Body body )
@@ -1306,7 +1424,7 @@ void delete_class_body( a_Class_Body body )
 
     delete_class_body( body->next );
     delete_section( body->section );
-    CK_SAFE_FREE( body );
+    CK_AST_FREE( body );
 }
 
 void delete_class_ext( a_Class_Ext ext )
@@ -1316,7 +1434,7 @@ void delete_class_ext( a_Class_Ext ext )
 
     delete_id_list( ext->extend_id );
     delete_id_list( ext->impl_list );
-    CK_SAFE_FREE( ext );
+    CK_AST_FREE( ext );
 }
 
 // delete func def
@@ -1340,7 +1458,7 @@ void delete_func_def( a_Func_Def def )
     delete_type_decl( def->type_decl );
     delete_arg_list( def->arg_list );
     delete_stmt( def->code );
-    CK_SAFE_FREE( def );
+    CK_AST_FREE( def );
 }
 
 void delete_iface_def( a_Class_Def def )
@@ -1409,7 +1527,7 @@ void delete_stmt( a_Stmt stmt )
         break;
     }
 
-    CK_SAFE_FREE( stmt );
+    CK_AST_FREE( stmt );
 }
 
 void delete_stmt_from_code( a_Stmt stmt )
@@ -1500,11 +1618,11 @@ void delete_stmt_from_import( a_Stmt stmt )
     while( i )
     {
         // delete the content
-        CK_SAFE_FREE( i->what );
+        CK_AST_FREE( i->what );
         // get next before we delete this one
         next = i->next;
         // delete the import target
-        CK_SAFE_FREE( i );
+        CK_AST_FREE( i );
         // move to the next one
         i = next;
     }
@@ -1521,11 +1639,11 @@ void delete_stmt_from_doc( a_Stmt stmt )
     while( i )
     {
         // delete the content
-        CK_SAFE_FREE( i->desc );
+        CK_AST_FREE( i->desc );
         // get next before we delete this one
         next = i->next;
         // delete the import target
-        CK_SAFE_FREE( i );
+        CK_AST_FREE( i );
         // move to the next one
         i = next;
     }
@@ -1645,7 +1763,7 @@ void delete_exp( a_Exp e )
         // get next exp before we delete this one
         next = e->next;
         // delete this one
-        CK_SAFE_FREE( e );
+        CK_AST_FREE( e );
         // move to the next one
         e = next;
     }
@@ -1753,14 +1871,14 @@ void delete_exp_from_str( a_Exp_Primary e )
 {
     EM_log( CK_LOG_FINEST, "deleting exp (primary str) [%p]...", (void *)e );
 
-    CK_SAFE_FREE( e->str );
+    CK_AST_FREE( e->str );
 }
 
 void delete_exp_from_char( a_Exp_Primary e )
 {
     EM_log( CK_LOG_FINEST, "deleting exp (primary char) [%p]...", (void *)e );
 
-    CK_SAFE_FREE( e->chr );
+    CK_AST_FREE( e->chr );
 }
 
 void delete_exp_from_array_lit( a_Exp_Primary e )
@@ -1804,7 +1922,7 @@ void delete_var_decl_list( a_Var_Decl_List list )
     delete_var_decl_list( list->next );
     EM_log( CK_LOG_FINEST, "deleting var decl list [%p] [next: %p]...", (void *)list, (void *)(list->next) );
     delete_var_decl( list->var_decl );
-    CK_SAFE_FREE( list );
+    CK_AST_FREE( list );
 }
 
 void delete_var_decl( a_Var_Decl decl )
@@ -1817,7 +1935,7 @@ void delete_var_decl( a_Var_Decl decl )
     // TODO: release reference ck_type
 
     delete_array_sub( decl->array );
-    CK_SAFE_FREE( decl );
+    CK_AST_FREE( decl );
 }
 
 void delete_type_decl( a_Type_Decl decl )
@@ -1827,7 +1945,7 @@ void delete_type_decl( a_Type_Decl decl )
 
     delete_id_list( decl->xid );
     delete_array_sub( decl->array );
-    CK_SAFE_FREE( decl );
+    CK_AST_FREE( decl );
 }
 
 void delete_arg_list( a_Arg_List list )
@@ -1837,7 +1955,7 @@ void delete_arg_list( a_Arg_List list )
     delete_arg_list( list->next );
     EM_log( CK_LOG_FINEST, "deleting arg list [%p] [next: %p]...", (void *)list, (void *)(list->next) );
     delete_type_decl( list->type_decl );
-    CK_SAFE_FREE( list );
+    CK_AST_FREE( list );
 }
 
 void delete_array_sub( a_Array_Sub sub )
@@ -1845,7 +1963,7 @@ void delete_array_sub( a_Array_Sub sub )
     if( !sub ) return;
     EM_log( CK_LOG_FINEST, "deleting type decl [%p]...", (void *)sub );
     delete_exp( sub->exp_list );
-    CK_SAFE_FREE( sub );
+    CK_AST_FREE( sub );
 }
 
 void delete_complex( a_Complex c )
@@ -1854,7 +1972,7 @@ void delete_complex( a_Complex c )
     delete_exp( c->re );
     // do not delete c->im, since it's just c->re->next
     // delete_exp( c->im );
-    CK_SAFE_FREE( c );
+    CK_AST_FREE( c );
 }
 
 void delete_polar( a_Polar p )
@@ -1863,14 +1981,14 @@ void delete_polar( a_Polar p )
     delete_exp( p->mod );
     // do not delete p->phase, since it's just c->re->next
     // delete_exp( p->phase );
-    CK_SAFE_FREE( p );
+    CK_AST_FREE( p );
 }
 
 void delete_vec( a_Vec v )
 {
     EM_log( CK_LOG_FINEST, "deleting vec [%p]...", (void *)v );
     delete_exp( v->args );
-    CK_SAFE_FREE( v );
+    CK_AST_FREE( v );
 }
 
 void delete_id_list( a_Id_List list )
@@ -1887,7 +2005,7 @@ void delete_id_list( a_Id_List list )
         // get next before we delete this
         next = list->next;
         // delete this one
-        CK_SAFE_FREE( list );
+        CK_AST_FREE( list );
         // move to the next one
         list = next;
     }
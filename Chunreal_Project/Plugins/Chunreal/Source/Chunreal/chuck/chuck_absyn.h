@@ -325,6 +325,45 @@ void delete_vec( a_Vec v );
 
 
 
+//------------------------------------------------------------------------------
+// AST arena | 1.5.5.3
+// a bump allocator that backs every node (and lexer string) created while one
+// compile target is parsed; the whole tree is reclaimed by delete_arena()
+// in one shot, instead of walking it with delete_program()
+//------------------------------------------------------------------------------
+typedef struct a_Arena_ * a_Arena;
+// allocate an empty arena
+a_Arena new_arena( void );
+// release an arena and everything allocated from it
+void delete_arena( a_Arena arena );
+// make arena current for AST allocations on this thread (NULL: heap);
+// returns the previously current arena, to be restored afterwards
+a_Arena arena_make_current( a_Arena arena );
+// bytes handed out / bytes reserved from the system / number of allocations
+size_t arena_used( a_Arena arena );
+size_t arena_reserved( a_Arena arena );
+size_t arena_allocs( a_Arena arena );
+// allocate zeroed AST memory (from the current arena, if any)
+void * ast_malloc( size_t len );
+// free AST memory (no-op for memory owned by the current arena)
+void ast_free( void * p );
+
+
+
+
+//------------------------------------------------------------------------------
+// parse state | 1.5.5.3
+// everything one parse works on: the reentrant scanner (its buffers, line,
+// and column) and the program the pure parser builds; chuck_parse() makes
+// one per compile and hands it to the scanner as its extra data, so parses
+// on different threads share nothing
+//------------------------------------------------------------------------------
+typedef struct a_Parse_ * a_Parse;
+struct a_Parse_ { void * scanner; a_Program program; };
+
+
+
+
 
 //------------------------------------------------------------------------------
 // helper structs
@@ -334,7 +373,9 @@ struct a_Ctor_Call_ { int invoked; a_Exp args; t_CKFUNC func; int primitive; };
 //------------------------------------------------------------------------------
 // abstract syntax tree | structs
 //------------------------------------------------------------------------------
-struct a_Exp_Binary_ { a_Exp lhs; ae_Operator op; a_Exp rhs; t_CKFUNC ck_func; t_CKFUNC ck_overload_func; uint32_t line; uint32_t where; a_Exp self; };
+struct a_Exp_Binary_ { a_Exp lhs; ae_Operator op; a_Exp rhs; t_CKFUNC ck_func; t_CKFUNC ck_overload_func; uint32_t line; uint32_t where; a_Exp self;
+                       // 1.5.5.3: lhs is a string temporary that can be appended to in place (see chuck_escape.h)
+                       int concat_in_place; };
 struct a_Exp_Cast_ { a_Type_Decl type; a_Exp exp; uint32_t line; uint32_t where; a_Exp self; };
 struct a_Exp_Unary_ { ae_Operator op; a_Exp exp; a_Type_Decl type; struct a_Ctor_Call_ ctor; a_Array_Sub array;
                       a_Stmt code; t_CKFUNC ck_overload_func; uint32_t line; uint32_t where; a_Exp self; };
@@ -353,6 +394,8 @@ struct a_Var_Decl_List_ { a_Var_Decl var_decl; a_Var_Decl_List next; uint32_t li
 struct a_Var_Decl_ { S_Symbol xid; struct a_Ctor_Call_ ctor;
                      a_Array_Sub array; t_CKVALUE value; void * addr; t_CKTYPE ck_type;
                      /* int is_auto; */ int ref; int force_ref;
+                     // 1.5.5.3: non-escaping local; instantiate from shred scratch storage (see chuck_escape.h)
+                     int scratch;
                      uint32_t line; uint32_t where; a_Exp self; };
 struct a_Type_Decl_ { a_Id_List xid; a_Array_Sub array; int ref; uint32_t line; uint32_t where; /*a_Exp self;*/ };
 struct a_Array_Sub_ { t_CKUINT depth; a_Exp exp_list; uint32_t line; uint32_t where; a_Exp self;
@@ -0,0 +1,1755 @@
+/*----------------------------------------------------------------------------
+  ChucK Strongly-timed Audio Programming Language
+    Compiler, Virtual Machine, and Synthesis Engine
+
+  Copyright (c) 2003 Ge Wang and Perry R. Cook. All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the dual-license terms of EITHER the MIT License OR the GNU
+  General Public License (the latter as published by the Free Software
+  Foundation; either version 2 of the License or, at your option, any
+  later version).
+
+  This program is distributed in the hope that it will be useful and/or
+  interesting, but WITHOUT ANY WARRANTY; without even the implied warranty
+  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  MIT Licence and/or the GNU General Public License for details.
+
+  You should have received a copy of the MIT License and the GNU General
+  Public License (GPL) along with this program; a copy of the GPL can also
+  be obtained by writing to the Free Software Foundation, Inc., 59 Temple
+  Place, Suite 330, Boston, MA 02111-1307 U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_bytecode.cpp
+// desc: versioned binary images of emitted VM code
+//
+//       image layout (integers are native t_CKUINT unless noted):
+//         header:  "CKBC", format version, sizeof(t_CKUINT), sizeof(t_CKFLOAT),
+//                  endian probe, sample rate (all 32-bit), chuck version
+//                  string
+//         tables:  instruction class names, types, static data, string
+//                  literals, number of codes, functions
+//         codes:   name, filename, stack depth, need_this, is_static, and
+//                  instructions as (class index, line, operands...)
+//       the first code is the program's top-level code; durations such as
+//       `second` are folded into instructions as samples, so an image only
+//       loads into a VM running at the sample rate it was built for
+//
+//       programs with classes or @import are not representable (the types
+//       they define would have to be rebuilt in the loading VM) and are not
+//       precompiled; for those a source image is written instead, which
+//       the loader compiles like any other source:
+//         "CKSC", format version, source length, source, path length,
+//         path (all 32-bit little-endian)
+//
+// date: Autumn 2026 | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#include "chuck_bytecode.h"
+#include "chuck_instr.h"
+#include "chuck_type.h"
+#include "chuck_vm.h"
+#include "chuck_oo.h"
+#include <map>
+#include <stdint.h>
+#include <string.h>
+using namespace std;
+
+
+// image magic
+#define CK_BYTECODE_MAGIC       "CKBC"
+// source image magic
+#define CK_BYTECODE_SOURCE_MAGIC "CKSC"
+// endianness probe (images are not portable across byte orders)
+#define CK_BYTECODE_ENDIAN      0x01020304
+// no index (null reference)
+#define CK_BYTECODE_NONE        ((t_CKUINT)-1)
+// deepest array type an image may name (a corrupt depth would otherwise
+// build a type with that many dimensions)
+#define CK_BYTECODE_MAX_DEPTH   64
+
+// code reference kinds
+enum { ck_bc_code_null = 0, ck_bc_code_image, ck_bc_code_pre_ctor, ck_bc_code_func };
+// function table entry kinds
+enum { ck_bc_func_named = 1, ck_bc_func_ctor, ck_bc_func_image };
+
+// forward reference
+struct Chuck_Bytecode_Codec;
+// operand writer for one instruction class
+typedef void (* f_bc_write)( Chuck_Bytecode_Codec & c, Chuck_Instr * instr );
+// operand reader for one instruction class; allocates the instruction
+typedef Chuck_Instr * (* f_bc_read)( Chuck_Bytecode_Codec & c );
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Bytecode_Op
+// desc: a serializable instruction class; images refer to classes by name,
+//       so the order of the table below is not part of the format
+//-----------------------------------------------------------------------------
+struct Chuck_Bytecode_Op
+{
+    const char * name;
+    f_bc_write write;
+    f_bc_read read;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Bytecode_Func
+// desc: function table entry, as written
+//-----------------------------------------------------------------------------
+struct Chuck_Bytecode_Func
+{
+    t_CKUINT kind;
+    // owner type index (named, ctor) or code index (image)
+    t_CKUINT index;
+    // position among overloads (named, ctor)
+    t_CKUINT ordinal;
+    // value name (named) or mangled name (image); base name (image)
+    std::string name;
+    std::string base_name;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Bytecode_Codec
+// desc: serializer/deserializer state; instructions with protected
+//       operands befriend this struct
+//-----------------------------------------------------------------------------
+struct Chuck_Bytecode_Codec
+{
+public:
+    Chuck_Bytecode_Codec( Chuck_Env * e )
+        : env(e), out(NULL), in(NULL), inLen(0), inPos(0),
+          proto(FALSE), ok(TRUE), scanned(FALSE) { }
+
+public:
+    // serialize `code` and everything it reaches
+    t_CKBOOL serialize( Chuck_VM_Code * code, std::string & image );
+    // deserialize an image
+    Chuck_VM_Code * deserialize( const std::string & image );
+
+public: // state
+    Chuck_Env * env;
+    // output buffer (writing)
+    std::string * out;
+    // input buffer (reading)
+    const char * in;
+    t_CKUINT inLen;
+    t_CKUINT inPos;
+    // prototype mode: readers get zeros and placeholders; used to make
+    // one throwaway instance of each class
+    t_CKBOOL proto;
+    // no error so far
+    t_CKBOOL ok;
+    // the first error
+    std::string error;
+
+public: // tables (types, codes, etc. are used by both directions)
+    std::vector<Chuck_Type *> types;
+    std::vector<Chuck_VM_Code *> codes;
+    std::vector<Chuck_String *> strings;
+    std::vector<Chuck_Func *> funcs;
+    std::vector<void *> datas;
+    // writing: pointer to index
+    std::map<Chuck_Type *, t_CKUINT> typeIndex;
+    std::map<Chuck_VM_Code *, t_CKUINT> codeIndex;
+    std::map<Chuck_String *, t_CKUINT> stringIndex;
+    std::map<Chuck_Func *, t_CKUINT> funcIndex;
+    std::map<void *, t_CKUINT> dataIndex;
+    // writing: table entries
+    std::vector<Chuck_Bytecode_Func> funcEntries;
+    std::vector< std::pair<t_CKUINT, std::string> > dataEntries;
+    // writing: instruction class (op table index) to image opcode
+    std::map<t_CKUINT, t_CKUINT> opcodeIndex;
+    std::vector<t_CKUINT> opcodes;
+    // writing: instructions of the current code, to their index
+    std::map<Chuck_Instr *, t_CKUINT> currIndex;
+    // reading: instructions decoded so far in the current code, and their class
+    std::vector<Chuck_Instr *> currInstr;
+    std::vector<t_CKUINT> currOp;
+
+    // writing: type system entities that instructions may point at
+    t_CKBOOL scanned;
+    std::map<Chuck_VM_Code *, Chuck_Type *> preCtorOwner;
+    std::map<Chuck_VM_Code *, Chuck_Func *> codeFunc;
+    std::map<void *, Chuck_Value *> staticData;
+
+public: // primitives
+    void fail( const std::string & why )
+    { if( ok ) { ok = FALSE; error = why; } }
+    void put( const void * p, t_CKUINT n )
+    { out->append( (const char *)p, n ); }
+    void get( void * p, t_CKUINT n )
+    {
+        if( proto || !ok || n > inLen - inPos )
+        { if( !proto ) fail( "image is truncated" ); memset( p, 0, n ); return; }
+        memcpy( p, in + inPos, n ); inPos += n;
+    }
+    void wu( t_CKUINT v ) { put( &v, sizeof(v) ); }
+    t_CKUINT ru() { t_CKUINT v; get( &v, sizeof(v) ); return v; }
+    void wf( t_CKFLOAT v ) { put( &v, sizeof(v) ); }
+    t_CKFLOAT rf() { t_CKFLOAT v; get( &v, sizeof(v) ); return v; }
+    void ws( const std::string & s ) { wu( s.size() ); put( s.data(), s.size() ); }
+    std::string rs()
+    {
+        t_CKUINT n = ru();
+        if( proto || !ok ) return "";
+        if( n > inLen - inPos ) { fail( "image is truncated" ); return ""; }
+        std::string s( in + inPos, n ); inPos += n; return s;
+    }
+    // a table size; each entry takes at least one byte, so anything
+    // larger than what is left is corrupt
+    t_CKUINT rcount()
+    {
+        t_CKUINT n = ru();
+        if( ok && n > inLen - inPos ) { fail( "image is corrupt" ); return 0; }
+        return n;
+    }
+
+public: // references
+    t_CKUINT typeRef( Chuck_Type * t );
+    t_CKUINT funcRef( Chuck_Func * f );
+    t_CKUINT codeRef( Chuck_VM_Code * code );
+    void scan();
+    void wtype( Chuck_Type * t ) { wu( t ? typeRef( t ) : CK_BYTECODE_NONE ); }
+    Chuck_Type * rtype();
+    void wfunc( Chuck_Func * f ) { wu( f ? funcRef( f ) : CK_BYTECODE_NONE ); }
+    Chuck_Func * rfunc();
+    void wcode( Chuck_VM_Code * code );
+    Chuck_VM_Code * rcode();
+    void wstring( Chuck_String * s );
+    Chuck_String * rstring();
+    void wdata( void * addr );
+    void * rdata();
+    void wstmt( Chuck_Instr * start );
+    Chuck_Instr_Stmt_Start * rstmt();
+
+public: // operand readers/writers, one pair per operand layout
+    // no operands
+    static void w_none( Chuck_Bytecode_Codec & c, Chuck_Instr * i ) { }
+    template <class T> static Chuck_Instr * r_none( Chuck_Bytecode_Codec & c )
+    { return new T; }
+    // Chuck_Instr_Unary_Op::m_val
+    static void w_uint( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+    { c.wu( ((Chuck_Instr_Unary_Op *)i)->m_val ); }
+    template <class T> static Chuck_Instr * r_uint( Chuck_Bytecode_Codec & c )
+    { return new T( c.ru() ); }
+    template <class T> static Chuck_Instr * r_uint_set( Chuck_Bytecode_Codec & c )
+    { T * t = new T; t->set( c.ru() ); return t; }
+    // Chuck_Instr_Unary_Op2::m_val
+    static void w_float( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+    { c.wf( ((Chuck_Instr_Unary_Op2 *)i)->m_val ); }
+    template <class T> static Chuck_Instr * r_float( Chuck_Bytecode_Codec & c )
+    { return new T( c.rf() ); }
+    // Chuck_Instr_Branch_Op::m_jmp
+    static void w_jump( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+    { c.wu( ((Chuck_Instr_Branch_Op *)i)->m_jmp ); }
+    template <class T> static Chuck_Instr * r_jump( Chuck_Bytecode_Codec & c )
+    { return new T( c.ru() ); }
+    // stack offset + use global base
+    template <class T> static void w_mem( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+    { T * t = (T *)i; c.wu( t->m_val ); c.wu( t->base ); }
+    template <class T> static Chuck_Instr * r_mem( Chuck_Bytecode_Codec & c )
+    { t_CKUINT v = c.ru(); t_CKBOOL b = (t_CKBOOL)c.ru(); return new T( v, b ); }
+    // global name + type
+    template <class T> static void w_global( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+    { T * t = (T *)i; c.ws( t->m_name ); c.wu( t->m_type ); }
+    template <class T> static Chuck_Instr * r_global( Chuck_Bytecode_Codec & c )
+    { std::string n = c.rs(); te_GlobalType g = (te_GlobalType)c.ru(); return new T( n, g ); }
+    // object type
+    template <class T> static void w_objtype( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+    { c.wtype( ((T *)i)->type ); }
+    template <class T> static Chuck_Instr * r_objtype( Chuck_Bytecode_Codec & c )
+    { return new T( c.rtype() ); }
+    // dot compare (vec/complex fields)
+    template <class T> static void w_dotcmp( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+    { T * t = (T *)i; c.wu( t->m_is_mem ); c.wu( t->m_emit_addr ); c.wu( t->m_kind ); }
+    template <class T> static Chuck_Instr * r_dotcmp( Chuck_Bytecode_Codec & c )
+    { t_CKUINT m = c.ru(); t_CKUINT e = c.ru(); te_KindOf k = (te_KindOf)c.ru(); return new T( m, e, k ); }
+
+    // everything else
+    static void w_push_imm( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_push_imm( Chuck_Bytecode_Codec & c );
+    static void w_push_imm4( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_push_imm4( Chuck_Bytecode_Codec & c );
+    static void w_push_code( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_push_code( Chuck_Bytecode_Codec & c );
+    static void w_mem_set_imm( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_mem_set_imm( Chuck_Bytecode_Codec & c );
+    static void w_mem_set_imm2( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_mem_set_imm2( Chuck_Bytecode_Codec & c );
+    static void w_alloc_word( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_alloc_word( Chuck_Bytecode_Codec & c );
+    static void w_alloc_global( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_alloc_global( Chuck_Bytecode_Codec & c );
+    static void w_pre_ctor( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_pre_ctor( Chuck_Bytecode_Codec & c );
+    static void w_pre_ctor_array_top( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_pre_ctor_array_top( Chuck_Bytecode_Codec & c );
+    static void w_func_call( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_func_call( Chuck_Bytecode_Codec & c );
+    static void w_func_call_member( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_func_call_member( Chuck_Bytecode_Codec & c );
+    static void w_func_call_static( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_func_call_static( Chuck_Bytecode_Codec & c );
+    static void w_func_call_global( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_func_call_global( Chuck_Bytecode_Codec & c );
+    static void w_stmt_start( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_stmt_start( Chuck_Bytecode_Codec & c );
+    static void w_stmt_remember( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_stmt_remember( Chuck_Bytecode_Codec & c );
+    static void w_stmt_cleanup( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_stmt_cleanup( Chuck_Bytecode_Codec & c );
+    static void w_array_init( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_array_init( Chuck_Bytecode_Codec & c );
+    static void w_array_alloc( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_array_alloc( Chuck_Bytecode_Codec & c );
+    static void w_array_access( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_array_access( Chuck_Bytecode_Codec & c );
+    static void w_array_map_access( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_array_map_access( Chuck_Bytecode_Codec & c );
+    static void w_array_access_multi( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_array_access_multi( Chuck_Bytecode_Codec & c );
+    static void w_dot_member_data( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_dot_member_data( Chuck_Bytecode_Codec & c );
+    static void w_dot_member_func( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_dot_member_func( Chuck_Bytecode_Codec & c );
+    static void w_dot_member_func_call( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_dot_member_func_call( Chuck_Bytecode_Codec & c );
+    static void w_dot_primitive_func( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_dot_primitive_func( Chuck_Bytecode_Codec & c );
+    static void w_dot_static_data( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_dot_static_data( Chuck_Bytecode_Codec & c );
+    static void w_dot_static_import( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_dot_static_import( Chuck_Bytecode_Codec & c );
+    static void w_dot_static_func( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_dot_static_func( Chuck_Bytecode_Codec & c );
+    static void w_ugen_link( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_ugen_link( Chuck_Bytecode_Codec & c );
+    static void w_ugen_array_link( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_ugen_array_link( Chuck_Bytecode_Codec & c );
+    static void w_cast_verify( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_cast_verify( Chuck_Bytecode_Codec & c );
+    static void w_foreach( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_foreach( Chuck_Bytecode_Codec & c );
+    static void w_hack( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_hack( Chuck_Bytecode_Codec & c );
+    static void w_gack( Chuck_Bytecode_Codec & c, Chuck_Instr * i );
+    static Chuck_Instr * r_gack( Chuck_Bytecode_Codec & c );
+
+protected:
+    // write one code
+    void writeCode( Chuck_VM_Code * code );
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// the instruction classes that can be serialized; anything else (e.g.,
+// instructions that only appear inside class definitions, or that carry
+// raw addresses) makes serialization fail
+//-----------------------------------------------------------------------------
+#define CK_BC_OP( x, w, r ) { "Chuck_Instr_" #x, w, r }
+#define CK_BC_NONE( x )     CK_BC_OP( x, Chuck_Bytecode_Codec::w_none, Chuck_Bytecode_Codec::r_none<Chuck_Instr_##x> )
+#define CK_BC_UINT( x )     CK_BC_OP( x, Chuck_Bytecode_Codec::w_uint, Chuck_Bytecode_Codec::r_uint<Chuck_Instr_##x> )
+#define CK_BC_UINT_SET( x ) CK_BC_OP( x, Chuck_Bytecode_Codec::w_uint, Chuck_Bytecode_Codec::r_uint_set<Chuck_Instr_##x> )
+#define CK_BC_FLOAT( x )    CK_BC_OP( x, Chuck_Bytecode_Codec::w_float, Chuck_Bytecode_Codec::r_float<Chuck_Instr_##x> )
+#define CK_BC_JUMP( x )     CK_BC_OP( x, Chuck_Bytecode_Codec::w_jump, Chuck_Bytecode_Codec::r_jump<Chuck_Instr_##x> )
+#define CK_BC_MEM( x )      CK_BC_OP( x, Chuck_Bytecode_Codec::w_mem<Chuck_Instr_##x>, Chuck_Bytecode_Codec::r_mem<Chuck_Instr_##x> )
+#define CK_BC_GLOBAL( x )   CK_BC_OP( x, Chuck_Bytecode_Codec::w_global<Chuck_Instr_##x>, Chuck_Bytecode_Codec::r_global<Chuck_Instr_##x> )
+#define CK_BC_OBJTYPE( x )  CK_BC_OP( x, Chuck_Bytecode_Codec::w_objtype<Chuck_Instr_##x>, Chuck_Bytecode_Codec::r_objtype<Chuck_Instr_##x> )
+#define CK_BC_DOTCMP( x )   CK_BC_OP( x, Chuck_Bytecode_Codec::w_dotcmp<Chuck_Instr_##x>, Chuck_Bytecode_Codec::r_dotcmp<Chuck_Instr_##x> )
+#define CK_BC_CUSTOM( x, n ) CK_BC_OP( x, Chuck_Bytecode_Codec::w_##n, Chuck_Bytecode_Codec::r_##n )
+
+static const Chuck_Bytecode_Op g_bytecode_ops[] =
+{
+    // no operands
+    CK_BC_NONE( Add_int ),
+    CK_BC_NONE( PreInc_int ),
+    CK_BC_NONE( PostInc_int ),
+    CK_BC_NONE( PreDec_int ),
+    CK_BC_NONE( PostDec_int ),
+    CK_BC_NONE( Complement_int ),
+    CK_BC_NONE( Mod_int ),
+    CK_BC_NONE( Mod_int_Reverse ),
+    CK_BC_NONE( Minus_int ),
+    CK_BC_NONE( Minus_int_Reverse ),
+    CK_BC_NONE( Times_int ),
+    CK_BC_NONE( Divide_int ),
+    CK_BC_NONE( Divide_int_Reverse ),
+    CK_BC_NONE( Add_double ),
+    CK_BC_NONE( Minus_double ),
+    CK_BC_NONE( Minus_double_Reverse ),
+    CK_BC_NONE( Times_double ),
+    CK_BC_NONE( Divide_double ),
+    CK_BC_NONE( Divide_double_Reverse ),
+    CK_BC_NONE( Mod_double ),
+    CK_BC_NONE( Mod_double_Reverse ),
+    CK_BC_NONE( Add_complex ),
+    CK_BC_NONE( Minus_complex ),
+    CK_BC_NONE( Minus_complex_Reverse ),
+    CK_BC_NONE( Times_complex ),
+    CK_BC_NONE( Divide_complex ),
+    CK_BC_NONE( Divide_complex_Reverse ),
+    CK_BC_NONE( Add_polar ),
+    CK_BC_NONE( Minus_polar ),
+    CK_BC_NONE( Minus_polar_Reverse ),
+    CK_BC_NONE( Times_polar ),
+    CK_BC_NONE( Divide_polar ),
+    CK_BC_NONE( Divide_polar_Reverse ),
+    CK_BC_NONE( Add_vec2 ),
+    CK_BC_NONE( Minus_vec2 ),
+    CK_BC_NONE( float_Times_vec2 ),
+    CK_BC_NONE( vec2_Times_float ),
+    CK_BC_NONE( vec2_Divide_float ),
+    CK_BC_NONE( Add_vec3 ),
+    CK_BC_NONE( Minus_vec3 ),
+    CK_BC_NONE( XProduct_vec3 ),
+    CK_BC_NONE( Add_vec4 ),
+    CK_BC_NONE( Minus_vec4 ),
+    CK_BC_NONE( XProduct_vec4 ),
+    CK_BC_NONE( float_Times_vec3 ),
+    CK_BC_NONE( vec3_Times_float ),
+    CK_BC_NONE( vec3_Divide_float ),
+    CK_BC_NONE( float_Times_vec4 ),
+    CK_BC_NONE( vec4_Times_float ),
+    CK_BC_NONE( vec4_Divide_float ),
+    CK_BC_NONE( Add_int_Assign ),
+    CK_BC_NONE( Mod_int_Assign ),
+    CK_BC_NONE( Minus_int_Assign ),
+    CK_BC_NONE( Times_int_Assign ),
+    CK_BC_NONE( Divide_int_Assign ),
+    CK_BC_NONE( Add_double_Assign ),
+    CK_BC_NONE( Minus_double_Assign ),
+    CK_BC_NONE( Times_double_Assign ),
+    CK_BC_NONE( Divide_double_Assign ),
+    CK_BC_NONE( Mod_double_Assign ),
+    CK_BC_NONE( Add_complex_Assign ),
+    CK_BC_NONE( Minus_complex_Assign ),
+    CK_BC_NONE( Times_complex_Assign ),
+    CK_BC_NONE( Divide_complex_Assign ),
+    CK_BC_NONE( Add_polar_Assign ),
+    CK_BC_NONE( Minus_polar_Assign ),
+    CK_BC_NONE( Times_polar_Assign ),
+    CK_BC_NONE( Divide_polar_Assign ),
+    CK_BC_NONE( Add_vec2_Assign ),
+    CK_BC_NONE( Minus_vec2_Assign ),
+    CK_BC_NONE( Add_vec3_Assign ),
+    CK_BC_NONE( Minus_vec3_Assign ),
+    CK_BC_NONE( Add_vec4_Assign ),
+    CK_BC_NONE( Minus_vec4_Assign ),
+    CK_BC_NONE( float_Times_vec2_Assign ),
+    CK_BC_NONE( float_Times_vec3_Assign ),
+    CK_BC_NONE( float_Times_vec4_Assign ),
+    CK_BC_NONE( vec2_Divide_float_Assign ),
+    CK_BC_NONE( vec3_Divide_float_Assign ),
+    CK_BC_NONE( vec4_Divide_float_Assign ),
+    CK_BC_NONE( Add_string_Assign ),
+    CK_BC_NONE( Add_string_int ),
+    CK_BC_NONE( Add_string_float ),
+    CK_BC_NONE( Add_int_string ),
+    CK_BC_NONE( Add_float_string ),
+    CK_BC_NONE( Add_int_string_Assign ),
+    CK_BC_NONE( Add_float_string_Assign ),
+    CK_BC_NONE( Lt_int ),
+    CK_BC_NONE( Gt_int ),
+    CK_BC_NONE( Le_int ),
+    CK_BC_NONE( Ge_int ),
+    CK_BC_NONE( Eq_int ),
+    CK_BC_NONE( Neq_int ),
+    CK_BC_NONE( Not_int ),
+    CK_BC_NONE( Negate_int ),
+    CK_BC_NONE( Negate_double ),
+    CK_BC_NONE( Lt_double ),
+    CK_BC_NONE( Gt_double ),
+    CK_BC_NONE( Le_double ),
+    CK_BC_NONE( Ge_double ),
+    CK_BC_NONE( Eq_double ),
+    CK_BC_NONE( Neq_double ),
+    CK_BC_NONE( Eq_complex ),
+    CK_BC_NONE( Neq_complex ),
+    CK_BC_NONE( Eq_vec2 ),
+    CK_BC_NONE( Neq_vec2 ),
+    CK_BC_NONE( Eq_vec3 ),
+    CK_BC_NONE( Neq_vec3 ),
+    CK_BC_NONE( Eq_vec4 ),
+    CK_BC_NONE( Neq_vec4 ),
+    CK_BC_NONE( Binary_And ),
+    CK_BC_NONE( Binary_Or ),
+    CK_BC_NONE( Binary_Xor ),
+    CK_BC_NONE( Binary_Shift_Right ),
+    CK_BC_NONE( Binary_Shift_Right_Reverse ),
+    CK_BC_NONE( Binary_Shift_Left ),
+    CK_BC_NONE( Binary_Shift_Left_Reverse ),
+    CK_BC_NONE( Binary_And_Assign ),
+    CK_BC_NONE( Binary_Or_Assign ),
+    CK_BC_NONE( Binary_Xor_Assign ),
+    CK_BC_NONE( Binary_Shift_Right_Assign ),
+    CK_BC_NONE( Binary_Shift_Left_Assign ),
+    CK_BC_NONE( And ),
+    CK_BC_NONE( Or ),
+    CK_BC_NONE( Reg_Pop_Int ),
+    CK_BC_NONE( Reg_Pop_Float ),
+    CK_BC_NONE( Reg_Pop_Vec2ComplexPolar ),
+    CK_BC_NONE( Reg_Pop_Vec3 ),
+    CK_BC_NONE( Reg_Pop_Vec4 ),
+    CK_BC_NONE( Reg_Dup_Last ),
+    CK_BC_NONE( Reg_Dup_Last2 ),
+    CK_BC_NONE( Reg_Push_Now ),
+    CK_BC_NONE( Reg_Push_Me ),
+    CK_BC_NONE( Reg_Push_This ),
+    CK_BC_NONE( Reg_Push_Start ),
+    CK_BC_NONE( Mem_Pop_Word ),
+    CK_BC_NONE( Mem_Pop_Word2 ),
+    CK_BC_NONE( Nop ),
+    CK_BC_NONE( EOC ),
+    CK_BC_NONE( Pre_Ctor_Array_Post ),
+    CK_BC_NONE( Assign_String ),
+    CK_BC_NONE( Assign_Primitive ),
+    CK_BC_NONE( Assign_Primitive2 ),
+    CK_BC_NONE( Assign_Primitive4 ),
+    CK_BC_NONE( Assign_PrimitiveVec3 ),
+    CK_BC_NONE( Assign_PrimitiveVec4 ),
+    CK_BC_NONE( Assign_Object ),
+    CK_BC_NONE( AddRef_Object ),
+    CK_BC_NONE( Reg_AddRef_Object3 ),
+    CK_BC_NONE( Release_Object ),
+    CK_BC_NONE( Release_Object3_Pop_Int ),
+    CK_BC_NONE( Func_To_Code ),
+    CK_BC_NONE( Func_Return ),
+    CK_BC_NONE( Time_Advance ),
+    CK_BC_NONE( Event_Wait ),
+    CK_BC_NONE( ADC ),
+    CK_BC_NONE( DAC ),
+    CK_BC_NONE( Bunghole ),
+    CK_BC_NONE( Chout ),
+    CK_BC_NONE( Cherr ),
+    CK_BC_NONE( UGen_UnLink ),
+    CK_BC_NONE( UGen_PMsg ),
+    CK_BC_NONE( Cast_double2int ),
+    CK_BC_NONE( Cast_int2double ),
+    CK_BC_NONE( Cast_int2complex ),
+    CK_BC_NONE( Cast_int2polar ),
+    CK_BC_NONE( Cast_double2complex ),
+    CK_BC_NONE( Cast_double2polar ),
+    CK_BC_NONE( Cast_complex2polar ),
+    CK_BC_NONE( Cast_polar2complex ),
+    CK_BC_NONE( Cast_vec2tovec3 ),
+    CK_BC_NONE( Cast_vec2tovec4 ),
+    CK_BC_NONE( Cast_vec3tovec2 ),
+    CK_BC_NONE( Cast_vec4tovec2 ),
+    CK_BC_NONE( Cast_vec3tovec4 ),
+    CK_BC_NONE( Cast_vec4tovec3 ),
+    CK_BC_NONE( Cast_object2string ),
+    CK_BC_NONE( Init_Loop_Counter ),
+    CK_BC_NONE( Reg_Push_Loop_Counter_Deref ),
+    CK_BC_NONE( Dec_Loop_Counter ),
+    CK_BC_NONE( Pop_Loop_Counter ),
+    CK_BC_NONE( IO_in_int ),
+    CK_BC_NONE( IO_in_float ),
+    CK_BC_NONE( IO_in_string ),
+    CK_BC_NONE( IO_out_int ),
+    CK_BC_NONE( IO_out_float ),
+    CK_BC_NONE( IO_out_complex ),
+    CK_BC_NONE( IO_out_polar ),
+    CK_BC_NONE( IO_out_vec2 ),
+    CK_BC_NONE( IO_out_vec3 ),
+    CK_BC_NONE( IO_out_vec4 ),
+    CK_BC_NONE( IO_out_string ),
+    // one integer operand
+    CK_BC_UINT( Reg_Pop_WordsMulti ),
+    CK_BC_UINT( Reg_Push_Zero ),
+    CK_BC_UINT( Reg_Transmute_Value_To_Pointer ),
+    CK_BC_UINT( Add_string_Temp ),
+    CK_BC_UINT( Mem_Push_Imm ),
+    CK_BC_UINT( Mem_Pop_Word3 ),
+    CK_BC_UINT( Alloc_Word2 ),
+    CK_BC_UINT( Alloc_Word4 ),
+    CK_BC_UINT( Alloc_Vec3 ),
+    CK_BC_UINT( Alloc_Vec4 ),
+    CK_BC_UINT( Alloc_Member_Word ),
+    CK_BC_UINT( Alloc_Member_Word2 ),
+    CK_BC_UINT( Alloc_Member_Word4 ),
+    CK_BC_UINT( Alloc_Member_Vec3 ),
+    CK_BC_UINT( Alloc_Member_Vec4 ),
+    CK_BC_UINT( Array_Prepend ),
+    CK_BC_UINT( Array_Append ),
+    CK_BC_UINT( AddRef_Object2 ),
+    CK_BC_UINT( Release_Object2 ),
+    CK_BC_UINT( Release_Object4 ),
+    CK_BC_UINT( Spork ),
+    CK_BC_UINT_SET( Reg_Pop_Mem ),
+    CK_BC_UINT_SET( Reg_Push_Maybe ),
+    CK_BC_UINT_SET( Pre_Ctor_Array_Bottom ),
+    // one float operand
+    CK_BC_FLOAT( Reg_Push_Imm2 ),
+    CK_BC_FLOAT( Mem_Push_Imm2 ),
+    // jumps
+    CK_BC_JUMP( Branch_Lt_int ),
+    CK_BC_JUMP( Branch_Gt_int ),
+    CK_BC_JUMP( Branch_Le_int ),
+    CK_BC_JUMP( Branch_Ge_int ),
+    CK_BC_JUMP( Branch_Eq_int ),
+    CK_BC_JUMP( Branch_Neq_int ),
+    CK_BC_JUMP( Branch_Lt_double ),
+    CK_BC_JUMP( Branch_Gt_double ),
+    CK_BC_JUMP( Branch_Le_double ),
+    CK_BC_JUMP( Branch_Ge_double ),
+    CK_BC_JUMP( Branch_Eq_double ),
+    CK_BC_JUMP( Branch_Neq_double ),
+    CK_BC_JUMP( Branch_Eq_int_IO_good ),
+    CK_BC_JUMP( Branch_Neq_int_IO_good ),
+    CK_BC_JUMP( Goto ),
+    // stack memory
+    CK_BC_MEM( Reg_Push_Mem ),
+    CK_BC_MEM( Reg_Push_Mem2 ),
+    CK_BC_MEM( Reg_Push_Mem4 ),
+    CK_BC_MEM( Reg_Push_Mem_Vec3 ),
+    CK_BC_MEM( Reg_Push_Mem_Vec4 ),
+    CK_BC_MEM( Reg_Push_Mem_Addr ),
+    // globals
+    CK_BC_GLOBAL( Reg_Push_Global ),
+    CK_BC_GLOBAL( Reg_Push_Global_Addr ),
+    // objects
+    CK_BC_OBJTYPE( Instantiate_Object_Start ),
+    CK_BC_OBJTYPE( Instantiate_Object_Scratch ),
+    CK_BC_OBJTYPE( Instantiate_Object_Complete ),
+    // vec/complex/polar fields
+    CK_BC_DOTCMP( Dot_Cmp_First ),
+    CK_BC_DOTCMP( Dot_Cmp_Second ),
+    CK_BC_DOTCMP( Dot_Cmp_Third ),
+    CK_BC_DOTCMP( Dot_Cmp_Fourth ),
+    // everything else
+    CK_BC_CUSTOM( Reg_Push_Imm, push_imm ),
+    CK_BC_CUSTOM( Reg_Push_Imm4, push_imm4 ),
+    CK_BC_CUSTOM( Reg_Push_Code, push_code ),
+    CK_BC_CUSTOM( Mem_Set_Imm, mem_set_imm ),
+    CK_BC_CUSTOM( Mem_Set_Imm2, mem_set_imm2 ),
+    CK_BC_CUSTOM( Alloc_Word, alloc_word ),
+    CK_BC_CUSTOM( Alloc_Word_Global, alloc_global ),
+    CK_BC_CUSTOM( Pre_Constructor, pre_ctor ),
+    CK_BC_CUSTOM( Pre_Ctor_Array_Top, pre_ctor_array_top ),
+    CK_BC_CUSTOM( Func_Call, func_call ),
+    CK_BC_CUSTOM( Func_Call_Member, func_call_member ),
+    CK_BC_CUSTOM( Func_Call_Static, func_call_static ),
+    CK_BC_CUSTOM( Func_Call_Global, func_call_global ),
+    CK_BC_CUSTOM( Stmt_Start, stmt_start ),
+    CK_BC_CUSTOM( Stmt_Remember_Object, stmt_remember ),
+    CK_BC_CUSTOM( Stmt_Cleanup, stmt_cleanup ),
+    CK_BC_CUSTOM( Array_Init_Literal, array_init ),
+    CK_BC_CUSTOM( Array_Alloc, array_alloc ),
+    CK_BC_CUSTOM( Array_Access, array_access ),
+    CK_BC_CUSTOM( Array_Map_Access, array_map_access ),
+    CK_BC_CUSTOM( Array_Access_Multi, array_access_multi ),
+    CK_BC_CUSTOM( Dot_Member_Data, dot_member_data ),
+    CK_BC_CUSTOM( Dot_Member_Func, dot_member_func ),
+    CK_BC_CUSTOM( Dot_Member_Func_Call, dot_member_func_call ),
+    CK_BC_CUSTOM( Dot_Primitive_Func, dot_primitive_func ),
+    CK_BC_CUSTOM( Dot_Static_Data, dot_static_data ),
+    CK_BC_CUSTOM( Dot_Static_Import_Data, dot_static_import ),
+    CK_BC_CUSTOM( Dot_Static_Func, dot_static_func ),
+    CK_BC_CUSTOM( UGen_Link, ugen_link ),
+    CK_BC_CUSTOM( UGen_Array_Link, ugen_array_link ),
+    CK_BC_CUSTOM( Cast_Runtime_Verify, cast_verify ),
+    CK_BC_CUSTOM( ForEach_Inc_And_Branch, foreach ),
+    CK_BC_CUSTOM( Hack, hack ),
+    CK_BC_CUSTOM( Gack, gack ),
+};
+
+// number of entries
+static const t_CKUINT g_bytecode_num_ops = sizeof(g_bytecode_ops) / sizeof(g_bytecode_ops[0]);
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Bytecode_OpTable
+// desc: lookup from instruction class name (see Chuck_Instr::opcode()) to an
+//       entry in g_bytecode_ops
+//-----------------------------------------------------------------------------
+struct Chuck_Bytecode_OpTable
+{
+    // name to entry
+    std::map<std::string, t_CKUINT> byName;
+    // entries with special handling
+    t_CKUINT stmtStart;
+
+    Chuck_Bytecode_OpTable( Chuck_Env * env ) : stmtStart( CK_BYTECODE_NONE )
+    {
+        // a throwaway instance of each class checks that the class declares
+        // the name the table knows it by
+        Chuck_Bytecode_Codec proto( env );
+        proto.proto = TRUE;
+        for( t_CKUINT i = 0; i < g_bytecode_num_ops; i++ )
+        {
+            Chuck_Instr * instr = g_bytecode_ops[i].read( proto );
+            assert( instr->opcode() && !strcmp( instr->opcode(), g_bytecode_ops[i].name ) );
+            byName[g_bytecode_ops[i].name] = i;
+            delete instr;
+        }
+        stmtStart = byName["Chuck_Instr_Stmt_Start"];
+    }
+
+    // look up an instruction
+    t_CKUINT find( const Chuck_Instr * instr ) const
+    {
+        const char * name = instr->opcode();
+        std::map<std::string, t_CKUINT>::const_iterator it = byName.end();
+        if( name ) it = byName.find( name );
+        return it == byName.end() ? CK_BYTECODE_NONE : it->second;
+    }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_ops()
+// desc: the op table, built on first use
+//-----------------------------------------------------------------------------
+static const Chuck_Bytecode_OpTable & bytecode_ops( Chuck_Env * env )
+{
+    static Chuck_Bytecode_OpTable table( env );
+    return table;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_resolve_type()
+// desc: find a (possibly array) type by base name in the global namespace
+//-----------------------------------------------------------------------------
+static Chuck_Type * bytecode_resolve_type( Chuck_Env * env, const std::string & name, t_CKUINT depth )
+{
+    Chuck_Type * base = env->global()->lookup_type( name, 1 );
+    if( !base || !depth ) return base;
+    return env->get_array_type( depth, base );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_resolve_func()
+// desc: find a function named by a function table entry (named and ctor
+//       entries only)
+//-----------------------------------------------------------------------------
+static Chuck_Func * bytecode_resolve_func( Chuck_Env * env, Chuck_Type * owner,
+                                          const Chuck_Bytecode_Func & e )
+{
+    Chuck_Func * f = NULL;
+    if( e.kind == ck_bc_func_named )
+    {
+        // by value name and overload; mangled names are not reliable for
+        // builtins, which may register a parent's functions under a child
+        Chuck_Namespace * nspc = owner ? owner->nspc : env->global();
+        Chuck_Value * v = nspc ? nspc->lookup_value( e.name, 0 ) : NULL;
+        f = v ? v->func_ref : NULL;
+    }
+    else if( e.kind == ck_bc_func_ctor && owner )
+    {
+        f = owner->ctors_all;
+    }
+    else return NULL;
+    // the nth overload
+    for( t_CKUINT i = 0; f && i < e.ordinal; i++ ) f = f->next;
+    return f;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_resolve_data()
+// desc: find the address of builtin static data by owner and value name
+//-----------------------------------------------------------------------------
+static void * bytecode_resolve_data( Chuck_Env * env, Chuck_Type * owner, const std::string & name )
+{
+    Chuck_Namespace * nspc = owner ? owner->nspc : env->global();
+    Chuck_Value * v = nspc ? nspc->lookup_value( name, 0 ) : NULL;
+    return v ? v->addr : NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_srate()
+// desc: the sample rate durations are folded against; read from `second`,
+//       as the emitter does
+//-----------------------------------------------------------------------------
+static uint32_t bytecode_srate( Chuck_Env * env )
+{
+    Chuck_Value * v = env->global()->lookup_value( "second", FALSE );
+    return v && v->addr ? (uint32_t)*( (t_CKDUR *)v->addr ) : 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: scan()
+// desc: index the global type system's pre-constructors, function code,
+//       and static data by address, for writing references to them
+//-----------------------------------------------------------------------------
+void Chuck_Bytecode_Codec::scan()
+{
+    if( scanned ) return;
+    scanned = TRUE;
+
+    std::vector<Chuck_Namespace *> spaces;
+    std::vector<Chuck_Type *> owners;
+    // the global namespace itself
+    spaces.push_back( env->global() ); owners.push_back( NULL );
+    // every type visible from it
+    std::vector<Chuck_Type *> all;
+    env->global()->get_types( all );
+    for( t_CKUINT i = 0; i < all.size(); i++ )
+    {
+        if( !all[i]->nspc ) continue;
+        spaces.push_back( all[i]->nspc ); owners.push_back( all[i] );
+        if( all[i]->nspc->pre_ctor ) preCtorOwner[all[i]->nspc->pre_ctor] = all[i];
+        for( Chuck_Func * f = all[i]->ctors_all; f; f = f->next )
+            if( f->code ) codeFunc[f->code] = f;
+    }
+
+    for( t_CKUINT i = 0; i < spaces.size(); i++ )
+    {
+        std::vector<Chuck_Func *> fs;
+        spaces[i]->get_funcs( fs );
+        for( t_CKUINT j = 0; j < fs.size(); j++ )
+            if( fs[j]->code ) codeFunc[fs[j]->code] = fs[j];
+        std::vector<Chuck_Value *> vs;
+        spaces[i]->get_values( vs );
+        for( t_CKUINT j = 0; j < vs.size(); j++ )
+            if( vs[j]->addr && vs[j]->owner_class == owners[i] ) staticData[vs[j]->addr] = vs[j];
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: typeRef()
+// desc: index of a type in the image's type table
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_Bytecode_Codec::typeRef( Chuck_Type * t )
+{
+    std::map<Chuck_Type *, t_CKUINT>::iterator it = typeIndex.find( t );
+    if( it != typeIndex.end() ) return it->second;
+
+    // types are stored by name, so must be found the same way on load
+    Chuck_Type * base = t->array_depth ? t->array_type : t;
+    if( !base || bytecode_resolve_type( env, base->base_name, t->array_depth ) != t )
+    { fail( std::string("type '") + t->c_name() + "' is not a builtin type" ); return 0; }
+
+    typeIndex[t] = types.size();
+    types.push_back( t );
+    return types.size() - 1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: rtype()
+// desc: read a type reference
+//-----------------------------------------------------------------------------
+Chuck_Type * Chuck_Bytecode_Codec::rtype()
+{
+    if( proto ) return env->ckt_int;
+    t_CKUINT i = ru();
+    if( i == CK_BYTECODE_NONE ) return NULL;
+    if( i >= types.size() ) { fail( "bad type reference" ); return NULL; }
+    return types[i];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: funcRef()
+// desc: index of a function in the image's function table
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_Bytecode_Codec::funcRef( Chuck_Func * f )
+{
+    std::map<Chuck_Func *, t_CKUINT>::iterator it = funcIndex.find( f );
+    if( it != funcIndex.end() ) return it->second;
+
+    Chuck_Bytecode_Func e;
+    e.kind = 0; e.index = CK_BYTECODE_NONE; e.ordinal = 0;
+    Chuck_Type * owner = f->ownerType();
+    Chuck_Func * first = NULL;
+    if( f->is_ctor && owner )
+    {
+        e.kind = ck_bc_func_ctor;
+        first = owner->ctors_all;
+    }
+    else
+    {
+        e.kind = ck_bc_func_named;
+        e.name = f->base_name;
+        first = f->value_ref ? f->value_ref->func_ref : NULL;
+    }
+    for( Chuck_Func * c = first; c && c != f; c = c->next ) e.ordinal++;
+    // builtin: must resolve back to the same function
+    e.index = owner ? typeRef( owner ) : CK_BYTECODE_NONE;
+    if( !ok ) return 0;
+
+    if( bytecode_resolve_func( env, owner, e ) != f )
+    {
+        // otherwise it must be a file-level function of this program
+        if( owner || f->is_member || f->is_static || !f->code || f->code->native_func )
+        { fail( "function '" + f->base_name + "' is not a builtin or file-level function" ); return 0; }
+        e.kind = ck_bc_func_image;
+        e.name = f->name;
+        e.base_name = f->base_name;
+        // reserve our slot before the code (which may call us)
+        funcIndex[f] = funcs.size();
+        funcs.push_back( f );
+        funcEntries.push_back( e );
+        t_CKUINT idx = funcs.size() - 1;
+        funcEntries[idx].index = codeRef( f->code );
+        if( funcEntries[idx].index == CK_BYTECODE_NONE || f->code != codes[funcEntries[idx].index] )
+            fail( "function '" + f->base_name + "' has no code of its own" );
+        return idx;
+    }
+
+    funcIndex[f] = funcs.size();
+    funcs.push_back( f );
+    funcEntries.push_back( e );
+    return funcs.size() - 1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: rfunc()
+// desc: read a function reference
+//-----------------------------------------------------------------------------
+Chuck_Func * Chuck_Bytecode_Codec::rfunc()
+{
+    if( proto ) return NULL;
+    t_CKUINT i = ru();
+    if( i == CK_BYTECODE_NONE ) return NULL;
+    if( i >= funcs.size() ) { fail( "bad function reference" ); return NULL; }
+    return funcs[i];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: codeRef()
+// desc: index of a code in the image (adding it to be written if new);
+//       CK_BYTECODE_NONE if the code belongs to the type system
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_Bytecode_Codec::codeRef( Chuck_VM_Code * code )
+{
+    std::map<Chuck_VM_Code *, t_CKUINT>::iterator it = codeIndex.find( code );
+    if( it != codeIndex.end() ) return it->second;
+    scan();
+    if( preCtorOwner.count( code ) || codeFunc.count( code ) ) return CK_BYTECODE_NONE;
+    if( code->native_func ) { fail( "native code '" + code->name + "' is not part of the type system" ); return 0; }
+    codeIndex[code] = codes.size();
+    codes.push_back( code );
+    return codes.size() - 1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: wcode()
+// desc: write a code reference
+//-----------------------------------------------------------------------------
+void Chuck_Bytecode_Codec::wcode( Chuck_VM_Code * code )
+{
+    if( !code ) { wu( ck_bc_code_null ); wu( 0 ); return; }
+    t_CKUINT i = codeRef( code );
+    if( i != CK_BYTECODE_NONE ) { wu( ck_bc_code_image ); wu( i ); }
+    else if( preCtorOwner.count( code ) ) { wu( ck_bc_code_pre_ctor ); wu( typeRef( preCtorOwner[code] ) ); }
+    else { wu( ck_bc_code_func ); wu( funcRef( codeFunc[code] ) ); }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: rcode()
+// desc: read a code reference
+//-----------------------------------------------------------------------------
+Chuck_VM_Code * Chuck_Bytecode_Codec::rcode()
+{
+    if( proto ) return NULL;
+    t_CKUINT kind = ru();
+    t_CKUINT i = ru();
+    if( !ok ) return NULL;
+    switch( kind )
+    {
+        case ck_bc_code_null: return NULL;
+        case ck_bc_code_image: if( i < codes.size() ) return codes[i]; break;
+        case ck_bc_code_pre_ctor:
+            if( i < types.size() && types[i]->nspc && types[i]->nspc->pre_ctor )
+                return types[i]->nspc->pre_ctor;
+            break;
+        case ck_bc_code_func: if( i < funcs.size() && funcs[i]->code ) return funcs[i]->code; break;
+    }
+    fail( "bad code reference" );
+    return NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: wstring() / rstring()
+// desc: string literal references
+//-----------------------------------------------------------------------------
+void Chuck_Bytecode_Codec::wstring( Chuck_String * s )
+{
+    std::map<Chuck_String *, t_CKUINT>::iterator it = stringIndex.find( s );
+    if( it != stringIndex.end() ) { wu( it->second ); return; }
+    stringIndex[s] = strings.size();
+    strings.push_back( s );
+    wu( strings.size() - 1 );
+}
+
+Chuck_String * Chuck_Bytecode_Codec::rstring()
+{
+    if( proto ) return NULL;
+    t_CKUINT i = ru();
+    if( i >= strings.size() ) { fail( "bad string reference" ); return NULL; }
+    return strings[i];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: wdata() / rdata()
+// desc: builtin static data references
+//-----------------------------------------------------------------------------
+void Chuck_Bytecode_Codec::wdata( void * addr )
+{
+    std::map<void *, t_CKUINT>::iterator it = dataIndex.find( addr );
+    if( it != dataIndex.end() ) { wu( it->second ); return; }
+    scan();
+    Chuck_Value * v = staticData.count( addr ) ? staticData[addr] : NULL;
+    if( !v ) { fail( "reference to static data outside the type system" ); return; }
+    t_CKUINT owner = v->owner_class ? typeRef( v->owner_class ) : CK_BYTECODE_NONE;
+    if( !ok ) return;
+    if( bytecode_resolve_data( env, v->owner_class, v->name ) != addr )
+    { fail( "static data '" + v->name + "' cannot be found by name" ); return; }
+    dataIndex[addr] = datas.size();
+    datas.push_back( addr );
+    dataEntries.push_back( std::make_pair( owner, v->name ) );
+    wu( datas.size() - 1 );
+}
+
+void * Chuck_Bytecode_Codec::rdata()
+{
+    if( proto ) return NULL;
+    t_CKUINT i = ru();
+    if( i >= datas.size() ) { fail( "bad static data reference" ); return NULL; }
+    return datas[i];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: wstmt() / rstmt()
+// desc: references to a Stmt_Start earlier in the same code
+//-----------------------------------------------------------------------------
+void Chuck_Bytecode_Codec::wstmt( Chuck_Instr * start )
+{
+    if( !start ) { wu( CK_BYTECODE_NONE ); return; }
+    std::map<Chuck_Instr *, t_CKUINT>::iterator it = currIndex.find( start );
+    if( it == currIndex.end() ) { fail( "statement start outside of its code" ); return; }
+    wu( it->second );
+}
+
+Chuck_Instr_Stmt_Start * Chuck_Bytecode_Codec::rstmt()
+{
+    if( proto ) return NULL;
+    t_CKUINT i = ru();
+    if( i == CK_BYTECODE_NONE ) return NULL;
+    if( i >= currInstr.size() || currOp[i] != bytecode_ops( env ).stmtStart )
+    { fail( "bad statement reference" ); return NULL; }
+    return (Chuck_Instr_Stmt_Start *)currInstr[i];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// operand readers/writers
+//-----------------------------------------------------------------------------
+void Chuck_Bytecode_Codec::w_push_imm( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{
+    Chuck_Instr_Reg_Push_Imm * t = (Chuck_Instr_Reg_Push_Imm *)i;
+    c.wu( t->m_kind );
+    switch( t->m_kind )
+    {
+        case te_immValue: c.wu( t->m_val ); break;
+        case te_immType: c.wtype( (Chuck_Type *)t->m_val ); break;
+        case te_immFunc: c.wfunc( (Chuck_Func *)t->m_val ); break;
+        case te_immCode: c.wcode( (Chuck_VM_Code *)t->m_val ); break;
+        case te_immString: c.wstring( (Chuck_String *)t->m_val ); break;
+    }
+}
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_push_imm( Chuck_Bytecode_Codec & c )
+{
+    t_CKUINT kind = c.ru();
+    t_CKUINT val = 0;
+    switch( kind )
+    {
+        case te_immValue: val = c.ru(); break;
+        case te_immType: val = (t_CKUINT)c.rtype(); break;
+        case te_immFunc: val = (t_CKUINT)c.rfunc(); break;
+        case te_immCode: val = (t_CKUINT)c.rcode(); break;
+        case te_immString: val = (t_CKUINT)c.rstring(); break;
+        default: c.fail( "bad immediate kind" ); kind = te_immValue; break;
+    }
+    return new Chuck_Instr_Reg_Push_Imm( val, (te_ImmKind)kind );
+}
+
+void Chuck_Bytecode_Codec::w_push_imm4( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Reg_Push_Imm4 * t = (Chuck_Instr_Reg_Push_Imm4 *)i; c.wf( t->m_val ); c.wf( t->m_val2 ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_push_imm4( Chuck_Bytecode_Codec & c )
+{ t_CKFLOAT x = c.rf(); t_CKFLOAT y = c.rf(); return new Chuck_Instr_Reg_Push_Imm4( x, y ); }
+
+void Chuck_Bytecode_Codec::w_push_code( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wcode( ((Chuck_Instr_Reg_Push_Code *)i)->m_code ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_push_code( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_Reg_Push_Code( c.rcode() ); }
+
+void Chuck_Bytecode_Codec::w_mem_set_imm( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{
+    // the emitter only uses this to store a file-level function in its variable
+    Chuck_Instr_Mem_Set_Imm * t = (Chuck_Instr_Mem_Set_Imm *)i;
+    c.wu( t->m_offset ); c.wfunc( (Chuck_Func *)t->m_val );
+}
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_mem_set_imm( Chuck_Bytecode_Codec & c )
+{ t_CKUINT o = c.ru(); return new Chuck_Instr_Mem_Set_Imm( o, (t_CKUINT)c.rfunc() ); }
+
+void Chuck_Bytecode_Codec::w_mem_set_imm2( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Mem_Set_Imm2 * t = (Chuck_Instr_Mem_Set_Imm2 *)i; c.wu( t->m_offset ); c.wf( t->m_val ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_mem_set_imm2( Chuck_Bytecode_Codec & c )
+{ t_CKUINT o = c.ru(); return new Chuck_Instr_Mem_Set_Imm2( o, c.rf() ); }
+
+void Chuck_Bytecode_Codec::w_alloc_word( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Alloc_Word * t = (Chuck_Instr_Alloc_Word *)i; c.wu( t->m_val ); c.wu( t->m_is_object ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_alloc_word( Chuck_Bytecode_Codec & c )
+{ t_CKUINT o = c.ru(); return new Chuck_Instr_Alloc_Word( o, (t_CKBOOL)c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_alloc_global( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{
+    Chuck_Instr_Alloc_Word_Global * t = (Chuck_Instr_Alloc_Word_Global *)i;
+    c.wu( t->m_val ); c.ws( t->m_name ); c.wu( t->m_type ); c.wu( t->m_is_array );
+    c.wu( t->m_should_execute_ctors ); c.wu( t->m_stack_offset ); c.wtype( t->m_chuck_type );
+}
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_alloc_global( Chuck_Bytecode_Codec & c )
+{
+    Chuck_Instr_Alloc_Word_Global * t = new Chuck_Instr_Alloc_Word_Global;
+    t->set( c.ru() ); t->m_name = c.rs(); t->m_type = (te_GlobalType)c.ru();
+    t->m_is_array = (t_CKBOOL)c.ru(); t->m_should_execute_ctors = (t_CKBOOL)c.ru();
+    t->m_stack_offset = c.ru(); t->m_chuck_type = c.rtype();
+    return t;
+}
+
+void Chuck_Bytecode_Codec::w_pre_ctor( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Pre_Constructor * t = (Chuck_Instr_Pre_Constructor *)i; c.wcode( t->pre_ctor ); c.wu( t->stack_offset ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_pre_ctor( Chuck_Bytecode_Codec & c )
+{ Chuck_VM_Code * code = c.rcode(); return new Chuck_Instr_Pre_Constructor( code, c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_pre_ctor_array_top( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Pre_Ctor_Array_Top * t = (Chuck_Instr_Pre_Ctor_Array_Top *)i; c.wu( t->m_val ); c.wtype( t->type ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_pre_ctor_array_top( Chuck_Bytecode_Codec & c )
+{ t_CKUINT v = c.ru(); Chuck_Instr_Pre_Ctor_Array_Top * t = new Chuck_Instr_Pre_Ctor_Array_Top( c.rtype() ); t->set( v ); return t; }
+
+void Chuck_Bytecode_Codec::w_func_call( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wu( ((Chuck_Instr_Func_Call *)i)->m_arg_convention ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_func_call( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_Func_Call( (ck_Func_Call_Arg_Convention)c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_func_call_member( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{
+    Chuck_Instr_Func_Call_Member * t = (Chuck_Instr_Func_Call_Member *)i;
+    c.wu( t->m_val ); c.wfunc( t->m_func_ref ); c.wu( t->m_arg_convention ); c.wu( t->m_special_primitive_cleanup_this );
+}
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_func_call_member( Chuck_Bytecode_Codec & c )
+{
+    t_CKUINT v = c.ru(); Chuck_Func * f = c.rfunc();
+    ck_Func_Call_Arg_Convention conv = (ck_Func_Call_Arg_Convention)c.ru();
+    return new Chuck_Instr_Func_Call_Member( v, f, conv, (t_CKBOOL)c.ru() );
+}
+
+void Chuck_Bytecode_Codec::w_func_call_static( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Func_Call_Static * t = (Chuck_Instr_Func_Call_Static *)i; c.wu( t->m_val ); c.wfunc( t->m_func_ref ); c.wu( t->m_arg_convention ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_func_call_static( Chuck_Bytecode_Codec & c )
+{ t_CKUINT v = c.ru(); Chuck_Func * f = c.rfunc(); return new Chuck_Instr_Func_Call_Static( v, f, (ck_Func_Call_Arg_Convention)c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_func_call_global( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Func_Call_Global * t = (Chuck_Instr_Func_Call_Global *)i; c.wu( t->m_val ); c.wfunc( t->m_func_ref ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_func_call_global( Chuck_Bytecode_Codec & c )
+{ t_CKUINT v = c.ru(); return new Chuck_Instr_Func_Call_Global( v, c.rfunc() ); }
+
+void Chuck_Bytecode_Codec::w_stmt_start( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wu( ((Chuck_Instr_Stmt_Start *)i)->m_numObjReleases ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_stmt_start( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_Stmt_Start( c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_stmt_remember( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Stmt_Remember_Object * t = (Chuck_Instr_Stmt_Remember_Object *)i; c.wstmt( t->m_stmtStart ); c.wu( t->m_offset ); c.wu( t->m_addRef ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_stmt_remember( Chuck_Bytecode_Codec & c )
+{
+    Chuck_Instr_Stmt_Start * s = c.rstmt(); t_CKUINT o = c.ru();
+    // a missing start would be dereferenced at runtime
+    if( !s && !c.proto ) c.fail( "bad statement reference" );
+    return new Chuck_Instr_Stmt_Remember_Object( s, o, c.ru() );
+}
+
+void Chuck_Bytecode_Codec::w_stmt_cleanup( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wstmt( ((Chuck_Instr_Stmt_Cleanup *)i)->m_stmtStart ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_stmt_cleanup( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_Stmt_Cleanup( c.rstmt() ); }
+
+void Chuck_Bytecode_Codec::w_array_init( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Array_Init_Literal * t = (Chuck_Instr_Array_Init_Literal *)i; c.wtype( t->m_type_ref ); c.wu( t->m_length ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_array_init( Chuck_Bytecode_Codec & c )
+{
+    Chuck_Type * t = c.rtype(); t_CKINT n = (t_CKINT)c.ru();
+    if( !t ) { c.fail( "bad array literal type" ); t = c.env->ckt_int; }
+    return new Chuck_Instr_Array_Init_Literal( c.env, t, n );
+}
+
+void Chuck_Bytecode_Codec::w_array_alloc( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{
+    Chuck_Instr_Array_Alloc * t = (Chuck_Instr_Array_Alloc *)i;
+    c.wu( t->m_depth ); c.wtype( t->m_type_ref_content ); c.wu( t->m_stack_offset );
+    c.wu( t->m_is_ref ); c.wtype( t->m_type_ref_array );
+}
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_array_alloc( Chuck_Bytecode_Codec & c )
+{
+    t_CKUINT depth = c.ru(); Chuck_Type * content = c.rtype(); t_CKUINT offset = c.ru();
+    t_CKBOOL ref = (t_CKBOOL)c.ru(); Chuck_Type * array = c.rtype();
+    if( !content || !array ) { c.fail( "bad array type" ); content = array = c.env->ckt_int; }
+    return new Chuck_Instr_Array_Alloc( c.env, depth, content, offset, ref, array );
+}
+
+void Chuck_Bytecode_Codec::w_array_access( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Array_Access * t = (Chuck_Instr_Array_Access *)i; c.wu( t->m_kind ); c.wu( t->m_emit_addr ); c.wu( t->m_istr ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_array_access( Chuck_Bytecode_Codec & c )
+{ t_CKUINT k = c.ru(); t_CKUINT e = c.ru(); return new Chuck_Instr_Array_Access( k, e, c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_array_map_access( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Array_Map_Access * t = (Chuck_Instr_Array_Map_Access *)i; c.wu( t->m_kind ); c.wu( t->m_emit_addr ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_array_map_access( Chuck_Bytecode_Codec & c )
+{ t_CKUINT k = c.ru(); return new Chuck_Instr_Array_Map_Access( k, c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_array_access_multi( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{
+    Chuck_Instr_Array_Access_Multi * t = (Chuck_Instr_Array_Access_Multi *)i;
+    c.wu( t->m_depth ); c.wu( t->m_kind ); c.wu( t->m_emit_addr );
+    c.wu( t->m_indexIsAssociative.size() );
+    for( t_CKUINT j = 0; j < t->m_indexIsAssociative.size(); j++ ) c.wu( t->m_indexIsAssociative[j] );
+}
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_array_access_multi( Chuck_Bytecode_Codec & c )
+{
+    t_CKUINT d = c.ru(); t_CKUINT k = c.ru(); t_CKUINT e = c.ru();
+    Chuck_Instr_Array_Access_Multi * t = new Chuck_Instr_Array_Access_Multi( d, k, e );
+    t_CKUINT n = c.rcount();
+    for( t_CKUINT j = 0; j < n && c.ok; j++ ) t->m_indexIsAssociative.push_back( (t_CKBOOL)c.ru() );
+    return t;
+}
+
+void Chuck_Bytecode_Codec::w_dot_member_data( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Dot_Member_Data * t = (Chuck_Instr_Dot_Member_Data *)i; c.wu( t->m_offset ); c.wu( t->m_kind ); c.wu( t->m_emit_addr ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_dot_member_data( Chuck_Bytecode_Codec & c )
+{ t_CKUINT o = c.ru(); t_CKUINT k = c.ru(); return new Chuck_Instr_Dot_Member_Data( o, k, c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_dot_member_func( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wu( ((Chuck_Instr_Dot_Member_Func *)i)->m_offset ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_dot_member_func( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_Dot_Member_Func( c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_dot_member_func_call( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Dot_Member_Func_Call * t = (Chuck_Instr_Dot_Member_Func_Call *)i; c.wu( t->m_offset ); c.wu( t->m_push_code ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_dot_member_func_call( Chuck_Bytecode_Codec & c )
+{ t_CKUINT o = c.ru(); return new Chuck_Instr_Dot_Member_Func_Call( o, c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_dot_primitive_func( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wfunc( (Chuck_Func *)((Chuck_Instr_Dot_Primitive_Func *)i)->m_native_func ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_dot_primitive_func( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_Dot_Primitive_Func( (t_CKUINT)c.rfunc() ); }
+
+void Chuck_Bytecode_Codec::w_dot_static_data( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{
+    Chuck_Instr_Dot_Static_Data * t = (Chuck_Instr_Dot_Static_Data *)i;
+    c.wu( t->m_offset ); c.wu( t->m_size ); c.wu( t->m_kind ); c.wu( t->m_emit_addr );
+}
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_dot_static_data( Chuck_Bytecode_Codec & c )
+{ t_CKUINT o = c.ru(); t_CKUINT s = c.ru(); t_CKUINT k = c.ru(); return new Chuck_Instr_Dot_Static_Data( o, s, k, c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_dot_static_import( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Dot_Static_Import_Data * t = (Chuck_Instr_Dot_Static_Import_Data *)i; c.wdata( t->m_addr ); c.wu( t->m_kind ); c.wu( t->m_emit_addr ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_dot_static_import( Chuck_Bytecode_Codec & c )
+{ void * a = c.rdata(); t_CKUINT k = c.ru(); return new Chuck_Instr_Dot_Static_Import_Data( a, k, c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_dot_static_func( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wfunc( ((Chuck_Instr_Dot_Static_Func *)i)->m_func ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_dot_static_func( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_Dot_Static_Func( c.rfunc() ); }
+
+void Chuck_Bytecode_Codec::w_ugen_link( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wu( ((Chuck_Instr_UGen_Link *)i)->m_isUpChuck ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_ugen_link( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_UGen_Link( (t_CKBOOL)c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_ugen_array_link( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_UGen_Array_Link * t = (Chuck_Instr_UGen_Array_Link *)i; c.wu( t->m_srcIsArray ); c.wu( t->m_dstIsArray ); c.wu( t->m_isUpChuck ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_ugen_array_link( Chuck_Bytecode_Codec & c )
+{ t_CKBOOL s = (t_CKBOOL)c.ru(); t_CKBOOL d = (t_CKBOOL)c.ru(); return new Chuck_Instr_UGen_Array_Link( s, d, (t_CKBOOL)c.ru() ); }
+
+void Chuck_Bytecode_Codec::w_cast_verify( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_Cast_Runtime_Verify * t = (Chuck_Instr_Cast_Runtime_Verify *)i; c.wtype( t->m_from ); c.wtype( t->m_to ); c.ws( t->m_codeWithFormat ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_cast_verify( Chuck_Bytecode_Codec & c )
+{
+    Chuck_Type * from = c.rtype(); Chuck_Type * to = c.rtype();
+    Chuck_Instr_Cast_Runtime_Verify * t = new Chuck_Instr_Cast_Runtime_Verify( from, to );
+    t->set_codeformat4exception( c.rs() );
+    return t;
+}
+
+void Chuck_Bytecode_Codec::w_foreach( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ Chuck_Instr_ForEach_Inc_And_Branch * t = (Chuck_Instr_ForEach_Inc_And_Branch *)i; c.wu( t->m_dataKind ); c.wu( t->m_dataSize ); c.wu( t->m_jmp ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_foreach( Chuck_Bytecode_Codec & c )
+{
+    te_KindOf k = (te_KindOf)c.ru(); t_CKUINT s = c.ru();
+    Chuck_Instr_ForEach_Inc_And_Branch * t = new Chuck_Instr_ForEach_Inc_And_Branch( k, s );
+    t->set( c.ru() );
+    return t;
+}
+
+void Chuck_Bytecode_Codec::w_hack( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{ c.wtype( ((Chuck_Instr_Hack *)i)->m_type_ref ); }
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_hack( Chuck_Bytecode_Codec & c )
+{ return new Chuck_Instr_Hack( c.rtype() ); }
+
+void Chuck_Bytecode_Codec::w_gack( Chuck_Bytecode_Codec & c, Chuck_Instr * i )
+{
+    Chuck_Instr_Gack * t = (Chuck_Instr_Gack *)i;
+    c.wu( t->m_type_refs.size() );
+    for( t_CKUINT j = 0; j < t->m_type_refs.size(); j++ ) c.wtype( t->m_type_refs[j] );
+}
+
+Chuck_Instr * Chuck_Bytecode_Codec::r_gack( Chuck_Bytecode_Codec & c )
+{
+    std::vector<Chuck_Type *> types;
+    t_CKUINT n = c.rcount();
+    for( t_CKUINT j = 0; j < n && c.ok; j++ ) types.push_back( c.rtype() );
+    return new Chuck_Instr_Gack( types );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: writeCode()
+// desc: write one code body
+//-----------------------------------------------------------------------------
+void Chuck_Bytecode_Codec::writeCode( Chuck_VM_Code * code )
+{
+    const Chuck_Bytecode_OpTable & table = bytecode_ops( env );
+
+    ws( code->name ); ws( code->filename );
+    wu( code->stack_depth ); wu( code->need_this ); wu( code->is_static );
+    wu( code->num_instr );
+
+    currIndex.clear();
+    for( t_CKUINT i = 0; i < code->num_instr && ok; i++ )
+    {
+        Chuck_Instr * instr = code->instr[i];
+        currIndex[instr] = i;
+        t_CKUINT op = table.find( instr );
+        if( op == CK_BYTECODE_NONE )
+        {
+            fail( "code '" + code->name + "' has an instruction that cannot be saved "
+                  "(line " + std::to_string( (unsigned long long)instr->m_linepos ) + ")" );
+            return;
+        }
+        // instruction classes are numbered in order of first use
+        if( opcodeIndex.find( op ) == opcodeIndex.end() )
+        { opcodeIndex[op] = opcodes.size(); opcodes.push_back( op ); }
+
+        wu( opcodeIndex[op] );
+        wu( instr->m_linepos );
+        g_bytecode_ops[op].write( *this, instr );
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: serialize()
+// desc: serialize code and everything it reaches
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Bytecode_Codec::serialize( Chuck_VM_Code * code, std::string & image )
+{
+    // code bodies first: writing them discovers everything else
+    std::string body;
+    out = &body;
+    codeIndex[code] = 0;
+    codes.push_back( code );
+    for( t_CKUINT i = 0; i < codes.size() && ok; i++ )
+        writeCode( codes[i] );
+    if( !ok ) return FALSE;
+
+    // header
+    std::string head;
+    out = &head;
+    put( CK_BYTECODE_MAGIC, 4 );
+    uint32_t h[5] = { CK_BYTECODE_FORMAT_VERSION, sizeof(t_CKUINT), sizeof(t_CKFLOAT),
+                      CK_BYTECODE_ENDIAN, bytecode_srate( env ) };
+    put( h, sizeof(h) );
+    ws( CHUCK_VERSION_STRING );
+
+    // instruction classes used
+    wu( opcodes.size() );
+    for( t_CKUINT i = 0; i < opcodes.size(); i++ ) ws( g_bytecode_ops[opcodes[i]].name );
+    // types
+    wu( types.size() );
+    for( t_CKUINT i = 0; i < types.size(); i++ )
+    {
+        Chuck_Type * base = types[i]->array_depth ? types[i]->array_type : types[i];
+        ws( base->base_name ); wu( types[i]->array_depth );
+    }
+    // static data
+    wu( dataEntries.size() );
+    for( t_CKUINT i = 0; i < dataEntries.size(); i++ )
+    { wu( dataEntries[i].first ); ws( dataEntries[i].second ); }
+    // string literals
+    wu( strings.size() );
+    for( t_CKUINT i = 0; i < strings.size(); i++ ) ws( strings[i]->str() );
+    // codes (created before functions, which point at them)
+    wu( codes.size() );
+    // functions
+    wu( funcEntries.size() );
+    for( t_CKUINT i = 0; i < funcEntries.size(); i++ )
+    {
+        const Chuck_Bytecode_Func & e = funcEntries[i];
+        wu( e.kind ); wu( e.index ); wu( e.ordinal ); ws( e.name ); ws( e.base_name );
+    }
+
+    image = head + body;
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: deserialize()
+// desc: reconstruct code from an image
+//-----------------------------------------------------------------------------
+Chuck_VM_Code * Chuck_Bytecode_Codec::deserialize( const std::string & image )
+{
+    const Chuck_Bytecode_OpTable & table = bytecode_ops( env );
+    in = image.data(); inLen = image.size(); inPos = 0;
+    // everything created, with a reference each
+    std::vector<Chuck_VM_Object *> keep;
+
+    // header
+    char magic[4] = { 0 };
+    uint32_t h[5] = { 0 };
+    get( magic, 4 ); get( h, sizeof(h) );
+    if( !ok || memcmp( magic, CK_BYTECODE_MAGIC, 4 ) ) { error = "not a bytecode image"; return NULL; }
+    if( h[0] != CK_BYTECODE_FORMAT_VERSION ) { error = "unsupported bytecode format version"; return NULL; }
+    if( h[1] != sizeof(t_CKUINT) || h[2] != sizeof(t_CKFLOAT) || h[3] != CK_BYTECODE_ENDIAN )
+    { error = "bytecode image was built for a different platform"; return NULL; }
+    if( h[4] != bytecode_srate( env ) )
+    { error = "bytecode image was built for a different sample rate"; return NULL; }
+    if( rs() != CHUCK_VERSION_STRING ) { if( ok ) error = "bytecode image was built by a different version of chuck"; return NULL; }
+
+    // instruction classes
+    std::vector<t_CKUINT> ops( rcount() );
+    for( t_CKUINT i = 0; i < ops.size() && ok; i++ )
+    {
+        std::string name = rs();
+        std::map<std::string, t_CKUINT>::const_iterator it = table.byName.find( name );
+        if( it == table.byName.end() ) fail( "unknown instruction '" + name + "'" );
+        else ops[i] = it->second;
+    }
+    // types
+    t_CKUINT n = rcount();
+    for( t_CKUINT i = 0; i < n && ok; i++ )
+    {
+        std::string name = rs(); t_CKUINT depth = ru();
+        if( ok && depth > CK_BYTECODE_MAX_DEPTH ) { fail( "image is corrupt" ); break; }
+        Chuck_Type * t = ok ? bytecode_resolve_type( env, name, depth ) : NULL;
+        if( !t ) fail( "unknown type '" + name + "'" );
+        types.push_back( t );
+    }
+    // static data
+    n = rcount();
+    for( t_CKUINT i = 0; i < n && ok; i++ )
+    {
+        t_CKUINT owner = ru(); std::string name = rs();
+        if( owner != CK_BYTECODE_NONE && owner >= types.size() ) { fail( "bad type reference" ); break; }
+        void * addr = bytecode_resolve_data( env, owner == CK_BYTECODE_NONE ? NULL : types[owner], name );
+        if( !addr ) fail( "unknown static data '" + name + "'" );
+        datas.push_back( addr );
+    }
+    // string literals
+    n = rcount();
+    for( t_CKUINT i = 0; i < n && ok; i++ )
+    {
+        Chuck_String * s = new Chuck_String();
+        if( !initialize_object( s, env->ckt_string, NULL, env->vm() ) )
+        { CK_SAFE_RELEASE( s ); fail( "out of memory" ); break; }
+        s->set( rs() );
+        s->add_ref(); keep.push_back( s );
+        strings.push_back( s );
+    }
+    // codes
+    n = rcount();
+    if( ok && !n ) fail( "image has no code" );
+    for( t_CKUINT i = 0; i < n && ok; i++ )
+    {
+        Chuck_VM_Code * code = new Chuck_VM_Code;
+        code->add_ref(); keep.push_back( code );
+        codes.push_back( code );
+    }
+    // functions
+    n = rcount();
+    for( t_CKUINT i = 0; i < n && ok; i++ )
+    {
+        Chuck_Bytecode_Func e;
+        e.kind = ru(); e.index = ru(); e.ordinal = ru(); e.name = rs(); e.base_name = rs();
+        if( !ok ) break;
+        Chuck_Func * f = NULL;
+        if( e.kind == ck_bc_func_image )
+        {
+            if( e.index >= codes.size() ) { fail( "bad code reference" ); break; }
+            f = new Chuck_Func;
+            f->name = e.name;
+            f->base_name = e.base_name;
+            f->code = codes[e.index];
+            f->code->add_ref();
+            f->add_ref(); keep.push_back( f );
+        }
+        else
+        {
+            if( e.index != CK_BYTECODE_NONE && e.index >= types.size() ) { fail( "bad type reference" ); break; }
+            f = bytecode_resolve_func( env, e.index == CK_BYTECODE_NONE ? NULL : types[e.index], e );
+            if( !f ) { fail( "unknown function '" + e.name + "'" ); break; }
+        }
+        funcs.push_back( f );
+    }
+
+    // code bodies
+    for( t_CKUINT c = 0; c < codes.size() && ok; c++ )
+    {
+        Chuck_VM_Code * code = codes[c];
+        code->name = rs(); code->filename = rs();
+        code->stack_depth = ru(); code->need_this = (t_CKBOOL)ru(); code->is_static = (t_CKBOOL)ru();
+        t_CKUINT count = rcount();
+        if( ok && !count ) fail( "empty code '" + code->name + "'" );
+        if( !ok ) break;
+        code->instr = new Chuck_Instr *[count];
+        currInstr.clear(); currOp.clear();
+        std::vector<Chuck_Instr_Branch_Op *> jumps;
+        for( t_CKUINT i = 0; i < count && ok; i++ )
+        {
+            t_CKUINT op = ru(); t_CKUINT line = ru();
+            if( !ok ) break;
+            if( op >= ops.size() ) { fail( "bad instruction" ); break; }
+            f_bc_read reader = g_bytecode_ops[ops[op]].read;
+            Chuck_Instr * instr = reader( *this );
+            instr->set_linepos( line );
+            // (num_instr tracks what has been filled in, for cleanup on error)
+            code->instr[code->num_instr++] = instr;
+            currInstr.push_back( instr ); currOp.push_back( ops[op] );
+            if( g_bytecode_ops[ops[op]].write == w_jump || reader == r_foreach )
+                jumps.push_back( (Chuck_Instr_Branch_Op *)instr );
+        }
+        // jumps must land inside the code
+        for( t_CKUINT j = 0; j < jumps.size() && ok; j++ )
+            if( jumps[j]->m_jmp >= count ) fail( "jump out of range in '" + code->name + "'" );
+    }
+    if( ok && inPos != inLen ) fail( "trailing data in image" );
+
+    if( !ok )
+    {
+        // release everything we made, in reverse
+        while( keep.size() ) { CK_SAFE_RELEASE( keep.back() ); keep.pop_back(); }
+        return NULL;
+    }
+
+    // the top-level code keeps the rest alive; shreds running any of it
+    // descend from a shred running the top-level code (children go with
+    // their parent), so nothing outlives it
+    for( t_CKUINT i = 0; i < keep.size(); i++ )
+        if( keep[i] != codes[0] ) codes[0]->image_refs.push_back( keep[i] );
+
+    return codes[0];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_serialize()
+// desc: serialize code into a bytecode image
+//-----------------------------------------------------------------------------
+t_CKBOOL bytecode_serialize( Chuck_Env * env, Chuck_VM_Code * code,
+                             std::string & image, std::string & error )
+{
+    Chuck_Bytecode_Codec codec( env );
+    if( !code || !codec.serialize( code, image ) )
+    {
+        error = code ? codec.error : "no code";
+        image.clear();
+        return FALSE;
+    }
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_deserialize()
+// desc: reconstruct code from a bytecode image
+//-----------------------------------------------------------------------------
+Chuck_VM_Code * bytecode_deserialize( Chuck_Env * env, const std::string & image,
+                                      std::string & error )
+{
+    Chuck_Bytecode_Codec codec( env );
+    Chuck_VM_Code * code = codec.deserialize( image );
+    if( !code ) error = codec.error;
+    return code;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_put32() / bytecode_get32()
+// desc: 32-bit little-endian integers, for source images
+//-----------------------------------------------------------------------------
+static void bytecode_put32( std::string & out, uint32_t v )
+{
+    for( t_CKUINT i = 0; i < 4; i++ ) out += (char)( (v >> (8*i)) & 0xff );
+}
+static t_CKBOOL bytecode_get32( const std::string & in, t_CKUINT & pos, uint32_t & v )
+{
+    if( in.size() < 4 || pos > in.size() - 4 ) return FALSE;
+    v = 0;
+    for( t_CKUINT i = 0; i < 4; i++ ) v |= (uint32_t)(unsigned char)in[pos+i] << (8*i);
+    pos += 4;
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_wrap_source()
+// desc: wrap program source as a source image
+//-----------------------------------------------------------------------------
+void bytecode_wrap_source( const std::string & code, const std::string & filepath,
+                           std::string & image )
+{
+    image = CK_BYTECODE_SOURCE_MAGIC;
+    bytecode_put32( image, CK_BYTECODE_FORMAT_VERSION );
+    bytecode_put32( image, (uint32_t)code.size() ); image += code;
+    bytecode_put32( image, (uint32_t)filepath.size() ); image += filepath;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_unwrap_source()
+// desc: if image is a source image, get its contents
+//-----------------------------------------------------------------------------
+t_CKBOOL bytecode_unwrap_source( const std::string & image, std::string & code,
+                                 std::string & filepath )
+{
+    // not a source image
+    if( image.compare( 0, 4, CK_BYTECODE_SOURCE_MAGIC ) ) return FALSE;
+
+    t_CKUINT pos = 4;
+    uint32_t version = 0, len = 0;
+    if( !bytecode_get32( image, pos, version ) || version != CK_BYTECODE_FORMAT_VERSION ) return FALSE;
+    // source
+    if( !bytecode_get32( image, pos, len ) || len > image.size() - pos ) return FALSE;
+    code = image.substr( pos, len ); pos += len;
+    // path
+    if( !bytecode_get32( image, pos, len ) || len > image.size() - pos ) return FALSE;
+    filepath = image.substr( pos, len );
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bytecode_is_source()
+// desc: whether an image is a source image
+//-----------------------------------------------------------------------------
+t_CKBOOL bytecode_is_source( const std::string & image )
+{
+    return !image.compare( 0, 4, CK_BYTECODE_SOURCE_MAGIC );
+}
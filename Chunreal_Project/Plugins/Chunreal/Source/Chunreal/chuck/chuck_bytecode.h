@@ -0,0 +1,92 @@
+/*----------------------------------------------------------------------------
+  ChucK Strongly-timed Audio Programming Language
+    Compiler, Virtual Machine, and Synthesis Engine
+
+  Copyright (c) 2003 Ge Wang and Perry R. Cook. All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the dual-license terms of EITHER the MIT License OR the GNU
+  General Public License (the latter as published by the Free Software
+  Foundation; either version 2 of the License or, at your option, any
+  later version).
+
+  This program is distributed in the hope that it will be useful and/or
+  interesting, but WITHOUT ANY WARRANTY; without even the implied warranty
+  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  MIT Licence and/or the GNU General Public License for details.
+
+  You should have received a copy of the MIT License and the GNU General
+  Public License (GPL) along with this program; a copy of the GPL can also
+  be obtained by writing to the Free Software Foundation, Inc., 59 Temple
+  Place, Suite 330, Boston, MA 02111-1307 U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_bytecode.h
+// desc: versioned binary images of emitted VM code, so that a
+//       self-contained program can be compiled ahead of time (e.g., when
+//       cooking content) and later loaded into a VM without running the
+//       parser, type checker, or emitter
+//
+//       an image holds the top-level code of one program, every spork~ stub
+//       and file-level function it reaches, and its string literals;
+//       references to types, functions, and static data that live in the
+//       type system are stored by name and resolved against the loading
+//       VM's type system.
+//
+//       SCOPE: user-defined types are not serialized, so programs that
+//       define classes or use @import are not precompiled at all; for
+//       those only a source image is written, which is compiled from
+//       scratch when loaded (see bytecode_is_source()). rebuilding public
+//       types and @import dependencies in the loading VM would need a
+//       later format version.
+//
+// date: Autumn 2026 | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_BYTECODE_H__
+#define __CHUCK_BYTECODE_H__
+
+#include "chuck_def.h"
+#include <string>
+#include <vector>
+
+
+// forward reference
+struct Chuck_Env;
+struct Chuck_VM_Code;
+struct Chuck_VM_Object;
+
+// image format version; bump on any change to the layout or to the
+// meaning of an instruction's operands
+#define CK_BYTECODE_FORMAT_VERSION  2
+
+
+
+
+// serialize `code` and everything it reaches into a bytecode image;
+// returns FALSE (with reason in `error`) if the code cannot be represented
+t_CKBOOL bytecode_serialize( Chuck_Env * env, Chuck_VM_Code * code,
+                             std::string & image, std::string & error );
+// reconstruct code from a bytecode image; returns the top-level code, with
+// a reference added for the caller, or NULL on error; everything else the
+// image creates (other code, functions, string literals) is released along
+// with the top-level code
+Chuck_VM_Code * bytecode_deserialize( Chuck_Env * env, const std::string & image,
+                                      std::string & error );
+// wrap program source, and the path @import resolves against, as a source
+// image, for programs a bytecode image cannot represent (e.g., ones that
+// define classes or use @import); loading one compiles the source
+void bytecode_wrap_source( const std::string & code, const std::string & filepath,
+                           std::string & image );
+// if `image` is a source image, get its contents and return TRUE
+t_CKBOOL bytecode_unwrap_source( const std::string & image, std::string & code,
+                                 std::string & filepath );
+// whether `image` is a source image, i.e., is not precompiled
+t_CKBOOL bytecode_is_source( const std::string & image );
+
+
+
+
+#endif
@@ -31,6 +31,9 @@
 //   date: (see header for information)
 //-----------------------------------------------------------------------------
 #include "chuck_compile.h"
+#include "chuck_bytecode.h"
+#include "chuck_fold.h"
+#include "chuck_escape.h"
 #include "chuck_lang.h"
 #include "chuck_errmsg.h"
 #include "chuck.h"
@@ -64,6 +67,7 @@
 #endif
 
 #include <sys/stat.h>
+#include <time.h>
 
 #include <string>
 #include <vector>
@@ -104,6 +108,9 @@ Chuck_Compiler::Chuck_Compiler()
 
     // origin hint | 1.5.0.0 (ge) added
     m_originHint = ckte_origin_UNKNOWN;
+    // nothing compiled yet | 1.5.5.3
+    m_lastSelfContained = FALSE;
+    m_bytecodeCode = NULL;
 }
 
 
@@ -185,6 +192,9 @@ void Chuck_Compiler::shutdown()
     // check the pointer is now NULL
     assert( emitter == NULL );
 
+    // release code loaded from a bytecode image | 1.5.5.3
+    CK_SAFE_RELEASE( m_bytecodeCode );
+
     // clear more state
     code = NULL;
     m_auto_depend = FALSE;
@@ -195,6 +205,9 @@ void Chuck_Compiler::shutdown()
     // pop indent
     EM_poplog();
 
+    // release types held for incremental recompilation | 1.5.5.3
+    m_importRegistry.releaseUnits();
+
     // if we have carrier
     if( m_carrier != NULL )
     {
@@ -388,6 +401,10 @@ t_CKBOOL Chuck_Compiler::compile( Chuck_CompileTarget * target )
 
     // set the chuck
     target->the_chuck = this->carrier()->chuck;
+    // until shown otherwise by compile_entire_file() | 1.5.5.3
+    m_lastSelfContained = FALSE;
+    // pick up changes to previously @import'ed files | 1.5.5.3
+    this->refresh_imports();
     // clear in-progress
     this->imports()->clearInProgress();
     // add current target to registry to avoid cycles
@@ -457,11 +474,16 @@ t_CKBOOL Chuck_Compiler::compile( Chuck_CompileTarget * target )
         // if target was an import (i.e., don't do this with the base target)
         if( sequence[i]->target->howMuch == te_do_import_only )
         {
+            // note what it added to [user], for reuse | 1.5.5.3
+            this->capture_exports( sequence[i]->target );
             // move target from in-progress to imported in registry
             this->imports()->commit( sequence[i]->target );
         }
     }
 
+    // code that depends on @import'ed definitions can't stand alone | 1.5.5.3
+    if( sequence.size() > 1 ) m_lastSelfContained = FALSE;
+
 cleanup:
     // 1.4.1.0 (ge) | added to unset the fileName reference, which determines
     // how messages print to console (e.g., [file.ck]: or [chuck]:)
@@ -740,10 +762,21 @@ t_CKBOOL Chuck_Compiler::compile_entire_file( Chuck_Context * context )
     if( !type_engine_check_context( env(), context, te_do_all ) )
         return FALSE;
 
+    // fold constants and drop dead branches (pass 3.5) | 1.5.5.3
+    if( !type_engine_fold_prog( env(), context->parse_tree, te_do_all ) )
+        return FALSE;
+
+    // find non-escaping temporaries and locals (pass 3.6) | 1.5.5.3
+    if( !type_engine_escape_prog( env(), context->parse_tree, te_do_all ) )
+        return FALSE;
+
     // emit (pass 4)
     this->code = emit_engine_emit_prog( emitter, context->parse_tree, te_do_all );
     if( !code ) return FALSE;
 
+    // no classes defined (each would have its own namespace) | 1.5.5.3
+    m_lastSelfContained = ( context->new_nspc.size() == 0 );
+
     // set the state of the context to done
     context->progress = Chuck_Context::P_ALL_DONE;
 
@@ -778,6 +811,14 @@ t_CKBOOL Chuck_Compiler::compile_import_only( Chuck_Context * context )
     if( !type_engine_check_context( env(), context, te_do_import_only ) )
         return FALSE;
 
+    // fold constants and drop dead branches (pass 3.5) | 1.5.5.3
+    if( !type_engine_fold_prog( env(), context->parse_tree, te_do_import_only ) )
+        return FALSE;
+
+    // find non-escaping temporaries and locals (pass 3.6) | 1.5.5.3
+    if( !type_engine_escape_prog( env(), context->parse_tree, te_do_import_only ) )
+        return FALSE;
+
     // emit (pass 4)
     if( !emit_engine_emit_prog( emitter, context->parse_tree, te_do_import_only ) )
         return FALSE;
@@ -811,6 +852,14 @@ t_CKBOOL Chuck_Compiler::compile_all_except_import( Chuck_Context * context )
     if( !type_engine_check_context( env(), context, te_skip_import ) )
         return FALSE;
 
+    // fold constants and drop dead branches (pass 3.5) | 1.5.5.3
+    if( !type_engine_fold_prog( env(), context->parse_tree, te_skip_import ) )
+        return FALSE;
+
+    // find non-escaping temporaries and locals (pass 3.6) | 1.5.5.3
+    if( !type_engine_escape_prog( env(), context->parse_tree, te_skip_import ) )
+        return FALSE;
+
     // emit (pass 4)
     code = emit_engine_emit_prog( emitter, context->parse_tree, te_skip_import );
     if( !code ) return FALSE;
@@ -890,6 +939,11 @@ t_CKBOOL type_engine_scan_import( Chuck_Env * env, a_Stmt_List stmt_list,
                             return FALSE;
                         }
                     }
+                    // unchanged since before the last VM clear? | 1.5.5.3
+                    else if( (t = compiler->reinstall( abs )) != NULL )
+                    {
+                        // nothing more to do; already compiled
+                    }
                     else
                     {
                         // make new target with import only
@@ -1013,9 +1067,6 @@ t_CKBOOL Chuck_Compiler::scan_imports( Chuck_CompileTarget * target )
         goto cleanup;
     }
 
-    // set the AST
-    target->AST = g_program;
-
     // log
     EM_log( CK_LOG_INFO, "@import scanning within target '%s'...", target->filename.c_str() );
 
@@ -1137,6 +1188,177 @@ cleanup:
 
 
 
+//-----------------------------------------------------------------------------
+// name: capture_exports() | 1.5.5.3 (added)
+// desc: remember (with a reference) the public classes an @import target
+//       added to the [user] namespace, and decide whether the target can be
+//       reinstalled as-is after the [user] namespace is cleared; called
+//       after a successful compile_single(), while the AST is still around
+//-----------------------------------------------------------------------------
+void Chuck_Compiler::capture_exports( Chuck_CompileTarget * target )
+{
+    // only targets read from files can be checked for changes later
+    target->reusable = target->fingerprint != 0;
+
+    // go through each of the program sections
+    for( a_Program prog = target->AST; prog != NULL; prog = prog->next )
+    {
+        if( prog->section->s_type == ae_section_class )
+        {
+            a_Class_Def class_def = prog->section->class_def;
+            // public classes (the only ones compiled on import)
+            if( class_def->decl != ae_key_public || !class_def->type ) continue;
+            // the type and the value that names it
+            Chuck_Type * type = class_def->type;
+            Chuck_Value * value = env()->user()
+                ? env()->user()->lookup_value( type->base_name, FALSE ) : NULL;
+            if( !value ) { target->reusable = FALSE; continue; }
+            // static data is initialized once, when emitted; re-running
+            // that on reuse is not possible, so rebuild instead
+            if( type->nspc && type->nspc->static_data_size ) target->reusable = FALSE;
+            // hold on to both
+            CK_SAFE_ADD_REF( type ); target->exportTypes.push_back( type );
+            CK_SAFE_ADD_REF( value ); target->exportValues.push_back( value );
+        }
+        else if( prog->section->s_type == ae_section_func )
+        {
+            // public operator overloads don't survive op_registry.reset2public()
+            a_Func_Def func_def = prog->section->func_def;
+            if( func_def->func_decl == ae_key_public && func_def->op2overload != ae_op_none )
+                target->reusable = FALSE;
+        }
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: reinstall() | 1.5.5.3 (added)
+// desc: reinstall an @import target retained across the last [user]
+//       namespace clear, skipping parse, type-check, and emit; possible
+//       only if its file is unchanged and every target it depends on has
+//       itself been reinstalled (i.e., the types it was checked against
+//       are the ones in effect); otherwise the retained target is discarded
+//       and the caller compiles the file from scratch
+//-----------------------------------------------------------------------------
+Chuck_CompileTarget * Chuck_Compiler::reinstall( const std::string & absolutePath )
+{
+    // anything retained under this path?
+    Chuck_CompileTarget * t = this->imports()->retained( absolutePath );
+    if( !t ) return NULL;
+    // the [user] namespace to install into
+    Chuck_Namespace * user = env()->user();
+
+    // the file itself
+    if( !user || t->modified() ) goto discard;
+
+    // its dependencies, depth first
+    for( t_CKUINT i = 0; i < t->dependencies.size(); i++ )
+    {
+        Chuck_CompileTarget * dep = t->dependencies[i].target;
+        // chugins persist across clears
+        if( dep->isSystemImport ) continue;
+        // already reinstalled (by an earlier @import)
+        if( this->imports()->committed( dep->absolutePath ) == dep ) continue;
+        // reinstall now, or give up
+        if( this->reinstall( dep->absolutePath ) != dep ) goto discard;
+    }
+
+    // names must still be free
+    for( t_CKUINT i = 0; i < t->exportTypes.size(); i++ )
+    {
+        if( user->lookup_type( t->exportTypes[i]->base_name, FALSE ) ||
+            user->lookup_value( t->exportTypes[i]->base_name, FALSE ) )
+            goto discard;
+    }
+
+    // put the public classes back in [user]
+    for( t_CKUINT i = 0; i < t->exportTypes.size(); i++ )
+    {
+        Chuck_Type * type = t->exportTypes[i];
+        Chuck_Value * value = t->exportValues[i];
+        // a public class addresses its file's context namespace, which
+        // sat under the previous [user] namespace; keep the new one alive
+        // for as long as this target is (see exportParent)
+        if( type->nspc->parent )
+        {
+            type->nspc->parent->parent = user;
+            if( t->exportParent != user ) CK_SAFE_REF_ASSIGN( t->exportParent, user );
+        }
+        // add type and value
+        user->add_type( type->base_name, type );
+        user->add_value( type->base_name, value );
+        CK_SAFE_REF_ASSIGN( value->owner, user );
+    }
+    // make it stick, independent of how the current compile goes
+    user->commit();
+
+    // back in the imported list
+    this->imports()->reinstate( t );
+    // log
+    EM_log( CK_LOG_FINE, "@import reusing unchanged '%s' (%lu class(es))",
+            t->filename.c_str(), (unsigned long)t->exportTypes.size() );
+    return t;
+
+discard:
+    // log
+    EM_log( CK_LOG_FINE, "@import '%s' (or a dependency) changed; recompiling", t->filename.c_str() );
+    // no longer usable
+    this->imports()->discard( t );
+    return NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: refresh_imports() | 1.5.5.3 (added)
+// desc: if any @import'ed file changed on disk since it was compiled, clear
+//       the [user] namespace so that the next compile picks up the change;
+//       files that did not change (and don't depend on one that did) are
+//       reinstalled as-is by reinstall(), so only the affected part of the
+//       dependency graph is actually recompiled
+//       NOTE: the compiler cannot tell whether the current types are still
+//       in use (shreds waiting to be sporked, globals holding user-defined
+//       objects, or a VM running on another thread), so this is off unless
+//       the host opts in with CHUCK_PARAM_IMPORT_AUTO_RELOAD, promising to
+//       compile only while nothing uses [user] types; otherwise, clearing
+//       the VM (e.g., Machine.clearVM()) picks up changes, and still reuses
+//       whatever did not change
+//-----------------------------------------------------------------------------
+void Chuck_Compiler::refresh_imports()
+{
+    // opt-in
+    if( !this->carrier()->chuck->getParamInt( CHUCK_PARAM_IMPORT_AUTO_RELOAD ) ) return;
+    // nothing to do
+    if( !this->imports()->hasStaleUserImports() ) return;
+
+    // last line of defense: shreds known to be running use the current types
+    if( this->vm() && this->vm()->num_shreds() )
+    {
+        EM_log( CK_LOG_WARNING, "@import'ed file(s) modified; not reloading while shreds are running" );
+        return;
+    }
+
+    // public classes not defined by an @import target would be lost
+    std::vector<Chuck_Type *> types;
+    if( env()->user() ) env()->user()->get_types( types );
+    if( types.size() != this->imports()->numUserExports() )
+    {
+        EM_log( CK_LOG_WARNING, "@import'ed file(s) modified; not reloading (other public classes defined)" );
+        return;
+    }
+
+    // log
+    EM_log( CK_LOG_INFO, "@import'ed file(s) modified; reloading..." );
+    // clears [user] and retains what can be reused
+    env()->clear_user_namespace();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: output()
 // desc: get the code generated by the last do()
@@ -1149,6 +1371,75 @@ Chuck_VM_Code * Chuck_Compiler::output()
 
 
 
+//-----------------------------------------------------------------------------
+// name: saveBytecode() | 1.5.5.3 (added)
+// desc: save the code from the last compile() as a bytecode image
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Compiler::saveBytecode( std::string & image )
+{
+    // error message
+    std::string error;
+
+    // check
+    if( !this->code )
+    {
+        EM_error2( 0, "saveBytecode() invoked with no compiled code..." );
+        return FALSE;
+    }
+    // classes and imports would need to be registered with the type system
+    if( !m_lastSelfContained )
+    {
+        EM_log( CK_LOG_INFO, "bytecode: '%s' defines classes or uses @import; not saved",
+                code->name.c_str() );
+        return FALSE;
+    }
+    // serialize
+    if( !bytecode_serialize( env(), code, image, error ) )
+    {
+        EM_log( CK_LOG_INFO, "bytecode: '%s' not saved: %s", code->name.c_str(), error.c_str() );
+        return FALSE;
+    }
+
+    // log
+    EM_log( CK_LOG_FINE, "bytecode: saved '%s' (%lu bytes)", code->name.c_str(),
+            (unsigned long)image.size() );
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: loadBytecode() | 1.5.5.3 (added)
+// desc: load a bytecode image in place of compiling
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Compiler::loadBytecode( const std::string & image )
+{
+    // error message
+    std::string error;
+
+    // deserialize
+    Chuck_VM_Code * loaded = bytecode_deserialize( env(), image, error );
+    if( !loaded )
+    {
+        EM_error2( 0, "cannot load bytecode image: %s", error.c_str() );
+        return FALSE;
+    }
+
+    // becomes the output; the previous image's code lives on only as
+    // long as shreds run it
+    CK_SAFE_RELEASE( m_bytecodeCode );
+    m_bytecodeCode = loaded;
+    this->code = loaded;
+    m_lastSelfContained = TRUE;
+
+    return TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: setReplaceDac()
 // desc: tell the compiler whether dac should be replaced in scripts
@@ -2365,15 +2656,30 @@ void Chuck_ImportRegistry::clearAllUserImports()
 
     // list of iterators to erase after iterating
     vector<string> itersToErase;
+    // which targets can be retained for reuse | 1.5.5.3
+    map<Chuck_CompileTarget *, t_CKBOOL> keep;
 
-    // clear imported CK Files
+    // drop what was retained by a previous clear and not reused since | 1.5.5.3
     map<std::string, Chuck_CompileTarget *>::iterator iterT;
+    for( iterT = m_retainedTargets.begin(); iterT != m_retainedTargets.end(); iterT++ )
+    { CK_SAFE_DELETE( iterT->second ); }
+    m_retainedTargets.clear();
+
+    // decide before deleting anything, since this follows dependencies
+    for( iterT = m_importedTargets.begin(); iterT != m_importedTargets.end(); iterT++ )
+    {
+        if( iterT->second->isSystemImport == FALSE )
+            retainable( iterT->second, keep );
+    }
+
+    // clear imported CK Files
     for( iterT = m_importedTargets.begin(); iterT != m_importedTargets.end(); iterT++ )
     {
         if( iterT->second->isSystemImport == FALSE )
         {
-            // delete each imported CK file
-            CK_SAFE_DELETE( iterT->second );
+            // retain for reinstall() if possible; else delete | 1.5.5.3
+            if( keep[iterT->second] ) m_retainedTargets[iterT->first] = iterT->second;
+            else CK_SAFE_DELETE( iterT->second );
             // add key to list to be erased after this loop
             itersToErase.push_back( iterT->first );
         }
@@ -2390,6 +2696,152 @@ void Chuck_ImportRegistry::clearAllUserImports()
 
 
 
+//-----------------------------------------------------------------------------
+// name: retainable() | 1.5.5.3 (added)
+// desc: can a target be retained across a [user] namespace clear? only if
+//       it is reusable and each user target it depends on is retainable
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_ImportRegistry::retainable( Chuck_CompileTarget * target,
+                                           map<Chuck_CompileTarget *, t_CKBOOL> & memo )
+{
+    // already decided
+    map<Chuck_CompileTarget *, t_CKBOOL>::iterator it = memo.find( target );
+    if( it != memo.end() ) return it->second;
+
+    // the target itself
+    t_CKBOOL ok = target->reusable && target->state == te_compile_complete;
+    // and its dependencies
+    for( t_CKUINT i = 0; ok && i < target->dependencies.size(); i++ )
+    {
+        Chuck_CompileTarget * dep = target->dependencies[i].target;
+        if( !dep->isSystemImport ) ok = retainable( dep, memo );
+    }
+
+    // remember
+    memo[target] = ok;
+    return ok;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: committed() | 1.5.5.3 (added)
+// desc: look up a compiled target by exact key
+//-----------------------------------------------------------------------------
+Chuck_CompileTarget * Chuck_ImportRegistry::committed( const std::string & key )
+{
+    map<string, Chuck_CompileTarget *>::iterator it = m_importedTargets.find( key );
+    return it != m_importedTargets.end() ? it->second : NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: retained() | 1.5.5.3 (added)
+// desc: look up a target retained by the last clearAllUserImports()
+//-----------------------------------------------------------------------------
+Chuck_CompileTarget * Chuck_ImportRegistry::retained( const std::string & key )
+{
+    map<string, Chuck_CompileTarget *>::iterator it = m_retainedTargets.find( key );
+    return it != m_retainedTargets.end() ? it->second : NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: reinstate() | 1.5.5.3 (added)
+// desc: move a retained target back to the imported list
+//-----------------------------------------------------------------------------
+void Chuck_ImportRegistry::reinstate( Chuck_CompileTarget * target )
+{
+    // remove from retained
+    m_retainedTargets.erase( target->key() );
+    // insert into imported map
+    m_importedTargets[target->key()] = target;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: discard() | 1.5.5.3 (added)
+// desc: delete a retained target
+//-----------------------------------------------------------------------------
+void Chuck_ImportRegistry::discard( Chuck_CompileTarget * target )
+{
+    // remove from retained
+    m_retainedTargets.erase( target->key() );
+    // delete
+    CK_SAFE_DELETE( target );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: hasStaleUserImports() | 1.5.5.3 (added)
+// desc: check whether any imported user file has changed on disk
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_ImportRegistry::hasStaleUserImports()
+{
+    map<string, Chuck_CompileTarget *>::iterator it;
+    for( it = m_importedTargets.begin(); it != m_importedTargets.end(); it++ )
+    {
+        if( it->second->isSystemImport == FALSE && it->second->modified() )
+        {
+            // log
+            EM_log( CK_LOG_FINE, "@import '%s' modified on disk", it->second->filename.c_str() );
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: numUserExports() | 1.5.5.3 (added)
+// desc: number of public types exported by imported user files
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_ImportRegistry::numUserExports()
+{
+    t_CKUINT n = 0;
+    map<string, Chuck_CompileTarget *>::iterator it;
+    for( it = m_importedTargets.begin(); it != m_importedTargets.end(); it++ )
+    {
+        if( it->second->isSystemImport == FALSE )
+            n += it->second->exportTypes.size();
+    }
+    return n;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: releaseUnits() | 1.5.5.3 (added)
+// desc: delete retained targets and release types held by imported ones;
+//       called before the type system is shut down
+//-----------------------------------------------------------------------------
+void Chuck_ImportRegistry::releaseUnits()
+{
+    map<string, Chuck_CompileTarget *>::iterator it;
+    // retained
+    for( it = m_retainedTargets.begin(); it != m_retainedTargets.end(); it++ )
+    { CK_SAFE_DELETE( it->second ); }
+    m_retainedTargets.clear();
+    // imported
+    for( it = m_importedTargets.begin(); it != m_importedTargets.end(); it++ )
+    { it->second->releaseExports(); }
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: shutdown()
 // desc: remove all imports (system and user)
@@ -2398,6 +2850,8 @@ void Chuck_ImportRegistry::shutdown()
 {
     // clear in progress
     clearInProgress();
+    // clear retained | 1.5.5.3
+    releaseUnits();
 
     // clear imported CK Files
     map<std::string, Chuck_CompileTarget *>::iterator iterT;
@@ -2429,8 +2883,16 @@ void Chuck_ImportRegistry::shutdown()
 //-----------------------------------------------------------------------------
 void Chuck_CompileTarget::cleanupAST()
 {
+    // tree allocated from arena: reclaim all of it at once | 1.5.5.3
+    if( arena )
+    {
+        // delete arena (also covers any partial tree from a failed parse)
+        delete_arena( arena );
+        // null out
+        arena = NULL; AST = NULL;
+    }
     // clean up abstract syntax tree
-    if( AST )
+    else if( AST )
     {
         // delete tree
         delete_program( AST );
@@ -2442,6 +2904,82 @@ void Chuck_CompileTarget::cleanupAST()
 
 
 
+//-----------------------------------------------------------------------------
+// name: fingerprint_file() | 1.5.5.3 (added)
+// desc: FNV-1a hash of everything from the current position of `fd` to EOF
+//-----------------------------------------------------------------------------
+static t_CKUINT fingerprint_file( FILE * fd )
+{
+    // 64-bit FNV-1a (truncated on 32-bit builds)
+    unsigned long long h = 14695981039346656037ULL;
+    // read buffer
+    unsigned char buf[4096];
+    size_t n = 0;
+    // hash every byte
+    while( (n = fread( buf, 1, sizeof(buf), fd )) > 0 )
+    {
+        for( size_t i = 0; i < n; i++ )
+        { h ^= buf[i]; h *= 1099511628211ULL; }
+    }
+    // never 0, which means "no fingerprint"
+    return h ? (t_CKUINT)h : 1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: releaseExports() | 1.5.5.3 (added)
+// desc: release references to exported types and values
+//-----------------------------------------------------------------------------
+void Chuck_CompileTarget::releaseExports()
+{
+    for( t_CKUINT i = 0; i < exportTypes.size(); i++ )
+    { CK_SAFE_RELEASE( exportTypes[i] ); }
+    for( t_CKUINT i = 0; i < exportValues.size(); i++ )
+    { CK_SAFE_RELEASE( exportValues[i] ); }
+    exportTypes.clear();
+    exportValues.clear();
+    CK_SAFE_RELEASE( exportParent );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: modified() | 1.5.5.3 (added)
+// desc: has the source file changed since the target was compiled? the
+//       timestamp is checked first; if it differs, the contents are hashed,
+//       so that a touched-but-identical file still counts as unchanged
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_CompileTarget::modified()
+{
+    // code literals and chugins are not tracked
+    if( !fingerprint ) return FALSE;
+
+    // timestamp unchanged (and older than the fingerprint): assume
+    // contents unchanged
+    time_t t = file_last_write_time( absolutePath );
+    if( t == timestamp && t < fingerprintTime ) return FALSE;
+
+    // hash the file as it is now
+    FILE * fd = fopen( absolutePath.c_str(), "rb" );
+    // gone or unreadable counts as modified
+    if( !fd ) return TRUE;
+    t_CKUINT f = fingerprint_file( fd );
+    fclose( fd );
+
+    // changed contents
+    if( f != fingerprint ) return TRUE;
+
+    // same contents; remember the new timestamp to skip hashing next time
+    timestamp = t; fingerprintTime = time( NULL );
+    return FALSE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: cleanup()
 // desc: performs cleanup (e.g., close file descriptors and reclaims AST)
@@ -2537,6 +3075,11 @@ t_CKBOOL Chuck_Compiler::openFile( Chuck_CompileTarget * target,
         return FALSE;
     }
 
+    // fingerprint the contents, for detecting changes later | 1.5.5.3
+    target->fingerprint = fingerprint_file( target->fd2parse );
+    target->timestamp = file_last_write_time( target->absolutePath );
+    target->fingerprintTime = time( NULL );
+
     // set file descriptor to beginning
     fseek( target->fd2parse, 0, SEEK_SET );
 
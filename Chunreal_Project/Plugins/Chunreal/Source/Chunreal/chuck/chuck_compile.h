@@ -114,7 +114,8 @@ public:
     Chuck_CompileTarget( te_HowMuch extent = te_do_all )
         : state(te_compile_inprogress), howMuch(extent), isSystemImport(FALSE),
           fd2parse(NULL), chugin(NULL), lineNum(1), tokPos(0),
-          AST(NULL), timestamp(0), the_chuck(NULL)
+          AST(NULL), arena(NULL), timestamp(0), fingerprint(0), fingerprintTime(0),
+          exportParent(NULL), reusable(FALSE), the_chuck(NULL)
     {
         // initialize
         the_linePos = intList( 0, NULL );
@@ -122,13 +123,17 @@ public:
 
     // destructor
     virtual ~Chuck_CompileTarget()
-    { cleanup(); CK_SAFE_FREE( the_linePos ); }
+    { cleanup(); releaseExports(); CK_SAFE_FREE( the_linePos ); }
 
     // performs cleanup (e.g., close file desriptors and reclaims AST)
     // post-parser prep for target to be archived in registry
     void cleanup();
     // clean up AST
     void cleanupAST();
+    // release references to exported types | 1.5.5.3
+    void releaseExports();
+    // has the source file changed since the target was compiled? | 1.5.5.3
+    t_CKBOOL modified();
 
 public:
     // get filename
@@ -171,6 +176,8 @@ public:
     CompileFileSource fileSource;
     // pointer to abstract syntax tree
     a_Program AST;
+    // arena backing AST (released with it in one shot) | 1.5.5.3
+    a_Arena arena;
     // for the current file
     IntList the_linePos;
 
@@ -180,6 +187,24 @@ public:
     // timestamp of target file when target was compiled
     // used to detect and potentially warn of modified files
     time_t timestamp;
+    // hash of the file contents at compile time; confirms a change when
+    // the timestamp differs (0 for code literals) | 1.5.5.3
+    t_CKUINT fingerprint;
+    // when the fingerprint was taken; a timestamp in the same second is
+    // not trusted, since a later write may not have changed it | 1.5.5.3
+    time_t fingerprintTime;
+    // public classes this @import target put in the [user] namespace, and
+    // their values; referenced so an unchanged target can be reinstalled
+    // after the [user] namespace is cleared | 1.5.5.3
+    std::vector<Chuck_Type *> exportTypes;
+    std::vector<Chuck_Value *> exportValues;
+    // the [user] namespace the classes were last reinstalled under; the
+    // context namespace they address points at it without a reference,
+    // so hold one here for as long as the target is around | 1.5.5.3
+    Chuck_Namespace * exportParent;
+    // can be retained across a [user] namespace clear (no static data,
+    // no public operator overloads) | 1.5.5.3
+    t_CKBOOL reusable;
     // reference to ChucK instance
     ChucK * the_chuck;
 };
@@ -218,6 +243,28 @@ public:
     // add a chugin
     Chuck_CompileTarget * commit( Chuck_DLL * chugin );
 
+public: // incremental recompilation | 1.5.5.3
+    // look up a compiled target by exact key (absolute path)
+    Chuck_CompileTarget * committed( const std::string & key );
+    // look up a target retained from before the last clearAllUserImports()
+    Chuck_CompileTarget * retained( const std::string & key );
+    // move a retained target back to the imported list
+    void reinstate( Chuck_CompileTarget * target );
+    // delete a retained target that can no longer be reused
+    void discard( Chuck_CompileTarget * target );
+    // check whether any imported user file has changed on disk
+    t_CKBOOL hasStaleUserImports();
+    // number of public types exported by imported user files
+    t_CKUINT numUserExports();
+    // release retained targets and exported types; call before the type
+    // system is shut down
+    void releaseUnits();
+
+protected:
+    // can target (and everything it depends on) be retained?
+    t_CKBOOL retainable( Chuck_CompileTarget * target,
+                         std::map<Chuck_CompileTarget *, t_CKBOOL> & memo );
+
 protected:
     // clear everything (system and user)
     void shutdown();
@@ -229,6 +276,9 @@ protected:
     std::map<std::string, Chuck_CompileTarget *> m_importedTargets;
     // map of successfully imported chugins
     std::map<std::string, Chuck_DLL *> m_importedChugins;
+    // map of user targets retained across the last user-namespace clear,
+    // awaiting reinstallation if unchanged | 1.5.5.3
+    std::map<std::string, Chuck_CompileTarget *> m_retainedTargets;
 };
 
 
@@ -275,6 +325,13 @@ public: // data
     // to denote where new entities originate | 1.5.0.0 (ge) added
     ckte_Origin m_originHint;
 
+    // whether the last compile() produced code with no definitions of its
+    // own (classes) and no @import, i.e., could be saved as bytecode | 1.5.5.3
+    t_CKBOOL m_lastSelfContained;
+    // code from the last loadBytecode(), referenced until the next one;
+    // shreds running it hold their own references | 1.5.5.3
+    Chuck_VM_Code * m_bytecodeCode;
+
 public: // to all
     // contructor
     Chuck_Compiler();
@@ -297,6 +354,16 @@ public: // compile from file or code
     // get the code generated from the last compile()
     Chuck_VM_Code * output();
 
+public: // precompiled bytecode | 1.5.5.3 (added)
+    // save the code from the last compile() as a bytecode image;
+    // returns FALSE if the program cannot be represented as an image
+    // (e.g., it defines classes or uses @import); ChucK::compileCodeToBytecode()
+    // then saves a source image instead
+    t_CKBOOL saveBytecode( std::string & image );
+    // load a bytecode image in place of compiling; on success, output()
+    // returns the loaded code
+    t_CKBOOL loadBytecode( const std::string & image );
+
 public: // import while observing semantics of chuck @import
     // import a .ck module by file path
     t_CKBOOL importFile( const std::string & filename );
@@ -314,6 +381,9 @@ public:
     // NOTE: this function will memory-manage `target`
     // (do not access or delete `target` after function call)
     t_CKBOOL compile( Chuck_CompileTarget * target );
+    // reinstall an @import target retained across a [user] namespace clear,
+    // if it and its dependencies are unchanged; NULL otherwise | 1.5.5.3
+    Chuck_CompileTarget * reinstall( const std::string & absolutePath );
 
 public:
     // opens file for compilation...
@@ -395,6 +465,11 @@ protected: // internal
     t_CKBOOL compile_import_only( Chuck_Context * context ); // 1.5.4.0 (ge) added
     // all except import
     t_CKBOOL compile_all_except_import( Chuck_Context * context );
+    // remember public types an @import target added to [user] | 1.5.5.3
+    void capture_exports( Chuck_CompileTarget * target );
+    // rebuild @import targets whose files changed on disk, if enabled
+    // with CHUCK_PARAM_IMPORT_AUTO_RELOAD | 1.5.5.3
+    void refresh_imports();
 
 protected: // import
     // scan for @import statements; builds a list of dependencies in the target
@@ -216,6 +216,14 @@ typedef struct { SAMPLE re ; SAMPLE im ; } t_CKCOMPLEX_SAMPLE;
 #define CK_TRACK( stmt )
 #endif
 
+// per-thread storage for plain-old-data globals shared between the C
+// parser/lexer and the C++ compiler (lets compiles run in parallel) | 1.5.5.3
+#if defined(_MSC_VER)
+#define CK_THREAD_LOCAL             __declspec(thread)
+#else
+#define CK_THREAD_LOCAL             __thread
+#endif
+
 
 //-------------------------------------------
 // operating system identification
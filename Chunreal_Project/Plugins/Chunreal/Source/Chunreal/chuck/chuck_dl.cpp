@@ -758,6 +758,59 @@ void CK_DLL_CALL ck_add_ugen_funcf_auto_num_channels( Chuck_DL_Query * query,
 
 
 
+//-----------------------------------------------------------------------------
+// name: ck_add_ugen_funcv()
+// desc: (ugen only) add block tick function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+void CK_DLL_CALL ck_add_ugen_funcv( Chuck_DL_Query * query, f_tickv ugen_tickv )
+{
+    // make sure there is class
+    if( !query->curr_class )
+    {
+        // error
+        EM_error2( 0, "class import: add_ugen_funcv invoked without begin_class..." );
+        return;
+    }
+
+    // make sure tickv not defined already
+    if( query->curr_class->ugen_tickv && ugen_tickv )
+    {
+        // error
+        EM_error2( 0, "class import: ugen_tickv already defined..." );
+        return;
+    }
+
+    // set
+    if( ugen_tickv ) query->curr_class->ugen_tickv = ugen_tickv;
+    query->curr_func = NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_ugen_threadsafe()
+// desc: (ugen only) declare whether ticks may run on a helper thread
+//       | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+void CK_DLL_CALL ck_ugen_threadsafe( Chuck_DL_Query * query, t_CKBOOL threadsafe )
+{
+    // make sure there is class
+    if( !query->curr_class )
+    {
+        // error
+        EM_error2( 0, "class import: ugen_threadsafe invoked without begin_class..." );
+        return;
+    }
+
+    // set
+    query->curr_class->ugen_threadsafe = threadsafe;
+    query->curr_func = NULL;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: ck_add_ugen_ctrl()
 // desc: (ugen only) add ctrl parameters
@@ -1440,6 +1493,8 @@ Chuck_DL_Query::Chuck_DL_Query( Chuck_Carrier * carrier, Chuck_DLL * dll )
     add_ugen_func = ck_add_ugen_func;
     add_ugen_funcf = ck_add_ugen_funcf;
     add_ugen_funcf_auto_num_channels = ck_add_ugen_funcf_auto_num_channels;
+    add_ugen_funcv = ck_add_ugen_funcv; // 1.5.5.3 added
+    ugen_threadsafe = ck_ugen_threadsafe; // 1.5.5.3 added
     // add_ugen_ctrl = ck_add_ugen_ctrl; // not used
     end_class = ck_end_class;
     doc_class = ck_doc_class;
@@ -2887,6 +2942,9 @@ Chuck_DL_Return CK_DLL_CALL ck_invoke_mfun_immediate_mode( Chuck_Object * obj, t
         func->invoker_mfun->invoke( obj, args_vector, caller_shred );
     }
 
+    // a ugen may no longer be at rest | 1.5.5.3
+    if( Chuck_UGen::wakes( func, vm ) ) ((Chuck_UGen *)obj)->wake();
+
     // return it
     return RETURN;
 }
@@ -64,7 +64,7 @@
 #define CK_DLL_VERSION_MAJOR (10)
 // minor API version: revisions
 // minor API version of chuck must >= API version of chugin
-#define CK_DLL_VERSION_MINOR (2)
+#define CK_DLL_VERSION_MINOR (3)
 #define CK_DLL_VERSION_MAKE(maj,min) ((t_CKUINT)(((maj) << 16) | (min)))
 #define CK_DLL_VERSION_GETMAJOR(v) (((v) >> 16) & 0xFFFF)
 #define CK_DLL_VERSION_GETMINOR(v) ((v) & 0xFFFF)
@@ -283,6 +283,12 @@ typedef const Chuck_DL_Api * CK_DL_API;
 // macro for defining ChucK DLL export ugen multi-channel tick functions
 // example: CK_DLL_TICKF(foo)
 #define CK_DLL_TICKF(name) CK_DLL_EXPORT(t_CKBOOL) name( Chuck_Object * SELF, SAMPLE * in, SAMPLE * out, t_CKUINT nframes, CK_DL_API API )
+// macro for defining ChucK DLL export ugen block tick functions | 1.5.5.3 (added)
+// example: CK_DLL_TICKV(foo)
+#define CK_DLL_TICKV(name) CK_DLL_EXPORT(t_CKBOOL) name( Chuck_Object * SELF, SAMPLE * in, SAMPLE * out, t_CKUINT nframes, CK_DL_API API )
+// macro for defining ugen block tick functions over several instances | 1.5.5.3 (added)
+// example: CK_DLL_TICKVN(foo)
+#define CK_DLL_TICKVN(name) CK_DLL_EXPORT(t_CKBOOL) name( Chuck_Object ** SELF, SAMPLE ** in, SAMPLE ** out, t_CKUINT count, t_CKUINT nframes, CK_DL_API API )
 // macro for defining ChucK DLL export ugen ctrl functions
 // example: CK_DLL_CTRL(foo)
 #define CK_DLL_CTRL(name) CK_DLL_EXPORT(void) name( Chuck_Object * SELF, void * ARGS, Chuck_DL_Return * RETURN, Chuck_VM * VM, Chuck_VM_Shred * SHRED, CK_DL_API API )
@@ -337,6 +343,23 @@ typedef t_CKVOID (CK_DLL_CALL * f_gfun)( void * ARGS, Chuck_DL_Return * RETURN,
 // ugen specific
 typedef t_CKBOOL (CK_DLL_CALL * f_tick)( Chuck_Object * SELF, SAMPLE in, SAMPLE * out, CK_DL_API API );
 typedef t_CKBOOL (CK_DLL_CALL * f_tickf)( Chuck_Object * SELF, SAMPLE * in, SAMPLE * out, t_CKUINT nframes, CK_DL_API API );
+// 1.5.5.3 added: mono tick over a block; in and out each hold nframes samples
+typedef t_CKBOOL (CK_DLL_CALL * f_tickv)( Chuck_Object * SELF, SAMPLE * in, SAMPLE * out, t_CKUINT nframes, CK_DL_API API );
+// 1.5.5.3 added: f_tickv over count instances of one ugen type at once, each
+// with its own in[k] and out[k]; FALSE if any instance is not valid
+// (builtin ugens only for now; see type_engine_import_ugen_tickvn())
+typedef t_CKBOOL (CK_DLL_CALL * f_tickvn)( Chuck_Object ** SELF, SAMPLE ** in, SAMPLE ** out, t_CKUINT count, t_CKUINT nframes, CK_DL_API API );
+// 1.5.5.3 added: besides TRUE and FALSE (not valid), f_tick and f_tickv may
+// return either or both of these flags: CK_TICK_SILENT if all of this output
+// is zero; CK_TICK_DORMANT if the ugen is at rest: so long as its input stays
+// zero and none of its member functions are called, its output from the next
+// tick on is zero and its state does not (observably) change; the VM then
+// skips ticking it -- so flush any state left below CK_TICK_FLOOR to zero
+// before saying so
+#define CK_TICK_SILENT      2
+#define CK_TICK_DORMANT     4
+// level under which a ugen's state counts as decayed to silence (-180dB)
+#define CK_TICK_FLOOR       1e-9
 typedef t_CKVOID (CK_DLL_CALL * f_ctrl)( Chuck_Object * SELF, void * ARGS, Chuck_DL_Return * RETURN, Chuck_VM * VM, Chuck_VM_Shred * SHRED, CK_DL_API API );
 typedef t_CKVOID (CK_DLL_CALL * f_cget)( Chuck_Object * SELF, void * ARGS, Chuck_DL_Return * RETURN, Chuck_VM * VM, Chuck_VM_Shred * SHRED, CK_DL_API API );
 typedef t_CKBOOL (CK_DLL_CALL * f_pmsg)( Chuck_Object * SELF, const char * MSG, void * ARGS, Chuck_VM * VM, Chuck_VM_Shred * SHRED, CK_DL_API API );
@@ -417,6 +440,10 @@ typedef void (CK_DLL_CALL * f_add_arg)( Chuck_DL_Query * query, const char * typ
 typedef void (CK_DLL_CALL * f_add_ugen_func)( Chuck_DL_Query * query, f_tick tick, f_pmsg pmsg, t_CKUINT num_in, t_CKUINT num_out );
 typedef void (CK_DLL_CALL * f_add_ugen_funcf)( Chuck_DL_Query * query, f_tickf tickf, f_pmsg pmsg, t_CKUINT num_in, t_CKUINT num_out );
 typedef void (CK_DLL_CALL * f_add_ugen_funcf_auto_num_channels)( Chuck_DL_Query * query, f_tickf tickf, f_pmsg psmg );
+// ** add a block tick alongside the tick from add_ugen_func() | 1.5.5.3 (added)
+typedef void (CK_DLL_CALL * f_add_ugen_funcv)( Chuck_DL_Query * query, f_tickv tickv );
+// ** declare whether a ugen's ticks may run on a helper thread | 1.5.5.3 (added)
+typedef void (CK_DLL_CALL * f_ugen_threadsafe)( Chuck_DL_Query * query, t_CKBOOL threadsafe );
 // ** add a ugen control (not used) | 1.4.1.0 removed
 //typedef void (CK_DLL_CALL * f_add_ugen_ctrl)( Chuck_DL_Query * query, f_ctrl ctrl, f_cget cget,
 //                                              const char * type, const char * name );
@@ -634,6 +661,21 @@ public:
     // -------------
     f_register_callback_on_srate_update register_callback_on_srate_update;
 
+public:
+    // -------------
+    // (ugen only) add a block tick to be used when the VM computes
+    // audio in blocks (adaptive mode); the scalar tick added through
+    // add_ugen_func() is still required, and is used otherwise | 1.5.5.3 (added)
+    // -------------
+    f_add_ugen_funcv add_ugen_funcv;
+    // -------------
+    // (ugen only) declare that the ugen's ticks touch nothing but the
+    // instance (no globals, no thread-local state, no calls back into the
+    // VM), so that the VM may tick it on a helper thread alongside other
+    // ugens (see CHUCK_PARAM_VM_UGEN_THREADS); off unless called | 1.5.5.3 (added)
+    // -------------
+    f_ugen_threadsafe ugen_threadsafe;
+
 
 
 
@@ -731,6 +773,10 @@ struct Chuck_DL_Class
     f_tick ugen_tick;
     // ugen_tickf
     f_tickf ugen_tickf;
+    // ugen_tickv | 1.5.5.3 (added)
+    f_tickv ugen_tickv;
+    // ticks may run on a helper thread | 1.5.5.3 (added)
+    t_CKBOOL ugen_threadsafe;
     // ugen_pmsg
     f_pmsg ugen_pmsg;
     // ugen_ctrl/cget
@@ -751,7 +797,7 @@ struct Chuck_DL_Class
     std::string hint_dll_filepath;
 
     // constructor
-    Chuck_DL_Class() { dtor = NULL; ugen_tick = NULL; ugen_tickf = NULL; ugen_pmsg = NULL; uana_tock = NULL; ugen_pmsg = NULL; current_mvar_offset = 0; ugen_num_in = ugen_num_out = 0; }
+    Chuck_DL_Class() { dtor = NULL; ugen_tick = NULL; ugen_tickf = NULL; ugen_tickv = NULL; ugen_threadsafe = FALSE; ugen_pmsg = NULL; uana_tock = NULL; ugen_pmsg = NULL; current_mvar_offset = 0; ugen_num_in = ugen_num_out = 0; }
     // destructor
     ~Chuck_DL_Class();
 };
@@ -38,6 +38,7 @@
 #include "chuck_globals.h" // added 1.4.1.0
 #include "chuck_parse.h" // added 1.5.0.0
 #include "util_string.h" // added 1.5.0.5
+#include "chuck_fold.h" // added 1.5.5.3
 #include <sstream>
 #include <iostream>
 using namespace std;
@@ -101,7 +102,7 @@ t_CKBOOL emit_engine_emit_class_def( Chuck_Emitter * emit, a_Class_Def class_def
 t_CKBOOL emit_engine_pre_constructor( Chuck_Emitter * emit, Chuck_Type * type, a_Ctor_Call ctor_info );
 t_CKBOOL emit_engine_instantiate_object( Chuck_Emitter * emit, Chuck_Type * type,
                                          a_Ctor_Call ctor_info, a_Array_Sub array, t_CKBOOL is_ref,
-                                         t_CKBOOL is_array_ref );
+                                         t_CKBOOL is_array_ref, t_CKBOOL scratch = FALSE );
 t_CKBOOL emit_engine_emit_spork( Chuck_Emitter * emit, a_Exp_Func_Call exp );
 t_CKBOOL emit_engine_emit_cast( Chuck_Emitter * emit, Chuck_Type * to, Chuck_Type * from, uint32_t where );
 t_CKBOOL emit_engine_emit_symbol( Chuck_Emitter * emit, S_Symbol symbol,
@@ -109,6 +110,7 @@ t_CKBOOL emit_engine_emit_symbol( Chuck_Emitter * emit, S_Symbol symbol,
                                   t_CKUINT line, t_CKUINT where, a_Exp_Primary exp );
 Chuck_Instr_Stmt_Start * emit_engine_track_stmt_refs_start( Chuck_Emitter * emit, a_Stmt stmt );
 void emit_engine_track_stmt_refs_cleanup( Chuck_Emitter * emit, Chuck_Instr_Stmt_Start * start );
+void emit_engine_emit_addref_on_stack( Chuck_Emitter * emit, a_Exp exp );
 // disabled until further notice (added 1.3.0.0)
 // t_CKBOOL emit_engine_emit_spork( Chuck_Emitter * emit, a_Stmt stmt );
 
@@ -186,6 +188,9 @@ Chuck_VM_Code * emit_engine_emit_prog( Chuck_Emitter * emit, a_Program prog,
     EM_pushlog();
     // log how much
     EM_log( CK_LOG_FINEST, "target: %s", howmuch2str( how_much ) );
+    // reset elision count | 1.5.5.3
+    emit->num_refs_elided = 0;
+    emit->last_remember = NULL;
 
     // return
     t_CKBOOL ret = TRUE;
@@ -331,6 +336,11 @@ Chuck_VM_Code * emit_engine_emit_prog( Chuck_Emitter * emit, a_Program prog,
 
     // clear stmt_stack (no need to delete contents; only contains instructions that should be cleaned up above)
     emit->stmt_stack.clear();
+    // no longer valid | 1.5.5.3
+    emit->last_remember = NULL;
+
+    // log elided ref/unref pairs | 1.5.5.3
+    EM_log( CK_LOG_FINER, "elided %lu object ref/unref pair(s)", emit->num_refs_elided );
 
     // pop indent
     EM_poplog();
@@ -731,7 +741,7 @@ t_CKBOOL emit_engine_emit_stmt( Chuck_Emitter * emit, a_Stmt stmt, t_CKBOOL pop
     }
 
     // see if need to add closing
-    if( codestr_close != "" && nextIndex < emit->next_index()-1 )
+    if( codestr_close != "" && nextIndex+1 < emit->next_index() )
     {
         // APPPEND closing
         emit->code->code[emit->next_index()-1]->append_codestr( codestr_close );
@@ -763,6 +773,21 @@ t_CKBOOL emit_engine_emit_if( Chuck_Emitter * emit, a_Stmt_If stmt )
 {
     t_CKBOOL ret = TRUE;
     Chuck_Instr_Branch_Op * op = NULL, * op2 = NULL;
+    t_CKBOOL truth = FALSE;
+
+    // condition folded to a constant: emit only the branch taken | 1.5.5.3
+    if( fold_truth( stmt->cond, truth ) )
+    {
+        // push the stack, allowing for new local variables
+        emit->push_scope();
+        // emit the body
+        ret = emit_engine_emit_stmt( emit, truth ? stmt->if_body : stmt->else_body );
+        if( !ret )
+            return FALSE;
+        // pop stack
+        emit->pop_scope();
+        return TRUE;
+    }
 
     // push the stack, allowing for new local variables
     emit->push_scope();
@@ -1233,6 +1258,12 @@ t_CKBOOL emit_engine_emit_while( Chuck_Emitter * emit, a_Stmt_While stmt )
     Chuck_Instr_Branch_Op * op = NULL;
     // codestr prefix for better description | 1.5.0.8
     string codestr_prefix = "/** loop conditional **/";
+    // condition folded to a constant | 1.5.5.3
+    t_CKBOOL truth = FALSE;
+    t_CKBOOL constant = fold_truth( stmt->cond, truth );
+
+    // never entered: nothing to emit
+    if( constant && !truth ) return TRUE;
 
     // push stack
     emit->push_scope();
@@ -1244,53 +1275,57 @@ t_CKBOOL emit_engine_emit_while( Chuck_Emitter * emit, a_Stmt_While stmt )
     // mark the stack of break
     emit->code->stack_break.push_back( NULL );
 
-    // get the code str | 1.5.0.8
-    string codestr = absyn2str( stmt->cond );
-    // get the index
-    t_CKUINT cond_index = emit->next_index();
-
-    // emit the cond
-    ret = emit_engine_emit_exp( emit, stmt->cond, FALSE, stmt->self );
-    if( !ret ) return FALSE;
+    // test the condition, unless folded to one that always holds
+    if( !constant )
+    {
+        // get the code str | 1.5.0.8
+        string codestr = absyn2str( stmt->cond );
+        // get the index
+        t_CKUINT cond_index = emit->next_index();
 
-    // add code str | 1.5.0.8
-    emit->code->code[cond_index]->prepend_codestr( codestr_prefix + " " + codestr );
+        // emit the cond
+        ret = emit_engine_emit_exp( emit, stmt->cond, FALSE, stmt->self );
+        if( !ret ) return FALSE;
 
-    // the condition
-    switch( stmt->cond->type->xid )
-    {
-    case te_int:
-        // push 0
-        emit->append( new Chuck_Instr_Reg_Push_Imm( 0 ) );
-        op = new Chuck_Instr_Branch_Eq_int( 0 );
-        break;
-    case te_float:
-    case te_dur:
-    case te_time:
-        // push 0
-        emit->append( new Chuck_Instr_Reg_Push_Imm2( 0.0 ) );
-        op = new Chuck_Instr_Branch_Eq_double( 0 );
-        break;
+        // add code str | 1.5.0.8
+        emit->code->code[cond_index]->prepend_codestr( codestr_prefix + " " + codestr );
 
-    default:
-        // check for IO
-        if( isa( stmt->cond->type, emit->env->ckt_io ) )
+        // the condition
+        switch( stmt->cond->type->xid )
         {
+        case te_int:
             // push 0
             emit->append( new Chuck_Instr_Reg_Push_Imm( 0 ) );
-            op = new Chuck_Instr_Branch_Eq_int_IO_good( 0 );
+            op = new Chuck_Instr_Branch_Eq_int( 0 );
+            break;
+        case te_float:
+        case te_dur:
+        case te_time:
+            // push 0
+            emit->append( new Chuck_Instr_Reg_Push_Imm2( 0.0 ) );
+            op = new Chuck_Instr_Branch_Eq_double( 0 );
             break;
+
+        default:
+            // check for IO
+            if( isa( stmt->cond->type, emit->env->ckt_io ) )
+            {
+                // push 0
+                emit->append( new Chuck_Instr_Reg_Push_Imm( 0 ) );
+                op = new Chuck_Instr_Branch_Eq_int_IO_good( 0 );
+                break;
+            }
+
+            EM_error2( stmt->cond->where,
+                "(emit): internal error: unhandled type '%s' in while conditional",
+                stmt->cond->type->base_name.c_str() );
+            return FALSE;
         }
 
-        EM_error2( stmt->cond->where,
-            "(emit): internal error: unhandled type '%s' in while conditional",
-            stmt->cond->type->base_name.c_str() );
-        return FALSE;
+        // append the op
+        emit->append( op );
     }
 
-    // append the op
-    emit->append( op );
-
     // added 1.3.1.1: new scope just for loop body
     emit->push_scope();
 
@@ -1306,7 +1341,7 @@ t_CKBOOL emit_engine_emit_while( Chuck_Emitter * emit, a_Stmt_While stmt )
     emit->append( new Chuck_Instr_Goto( start_index ) );
 
     // set the op's target
-    op->set( emit->next_index() );
+    if( op ) op->set( emit->next_index() );
 
     // stack of continue
     while( emit->code->stack_cont.size() && emit->code->stack_cont.back() )
@@ -1453,6 +1488,12 @@ t_CKBOOL emit_engine_emit_until( Chuck_Emitter * emit, a_Stmt_Until stmt )
     Chuck_Instr_Branch_Op * op = NULL;
     // codestr prefix for better description | 1.5.0.8
     string codestr_prefix = "/** loop conditional **/";
+    // condition folded to a constant | 1.5.5.3
+    t_CKBOOL truth = FALSE;
+    t_CKBOOL constant = fold_truth( stmt->cond, truth );
+
+    // never entered: nothing to emit
+    if( constant && truth ) return TRUE;
 
     // push stack
     emit->push_scope();
@@ -1464,53 +1505,57 @@ t_CKBOOL emit_engine_emit_until( Chuck_Emitter * emit, a_Stmt_Until stmt )
     // mark the stack of break
     emit->code->stack_break.push_back( NULL );
 
-    // get the code str | 1.5.0.8
-    string codestr = absyn2str( stmt->cond );
-    // get the index
-    t_CKUINT cond_index = emit->next_index();
-
-    // emit the cond
-    ret = emit_engine_emit_exp( emit, stmt->cond, FALSE, stmt->self );
-    if( !ret ) return FALSE;
+    // test the condition, unless folded to one that always holds
+    if( !constant )
+    {
+        // get the code str | 1.5.0.8
+        string codestr = absyn2str( stmt->cond );
+        // get the index
+        t_CKUINT cond_index = emit->next_index();
 
-    // add code str | 1.5.0.8
-    emit->code->code[cond_index]->prepend_codestr( codestr_prefix + " " + codestr );
+        // emit the cond
+        ret = emit_engine_emit_exp( emit, stmt->cond, FALSE, stmt->self );
+        if( !ret ) return FALSE;
 
-    // condition
-    switch( stmt->cond->type->xid )
-    {
-    case te_int:
-        // push 0
-        emit->append( new Chuck_Instr_Reg_Push_Imm( 0 ) );
-        op = new Chuck_Instr_Branch_Neq_int( 0 );
-        break;
-    case te_float:
-    case te_dur:
-    case te_time:
-        // push 0
-        emit->append( new Chuck_Instr_Reg_Push_Imm2( 0.0 ) );
-        op = new Chuck_Instr_Branch_Neq_double( 0 );
-        break;
+        // add code str | 1.5.0.8
+        emit->code->code[cond_index]->prepend_codestr( codestr_prefix + " " + codestr );
 
-    default:
-        // check for IO
-        if( isa( stmt->cond->type, emit->env->ckt_io ) )
+        // condition
+        switch( stmt->cond->type->xid )
         {
+        case te_int:
             // push 0
             emit->append( new Chuck_Instr_Reg_Push_Imm( 0 ) );
-            op = new Chuck_Instr_Branch_Neq_int_IO_good( 0 );
+            op = new Chuck_Instr_Branch_Neq_int( 0 );
             break;
+        case te_float:
+        case te_dur:
+        case te_time:
+            // push 0
+            emit->append( new Chuck_Instr_Reg_Push_Imm2( 0.0 ) );
+            op = new Chuck_Instr_Branch_Neq_double( 0 );
+            break;
+
+        default:
+            // check for IO
+            if( isa( stmt->cond->type, emit->env->ckt_io ) )
+            {
+                // push 0
+                emit->append( new Chuck_Instr_Reg_Push_Imm( 0 ) );
+                op = new Chuck_Instr_Branch_Neq_int_IO_good( 0 );
+                break;
+            }
+
+            EM_error2( stmt->cond->where,
+                "(emit): internal error: unhandled type '%s' in until conditional",
+                stmt->cond->type->base_name.c_str() );
+            return FALSE;
         }
 
-        EM_error2( stmt->cond->where,
-            "(emit): internal error: unhandled type '%s' in until conditional",
-            stmt->cond->type->base_name.c_str() );
-        return FALSE;
+        // append the op
+        emit->append( op );
     }
 
-    // append the op
-    emit->append( op );
-
     // added 1.3.1.1: new scope just for loop body
     emit->push_scope();
 
@@ -1524,7 +1569,7 @@ t_CKBOOL emit_engine_emit_until( Chuck_Emitter * emit, a_Stmt_Until stmt )
     emit->append( new Chuck_Instr_Goto( start_index ) );
 
     // set the op's target
-    op->set( emit->next_index() );
+    if( op ) op->set( emit->next_index() );
 
     // stack of continue
     while( emit->code->stack_cont.size() && emit->code->stack_cont.back() )
@@ -1824,7 +1869,7 @@ t_CKBOOL emit_engine_emit_return( Chuck_Emitter * emit, a_Stmt_Return stmt )
     if( stmt->val && isobj( emit->env, stmt->val->type ) )
     {
         // add reference (to be released by the function caller)
-        emit->append( new Chuck_Instr_Reg_AddRef_Object3 );
+        emit_engine_emit_addref_on_stack( emit, stmt->val );
     }
 
     // clean up any dangling object refs | 1.5.1.7
@@ -1902,6 +1947,45 @@ void emit_engine_track_stmt_refs_cleanup( Chuck_Emitter * emit, Chuck_Instr_Stmt
 
 
 
+//-----------------------------------------------------------------------------
+// name: emit_engine_emit_addref_on_stack() | 1.5.5.3 added
+// desc: add a reference to the object on top of the reg stack, e.g., for an
+//       argument or a return value; if 'exp' is a func call or `new` whose
+//       result was just remembered for release at the end of the enclosing
+//       stmt, hand that reference over instead of emitting an add_ref now
+//       and a release later
+//-----------------------------------------------------------------------------
+void emit_engine_emit_addref_on_stack( Chuck_Emitter * emit, a_Exp exp )
+{
+    // only for expressions that end in a remember (no branches into here)
+    t_CKBOOL handsOff = exp->next == NULL && exp->cast_to == NULL &&
+        ( exp->s_type == ae_exp_func_call ||
+          ( exp->s_type == ae_exp_unary && exp->unary.op == ae_op_new ) );
+
+    // was the last instruction the remember for this expression?
+    if( handsOff && emit->last_remember && emit->next_index() &&
+        emit->code->code.back() == emit->last_remember )
+    {
+        // take it off
+        Chuck_Instr_Stmt_Remember_Object * remember = emit->last_remember;
+        emit->pop_back(); emit->last_remember = NULL;
+        // func calls return with a reference already added: take it as-is;
+        // `new` needs the add_ref the remember would have done
+        if( remember->addRef() ) emit->append( new Chuck_Instr_Reg_AddRef_Object3 );
+        // clean up
+        CK_SAFE_DELETE( remember );
+        // count
+        emit->num_refs_elided++;
+        return;
+    }
+
+    // add ref in place on the stack
+    emit->append( new Chuck_Instr_Reg_AddRef_Object3 );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: emit_engine_emit_exp()
 // desc: emit code for an expression
@@ -1981,7 +2065,7 @@ t_CKBOOL emit_engine_emit_exp( Chuck_Emitter * emit, a_Exp exp, t_CKBOOL doAddRe
                     // acquire next offset
                     if( !onStack->nextOffset( offset ) ) return FALSE;
                     // append instruction
-                    emit->append( new Chuck_Instr_Stmt_Remember_Object( onStack, offset ) );
+                    emit->append( emit->last_remember = new Chuck_Instr_Stmt_Remember_Object( onStack, offset ) );
                 }
             }
             break;
@@ -2022,8 +2106,8 @@ t_CKBOOL emit_engine_emit_exp( Chuck_Emitter * emit, a_Exp exp, t_CKBOOL doAddRe
         // (NOTE: cast shouldn't matter since pointer width should remain constant)
         if( doAddRef && isobj( emit->env, exp->type ) )
         {
-            // add ref in place on the stack
-            emit->append( new Chuck_Instr_Reg_AddRef_Object3() );
+            // add ref in place on the stack (or take over a stmt-level ref)
+            emit_engine_emit_addref_on_stack( emit, exp );
         }
 
         // next exp
@@ -2145,6 +2229,12 @@ t_CKBOOL emit_engine_emit_exp_binary( Chuck_Emitter * emit, a_Exp_Binary binary
         // treat as arguments
         doRefRight = TRUE;
     }
+    // appending to a string temporary: the lhs is kept alive by its
+    // stmt remember, the rhs is used right after it is evaluated | 1.5.5.3
+    if( binary->concat_in_place )
+    {
+        doRefLeft = doRefRight = FALSE;
+    }
 
     // emit (doRef added 1.3.0.2)
     left = emit_engine_emit_exp( emit, binary->lhs, doRefLeft );
@@ -2183,6 +2273,14 @@ t_CKBOOL emit_engine_emit_op( Chuck_Emitter * emit, ae_Operator op, a_Exp lhs, a
     // whether an operator should be using an explicit overloading
     if( binary->ck_overload_func )
     {
+        // string + ..., appending to a temporary (see chuck_escape.h) | 1.5.5.3
+        if( binary->concat_in_place )
+        {
+            te_Type kind = isa( t_right, emit->env->ckt_string ) ? te_string : right;
+            emit->append( instr = new Chuck_Instr_Add_string_Temp( kind ) );
+            instr->set_linepos( lhs->line );
+            return TRUE;
+        }
         // emit operator overload | 1.5.1.5 (ge) added
         return emit_engine_emit_op_overload_binary( emit, binary );
     }
@@ -3143,7 +3241,7 @@ t_CKBOOL emit_engine_emit_stmt_remember_object( Chuck_Emitter * emit, Chuck_Type
         // acquire next offset
         if( !onStack->nextOffset( offset ) ) return FALSE;
         // append instruction
-        emit->append( new Chuck_Instr_Stmt_Remember_Object( onStack, offset ) );
+        emit->append( emit->last_remember = new Chuck_Instr_Stmt_Remember_Object( onStack, offset ) );
     }
 
     return TRUE;
@@ -3160,7 +3258,7 @@ t_CKBOOL emit_engine_emit_op_overload_binary( Chuck_Emitter * emit, a_Exp_Binary
 {
     // TODO: transforms local stack into args; add refs, variable mem to reg, etc.
     // push function pointer
-    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)binary->ck_overload_func ) );
+    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)binary->ck_overload_func, te_immFunc ) );
     // emit the function call
     if( !emit_engine_emit_exp_func_call( emit, binary->ck_overload_func, binary->self->type, binary->line, binary->where ) )
         return FALSE;
@@ -3185,7 +3283,7 @@ t_CKBOOL emit_engine_emit_op_overload_unary( Chuck_Emitter * emit, a_Exp_Unary u
 {
     // TODO: transforms local stack into args; add refs, variable mem to reg, etc.
     // push function pointer
-    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)unary->ck_overload_func ) );
+    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)unary->ck_overload_func, te_immFunc ) );
     // emit the function call
     if( !emit_engine_emit_exp_func_call( emit, unary->ck_overload_func, unary->self->type, unary->line, unary->where ) )
         return FALSE;
@@ -3210,7 +3308,7 @@ t_CKBOOL emit_engine_emit_op_overload_postfix( Chuck_Emitter * emit, a_Exp_Postf
 {
     // TODO: transforms local stack into args; add refs, variable mem to reg, etc.
     // push function pointer
-    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)postfix->ck_overload_func ) );
+    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)postfix->ck_overload_func, te_immFunc ) );
     // emit the function call
     if( !emit_engine_emit_exp_func_call( emit, postfix->ck_overload_func, postfix->self->type, postfix->line, postfix->where ) )
         return FALSE;
@@ -3710,7 +3808,7 @@ t_CKBOOL emit_engine_emit_exp_unary( Chuck_Emitter * emit, a_Exp_Unary unary )
             // acquire next offset
             if( !onStack->nextOffset( offset ) ) return FALSE;
             // append instruction, addRef=TRUE
-            emit->append( new Chuck_Instr_Stmt_Remember_Object( onStack, offset, TRUE ) );
+            emit->append( emit->last_remember = new Chuck_Instr_Stmt_Remember_Object( onStack, offset, TRUE ) );
         }
         break;
 
@@ -3851,7 +3949,7 @@ t_CKBOOL emit_engine_emit_exp_primary( Chuck_Emitter * emit, a_Exp_Primary exp )
         }
         str->set( exp->str );
         temp = (t_CKUINT)str;
-        emit->append( new Chuck_Instr_Reg_Push_Imm( temp ) );
+        emit->append( new Chuck_Instr_Reg_Push_Imm( temp, te_immString ) );
         // add reference for string literal (added 1.3.0.2)
         str->add_ref();
         break;
@@ -4369,6 +4467,8 @@ t_CKBOOL emit_engine_emit_exp_func_call( Chuck_Emitter * emit,
     // need to know here so the func can properly emit
     // 1.5.4.3 (ge) added as part of #2024-func-call-update
     func_call->func->emit_as_funccall = TRUE;
+    // only a lookup emitted by func_call->func may take over Func_To_Code
+    emit->last_member_call = NULL;
 
     // emit func
     if( !emit_engine_emit_exp( emit, func_call->func ) )
@@ -4387,7 +4487,7 @@ t_CKBOOL emit_engine_emit_exp_func_call( Chuck_Emitter * emit,
         // NOTE should have already checked that we are within a class if `this` was used
         assert( emit->env->class_def != NULL );
         // emit the contructor func | (don't need to dup last since we are not resolving from a dot_member
-        emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)exp_func->primary.func_alias ) );
+        emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)exp_func->primary.func_alias, te_immFunc ) );
     }
 
     // line and pos
@@ -4471,8 +4571,14 @@ t_CKBOOL emit_engine_emit_exp_func_call( Chuck_Emitter * emit,
         }
     }
 
-    // translate to code
-    emit->append( new Chuck_Instr_Func_To_Code );
+    // translate to code; if the function was just looked up by a
+    // Dot_Member_Func_Call, have that push the code directly | 1.5.5.3
+    if( emit->last_member_call && emit->code->code.size() &&
+        emit->code->code.back() == emit->last_member_call )
+        emit->last_member_call->push_code();
+    else
+        emit->append( new Chuck_Instr_Func_To_Code );
+    emit->last_member_call = NULL;
     // emit->append( new Chuck_Instr_Reg_Push_Code( func->code ) );
     // push the local stack depth - local variables
     emit->append( new Chuck_Instr_Reg_Push_Imm( emit->code->frame->curr_offset ) );
@@ -4837,23 +4943,30 @@ t_CKBOOL emit_engine_emit_exp_dot_member( Chuck_Emitter * emit,
             {
                 // emit the base
                 if( !emit_engine_emit_exp( emit, member->base ) ) { return FALSE; }
+                // find the offset for virtual table
+                offset = func->vt_index;
                 // check if we are part of a function call vs. function as value
                 // 1.5.4.3 (ge) added as part of #2024-func-call-update
                 if( member->self->emit_as_funccall )
                 {
-                    // dup the base pointer ('this' pointer as argument)
-                    emit->append( new Chuck_Instr_Reg_Dup_Last );
+                    // look up for a call, keeping the base pointer as 'this'
+                    // | 1.5.5.3 (was Reg_Dup_Last + Dot_Member_Func)
+                    Chuck_Instr_Dot_Member_Func_Call * call = new Chuck_Instr_Dot_Member_Func_Call( offset );
+                    emit->append( instr = call );
+                    // the call itself may fold its Func_To_Code into this
+                    emit->last_member_call = call;
+                }
+                else
+                {
+                    // emit the function
+                    emit->append( instr = new Chuck_Instr_Dot_Member_Func( offset ) );
                 }
-                // find the offset for virtual table
-                offset = func->vt_index;
-                // emit the function
-                emit->append( instr = new Chuck_Instr_Dot_Member_Func( offset ) );
                 instr->set_linepos( member->line );
             }
             else
             {
                 // emit the type
-                emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)t_base ) );
+                emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)t_base, te_immType ) );
                 // check if we are part of a function call vs. function as value
                 // 1.5.4.3 (ge) added as part of #2024-func-call-update
                 if( member->self->emit_as_funccall )
@@ -4898,7 +5011,7 @@ t_CKBOOL emit_engine_emit_exp_dot_member( Chuck_Emitter * emit,
                 else
                 {
                     // emit the type
-                    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)t_base ) );
+                    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)t_base, te_immType ) );
                     // emit the static value (1.3.1.0: changed to use getkindof in addition to size)
                     emit->append( new Chuck_Instr_Dot_Static_Data(
                         offset, member->self->type->size, getkindof(emit->env, member->self->type), emit_addr ) );
@@ -4917,7 +5030,7 @@ t_CKBOOL emit_engine_emit_exp_dot_member( Chuck_Emitter * emit,
         if( isfunc( emit->env, member->self->type ) )
         {
             // emit the type - spencer
-            emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)t_base ) );
+            emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)t_base, te_immType ) );
             // if part of a func call
             // 1.5.4.3 (ge) added as part of #2024-func-call-update
             if( member->self->emit_as_funccall )
@@ -4952,7 +5065,7 @@ t_CKBOOL emit_engine_emit_exp_dot_member( Chuck_Emitter * emit,
             else
             {
                 // emit the type - spencer
-                emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)t_base ) );
+                emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)t_base, te_immType ) );
                 // find the offset for data
                 offset = value->offset;
                 // emit the member (1.3.1.0: changed to use getkindof in addition to size)
@@ -4976,10 +5089,19 @@ t_CKBOOL emit_engine_emit_exp_if( Chuck_Emitter * emit, a_Exp_If exp_if )
 {
     t_CKBOOL ret = TRUE;
     Chuck_Instr_Branch_Op * op = NULL, * op2 = NULL;
+    t_CKBOOL truth = FALSE;
 
     // push the stack, allowing for new local variables
     emit->push_scope();
 
+    // condition folded to a constant: emit only the arm taken | 1.5.5.3
+    if( fold_truth( exp_if->cond, truth ) )
+    {
+        ret = emit_engine_emit_exp( emit, truth ? exp_if->if_exp : exp_if->else_exp );
+        emit->pop_scope();
+        return ret;
+    }
+
     // emit the condition
     ret = emit_engine_emit_exp( emit, exp_if->cond );
     if( !ret )
@@ -5150,10 +5272,12 @@ t_CKBOOL emit_engine_pre_constructor_array( Chuck_Emitter * emit, Chuck_Type * t
 //-----------------------------------------------------------------------------
 // name: emit_engine_instantiate_object()
 // desc: emit instructions for instantiating object
+//       1.5.5.3 | added scratch -- for a non-escaping local, instantiate
+//        from shred scratch storage (see chuck_escape.h)
 //-----------------------------------------------------------------------------
 t_CKBOOL emit_engine_instantiate_object( Chuck_Emitter * emit, Chuck_Type * type,
                                          a_Ctor_Call ctor_info, a_Array_Sub array, t_CKBOOL is_ref,
-                                         t_CKBOOL is_array_ref )
+                                         t_CKBOOL is_array_ref, t_CKBOOL scratch )
 {
     // if array
     if( type->array_depth )
@@ -5183,7 +5307,8 @@ t_CKBOOL emit_engine_instantiate_object( Chuck_Emitter * emit, Chuck_Type * type
     else if( !is_ref ) // not array
     {
         // emit object instantiation code, include pre constructor
-        emit->append( new Chuck_Instr_Instantiate_Object_Start( type ) );
+        if( scratch ) emit->append( new Chuck_Instr_Instantiate_Object_Scratch( type ) );
+        else emit->append( new Chuck_Instr_Instantiate_Object_Start( type ) );
 
         // call pre constructor
         emit_engine_pre_constructor( emit, type, ctor_info );
@@ -5382,7 +5507,8 @@ t_CKBOOL emit_engine_emit_exp_decl( Chuck_Emitter * emit, a_Exp_Decl decl,
                     // set
                     is_init = TRUE;
                     // instantiate object (not array)
-                    if( !emit_engine_instantiate_object( emit, type, &var_decl->ctor, var_decl->array, is_ref, FALSE ) )
+                    if( !emit_engine_instantiate_object( emit, type, &var_decl->ctor, var_decl->array, is_ref, FALSE,
+                                                         var_decl->scratch ) )
                         return FALSE;
                 }
             }
@@ -5555,7 +5681,7 @@ t_CKBOOL emit_engine_emit_exp_decl( Chuck_Emitter * emit, a_Exp_Decl decl,
             else // static
             {
                 // emit the type
-                emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)emit->env->class_def ) );
+                emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)emit->env->class_def, te_immType ) );
                 // emit the static value (1.3.1.0: changed to use getkindof in addition to size)
                 emit->append( new Chuck_Instr_Dot_Static_Data(
                     value->offset, value->type->size, getkindof(emit->env, value->type), TRUE ) );
@@ -6101,6 +6227,8 @@ t_CKBOOL emit_engine_emit_spork( Chuck_Emitter * emit, a_Exp_Func_Call exp )
         //            "(emit): internal error in evaluating function call..." );
         return FALSE;
     }
+    // the sporker needs the function itself, not its code | 1.5.5.3
+    emit->last_member_call = NULL;
 
     // push the current code
     emit->code_stack.push_back( emit->code );
@@ -6174,7 +6302,7 @@ t_CKBOOL emit_engine_emit_spork( Chuck_Emitter * emit, a_Exp_Func_Call exp )
     //     size += sz_INT; // (changed 1.3.1.0: 4 to sz_INT)
 
     // emit instruction that will put the code on the stack
-    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)code ) );
+    emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)code, te_immCode ) );
     // emit spork instruction - this will copy, func, args, this
     emit->append( new Chuck_Instr_Spork( size ) );
 
@@ -6329,10 +6457,10 @@ t_CKBOOL emit_engine_emit_symbol( Chuck_Emitter * emit, S_Symbol symbol,
             if( v->func_ref->is_static )
             {
                 // push the type pointer
-                emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)v->owner_class ) );
+                emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)v->owner_class, te_immType ) );
             }
             // push function pointer
-            emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)v->func_ref ) );
+            emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)v->func_ref, te_immFunc ) );
         }
         else if( v->is_global )
         {
@@ -6347,7 +6475,7 @@ t_CKBOOL emit_engine_emit_symbol( Chuck_Emitter * emit, S_Symbol symbol,
             // look up the type by name in the value's owner namespace, climb==0, stayWithinClassDef==TRUE
             Chuck_Type * type = v->owner->lookup_type( v->name, 0, TRUE );
             // append the value pointer directly | 1.5.4.4 (ge) added
-            emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)type ) );
+            emit->append( new Chuck_Instr_Reg_Push_Imm( (t_CKUINT)type, te_immType ) );
         }
         // check size
         // (added 1.3.1.0: iskindofint -- since in some 64-bit systems, sz_INT == sz_FLOAT)
@@ -6377,6 +6505,24 @@ t_CKBOOL emit_engine_emit_symbol( Chuck_Emitter * emit, S_Symbol symbol,
 
 
 
+//-----------------------------------------------------------------------------
+// name: append()
+// desc: append instruction to the current code
+//       1.5.5.3: instructions without a line position get the line of the
+//       statement being emitted (for profiling and runtime error messages)
+//-----------------------------------------------------------------------------
+void Chuck_Emitter::append( Chuck_Instr * instr )
+{
+    assert( code != NULL );
+    code->code.push_back( instr );
+    // default line position
+    if( !instr->m_linepos && env && env->stmt_stack.size() )
+        instr->set_linepos( env->stmt_stack.back()->line );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: addref_on_scope()
 // desc: add references to locals on current scope (added 1.3.0.0)
@@ -44,6 +44,8 @@
 struct Chuck_Instr;
 struct Chuck_Instr_Goto;
 struct Chuck_Instr_Stmt_Start;
+struct Chuck_Instr_Stmt_Remember_Object;
+struct Chuck_Instr_Dot_Member_Func_Call;
 struct Chuck_VM_Code;
 struct Chuck_VM_Shred;
 
@@ -127,6 +129,12 @@ struct Chuck_Emitter : public Chuck_VM_Object
     std::vector<Chuck_Code *> code_stack;
     // stmt stack
     std::vector<Chuck_Instr_Stmt_Start *> stmt_stack;
+    // most recently appended stmt-level remember (for ref/unref elision) | 1.5.5.3
+    Chuck_Instr_Stmt_Remember_Object * last_remember;
+    // number of ref/unref pairs elided this emission | 1.5.5.3
+    t_CKUINT num_refs_elided;
+    // most recently appended member function lookup for a call | 1.5.5.3
+    Chuck_Instr_Dot_Member_Func_Call * last_member_call;
 
     // dump
     t_CKBOOL dump;
@@ -136,17 +144,22 @@ public:
     Chuck_Emitter()
     { env = NULL; code = NULL; context = NULL;
       nspc = NULL; func = NULL; dump = FALSE;
-      should_replace_dac = FALSE; }
+      should_replace_dac = FALSE;
+      last_remember = NULL; num_refs_elided = 0;
+      last_member_call = NULL; }
 
     // destructor
     ~Chuck_Emitter() { }
 
     // append instruction
-    void append( Chuck_Instr * instr )
-    { assert( code != NULL ); code->code.push_back( instr ); }
+    void append( Chuck_Instr * instr );
     // next instruction index
     t_CKUINT next_index()
     { assert( code != NULL ); return code->code.size(); }
+    // remove and return the last instruction (NULL if none) | 1.5.5.3
+    Chuck_Instr * pop_back()
+    { assert( code != NULL ); if( code->code.empty() ) return NULL;
+      Chuck_Instr * instr = code->code.back(); code->code.pop_back(); return instr; }
 
     // push scope
     void push_scope( )
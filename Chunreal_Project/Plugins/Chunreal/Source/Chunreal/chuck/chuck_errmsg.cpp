@@ -48,17 +48,18 @@
 #include <string.h>
 #include <sstream>
 #include <iostream>
+#include <mutex>
 using namespace std;
 
 
-// global
-t_CKINT EM_tokPos = 0;
-t_CKINT EM_lineNum = 1;
+// global (per-thread, so that independent compiles can run in parallel) | 1.5.5.3
+CK_THREAD_LOCAL t_CKINT EM_tokPos = 0;
+CK_THREAD_LOCAL t_CKINT EM_lineNum = 1;
 
 // current per-file error message context | 1.5.4.0 (ge)
-static Chuck_CompileTarget * the_compileTarget = NULL;
+static CK_THREAD_LOCAL Chuck_CompileTarget * the_compileTarget = NULL;
 // current filename
-static const char * the_filename = "";
+static CK_THREAD_LOCAL const char * the_filename = "";
 
 // file source info (for better error reporting) | 1.5.0.5 (ge)
 // static CompileFileSource g_currentFile;
@@ -67,20 +68,22 @@ static t_CKBOOL g_highlight_on_error = TRUE;
 
 // a local global string buffer for snprintf
 #define CK_ERR_BUF_LENGTH 2048
-static char g_buffer[CK_ERR_BUF_LENGTH] = "";
+static CK_THREAD_LOCAL char g_buffer[CK_ERR_BUF_LENGTH] = "";
 // last error
-static std::string g_lasterror = "";
+static thread_local std::string g_lasterror = "";
 // for code snippet output | 1.5.2.0
-static std::string g_codestr = "";
+static thread_local std::string g_codestr = "";
 // for output error to str | 1.5.2.0
-static std::string g_error2str = "";
+static thread_local std::string g_error2str = "";
 
 // log globals
 t_CKINT g_loglevel = CK_LOG_CORE;
-t_CKINT g_logstack = 0;
+CK_THREAD_LOCAL t_CKINT g_logstack = 0;
 #ifndef __DISABLE_THREADS__
 XMutex g_logmutex;
 #endif
+// serializes the shared stdout/stderr streams below | 1.5.5.3
+static std::recursive_mutex g_outmutex;
 
 // more local globals
 std::stringstream g_stdout_stream;
@@ -88,7 +91,7 @@ std::stringstream g_stderr_stream;
 // 1.5.0.5 (ge) increase g_buffer2_size from 1024 to 8192
 // to accomodate longer, potentially multiline output strings
 static const size_t g_buffer2_size = 8192;
-static char g_buffer2[g_buffer2_size] = "";
+static CK_THREAD_LOCAL char g_buffer2[g_buffer2_size] = "";
 
 // local global callbacks
 void (*g_stdout_callback)(const char *) = NULL;
@@ -879,6 +882,8 @@ void EM_log( t_CKINT level, const char * message, ... )
     #ifndef __DISABLE_THREADS__
     g_logmutex.acquire();
     #endif
+    // keep prefix, message, and newline together
+    std::lock_guard<std::recursive_mutex> lock( g_outmutex );
 
     TC::off();
     CK_FPRINTF_STDERR( "[%s:%s:%s]: ",
@@ -930,6 +935,8 @@ void EM_log_opts( t_CKINT level, enum em_LogOpts options, const char * message,
     #ifndef __DISABLE_THREADS__
     g_logmutex.acquire();
     #endif
+    // keep prefix, message, and newline together
+    std::lock_guard<std::recursive_mutex> lock( g_outmutex );
 
     // check option
     if( prefix )
@@ -1217,6 +1224,8 @@ std::string CompileFileSource::getLine( t_CKUINT n )
 //-----------------------------------------------------------------------------
 void ck_fprintf_stdout( const char * format, ... )
 {
+    std::lock_guard<std::recursive_mutex> lock( g_outmutex );
+
     // evaluate the format string
     va_list args;
     va_start( args, format );
@@ -1244,6 +1253,8 @@ void ck_fprintf_stdout( const char * format, ... )
 //-----------------------------------------------------------------------------
 void ck_fprintf_stderr( const char * format, ... )
 {
+    std::lock_guard<std::recursive_mutex> lock( g_outmutex );
+
     // evaluate the format string
     va_list args;
     va_start( args, format );
@@ -1271,6 +1282,8 @@ void ck_fprintf_stderr( const char * format, ... )
 //-----------------------------------------------------------------------------
 void ck_fflush_stdout()
 {
+    std::lock_guard<std::recursive_mutex> lock( g_outmutex );
+
     // no callback? just flush it
     if( g_stdout_callback == NULL )
     {
@@ -1304,6 +1317,8 @@ void ck_fflush_stdout()
 //-----------------------------------------------------------------------------
 void ck_fflush_stderr()
 {
+    std::lock_guard<std::recursive_mutex> lock( g_outmutex );
+
     // no callback? just flush it
     if( g_stderr_callback == NULL )
     {
@@ -1337,6 +1352,8 @@ void ck_fflush_stderr()
 //-----------------------------------------------------------------------------
 void ck_vfprintf_stdout( const char * format, va_list args )
 {
+    std::lock_guard<std::recursive_mutex> lock( g_outmutex );
+
     // evaluate the format string
     vsnprintf( g_buffer2, g_buffer2_size, format, args );
 
@@ -1355,6 +1372,8 @@ void ck_vfprintf_stdout( const char * format, va_list args )
 //-----------------------------------------------------------------------------
 void ck_vfprintf_stderr( const char * format, va_list args )
 {
+    std::lock_guard<std::recursive_mutex> lock( g_outmutex );
+
     // evaluate the format string
     vsnprintf( g_buffer2, g_buffer2_size, format, args );
 
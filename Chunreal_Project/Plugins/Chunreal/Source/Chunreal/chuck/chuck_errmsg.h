@@ -135,8 +135,8 @@ const char * mini_type( const char * str );
 // things connected with lexer and parser
 //-----------------------------------------------------------------------------
 // variables
-extern t_CKINT EM_tokPos;
-extern t_CKINT EM_lineNum;
+extern CK_THREAD_LOCAL t_CKINT EM_tokPos;
+extern CK_THREAD_LOCAL t_CKINT EM_lineNum;
 
 // advance state when new line is encountered
 void EM_newline( t_CKINT pos, t_CKINT line );
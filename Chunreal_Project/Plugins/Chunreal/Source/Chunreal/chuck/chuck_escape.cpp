@@ -0,0 +1,417 @@
+/*----------------------------------------------------------------------------
+  ChucK Strongly-timed Audio Programming Language
+    Compiler, Virtual Machine, and Synthesis Engine
+
+  Copyright (c) 2003 Ge Wang and Perry R. Cook. All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the dual-license terms of EITHER the MIT License OR the GNU
+  General Public License (the latter as published by the Free Software
+  Foundation; either version 2 of the License or, at your option, any
+  later version).
+
+  This program is distributed in the hope that it will be useful and/or
+  interesting, but WITHOUT ANY WARRANTY; without even the implied warranty
+  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  MIT Licence and/or the GNU General Public License for details.
+
+  You should have received a copy of the MIT License and the GNU General
+  Public License (GPL) along with this program; a copy of the GPL can also
+  be obtained by writing to the Free Software Foundation, Inc., 59 Temple
+  Place, Suite 330, Boston, MA 02111-1307 U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_escape.cpp
+// desc: escape analysis over the type-checked AST
+//
+//       a local object escapes if its variable appears anywhere other than
+//       as the base of a dot member: as an argument, an operand, a return
+//       value, on either side of @=>, printed, and so on. a declaration
+//       that is itself used as a value (e.g., `V v @=> w`) escapes too.
+//
+// date: Autumn 2026 | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#include "chuck_escape.h"
+#include "chuck_lang.h"
+#include "chuck_vm.h"
+#include "chuck_errmsg.h"
+#include <map>
+#include <set>
+using namespace std;
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Escape
+// desc: state for one pass over a program
+//-----------------------------------------------------------------------------
+struct Chuck_Escape
+{
+    // the type environment
+    Chuck_Env * env;
+    // classes defined in this program
+    set<Chuck_Type *> classes;
+    // candidate scratch locals, by value
+    map<Chuck_Value *, a_Var_Decl> candidates;
+    // candidates seen to escape
+    set<Chuck_Value *> escaped;
+    // inside a function body
+    t_CKBOOL in_func;
+    // loop nesting depth
+    t_CKUINT loops;
+    // string concatenations done in place
+    t_CKUINT concats;
+
+    Chuck_Escape( Chuck_Env * e )
+        : env(e), in_func(FALSE), loops(0), concats(0) { }
+
+    void collect( a_Section section );
+    void section( a_Section section, te_HowMuch how_much );
+    void stmt_list( a_Stmt_List list );
+    void stmt( a_Stmt stmt );
+    void exp( a_Exp exp );
+    void exp_one( a_Exp e );
+    // a declaration; `used` if its value is used by an enclosing expression
+    void decl( a_Exp e, t_CKBOOL used );
+    // whether objects of type `t` can be reset and reused
+    t_CKBOOL plain( Chuck_Type * t );
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: is_concat()
+// desc: is `e` a builtin string `+`, which always returns a fresh string?
+//-----------------------------------------------------------------------------
+static t_CKBOOL is_concat( a_Exp e )
+{
+    if( e->s_type != ae_exp_binary || e->binary.op != ae_op_plus ) return FALSE;
+    Chuck_Func * func = e->binary.ck_overload_func;
+    if( !func || !func->code ) return FALSE;
+
+    t_CKUINT f = func->code->native_func;
+    return f == (t_CKUINT)string_op_string_plus_string ||
+           f == (t_CKUINT)string_op_string_plus_int ||
+           f == (t_CKUINT)string_op_string_plus_float ||
+           f == (t_CKUINT)string_op_int_plus_string ||
+           f == (t_CKUINT)string_op_float_plus_string;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: type_engine_escape_prog()
+// desc: mark non-escaping string temporaries and local objects
+//-----------------------------------------------------------------------------
+t_CKBOOL type_engine_escape_prog( Chuck_Env * env, a_Program prog, te_HowMuch how_much )
+{
+    Chuck_Escape escape( env );
+    t_CKUINT scratch = 0;
+
+    // classes first, so uses can come before definitions
+    for( a_Program p = prog; p; p = p->next )
+        escape.collect( p->section );
+    // then everything else
+    for( a_Program p = prog; p; p = p->next )
+        escape.section( p->section, how_much );
+
+    // what's left didn't escape
+    map<Chuck_Value *, a_Var_Decl>::iterator it;
+    for( it = escape.candidates.begin(); it != escape.candidates.end(); it++ )
+    {
+        if( escape.escaped.count( it->first ) ) continue;
+        it->second->scratch = TRUE;
+        scratch++;
+    }
+
+    // report
+    if( scratch || escape.concats )
+    {
+        EM_log( CK_LOG_INFO, "escape analysis: %lu local object(s) in scratch storage, %lu string concatenation(s) in place in '%s'",
+                scratch, escape.concats, env->context ? env->context->filename.c_str() : "" );
+    }
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: collect()
+// desc: note the classes defined in a section (and nested classes)
+//-----------------------------------------------------------------------------
+void Chuck_Escape::collect( a_Section section )
+{
+    if( section->s_type != ae_section_class || !section->class_def->type ) return;
+
+    classes.insert( section->class_def->type );
+    for( a_Class_Body body = section->class_def->body; body; body = body->next )
+        collect( body->section );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: plain()
+// desc: objects of type `t` can be reset by zeroing their data and running
+//       the constructors again: every class up to Object is defined in this
+//       program, has no Object (including array) members, and no destructor
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Escape::plain( Chuck_Type * t )
+{
+    // not arrays
+    if( !t || t->array_depth ) return FALSE;
+
+    for( ; t && t != env->ckt_object; t = t->parent_type )
+    {
+        if( !classes.count( t ) ) return FALSE;
+        if( t->obj_mvars_offsets.size() || t->has_pre_dtor || t->dtor_the ||
+            t->ugen_info || t->allocator ) return FALSE;
+    }
+
+    return t == env->ckt_object;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: section()
+// desc: analyze a program or class body section
+//-----------------------------------------------------------------------------
+void Chuck_Escape::section( a_Section section, te_HowMuch how_much )
+{
+    switch( section->s_type )
+    {
+    case ae_section_stmt:
+        // statements are not part of an import
+        if( how_much == te_do_import_only ) break;
+        stmt_list( section->stmt_list );
+        break;
+
+    case ae_section_func:
+        if( !howMuch_criteria_match( how_much, section->func_def ) ) break;
+        in_func = TRUE;
+        stmt( section->func_def->code );
+        in_func = FALSE;
+        break;
+
+    case ae_section_class:
+        if( !howMuch_criteria_match( how_much, section->class_def ) ) break;
+        // everything in a class goes with it
+        for( a_Class_Body body = section->class_def->body; body; body = body->next )
+            this->section( body->section, te_do_all );
+        break;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: stmt_list()
+// desc: ...
+//-----------------------------------------------------------------------------
+void Chuck_Escape::stmt_list( a_Stmt_List list )
+{
+    for( ; list; list = list->next )
+        stmt( list->stmt );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: stmt()
+// desc: analyze a statement
+//-----------------------------------------------------------------------------
+void Chuck_Escape::stmt( a_Stmt stmt )
+{
+    if( !stmt ) return;
+
+    switch( stmt->s_type )
+    {
+    case ae_stmt_exp:
+        // a declaration on its own is not a use
+        for( a_Exp e = stmt->stmt_exp; e; e = e->next )
+        {
+            if( e->s_type == ae_exp_decl ) decl( e, FALSE );
+            else exp_one( e );
+        }
+        break;
+
+    case ae_stmt_if:
+        exp( stmt->stmt_if.cond );
+        this->stmt( stmt->stmt_if.if_body );
+        this->stmt( stmt->stmt_if.else_body );
+        break;
+
+    case ae_stmt_while:
+        exp( stmt->stmt_while.cond );
+        loops++; this->stmt( stmt->stmt_while.body ); loops--;
+        break;
+
+    case ae_stmt_until:
+        exp( stmt->stmt_until.cond );
+        loops++; this->stmt( stmt->stmt_until.body ); loops--;
+        break;
+
+    case ae_stmt_for:
+        this->stmt( stmt->stmt_for.c1 );
+        this->stmt( stmt->stmt_for.c2 );
+        exp( stmt->stmt_for.c3 );
+        loops++; this->stmt( stmt->stmt_for.body ); loops--;
+        break;
+
+    case ae_stmt_foreach:
+        exp( stmt->stmt_foreach.theIter );
+        exp( stmt->stmt_foreach.theArray );
+        loops++; this->stmt( stmt->stmt_foreach.body ); loops--;
+        break;
+
+    case ae_stmt_loop:
+        exp( stmt->stmt_loop.cond );
+        loops++; this->stmt( stmt->stmt_loop.body ); loops--;
+        break;
+
+    case ae_stmt_code:
+        stmt_list( stmt->stmt_code.stmt_list );
+        break;
+
+    case ae_stmt_switch:
+        exp( stmt->stmt_switch.val );
+        break;
+
+    case ae_stmt_return:
+        exp( stmt->stmt_return.val );
+        break;
+
+    case ae_stmt_case:
+        exp( stmt->stmt_case.exp );
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: decl()
+// desc: a declaration is a candidate if it instantiates a plain object in
+//       a function or loop body, and is not itself used as a value
+//-----------------------------------------------------------------------------
+void Chuck_Escape::decl( a_Exp e, t_CKBOOL used )
+{
+    for( a_Var_Decl_List list = e->decl.var_decl_list; list; list = list->next )
+    {
+        a_Var_Decl var = list->var_decl;
+        // array sizes and constructor arguments
+        if( var->array ) exp( var->array->exp_list );
+        exp( var->ctor.args );
+
+        // instantiated here, and more than once?
+        if( used || !( in_func || loops ) ) continue;
+        if( e->decl.is_static || e->decl.is_global || e->decl.type->ref ) continue;
+        if( var->ref || var->force_ref || var->array || !var->value ) continue;
+        if( !plain( var->value->type ) ) continue;
+
+        candidates[var->value] = var;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: exp()
+// desc: analyze each expression in a list
+//-----------------------------------------------------------------------------
+void Chuck_Escape::exp( a_Exp exp )
+{
+    for( ; exp; exp = exp->next )
+        exp_one( exp );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: exp_one()
+// desc: analyze an expression; any variable reached here (rather than
+//       skipped as the base of a dot member) escapes
+//-----------------------------------------------------------------------------
+void Chuck_Escape::exp_one( a_Exp e )
+{
+    switch( e->s_type )
+    {
+    case ae_exp_binary:
+        exp( e->binary.lhs ); exp( e->binary.rhs );
+        // the lhs is a fresh string seen by nothing but this `+`
+        if( is_concat( e ) && is_concat( e->binary.lhs ) && !e->binary.lhs->next &&
+            !e->binary.lhs->cast_to && e->binary.lhs->type &&
+            isa( e->binary.lhs->type, env->ckt_string ) )
+        {
+            e->binary.concat_in_place = TRUE;
+            concats++;
+        }
+        break;
+    case ae_exp_unary:
+        exp( e->unary.exp );
+        exp( e->unary.ctor.args );
+        if( e->unary.array ) exp( e->unary.array->exp_list );
+        stmt( e->unary.code );
+        break;
+    case ae_exp_cast:
+        exp( e->cast.exp );
+        break;
+    case ae_exp_postfix:
+        exp( e->postfix.exp );
+        break;
+    case ae_exp_dur:
+        exp( e->dur.base ); exp( e->dur.unit );
+        break;
+    case ae_exp_array:
+        exp( e->array.base );
+        if( e->array.indices ) exp( e->array.indices->exp_list );
+        break;
+    case ae_exp_func_call:
+        exp( e->func_call.func ); exp( e->func_call.args );
+        break;
+    case ae_exp_dot_member:
+        // `v.x` and `v.f()` don't let `v` escape
+        if( e->dot_member.base->s_type == ae_exp_primary &&
+            e->dot_member.base->primary.s_type == ae_primary_var &&
+            !e->dot_member.base->next ) break;
+        exp( e->dot_member.base );
+        break;
+    case ae_exp_if:
+        exp( e->exp_if.cond ); exp( e->exp_if.if_exp ); exp( e->exp_if.else_exp );
+        break;
+    case ae_exp_decl:
+        decl( e, TRUE );
+        break;
+    case ae_exp_primary:
+        switch( e->primary.s_type )
+        {
+        case ae_primary_var: if( e->primary.value ) escaped.insert( e->primary.value ); break;
+        case ae_primary_exp: case ae_primary_hack: exp( e->primary.exp ); break;
+        case ae_primary_array: if( e->primary.array ) exp( e->primary.array->exp_list ); break;
+        case ae_primary_complex: exp( e->primary.complex->re ); break;
+        case ae_primary_polar: exp( e->primary.polar->mod ); break;
+        case ae_primary_vec: exp( e->primary.vec->args ); break;
+        default: break;
+        }
+        break;
+    }
+}
@@ -0,0 +1,65 @@
+/*----------------------------------------------------------------------------
+  ChucK Strongly-timed Audio Programming Language
+    Compiler, Virtual Machine, and Synthesis Engine
+
+  Copyright (c) 2003 Ge Wang and Perry R. Cook. All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the dual-license terms of EITHER the MIT License OR the GNU
+  General Public License (the latter as published by the Free Software
+  Foundation; either version 2 of the License or, at your option, any
+  later version).
+
+  This program is distributed in the hope that it will be useful and/or
+  interesting, but WITHOUT ANY WARRANTY; without even the implied warranty
+  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  MIT Licence and/or the GNU General Public License for details.
+
+  You should have received a copy of the MIT License and the GNU General
+  Public License (GPL) along with this program; a copy of the GPL can also
+  be obtained by writing to the Free Software Foundation, Inc., 59 Temple
+  Place, Suite 330, Boston, MA 02111-1307 U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_escape.h
+// desc: escape analysis over the type-checked AST, run between constant
+//       folding and the emitter
+//
+//       two kinds of short-lived objects are found:
+//       1) string temporaries: in a chain like `"x: " + a + ", " + b`, the
+//          result of each inner `+` is only ever used as the left operand
+//          of the next `+`; the outer `+` appends to it in place instead of
+//          allocating another string (a_Exp_Binary::concat_in_place)
+//       2) local objects: a non-reference, non-array local of a class
+//          defined in the same file, declared in a function or loop body,
+//          and only used as the base of `.` (e.g., `v.x`, `v.f()`); it is
+//          instantiated from per-shred scratch storage that is reset and
+//          reused on the next pass through the declaration
+//          (a_Var_Decl::scratch)
+//
+//       the VM re-checks scratch objects before reusing them: an object
+//       that is still referenced (e.g., `this` leaked from a method) is left
+//       alone and a fresh one is allocated.
+//
+// date: Autumn 2026 | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_ESCAPE_H__
+#define __CHUCK_ESCAPE_H__
+
+#include "chuck_type.h"
+
+
+
+
+// mark non-escaping string temporaries and local objects in a type-checked
+// program; `how_much` selects the same sections as the scan/check/emit passes
+t_CKBOOL type_engine_escape_prog( Chuck_Env * env, a_Program prog,
+                                  te_HowMuch how_much = te_do_all );
+
+
+
+
+#endif
@@ -0,0 +1,923 @@
+/*----------------------------------------------------------------------------
+  ChucK Strongly-timed Audio Programming Language
+    Compiler, Virtual Machine, and Synthesis Engine
+
+  Copyright (c) 2003 Ge Wang and Perry R. Cook. All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the dual-license terms of EITHER the MIT License OR the GNU
+  General Public License (the latter as published by the Free Software
+  Foundation; either version 2 of the License or, at your option, any
+  later version).
+
+  This program is distributed in the hope that it will be useful and/or
+  interesting, but WITHOUT ANY WARRANTY; without even the implied warranty
+  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  MIT Licence and/or the GNU General Public License for details.
+
+  You should have received a copy of the MIT License and the GNU General
+  Public License (GPL) along with this program; a copy of the GPL can also
+  be obtained by writing to the Free Software Foundation, Inc., 59 Temple
+  Place, Suite 330, Boston, MA 02111-1307 U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_fold.cpp
+// desc: constant folding and dead-code elimination over the type-checked
+//       AST
+//
+//       folding mirrors what the VM would compute at runtime, instruction
+//       for instruction (e.g., && yields its rhs, >> is unsigned); anything
+//       that would raise a runtime exception (division or modulo by zero)
+//       or whose result depends on the platform (out-of-range shifts and
+//       casts) is left to the VM. instructions saved are counted exactly
+//       for folded expressions; for removed branches the count is an
+//       estimate (one instruction per AST node).
+//
+// date: Autumn 2026 | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#include "chuck_fold.h"
+#include "chuck_errmsg.h"
+#include <math.h>
+using namespace std;
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Folder
+// desc: state for one pass over a program
+//-----------------------------------------------------------------------------
+struct Chuck_Folder
+{
+    // the type environment
+    Chuck_Env * env;
+    // only count nodes (for dead code), don't fold
+    t_CKBOOL dry;
+    // nodes visited in dry mode
+    t_CKUINT nodes;
+    // expressions folded
+    t_CKUINT folded;
+    // branches removed
+    t_CKUINT branches;
+    // instructions saved
+    t_CKUINT saved;
+
+    Chuck_Folder( Chuck_Env * e )
+        : env(e), dry(FALSE), nodes(0), folded(0), branches(0), saved(0) { }
+
+    void stmt_list( a_Stmt_List list );
+    void stmt( a_Stmt stmt );
+    void exp( a_Exp exp );
+    void exp_one( a_Exp exp );
+    void section( a_Section section, te_HowMuch how_much );
+    // fold each kind of expression
+    void binary( a_Exp e );
+    void unary( a_Exp e );
+    void cast( a_Exp e );
+    void dur( a_Exp e );
+    void primary( a_Exp e );
+    void dot_member( a_Exp e );
+    void exp_if( a_Exp e );
+    // complex and vec literals
+    void aggregate( a_Exp e );
+    // estimated instructions in a dead statement or expression
+    t_CKUINT dead( a_Stmt stmt );
+    t_CKUINT dead( a_Exp exp );
+};
+
+
+
+
+// representation of a value on the VM's reg stack
+enum { fold_none = 0, fold_int, fold_double };
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: fold_kind()
+// desc: how a value of type `t` is represented, if foldable
+//-----------------------------------------------------------------------------
+static t_CKUINT fold_kind( Chuck_Type * t )
+{
+    if( !t ) return fold_none;
+    switch( t->xid )
+    {
+    case te_int: return fold_int;
+    case te_float: case te_dur: case te_time: return fold_double;
+    default: return fold_none;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: is_lit()
+// desc: is `e` a (type-checked) int or float literal
+//-----------------------------------------------------------------------------
+static t_CKBOOL is_lit( a_Exp e )
+{
+    return e && e->type && e->s_type == ae_exp_primary &&
+        ( e->primary.s_type == ae_primary_num || e->primary.s_type == ae_primary_float );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: lit_double()
+// desc: value of a literal as a double
+//-----------------------------------------------------------------------------
+static t_CKFLOAT lit_double( a_Exp e )
+{
+    return e->primary.s_type == ae_primary_num ? (t_CKFLOAT)e->primary.num : e->primary.fnum;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: lit_cost()
+// desc: instructions the emitter produces for a literal (or a complex or
+//       vec literal with literal components), including an implicit cast
+//-----------------------------------------------------------------------------
+static t_CKUINT lit_cost( a_Exp e )
+{
+    t_CKUINT cost = e->cast_to ? 1 : 0;
+    if( is_lit( e ) ) return cost + 1;
+
+    // aggregates
+    if( e->s_type == ae_exp_primary )
+    {
+        a_Exp c = NULL;
+        t_CKINT pad = 0;
+        switch( e->primary.s_type )
+        {
+        case ae_primary_complex: c = e->primary.complex->re; break;
+        case ae_primary_polar: c = e->primary.polar->mod; break;
+        case ae_primary_vec:
+            c = e->primary.vec->args;
+            pad = sz_VEC2/sz_FLOAT - e->primary.vec->numdims;
+            break;
+        default: break;
+        }
+        for( ; c; c = c->next ) cost += lit_cost( c );
+        if( pad > 0 ) cost += pad;
+    }
+
+    return cost;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: make_int() / make_float()
+// desc: rewrite `e` in place as a literal; its type, implicit cast, and
+//       position in the expression list are kept
+//-----------------------------------------------------------------------------
+static void make_lit( a_Exp e )
+{
+    e->s_type = ae_exp_primary;
+    e->s_meta = ae_meta_value;
+    e->primary.value = NULL;
+    e->primary.func_alias = NULL;
+    e->primary.line = e->line;
+    e->primary.where = e->where;
+    e->primary.self = e;
+}
+
+static void make_int( a_Exp e, t_CKINT v )
+{
+    make_lit( e );
+    e->primary.s_type = ae_primary_num;
+    e->primary.num = v;
+}
+
+static void make_float( a_Exp e, t_CKFLOAT v )
+{
+    make_lit( e );
+    e->primary.s_type = ae_primary_float;
+    e->primary.fnum = v;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: copy_lit()
+// desc: rewrite `dst` as the literal `src`
+//-----------------------------------------------------------------------------
+static void copy_lit( a_Exp dst, a_Exp src )
+{
+    if( src->primary.s_type == ae_primary_num ) make_int( dst, src->primary.num );
+    else make_float( dst, src->primary.fnum );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: fold_truth()
+// desc: is `cond` a literal; if so, its truth value
+//-----------------------------------------------------------------------------
+t_CKBOOL fold_truth( a_Exp cond, t_CKBOOL & truth )
+{
+    // single literal, no conversion
+    if( !is_lit( cond ) || cond->next || cond->cast_to ) return FALSE;
+    // non-zero
+    truth = cond->primary.s_type == ae_primary_num ? cond->primary.num != 0
+                                                   : cond->primary.fnum != 0;
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: type_engine_fold_prog()
+// desc: fold constants and drop unreachable branches in a program
+//-----------------------------------------------------------------------------
+t_CKBOOL type_engine_fold_prog( Chuck_Env * env, a_Program prog, te_HowMuch how_much )
+{
+    Chuck_Folder folder( env );
+
+    // loop over the program sections
+    for( ; prog; prog = prog->next )
+        folder.section( prog->section, how_much );
+
+    // report
+    if( folder.folded || folder.branches )
+    {
+        EM_log( CK_LOG_INFO, "folded %lu constant expression(s), removed %lu dead branch(es) in '%s'; ~%lu instruction(s) saved",
+                folder.folded, folder.branches,
+                env->context ? env->context->filename.c_str() : "", folder.saved );
+    }
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: section()
+// desc: fold a program or class body section
+//-----------------------------------------------------------------------------
+void Chuck_Folder::section( a_Section section, te_HowMuch how_much )
+{
+    switch( section->s_type )
+    {
+    case ae_section_stmt:
+        // statements are not part of an import
+        if( how_much == te_do_import_only ) break;
+        stmt_list( section->stmt_list );
+        break;
+
+    case ae_section_func:
+        if( !howMuch_criteria_match( how_much, section->func_def ) ) break;
+        stmt( section->func_def->code );
+        break;
+
+    case ae_section_class:
+        if( !howMuch_criteria_match( how_much, section->class_def ) ) break;
+        // everything in a class goes with it
+        for( a_Class_Body body = section->class_def->body; body; body = body->next )
+            this->section( body->section, te_do_all );
+        break;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: stmt_list()
+// desc: ...
+//-----------------------------------------------------------------------------
+void Chuck_Folder::stmt_list( a_Stmt_List list )
+{
+    for( ; list; list = list->next )
+        stmt( list->stmt );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: stmt()
+// desc: fold a statement; drop branches that can never run
+//-----------------------------------------------------------------------------
+void Chuck_Folder::stmt( a_Stmt stmt )
+{
+    t_CKBOOL truth = FALSE;
+    if( !stmt ) return;
+    if( dry ) nodes++;
+
+    switch( stmt->s_type )
+    {
+    case ae_stmt_exp:
+        exp( stmt->stmt_exp );
+        break;
+
+    case ae_stmt_if:
+        exp( stmt->stmt_if.cond );
+        if( !dry && fold_truth( stmt->stmt_if.cond, truth ) )
+        {
+            // cond, push 0, branch, goto
+            saved += lit_cost( stmt->stmt_if.cond ) + 3;
+            // the branch never taken
+            a_Stmt & gone = truth ? stmt->stmt_if.else_body : stmt->stmt_if.if_body;
+            if( gone ) { saved += dead( gone ); branches++; gone = NULL; }
+        }
+        this->stmt( stmt->stmt_if.if_body );
+        this->stmt( stmt->stmt_if.else_body );
+        break;
+
+    case ae_stmt_while:
+        exp( stmt->stmt_while.cond );
+        if( !dry && !stmt->stmt_while.is_do && fold_truth( stmt->stmt_while.cond, truth ) )
+        {
+            // never entered
+            if( !truth )
+            {
+                saved += lit_cost( stmt->stmt_while.cond ) + 3 + dead( stmt->stmt_while.body );
+                if( stmt->stmt_while.body ) branches++;
+                stmt->stmt_while.body = NULL;
+            }
+            // never exits via the cond: cond, push 0, branch (per iteration)
+            else saved += lit_cost( stmt->stmt_while.cond ) + 2;
+        }
+        this->stmt( stmt->stmt_while.body );
+        break;
+
+    case ae_stmt_until:
+        exp( stmt->stmt_until.cond );
+        if( !dry && !stmt->stmt_until.is_do && fold_truth( stmt->stmt_until.cond, truth ) )
+        {
+            if( truth )
+            {
+                saved += lit_cost( stmt->stmt_until.cond ) + 3 + dead( stmt->stmt_until.body );
+                if( stmt->stmt_until.body ) branches++;
+                stmt->stmt_until.body = NULL;
+            }
+            else saved += lit_cost( stmt->stmt_until.cond ) + 2;
+        }
+        this->stmt( stmt->stmt_until.body );
+        break;
+
+    case ae_stmt_for:
+        this->stmt( stmt->stmt_for.c1 );
+        this->stmt( stmt->stmt_for.c2 );
+        exp( stmt->stmt_for.c3 );
+        this->stmt( stmt->stmt_for.body );
+        break;
+
+    case ae_stmt_foreach:
+        exp( stmt->stmt_foreach.theIter );
+        exp( stmt->stmt_foreach.theArray );
+        this->stmt( stmt->stmt_foreach.body );
+        break;
+
+    case ae_stmt_loop:
+        exp( stmt->stmt_loop.cond );
+        this->stmt( stmt->stmt_loop.body );
+        break;
+
+    case ae_stmt_code:
+        stmt_list( stmt->stmt_code.stmt_list );
+        break;
+
+    case ae_stmt_switch:
+        exp( stmt->stmt_switch.val );
+        break;
+
+    case ae_stmt_return:
+        exp( stmt->stmt_return.val );
+        break;
+
+    case ae_stmt_case:
+        exp( stmt->stmt_case.exp );
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: dead()
+// desc: estimate the instructions in code that will not be emitted
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_Folder::dead( a_Stmt stmt )
+{
+    t_CKBOOL wasDry = dry; t_CKUINT wasNodes = nodes;
+    dry = TRUE; nodes = 0;
+    this->stmt( stmt );
+    t_CKUINT count = nodes;
+    dry = wasDry; nodes = wasNodes;
+    return count;
+}
+
+t_CKUINT Chuck_Folder::dead( a_Exp exp )
+{
+    if( is_lit( exp ) && !exp->next ) return lit_cost( exp );
+    t_CKBOOL wasDry = dry; t_CKUINT wasNodes = nodes;
+    dry = TRUE; nodes = 0;
+    this->exp( exp );
+    t_CKUINT count = nodes;
+    dry = wasDry; nodes = wasNodes;
+    return count;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: exp()
+// desc: fold each expression in a list
+//-----------------------------------------------------------------------------
+void Chuck_Folder::exp( a_Exp exp )
+{
+    for( ; exp; exp = exp->next )
+        exp_one( exp );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: exp_one()
+// desc: fold the sub-expressions of `e`, then `e` itself
+//-----------------------------------------------------------------------------
+void Chuck_Folder::exp_one( a_Exp e )
+{
+    if( dry ) nodes++;
+
+    // sub-expressions
+    switch( e->s_type )
+    {
+    case ae_exp_binary:
+        exp( e->binary.lhs ); exp( e->binary.rhs );
+        break;
+    case ae_exp_unary:
+        exp( e->unary.exp );
+        exp( e->unary.ctor.args );
+        if( e->unary.array ) exp( e->unary.array->exp_list );
+        stmt( e->unary.code );
+        break;
+    case ae_exp_cast:
+        exp( e->cast.exp );
+        break;
+    case ae_exp_postfix:
+        exp( e->postfix.exp );
+        break;
+    case ae_exp_dur:
+        exp( e->dur.base ); exp( e->dur.unit );
+        break;
+    case ae_exp_array:
+        exp( e->array.base );
+        if( e->array.indices ) exp( e->array.indices->exp_list );
+        break;
+    case ae_exp_func_call:
+        exp( e->func_call.func ); exp( e->func_call.args );
+        break;
+    case ae_exp_dot_member:
+        exp( e->dot_member.base );
+        break;
+    case ae_exp_if:
+        exp( e->exp_if.cond ); exp( e->exp_if.if_exp ); exp( e->exp_if.else_exp );
+        break;
+    case ae_exp_decl:
+        for( a_Var_Decl_List list = e->decl.var_decl_list; list; list = list->next )
+        {
+            if( list->var_decl->array ) exp( list->var_decl->array->exp_list );
+            exp( list->var_decl->ctor.args );
+        }
+        break;
+    case ae_exp_primary:
+        switch( e->primary.s_type )
+        {
+        case ae_primary_exp: case ae_primary_hack: exp( e->primary.exp ); break;
+        case ae_primary_array: if( e->primary.array ) exp( e->primary.array->exp_list ); break;
+        case ae_primary_complex: exp( e->primary.complex->re ); break;
+        case ae_primary_polar: exp( e->primary.polar->mod ); break;
+        case ae_primary_vec: exp( e->primary.vec->args ); break;
+        default: break;
+        }
+        break;
+    }
+
+    // only count, or not type-checked (e.g., an unused import section), or an lvalue
+    if( dry || !e->type || e->emit_var ) return;
+
+    // this expression
+    switch( e->s_type )
+    {
+    case ae_exp_binary: binary( e ); break;
+    case ae_exp_unary: unary( e ); break;
+    case ae_exp_cast: cast( e ); break;
+    case ae_exp_dur: dur( e ); break;
+    case ae_exp_primary: primary( e ); break;
+    case ae_exp_dot_member: dot_member( e ); break;
+    case ae_exp_if: exp_if( e ); break;
+    default: break;
+    }
+
+    // absorb an implicit int to float cast into the literal
+    if( is_lit( e ) && e->primary.s_type == ae_primary_num &&
+        e->cast_to && e->cast_to->xid == te_float && e->type->xid == te_int )
+    {
+        make_float( e, (t_CKFLOAT)e->primary.num );
+        e->type = e->cast_to;
+        e->cast_to = NULL;
+        saved++;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: binary()
+// desc: fold a binary operation on literals
+//-----------------------------------------------------------------------------
+void Chuck_Folder::binary( a_Exp e )
+{
+    a_Exp lhs = e->binary.lhs, rhs = e->binary.rhs;
+    ae_Operator op = e->binary.op;
+
+    // operator overloads run user code
+    if( e->binary.ck_overload_func || lhs->next || rhs->next ) return;
+
+    // short-circuit: rhs is never evaluated (emitted as push, lhs, push 0, branch, pop, rhs)
+    if( (op == ae_op_and || op == ae_op_or) && is_lit( lhs ) && !lhs->cast_to &&
+        lhs->primary.s_type == ae_primary_num && e->type->xid == te_int )
+    {
+        t_CKBOOL l = lhs->primary.num != 0;
+        if( op == ae_op_and ? !l : l )
+        {
+            saved += lit_cost( lhs ) + dead( rhs ) + 3;
+            make_int( e, op == ae_op_and ? 0 : 1 );
+            folded++;
+            return;
+        }
+    }
+
+    // complex and vec
+    if( lhs->s_type == ae_exp_primary && rhs->s_type == ae_exp_primary &&
+        ( lhs->primary.s_type == ae_primary_complex || lhs->primary.s_type == ae_primary_vec ) )
+    {
+        aggregate( e );
+        return;
+    }
+
+    // both literals, no further conversion
+    if( !is_lit( lhs ) || !is_lit( rhs ) || lhs->cast_to || rhs->cast_to ) return;
+    t_CKUINT kl = fold_kind( lhs->type ), kr = fold_kind( rhs->type ), k = fold_kind( e->type );
+    if( !k || kl != kr ) return;
+    t_CKUINT cost = lit_cost( lhs ) + lit_cost( rhs ) + 1;
+
+    if( kl == fold_int )
+    {
+        t_CKINT a = lhs->primary.num, b = rhs->primary.num, r = 0;
+        // wrap around as the VM does
+        t_CKUINT ua = (t_CKUINT)a, ub = (t_CKUINT)b;
+        if( k != fold_int ) return;
+
+        switch( op )
+        {
+        case ae_op_plus: r = (t_CKINT)(ua + ub); break;
+        case ae_op_minus: r = (t_CKINT)(ua - ub); break;
+        case ae_op_times: r = (t_CKINT)(ua * ub); break;
+        case ae_op_divide:
+        case ae_op_percent:
+            // runtime exception (or trap) left to the VM
+            if( b == 0 || ( b == -1 && a == (t_CKINT)((t_CKUINT)1 << (sizeof(t_CKINT)*8-1)) ) ) return;
+            r = op == ae_op_divide ? a / b : a % b;
+            break;
+        case ae_op_shift_left:
+        case ae_op_shift_right:
+            if( b < 0 || b >= (t_CKINT)(sizeof(t_CKINT)*8) ) return;
+            r = (t_CKINT)( op == ae_op_shift_left ? ua << ub : ua >> ub );
+            break;
+        case ae_op_s_and: r = a & b; break;
+        case ae_op_s_or: r = a | b; break;
+        case ae_op_s_xor: r = a ^ b; break;
+        case ae_op_lt: r = a < b; break;
+        case ae_op_le: r = a <= b; break;
+        case ae_op_gt: r = a > b; break;
+        case ae_op_ge: r = a >= b; break;
+        case ae_op_eq: r = a == b; break;
+        case ae_op_neq: r = a != b; break;
+        // the result of && / || is the rhs when not short-circuited
+        case ae_op_and: r = a ? b : 0; cost += 3; break;
+        case ae_op_or: r = a ? 1 : b; cost += 3; break;
+        default: return;
+        }
+
+        make_int( e, r );
+    }
+    else if( kl == fold_double )
+    {
+        t_CKFLOAT a = lhs->primary.fnum, b = rhs->primary.fnum, r = 0;
+        t_CKBOOL cmp = FALSE;
+
+        switch( op )
+        {
+        case ae_op_plus: r = a + b; break;
+        case ae_op_minus: r = a - b; break;
+        case ae_op_times: r = a * b; break;
+        case ae_op_divide: r = a / b; break;
+        case ae_op_percent:
+            if( b == 0 ) return;
+            r = ::fmod( a, b );
+            break;
+        case ae_op_lt: r = a < b; cmp = TRUE; break;
+        case ae_op_le: r = a <= b; cmp = TRUE; break;
+        case ae_op_gt: r = a > b; cmp = TRUE; break;
+        case ae_op_ge: r = a >= b; cmp = TRUE; break;
+        case ae_op_eq: r = a == b; cmp = TRUE; break;
+        case ae_op_neq: r = a != b; cmp = TRUE; break;
+        default: return;
+        }
+
+        // comparisons yield int
+        if( cmp != (k == fold_int) ) return;
+        if( cmp ) make_int( e, (t_CKINT)r );
+        else make_float( e, r );
+    }
+    else return;
+
+    saved += cost - 1;
+    folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: aggregate()
+// desc: fold + - * / on complex literals and + - on vec literals
+//-----------------------------------------------------------------------------
+void Chuck_Folder::aggregate( a_Exp e )
+{
+    a_Exp lhs = e->binary.lhs, rhs = e->binary.rhs;
+    ae_Operator op = e->binary.op;
+    a_Exp a = NULL, b = NULL;
+
+    // same kind and type, no conversion
+    if( lhs->primary.s_type != rhs->primary.s_type || lhs->cast_to || rhs->cast_to ) return;
+    if( !equals( lhs->type, rhs->type ) || !equals( lhs->type, e->type ) ) return;
+
+    if( lhs->primary.s_type == ae_primary_complex )
+    {
+        if( op != ae_op_plus && op != ae_op_minus && op != ae_op_times && op != ae_op_divide ) return;
+        a = lhs->primary.complex->re; b = rhs->primary.complex->re;
+    }
+    else
+    {
+        if( op != ae_op_plus && op != ae_op_minus ) return;
+        if( lhs->primary.vec->numdims != rhs->primary.vec->numdims ) return;
+        a = lhs->primary.vec->args; b = rhs->primary.vec->args;
+    }
+
+    // every component a float literal (int components absorb their cast)
+    t_CKFLOAT x[4], y[4];
+    t_CKUINT n = 0;
+    a_Exp ai = a, bi = b;
+    for( ; ai && bi && n < 4; ai = ai->next, bi = bi->next, n++ )
+    {
+        if( !is_lit( ai ) || !is_lit( bi ) || ai->cast_to || bi->cast_to ) return;
+        if( ai->primary.s_type != ae_primary_float || bi->primary.s_type != ae_primary_float ) return;
+        x[n] = ai->primary.fnum; y[n] = bi->primary.fnum;
+    }
+    if( ai || bi ) return;
+
+    t_CKUINT cost = lit_cost( lhs ) + lit_cost( rhs ) + 1;
+
+    // compute into x
+    if( op == ae_op_plus ) for( t_CKUINT i = 0; i < n; i++ ) x[i] += y[i];
+    else if( op == ae_op_minus ) for( t_CKUINT i = 0; i < n; i++ ) x[i] -= y[i];
+    else
+    {
+        if( n != 2 ) return;
+        t_CKFLOAT re = 0, im = 0;
+        if( op == ae_op_times )
+        {
+            re = x[0]*y[0] - x[1]*y[1];
+            im = x[0]*y[1] + x[1]*y[0];
+        }
+        else
+        {
+            // complex division -> * complex conjugate of divisor
+            t_CKFLOAT denom = y[0]*y[0] + y[1]*y[1];
+            if( denom == 0 ) return;
+            re = (x[0]*y[0] + x[1]*y[1]) / denom;
+            im = (x[1]*y[0] - x[0]*y[1]) / denom;
+        }
+        x[0] = re; x[1] = im;
+    }
+
+    // write the result into lhs's components, then make lhs the result
+    ai = a;
+    for( t_CKUINT i = 0; i < n; i++, ai = ai->next ) ai->primary.fnum = x[i];
+    e->s_type = ae_exp_primary;
+    e->s_meta = ae_meta_value;
+    e->primary = lhs->primary;
+    e->primary.self = e;
+    if( e->primary.s_type == ae_primary_complex ) e->primary.complex->self = e;
+    else e->primary.vec->self = e;
+
+    saved += cost - lit_cost( lhs );
+    folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: unary()
+// desc: fold - ~ ! on a literal
+//-----------------------------------------------------------------------------
+void Chuck_Folder::unary( a_Exp e )
+{
+    a_Exp x = e->unary.exp;
+    if( e->unary.ck_overload_func || !is_lit( x ) || x->next || x->cast_to ) return;
+    t_CKUINT k = fold_kind( x->type );
+    if( !k || k != fold_kind( e->type ) ) return;
+
+    switch( e->unary.op )
+    {
+    case ae_op_minus:
+        if( k == fold_int ) make_int( e, (t_CKINT)(0 - (t_CKUINT)x->primary.num ) );
+        else make_float( e, -x->primary.fnum );
+        break;
+    case ae_op_tilda:
+        if( k != fold_int ) return;
+        make_int( e, ~x->primary.num );
+        break;
+    case ae_op_exclamation:
+        if( k != fold_int ) return;
+        make_int( e, !x->primary.num );
+        break;
+    default:
+        return;
+    }
+
+    // operand and op -> literal
+    saved += lit_cost( x );
+    folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: cast()
+// desc: fold an explicit cast of a literal between int and float, or to a
+//       type with the same representation
+//-----------------------------------------------------------------------------
+void Chuck_Folder::cast( a_Exp e )
+{
+    a_Exp x = e->cast.exp;
+    if( !is_lit( x ) || x->next || x->cast_to ) return;
+    t_CKUINT from = fold_kind( x->type ), to = fold_kind( e->type );
+    if( !from || !to ) return;
+
+    // the emitter casts only between int and float
+    t_CKUINT instrs = 0;
+    if( from == to )
+    {
+        if( !equals( x->type, e->type ) ) return;
+        copy_lit( e, x );
+    }
+    else if( from == fold_int && e->type->xid == te_float )
+    {
+        make_float( e, (t_CKFLOAT)x->primary.num );
+        instrs = 1;
+    }
+    else if( from == fold_double && x->type->xid == te_float && to == fold_int )
+    {
+        // out of range is platform-dependent; leave to the VM
+        t_CKFLOAT v = x->primary.fnum;
+        if( !(v > -9.2e18 && v < 9.2e18) ) return;
+        make_int( e, (t_CKINT)v );
+        instrs = 1;
+    }
+    else return;
+
+    saved += lit_cost( x ) + instrs - 1;
+    folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: dur()
+// desc: fold base::unit
+//-----------------------------------------------------------------------------
+void Chuck_Folder::dur( a_Exp e )
+{
+    a_Exp base = e->dur.base, unit = e->dur.unit;
+    if( !is_lit( base ) || !is_lit( unit ) || base->cast_to || unit->cast_to ) return;
+    if( !fold_kind( base->type ) || unit->type->xid != te_dur ) return;
+
+    // base, cast (if int), unit, times
+    t_CKUINT cost = lit_cost( base ) + ( base->type->xid == te_int ? 1 : 0 ) + lit_cost( unit ) + 1;
+    make_float( e, lit_double( base ) * unit->primary.fnum );
+
+    saved += cost - 1;
+    folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: primary()
+// desc: true, false, pi, and builtin durations become literals (as the
+//       emitter would push them)
+//-----------------------------------------------------------------------------
+void Chuck_Folder::primary( a_Exp e )
+{
+    if( e->primary.s_type == ae_primary_char )
+    {
+        make_int( e, str2char( e->primary.chr, e->where ) );
+        return;
+    }
+    if( e->primary.s_type != ae_primary_var ) return;
+
+    S_Symbol var = e->primary.var;
+    if( var == insert_symbol( "true" ) ) make_int( e, 1 );
+    else if( var == insert_symbol( "false" ) ) make_int( e, 0 );
+    else if( var == insert_symbol( "pi" ) ) make_float( e, 3.14159265358979323846 );
+    else if( e->type->xid == te_dur )
+    {
+        // same lookup as Chuck_Emitter::find_dur()
+        Chuck_Value * value = env->global()->lookup_value( S_name(var), FALSE );
+        if( !value || !value->addr || !equals( value->type, env->ckt_dur ) ) return;
+        // only if that is what the name refers to
+        if( e->primary.value && e->primary.value != value ) return;
+        make_float( e, *(t_CKDUR *)value->addr );
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: dot_member()
+// desc: builtin static constants (e.g., Math.PI) become literals
+//-----------------------------------------------------------------------------
+void Chuck_Folder::dot_member( a_Exp e )
+{
+    a_Exp_Dot_Member member = &e->dot_member;
+    // only through a class name (nothing to evaluate)
+    if( !type_engine_is_base_type_static( env, member->t_base ) ) return;
+    Chuck_Value * value = type_engine_find_value( member->t_base->actual_type, member->xid );
+    if( !value || !value->is_const || value->is_instance_member || !value->addr ) return;
+    if( value->func_ref || !equals( value->type, e->type ) ) return;
+
+    // read it as Chuck_Instr_Dot_Static_Import_Data would
+    switch( fold_kind( e->type ) )
+    {
+    case fold_int: make_int( e, *(t_CKINT *)value->addr ); break;
+    case fold_double: make_float( e, *(t_CKFLOAT *)value->addr ); break;
+    default: return;
+    }
+
+    // the load becomes an immediate
+    folded++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: exp_if()
+// desc: cond ? a : b with a literal cond and a literal live arm
+//       (otherwise the emitter drops the dead arm; see fold_truth())
+//-----------------------------------------------------------------------------
+void Chuck_Folder::exp_if( a_Exp e )
+{
+    t_CKBOOL truth = FALSE;
+    if( !fold_truth( e->exp_if.cond, truth ) ) return;
+    a_Exp live = truth ? e->exp_if.if_exp : e->exp_if.else_exp;
+    a_Exp gone = truth ? e->exp_if.else_exp : e->exp_if.if_exp;
+    if( !is_lit( live ) || live->next || live->cast_to ) return;
+    if( !equals( live->type, e->type ) ) return;
+
+    // cond, push 0, branch, goto, and the dead arm
+    saved += lit_cost( e->exp_if.cond ) + 3 + dead( gone );
+    copy_lit( e, live );
+    branches++;
+}
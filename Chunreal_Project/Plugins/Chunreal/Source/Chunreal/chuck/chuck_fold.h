@@ -0,0 +1,61 @@
+/*----------------------------------------------------------------------------
+  ChucK Strongly-timed Audio Programming Language
+    Compiler, Virtual Machine, and Synthesis Engine
+
+  Copyright (c) 2003 Ge Wang and Perry R. Cook. All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the dual-license terms of EITHER the MIT License OR the GNU
+  General Public License (the latter as published by the Free Software
+  Foundation; either version 2 of the License or, at your option, any
+  later version).
+
+  This program is distributed in the hope that it will be useful and/or
+  interesting, but WITHOUT ANY WARRANTY; without even the implied warranty
+  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  MIT Licence and/or the GNU General Public License for details.
+
+  You should have received a copy of the MIT License and the GNU General
+  Public License (GPL) along with this program; a copy of the GPL can also
+  be obtained by writing to the Free Software Foundation, Inc., 59 Temple
+  Place, Suite 330, Boston, MA 02111-1307 U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// file: chuck_fold.h
+// desc: constant folding and dead-code elimination over the type-checked
+//       AST, run between the type checker and the emitter
+//
+//       int, float, dur, and time expressions whose operands are literals,
+//       true/false/pi, builtin durations (e.g., second), or builtin static
+//       constants (e.g., Math.PI) are rewritten in place as literals;
+//       complex and vec literals are folded under + and - (and * and / for
+//       complex). the bodies of if/while/until statements whose condition
+//       folds to a constant are dropped when unreachable; the emitter then
+//       emits only the live part (see fold_truth()).
+//
+// date: Autumn 2026 | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#ifndef __CHUCK_FOLD_H__
+#define __CHUCK_FOLD_H__
+
+#include "chuck_type.h"
+
+
+
+
+// fold constants and drop unreachable branches in a type-checked program;
+// `how_much` selects the same sections as the scan/check/emit passes
+t_CKBOOL type_engine_fold_prog( Chuck_Env * env, a_Program prog,
+                                te_HowMuch how_much = te_do_all );
+
+// if `cond` is a literal (e.g., after folding), set `truth` to whether it
+// is non-zero and return TRUE; used by the emitter to skip the branch
+t_CKBOOL fold_truth( a_Exp cond, t_CKBOOL & truth );
+
+
+
+
+#endif
@@ -34,6 +34,7 @@
 #include "chuck_globals.h"
 #include "chuck_vm.h"
 #include "chuck_instr.h"
+#include <atomic>
 using namespace std;
 
 
@@ -308,8 +309,10 @@ struct Chuck_Set_Global_Float_Array_Request
 {
     std::string name;
     std::vector< t_CKFLOAT > arrayValues;
+    // return the replaced contents to the host for reuse | 1.5.5.3
+    t_CKBOOL recycle;
     // constructor
-    Chuck_Set_Global_Float_Array_Request() { }
+    Chuck_Set_Global_Float_Array_Request() : recycle(FALSE) { }
 };
 
 
@@ -564,6 +567,20 @@ struct Chuck_Global_Object_Container
 
 
 
+//-----------------------------------------------------------------------------
+// name: next_globals_generation() | 1.5.5.3 (added)
+// desc: next Chuck_Globals_Manager::generation(); never reused, so a cached
+//       global address can't be mistaken for one in a newer manager
+//-----------------------------------------------------------------------------
+static t_CKUINT next_globals_generation()
+{
+    static std::atomic<t_CKUINT> s_next( 1 );
+    return s_next.fetch_add( 1, std::memory_order_relaxed );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: Chuck_Globals_Manager()
 // desc: constructor: size queues appropriately
@@ -576,6 +593,10 @@ Chuck_Globals_Manager::Chuck_Globals_Manager( Chuck_VM * vm )
     // REFACTOR-2017: TODO might want to dynamically grow queue?
     m_global_request_queue.init( 16384 );
     m_global_request_retry_queue.init( 16384 );
+    // 1.5.5.3: buffers handed back by publishGlobalFloatArrayBuffer()
+    m_float_array_recycle_queue.init( 1024 );
+    // 1.5.5.3: for cached global addresses
+    m_generation = next_globals_generation();
 }
 
 
@@ -588,6 +609,11 @@ Chuck_Globals_Manager::Chuck_Globals_Manager( Chuck_VM * vm )
 Chuck_Globals_Manager::~Chuck_Globals_Manager()
 {
     cleanup_global_variables();
+
+    // float array buffers the host has not taken back | 1.5.5.3
+    Chuck_Set_Global_Float_Array_Request * back = NULL;
+    while( m_float_array_recycle_queue.get( &back ) ) CK_SAFE_DELETE( back );
+    m_float_array_buffers.clear();
 }
 
 
@@ -606,18 +632,6 @@ t_CKBOOL Chuck_Globals_Manager::add_request( Chuck_Global_Request request )
 
 
 
-//-----------------------------------------------------------------------------
-// name: more_requests
-// desc: are there more requests left?
-//-----------------------------------------------------------------------------
-t_CKBOOL Chuck_Globals_Manager::more_requests()
-{
-    return m_global_request_queue.more();
-}
-
-
-
-
 //-----------------------------------------------------------------------------
 // name: getGlobalInt()
 // desc: get a global int by name
@@ -1844,12 +1858,98 @@ t_CKBOOL Chuck_Globals_Manager::setGlobalFloatArray( const char * name,
     Chuck_Set_Global_Float_Array_Request * message =
         new Chuck_Set_Global_Float_Array_Request;
     message->name = name;
-    message->arrayValues.resize( numValues );
-    for( int i = 0; i < numValues; i++ )
+    message->arrayValues.assign( arrayValues, arrayValues + numValues );
+
+    Chuck_Global_Request r;
+    r.type = set_global_float_array_request;
+    r.setFloatArrayRequest = message;
+    // chuck object might not be constructed on time. retry only once
+    r.retries = 1;
+
+    m_global_request_queue.put( r );
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: setGlobalFloatArray()
+// desc: tell the vm to set an entire float array, taking over `values`
+//       (no copy on either side; the vm swaps it in) | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Globals_Manager::setGlobalFloatArray( const char * name,
+    std::vector<t_CKFLOAT> && values )
+{
+    Chuck_Set_Global_Float_Array_Request * message =
+        new Chuck_Set_Global_Float_Array_Request;
+    message->name = name;
+    message->arrayValues.swap( values );
+
+    Chuck_Global_Request r;
+    r.type = set_global_float_array_request;
+    r.setFloatArrayRequest = message;
+    // chuck object might not be constructed on time. retry only once
+    r.retries = 1;
+
+    m_global_request_queue.put( r );
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: getGlobalFloatArrayBuffer()
+// desc: get the host-side buffer of `numValues` floats for a global float
+//       array, to be filled and then published with
+//       publishGlobalFloatArrayBuffer(); the buffer is one the vm handed
+//       back from an earlier publish when available, so its previous
+//       contents are unspecified | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+t_CKFLOAT * Chuck_Globals_Manager::getGlobalFloatArrayBuffer( const char * name,
+    t_CKUINT numValues )
+{
+    // take back what the vm has swapped out since last time
+    Chuck_Set_Global_Float_Array_Request * back = NULL;
+    while( m_float_array_recycle_queue.get( &back ) )
     {
-        message->arrayValues[i] = arrayValues[i];
+        std::vector<t_CKFLOAT> & spare = m_float_array_buffers[back->name];
+        // keep whichever is larger
+        if( spare.capacity() < back->arrayValues.capacity() )
+            spare.swap( back->arrayValues );
+        CK_SAFE_DELETE( back );
     }
 
+    // size the back buffer
+    std::vector<t_CKFLOAT> & buffer = m_float_array_buffers[name];
+    buffer.resize( numValues );
+    return numValues ? &buffer[0] : NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: publishGlobalFloatArrayBuffer()
+// desc: hand the buffer from getGlobalFloatArrayBuffer() to the vm, which
+//       swaps it with the global float array's storage at the start of the
+//       next block and hands the old storage back | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_Globals_Manager::publishGlobalFloatArrayBuffer( const char * name )
+{
+    std::map< std::string, std::vector<t_CKFLOAT> >::iterator it =
+        m_float_array_buffers.find( name );
+    if( it == m_float_array_buffers.end() ) return FALSE;
+
+    Chuck_Set_Global_Float_Array_Request * message =
+        new Chuck_Set_Global_Float_Array_Request;
+    message->name = name;
+    message->arrayValues.swap( it->second );
+    message->recycle = TRUE;
+
     Chuck_Global_Request r;
     r.type = set_global_float_array_request;
     r.setFloatArrayRequest = message;
@@ -2767,6 +2867,12 @@ void Chuck_Globals_Manager::global_ctor_was_called( const std::string & name,
 //-----------------------------------------------------------------------------
 void Chuck_Globals_Manager::cleanup_global_variables()
 {
+    // invalidate addresses cached by instructions | 1.5.5.3
+    m_generation = next_globals_generation();
+
+    // (float array back buffers and the recycle queue belong to the host
+    // side; they outlive a clear and are only freed in the destructor)
+
     // ints: delete containers and clear map
     for( std::map< std::string, Chuck_Global_Int_Container * >::iterator it=
         m_global_ints.begin(); it!=m_global_ints.end(); it++ )
@@ -3400,16 +3506,13 @@ void Chuck_Globals_Manager::handle_global_queue_messages()
                         if( array != NULL &&
                            m_global_arrays[request->name]->array_type == te_globalFloat )
                         {
-                            // it exists! get existing array, new size
+                            // it exists! swap in the new contents; the old
+                            // contents leave with the request | 1.5.5.3
                             Chuck_ArrayFloat * floatArray = (Chuck_ArrayFloat *) array;
-                            t_CKUINT newSize = request->arrayValues.size();
-
-                            // resize and copy in
-                            floatArray->set_size( newSize );
-                            for( int i = 0; i < newSize; i++ )
-                            {
-                                floatArray->set( i, request->arrayValues[i] );
-                            }
+                            floatArray->m_vector.swap( request->arrayValues );
+                            // hand them back to the host for its next update
+                            if( request->recycle && m_float_array_recycle_queue.put( request ) )
+                                message.setFloatArrayRequest = NULL;
                         }
                     }
                     else
@@ -261,6 +261,13 @@ public:
     t_CKBOOL getGlobalAssociativeIntArrayValue( const char * name, t_CKINT callbackID, const char * key, void (*callback)(t_CKINT, t_CKINT) );
 
     t_CKBOOL setGlobalFloatArray( const char * name, t_CKFLOAT arrayValues[], t_CKUINT numValues );
+    t_CKBOOL setGlobalFloatArray( const char * name, std::vector<t_CKFLOAT> && values ); // 1.5.5.3
+    // 1.5.5.3: double-buffered float arrays without per-update copies:
+    // fill the buffer returned by getGlobalFloatArrayBuffer(), then publish;
+    // the vm swaps it in and hands the old storage back for the next update
+    // (call both from the same host thread)
+    t_CKFLOAT * getGlobalFloatArrayBuffer( const char * name, t_CKUINT numValues );
+    t_CKBOOL publishGlobalFloatArrayBuffer( const char * name );
     t_CKBOOL getGlobalFloatArray( const char * name, void (*callback)(t_CKFLOAT[], t_CKUINT) );
     t_CKBOOL getGlobalFloatArray( const char * name, void (*callback)(const char*, t_CKFLOAT[], t_CKUINT) );
     t_CKBOOL getGlobalFloatArray( const char * name, t_CKINT callbackID, void (*callback)(t_CKINT, t_CKFLOAT[], t_CKUINT) );
@@ -336,11 +343,14 @@ public:
 
     // global variables -- clean up
     void cleanup_global_variables();
+    // changes whenever global storage is torn down; instructions that
+    // cache a global's address re-resolve it when this differs | 1.5.5.3
+    t_CKUINT generation() const { return m_generation; }
 
 public: // these should ever ONLY be called from within the VM
     // request queue: add, query for size
     t_CKBOOL add_request( Chuck_Global_Request request );
-    t_CKBOOL more_requests();
+    t_CKBOOL more_requests() { return m_global_request_queue.more(); }
     // REFACTOR-2017: execute the messages from the global queue
     void handle_global_queue_messages();
 
@@ -367,6 +377,14 @@ private:
     // this is ok because the external host has no guarantee of sample-level
     // determinism, like we have within the ChucK VM
     FinalRingBuffer< Chuck_Global_Request > m_global_request_retry_queue;
+
+    // 1.5.5.3: host-side back buffers for publishGlobalFloatArrayBuffer()
+    std::map< std::string, std::vector<t_CKFLOAT> > m_float_array_buffers;
+    // storage swapped out of global float arrays, on its way back to the host
+    FinalRingBuffer< Chuck_Set_Global_Float_Array_Request * > m_float_array_recycle_queue;
+
+    // see generation(); unique across all managers in the process | 1.5.5.3
+    t_CKUINT m_generation;
 };
 
 
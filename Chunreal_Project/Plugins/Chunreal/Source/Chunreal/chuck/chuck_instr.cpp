@@ -86,6 +86,10 @@ Chuck_Instr::~Chuck_Instr()
 //-----------------------------------------------------------------------------
 const char * Chuck_Instr::name() const
 {
+    // declared by the class; does not need run time type information,
+    // which Unreal Engine disables | 1.5.5.3
+    const char * str = opcode();
+    if( str ) return str;
 #ifndef __CHUNREAL_ENGINE__
     return mini_type( typeid(*this).name() );
 #else
@@ -2064,6 +2068,54 @@ done:
 
 
 
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: string temporary + (string|int|float), in place | 1.5.5.3
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Add_string_Temp::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    Chuck_String * lhs = NULL;
+
+    switch( m_val )
+    {
+    case te_int:
+        pop_( reg_sp, 2 );
+        lhs = (Chuck_String *)(*(reg_sp));
+        lhs->append( std::to_string( *(t_CKINT *)(reg_sp+1) ) );
+        break;
+
+    case te_float:
+        pop_( reg_sp, 1 + (sz_FLOAT / sz_UINT) );
+        lhs = (Chuck_String *)(*(reg_sp));
+        lhs->append( std::to_string( *(t_CKFLOAT *)(reg_sp+1) ) );
+        break;
+
+    default:
+    {
+        pop_( reg_sp, 2 );
+        lhs = (Chuck_String *)(*(reg_sp));
+        Chuck_String * rhs = (Chuck_String *)(*(reg_sp+1));
+        // same exception as @operator+(string,string)
+        if( !rhs )
+        {
+            ck_throw_exception( shred, "NullPointer", "argument(s) to @operator+(string,string)" );
+            return;
+        }
+        lhs->append( rhs->str() );
+        break;
+    }
+    }
+
+    // push the (same) reference value to reg stack
+    push_( reg_sp, (t_CKUINT)lhs );
+    // count
+    vm->pool()->avoided();
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: execute()
 // desc: string + int
@@ -2715,7 +2767,7 @@ void Chuck_Instr_Reg_Push_Global::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
         {
             // int pointer to registers
             t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
-            t_CKUINT val = (t_CKUINT) vm->globals_manager()->get_global_int_value( m_name );
+            t_CKUINT val = *(t_CKUINT *)m_addr.get( vm, m_name, m_type );
 
             // push global map content into int-reg stack
             push_( reg_sp, val );
@@ -2725,7 +2777,7 @@ void Chuck_Instr_Reg_Push_Global::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
         {
             // float pointer to registers
             t_CKFLOAT *& reg_sp = (t_CKFLOAT *&)shred->reg->sp;
-            t_CKFLOAT val = (t_CKFLOAT) vm->globals_manager()->get_global_float_value( m_name );
+            t_CKFLOAT val = *(t_CKFLOAT *)m_addr.get( vm, m_name, m_type );
 
             // push global map content into float-reg stack
             push_( reg_sp, val );
@@ -2735,7 +2787,7 @@ void Chuck_Instr_Reg_Push_Global::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
         {
             // pointer to registers
             t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
-            t_CKUINT val = (t_CKUINT) vm->globals_manager()->get_global_string( m_name );
+            t_CKUINT val = *(t_CKUINT *)m_addr.get( vm, m_name, m_type );
 
             // push global map content into string-reg stack
             push_( reg_sp, val );
@@ -2744,7 +2796,7 @@ void Chuck_Instr_Reg_Push_Global::execute( Chuck_VM * vm, Chuck_VM_Shred * shred
         case te_globalEvent:
         {
             t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
-            t_CKUINT val = (t_CKUINT) vm->globals_manager()->get_global_event( m_name );
+            t_CKUINT val = *(t_CKUINT *)m_addr.get( vm, m_name, m_type );
 
             // push global map content into event-reg stack
             push_( reg_sp, val );
@@ -2840,43 +2892,73 @@ void Chuck_Instr_Reg_Push_Mem_Addr::execute( Chuck_VM * vm, Chuck_VM_Shred * shr
 
 
 //-----------------------------------------------------------------------------
-// name: execute()
-// desc: ...
+// name: get() | 1.5.5.3 (added)
+// desc: address of a global's storage; the containers behind these stay put
+//       until cleanup_global_variables(), which bumps the generation
 //-----------------------------------------------------------------------------
-void Chuck_Instr_Reg_Push_Global_Addr::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+t_CKUINT Chuck_Global_Addr_Cache::get( Chuck_VM * vm, const std::string & name, te_GlobalType type )
 {
-    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    Chuck_Globals_Manager * globals = vm->globals_manager();
+    // still good?
+    if( generation == globals->generation() ) return addr;
 
     // find addr
-    t_CKUINT addr = 0;
-    switch( m_type ) {
+    addr = 0;
+    switch( type ) {
         case te_globalInt:
-            addr = (t_CKUINT) vm->globals_manager()->get_ptr_to_global_int( m_name );
+            // ensure exists
+            globals->init_global_int( name );
+            addr = (t_CKUINT) globals->get_ptr_to_global_int( name );
             break;
         case te_globalFloat:
-            addr = (t_CKUINT) vm->globals_manager()->get_ptr_to_global_float( m_name );
+            // ensure exists
+            globals->init_global_float( name );
+            addr = (t_CKUINT) globals->get_ptr_to_global_float( name );
             break;
         case te_globalString:
-            addr = (t_CKUINT) vm->globals_manager()->get_ptr_to_global_string( m_name );
+            // ensure exists
+            globals->init_global_string( name );
+            addr = (t_CKUINT) globals->get_ptr_to_global_string( name );
             break;
         case te_globalEvent:
             // TODO: should this be a * or a * * ?
-            addr = (t_CKUINT) vm->globals_manager()->get_ptr_to_global_event( m_name );
+            addr = (t_CKUINT) globals->get_ptr_to_global_event( name );
             break;
         case te_globalUGen:
-            addr = (t_CKUINT) vm->globals_manager()->get_ptr_to_global_ugen( m_name );
+            addr = (t_CKUINT) globals->get_ptr_to_global_ugen( name );
             break;
         case te_globalObject:
-            addr = (t_CKUINT) vm->globals_manager()->get_ptr_to_global_object( m_name );
+            addr = (t_CKUINT) globals->get_ptr_to_global_object( name );
             break;
         case te_globalArraySymbol:
-            addr = (t_CKUINT) vm->globals_manager()->get_ptr_to_global_array( m_name );
+            addr = (t_CKUINT) globals->get_ptr_to_global_array( name );
             break;
         default:
-            EM_error3( "Chuck_Instr_Reg_Push_Global_Addr: unrecognized type flag %d...", m_type );
-            break;
+            EM_error3( "Chuck_Instr_Reg_Push_Global_Addr: unrecognized type flag %d...", type );
+            // don't cache
+            return addr;
     }
 
+    // remember, if found (events, ugens, objects, and arrays may not exist
+    // yet, and are looked up again next time)
+    if( addr ) generation = globals->generation();
+    return addr;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: ...
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Reg_Push_Global_Addr::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+
+    // find addr (cached after the first lookup) | 1.5.5.3
+    t_CKUINT addr = m_addr.get( vm, m_name, m_type );
+
     // push mem stack addr into reg stack
     push_( reg_sp, addr );
 }
@@ -4391,6 +4473,21 @@ const char * Chuck_Instr_Pre_Constructor::params() const
 
 
 
+//-----------------------------------------------------------------------------
+// name: object_pool() | 1.5.5.3 added
+// desc: pool to allocate from when instantiating an object; objects are
+//       pooled only when instantiated by a shred running on the VM thread;
+//       others (e.g., static initializers run by the compiler thread) use
+//       the system allocator
+//-----------------------------------------------------------------------------
+static inline Chuck_VM_Pool * object_pool( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    return shred && vm && vm->pool() && vm->pool()->owned() ? vm->pool() : NULL;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: initialize_object()
 // desc: initialize Object including data and virtual table
@@ -4421,11 +4518,14 @@ t_CKBOOL initialize_object( Chuck_Object * object, Chuck_Type * type, Chuck_VM_S
     CK_SAFE_ADD_REF(object->type_ref);
     // get the size
     object->data_size = type->obj_size;
+    // note whether the object itself came from a VM pool | 1.5.5.3
+    object->m_pooled = Chuck_VM_Pool::pool_of( object ) != NULL;
     // allocate memory
     if( object->data_size )
     {
-        // check to ensure enough memory
-        object->data = new t_CKBYTE[object->data_size];
+        // check to ensure enough memory; data segment follows its object
+        // into the same pool (or the system allocator) | 1.5.5.3
+        object->data = (t_CKBYTE *)Chuck_VM_Pool::allocate( Chuck_VM_Pool::pool_of( object ), object->data_size );
         if( !object->data ) goto out_of_memory;
         // zero it out
         memset( object->data, 0, object->data_size );
@@ -4459,6 +4559,11 @@ t_CKBOOL initialize_object( Chuck_Object * object, Chuck_Type * type, Chuck_VM_S
         if( type->ugen_info->tick ) ugen->tick = type->ugen_info->tick;
         // added 1.3.0.0 -- tickf for multi-channel tick
         if( type->ugen_info->tickf ) ugen->tickf = type->ugen_info->tickf;
+        // added 1.5.5.3 -- tickv for block (adaptive) tick
+        if( type->ugen_info->tickv ) ugen->tickv = type->ugen_info->tickv;
+        if( type->ugen_info->tickvn ) ugen->tickvn = type->ugen_info->tickvn;
+        ugen->m_serial = type->ugen_info->serial;
+        ugen->m_threadsafe = type->ugen_info->threadsafe;
         if( type->ugen_info->pmsg ) ugen->pmsg = type->ugen_info->pmsg;
         // TODO: another hack!
         if( type->ugen_info->tock ) ((Chuck_UAna *)ugen)->tock = type->ugen_info->tock;
@@ -4560,8 +4665,8 @@ Chuck_Object * instantiate_and_initialize_object( Chuck_Type * type, Chuck_VM_Sh
         if( type->allocator )
             object = type->allocator( vm, shred, Chuck_DL_Api::instance() );
         else if( isa( type, vm->env()->ckt_fileio ) ) object = new Chuck_IO_File( vm );
-        else if( isa( type, vm->env()->ckt_event ) ) object = new Chuck_Event;
-        else if( isa( type, vm->env()->ckt_string ) ) object = new Chuck_String;
+        else if( isa( type, vm->env()->ckt_event ) ) object = new( object_pool( vm, shred ) ) Chuck_Event;
+        else if( isa( type, vm->env()->ckt_string ) ) object = new( object_pool( vm, shred ) ) Chuck_String;
         // TODO: is this ok?
         else if( isa( type, vm->env()->ckt_shred ) )
         {
@@ -4581,7 +4686,7 @@ Chuck_Object * instantiate_and_initialize_object( Chuck_Type * type, Chuck_VM_Sh
         // 1.5.0.0 (ge) added -- here my feeble brain starts leaking out of my eyeballs
         else if( isa( type, vm->env()->ckt_class ) ) object = new Chuck_Type( vm->env(), te_class, type->base_name, type, type->size );
         // TODO: is this ok?
-        else object = new Chuck_Object;
+        else object = new( object_pool( vm, shred ) ) Chuck_Object;
     }
     else
     {
@@ -4706,6 +4811,45 @@ const char * Chuck_Instr_Instantiate_Object_Start::params() const
 
 
 
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: instantiate a non-escaping local Object (starting step) | 1.5.5.3
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Instantiate_Object_Scratch::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    t_CKUINT *& reg_sp = (t_CKUINT *&)shred->reg->sp;
+    // this shred's scratch object for this instruction
+    Chuck_Object *& scratch = shred->m_scratch[this];
+
+    // left over from a freed instruction at the same address?
+    if( scratch && scratch->type_ref != this->type ) CK_SAFE_RELEASE( scratch );
+
+    // reuse it if only the shred refers to it
+    if( scratch && scratch->m_ref_count == 1 )
+    {
+        // back to a freshly instantiated state; the pre-constructors follow
+        if( scratch->data_size ) memset( scratch->data, 0, scratch->data_size );
+        // push, with the temporary reference (as instantiate_object() does)
+        push_( reg_sp, (t_CKUINT)scratch );
+        scratch->add_ref();
+        // count
+        vm->pool()->avoided();
+        return;
+    }
+
+    // instantiate a fresh one
+    instantiate_object( vm, shred, this->type, TRUE );
+    // keep the first one for next time
+    if( !scratch && !shred->is_done )
+    {
+        scratch = (Chuck_Object *)(*(reg_sp-1));
+        scratch->add_ref();
+    }
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: execute()
 // desc: complete the process of instantiating an Object | 1.5.4.3 (ge) added
@@ -5444,6 +5588,26 @@ const char * Chuck_Instr_Func_Call_Member::params() const
 
 
 
+//-----------------------------------------------------------------------------
+// name: prepare() | 1.5.5.3 (added)
+// desc: work out once what the native fast path has to do around the call
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Func_Call_Member::prepare( Chuck_VM * vm )
+{
+    m_prepared = TRUE;
+    if( !m_func_ref ) return;
+
+    // same tests as the generic path / func_release_args()
+    m_returns_obj = m_val == kindof_INT && isobj( vm->env(), m_func_ref->def()->ret_type );
+    for( a_Arg_List arg = m_func_ref->def()->arg_list; arg; arg = arg->next )
+        if( arg->type && isobj( vm->env(), arg->type ) ) { m_release_args = TRUE; break; }
+    // may change what the ugen's tick would do
+    m_wakes_ugen = Chuck_UGen::wakes( m_func_ref, vm );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: execute()
 // desc: imported member function call with return
@@ -5470,6 +5634,43 @@ void Chuck_Instr_Func_Call_Member::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
     // UNUSED: t_CKUINT prev_stack = ( *(mem_sp-1) >> 2 ) + ( *(mem_sp-1) & 0x3 ? 1 : 0 );
     // the amount to push in 4-byte words
     t_CKUINT push = local_depth;
+
+    // native member function: call it directly on the operand stack, where
+    // 'this' and the args already sit contiguously | 1.5.5.3
+    if( func->native_func_kind == ae_fp_mfun && stack_depth && m_func_ref &&
+        !m_special_primitive_cleanup_this )
+    {
+        if( !m_prepared ) prepare( vm );
+        // pop this + args
+        reg_sp -= stack_depth;
+        // 'this' at either end of the block
+        Chuck_Object * self = NULL;
+        t_CKUINT * args = reg_sp;
+        if( m_arg_convention == CK_FUNC_CALL_THIS_IN_BACK ) self = (Chuck_Object *)reg_sp[stack_depth-1];
+        else { self = (Chuck_Object *)reg_sp[0]; args++; }
+        // call the function
+        f_mfun f = (f_mfun)func->native_func;
+        f( self, args, &retval, vm, shred, Chuck_DL_Api::instance() );
+        if( m_wakes_ugen && self ) ((Chuck_UGen *)self)->wake();
+
+        // the args are released before the return value overwrites them on
+        // the stack, so take hold of a returned object (maybe an arg) first
+        if( m_returns_obj && retval.v_uint ) ((Chuck_VM_Object *)retval.v_uint)->add_ref();
+        if( m_release_args ) func_release_args( vm, m_func_ref->def()->arg_list, (t_CKBYTE *)args );
+
+        // push the return
+        switch( m_val )
+        {
+            case kindof_INT: push_( reg_sp, retval.v_uint ); break;
+            case kindof_FLOAT: { t_CKFLOAT *& sp = (t_CKFLOAT *&)reg_sp; push_( sp, retval.v_float ); } break;
+            case kindof_VEC2: { t_CKVEC2 *& sp = (t_CKVEC2 *&)reg_sp; push_( sp, retval.v_vec2 ); } break;
+            case kindof_VEC3: { t_CKVEC3 *& sp = (t_CKVEC3 *&)reg_sp; push_( sp, retval.v_vec3 ); } break;
+            case kindof_VEC4: { t_CKVEC4 *& sp = (t_CKVEC4 *&)reg_sp; push_( sp, retval.v_vec4 ); } break;
+            default: break;
+        }
+        return;
+    }
+
     // push the mem stack passed the current function variables and arguments
     mem_sp += push;
 
@@ -5528,6 +5729,9 @@ void Chuck_Instr_Func_Call_Member::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         f_mfun f = (f_mfun)func->native_func;
         // call the function (added 1.3.0.0 -- Chuck_DL_Api::instance())
         f( (Chuck_Object *)(*mem_sp), mem_sp + 1, &retval, vm, shred, Chuck_DL_Api::instance() );
+        // wake the ugen, if dormant | 1.5.5.3
+        if( !m_prepared ) prepare( vm );
+        if( m_wakes_ugen && ckTHIS ) ((Chuck_UGen *)ckTHIS)->wake();
     }
 
     // push the return
@@ -6385,7 +6589,7 @@ void Chuck_Instr_Time_Advance::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
     // shred->gc_inc( ck_max((*sp)-shred->now,1) );
 
     // track time advance
-    CK_TRACK( Chuck_Stats::instance()->advance_time( shred, *sp ) );
+    CK_TRACK( vm->stats()->advance_time( shred, *sp ) );
 
     // push time value on stack
     push_( sp, *sp );
@@ -6515,7 +6719,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length );
         // instantiate array
-        Chuck_ArrayInt * array = new Chuck_ArrayInt( m_is_obj, m_length );
+        Chuck_ArrayInt * array = new( object_pool( vm, shred ) ) Chuck_ArrayInt( m_is_obj, m_length );
         // problem
         if( !array ) goto out_of_memory;
 
@@ -6538,7 +6742,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length * (sz_FLOAT / sz_INT) ); // 1.3.1.0 added size division
         // instantiate array
-        Chuck_ArrayFloat * array = new Chuck_ArrayFloat( m_length );
+        Chuck_ArrayFloat * array = new( object_pool( vm, shred ) ) Chuck_ArrayFloat( m_length );
         // problem
         if( !array ) goto out_of_memory;
         // fill array
@@ -6558,7 +6762,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length * (sz_VEC2 / sz_INT) ); // 1.3.1.0 added size division
         // instantiate array
-        Chuck_ArrayVec2 * array = new Chuck_ArrayVec2( m_length );
+        Chuck_ArrayVec2 * array = new( object_pool( vm, shred ) ) Chuck_ArrayVec2( m_length );
         // problem
         if( !array ) goto out_of_memory;
         // fill array
@@ -6580,7 +6784,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length * (sz_VEC3 / sz_INT) );
         // instantiate array
-        Chuck_ArrayVec3 * array = new Chuck_ArrayVec3( m_length );
+        Chuck_ArrayVec3 * array = new( object_pool( vm, shred ) ) Chuck_ArrayVec3( m_length );
         // problem
         if( !array ) goto out_of_memory;
         // fill array
@@ -6600,7 +6804,7 @@ void Chuck_Instr_Array_Init_Literal::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
         // pop the values
         pop_( reg_sp, m_length * (sz_VEC4 / sz_INT) );
         // instantiate array
-        Chuck_ArrayVec4 * array = new Chuck_ArrayVec4( m_length );
+        Chuck_ArrayVec4 * array = new( object_pool( vm, shred ) ) Chuck_ArrayVec4( m_length );
         // problem
         if( !array ) goto out_of_memory;
         // fill array
@@ -6733,7 +6937,7 @@ Chuck_Object * do_alloc_array(
         // 1.3.1.0: look at type to use kind instead of size
         if( kind == kindof_INT ) // ISSUE: 64-bit (fixed 1.3.1.0)
         {
-            Chuck_ArrayInt * baseX = new Chuck_ArrayInt( is_obj, *capacity );
+            Chuck_ArrayInt * baseX = new( object_pool( vm, shred ) ) Chuck_ArrayInt( is_obj, *capacity );
             if( !baseX ) goto out_of_memory;
 
             // if object
@@ -6756,7 +6960,7 @@ Chuck_Object * do_alloc_array(
         }
         else if( kind == kindof_FLOAT ) // ISSUE: 64-bit (fixed 1.3.1.0)
         {
-            Chuck_ArrayFloat * baseX = new Chuck_ArrayFloat( *capacity );
+            Chuck_ArrayFloat * baseX = new( object_pool( vm, shred ) ) Chuck_ArrayFloat( *capacity );
             if( !baseX ) goto out_of_memory;
 
             // initialize object | 1.5.0.0 (ge) use array type instead of base t_array
@@ -6767,7 +6971,7 @@ Chuck_Object * do_alloc_array(
         }
         else if( kind == kindof_VEC2 ) // ISSUE: 64-bit (fixed 1.3.1.0) | 1.5.1.7 (ge) complex -> vec2
         {
-            Chuck_ArrayVec2 * baseX = new Chuck_ArrayVec2( *capacity );
+            Chuck_ArrayVec2 * baseX = new( object_pool( vm, shred ) ) Chuck_ArrayVec2( *capacity );
             if( !baseX ) goto out_of_memory;
 
             // check array type
@@ -6783,7 +6987,7 @@ Chuck_Object * do_alloc_array(
         }
         else if( kind == kindof_VEC3 ) // 1.3.5.3
         {
-            Chuck_ArrayVec3 * baseX = new Chuck_ArrayVec3( *capacity );
+            Chuck_ArrayVec3 * baseX = new( object_pool( vm, shred ) ) Chuck_ArrayVec3( *capacity );
             if( !baseX ) goto out_of_memory;
 
             // initialize object | 1.5.0.0 (ge) use array type instead of base t_array
@@ -6794,7 +6998,7 @@ Chuck_Object * do_alloc_array(
         }
         else if( kind == kindof_VEC4 ) // 1.3.5.3
         {
-            Chuck_ArrayVec4* baseX = new Chuck_ArrayVec4( *capacity );
+            Chuck_ArrayVec4* baseX = new( object_pool( vm, shred ) ) Chuck_ArrayVec4( *capacity );
             if( !baseX ) goto out_of_memory;
 
             // initialize object | 1.5.0.0 (ge) use array type instead of base t_array
@@ -6809,7 +7013,7 @@ Chuck_Object * do_alloc_array(
     }
 
     // not top level
-    theBase = new Chuck_ArrayInt( TRUE, *capacity );
+    theBase = new( object_pool( vm, shred ) ) Chuck_ArrayInt( TRUE, *capacity );
     if( !theBase ) goto out_of_memory;
 
     // construct type for next array level | 1.5.0.0 (ge) added
@@ -7223,14 +7427,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            arr->get( key->str(), &val );
+            arr->get( key->str(), &val, key->hash() );
             // push the value
             push_( sp, val );
         }
@@ -7244,14 +7448,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            arr->get( key->str(), &fval );
+            arr->get( key->str(), &fval, key->hash() );
             // push the value
             push_( ((t_CKFLOAT *&)sp), fval );
         }
@@ -7265,14 +7469,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            arr->get( key->str(), &v2 );
+            arr->get( key->str(), &v2, key->hash() );
             // push the value
             push_( ((t_CKVEC2 *&)sp), v2 );
         }
@@ -7286,14 +7490,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            arr->get( key->str(), &v3 );
+            arr->get( key->str(), &v3, key->hash() );
             // push the value
             push_( ((t_CKVEC3 *&)sp), v3 );
         }
@@ -7307,14 +7511,14 @@ void Chuck_Instr_Array_Map_Access::execute( Chuck_VM * vm, Chuck_VM_Shred * shre
         // check if writing
         if( m_emit_addr ) {
             // get the addr
-            val = arr->addr( key->str() );
+            val = arr->addr( key->str(), key->hash() );
             // exception
             if( !val ) goto error;
             // push the addr
             push_( sp, val );
         } else {
             // get the value
-            arr->get( key->str(), &v4 );
+            arr->get( key->str(), &v4, key->hash() );
             // push the value
             push_( ((t_CKVEC4 *&)sp), v4 );
         }
@@ -7387,7 +7591,7 @@ void Chuck_Instr_Array_Access_Multi::execute( Chuck_VM * vm, Chuck_VM_Shred * sh
             // get index
             Chuck_String * key = (Chuck_String *)(i);
             // get the array
-            if( !base->get( key->str(), &val ) )
+            if( !base->get( key->str(), &val, key->hash() ) )
                 goto array_out_of_bound;
         }
         else
@@ -7758,6 +7962,45 @@ error:
 
 
 
+//-----------------------------------------------------------------------------
+// name: execute()
+// desc: member function lookup for a call | 1.5.5.3
+//-----------------------------------------------------------------------------
+void Chuck_Instr_Dot_Member_Func_Call::execute( Chuck_VM * vm, Chuck_VM_Shred * shred )
+{
+    // register stack pointer
+    t_CKUINT *& sp = (t_CKUINT *&)shred->reg->sp;
+    // the object pointer stays on the stack as 'this'
+    Chuck_Object * obj = (Chuck_Object *)*(sp-1);
+    Chuck_Func * func = NULL;
+
+    // check
+    if( !obj ) goto error;
+
+    // make sure we are in range
+    assert( m_offset < obj->vtable->funcs.size() );
+    // get the function from the object's virtual table
+    func = obj->vtable->funcs[m_offset];
+
+    // push the function or its code
+    push_( sp, m_push_code ? (t_CKUINT)func->code : (t_CKUINT)func );
+
+    return;
+
+error:
+    // we have a problem
+    EM_exception(
+        "NullPointer: on line[%lu] in shred[id=%lu:%s]",
+        m_linepos, shred->xid, shred->name.c_str() );
+
+    // do something!
+    shred->is_running = FALSE;
+    shred->is_done = TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: execute()
 // desc: primitive func, 1.3.5.3
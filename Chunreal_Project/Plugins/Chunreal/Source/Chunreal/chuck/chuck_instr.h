@@ -44,10 +44,17 @@ struct Chuck_VM;
 struct Chuck_VM_Shred;
 struct Chuck_Type;
 struct Chuck_Func;
+// bytecode serializer (see chuck_bytecode.h); befriended by instructions
+// whose operands are protected | 1.5.5.3 (added)
+struct Chuck_Bytecode_Codec;
 
 // 1.4.2.0 (ge) | added for switching from snprintf()
 #define CK_PRINT_BUF_LENGTH 256
 
+// declare the class name of an instruction; every concrete instruction
+// class needs its own, or it reports its parent's (see opcode()) | 1.5.5.3
+#define CK_INSTR_OPCODE( x ) virtual const char * opcode() const { return #x; }
+
 
 
 
@@ -68,6 +75,10 @@ public:
     virtual const char * name() const;
     virtual const char * params() const
     { return ""; }
+    // class name, declared by each instruction class with CK_INSTR_OPCODE();
+    // works without run time type information | 1.5.5.3 (added)
+    virtual const char * opcode() const
+    { return NULL; }
 
 public:
     // store line position for error messages
@@ -95,6 +106,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Op : public Chuck_Instr
 {
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Branch_Op() : m_jmp(0) { }
     inline void set( t_CKUINT jmp ) { m_jmp = jmp; }
@@ -116,6 +128,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Unary_Op : public Chuck_Instr
 {
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Unary_Op() : m_val(0) { }
     inline void set( t_CKUINT val ) { m_val = val; }
@@ -138,6 +151,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Unary_Op2 : public Chuck_Instr
 {
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Unary_Op2() : m_val(0) { }
     inline void set( t_CKFLOAT val ) { m_val = val; }
@@ -170,6 +184,7 @@ struct Chuck_Instr_Binary_Op : public Chuck_Instr
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -183,6 +198,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_PreInc_int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_PreInc_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -196,6 +212,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_PostInc_int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_PostInc_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -209,6 +226,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_PreDec_int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_PreDec_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -222,6 +240,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_PostDec_int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_PostDec_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -235,6 +254,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dec_int_Addr : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dec_int_Addr )
 public:
     Chuck_Instr_Dec_int_Addr( t_CKUINT src )
     { this->set( src ); }
@@ -252,6 +272,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Complement_int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Complement_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -265,6 +286,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mod_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mod_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -278,6 +300,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mod_int_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mod_int_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -291,6 +314,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -304,6 +328,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_int_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_int_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -317,6 +342,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Times_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Times_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -330,6 +356,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -343,6 +370,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_int_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_int_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -356,6 +384,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -369,6 +398,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -382,6 +412,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_double_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_double_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -395,6 +426,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Times_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Times_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -408,6 +440,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -421,6 +454,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_double_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_double_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -434,6 +468,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mod_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mod_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -447,6 +482,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mod_double_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mod_double_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -460,6 +496,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_complex : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -473,6 +510,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_complex : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -486,6 +524,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_complex_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_complex_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -499,6 +538,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Times_complex : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Times_complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -512,6 +552,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_complex : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -525,6 +566,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_complex_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_complex_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -538,6 +580,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_polar : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_polar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -551,6 +594,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_polar : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_polar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -564,6 +608,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_polar_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_polar_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -577,6 +622,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Times_polar : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Times_polar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -590,6 +636,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_polar : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_polar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -603,6 +650,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_polar_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_polar_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -616,6 +664,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_vec2 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_vec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -629,6 +678,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_vec2 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_vec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -642,6 +692,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_float_Times_vec2 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_float_Times_vec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -655,6 +706,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec2_Times_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec2_Times_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -668,6 +720,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec2_Divide_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec2_Divide_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -681,6 +734,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_vec3 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_vec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -694,6 +748,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_vec3 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_vec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -707,6 +762,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_XProduct_vec3 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_XProduct_vec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -720,6 +776,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_vec4 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_vec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -733,6 +790,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_vec4 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_vec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -746,6 +804,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_XProduct_vec4 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_XProduct_vec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -759,6 +818,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_float_Times_vec3 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_float_Times_vec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -772,6 +832,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec3_Times_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec3_Times_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -785,6 +846,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec3_Divide_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec3_Divide_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -798,6 +860,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_float_Times_vec4 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_float_Times_vec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -811,6 +874,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec4_Times_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec4_Times_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -824,6 +888,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec4_Divide_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec4_Divide_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -837,6 +902,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_int_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_int_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -850,6 +916,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mod_int_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mod_int_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -863,6 +930,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_int_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_int_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -876,6 +944,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Times_int_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Times_int_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -889,6 +958,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_int_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_int_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -902,6 +972,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_double_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_double_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -915,6 +986,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_double_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_double_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -928,6 +1000,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Times_double_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Times_double_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -941,6 +1014,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_double_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_double_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -954,6 +1028,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mod_double_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mod_double_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -967,6 +1042,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_complex_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_complex_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -980,6 +1056,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_complex_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_complex_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -993,6 +1070,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Times_complex_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Times_complex_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1006,6 +1084,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_complex_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_complex_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1019,6 +1098,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_polar_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_polar_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1032,6 +1112,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_polar_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_polar_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1045,6 +1126,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Times_polar_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Times_polar_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1058,6 +1140,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Divide_polar_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Divide_polar_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1071,6 +1154,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_vec2_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_vec2_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1084,6 +1168,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_vec2_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_vec2_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1097,6 +1182,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_vec3_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_vec3_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1110,6 +1196,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_vec3_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_vec3_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1136,6 +1223,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_vec4_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_vec4_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1149,6 +1237,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Minus_vec4_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Minus_vec4_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1175,6 +1264,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_float_Times_vec2_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_float_Times_vec2_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1188,6 +1278,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_float_Times_vec3_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_float_Times_vec3_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1201,6 +1292,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_float_Times_vec4_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_float_Times_vec4_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1214,6 +1306,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec2_Divide_float_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec2_Divide_float_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1226,6 +1319,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec3_Divide_float_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec3_Divide_float_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1239,6 +1333,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_vec4_Divide_float_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_vec4_Divide_float_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1267,7 +1362,26 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_string_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_string_Assign )
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Add_string_Temp | 1.5.5.3 added
+// desc: string + (string|int|float) where the left operand is a string
+//       temporary that nothing else refers to (see chuck_escape.h); appends
+//       in place and pushes the same string; m_val is the right operand's
+//       te_Type (te_string, te_int, or te_float)
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Add_string_Temp : public Chuck_Instr_Unary_Op
+{
+    CK_INSTR_OPCODE( Chuck_Instr_Add_string_Temp )
 public:
+    Chuck_Instr_Add_string_Temp( t_CKUINT kind ) { this->set( kind ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
 
@@ -1280,6 +1394,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_string_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_string_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1293,6 +1408,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_string_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_string_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1306,6 +1422,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_int_string : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_int_string )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1319,6 +1436,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_float_string : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_float_string )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1332,6 +1450,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_int_string_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_int_string_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1345,6 +1464,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Add_float_string_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Add_float_string_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1358,6 +1478,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Lt_int : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Lt_int )
 public:
     Chuck_Instr_Branch_Lt_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1372,6 +1493,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Gt_int : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Gt_int )
 public:
     Chuck_Instr_Branch_Gt_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1386,6 +1508,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Le_int : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Le_int )
 public:
     Chuck_Instr_Branch_Le_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1400,6 +1523,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Ge_int : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Ge_int )
 public:
     Chuck_Instr_Branch_Ge_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1414,6 +1538,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Eq_int : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Eq_int )
 public:
     Chuck_Instr_Branch_Eq_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1428,6 +1553,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Neq_int : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Neq_int )
 public:
     Chuck_Instr_Branch_Neq_int( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1442,6 +1568,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Lt_double : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Lt_double )
 public:
     Chuck_Instr_Branch_Lt_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1456,6 +1583,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Gt_double : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Gt_double )
 public:
     Chuck_Instr_Branch_Gt_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1470,6 +1598,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Le_double : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Le_double )
 public:
     Chuck_Instr_Branch_Le_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1484,6 +1613,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Ge_double : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Ge_double )
 public:
     Chuck_Instr_Branch_Ge_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1498,6 +1628,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Eq_double : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Eq_double )
 public:
     Chuck_Instr_Branch_Eq_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1512,6 +1643,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Neq_double : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Neq_double )
 public:
     Chuck_Instr_Branch_Neq_double( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1526,6 +1658,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Eq_int_IO_good : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Eq_int_IO_good )
 public:
     Chuck_Instr_Branch_Eq_int_IO_good( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1540,6 +1673,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Branch_Neq_int_IO_good : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Branch_Neq_int_IO_good )
 public:
     Chuck_Instr_Branch_Neq_int_IO_good( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -1554,6 +1688,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Lt_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Lt_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1567,6 +1702,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Gt_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Gt_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1580,6 +1716,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Le_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Le_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1593,6 +1730,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Ge_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Ge_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1606,6 +1744,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Eq_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Eq_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1619,6 +1758,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Neq_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Neq_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1632,6 +1772,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Not_int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Not_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1645,6 +1786,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Negate_int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Negate_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1658,6 +1800,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Negate_double : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Negate_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1671,6 +1814,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Lt_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Lt_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1684,6 +1828,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Gt_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Gt_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1697,6 +1842,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Le_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Le_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1710,6 +1856,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Ge_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Ge_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1723,6 +1870,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Eq_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Eq_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1736,6 +1884,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Neq_double : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Neq_double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1749,6 +1898,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Eq_complex : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Eq_complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1762,6 +1912,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Neq_complex : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Neq_complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1775,6 +1926,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Eq_vec2 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Eq_vec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1788,6 +1940,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Neq_vec2 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Neq_vec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1801,6 +1954,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Eq_vec3 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Eq_vec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1814,6 +1968,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Neq_vec3 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Neq_vec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1827,6 +1982,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Eq_vec4 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Eq_vec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1840,6 +1996,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Neq_vec4 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Neq_vec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1853,6 +2010,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_And : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_And )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1866,6 +2024,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Or : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Or )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1879,6 +2038,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Xor : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Xor )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1892,6 +2052,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Shift_Right : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Shift_Right )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1905,6 +2066,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Shift_Right_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Shift_Right_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1918,6 +2080,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Shift_Left : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Shift_Left )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1931,6 +2094,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Shift_Left_Reverse : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Shift_Left_Reverse )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1944,6 +2108,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_And_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_And_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1957,6 +2122,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Or_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Or_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1970,6 +2136,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Xor_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Xor_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1983,6 +2150,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Shift_Right_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Shift_Right_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -1996,6 +2164,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Binary_Shift_Left_Assign : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Binary_Shift_Left_Assign )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2009,6 +2178,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_And : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_And )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2022,6 +2192,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Or : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Or )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2035,6 +2206,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Goto : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Goto )
 public:
     Chuck_Instr_Goto( t_CKUINT jmp ) { this->set( jmp ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -2049,6 +2221,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_Int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_Int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2062,6 +2235,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_Float : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_Float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2075,6 +2249,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_Vec2ComplexPolar : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_Vec2ComplexPolar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2088,6 +2263,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_Vec2 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_Vec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2101,6 +2277,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_Vec3 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_Vec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2114,6 +2291,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_Vec4 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_Vec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2127,6 +2305,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_WordsMulti : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_WordsMulti )
 public:
     Chuck_Instr_Reg_Pop_WordsMulti( t_CKUINT num ) { this->set( num ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -2141,6 +2320,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_Mem: public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_Mem )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2154,6 +2334,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Pop_Mem2: public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Pop_Mem2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2161,18 +2342,41 @@ public:
 
 
 
+//-----------------------------------------------------------------------------
+// name: enum te_ImmKind | 1.5.5.3 (added)
+// desc: what an immediate pushed by Chuck_Instr_Reg_Push_Imm refers to;
+//       anything other than a plain value is a pointer that the bytecode
+//       serializer must translate into a symbolic reference
+//-----------------------------------------------------------------------------
+enum te_ImmKind
+{
+    te_immValue = 0, // int, char, etc.
+    te_immType,      // Chuck_Type *
+    te_immFunc,      // Chuck_Func *
+    te_immCode,      // Chuck_VM_Code * (e.g., spork~ stub)
+    te_immString     // Chuck_String * (string literal)
+};
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: struct Chuck_Instr_Reg_Push_Imm
 // desc: push immediate to reg stack
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Imm : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Imm )
 public:
-    Chuck_Instr_Reg_Push_Imm( t_CKUINT val )
-    { this->set( val ); }
+    Chuck_Instr_Reg_Push_Imm( t_CKUINT val, te_ImmKind kind = te_immValue )
+    { this->set( val ); m_kind = kind; }
 
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+
+public:
+    // what the immediate refers to | 1.5.5.3 (added)
+    te_ImmKind m_kind;
 };
 
 
@@ -2184,6 +2388,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Imm2 : public Chuck_Instr_Unary_Op2
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Imm2 )
 public:
     Chuck_Instr_Reg_Push_Imm2( t_CKFLOAT val )
     { this->set( val ); }
@@ -2201,6 +2406,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Imm4 : public Chuck_Instr_Unary_Op2
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Imm4 )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Reg_Push_Imm4( t_CKFLOAT x, t_CKFLOAT y )
     { this->set( x ); m_val2 = y; }
@@ -2221,6 +2428,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Code : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Code )
 public:
     // for carrying out instruction
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -2245,6 +2453,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Zero : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Zero )
 public:
     Chuck_Instr_Reg_Push_Zero( t_CKUINT sizeInBytes )
     { this->set( sizeInBytes ); }
@@ -2262,6 +2471,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Dup_Last : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Dup_Last )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2275,6 +2485,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Dup_Last2 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Dup_Last2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2288,6 +2499,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Transmute_Value_To_Pointer : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Transmute_Value_To_Pointer )
 public:
     Chuck_Instr_Reg_Transmute_Value_To_Pointer( t_CKUINT sizeInBytes )
     { this->set( sizeInBytes ); }
@@ -2303,6 +2515,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Now : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Now )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2316,6 +2529,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Me : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Me )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2329,6 +2543,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_This : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_This )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2342,6 +2557,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Start : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Start )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2355,6 +2571,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Maybe : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Maybe )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2368,6 +2585,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Mem : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Mem )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Reg_Push_Mem( t_CKUINT src, t_CKBOOL use_base = FALSE )
     { this->set( src ); base = use_base; }
@@ -2393,6 +2612,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Mem2 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Mem2 )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Reg_Push_Mem2( t_CKUINT src, t_CKBOOL use_base = FALSE )
     { this->set( src ); base = use_base; }
@@ -2418,6 +2639,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Mem4 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Mem4 )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Reg_Push_Mem4( t_CKUINT src, t_CKBOOL use_base = FALSE )
     { this->set( src ); base = use_base; }
@@ -2443,6 +2666,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Mem_Vec3 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Mem_Vec3 )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Reg_Push_Mem_Vec3( t_CKUINT src, t_CKBOOL use_base = FALSE )
     { this->set( src ); base = use_base; }
@@ -2468,6 +2693,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Mem_Vec4 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Mem_Vec4 )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Reg_Push_Mem_Vec4( t_CKUINT src, t_CKBOOL use_base = FALSE )
     { this->set( src ); base = use_base; }
@@ -2487,12 +2714,32 @@ protected:
 
 
 
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Global_Addr_Cache | 1.5.5.3 (added)
+// desc: a global variable's storage address, looked up by name on first use
+//       and kept until the VM's global storage is torn down (see
+//       Chuck_Globals_Manager::generation())
+//-----------------------------------------------------------------------------
+struct Chuck_Global_Addr_Cache
+{
+    Chuck_Global_Addr_Cache() : addr( 0 ), generation( 0 ) { }
+    // get the address, looking it up as needed
+    t_CKUINT get( Chuck_VM * vm, const std::string & name, te_GlobalType type );
+
+    t_CKUINT addr;
+    t_CKUINT generation;
+};
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: struct Chuck_Instr_Reg_Push_Global
 // desc: push a variable from global map to reg stack
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Global : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Global )
 public:
     Chuck_Instr_Reg_Push_Global( std::string name, te_GlobalType type )
     { this->set( 0 ); m_name = name; m_type = type; }
@@ -2507,6 +2754,8 @@ public:
 public:
     std::string m_name;
     te_GlobalType m_type;
+    // where the value lives (int/float/string/Event) | 1.5.5.3
+    Chuck_Global_Addr_Cache m_addr;
 };
 
 
@@ -2518,6 +2767,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Mem_Addr : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Mem_Addr )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Reg_Push_Mem_Addr( t_CKUINT src, t_CKBOOL use_base )
     { this->set( src ); base = use_base; }
@@ -2543,6 +2794,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Global_Addr : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Global_Addr )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Reg_Push_Global_Addr( std::string name, te_GlobalType type )
     { this->set( 0 ); m_name = name; m_type = type; }
@@ -2557,6 +2810,8 @@ public:
 protected:
     std::string m_name;
     te_GlobalType m_type;
+    // resolved address | 1.5.5.3
+    Chuck_Global_Addr_Cache m_addr;
 };
 
 
@@ -2569,6 +2824,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Deref : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Deref )
 public:
     Chuck_Instr_Reg_Push_Deref( t_CKUINT src )
     { this->set( src ); }
@@ -2586,6 +2842,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Deref2 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Deref2 )
 public:
     Chuck_Instr_Reg_Push_Deref2( t_CKUINT src )
     { this->set( src ); }
@@ -2603,6 +2860,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mem_Set_Imm : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mem_Set_Imm )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Mem_Set_Imm( t_CKUINT offset, t_CKUINT val )
     { m_offset = offset; m_val = val; }
@@ -2628,6 +2887,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mem_Set_Imm2 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mem_Set_Imm2 )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Mem_Set_Imm2( t_CKUINT offset, t_CKFLOAT val )
     { m_offset = offset; m_val = val; }
@@ -2653,6 +2914,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mem_Push_Imm : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mem_Push_Imm )
 public:
     Chuck_Instr_Mem_Push_Imm( t_CKUINT src )
     { this->set( src ); }
@@ -2669,6 +2931,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mem_Push_Imm2 : public Chuck_Instr_Unary_Op2
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mem_Push_Imm2 )
 public:
     Chuck_Instr_Mem_Push_Imm2( t_CKFLOAT src )
     { this->set( src ); }
@@ -2685,6 +2948,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mem_Pop_Word : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mem_Pop_Word )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2698,6 +2962,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mem_Pop_Word2 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mem_Pop_Word2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2711,6 +2976,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Mem_Pop_Word3 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Mem_Pop_Word3 )
 public:
     Chuck_Instr_Mem_Pop_Word3( t_CKUINT num ) { this->set( num ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -2725,6 +2991,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Nop : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Nop )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2738,6 +3005,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_EOC : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_EOC )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -2751,6 +3019,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Word : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Word )
 public:
     // (added 1.3.0.0 -- is_object)
     Chuck_Instr_Alloc_Word( t_CKUINT offset, t_CKBOOL is_object )
@@ -2771,6 +3040,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Word2 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Word2 )
 public:
     Chuck_Instr_Alloc_Word2( t_CKUINT offset )
     { this->set( offset ); }
@@ -2787,6 +3057,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Word4 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Word4 )
 public:
     Chuck_Instr_Alloc_Word4( t_CKUINT offset )
     { this->set( offset ); }
@@ -2803,6 +3074,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Vec3 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Vec3 )
 public:
     Chuck_Instr_Alloc_Vec3( t_CKUINT offset )
     { this->set( offset ); }
@@ -2819,6 +3091,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Vec4 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Vec4 )
 public:
     Chuck_Instr_Alloc_Vec4( t_CKUINT offset )
     { this->set( offset ); }
@@ -2835,6 +3108,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Member_Word : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Member_Word )
 public:
     Chuck_Instr_Alloc_Member_Word( t_CKUINT offset  )
     { this->set( offset ); }
@@ -2851,6 +3125,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Member_Word2 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Member_Word2 )
 public:
     Chuck_Instr_Alloc_Member_Word2( t_CKUINT offset  )
     { this->set( offset ); }
@@ -2867,6 +3142,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Member_Word4 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Member_Word4 )
 public:
     Chuck_Instr_Alloc_Member_Word4( t_CKUINT offset  )
     { this->set( offset ); }
@@ -2883,6 +3159,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Member_Vec3 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Member_Vec3 )
 public:
     Chuck_Instr_Alloc_Member_Vec3( t_CKUINT offset  )
     { this->set( offset ); }
@@ -2899,6 +3176,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Member_Vec4 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Member_Vec4 )
 public:
     Chuck_Instr_Alloc_Member_Vec4( t_CKUINT offset  )
     { this->set( offset ); }
@@ -2915,6 +3193,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Alloc_Word_Global : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Alloc_Word_Global )
 public:
     // (added 1.3.0.0 -- is_object)
     Chuck_Instr_Alloc_Word_Global()
@@ -2950,6 +3229,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Instantiate_Object_Start : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Instantiate_Object_Start )
 public:
     Chuck_Instr_Instantiate_Object_Start( Chuck_Type * t )
     { this->type = t; }
@@ -2964,12 +3244,32 @@ public:
 
 
 
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Instantiate_Object_Scratch | 1.5.5.3 added
+// desc: instantiate a non-escaping local object (see chuck_escape.h);
+//       reuses the shred's scratch object for this instruction, zeroed,
+//       if nothing else refers to it, otherwise same as the starting step
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Instantiate_Object_Scratch : public Chuck_Instr_Instantiate_Object_Start
+{
+    CK_INSTR_OPCODE( Chuck_Instr_Instantiate_Object_Scratch )
+public:
+    Chuck_Instr_Instantiate_Object_Scratch( Chuck_Type * t )
+        : Chuck_Instr_Instantiate_Object_Start( t ) { }
+
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+};
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: struct Chuck_Instr_Instantiate_Object_Complete | 1.5.4.3 (ge) added
 // desc: instantiate object (completing step); leaves reference value on operand stack
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Instantiate_Object_Complete : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Instantiate_Object_Complete )
 public:
     Chuck_Instr_Instantiate_Object_Complete( Chuck_Type * t )
     { this->type = t; }
@@ -2990,6 +3290,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Pre_Constructor : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Pre_Constructor )
 public:
     Chuck_Instr_Pre_Constructor( Chuck_VM_Code * pre, t_CKUINT offset )
     { pre_ctor = pre; this->stack_offset = offset; }
@@ -3011,6 +3312,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Pre_Ctor_Array_Top : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Pre_Ctor_Array_Top )
 public:
     Chuck_Instr_Pre_Ctor_Array_Top( Chuck_Type * t )
     { this->type = t; }
@@ -3031,6 +3333,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Pre_Ctor_Array_Bottom : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Pre_Ctor_Array_Bottom )
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
     // virtual const char * params() const;
 };
@@ -3044,6 +3347,7 @@ struct Chuck_Instr_Pre_Ctor_Array_Bottom : public Chuck_Instr_Unary_Op
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Pre_Ctor_Array_Post : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Pre_Ctor_Array_Post )
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
     // virtual const char * params() const;
 };
@@ -3057,6 +3361,7 @@ struct Chuck_Instr_Pre_Ctor_Array_Post : public Chuck_Instr
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Array_Prepend : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Array_Prepend )
     Chuck_Instr_Array_Prepend( t_CKUINT size ) { set( size ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
     // virtual const char * params() const;
@@ -3071,6 +3376,7 @@ struct Chuck_Instr_Array_Prepend : public Chuck_Instr_Unary_Op
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Array_Append : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Array_Append )
     Chuck_Instr_Array_Append( t_CKUINT size ) { set( size ); }
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
     // virtual const char * params() const;
@@ -3085,6 +3391,7 @@ struct Chuck_Instr_Array_Append : public Chuck_Instr_Unary_Op
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Assign_String : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Assign_String )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3098,6 +3405,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Assign_Primitive : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Assign_Primitive )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3111,6 +3419,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Assign_Primitive2 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Assign_Primitive2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3124,6 +3433,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Assign_Primitive4 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Assign_Primitive4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3137,6 +3447,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Assign_PrimitiveVec3 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Assign_PrimitiveVec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3150,6 +3461,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Assign_PrimitiveVec4 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Assign_PrimitiveVec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3163,6 +3475,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Assign_Object : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Assign_Object )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3176,6 +3489,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Assign_Object_To_Map : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Assign_Object_To_Map )
 public:
     Chuck_Instr_Assign_Object_To_Map( t_CKUINT size )
     { this->set( size ); }
@@ -3193,6 +3507,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_AddRef_Object : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_AddRef_Object )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3207,6 +3522,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_AddRef_Object2 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_AddRef_Object2 )
 public:
     Chuck_Instr_AddRef_Object2( t_CKUINT offset )
     { this->set( offset ); }
@@ -3225,6 +3541,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_AddRef_Object3 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_AddRef_Object3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3238,6 +3555,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Release_Object : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Release_Object )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3252,6 +3570,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Release_Object2 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Release_Object2 )
 public:
     Chuck_Instr_Release_Object2( t_CKUINT offset )
     { this->set( offset ); }
@@ -3270,6 +3589,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Release_Object3_Pop_Int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Release_Object3_Pop_Int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3284,6 +3604,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Release_Object4 : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Release_Object4 )
 public:
     Chuck_Instr_Release_Object4( t_CKUINT offset )
     { this->set( offset ); }
@@ -3301,6 +3622,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Func_To_Code : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Func_To_Code )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3325,6 +3647,7 @@ enum ck_Func_Call_Arg_Convention
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Func_Call : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Func_Call )
 public:
     // for carrying out instruction
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -3350,12 +3673,14 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Func_Call_Member : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Func_Call_Member )
 public:
     Chuck_Instr_Func_Call_Member( t_CKUINT ret_size, Chuck_Func * func_ref,
                                   ck_Func_Call_Arg_Convention arg_convention = CK_FUNC_CALL_THIS_IN_BACK,
                                   t_CKBOOL special_primitive_cleanup_this = FALSE )
     { this->set( ret_size ); m_func_ref = func_ref; m_arg_convention = arg_convention;
-      m_special_primitive_cleanup_this = special_primitive_cleanup_this; }
+      m_special_primitive_cleanup_this = special_primitive_cleanup_this;
+      m_prepared = FALSE; m_release_args = FALSE; m_returns_obj = FALSE; m_wakes_ugen = FALSE; }
 
 public:
     // for carrying out instruction
@@ -3372,6 +3697,17 @@ public:
     // 1.5.4.2 (ge) added only for special primitives that have "member" functions (vec2/3/4)
     // #special-primitive-member-func-from-literal
     t_CKBOOL m_special_primitive_cleanup_this;
+
+protected:
+    // native call fast path, set up on first execute | 1.5.5.3
+    void prepare( Chuck_VM * vm );
+    t_CKBOOL m_prepared;
+    // any args that are objects (to release after the call)
+    t_CKBOOL m_release_args;
+    // returns an object (to add_ref)
+    t_CKBOOL m_returns_obj;
+    // a UGen member; wakes the ugen if dormant (see CK_TICK_DORMANT)
+    t_CKBOOL m_wakes_ugen;
 };
 
 
@@ -3383,6 +3719,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Func_Call_Static : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Func_Call_Static )
 public:
     Chuck_Instr_Func_Call_Static( t_CKUINT ret_size, Chuck_Func * func_ref,
                                   ck_Func_Call_Arg_Convention arg_convention = CK_FUNC_CALL_THIS_IN_BACK )
@@ -3411,6 +3748,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Func_Call_Global : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Func_Call_Global )
 public:
     Chuck_Instr_Func_Call_Global( t_CKUINT ret_size, Chuck_Func * func_ref )
     { this->set( ret_size ); m_func_ref = func_ref; }
@@ -3435,6 +3773,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Func_Return : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Func_Return )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3461,6 +3800,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Stmt_Start : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Stmt_Start )
 public:
     // constructor
     Chuck_Instr_Stmt_Start( t_CKUINT numObjReleases );
@@ -3500,6 +3840,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Stmt_Remember_Object : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Stmt_Remember_Object )
+    friend struct Chuck_Bytecode_Codec;
 public:
     // constructor
     Chuck_Instr_Stmt_Remember_Object( Chuck_Instr_Stmt_Start * start, t_CKUINT offset, t_CKUINT addRef = FALSE )
@@ -3508,6 +3850,8 @@ public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
     // for printing
     virtual const char * params() const;
+    // whether this adds a reference (e.g., for 'new') | 1.5.5.3
+    t_CKBOOL addRef() const { return m_addRef; }
 
 protected:
     // pointer to corresponding Stmt_Start
@@ -3527,6 +3871,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Stmt_Cleanup : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Stmt_Cleanup )
+    friend struct Chuck_Bytecode_Codec;
 public:
     // constructor
     Chuck_Instr_Stmt_Cleanup( Chuck_Instr_Stmt_Start * start = NULL )
@@ -3552,6 +3898,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Spork : public Chuck_Instr_Unary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Spork )
 public:
     Chuck_Instr_Spork( t_CKUINT v = 0 ) { this->set( v ); }
 
@@ -3583,6 +3930,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Time_Advance : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Time_Advance )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3596,6 +3944,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Event_Wait : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Event_Wait )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -3609,6 +3958,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Array_Init_Literal : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Array_Init_Literal )
+    friend struct Chuck_Bytecode_Codec;
 public: // REFACTOR-2017: added env
     Chuck_Instr_Array_Init_Literal( Chuck_Env * env, Chuck_Type * the_type, t_CKINT length );
     virtual ~Chuck_Instr_Array_Init_Literal();
@@ -3634,6 +3985,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Array_Alloc : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Array_Alloc )
+    friend struct Chuck_Bytecode_Codec;
 public: // REFACTOR-2017: added env
     Chuck_Instr_Array_Alloc( Chuck_Env * env, t_CKUINT depth,
         Chuck_Type * contentType, t_CKUINT offset, t_CKBOOL ref,
@@ -3673,6 +4026,8 @@ Chuck_Object * do_alloc_array( Chuck_VM * vm, Chuck_VM_Shred * shred, t_CKINT *
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Array_Access : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Array_Access )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Array_Access( t_CKUINT kind, t_CKUINT emit_addr,
         t_CKUINT istr = FALSE )
@@ -3701,6 +4056,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Array_Map_Access : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Array_Map_Access )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Array_Map_Access( t_CKUINT kind, t_CKUINT emit_addr )
     { m_kind = kind; m_emit_addr = emit_addr; }
@@ -3726,6 +4083,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Array_Access_Multi : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Array_Access_Multi )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Array_Access_Multi( t_CKUINT depth, t_CKUINT kind, t_CKUINT emit_addr )
     { m_kind = kind; m_depth = depth; m_emit_addr = emit_addr; }
@@ -3757,6 +4116,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Member_Data : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Member_Data )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Member_Data( t_CKUINT offset, t_CKUINT kind, t_CKUINT emit_addr )
     { m_offset = offset; m_kind = kind; m_emit_addr = emit_addr; }
@@ -3783,6 +4144,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Member_Func : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Member_Func )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Member_Func( t_CKUINT offset )
     { m_offset = offset; }
@@ -3801,12 +4164,48 @@ protected:
 
 
 
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Instr_Dot_Member_Func_Call | 1.5.5.3 (added)
+// desc: look up a member function by offset for a call; this replaces
+//       Reg_Dup_Last + Dot_Member_Func: the object stays on the stack as
+//       'this', and the function is pushed above it -- or its code, once
+//       the emitter folds the following Func_To_Code in (see push_code())
+//-----------------------------------------------------------------------------
+struct Chuck_Instr_Dot_Member_Func_Call : public Chuck_Instr
+{
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Member_Func_Call )
+    friend struct Chuck_Bytecode_Codec;
+public:
+    Chuck_Instr_Dot_Member_Func_Call( t_CKUINT offset, t_CKBOOL pushCode = FALSE )
+    { m_offset = offset; m_push_code = pushCode; }
+
+public:
+    virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
+    virtual const char * params() const
+    { static char buffer[CK_PRINT_BUF_LENGTH];
+      snprintf( buffer, CK_PRINT_BUF_LENGTH, "offset=%ld%s", (long)m_offset, m_push_code ? ", code" : "" );
+      return buffer; }
+
+public:
+    // push the function's code instead of the function
+    void push_code() { m_push_code = TRUE; }
+
+protected:
+    t_CKUINT m_offset;
+    t_CKBOOL m_push_code;
+};
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: struct Chuck_Instr_Dot_Primitive_Func
 // desc: access the member function of primitive type 1.3.5.3
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Primitive_Func : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Primitive_Func )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Primitive_Func( t_CKUINT native_func )
     { m_native_func = native_func; }
@@ -3831,6 +4230,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Static_Data : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Static_Data )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Static_Data( t_CKUINT offset, t_CKUINT size, t_CKUINT kind, t_CKUINT emit_addr )
     { m_offset = offset; m_size = size; m_kind = kind; m_emit_addr = emit_addr; }
@@ -3859,6 +4260,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Static_Import_Data : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Static_Import_Data )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Static_Import_Data( void * addr, t_CKUINT kind, t_CKUINT emit_addr )
     { m_addr = addr; m_kind = kind; m_emit_addr = emit_addr; }
@@ -3886,6 +4289,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Static_Func : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Static_Func )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Static_Func( Chuck_Func * func )
     { m_func = func; }
@@ -3910,6 +4315,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Cmp_First : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Cmp_First )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Cmp_First( t_CKUINT is_mem, t_CKUINT emit_addr, te_KindOf kind )
     { m_is_mem = is_mem; m_emit_addr = emit_addr; m_kind = kind; }
@@ -3936,6 +4343,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Cmp_Second : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Cmp_Second )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Cmp_Second( t_CKUINT is_mem, t_CKUINT emit_addr, te_KindOf kind )
     { m_is_mem = is_mem; m_emit_addr = emit_addr; m_kind = kind; }
@@ -3962,6 +4371,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Cmp_Third : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Cmp_Third )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Cmp_Third( t_CKUINT is_mem, t_CKUINT emit_addr, te_KindOf kind )
     { m_is_mem = is_mem; m_emit_addr = emit_addr; m_kind = kind; }
@@ -3988,6 +4399,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dot_Cmp_Fourth : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dot_Cmp_Fourth )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Dot_Cmp_Fourth( t_CKUINT is_mem, t_CKUINT emit_addr, te_KindOf kind )
     { m_is_mem = is_mem; m_emit_addr = emit_addr; m_kind = kind; }
@@ -4014,6 +4427,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_ADC : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_ADC )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4027,6 +4441,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_DAC : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_DAC )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4040,6 +4455,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Bunghole : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Bunghole )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4053,6 +4469,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Chout : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Chout )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4066,6 +4483,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cherr : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cherr )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4079,6 +4497,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_UGen_Link : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_UGen_Link )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_UGen_Link( t_CKBOOL isUpChuck = FALSE );
 
@@ -4098,6 +4518,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_UGen_Array_Link : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_UGen_Array_Link )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_UGen_Array_Link( t_CKBOOL srcIsArray, t_CKBOOL dstIsArray, t_CKBOOL isUpChuck = FALSE ) :
     m_srcIsArray(srcIsArray), m_dstIsArray(dstIsArray), m_isUpChuck(isUpChuck)
@@ -4118,6 +4540,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_UGen_UnLink : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_UGen_UnLink )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4131,6 +4554,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_UGen_Ctrl : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_UGen_Ctrl )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4144,6 +4568,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_UGen_CGet : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_UGen_CGet )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4157,6 +4582,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_UGen_Ctrl2 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_UGen_Ctrl2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4170,6 +4596,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_UGen_CGet2 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_UGen_CGet2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4183,6 +4610,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_UGen_PMsg : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_UGen_PMsg )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4196,6 +4624,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_double2int : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_double2int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4209,6 +4638,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_int2double : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_int2double )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4222,6 +4652,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_int2complex : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_int2complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4235,6 +4666,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_int2polar : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_int2polar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4248,6 +4680,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_double2complex : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_double2complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4261,6 +4694,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_double2polar : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_double2polar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4274,6 +4708,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_complex2polar : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_complex2polar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4287,6 +4722,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_polar2complex : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_polar2complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4300,6 +4736,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_vec2tovec3 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_vec2tovec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4313,6 +4750,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_vec2tovec4 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_vec2tovec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4326,6 +4764,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_vec3tovec2 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_vec3tovec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4339,6 +4778,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_vec4tovec2 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_vec4tovec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4352,6 +4792,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_vec3tovec4 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_vec3tovec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4365,6 +4806,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_vec4tovec3 : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_vec4tovec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4378,6 +4820,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_object2string : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_object2string )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4391,6 +4834,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Cast_Runtime_Verify : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Cast_Runtime_Verify )
+    friend struct Chuck_Bytecode_Codec;
 public:
     // execute
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
@@ -4439,6 +4884,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Init_Loop_Counter : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Init_Loop_Counter )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4452,6 +4898,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Reg_Push_Loop_Counter_Deref : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Reg_Push_Loop_Counter_Deref )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4465,6 +4912,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Dec_Loop_Counter : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Dec_Loop_Counter )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4478,6 +4926,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Pop_Loop_Counter : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Pop_Loop_Counter )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4491,6 +4940,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_ForEach_Inc_And_Branch : public Chuck_Instr_Branch_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_ForEach_Inc_And_Branch )
+    friend struct Chuck_Bytecode_Codec;
 public:
     // constructor
     Chuck_Instr_ForEach_Inc_And_Branch( te_KindOf kind, t_CKUINT size )
@@ -4518,6 +4969,7 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_in_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_in_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4531,6 +4983,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_in_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_in_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4544,6 +4997,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_in_string : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_in_string )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4557,6 +5011,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_out_int : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_out_int )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4570,6 +5025,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_out_float : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_out_float )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4583,6 +5039,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_out_complex : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_out_complex )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4596,6 +5053,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_out_polar : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_out_polar )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4609,6 +5067,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_out_vec2 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_out_vec2 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4622,6 +5081,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_out_vec3 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_out_vec3 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4635,6 +5095,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_out_vec4 : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_out_vec4 )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4648,6 +5109,7 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_IO_out_string : public Chuck_Instr_Binary_Op
 {
+    CK_INSTR_OPCODE( Chuck_Instr_IO_out_string )
 public:
     virtual void execute( Chuck_VM * vm, Chuck_VM_Shred * shred );
 };
@@ -4661,6 +5123,8 @@ public:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Hack : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Hack )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Hack( Chuck_Type * type );
     virtual ~Chuck_Instr_Hack();
@@ -4680,6 +5144,8 @@ protected:
 //-----------------------------------------------------------------------------
 struct Chuck_Instr_Gack : public Chuck_Instr
 {
+    CK_INSTR_OPCODE( Chuck_Instr_Gack )
+    friend struct Chuck_Bytecode_Codec;
 public:
     Chuck_Instr_Gack( const std::vector<Chuck_Type *> & types );
     virtual ~Chuck_Instr_Gack();
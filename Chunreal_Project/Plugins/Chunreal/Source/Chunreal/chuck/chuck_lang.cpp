@@ -40,6 +40,8 @@
 #include "chuck_errmsg.h"
 #include "chuck_ugen.h"
 #include "util_string.h"
+#include "util_math.h"
+#include "util_simd.h" // 1.5.5.3
 
 #include <math.h>
 #include <iostream>
@@ -48,7 +50,14 @@
 using namespace std;
 
 // dac tick
-CK_DLL_TICK(__ugen_tick) { *out = in; return TRUE; }
+// (at rest whenever the input is zero | 1.5.5.3)
+CK_DLL_TICK(__ugen_tick) { *out = in; return in == 0 ? CK_TICK_SILENT | CK_TICK_DORMANT : TRUE; }
+// dac block tick | 1.5.5.3
+CK_DLL_TICKV(__ugen_tickv)
+{
+    memcpy( out, in, nframes * sizeof(SAMPLE) );
+    return ck_simd_is_zero( in, nframes ) ? CK_TICK_SILENT | CK_TICK_DORMANT : TRUE;
+}
 // object string offset
 static t_CKUINT Object_offset_string = 0;
 
@@ -139,6 +148,7 @@ t_CKBOOL init_class_ugen( Chuck_Env * env, Chuck_Type * type )
     type->ugen_info = new Chuck_UGen_Info;
     type->ugen_info->add_ref();
     type->ugen_info->tick = __ugen_tick;
+    type->ugen_info->tickv = __ugen_tickv;
     type->ugen_info->num_ins = 1;
     type->ugen_info->num_outs = 1;
     // documentation text
@@ -247,6 +257,7 @@ t_CKBOOL init_class_uana( Chuck_Env * env, Chuck_Type * type )
     type->ugen_info = new Chuck_UGen_Info;
     type->ugen_info->add_ref();
     type->ugen_info->tick = __ugen_tick;
+    type->ugen_info->tickv = __ugen_tickv;
     type->ugen_info->num_ins = 1;
     type->ugen_info->num_outs = 1;
 
@@ -1337,6 +1348,120 @@ t_CKBOOL init_class_array( Chuck_Env * env, Chuck_Type * type )
     func->doc = "sort the contents of the array in ascending order.";
     if( !type_engine_import_mfun( env, func ) ) goto error;
 
+    // bulk numeric operations (int[] and float[]) | 1.5.5.3 (added)
+    func = make_new_mfun( "void", "add", array_add );
+    func->add_arg( "float[]", "x" );
+    func->doc = "(int[] and float[] only) add the elements of x to this array, element by element, over the shorter of the two lengths; both arrays must hold the same element type.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "void", "add", array_add );
+    func->add_arg( "int[]", "x" );
+    func->doc = "(int[] and float[] only) add the elements of x to this array, element by element, over the shorter of the two lengths; both arrays must hold the same element type.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "void", "sub", array_sub );
+    func->add_arg( "float[]", "x" );
+    func->doc = "(int[] and float[] only) subtract the elements of x from this array, element by element, over the shorter of the two lengths.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "void", "sub", array_sub );
+    func->add_arg( "int[]", "x" );
+    func->doc = "(int[] and float[] only) subtract the elements of x from this array, element by element, over the shorter of the two lengths.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "void", "mul", array_mul );
+    func->add_arg( "float[]", "x" );
+    func->doc = "(int[] and float[] only) multiply this array by the elements of x, element by element, over the shorter of the two lengths.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "void", "mul", array_mul );
+    func->add_arg( "int[]", "x" );
+    func->doc = "(int[] and float[] only) multiply this array by the elements of x, element by element, over the shorter of the two lengths.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "void", "scale", array_scale );
+    func->add_arg( "float", "s" );
+    func->doc = "(int[] and float[] only) multiply every element by s; int elements are truncated.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "void", "axpy", array_axpy );
+    func->add_arg( "float", "a" );
+    func->add_arg( "float[]", "x" );
+    func->doc = "(float[] only) add a*x to this array, element by element, over the shorter of the two lengths.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "float", "dot", array_dot_float );
+    func->add_arg( "float[]", "x" );
+    func->doc = "(float[] only) dot product with x, over the shorter of the two lengths.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "int", "dot", array_dot_int );
+    func->add_arg( "int[]", "x" );
+    func->doc = "(int[] only) dot product with x, over the shorter of the two lengths.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "float", "sum", array_sum );
+    func->doc = "(int[] and float[] only) sum of all elements; int for int[].";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "float", "min", array_min );
+    func->doc = "(int[] and float[] only) smallest element; 0 if empty; int for int[].";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "float", "max", array_max );
+    func->doc = "(int[] and float[] only) largest element; 0 if empty; int for int[].";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    // int[] versions of sum/min/max; the type checker calls these in their
+    // place (see array_bulk_resolve())
+    func = make_new_mfun( "int", "@sum_int", array_sum_int );
+    func->doc = "(hidden) int[] sum().";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "int", "@min_int", array_min_int );
+    func->doc = "(hidden) int[] min().";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "int", "@max_int", array_max_int );
+    func->doc = "(hidden) int[] max().";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "int", "argmin", array_argmin );
+    func->doc = "(int[] and float[] only) index of the first smallest element; -1 if empty.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "int", "argmax", array_argmax );
+    func->doc = "(int[] and float[] only) index of the first largest element; -1 if empty.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "void", "fill", array_fill_float );
+    func->add_arg( "float", "value" );
+    func->doc = "(int[] and float[] only) set every element to value.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "void", "fill", array_fill_int );
+    func->add_arg( "int", "value" );
+    func->doc = "(int[] and float[] only) set every element to value.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "void", "copyFrom", array_copy_from );
+    func->add_arg( "float[]", "src" );
+    func->add_arg( "int", "srcBegin" );
+    func->add_arg( "int", "dstBegin" );
+    func->add_arg( "int", "count" );
+    func->doc = "(float[] only) copy count elements of src, starting at srcBegin, into this array starting at dstBegin; src may be this array.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "void", "copyFrom", array_copy_from );
+    func->add_arg( "int[]", "src" );
+    func->add_arg( "int", "srcBegin" );
+    func->add_arg( "int", "dstBegin" );
+    func->add_arg( "int", "count" );
+    func->doc = "(int[] only) copy count elements of src, starting at srcBegin, into this array starting at dstBegin; src may be this array.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "void", "map", array_map );
+    func->add_arg( "string", "mathFunc" );
+    func->doc = "(float[] only) replace every element x with Math.mathFunc(x), e.g., \"sin\", \"tanh\", \"mtof\", \"dbtorms\".";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "float", "interp", array_interp );
+    func->add_arg( "float", "index" );
+    func->doc = "(float[] only) linearly interpolated read at a fractional index; clamped to the first and last elements.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
     // add examples
     if( !type_engine_import_add_ex( env, "array/array_append.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "array/array_argument.ck" ) ) goto error;
@@ -3716,6 +3841,385 @@ CK_DLL_MFUN( array_reverse )
 
 
 
+
+//-----------------------------------------------------------------------------
+// bulk numeric operations on int[] and float[] | 1.5.5.3 (added)
+// float[] goes through the SIMD kernels in util_simd; int[] uses plain loops
+// element-wise operations cover the shorter of the two arrays
+//-----------------------------------------------------------------------------
+// the data kind of a numeric (non-object) array; throws and returns 0 otherwise
+static t_CKINT array_bulk_kind( Chuck_Array * array, Chuck_VM_Shred * SHRED, const char * what )
+{
+    t_CKINT kind = array->data_type_kind();
+    if( kind == CHUCK_ARRAYFLOAT_DATAKIND ) return kind;
+    if( kind == CHUCK_ARRAYINT_DATAKIND && !((Chuck_ArrayInt *)array)->contains_objects() ) return kind;
+    ck_throw_exception( SHRED, "InvalidArgument", what );
+    return 0;
+}
+
+// the kind shared by SELF and a second array argument; 0 (after throwing) if none
+static t_CKINT array_bulk_kind2( Chuck_Array * array, Chuck_Array * x, Chuck_VM_Shred * SHRED, const char * what )
+{
+    if( !x ) { ck_throw_exception( SHRED, "NullPointer", what ); return 0; }
+    t_CKINT kind = array_bulk_kind( array, SHRED, what );
+    if( !kind ) return 0;
+    if( x->data_type_kind() != kind || (kind == CHUCK_ARRAYINT_DATAKIND && ((Chuck_ArrayInt *)x)->contains_objects()) )
+    { ck_throw_exception( SHRED, "InvalidArgument", what ); return 0; }
+    return kind;
+}
+
+// element-wise y op= x over the common length
+#define ARRAY_BULK_BINARY( name, kernel, op, what )                         \
+CK_DLL_MFUN( name )                                                         \
+{                                                                           \
+    Chuck_Array * array = (Chuck_Array *)SELF;                              \
+    Chuck_Array * x = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);                 \
+    t_CKINT kind = array_bulk_kind2( array, x, SHRED, what );               \
+    if( kind == CHUCK_ARRAYFLOAT_DATAKIND )                                 \
+    {                                                                       \
+        std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector; \
+        std::vector<t_CKFLOAT> & b = ((Chuck_ArrayFloat *)x)->m_vector;     \
+        t_CKUINT n = ck_min( a.size(), b.size() );                          \
+        if( n ) kernel( &a[0], &b[0], n );                                  \
+    }                                                                       \
+    else if( kind == CHUCK_ARRAYINT_DATAKIND )                              \
+    {                                                                       \
+        std::vector<t_CKUINT> & a = ((Chuck_ArrayInt *)array)->m_vector;    \
+        std::vector<t_CKUINT> & b = ((Chuck_ArrayInt *)x)->m_vector;        \
+        t_CKUINT n = ck_min( a.size(), b.size() );                          \
+        for( t_CKUINT i = 0; i < n; i++ ) a[i] op b[i];                     \
+    }                                                                       \
+}
+
+ARRAY_BULK_BINARY( array_add, ck_simd_add, +=, "array.add() requires two int[] or two float[]" )
+ARRAY_BULK_BINARY( array_sub, ck_simd_sub, -=, "array.sub() requires two int[] or two float[]" )
+ARRAY_BULK_BINARY( array_mul, ck_simd_mul, *=, "array.mul() requires two int[] or two float[]" )
+
+#undef ARRAY_BULK_BINARY
+
+// array.scale( float s )
+CK_DLL_MFUN( array_scale )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKFLOAT s = GET_NEXT_FLOAT(ARGS);
+    t_CKINT kind = array_bulk_kind( array, SHRED, "array.scale() requires int[] or float[]" );
+    if( kind == CHUCK_ARRAYFLOAT_DATAKIND )
+    {
+        std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+        if( a.size() ) ck_simd_scale( &a[0], s, a.size() );
+    }
+    else if( kind == CHUCK_ARRAYINT_DATAKIND )
+    {
+        // same as i * s => i, truncating
+        std::vector<t_CKUINT> & a = ((Chuck_ArrayInt *)array)->m_vector;
+        for( t_CKUINT i = 0; i < a.size(); i++ ) a[i] = (t_CKINT)((t_CKINT)a[i] * s);
+    }
+}
+
+// array.axpy( float a, float[] x ) => this[i] += a * x[i]
+CK_DLL_MFUN( array_axpy )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKFLOAT s = GET_NEXT_FLOAT(ARGS);
+    Chuck_Array * x = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    if( array_bulk_kind2( array, x, SHRED, "array.axpy() requires two float[]" ) != CHUCK_ARRAYFLOAT_DATAKIND ) return;
+    std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+    std::vector<t_CKFLOAT> & b = ((Chuck_ArrayFloat *)x)->m_vector;
+    t_CKUINT n = ck_min( a.size(), b.size() );
+    if( n ) ck_simd_axpy( &a[0], s, &b[0], n );
+}
+
+// array.dot( float[] x ) / array.dot( int[] x )
+CK_DLL_MFUN( array_dot_float )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * x = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    RETURN->v_float = 0;
+    if( array_bulk_kind2( array, x, SHRED, "array.dot() requires two float[]" ) != CHUCK_ARRAYFLOAT_DATAKIND ) return;
+    std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+    std::vector<t_CKFLOAT> & b = ((Chuck_ArrayFloat *)x)->m_vector;
+    t_CKUINT n = ck_min( a.size(), b.size() );
+    if( n ) RETURN->v_float = ck_simd_dot( &a[0], &b[0], n );
+}
+
+CK_DLL_MFUN( array_dot_int )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * x = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    RETURN->v_int = 0;
+    if( array_bulk_kind2( array, x, SHRED, "array.dot() requires two int[]" ) != CHUCK_ARRAYINT_DATAKIND ) return;
+    std::vector<t_CKUINT> & a = ((Chuck_ArrayInt *)array)->m_vector;
+    std::vector<t_CKUINT> & b = ((Chuck_ArrayInt *)x)->m_vector;
+    t_CKUINT n = ck_min( a.size(), b.size() ), sum = 0;
+    for( t_CKUINT i = 0; i < n; i++ ) sum += a[i] * b[i];
+    RETURN->v_int = (t_CKINT)sum;
+}
+
+// array.sum()
+CK_DLL_MFUN( array_sum )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_float = 0;
+    if( array_bulk_kind( array, SHRED, "array.sum() requires int[] or float[]" ) != CHUCK_ARRAYFLOAT_DATAKIND ) return;
+    std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+    if( a.size() ) RETURN->v_float = ck_simd_sum( &a[0], a.size() );
+}
+
+CK_DLL_MFUN( array_sum_int )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_int = 0;
+    if( array_bulk_kind( array, SHRED, "array.sum() requires int[] or float[]" ) != CHUCK_ARRAYINT_DATAKIND ) return;
+    std::vector<t_CKUINT> & a = ((Chuck_ArrayInt *)array)->m_vector;
+    t_CKUINT sum = 0;
+    for( t_CKUINT i = 0; i < a.size(); i++ ) sum += a[i];
+    RETURN->v_int = (t_CKINT)sum;
+}
+
+// index of the first smallest (want_max == FALSE) or largest element; -1 if
+// the array is empty or not numeric
+static t_CKINT array_bulk_argext( Chuck_Array * array, Chuck_VM_Shred * SHRED, t_CKBOOL want_max, const char * what )
+{
+    t_CKINT kind = array_bulk_kind( array, SHRED, what );
+    if( kind == CHUCK_ARRAYFLOAT_DATAKIND )
+    {
+        std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+        if( !a.size() ) return -1;
+        return (t_CKINT)( want_max ? ck_simd_argmax( &a[0], a.size() ) : ck_simd_argmin( &a[0], a.size() ) );
+    }
+    else if( kind == CHUCK_ARRAYINT_DATAKIND )
+    {
+        std::vector<t_CKUINT> & a = ((Chuck_ArrayInt *)array)->m_vector;
+        if( !a.size() ) return -1;
+        t_CKUINT at = 0;
+        for( t_CKUINT i = 1; i < a.size(); i++ )
+            if( want_max ? (t_CKINT)a[i] > (t_CKINT)a[at] : (t_CKINT)a[i] < (t_CKINT)a[at] ) at = i;
+        return (t_CKINT)at;
+    }
+    return -1;
+}
+
+// the value at an index from array_bulk_argext(); 0 if none
+static t_CKFLOAT array_bulk_value_float( Chuck_Array * array, t_CKINT at )
+{
+    if( at < 0 || array->data_type_kind() != CHUCK_ARRAYFLOAT_DATAKIND ) return 0;
+    return ((Chuck_ArrayFloat *)array)->m_vector[at];
+}
+
+static t_CKINT array_bulk_value_int( Chuck_Array * array, t_CKINT at )
+{
+    if( at < 0 || array->data_type_kind() != CHUCK_ARRAYINT_DATAKIND ) return 0;
+    return (t_CKINT)((Chuck_ArrayInt *)array)->m_vector[at];
+}
+
+// array.argmin() / array.argmax() / array.min() / array.max()
+CK_DLL_MFUN( array_argmin )
+{
+    RETURN->v_int = array_bulk_argext( (Chuck_Array *)SELF, SHRED, FALSE, "array.argmin() requires int[] or float[]" );
+}
+
+CK_DLL_MFUN( array_argmax )
+{
+    RETURN->v_int = array_bulk_argext( (Chuck_Array *)SELF, SHRED, TRUE, "array.argmax() requires int[] or float[]" );
+}
+
+CK_DLL_MFUN( array_min )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_float = array_bulk_value_float( array, array_bulk_argext( array, SHRED, FALSE, "array.min() requires int[] or float[]" ) );
+}
+
+CK_DLL_MFUN( array_min_int )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_int = array_bulk_value_int( array, array_bulk_argext( array, SHRED, FALSE, "array.min() requires int[] or float[]" ) );
+}
+
+CK_DLL_MFUN( array_max )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_float = array_bulk_value_float( array, array_bulk_argext( array, SHRED, TRUE, "array.max() requires int[] or float[]" ) );
+}
+
+CK_DLL_MFUN( array_max_int )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    RETURN->v_int = array_bulk_value_int( array, array_bulk_argext( array, SHRED, TRUE, "array.max() requires int[] or float[]" ) );
+}
+
+// array.fill( float v ) / array.fill( int v )
+CK_DLL_MFUN( array_fill_float )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKFLOAT v = GET_NEXT_FLOAT(ARGS);
+    t_CKINT kind = array_bulk_kind( array, SHRED, "array.fill() requires int[] or float[]" );
+    if( kind == CHUCK_ARRAYFLOAT_DATAKIND )
+    {
+        std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+        if( a.size() ) ck_simd_fill( &a[0], v, a.size() );
+    }
+    else if( kind == CHUCK_ARRAYINT_DATAKIND )
+    {
+        std::vector<t_CKUINT> & a = ((Chuck_ArrayInt *)array)->m_vector;
+        std::fill( a.begin(), a.end(), (t_CKUINT)(t_CKINT)v );
+    }
+}
+
+CK_DLL_MFUN( array_fill_int )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKINT v = GET_NEXT_INT(ARGS);
+    t_CKINT kind = array_bulk_kind( array, SHRED, "array.fill() requires int[] or float[]" );
+    if( kind == CHUCK_ARRAYFLOAT_DATAKIND )
+    {
+        std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+        if( a.size() ) ck_simd_fill( &a[0], (t_CKFLOAT)v, a.size() );
+    }
+    else if( kind == CHUCK_ARRAYINT_DATAKIND )
+    {
+        std::vector<t_CKUINT> & a = ((Chuck_ArrayInt *)array)->m_vector;
+        std::fill( a.begin(), a.end(), (t_CKUINT)v );
+    }
+}
+
+// array.copyFrom( src, int srcBegin, int dstBegin, int count )
+CK_DLL_MFUN( array_copy_from )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_Array * src = (Chuck_Array *)GET_NEXT_OBJECT(ARGS);
+    t_CKINT srcBegin = GET_NEXT_INT(ARGS);
+    t_CKINT dstBegin = GET_NEXT_INT(ARGS);
+    t_CKINT count = GET_NEXT_INT(ARGS);
+    t_CKINT kind = array_bulk_kind2( array, src, SHRED, "array.copyFrom() requires two int[] or two float[]" );
+    if( !kind ) return;
+
+    // validate the range against both arrays (without overflow: the
+    // begins first, then count against what is left after them)
+    t_CKINT srcSize = src->size(), dstSize = array->size();
+    if( srcBegin < 0 || srcBegin > srcSize ) { ck_throw_exception( SHRED, "IndexOutOfBounds", srcBegin ); return; }
+    if( dstBegin < 0 || dstBegin > dstSize ) { ck_throw_exception( SHRED, "IndexOutOfBounds", dstBegin ); return; }
+    if( count < 0 || count > srcSize - srcBegin ) { ck_throw_exception( SHRED, "IndexOutOfBounds", count ); return; }
+    if( count > dstSize - dstBegin ) { ck_throw_exception( SHRED, "IndexOutOfBounds", count ); return; }
+    if( !count ) return;
+
+    // memmove semantics; src may be SELF
+    if( kind == CHUCK_ARRAYFLOAT_DATAKIND )
+    {
+        t_CKFLOAT * s = &((Chuck_ArrayFloat *)src)->m_vector[0];
+        t_CKFLOAT * d = &((Chuck_ArrayFloat *)array)->m_vector[0];
+        memmove( d + dstBegin, s + srcBegin, count * sizeof(t_CKFLOAT) );
+    }
+    else
+    {
+        t_CKUINT * s = &((Chuck_ArrayInt *)src)->m_vector[0];
+        t_CKUINT * d = &((Chuck_ArrayInt *)array)->m_vector[0];
+        memmove( d + dstBegin, s + srcBegin, count * sizeof(t_CKUINT) );
+    }
+}
+
+// unary Math functions accepted by array.map()
+static t_CKFLOAT array_map_abs( t_CKFLOAT x ) { return ::fabs( x ); }
+static t_CKFLOAT array_map_sgn( t_CKFLOAT x ) { return x == 0 ? 0 : ( x > 0 ? 1 : -1 ); }
+static const struct { const char * name; t_CKFLOAT (*f)( t_CKFLOAT ); } g_array_map_funcs[] = {
+    { "sin", ::sin }, { "cos", ::cos }, { "tan", ::tan },
+    { "asin", ::asin }, { "acos", ::acos }, { "atan", ::atan },
+    { "sinh", ::sinh }, { "cosh", ::cosh }, { "tanh", ::tanh },
+    { "exp", ::exp }, { "log", ::log }, { "log2", ::log2 }, { "log10", ::log10 },
+    { "sqrt", ::sqrt }, { "abs", array_map_abs }, { "fabs", array_map_abs }, { "sgn", array_map_sgn },
+    { "floor", ::floor }, { "ceil", ::ceil }, { "round", ::round }, { "trunc", ::trunc },
+    { "mtof", ck_mtof }, { "ftom", ck_ftom }, { "powtodb", ck_powtodb },
+    { "rmstodb", ck_rmstodb }, { "dbtopow", ck_dbtopow }, { "dbtorms", ck_dbtorms },
+};
+
+// array.map( string func ) => this[i] = Math.func( this[i] )
+CK_DLL_MFUN( array_map )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    Chuck_String * name = GET_NEXT_STRING(ARGS);
+    if( !name ) { ck_throw_exception( SHRED, "NullPointer", "array.map() function name is null" ); return; }
+    if( array->data_type_kind() != CHUCK_ARRAYFLOAT_DATAKIND )
+    { ck_throw_exception( SHRED, "InvalidArgument", "array.map() requires float[]" ); return; }
+
+    // look up the function
+    t_CKFLOAT (*f)( t_CKFLOAT ) = NULL;
+    for( t_CKUINT i = 0; i < sizeof(g_array_map_funcs)/sizeof(g_array_map_funcs[0]); i++ )
+        if( name->str() == g_array_map_funcs[i].name ) { f = g_array_map_funcs[i].f; break; }
+    if( !f )
+    {
+        string msg = "array.map() unknown Math function '" + name->str() + "'";
+        ck_throw_exception( SHRED, "InvalidArgument", msg.c_str() );
+        return;
+    }
+
+    std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+    for( t_CKUINT i = 0; i < a.size(); i++ ) a[i] = f( a[i] );
+}
+
+// array.interp( float index ) => linearly interpolated read, clamped to the ends
+CK_DLL_MFUN( array_interp )
+{
+    Chuck_Array * array = (Chuck_Array *)SELF;
+    t_CKFLOAT pos = GET_NEXT_FLOAT(ARGS);
+    RETURN->v_float = 0;
+    if( array->data_type_kind() != CHUCK_ARRAYFLOAT_DATAKIND )
+    { ck_throw_exception( SHRED, "InvalidArgument", "array.interp() requires float[]" ); return; }
+
+    std::vector<t_CKFLOAT> & a = ((Chuck_ArrayFloat *)array)->m_vector;
+    if( !a.size() ) { ck_throw_exception( SHRED, "IndexOutOfBounds", (t_CKINT)0 ); return; }
+    if( !(pos > 0) ) { RETURN->v_float = a[0]; return; }
+    if( pos >= (t_CKFLOAT)(a.size()-1) ) { RETURN->v_float = a[a.size()-1]; return; }
+    t_CKUINT i = (t_CKUINT)pos;
+    t_CKFLOAT frac = pos - i;
+    RETURN->v_float = a[i] + ( a[i+1] - a[i] ) * frac;
+}
+
+// the bulk numeric methods: element types each applies to, and the
+// int-returning function to call instead for int[]
+static const struct { const char * name; t_CKBOOL ints; t_CKBOOL floats; const char * int_func; } g_array_bulk_funcs[] = {
+    { "add", TRUE, TRUE, NULL }, { "sub", TRUE, TRUE, NULL }, { "mul", TRUE, TRUE, NULL },
+    { "scale", TRUE, TRUE, NULL }, { "axpy", FALSE, TRUE, NULL }, { "dot", TRUE, TRUE, NULL },
+    { "sum", TRUE, TRUE, "@sum_int" }, { "min", TRUE, TRUE, "@min_int" }, { "max", TRUE, TRUE, "@max_int" },
+    { "argmin", TRUE, TRUE, NULL }, { "argmax", TRUE, TRUE, NULL }, { "fill", TRUE, TRUE, NULL },
+    { "copyFrom", TRUE, TRUE, NULL }, { "map", FALSE, TRUE, NULL }, { "interp", FALSE, TRUE, NULL },
+};
+
+//-----------------------------------------------------------------------------
+// name: array_bulk_resolve() | 1.5.5.3 (added)
+// desc: called by the type checker on a call to an array method, to keep the
+//       bulk numeric ones to the arrays they work on: returns func, or the
+//       function to call in its place (int[] sum/min/max), or NULL if func
+//       does not apply to arrays of this type (or takes a different array)
+//-----------------------------------------------------------------------------
+Chuck_Func * array_bulk_resolve( Chuck_Env * env, Chuck_Type * array, Chuck_Func * func )
+{
+    // find it
+    t_CKUINT i, n = sizeof(g_array_bulk_funcs)/sizeof(g_array_bulk_funcs[0]);
+    for( i = 0; i < n; i++ )
+        if( func->base_name == g_array_bulk_funcs[i].name ) break;
+    // not one of them
+    if( i == n ) return func;
+
+    // one-dimensional int[] or float[] only
+    t_CKBOOL ints = array->array_depth == 1 && equals( array->array_type, env->ckt_int );
+    t_CKBOOL floats = array->array_depth == 1 && equals( array->array_type, env->ckt_float );
+    if( !(ints && g_array_bulk_funcs[i].ints) && !(floats && g_array_bulk_funcs[i].floats) ) return NULL;
+
+    // an array argument must be of the same type, e.g., int[].add( int[] )
+    for( a_Arg_List arg = func->def()->arg_list; arg; arg = arg->next )
+        if( arg->type->array_depth && !equals( arg->type, array ) ) return NULL;
+
+    // int[] version
+    if( ints && g_array_bulk_funcs[i].int_func )
+    {
+        Chuck_Value * v = type_engine_find_value( env->ckt_array, g_array_bulk_funcs[i].int_func );
+        return v ? v->func_ref : NULL;
+    }
+
+    return func;
+}
+
+
+
 //-----------------------------------------------------------------------------
 // Type implementation
 // 1.5.0.0 (ge) added
@@ -63,6 +63,9 @@ t_CKBOOL init_class_vec4( Chuck_Env * env, Chuck_Type * type ); // 1.3.5.3
 t_CKBOOL init_class_type( Chuck_Env * env, Chuck_Type * type ); // 1.5.0.0
 t_CKBOOL init_class_function( Chuck_Env * env, Chuck_Type * type ); // 1.5.0.0
 t_CKBOOL init_primitive_types( Chuck_Env * env ); // 1.5.0.0
+// resolve a bulk numeric array method for an array type; NULL if the method
+// does not apply to that element type | 1.5.5.3 (added)
+Chuck_Func * array_bulk_resolve( Chuck_Env * env, Chuck_Type * array, Chuck_Func * func );
 
 
 
@@ -209,6 +212,27 @@ CK_DLL_MFUN( array_shuffle );
 CK_DLL_MFUN( array_sort );
 CK_DLL_MFUN( array_map_find );
 CK_DLL_MFUN( array_map_erase );
+// bulk numeric operations | 1.5.5.3 (added)
+CK_DLL_MFUN( array_add );
+CK_DLL_MFUN( array_sub );
+CK_DLL_MFUN( array_mul );
+CK_DLL_MFUN( array_scale );
+CK_DLL_MFUN( array_axpy );
+CK_DLL_MFUN( array_dot_float );
+CK_DLL_MFUN( array_dot_int );
+CK_DLL_MFUN( array_sum );
+CK_DLL_MFUN( array_sum_int );
+CK_DLL_MFUN( array_min );
+CK_DLL_MFUN( array_min_int );
+CK_DLL_MFUN( array_max );
+CK_DLL_MFUN( array_max_int );
+CK_DLL_MFUN( array_argmin );
+CK_DLL_MFUN( array_argmax );
+CK_DLL_MFUN( array_fill_float );
+CK_DLL_MFUN( array_fill_int );
+CK_DLL_MFUN( array_copy_from );
+CK_DLL_MFUN( array_map );
+CK_DLL_MFUN( array_interp );
 
 
 //-----------------------------------------------------------------------------
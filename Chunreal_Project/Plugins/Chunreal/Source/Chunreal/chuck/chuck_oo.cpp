@@ -47,6 +47,389 @@ using namespace std;
 
 // initialize
 t_CKBOOL Chuck_VM_Object::our_locks_in_effect = TRUE;
+// refcount operations counter | 1.5.5.3
+t_CKUINT Chuck_VM_Object::our_refcount_ops = 0;
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Pool_Header | 1.5.5.3 added
+// desc: prefix of every block handed out by Chuck_VM_Pool::allocate()
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Pool_Header
+{
+    // originating pool; NULL if from system allocator
+    Chuck_VM_Pool * pool;
+    // total block size, including this header
+    t_CKUINT size;
+};
+
+// header <-> block conversion
+#define CK_POOL_HEADER(ptr) (((Chuck_VM_Pool_Header *)(ptr)) - 1)
+#define CK_POOL_BLOCK(hdr)  ((void *)(((Chuck_VM_Pool_Header *)(hdr)) + 1))
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: Chuck_VM_Pool()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Pool::Chuck_VM_Pool()
+{
+    // zero out free lists
+    memset( m_free, 0, sizeof(m_free) );
+    // not detached
+    m_detached = FALSE;
+    // not owned by any thread until the first enter()
+    m_owner = std::thread::id();
+    // nothing deferred
+    m_deferred = NULL;
+    m_has_deferred = FALSE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_VM_Pool()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Pool::~Chuck_VM_Pool()
+{
+    // release all slabs
+    for( t_CKUINT i = 0; i < m_slabs.size(); i++ )
+        ::operator delete( m_slabs[i] );
+    // clear
+    m_slabs.clear();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: allocate()
+// desc: allocate at least 'size' bytes; if pool is NULL, uses system allocator
+//-----------------------------------------------------------------------------
+void * Chuck_VM_Pool::allocate( Chuck_VM_Pool * pool, t_CKUINT size )
+{
+    // total block size, rounded up to granularity
+    t_CKUINT total = size + sizeof(Chuck_VM_Pool_Header);
+    total = (total + CK_POOL_GRANULARITY - 1) & ~(t_CKUINT)(CK_POOL_GRANULARITY - 1);
+
+    // header to fill in
+    Chuck_VM_Pool_Header * hdr = NULL;
+
+    // from pool?
+    if( pool && total <= CK_POOL_MAX_BLOCK_SIZE )
+    {
+        // from the size class
+        hdr = (Chuck_VM_Pool_Header *)pool->alloc_block( total / CK_POOL_GRANULARITY - 1 );
+    }
+    else
+    {
+        // from the system allocator
+        hdr = (Chuck_VM_Pool_Header *)::operator new( total );
+        // count oversized
+        if( pool ) pool->m_stats.num_oversized++;
+    }
+
+    // fill in header
+    hdr->pool = pool;
+    hdr->size = total;
+
+    // update stats
+    if( pool )
+    {
+        pool->m_stats.num_allocs++;
+        pool->m_stats.num_live++;
+        pool->m_stats.bytes_in_use += total;
+        if( pool->m_stats.bytes_in_use > pool->m_stats.bytes_peak )
+            pool->m_stats.bytes_peak = pool->m_stats.bytes_in_use;
+    }
+
+    // return the usable part
+    return CK_POOL_BLOCK( hdr );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: deallocate()
+// desc: return memory obtained from allocate() to wherever it came from
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::deallocate( void * ptr )
+{
+    // nothing to do
+    if( !ptr ) return;
+
+    // get header
+    Chuck_VM_Pool_Header * hdr = CK_POOL_HEADER( ptr );
+    Chuck_VM_Pool * pool = hdr->pool;
+
+    // system allocated
+    if( !pool ) { ::operator delete( hdr ); return; }
+
+    // on the VM thread, return directly to the pool; otherwise (e.g., a
+    // host thread releasing a global, or any thread once detached) defer
+    if( pool->owned() ) pool->release( hdr );
+    else pool->defer( hdr );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: release()
+// desc: return a block (with header) to this pool and update stats
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::release( void * block )
+{
+    // get header
+    Chuck_VM_Pool_Header * hdr = (Chuck_VM_Pool_Header *)block;
+    t_CKUINT total = hdr->size;
+
+    // return to pool
+    if( total <= CK_POOL_MAX_BLOCK_SIZE ) free_block( hdr, total / CK_POOL_GRANULARITY - 1 );
+    else ::operator delete( hdr );
+
+    // update stats
+    m_stats.num_frees++;
+    m_stats.num_live--;
+    m_stats.bytes_in_use -= total;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: defer()
+// desc: release a block from a thread other than the owner; the block is
+//       queued for the owner to reclaim in enter(), or released right away
+//       (under lock) once the pool is detached
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::defer( void * block )
+{
+    // get header
+    Chuck_VM_Pool_Header * hdr = (Chuck_VM_Pool_Header *)block;
+    // lock
+    std::unique_lock<std::mutex> lock( m_deferred_mutex );
+
+    // no VM thread anymore; release now
+    if( m_detached )
+    {
+        release( hdr );
+        // last block returned to a detached pool
+        t_CKBOOL gone = m_stats.num_live == 0;
+        lock.unlock();
+        if( gone ) delete this;
+        return;
+    }
+
+    // queue, linking through the header's pool field (restored on reclaim)
+    hdr->pool = (Chuck_VM_Pool *)m_deferred;
+    m_deferred = hdr;
+    m_has_deferred.store( TRUE, std::memory_order_release );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: reclaim_deferred()
+// desc: release blocks queued by defer(); caller must hold m_deferred_mutex
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::reclaim_deferred()
+{
+    while( m_deferred )
+    {
+        // pop
+        Chuck_VM_Pool_Header * hdr = (Chuck_VM_Pool_Header *)m_deferred;
+        m_deferred = hdr->pool;
+        // restore and release
+        hdr->pool = this;
+        release( hdr );
+    }
+    // empty
+    m_has_deferred.store( FALSE, std::memory_order_relaxed );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: enter()
+// desc: called by the VM thread before each run: takes ownership of the
+//       pool and reclaims blocks released from other threads
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::enter()
+{
+    // the host may call run() from a different thread over time
+    std::thread::id self = std::this_thread::get_id();
+    if( m_owner.load( std::memory_order_relaxed ) != self )
+        m_owner.store( self, std::memory_order_relaxed );
+
+    // reclaim anything released elsewhere; never block the audio thread
+    if( m_has_deferred.load( std::memory_order_acquire ) && m_deferred_mutex.try_lock() )
+    {
+        reclaim_deferred();
+        m_deferred_mutex.unlock();
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: pool_of()
+// desc: get the pool a block was allocated from (NULL if system-allocated)
+//-----------------------------------------------------------------------------
+Chuck_VM_Pool * Chuck_VM_Pool::pool_of( void * ptr )
+{
+    return ptr ? CK_POOL_HEADER( ptr )->pool : NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: detach()
+// desc: detach from owner; the pool reclaims itself (and its slabs) as soon
+//       as every outstanding block has been returned
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::detach()
+{
+    // log
+    EM_log( CK_LOG_SYSTEM, "object pool: %lu bytes reserved in %lu slabs, peak %lu bytes in use",
+            m_stats.bytes_reserved, m_stats.num_slabs, m_stats.bytes_peak );
+    EM_log( CK_LOG_SYSTEM, "object pool: %lu allocations (%lu oversized), %lu outstanding",
+            m_stats.num_allocs, m_stats.num_oversized, m_stats.num_live );
+    EM_log( CK_LOG_SYSTEM, "object pool: %lu object allocations avoided (escape analysis)",
+            m_stats.num_avoided );
+
+    // lock out deferred releases
+    std::unique_lock<std::mutex> lock( m_deferred_mutex );
+    // no owner from now on; every release goes through defer()
+    m_owner.store( std::thread::id(), std::memory_order_relaxed );
+    // set flag
+    m_detached = TRUE;
+    // reclaim anything still queued
+    reclaim_deferred();
+    // nothing outstanding
+    t_CKBOOL gone = m_stats.num_live == 0;
+    lock.unlock();
+    if( gone ) delete this;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: alloc_block()
+// desc: allocate a block of the given size class
+//-----------------------------------------------------------------------------
+void * Chuck_VM_Pool::alloc_block( t_CKUINT cls )
+{
+    // grow if needed
+    if( !m_free[cls] && !grow( cls ) ) return NULL;
+    // pop the head of the free list
+    void * block = m_free[cls];
+    m_free[cls] = *(void **)block;
+    // done
+    return block;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: free_block()
+// desc: return a block to the given size class
+//-----------------------------------------------------------------------------
+void Chuck_VM_Pool::free_block( void * block, t_CKUINT cls )
+{
+    // push onto the free list
+    *(void **)block = m_free[cls];
+    m_free[cls] = block;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: grow()
+// desc: carve a new slab for the given size class
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM_Pool::grow( t_CKUINT cls )
+{
+    // block size for this class
+    t_CKUINT blockSize = (cls + 1) * CK_POOL_GRANULARITY;
+    // number of blocks per slab
+    t_CKUINT num = CK_POOL_SLAB_SIZE / blockSize;
+    // allocate slab
+    t_CKBYTE * slab = (t_CKBYTE *)::operator new( num * blockSize );
+    // remember it
+    m_slabs.push_back( slab );
+    // thread blocks onto free list, in address order
+    for( t_CKINT i = (t_CKINT)num - 1; i >= 0; i-- )
+        free_block( slab + i * blockSize, cls );
+
+    // update stats
+    m_stats.bytes_reserved += num * blockSize;
+    m_stats.num_slabs++;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: operator new()
+// desc: allocate a VM object from the system allocator
+//-----------------------------------------------------------------------------
+void * Chuck_VM_Object::operator new( size_t size )
+{
+    return Chuck_VM_Pool::allocate( NULL, size );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: operator new()
+// desc: allocate a VM object from a pool (system allocator if pool is NULL)
+//-----------------------------------------------------------------------------
+void * Chuck_VM_Object::operator new( size_t size, Chuck_VM_Pool * pool )
+{
+    return Chuck_VM_Pool::allocate( pool, size );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: operator delete()
+// desc: return a VM object's memory to where it came from
+//-----------------------------------------------------------------------------
+void Chuck_VM_Object::operator delete( void * ptr )
+{
+    Chuck_VM_Pool::deallocate( ptr );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: operator delete()
+// desc: matching placement delete (called if a constructor throws)
+//-----------------------------------------------------------------------------
+void Chuck_VM_Object::operator delete( void * ptr, Chuck_VM_Pool * pool )
+{
+    Chuck_VM_Pool::deallocate( ptr );
+}
 
 
 
@@ -95,10 +478,10 @@ void Chuck_VM_Object::init_ref()
 
 
 //-----------------------------------------------------------------------------
-// name: add_ref()
-// desc: add reference
+// name: add_ref_debug()
+// desc: add reference, with debug tracking (see inline add_ref())
 //-----------------------------------------------------------------------------
-void Chuck_VM_Object::add_ref()
+void Chuck_VM_Object::add_ref_debug()
 {
     // increment reference count
     m_ref_count++;
@@ -113,23 +496,11 @@ void Chuck_VM_Object::add_ref()
 
 
 //-----------------------------------------------------------------------------
-// name: dec_ref_no_release() | 1.5.4.3 (ge) added
-// desc: decrement reference only; no deletion
-//-----------------------------------------------------------------------------
-void Chuck_VM_Object::dec_ref_no_release()
-{
-    // decrement
-    if( m_ref_count > 0 ) m_ref_count--;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// name: release()
+// name: release_slow()
 // desc: decrement reference; deletes objects when refcount reaches 0;
+//       (the inline release() handles the common still-referenced case)
 //-----------------------------------------------------------------------------
-void Chuck_VM_Object::release()
+void Chuck_VM_Object::release_slow()
 {
     //-----------------------------------------------------------------------------
     // release is permitted even if ref-count is already 0 | 1.5.1.0 (ge)
@@ -373,8 +744,8 @@ Chuck_Object::~Chuck_Object()
 
     // free virtual table
     CK_SAFE_DELETE( vtable );
-    // free data segment
-    CK_SAFE_DELETE_ARRAY( data );
+    // free data segment (allocated through Chuck_VM_Pool) | 1.5.5.3
+    Chuck_VM_Pool::deallocate( data ); data = NULL;
 }
 
 
@@ -512,10 +883,10 @@ t_CKUINT Chuck_ArrayInt::addr( t_CKINT i )
 // name: addr()
 // desc: return address of element at key, as an int
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_ArrayInt::addr( const string & key )
+t_CKUINT Chuck_ArrayInt::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_index.at( m_map, key, hash ));
 }
 
 
@@ -563,16 +934,16 @@ t_CKINT Chuck_ArrayInt::get( t_CKINT i, t_CKINT * val )
 // name: get()
 // desc: get value of element at key
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_ArrayInt::get( const string & key, t_CKUINT * val )
+t_CKINT Chuck_ArrayInt::get( const string & key, t_CKUINT * val, t_CKUINT hash )
 {
     // set to zero
     *val = 0;
     // find
-    map<string, t_CKUINT>::iterator iter = m_map.find( key );
+    t_CKUINT * v = m_index.find( key, hash );
     // check
-    if( iter == m_map.end() ) return 0;
+    if( !v ) return 0;
     // copy value
-    *val = (*iter).second;
+    *val = *v;
     // return good
     return 1;
 }
@@ -584,16 +955,16 @@ t_CKINT Chuck_ArrayInt::get( const string & key, t_CKUINT * val )
 // name: get() -- signed edition | 1.5.2.0
 // desc: get value of element at key
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_ArrayInt::get( const string & key, t_CKINT * val )
+t_CKINT Chuck_ArrayInt::get( const string & key, t_CKINT * val, t_CKUINT hash )
 {
     // set to zero
     *val = 0;
     // find
-    map<string, t_CKUINT>::iterator iter = m_map.find( key );
+    t_CKUINT * v = m_index.find( key, hash );
     // check
-    if( iter == m_map.end() ) return 0;
+    if( !v ) return 0;
     // copy value
-    *val = (t_CKINT)(*iter).second;
+    *val = (t_CKINT)*v;
     // return good
     return 1;
 }
@@ -633,15 +1004,16 @@ t_CKINT Chuck_ArrayInt::set( t_CKINT i, t_CKUINT val )
 t_CKINT Chuck_ArrayInt::set( const string & key, t_CKUINT val )
 {
     // look for key
-    map<string, t_CKUINT>::iterator iter = m_map.find( key );
+    t_CKUINT hash = ck_strhash( key );
+    t_CKUINT * v = m_index.find( key, hash );
 
     // if Object, release
-    if( m_is_obj && iter != m_map.end() && iter->second != 0 )
-        ((Chuck_Object *)iter->second)->release();
+    if( m_is_obj && v && *v != 0 )
+        ((Chuck_Object *)*v)->release();
 
     // if 0, remove the element
-    if( !val ) m_map.erase( key );
-    else m_map[key] = val;
+    if( !val ) m_index.erase( m_map, key, hash );
+    else m_index.at( m_map, key, hash ) = val;
 
     // if Object, add ref
     if( m_is_obj && val ) ((Chuck_Object *)val)->add_ref();
@@ -681,7 +1053,7 @@ t_CKINT Chuck_ArrayInt::insert( t_CKINT i, t_CKUINT val )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayInt::map_find( const string & key )
 {
-    return m_map.find( key ) != m_map.end();
+    return m_index.find( key ) != NULL;
 }
 
 
@@ -693,15 +1065,16 @@ t_CKINT Chuck_ArrayInt::map_find( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayInt::map_erase( const string & key )
 {
-    map<string, t_CKUINT>::iterator iter = m_map.find( key );
-    t_CKINT v = iter != m_map.end();
+    t_CKUINT hash = ck_strhash( key );
+    t_CKUINT * val = m_index.find( key, hash );
+    t_CKINT v = val != NULL;
 
     // if obj
-    if( m_is_obj && iter != m_map.end() )
-        ((Chuck_Object *)(*iter).second)->release();
+    if( m_is_obj && val )
+        ((Chuck_Object *)*val)->release();
 
     // erase
-    if( v ) m_map.erase( key );
+    if( v ) m_index.erase( m_map, key, hash );
 
     return v;
 }
@@ -1229,10 +1602,10 @@ t_CKUINT Chuck_ArrayFloat::addr( t_CKINT i )
 // name: addr()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_ArrayFloat::addr( const string & key )
+t_CKUINT Chuck_ArrayFloat::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_index.at( m_map, key, hash ));
 }
 
 
@@ -1262,19 +1635,19 @@ t_CKINT Chuck_ArrayFloat::get( t_CKINT i, t_CKFLOAT * val )
 // name: get()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_ArrayFloat::get( const string & key, t_CKFLOAT * val )
+t_CKINT Chuck_ArrayFloat::get( const string & key, t_CKFLOAT * val, t_CKUINT hash )
 {
     // set to zero
     *val = 0.0;
 
-    // iterator
-    map<string, t_CKFLOAT>::iterator iter = m_map.find( key );
+    // find
+    t_CKFLOAT * v = m_index.find( key, hash );
 
     // check
-    if( iter != m_map.end() )
+    if( v )
     {
         // get the value
-        *val = (*iter).second;
+        *val = *v;
     }
 
     // return good
@@ -1317,7 +1690,7 @@ t_CKINT Chuck_ArrayFloat::set( const string & key, t_CKFLOAT val )
     // if( !val ) m_map.erase( key ); else
 
     // insert
-    m_map[key] = val;
+    m_index.at( m_map, key ) = val;
 
     // return good
     return 1;
@@ -1352,7 +1725,7 @@ t_CKINT Chuck_ArrayFloat::insert( t_CKINT i, t_CKFLOAT val )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayFloat::map_find( const string & key )
 {
-    return m_map.find( key ) != m_map.end();
+    return m_index.find( key ) != NULL;
 }
 
 
@@ -1363,7 +1736,7 @@ t_CKINT Chuck_ArrayFloat::map_find( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayFloat::map_erase( const string & key )
 {
-    return m_map.erase( key );
+    return m_index.erase( m_map, key );
 }
 
 
@@ -1695,10 +2068,10 @@ t_CKUINT Chuck_ArrayVec2::addr( t_CKINT i )
 // name: addr()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_ArrayVec2::addr( const string & key )
+t_CKUINT Chuck_ArrayVec2::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_index.at( m_map, key, hash ));
 }
 
 
@@ -1731,27 +2104,27 @@ t_CKINT Chuck_ArrayVec2::get( t_CKINT i, t_CKCOMPLEX * val )
 // name: get()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_ArrayVec2::get( const string & key, t_CKVEC2 * val )
+t_CKINT Chuck_ArrayVec2::get( const string & key, t_CKVEC2 * val, t_CKUINT hash )
 {
     // set to zero
     val->x = 0;
     val->y = 0;
 
-    // iterator
-    map<string, t_CKVEC2>::iterator iter = m_map.find( key );
+    // find
+    t_CKVEC2 * v = m_index.find( key, hash );
 
     // check
-    if( iter != m_map.end() )
+    if( v )
     {
         // get the value
-        *val = (*iter).second;
+        *val = *v;
     }
 
     // return good
     return 1;
 }
 // redirect as vec2
-t_CKINT Chuck_ArrayVec2::get( const string & key, t_CKCOMPLEX * val )
+t_CKINT Chuck_ArrayVec2::get( const string & key, t_CKCOMPLEX * val, t_CKUINT hash )
 { return this->get( key, (t_CKVEC2 *)val ); }
 
 
@@ -1791,7 +2164,7 @@ t_CKINT Chuck_ArrayVec2::set( const string & key, const t_CKVEC2 & val )
 
     // 1.3.5.3: removed this
     // if( val.re == 0 && val.im == 0 ) m_map.erase( key ); else
-    m_map[key] = val;
+    m_index.at( m_map, key ) = val;
 
     // return good
     return 1;
@@ -1829,7 +2202,7 @@ t_CKINT Chuck_ArrayVec2::insert( t_CKINT i, const t_CKVEC2 & val )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayVec2::map_find( const string & key )
 {
-    return m_map.find( key ) != m_map.end();
+    return m_index.find( key ) != NULL;
 }
 
 
@@ -1840,7 +2213,7 @@ t_CKINT Chuck_ArrayVec2::map_find( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayVec2::map_erase( const string & key )
 {
-    return m_map.erase( key );
+    return m_index.erase( m_map, key );
 }
 
 
@@ -2252,10 +2625,10 @@ t_CKUINT Chuck_ArrayVec3::addr( t_CKINT i )
 // name: addr()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_ArrayVec3::addr( const string & key )
+t_CKUINT Chuck_ArrayVec3::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_index.at( m_map, key, hash ));
 }
 
 
@@ -2285,19 +2658,19 @@ t_CKINT Chuck_ArrayVec3::get( t_CKINT i, t_CKVEC3 * val )
 // name: get()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_ArrayVec3::get( const string & key, t_CKVEC3 * val )
+t_CKINT Chuck_ArrayVec3::get( const string & key, t_CKVEC3 * val, t_CKUINT hash )
 {
     // set to zero
     val->x = val->y = val->z = 0;
 
-    // iterator
-    map<string, t_CKVEC3>::iterator iter = m_map.find( key );
+    // find
+    t_CKVEC3 * v = m_index.find( key, hash );
 
     // check
-    if( iter != m_map.end() )
+    if( v )
     {
         // get the value
-        *val = (*iter).second;
+        *val = *v;
     }
 
     // return good
@@ -2337,7 +2710,7 @@ t_CKINT Chuck_ArrayVec3::set( const string & key, const t_CKVEC3 & val )
     // map<string, t_CKVEC3>::iterator iter = m_map.find( key );
 
     // insert
-    m_map[key] = val;
+    m_index.at( m_map, key ) = val;
 
     // return good
     return 1;
@@ -2372,7 +2745,7 @@ t_CKINT Chuck_ArrayVec3::insert( t_CKINT i, const t_CKVEC3 & val )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayVec3::map_find( const string & key )
 {
-    return m_map.find( key ) != m_map.end();
+    return m_index.find( key ) != NULL;
 }
 
 
@@ -2383,7 +2756,7 @@ t_CKINT Chuck_ArrayVec3::map_find( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayVec3::map_erase( const string & key )
 {
-    return m_map.erase( key );
+    return m_index.erase( m_map, key );
 }
 
 
@@ -2742,10 +3115,10 @@ t_CKUINT Chuck_ArrayVec4::addr( t_CKINT i )
 // name: addr()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKUINT Chuck_ArrayVec4::addr( const string & key )
+t_CKUINT Chuck_ArrayVec4::addr( const string & key, t_CKUINT hash )
 {
     // get the addr
-    return (t_CKUINT)(&m_map[key]);
+    return (t_CKUINT)(&m_index.at( m_map, key, hash ));
 }
 
 
@@ -2775,19 +3148,19 @@ t_CKINT Chuck_ArrayVec4::get( t_CKINT i, t_CKVEC4 * val )
 // name: get()
 // desc: ...
 //-----------------------------------------------------------------------------
-t_CKINT Chuck_ArrayVec4::get( const string & key, t_CKVEC4 * val )
+t_CKINT Chuck_ArrayVec4::get( const string & key, t_CKVEC4 * val, t_CKUINT hash )
 {
     // set to zero
     val->x = val->y = val->z = val->w = 0;
 
-    // iterator
-    map<string, t_CKVEC4>::iterator iter = m_map.find( key );
+    // find
+    t_CKVEC4 * v = m_index.find( key, hash );
 
     // check
-    if( iter != m_map.end() )
+    if( v )
     {
         // get the value
-        *val = (*iter).second;
+        *val = *v;
     }
 
     // return good
@@ -2830,7 +3203,7 @@ t_CKINT Chuck_ArrayVec4::set( const string & key, const t_CKVEC4 & val )
     // if( val.re == 0 && val.im == 0 ) m_map.erase( key ); else
 
     // insert
-    m_map[key] = val;
+    m_index.at( m_map, key ) = val;
 
     // return good
     return 1;
@@ -2865,7 +3238,7 @@ t_CKINT Chuck_ArrayVec4::insert( t_CKINT i, const t_CKVEC4 & val )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayVec4::map_find( const string & key )
 {
-    return m_map.find( key ) != m_map.end();
+    return m_index.find( key ) != NULL;
 }
 
 
@@ -2876,7 +3249,7 @@ t_CKINT Chuck_ArrayVec4::map_find( const string & key )
 //-----------------------------------------------------------------------------
 t_CKINT Chuck_ArrayVec4::map_erase( const string & key )
 {
-    return m_map.erase( key );
+    return m_index.erase( m_map, key );
 }
 
 
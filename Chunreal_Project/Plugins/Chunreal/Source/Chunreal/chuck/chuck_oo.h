@@ -44,7 +44,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <queue>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 
 
@@ -66,6 +70,145 @@ class  CBufferSimple;
 
 
 
+//-----------------------------------------------------------------------------
+// pool size classes | 1.5.5.3 added
+//-----------------------------------------------------------------------------
+// granularity of size classes, in bytes (also the block alignment)
+#define CK_POOL_GRANULARITY     16
+// largest block (including header) served from a size class; larger
+// requests fall through to the system allocator
+#define CK_POOL_MAX_BLOCK_SIZE  1024
+// number of size classes
+#define CK_POOL_NUM_CLASSES     (CK_POOL_MAX_BLOCK_SIZE / CK_POOL_GRANULARITY)
+// bytes per slab; each slab is carved into blocks of a single size class
+#define CK_POOL_SLAB_SIZE       16384
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Pool_Stats | 1.5.5.3 added
+// desc: memory usage statistics for a Chuck_VM_Pool
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Pool_Stats
+{
+    // bytes obtained from the system for slabs
+    t_CKUINT bytes_reserved;
+    // bytes currently handed out (including headers and oversized blocks)
+    t_CKUINT bytes_in_use;
+    // high-water mark of bytes_in_use
+    t_CKUINT bytes_peak;
+    // number of blocks currently handed out
+    t_CKUINT num_live;
+    // total number of allocations / deallocations
+    t_CKUINT num_allocs;
+    t_CKUINT num_frees;
+    // allocations too large for a size class (served by system allocator)
+    t_CKUINT num_oversized;
+    // number of slabs allocated
+    t_CKUINT num_slabs;
+    // allocations avoided by reusing scratch objects and concatenating
+    // strings in place (see chuck_escape.h)
+    t_CKUINT num_avoided;
+
+    // constructor
+    Chuck_VM_Pool_Stats() { clear(); }
+    // zero out
+    void clear() { memset( this, 0, sizeof(*this) ); }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Pool | 1.5.5.3 added
+// desc: per-VM, size-class slab allocator for VM objects and their data
+//       segments; every block is prefixed with a small header recording
+//       its originating pool (NULL for system-allocated blocks), so any
+//       block can be returned with deallocate() without knowing its origin
+//       NOTE: a pool is owned by the thread running its VM (see enter());
+//       only the owner may allocate from it; blocks released on any other
+//       thread are queued and reclaimed by the owner on its next enter()
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Pool
+{
+public:
+    // constructor
+    Chuck_VM_Pool();
+
+public:
+    // allocate at least 'size' bytes; if pool is NULL, uses system allocator
+    static void * allocate( Chuck_VM_Pool * pool, t_CKUINT size );
+    // return memory obtained from allocate() to wherever it came from
+    static void deallocate( void * ptr );
+    // get the pool a block was allocated from (NULL if system-allocated)
+    static Chuck_VM_Pool * pool_of( void * ptr );
+
+public:
+    // detach from owner; the pool reclaims itself (and its slabs) as soon
+    // as every outstanding block has been returned
+    void detach();
+    // get memory usage statistics
+    const Chuck_VM_Pool_Stats & stats() const { return m_stats; }
+    // count an allocation that was avoided (on the owning thread)
+    void avoided() { if( owned() ) m_stats.num_avoided++; }
+    // called by the VM thread before each run: takes ownership of the
+    // pool and reclaims blocks released from other threads
+    void enter();
+    // whether the calling thread owns this pool (may allocate from it)
+    t_CKBOOL owned() const { return m_owner.load( std::memory_order_relaxed ) == std::this_thread::get_id(); }
+
+protected:
+    // destructor (use detach() instead)
+    ~Chuck_VM_Pool();
+    // allocate a block of the given size class
+    void * alloc_block( t_CKUINT cls );
+    // return a block to the given size class
+    void free_block( void * block, t_CKUINT cls );
+    // carve a new slab for the given size class
+    t_CKBOOL grow( t_CKUINT cls );
+    // return a block (with header) to this pool and update stats
+    void release( void * hdr );
+    // release a block from a thread other than the owner
+    void defer( void * hdr );
+    // release blocks queued by defer(); caller must hold m_deferred_mutex
+    void reclaim_deferred();
+
+protected:
+    // free list per size class (linked through the blocks themselves)
+    void * m_free[CK_POOL_NUM_CLASSES];
+    // slabs obtained from the system
+    std::vector<void *> m_slabs;
+    // statistics
+    Chuck_VM_Pool_Stats m_stats;
+    // whether the owner has let go of this pool
+    t_CKBOOL m_detached;
+    // thread running the VM (no thread until the first enter())
+    std::atomic<std::thread::id> m_owner;
+    // blocks released from other threads, linked through the blocks
+    void * m_deferred;
+    // whether m_deferred is non-empty (checked without locking)
+    std::atomic<t_CKBOOL> m_has_deferred;
+    // protects m_deferred, and everything once detached
+    std::mutex m_deferred_mutex;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// refcount operations counter | 1.5.5.3 added
+// counted only when __CHUCK_REFCOUNT_STATS__ is defined (e.g., from makefile)
+//-----------------------------------------------------------------------------
+#if defined(__CHUCK_REFCOUNT_STATS__)
+  #define CK_REFCOUNT_OP() (Chuck_VM_Object::our_refcount_ops++)
+#else
+  #define CK_REFCOUNT_OP()
+#endif
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: struct Chuck_VM_Object
 // desc: base vm object
@@ -77,19 +220,60 @@ public:
     virtual ~Chuck_VM_Object();
 
 public:
-    // add reference (ge: april 2013: made these virtual)
-    virtual void add_ref();
+    // allocation, routed through Chuck_VM_Pool | 1.5.5.3 added
+    // new Chuck_X allocates from the system; new( pool ) Chuck_X from pool
+    static void * operator new( size_t size );
+    static void * operator new( size_t size, Chuck_VM_Pool * pool );
+    // deallocation (returns memory to originating pool, if any)
+    static void operator delete( void * ptr );
+    static void operator delete( void * ptr, Chuck_VM_Pool * pool );
+
+public:
+    // add reference
+    // 1.5.5.3: inline and non-virtual (were virtual since april 2013);
+    // VM objects are confined to their VM's thread, so no atomics needed
+    void add_ref()
+    {
+        CK_REFCOUNT_OP();
+    #ifndef __CHUCK_DEBUG__
+        m_ref_count++;
+    #else
+        add_ref_debug();
+    #endif
+    }
     // decrement reference; deletes objects when refcount reaches 0
-    virtual void release();
+    void release()
+    {
+        CK_REFCOUNT_OP();
+    #ifndef __CHUCK_DEBUG__
+        // fast path: object remains referenced
+        if( m_ref_count > 1 ) { m_ref_count--; return; }
+    #endif
+        // last reference (or debug tracking)
+        release_slow();
+    }
     // decrement reference only; no deletion | 1.5.4.3 (ge) added
-    virtual void dec_ref_no_release();
+    void dec_ref_no_release() { CK_REFCOUNT_OP(); if( m_ref_count > 0 ) m_ref_count--; }
     // lock
     virtual void lock();
     // unlock | 1.5.0.0 (ge) added
     virtual void unlock();
 
-    // NOTE: be careful when overriding these, should always
-    // explicitly call up to ChucK_VM_Object (ge: 2013)
+    // NOTE: add_ref() and release() are no longer virtual; the only virtual
+    // dispatch on release is the destructor, when the last reference goes;
+    // be careful when overriding lock/unlock, should always explicitly
+    // call up to ChucK_VM_Object (ge: 2013)
+
+public:
+    // number of refcount operations performed (if __CHUCK_REFCOUNT_STATS__)
+    static t_CKUINT refcount_ops() { return our_refcount_ops; }
+    static t_CKUINT our_refcount_ops;
+
+protected:
+    // release slow path: last reference; also debug tracking | 1.5.5.3
+    void release_slow();
+    // add_ref with debug tracking | 1.5.5.3
+    void add_ref_debug();
 
 public:
     // get reference count
@@ -103,7 +287,7 @@ public:
 
 public:
     t_CKUINT m_ref_count; // reference count
-    t_CKBOOL m_pooled; // if true, this allocates from a pool
+    t_CKBOOL m_pooled; // if true, this was allocated from a Chuck_VM_Pool
     t_CKBOOL m_locked; // if true, this should never be deleted
 
 private:
@@ -176,6 +360,80 @@ public: // static
 
 
 
+//-----------------------------------------------------------------------------
+// name: ck_strhash() | 1.5.5.3 (added)
+// desc: hash of a string key (FNV-1a); never 0, so 0 can mean "not yet
+//       computed" (see Chuck_String::hash())
+//-----------------------------------------------------------------------------
+inline t_CKUINT ck_strhash( const std::string & s )
+{
+    t_CKUINT h = (t_CKUINT)14695981039346656037ULL;
+    for( size_t i = 0; i < s.size(); i++ )
+    { h ^= (unsigned char)s[i]; h *= (t_CKUINT)1099511628211ULL; }
+    return h ? h : 1;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Map_Index | 1.5.5.3 (added)
+// desc: hashed index over the keys of an associative array; the std::map
+//       still holds the elements (keeping getKeys() in sorted order), and
+//       the index points into its nodes, so a lookup is one hash probe and
+//       one compare instead of O(log n) string compares; pass the hash when
+//       it is already known (e.g., Chuck_String::hash()), or 0 to compute
+//       NOTE all insertions/erasures must go through the index
+//-----------------------------------------------------------------------------
+template <typename T>
+struct Chuck_Map_Index
+{
+    typedef std::map<std::string, T> Map;
+
+    // find element; NULL if not present
+    T * find( const std::string & key, t_CKUINT hash = 0 ) const
+    {
+        Key k = { &key, hash ? hash : ck_strhash( key ) };
+        typename Index::const_iterator it = m_index.find( k );
+        return it != m_index.end() ? it->second : NULL;
+    }
+
+    // find element, inserting a zeroed one if not present
+    T & at( Map & map, const std::string & key, t_CKUINT hash = 0 )
+    {
+        if( !hash ) hash = ck_strhash( key );
+        T * v = find( key, hash );
+        if( v ) return *v;
+        // insert into map; the index keys off the node's own string
+        typename Map::iterator it = map.insert( typename Map::value_type( key, T() ) ).first;
+        Key k = { &it->first, hash };
+        m_index[k] = &it->second;
+        return it->second;
+    }
+
+    // erase element; returns whether it was present
+    t_CKBOOL erase( Map & map, const std::string & key, t_CKUINT hash = 0 )
+    {
+        Key k = { &key, hash ? hash : ck_strhash( key ) };
+        // out of the index first (its key points into the map node)
+        if( !m_index.erase( k ) ) return FALSE;
+        map.erase( key );
+        return TRUE;
+    }
+
+protected:
+    // key string (owned by a map node, or the caller when probing) + hash
+    struct Key { const std::string * str; t_CKUINT hash; };
+    struct Hash { size_t operator()( const Key & k ) const { return (size_t)k.hash; } };
+    struct Equal { bool operator()( const Key & a, const Key & b ) const
+                   { return a.hash == b.hash && *a.str == *b.str; } };
+    typedef std::unordered_map<Key, T *, Hash, Equal> Index;
+    Index m_index;
+};
+
+
+
+
 // ISSUE: 64-bit (fixed 1.3.1.0)
 #define CHUCK_ARRAYINT_DATASIZE sz_INT
 #define CHUCK_ARRAYFLOAT_DATASIZE sz_FLOAT
@@ -274,12 +532,12 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKUINT * val );
-    t_CKINT get( const std::string & key, t_CKUINT * val );
+    t_CKINT get( const std::string & key, t_CKUINT * val, t_CKUINT hash = 0 );
     t_CKINT get( t_CKINT i, t_CKINT * val ); // signed | 1.5.2.0
-    t_CKINT get( const std::string & key, t_CKINT * val ); // signed | 1.5.2.0
+    t_CKINT get( const std::string & key, t_CKINT * val, t_CKUINT hash = 0 ); // signed | 1.5.2.0
     // set value
     t_CKINT set( t_CKINT i, t_CKUINT val );
     t_CKINT set( const std::string & key, t_CKUINT val );
@@ -347,6 +605,8 @@ public: // map only
 public:
     std::vector<t_CKUINT> m_vector;
     std::map<std::string, t_CKUINT> m_map;
+    // hashed index into m_map | 1.5.5.3
+    Chuck_Map_Index<t_CKUINT> m_index;
     t_CKBOOL m_is_obj;
 
     // TODO: may need additional information here for set_size, if this is part of a multi-dim array
@@ -372,10 +632,10 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKFLOAT * val );
-    t_CKINT get( const std::string & key, t_CKFLOAT * val );
+    t_CKINT get( const std::string & key, t_CKFLOAT * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, t_CKFLOAT val );
     t_CKINT set( const std::string & key, t_CKFLOAT val );
@@ -440,6 +700,8 @@ public: // map only
 public:
     std::vector<t_CKFLOAT> m_vector;
     std::map<std::string, t_CKFLOAT> m_map;
+    // hashed index into m_map | 1.5.5.3
+    Chuck_Map_Index<t_CKFLOAT> m_index;
     // t_CKINT m_size;
     // t_CKINT m_capacity;
 };
@@ -461,12 +723,12 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKVEC2 * val );
     t_CKINT get( t_CKINT i, t_CKCOMPLEX * val );
-    t_CKINT get( const std::string & key, t_CKVEC2 * val );
-    t_CKINT get( const std::string & key, t_CKCOMPLEX * val );
+    t_CKINT get( const std::string & key, t_CKVEC2 * val, t_CKUINT hash = 0 );
+    t_CKINT get( const std::string & key, t_CKCOMPLEX * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, const t_CKVEC2 & val );
     t_CKINT set( t_CKINT i, const t_CKCOMPLEX & val );
@@ -533,6 +795,8 @@ public: // map only
 public:
     std::vector<t_CKVEC2> m_vector;
     std::map<std::string, t_CKVEC2> m_map;
+    // hashed index into m_map | 1.5.5.3
+    Chuck_Map_Index<t_CKVEC2> m_index;
     // semantic hint; in certain situations (like sorting)
     // need to distinguish between complex and polar | 1.5.1.0
     t_CKBOOL m_isPolarType;
@@ -555,10 +819,10 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKVEC3 * val );
-    t_CKINT get( const std::string & key, t_CKVEC3 * val );
+    t_CKINT get( const std::string & key, t_CKVEC3 * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, const t_CKVEC3 & val );
     t_CKINT set( const std::string & key, const t_CKVEC3 & val );
@@ -623,6 +887,8 @@ public: // map only
 public:
     std::vector<t_CKVEC3> m_vector;
     std::map<std::string, t_CKVEC3> m_map;
+    // hashed index into m_map | 1.5.5.3
+    Chuck_Map_Index<t_CKVEC3> m_index;
 };
 
 
@@ -642,10 +908,10 @@ public:
 public: // specific to this class
     // get address
     t_CKUINT addr( t_CKINT i );
-    t_CKUINT addr( const std::string & key );
+    t_CKUINT addr( const std::string & key, t_CKUINT hash = 0 );
     // get value
     t_CKINT get( t_CKINT i, t_CKVEC4 * val );
-    t_CKINT get( const std::string & key, t_CKVEC4 * val );
+    t_CKINT get( const std::string & key, t_CKVEC4 * val, t_CKUINT hash = 0 );
     // set value
     t_CKINT set( t_CKINT i, const t_CKVEC4 & val );
     t_CKINT set( const std::string & key, const t_CKVEC4 & val );
@@ -710,6 +976,8 @@ public: // map only
 public:
     std::vector<t_CKVEC4> m_vector;
     std::map<std::string, t_CKVEC4> m_map;
+    // hashed index into m_map | 1.5.5.3
+    Chuck_Map_Index<t_CKVEC4> m_index;
 };
 
 
@@ -816,7 +1084,11 @@ public:
     virtual ~Chuck_String() { }
 
     // set string (makes copy)
-    void set( const std::string & s ) { m_str = s; m_charptr = m_str.c_str(); }
+    void set( const std::string & s ) { m_str = s; m_charptr = m_str.c_str(); m_hash = 0; }
+    // append to string | 1.5.5.3 added
+    void append( const std::string & s ) { m_str += s; m_charptr = m_str.c_str(); m_hash = 0; }
+    // hash of contents, cached until the string changes | 1.5.5.3 added
+    t_CKUINT hash() { if( !m_hash ) m_hash = ck_strhash( m_str ); return m_hash; }
     // get as standard c++ string
     const std::string & str() { return m_str; }
     // get as C string (NOTE: use this in dynamical modules like chugins!)
@@ -827,6 +1099,8 @@ private:
     const char * m_charptr; // REFACTOR-2017
     // c++ string
     std::string m_str;
+    // cached ck_strhash() of m_str; 0 if not yet computed
+    t_CKUINT m_hash;
 };
 
 
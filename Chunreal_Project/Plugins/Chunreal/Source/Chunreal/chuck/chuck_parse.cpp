@@ -49,36 +49,6 @@ using namespace std;
 
 
 
-//-----------------------------------------------------------------------------
-// external from lexer
-//-----------------------------------------------------------------------------
-extern "C" {
-    extern FILE * yyin;
-}
-
-
-
-
-//-----------------------------------------------------------------------------
-// name: cleanup_AST()
-// desc: clean up the abstract syntax tree
-//-----------------------------------------------------------------------------
-static void cleanup_AST()
-{
-    // check
-    if( !g_program ) return;
-
-    // log
-    EM_log( CK_LOG_FINE, "cleaning up abstract syntax tree..." );
-    // do it
-    delete_program( g_program );
-    // reset to NULL
-    g_program = NULL;
-}
-
-
-
-
 //-----------------------------------------------------------------------------
 // name: chuck_parse()
 // desc: INPUT: chuck code (either from file or actual code) to be parsed
@@ -90,10 +60,14 @@ t_CKBOOL chuck_parse( Chuck_CompileTarget * target )
     t_CKBOOL ret = FALSE;
     // file descriptor (should be open if compiling from file)
     FILE * fd = target->fd2parse;
+    // this parse's scanner and program | 1.5.5.3
+    a_Parse_ state = { NULL, NULL };
     // our own lexer/parser buffer
     YY_BUFFER_STATE yyCodeBuffer = NULL;
     // where the code is coming from
     CompileFileSource source;
+    // previously current AST arena, and whether we replaced it
+    a_Arena prevArena = NULL; t_CKBOOL arenaCurrent = FALSE;
 
     // check for conflict
     if( fd && target->codeLiteral != "" )
@@ -106,14 +80,14 @@ t_CKBOOL chuck_parse( Chuck_CompileTarget * target )
     // if actual code was passed in
     if( target->codeLiteral != "" )
     {
-        // clean lexer
-        yyrestart( NULL );
-        // set to initial condition | 1.5.2.4 (ge) added
-        yyinitial();
+        // a fresh lexer | 1.5.5.3 one per parse
+        if( yylex_init_extra( &state, &state.scanner ) ) goto cleanup;
         // load string (yy_scan_string will copy the C string)
-        yyCodeBuffer = yy_scan_string( target->codeLiteral.c_str() );
+        yyCodeBuffer = yy_scan_string( target->codeLiteral.c_str(), state.scanner );
         // if could not load
         if( !yyCodeBuffer ) goto cleanup;
+        // set to initial condition | 1.5.2.4 (ge) added
+        yyinitial( state.scanner );
         // set source
         source.setCode( target->codeLiteral.c_str() );
     }
@@ -121,13 +95,12 @@ t_CKBOOL chuck_parse( Chuck_CompileTarget * target )
     {
         // set to beginning
         fseek( fd, 0, SEEK_SET );
-        // reset yyin to fd
-        yyrestart( fd );
+        // a fresh lexer | 1.5.5.3 one per parse
+        if( yylex_init_extra( &state, &state.scanner ) ) goto cleanup;
+        // read from fd
+        yyrestart( fd, state.scanner );
         // set to initial condition | 1.5.0.5 (ge) added
-        yyinitial();
-
-        // check
-        if( yyin == NULL ) goto cleanup;
+        yyinitial( state.scanner );
 
         // set source
         source.setFile( fd );
@@ -146,24 +119,32 @@ t_CKBOOL chuck_parse( Chuck_CompileTarget * target )
 
     // ensure abstract syntax tree is clean | 1.5.0.5 (ge) added, finally
     target->cleanupAST();
+    // allocate the tree (and lexer strings) from an arena owned by target | 1.5.5.3
+    target->arena = new_arena();
+    prevArena = arena_make_current( target->arena ); arenaCurrent = TRUE;
 
     // parse
-    if( !(yyparse() == 0) ) goto cleanup;
+    if( !(yyparse( state.scanner ) == 0) ) goto cleanup;
 
+    // the tree, owned by target from here
+    target->AST = state.program;
     // flag success
     ret = TRUE;
 
 cleanup:
 
-    // flush
-    // yyflush();
+    // restore allocation from heap | 1.5.5.3
+    if( arenaCurrent ) arena_make_current( prevArena );
 
-    // set to NULL | 1.5.0.5 (ge) added to reset yyin
-    yyin = NULL;
+    // flush
+    // yyflush( state.scanner );
 
     // clean up lexer buffer, if we used one
     if( yyCodeBuffer )
-    { yy_delete_buffer( yyCodeBuffer ); yyCodeBuffer = NULL; }
+    { yy_delete_buffer( yyCodeBuffer, state.scanner ); yyCodeBuffer = NULL; }
+    // and the lexer (the file, if any, stays with target) | 1.5.5.3
+    if( state.scanner )
+    { yylex_destroy( state.scanner ); state.scanner = NULL; }
 
     return ret;
 }
@@ -41,23 +41,19 @@
 #include <string>
 
 
-// 'C' specification necessary for windows to link properly
-#ifdef __PLATFORM_WINDOWS__
-  extern "C" a_Program g_program;
-#else
-  extern a_Program g_program;
-#endif
-
-// link with the parser
-extern "C" int yyparse( void );
-extern "C" void yyrestart( FILE * );
-extern "C" void yyinitial( void );
-extern "C" void yyflush( void );
+// link with the parser and scanner (chuck_yacc.c); all their state is in
+// the scanner made by yylex_init_extra(), so parses can run in parallel
+extern "C" int yyparse( void * scanner );
+extern "C" int yylex_init_extra( a_Parse parse, void ** scanner );
+extern "C" int yylex_destroy( void * scanner );
+extern "C" void yyrestart( FILE *, void * scanner );
+extern "C" void yyinitial( void * scanner );
+extern "C" void yyflush( void * scanner );
 
 struct yy_buffer_state;
 typedef yy_buffer_state * YY_BUFFER_STATE;
-extern "C" YY_BUFFER_STATE yy_scan_string( const char * );
-extern "C" void yy_delete_buffer( YY_BUFFER_STATE );
+extern "C" YY_BUFFER_STATE yy_scan_string( const char *, void * scanner );
+extern "C" void yy_delete_buffer( YY_BUFFER_STATE, void * scanner );
 
 // forward reference
 struct Chuck_CompileTarget;
@@ -39,26 +39,53 @@
 #if defined(__CHUCK_STAT_TRACK__)
 
 #include "chuck_vm.h"
+#include <string.h>
 using namespace std;
 
-// static members
-Chuck_Stats * Chuck_Stats::our_instance = NULL;
-t_CKBOOL Chuck_Stats::activations_yes = FALSE;
+
+
+
+//-----------------------------------------------------------------------------
+// name: clear()
+// desc: reset everything but sequence and state
+//-----------------------------------------------------------------------------
+void Shred_Stat::clear()
+{
+    xid = 0; parent = 0; cycles = 0; activations = 0;
+    average_ctrl = 0.0; average_cycles = 0.0;
+    spork_time = 0.0; active_time = 0.0; wake_time = 0.0; free_time = 0.0;
+    name[0] = '\0';
+    for( t_CKUINT i = 0; i < CK_STATS_NUM_ACTIVATIONS; i++ )
+    { act_when[i] = 0.0; act_cycles[i] = 0; }
+    act_count = 0;
+    cycles_now = 0; last_cycles = 0;
+    num_diffs = 0; diff_total = 0.0;
+    num_exe = 0; exe_total = 0;
+}
+
+
 
 
 //-----------------------------------------------------------------------------
-// name: instance()
+// name: Chuck_Stats()
 // desc: ...
 //-----------------------------------------------------------------------------
-Chuck_Stats * Chuck_Stats::instance()
+Chuck_Stats::Chuck_Stats( Chuck_VM * vm )
 {
-    if( !our_instance )
-    {
-        our_instance = new Chuck_Stats;
-        assert( our_instance );
-    }
+    m_vm = vm;
+    m_next = 0;
+    m_dropped = 0;
+}
+
+
+
 
-    return our_instance;
+//-----------------------------------------------------------------------------
+// name: ~Chuck_Stats()
+// desc: ...
+//-----------------------------------------------------------------------------
+Chuck_Stats::~Chuck_Stats()
+{
 }
 
 
@@ -66,43 +93,53 @@ Chuck_Stats * Chuck_Stats::instance()
 
 //-----------------------------------------------------------------------------
 // name: add_shred()
-// desc: ...
+// desc: claim a slot for a new shred
 //-----------------------------------------------------------------------------
 void Chuck_Stats::add_shred( Chuck_VM_Shred * shred )
 {
-    assert( vm != NULL );
-    assert( shred->stat == NULL );
     assert( shred->xid != 0 );
 
-    Shred_Stat * stat = new Shred_Stat;
-    stat->xid = shred->xid;
-    stat->parent = shred->parent ? shred->parent->xid : 0;
-    stat->state = 0; // inactive
-    stat->shred_ref = shred;
-    stat->spork_time = shred->wake_time;
-    stat->wake_time = shred->wake_time;
-    stat->name = shred->name;
-    stat->owner = "noone";
-    stat->source = "remote";
-    if( strncmp( shred->name.c_str(), "editor->", 8 ) == 0 )
+    // find a free slot: never used, or holding a deleted shred
+    Shred_Stat * stat = NULL;
+    for( t_CKUINT i = 0; i < CK_STATS_MAX_SHREDS; i++ )
     {
-        stat->name = shred->name.c_str() + 8;
-        stat->source = "editor";
+        Shred_Stat * s = &m_shreds[(m_next + i) % CK_STATS_MAX_SHREDS];
+        if( s->sequence.load( std::memory_order_relaxed ) == 0 ||
+            s->state.load( std::memory_order_relaxed ) == 3 )
+        {
+            stat = s;
+            m_next = (m_next + i + 1) % CK_STATS_MAX_SHREDS;
+            break;
+        }
     }
-    if( shred->parent )
+
+    // all slots live
+    if( !stat )
     {
-        Shred_Stat * another = shreds[shred->parent->xid];
-        another->mutex.acquire();
-        another->children.push_back( stat );
-        another->mutex.release();
+        m_dropped.fetch_add( 1, std::memory_order_relaxed );
+        shred->stat = NULL;
+        return;
     }
 
+    // claim: sequence goes odd while identity is rewritten
+    t_CKUINT seq = stat->sequence.load( std::memory_order_relaxed );
+    stat->sequence.store( seq + 1, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_release );
+
+    stat->clear();
+    stat->state.store( 0, std::memory_order_relaxed ); // inactive
+    stat->xid.store( shred->xid, std::memory_order_relaxed );
+    stat->parent.store( shred->parent ? shred->parent->xid : 0, std::memory_order_relaxed );
+    stat->spork_time.store( shred->wake_time, std::memory_order_relaxed );
+    stat->wake_time.store( shred->wake_time, std::memory_order_relaxed );
+    strncpy( stat->name, shred->name.c_str(), CK_STATS_NAME_LENGTH - 1 );
+    stat->name[CK_STATS_NAME_LENGTH - 1] = '\0';
+
+    // publish
+    stat->sequence.store( seq + 2, std::memory_order_release );
+
     // attach to shred
     shred->stat = stat;
-    // add
-    mutex.acquire();
-    shreds[shred->xid] = stat;
-    mutex.release();
 }
 
 
@@ -114,17 +151,16 @@ void Chuck_Stats::add_shred( Chuck_VM_Shred * shred )
 //-----------------------------------------------------------------------------
 void Chuck_Stats::activate_shred( Chuck_VM_Shred * shred )
 {
-    assert( vm !=  NULL );
-    //assert( shred->stat != NULL );
-    //assert( shred->id != 0 );
-
     Shred_Stat * stat = shred->stat;
+    if( !stat ) return;
+
     // set active state
-    stat->state = 1;  // active
+    stat->state.store( 1, std::memory_order_relaxed );
     // increment activations
-    stat->activations++;
+    stat->activations.store( stat->activations.load( std::memory_order_relaxed ) + 1,
+                             std::memory_order_relaxed );
     // set the active time
-    stat->active_time = shred->wake_time;
+    stat->active_time.store( shred->wake_time, std::memory_order_relaxed );
 }
 
 
@@ -136,25 +172,22 @@ void Chuck_Stats::activate_shred( Chuck_VM_Shred * shred )
 //-----------------------------------------------------------------------------
 void Chuck_Stats::advance_time( Chuck_VM_Shred * shred, t_CKTIME to )
 {
-    assert( vm != NULL );
-
     Shred_Stat * stat = shred->stat;
+    if( !stat ) return;
+
     // set the wake_time
-    stat->wake_time = to;
+    stat->wake_time.store( to, std::memory_order_relaxed );
     // find the period
-    t_CKDUR diff = stat->wake_time - stat->active_time;
-    // add to diffs
+    t_CKDUR diff = to - stat->active_time.load( std::memory_order_relaxed );
+    // replace the oldest of the last CK_STATS_NUM_DIFFS
+    t_CKDUR & slot = stat->diffs[stat->num_diffs % CK_STATS_NUM_DIFFS];
+    if( stat->num_diffs >= CK_STATS_NUM_DIFFS ) stat->diff_total -= slot;
+    slot = diff;
     stat->diff_total += diff;
-    // put in queue
-    stat->diffs.push( diff );
-    // subtract
-    if( stat->diffs.size() > stat->num_diffs )
-    {
-        stat->diff_total -= stat->diffs.front();
-        stat->diffs.pop();
-    }
+    stat->num_diffs++;
     // calculate average
-    stat->average_ctrl = stat->diff_total / stat->diffs.size();
+    stat->average_ctrl.store( stat->diff_total / ck_min( stat->num_diffs, (t_CKUINT)CK_STATS_NUM_DIFFS ),
+                              std::memory_order_relaxed );
 }
 
 
@@ -166,33 +199,30 @@ void Chuck_Stats::advance_time( Chuck_VM_Shred * shred, t_CKTIME to )
 //-----------------------------------------------------------------------------
 void Chuck_Stats::deactivate_shred( Chuck_VM_Shred * shred )
 {
-    assert( vm != NULL );
-
     Shred_Stat * stat = shred->stat;
-    // get diff
-    t_CKUINT diff = stat->cycles - stat->last_cycles;
+    if( !stat ) return;
+
+    // cycles this activation
+    t_CKUINT diff = stat->cycles_now - stat->last_cycles;
+    stat->last_cycles = stat->cycles_now;
     // set active state
-    stat->state = 2;
-    // find average
-    stat->act_cycles.push( diff );
-    // add to total
-    stat->act_cycles_total += diff;
-    // subtract
-    if( stat->act_cycles.size() > stat->num_diffs )
-    {
-        stat->act_cycles_total -= stat->act_cycles.front();
-        stat->act_cycles.pop();
-    }
+    stat->state.store( 2, std::memory_order_relaxed );
+    stat->cycles.store( stat->cycles_now, std::memory_order_relaxed );
+    // replace the oldest of the last CK_STATS_NUM_DIFFS
+    t_CKUINT & slot = stat->exe_cycles[stat->num_exe % CK_STATS_NUM_DIFFS];
+    if( stat->num_exe >= CK_STATS_NUM_DIFFS ) stat->exe_total -= slot;
+    slot = diff;
+    stat->exe_total += diff;
+    stat->num_exe++;
     // the average
-    stat->average_cycles = (t_CKFLOAT)stat->act_cycles_total / stat->act_cycles.size();
-    // remember the cycle count
-    stat->last_cycles = stat->cycles;
-    if( activations_yes )
-    {
-        stat->mutex.acquire();
-        stat->activationss.push_back( Shred_Activation( vm->shreduler()->now_system, diff ) );
-        stat->mutex.release();
-    }
+    stat->average_cycles.store( (t_CKFLOAT)stat->exe_total / ck_min( stat->num_exe, (t_CKUINT)CK_STATS_NUM_DIFFS ),
+                                std::memory_order_relaxed );
+
+    // record activation; entries first, then count (release)
+    t_CKUINT n = stat->act_count.load( std::memory_order_relaxed );
+    stat->act_when[n % CK_STATS_NUM_ACTIVATIONS].store( m_vm->shreduler()->now_system, std::memory_order_relaxed );
+    stat->act_cycles[n % CK_STATS_NUM_ACTIVATIONS].store( diff, std::memory_order_relaxed );
+    stat->act_count.store( n + 1, std::memory_order_release );
 }
 
 
@@ -200,69 +230,94 @@ void Chuck_Stats::deactivate_shred( Chuck_VM_Shred * shred )
 
 //-----------------------------------------------------------------------------
 // name: remove_shred()
-// desc: ...
+// desc: mark deleted; the slot is kept for readers until reused
 //-----------------------------------------------------------------------------
 void Chuck_Stats::remove_shred( Chuck_VM_Shred * shred )
 {
-    assert( vm != NULL );
-
     Shred_Stat * stat = shred->stat;
-    // set state
-    stat->state = 3;  // deleted
+    if( !stat ) return;
+
     // set free time
-    stat->free_time = vm->shreduler()->now_system;
-    // remove
-    mutex.acquire();
-    shreds.erase( shreds.find( stat->xid ) );
-    done.push_back( stat );
-    mutex.release();
+    stat->free_time.store( m_vm->shreduler()->now_system, std::memory_order_relaxed );
+    // set state (slot may now be reused)
+    stat->state.store( 3, std::memory_order_release );
+    // detach
+    shred->stat = NULL;
 }
 
 
 
 
 //-----------------------------------------------------------------------------
-// name: get_shreds()
-// desc: ...
+// name: snapshot()
+// desc: copy a slot, retrying if it is reclaimed mid-copy
 //-----------------------------------------------------------------------------
-void Chuck_Stats::get_shreds( vector<Shred_Stat *> & out, map<Shred_Stat *, Shred_Stat *> & d )
+t_CKBOOL Chuck_Stats::snapshot( const Shred_Stat & stat, Shred_Stat_Snapshot & out ) const
 {
-    assert( vm != NULL );
-
-    map<t_CKUINT, Shred_Stat *>::iterator iter;
-    out.clear();
+    for( t_CKUINT tries = 0; tries < 4; tries++ )
+    {
+        t_CKUINT seq = stat.sequence.load( std::memory_order_acquire );
+        // never used
+        if( seq == 0 ) return FALSE;
+        // being claimed; try again
+        if( seq & 1 ) continue;
+
+        out.xid = stat.xid.load( std::memory_order_relaxed );
+        out.parent = stat.parent.load( std::memory_order_relaxed );
+        out.state = stat.state.load( std::memory_order_relaxed );
+        out.cycles = stat.cycles.load( std::memory_order_relaxed );
+        out.activations = stat.activations.load( std::memory_order_relaxed );
+        out.average_ctrl = stat.average_ctrl.load( std::memory_order_relaxed );
+        out.average_cycles = stat.average_cycles.load( std::memory_order_relaxed );
+        out.spork_time = stat.spork_time.load( std::memory_order_relaxed );
+        out.active_time = stat.active_time.load( std::memory_order_relaxed );
+        out.wake_time = stat.wake_time.load( std::memory_order_relaxed );
+        out.free_time = stat.free_time.load( std::memory_order_relaxed );
+        memcpy( out.name, stat.name, CK_STATS_NAME_LENGTH );
+        out.name[CK_STATS_NAME_LENGTH - 1] = '\0';
+
+        // unchanged while copying?
+        std::atomic_thread_fence( std::memory_order_acquire );
+        if( stat.sequence.load( std::memory_order_relaxed ) == seq ) return TRUE;
+    }
 
-    mutex.acquire();
-    for( iter = shreds.begin(); iter != shreds.end(); iter++ )
-        out.push_back( (*iter).second );
-    for( int i = 0; i < done.size(); i++ )
-        d[done[i]] = done[i];
-    done.clear();
-    mutex.release();
+    return FALSE;
 }
 
 
 
 
-
 //-----------------------------------------------------------------------------
-// name: Chuck_Stats()
-// desc: ...
+// name: get_shred()
+// desc: copy stats for shred `xid`
 //-----------------------------------------------------------------------------
-Chuck_Stats::Chuck_Stats()
+t_CKBOOL Chuck_Stats::get_shred( t_CKUINT xid, Shred_Stat_Snapshot & out ) const
 {
-    vm = NULL;
+    for( t_CKUINT i = 0; i < CK_STATS_MAX_SHREDS; i++ )
+    {
+        if( m_shreds[i].xid.load( std::memory_order_relaxed ) != xid ) continue;
+        if( snapshot( m_shreds[i], out ) && out.xid == xid ) return TRUE;
+    }
+
+    return FALSE;
 }
 
 
 
 
 //-----------------------------------------------------------------------------
-// name: ~Chuck_Stats()
-// desc: ...
+// name: get_shreds()
+// desc: copy stats for up to `max` tracked shreds
 //-----------------------------------------------------------------------------
-Chuck_Stats::~Chuck_Stats()
+t_CKUINT Chuck_Stats::get_shreds( Shred_Stat_Snapshot * out, t_CKUINT max ) const
 {
+    t_CKUINT count = 0;
+    for( t_CKUINT i = 0; i < CK_STATS_MAX_SHREDS && count < max; i++ )
+    {
+        if( snapshot( m_shreds[i], out[count] ) ) count++;
+    }
+
+    return count;
 }
 
 
@@ -270,16 +325,18 @@ Chuck_Stats::~Chuck_Stats()
 
 //-----------------------------------------------------------------------------
 // name: get_sporked()
-// desc: ...
+// desc: ids of shreds sporked by `xid`
 //-----------------------------------------------------------------------------
-void Shred_Stat::get_sporked( vector<Shred_Stat *> & out )
+void Chuck_Stats::get_sporked( t_CKUINT xid, vector<t_CKUINT> & out ) const
 {
     out.clear();
 
-    mutex.acquire();
-    for( int i = 0; i < children.size(); i++ )
-        out.push_back( children[i] );
-    mutex.release();
+    Shred_Stat_Snapshot s;
+    for( t_CKUINT i = 0; i < CK_STATS_MAX_SHREDS; i++ )
+    {
+        if( snapshot( m_shreds[i], s ) && s.parent == xid )
+            out.push_back( s.xid );
+    }
 }
 
 
@@ -287,17 +344,429 @@ void Shred_Stat::get_sporked( vector<Shred_Stat *> & out )
 
 //-----------------------------------------------------------------------------
 // name: get_activations()
-// desc: ...
+// desc: copy up to `max` of the most recent activations of `xid`
 //-----------------------------------------------------------------------------
-void Shred_Stat::get_activations( vector<Shred_Activation> & out )
+t_CKUINT Chuck_Stats::get_activations( t_CKUINT xid, Shred_Activation * out, t_CKUINT max ) const
 {
-    out.clear();
+    for( t_CKUINT i = 0; i < CK_STATS_MAX_SHREDS; i++ )
+    {
+        const Shred_Stat & stat = m_shreds[i];
+        t_CKUINT seq = stat.sequence.load( std::memory_order_acquire );
+        if( !seq || (seq & 1) || stat.xid.load( std::memory_order_relaxed ) != xid )
+            continue;
+
+        // newest entries; the writer may lap us while copying
+        t_CKUINT end = stat.act_count.load( std::memory_order_acquire );
+        t_CKUINT num = ck_min( ck_min( end, max ), (t_CKUINT)CK_STATS_NUM_ACTIVATIONS );
+        t_CKUINT begin = end - num;
+        for( t_CKUINT n = begin; n < end; n++ )
+        {
+            out[n-begin].when = stat.act_when[n % CK_STATS_NUM_ACTIVATIONS].load( std::memory_order_relaxed );
+            out[n-begin].cycles = stat.act_cycles[n % CK_STATS_NUM_ACTIVATIONS].load( std::memory_order_relaxed );
+        }
+
+        // drop entries overwritten while copying, and everything if the
+        // slot was reclaimed for another shred
+        std::atomic_thread_fence( std::memory_order_acquire );
+        if( stat.sequence.load( std::memory_order_relaxed ) != seq ) return 0;
+        t_CKUINT now = stat.act_count.load( std::memory_order_relaxed );
+        t_CKUINT lapped = now > begin + CK_STATS_NUM_ACTIVATIONS ? now - begin - CK_STATS_NUM_ACTIVATIONS : 0;
+        if( lapped >= num ) return 0;
+        if( lapped ) memmove( out, out + lapped, (num - lapped) * sizeof(Shred_Activation) );
+        return num - lapped;
+    }
 
-    mutex.acquire();
-    out = activationss;
-    activationss.clear();
-    mutex.release();
+    return 0;
 }
 
 
+
+
 #endif
+
+
+
+
+//-----------------------------------------------------------------------------
+// instruction profiler | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#include "chuck_vm.h"
+#include "chuck_instr.h"
+#include <chrono>
+#include <ostream>
+#include <algorithm>
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_profile_nanos()
+// desc: monotonic time in nanoseconds
+//-----------------------------------------------------------------------------
+static inline t_CKUINT ck_profile_nanos()
+{
+    return (t_CKUINT)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_profile_label()
+// desc: make a string safe to use as a collapsed-stack frame
+//-----------------------------------------------------------------------------
+static std::string ck_profile_label( const std::string & str )
+{
+    std::string label = str.length() ? str : "(anonymous)";
+    // ';' separates frames and a trailing space separates the weight
+    std::replace( label.begin(), label.end(), ';', ':' );
+    std::replace( label.begin(), label.end(), '\n', ' ' );
+    return label;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_profile_opcode()
+// desc: name of an instruction's opcode
+//-----------------------------------------------------------------------------
+static std::string ck_profile_opcode( const Chuck_Instr * instr )
+{
+    // declared by each class (see CK_INSTR_OPCODE()), so this works
+    // without run time type information
+    return instr->name();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: Chuck_Profile_Node()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_Profile_Node::Chuck_Profile_Node( Chuck_VM_Code * c, Chuck_Profile_Node * p )
+    : code(c), parent(p), stats(c->num_instr)
+{
+    // keep code (and its instructions) around for dumping
+    code->add_ref();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_Profile_Node()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_Profile_Node::~Chuck_Profile_Node()
+{
+    std::map<Chuck_VM_Code *, Chuck_Profile_Node *>::iterator it;
+    for( it = children.begin(); it != children.end(); it++ )
+        CK_SAFE_DELETE( it->second );
+    CK_SAFE_RELEASE( code );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: child()
+// desc: get (creating as needed) the context for calling `callee` from here
+//-----------------------------------------------------------------------------
+Chuck_Profile_Node * Chuck_Profile_Node::child( Chuck_VM_Code * callee )
+{
+    Chuck_Profile_Node *& node = children[callee];
+    if( !node ) node = new Chuck_Profile_Node( callee, this );
+    return node;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: Chuck_VM_Profiler()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Profiler::Chuck_VM_Profiler()
+{
+    m_generation = 1;
+    m_now = Activation();
+    m_last = 0;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_VM_Profiler()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_VM_Profiler::~Chuck_VM_Profiler()
+{
+    this->clear();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: clear()
+// desc: discard everything collected so far
+//-----------------------------------------------------------------------------
+void Chuck_VM_Profiler::clear()
+{
+    std::map<std::string, Chuck_Profile_Node *>::iterator it;
+    for( it = m_roots.begin(); it != m_roots.end(); it++ )
+        CK_SAFE_DELETE( it->second );
+    m_roots.clear();
+    m_shreds.clear();
+    // any context pointer held by a shred is now stale
+    m_generation++;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: activate()
+// desc: a shred is about to run; find the context it left off in
+//-----------------------------------------------------------------------------
+void Chuck_VM_Profiler::activate( Chuck_VM_Shred * shred )
+{
+    t_CKUINT now = ck_profile_nanos();
+
+    // nested run() inside an instruction of another shred?
+    if( m_now.node )
+    {
+        m_now.pending = now - m_last;
+        m_suspended.push_back( m_now );
+    }
+
+    // per-shred totals
+    m_now.shred = &m_shreds[shred->xid];
+    if( m_now.shred->name.empty() ) m_now.shred->name = shred->name;
+    m_now.shred->activations++;
+
+    // resume the context this shred yielded in, if still valid
+    if( shred->prof_node && shred->prof_generation == m_generation &&
+        shred->prof_node->code == shred->code )
+    {
+        m_now.node = shred->prof_node;
+    }
+    else
+    {
+        // one tree per shred name, rooted at the shred's original code
+        Chuck_Profile_Node *& root = m_roots[shred->name];
+        if( !root ) root = new Chuck_Profile_Node( shred->code_orig, NULL );
+        // (profiling may have started while in a function)
+        m_now.node = shred->code == root->code ? root : root->child( shred->code );
+    }
+
+    m_last = now;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: after()
+// desc: the instruction noted in before() has executed; attribute it, then
+//       follow the shred into a callee or back to a caller
+//-----------------------------------------------------------------------------
+void Chuck_VM_Profiler::after( Chuck_VM_Shred * shred )
+{
+    t_CKUINT now = ck_profile_nanos();
+    t_CKUINT elapsed = now - m_last;
+    m_last = now;
+
+    // the node's code is always the code the instruction came from
+    Chuck_Profile_Stat & stat = m_now.node->stats[m_now.pc];
+    stat.count++; stat.nanos += elapsed;
+    m_now.shred->total.count++; m_now.shred->total.nanos += elapsed;
+
+    // still in the same code?
+    if( shred->code == m_now.code || !shred->code ) return;
+
+    // a call pushes a frame on the mem stack; a return pops one
+    if( (void *)shred->mem->sp > m_now.sp )
+    {
+        m_now.node = m_now.node->child( shred->code );
+        return;
+    }
+    // return to the nearest caller running that code
+    for( Chuck_Profile_Node * n = m_now.node->parent; n; n = n->parent )
+    {
+        if( n->code == shred->code ) { m_now.node = n; return; }
+    }
+    // caller predates profiling; track it as a callee instead
+    m_now.node = m_now.node->child( shred->code );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: deactivate()
+// desc: the shred has stopped running; remember where it was
+//-----------------------------------------------------------------------------
+void Chuck_VM_Profiler::deactivate( Chuck_VM_Shred * shred )
+{
+    shred->prof_node = m_now.node;
+    shred->prof_generation = m_generation;
+
+    // resume a suspended activation, if any
+    if( m_suspended.size() )
+    {
+        m_now = m_suspended.back();
+        m_suspended.pop_back();
+        // don't charge the nested run to the outer instruction
+        m_last = ck_profile_nanos() - m_now.pending;
+    }
+    else m_now = Activation();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: collapse()
+// desc: emit one collapsed-stack line per (source line, opcode) of a node,
+//       then recurse into callees
+//-----------------------------------------------------------------------------
+void Chuck_VM_Profiler::collapse( std::ostream & out, const Chuck_Profile_Node * node,
+                                  const std::string & prefix, t_CKBOOL byCount ) const
+{
+    // merge instructions by source line and opcode
+    std::map< std::pair<t_CKUINT, std::string>, t_CKUINT > frames;
+    for( t_CKUINT pc = 0; pc < node->stats.size(); pc++ )
+    {
+        const Chuck_Profile_Stat & stat = node->stats[pc];
+        if( !stat.count ) continue;
+        Chuck_Instr * instr = node->code->instr[pc];
+        frames[std::make_pair( instr->m_linepos, ck_profile_opcode( instr ) )]
+            += byCount ? stat.count : stat.nanos;
+    }
+
+    // output
+    std::map< std::pair<t_CKUINT, std::string>, t_CKUINT >::iterator f;
+    for( f = frames.begin(); f != frames.end(); f++ )
+    {
+        if( !f->second ) continue;
+        out << prefix << ";line " << f->first.first << ";"
+            << f->first.second << " " << f->second << "\n";
+    }
+
+    // callees
+    std::map<Chuck_VM_Code *, Chuck_Profile_Node *>::const_iterator c;
+    for( c = node->children.begin(); c != node->children.end(); c++ )
+        collapse( out, c->second, prefix + ";" + ck_profile_label( c->first->name ), byCount );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: dump_collapsed()
+// desc: collapsed stacks (shred;code...;line;opcode weight)
+//-----------------------------------------------------------------------------
+void Chuck_VM_Profiler::dump_collapsed( std::ostream & out, t_CKBOOL byCount ) const
+{
+    std::map<std::string, Chuck_Profile_Node *>::const_iterator it;
+    for( it = m_roots.begin(); it != m_roots.end(); it++ )
+        collapse( out, it->second, ck_profile_label( it->first ), byCount );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_profile_top()
+// desc: print the topN entries of a map by time
+//-----------------------------------------------------------------------------
+static void ck_profile_top( std::ostream & out, const char * title,
+                            const std::map<std::string, Chuck_Profile_Stat> & stats,
+                            t_CKUINT total, t_CKUINT topN )
+{
+    // sort by time spent
+    std::vector< std::pair<t_CKUINT, std::string> > order;
+    std::map<std::string, Chuck_Profile_Stat>::const_iterator it;
+    for( it = stats.begin(); it != stats.end(); it++ )
+        order.push_back( std::make_pair( it->second.nanos, it->first ) );
+    std::sort( order.rbegin(), order.rend() );
+
+    out << title << ":\n";
+    for( t_CKUINT i = 0; i < order.size() && i < topN; i++ )
+    {
+        const Chuck_Profile_Stat & stat = stats.find( order[i].second )->second;
+        char buffer[64];
+        snprintf( buffer, sizeof(buffer), "  %6.2f%% %10.3fms %12lu  ",
+                  total ? 100.0 * stat.nanos / total : 0.0,
+                  stat.nanos / 1000000.0, (unsigned long)stat.count );
+        out << buffer << order[i].second << "\n";
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_profile_gather()
+// desc: fold a context tree into per-opcode and per-line stats
+//-----------------------------------------------------------------------------
+static void ck_profile_gather( const Chuck_Profile_Node * node,
+                               std::map<std::string, Chuck_Profile_Stat> & opcodes,
+                               std::map<std::string, Chuck_Profile_Stat> & lines )
+{
+    for( t_CKUINT pc = 0; pc < node->stats.size(); pc++ )
+    {
+        const Chuck_Profile_Stat & stat = node->stats[pc];
+        if( !stat.count ) continue;
+        Chuck_Instr * instr = node->code->instr[pc];
+
+        Chuck_Profile_Stat & op = opcodes[ck_profile_opcode( instr )];
+        op.count += stat.count; op.nanos += stat.nanos;
+
+        char buffer[32];
+        snprintf( buffer, sizeof(buffer), ":%lu", (unsigned long)instr->m_linepos );
+        Chuck_Profile_Stat & line = lines[node->code->name + buffer];
+        line.count += stat.count; line.nanos += stat.nanos;
+    }
+
+    std::map<Chuck_VM_Code *, Chuck_Profile_Node *>::const_iterator c;
+    for( c = node->children.begin(); c != node->children.end(); c++ )
+        ck_profile_gather( c->second, opcodes, lines );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: dump_summary()
+// desc: top opcodes, source lines, and shreds by time
+//-----------------------------------------------------------------------------
+void Chuck_VM_Profiler::dump_summary( std::ostream & out, t_CKUINT topN ) const
+{
+    std::map<std::string, Chuck_Profile_Stat> opcodes, lines, shreds;
+    t_CKUINT total = 0;
+
+    // fold trees
+    std::map<std::string, Chuck_Profile_Node *>::const_iterator r;
+    for( r = m_roots.begin(); r != m_roots.end(); r++ )
+        ck_profile_gather( r->second, opcodes, lines );
+
+    // shreds
+    std::map<t_CKUINT, Chuck_Profile_Shred>::const_iterator s;
+    for( s = m_shreds.begin(); s != m_shreds.end(); s++ )
+    {
+        char buffer[32];
+        snprintf( buffer, sizeof(buffer), "[shred %lu] ", (unsigned long)s->first );
+        shreds[buffer + s->second.name] = s->second.total;
+        total += s->second.total.nanos;
+    }
+
+    ck_profile_top( out, "opcodes", opcodes, total, topN );
+    ck_profile_top( out, "lines (code:line)", lines, total, topN );
+    ck_profile_top( out, "shreds", shreds, total, topN );
+}
@@ -41,18 +41,23 @@
 // tracking
 #if defined(__CHUCK_STAT_TRACK__)
 
-#include "util_thread.h"
+#include <atomic>
+#include <vector>
 
-#include <string>
-#include <map>
-#include <queue>
+// 1.5.5.3: fixed sizes; tracking never allocates on the VM thread
+// max number of shreds tracked at once (more are counted as dropped)
+#define CK_STATS_MAX_SHREDS         128
+// samples kept for the control rate and cycles-per-activation averages
+#define CK_STATS_NUM_DIFFS          8
+// recent activations kept per shred
+#define CK_STATS_NUM_ACTIVATIONS    16
+// max length (including terminator) of copied shred names
+#define CK_STATS_NAME_LENGTH        64
 
 
 // forward reference
 struct Chuck_VM;
 struct Chuck_VM_Shred;
-struct Shred_Data;
-struct Shred_Time;
 
 
 
@@ -66,6 +71,7 @@ struct Shred_Activation
     t_CKTIME when;
     t_CKUINT cycles;
 
+    Shred_Activation() : when(0), cycles(0) { }
     Shred_Activation( t_CKTIME a, t_CKUINT b ) { when = a; cycles = b; }
 };
 
@@ -73,80 +79,98 @@ struct Shred_Activation
 
 
 //-----------------------------------------------------------------------------
-// name: struct Shred_Stat
-// desc: ...
+// name: struct Shred_Stat_Snapshot
+// desc: a consistent copy of a Shred_Stat, for readers on any thread
 //-----------------------------------------------------------------------------
-struct Shred_Stat
+struct Shred_Stat_Snapshot
 {
-public:
-    // instructions computed
-    t_CKUINT cycles;
     // shred id
     t_CKUINT xid;
-    // parent
+    // parent shred id (0 if none)
     t_CKUINT parent;
-    // current state, 0 = inactive, 1 = active, 2 = wait, 3 = deleted
+    // 0 = inactive, 1 = active, 2 = wait, 3 = deleted
     t_CKUINT state;
-    // reference (could be pointing to garbage - see state)
-    Chuck_VM_Shred * shred_ref;
+    // instructions computed
+    t_CKUINT cycles;
     // number of activations
     t_CKUINT activations;
-    // average control rate
+    // average control rate (samples between wake-ups)
     t_CKFLOAT average_ctrl;
-    // average cycles
+    // average cycles per activation
     t_CKFLOAT average_cycles;
-    // spork time
+    // spork, last activation, wake, and free times
     t_CKTIME spork_time;
-    // active time
     t_CKTIME active_time;
-    // wake time
     t_CKTIME wake_time;
-    // free time
     t_CKTIME free_time;
     // name
-    std::string name;
-    // owner
-    std::string owner;
-    // source
-    std::string source;
+    char name[CK_STATS_NAME_LENGTH];
+};
+
 
+
+
+//-----------------------------------------------------------------------------
+// name: struct Shred_Stat
+// desc: per-shred statistics slot; written only by the VM thread; fields
+//       are atomics so any thread can read them (see Chuck_Stats::get_shred)
+//       1.5.5.3: fixed-size and lock-free (was std::queue/vector + XMutex)
+//-----------------------------------------------------------------------------
+struct Shred_Stat
+{
+public:
+    // bumped (to odd) when the slot is (re)claimed and (to even) once the
+    // identity fields are written; readers retry if it changes under them
+    std::atomic<t_CKUINT> sequence;
+    // current state, 0 = inactive, 1 = active, 2 = wait, 3 = deleted
+    // (a slot is free if deleted or never used, i.e., sequence == 0)
+    std::atomic<t_CKUINT> state;
+    // shred id
+    std::atomic<t_CKUINT> xid;
+    // parent
+    std::atomic<t_CKUINT> parent;
+    // instructions computed (published at each deactivation)
+    std::atomic<t_CKUINT> cycles;
+    // number of activations
+    std::atomic<t_CKUINT> activations;
+    // average control rate
+    std::atomic<t_CKFLOAT> average_ctrl;
+    // average cycles
+    std::atomic<t_CKFLOAT> average_cycles;
+    // spork time
+    std::atomic<t_CKTIME> spork_time;
+    // active time
+    std::atomic<t_CKTIME> active_time;
+    // wake time
+    std::atomic<t_CKTIME> wake_time;
+    // free time
+    std::atomic<t_CKTIME> free_time;
+    // name (written only while sequence is odd)
+    char name[CK_STATS_NAME_LENGTH];
+
+    // recent activations (ring; index = count % CK_STATS_NUM_ACTIVATIONS)
+    std::atomic<t_CKTIME> act_when[CK_STATS_NUM_ACTIVATIONS];
+    std::atomic<t_CKUINT> act_cycles[CK_STATS_NUM_ACTIVATIONS];
+    std::atomic<t_CKUINT> act_count;
+
+public: // VM thread only
+    // instructions computed, counted by Chuck_VM_Shred::run()
+    t_CKUINT cycles_now;
+    // cycles at the start of the current activation
+    t_CKUINT last_cycles;
     // ctrl rate calculation
-    std::queue<t_CKDUR> diffs;
-    // number of diffs
+    t_CKDUR diffs[CK_STATS_NUM_DIFFS];
     t_CKUINT num_diffs;
-    // total diffs
     t_CKDUR diff_total;
-
     // exe per activation
-    std::queue<t_CKUINT> act_cycles;
-    // total
-    t_CKUINT act_cycles_total;
-    // last
-    t_CKUINT last_cycles;
-
-    // children
-    std::vector<Shred_Stat *> children;
-    void get_sporked( std::vector<Shred_Stat *> & out );
-
-    std::vector<Shred_Activation> activationss;
-    void get_activations( std::vector<Shred_Activation> & out );
-
-    // mutex
-    XMutex mutex;
-
-    // audicle info
-    Shred_Data * data;
-    Shred_Time * time;
+    t_CKUINT exe_cycles[CK_STATS_NUM_DIFFS];
+    t_CKUINT num_exe;
+    t_CKUINT exe_total;
 
 public:
-    Shred_Stat() { this->clear(); num_diffs = 8; data = NULL; time = NULL; }
-    void clear()
-    { xid = 0; parent = 0; state = 0; cycles = 0; activations = 0;
-      average_ctrl = 0.0; spork_time = 0.0; active_time = 0.0; wake_time = 0.0;
-      free_time = 0.0; name = "no name"; owner = "none"; source = "nowhere";
-      while( diffs.size() ) diffs.pop(); diff_total = 0.0;
-      while( act_cycles.size() ) act_cycles.pop(); act_cycles_total = 0;
-      last_cycles = 0; children.clear(); }
+    Shred_Stat() { sequence = 0; state = 0; this->clear(); }
+    // reset everything but sequence and state
+    void clear();
 };
 
 
@@ -154,41 +178,50 @@ public:
 
 //-----------------------------------------------------------------------------
 // name: struct Chuck_Stats
-// desc: ...
+// desc: per-VM shred statistics
+//       1.5.5.3: one per VM (was a process-wide singleton); the VM thread
+//       writes without locks or allocation; other threads (e.g., the game
+//       thread) read through get_shred() / get_shreds() / get_activations()
 //-----------------------------------------------------------------------------
 struct Chuck_Stats
 {
 public:
-    static Chuck_Stats * instance();
-
-public:
-    void set_vm_ref( Chuck_VM * _vm ) { vm = _vm; }
+    Chuck_Stats( Chuck_VM * vm );
+    ~Chuck_Stats();
 
-public:
+public: // VM thread only
     void add_shred( Chuck_VM_Shred * shred );
     void activate_shred( Chuck_VM_Shred * shred );
     void advance_time( Chuck_VM_Shred * shred, t_CKTIME to );
     void deactivate_shred( Chuck_VM_Shred * shred );
     void remove_shred( Chuck_VM_Shred * shred );
 
-public:
-    Shred_Stat * get_shred( t_CKUINT xid )
-    { mutex.acquire(); Shred_Stat * s = shreds[xid]; mutex.release(); return s; }
-    void get_shreds( std::vector<Shred_Stat *> & out,
-                     std::map<Shred_Stat *, Shred_Stat *> & d );
-    static t_CKBOOL activations_yes;
+public: // any thread
+    // copy stats for shred `xid`; FALSE if not tracked (anymore)
+    t_CKBOOL get_shred( t_CKUINT xid, Shred_Stat_Snapshot & out ) const;
+    // copy stats for up to `max` tracked shreds (including recently
+    // deleted ones); returns the number copied
+    t_CKUINT get_shreds( Shred_Stat_Snapshot * out, t_CKUINT max ) const;
+    // ids of shreds sporked by `xid`
+    void get_sporked( t_CKUINT xid, std::vector<t_CKUINT> & out ) const;
+    // copy up to `max` of the most recent activations of `xid`, oldest
+    // first; returns the number copied
+    t_CKUINT get_activations( t_CKUINT xid, Shred_Activation * out, t_CKUINT max ) const;
+    // shreds that could not be tracked because all slots were live
+    t_CKUINT dropped() const { return m_dropped.load( std::memory_order_relaxed ); }
 
 protected:
-    Chuck_Stats();
-    ~Chuck_Stats();
-
-    static Chuck_Stats * our_instance;
+    // copy a slot, retrying if it is reclaimed mid-copy
+    t_CKBOOL snapshot( const Shred_Stat & stat, Shred_Stat_Snapshot & out ) const;
 
 protected:
-    Chuck_VM * vm;
-    std::map<t_CKUINT, Shred_Stat *> shreds;
-    std::vector<Shred_Stat *> done;
-    XMutex mutex;
+    Chuck_VM * m_vm;
+    // slots
+    Shred_Stat m_shreds[CK_STATS_MAX_SHREDS];
+    // where to start looking for a slot to reuse
+    t_CKUINT m_next;
+    // shreds not tracked
+    std::atomic<t_CKUINT> m_dropped;
 };
 
 
@@ -196,4 +229,151 @@ protected:
 
 #endif
 
+
+
+
+//-----------------------------------------------------------------------------
+// instruction profiler | 1.5.5.3 (added)
+// opt-in and independent of __CHUCK_STAT_TRACK__; enabled per VM with
+// Chuck_VM::profile(); while enabled, every instruction executed by a shred
+// is counted and timed, and attributed to its opcode, VM code, source line,
+// and shred, under the calling context in which it ran
+//-----------------------------------------------------------------------------
+#include <map>
+#include <string>
+#include <vector>
+#include <iosfwd>
+
+// forward reference
+struct Chuck_VM_Code;
+struct Chuck_VM_Shred;
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Profile_Stat
+// desc: instructions executed and time spent (in nanoseconds)
+//-----------------------------------------------------------------------------
+struct Chuck_Profile_Stat
+{
+    t_CKUINT count;
+    t_CKUINT nanos;
+
+    Chuck_Profile_Stat() : count(0), nanos(0) { }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Profile_Node
+// desc: one calling context: a VM code reached through its parent's code;
+//       holds a stat per instruction of that code
+//-----------------------------------------------------------------------------
+struct Chuck_Profile_Node
+{
+    // the code (referenced, so it is still around for dumping)
+    Chuck_VM_Code * code;
+    // caller context; NULL for the root of a shred
+    Chuck_Profile_Node * parent;
+    // callee contexts
+    std::map<Chuck_VM_Code *, Chuck_Profile_Node *> children;
+    // per-instruction stats, indexed by pc
+    std::vector<Chuck_Profile_Stat> stats;
+
+    Chuck_Profile_Node( Chuck_VM_Code * c, Chuck_Profile_Node * p );
+    ~Chuck_Profile_Node();
+    // get (creating as needed) the context for calling `callee` from here
+    Chuck_Profile_Node * child( Chuck_VM_Code * callee );
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_Profile_Shred
+// desc: per-shred totals
+//-----------------------------------------------------------------------------
+struct Chuck_Profile_Shred
+{
+    std::string name;
+    t_CKUINT activations;
+    Chuck_Profile_Stat total;
+
+    Chuck_Profile_Shred() : activations(0) { }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_VM_Profiler
+// desc: counting instruction profiler; driven by Chuck_VM_Shred::run()
+//       NOTE not thread-safe; dump or clear from the VM thread, or after
+//       profiling has been turned off and the current run() has returned
+//-----------------------------------------------------------------------------
+struct Chuck_VM_Profiler
+{
+public:
+    Chuck_VM_Profiler();
+    ~Chuck_VM_Profiler();
+
+public: // called by Chuck_VM_Shred::run()
+    // a shred is about to run
+    void activate( Chuck_VM_Shred * shred );
+    // an instruction is about to execute
+    void before( Chuck_VM_Code * code, t_CKUINT pc, void * sp )
+    { m_now.code = code; m_now.pc = pc; m_now.sp = sp; }
+    // the instruction has executed
+    void after( Chuck_VM_Shred * shred );
+    // the shred has stopped running (yielded, waiting, or done)
+    void deactivate( Chuck_VM_Shred * shred );
+
+public:
+    // discard everything collected so far
+    void clear();
+    // collapsed stacks, one line per (shred;code...;line;opcode), for use
+    // with flamegraph.pl, speedscope, etc.; weighted by nanoseconds or,
+    // if `byCount` is TRUE, by instructions executed
+    void dump_collapsed( std::ostream & out, t_CKBOOL byCount = FALSE ) const;
+    // human-readable summary: top opcodes, source lines, and shreds
+    void dump_summary( std::ostream & out, t_CKUINT topN = 20 ) const;
+
+protected:
+    // walk a context tree for dump_collapsed()
+    void collapse( std::ostream & out, const Chuck_Profile_Node * node,
+                   const std::string & prefix, t_CKBOOL byCount ) const;
+
+protected:
+    // roots of calling context trees, one per shred name
+    std::map<std::string, Chuck_Profile_Node *> m_roots;
+    // per-shred totals, by shred id
+    std::map<t_CKUINT, Chuck_Profile_Shred> m_shreds;
+    // bumped by clear(); lets shreds detect stale context pointers
+    t_CKUINT m_generation;
+
+    // a shred activation in progress
+    struct Activation
+    {
+        Chuck_Profile_Node * node;
+        Chuck_Profile_Shred * shred;
+        Chuck_VM_Code * code;
+        t_CKUINT pc;
+        void * sp;
+        // nanoseconds into the current instruction when suspended
+        t_CKUINT pending;
+    };
+    // the current activation
+    Activation m_now;
+    // activations suspended by a nested run() (e.g., a callback into
+    // ChucK code made by an instruction of the outer shred)
+    std::vector<Activation> m_suspended;
+    // when the current instruction started
+    t_CKUINT m_last;
+};
+
+
+
+
 #endif
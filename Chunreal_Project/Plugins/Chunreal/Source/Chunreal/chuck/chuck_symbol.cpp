@@ -37,6 +37,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <mutex>
 
 
 
@@ -57,6 +58,12 @@ static S_Symbol mksymbol( c_constr name, S_Symbol next )
 
 static S_Symbol hashtable[CK_SIM_HASH_SIZE];
 
+// symbols are interned process-wide (identity is compared by pointer across
+// every compiler instance), so buckets are guarded by a small set of striped
+// locks; this lets independent compiles intern concurrently | 1.5.5.3
+#define CK_SIM_LOCK_STRIPES 64
+static std::mutex hashlocks[CK_SIM_LOCK_STRIPES];
+
 static unsigned int s_hash(const char *s0)
 {
     unsigned int h=0; const char *s;
@@ -73,9 +80,11 @@ static int streq(c_constr a, c_constr b)
 S_Symbol insert_symbol(c_constr name)
 {
     S_Symbol syms = NULL, sym;
-    int index= s_hash(name) % CK_SIM_HASH_SIZE;
 
     if( !name ) return NULL;
+    int index= s_hash(name) % CK_SIM_HASH_SIZE;
+
+    std::lock_guard<std::mutex> lock( hashlocks[index % CK_SIM_LOCK_STRIPES] );
     syms = hashtable[index];
     for(sym=syms; sym; sym=sym->next)
         if (streq(sym->name,name)) return sym;
@@ -49,6 +49,7 @@
 
 #include <sstream>
 #include <algorithm>
+#include <mutex>
 using namespace std;
 
 
@@ -891,11 +892,11 @@ t_CKBOOL type_engine_check_prog( Chuck_Env * env, a_Program prog,
     { ret = FALSE; goto done; }
 
     // 0th-scan (pass 0)
-    if( !type_engine_scan0_prog( env, g_program, te_do_all ) )
+    if( !type_engine_scan0_prog( env, prog, te_do_all ) )
     { ret = FALSE; goto cleanup; }
 
     // 1st-scan (pass 1)
-    if( !type_engine_scan1_prog( env, g_program, te_do_all ) )
+    if( !type_engine_scan1_prog( env, prog, te_do_all ) )
     { ret = FALSE; goto cleanup; }
 
     // 2nd-scan (pass 2)
@@ -1127,7 +1128,7 @@ t_CKBOOL type_engine_unload_context( Chuck_Env * env )
     // after AST cleanup | 1.5.0.5 (ge) added
     env->context->decouple_ast();
     // removing reference to AST tree, which is cleaned up elsewhere
-    // see cleanup_AST() in the parser | 1.5.0.5 (ge) added
+    // see Chuck_CompileTarget::cleanupAST() | 1.5.0.5 (ge) added
     env->context->parse_tree = NULL;
 
     // log
@@ -5047,6 +5048,24 @@ t_CKTYPE type_engine_check_exp_func_call( Chuck_Env * env, a_Exp exp_func, a_Exp
             return NULL;
         }
 
+        // bulk numeric array methods apply only to some element types, and
+        // int[] sum/min/max call int-returning versions | 1.5.5.3 (added)
+        if( exp_func->s_type == ae_exp_dot_member && theFunc->value_ref &&
+            theFunc->value_ref->owner_class == env->ckt_array &&
+            exp_func->dot_member.t_base->array_depth )
+        {
+            Chuck_Func * bulk = array_bulk_resolve( env, exp_func->dot_member.t_base, theFunc );
+            if( !bulk )
+            {
+                EM_error2( exp_func->dot_member.where,
+                          "array method '%s(...)' does not apply to '%s'...",
+                          theFunc->base_name.c_str(), exp_func->dot_member.t_base->name().c_str() );
+                EM_error2( 0, "...(it takes int[] and/or float[], of the same type as any array argument)" );
+                return NULL;
+            }
+            theFunc = bulk;
+        }
+
         // recheck the type with new name
         if( exp_func->s_type == ae_exp_primary && exp_func->primary.s_type == ae_primary_var )
         {
@@ -6746,7 +6765,7 @@ Chuck_Type * type_engine_find_common_anc( Chuck_Type * lhs, Chuck_Type * rhs )
 //-----------------------------------------------------------------------------
 const char * type_path( a_Id_List thePath )
 {
-    static string str;
+    static thread_local string str;
 
     // clear it
     str = "";
@@ -7351,11 +7370,17 @@ Chuck_Type * type_engine_import_ugen_begin( Chuck_Env * env, const char * name,
     info->add_ref();
     info->tick = type->parent_type->ugen_info->tick;
     info->tickf = type->parent_type->ugen_info->tickf; // added 1.3.0.0
+    info->tickv = type->parent_type->ugen_info->tickv; // added 1.5.5.3
+    info->tickvn = type->parent_type->ugen_info->tickvn; // added 1.5.5.3
+    info->serial = type->parent_type->ugen_info->serial; // added 1.5.5.3
+    info->threadsafe = type->parent_type->ugen_info->threadsafe; // added 1.5.5.3
     info->pmsg = type->parent_type->ugen_info->pmsg;
     info->num_ins = type->parent_type->ugen_info->num_ins;
     info->num_outs = type->parent_type->ugen_info->num_outs;
     if( tick ) info->tick = tick;
     if( tickf ) { info->tickf = tickf; info->tick = NULL; } // added 1.3.0.0
+    // a parent's block tick only stands in for the parent's own tick
+    if( tick || tickf ) { info->tickv = NULL; info->tickvn = NULL; } // added 1.5.5.3
     if( pmsg ) info->pmsg = pmsg;
     if( num_ins != CK_NO_VALUE ) info->num_ins = num_ins;
     if( num_outs != CK_NO_VALUE ) info->num_outs = num_outs;
@@ -7405,6 +7430,85 @@ Chuck_Type * type_engine_import_ugen_begin( Chuck_Env * env, const char * name,
 
 
 
+//-----------------------------------------------------------------------------
+// name: type_engine_import_ugen_tickv()
+// desc: add a block tick to the ugen currently being imported; must
+//       follow type_engine_import_ugen_begin() with a scalar tick, which
+//       is still used whenever the VM ticks one sample at a time
+//       (added 1.5.5.3)
+//-----------------------------------------------------------------------------
+t_CKBOOL type_engine_import_ugen_tickv( Chuck_Env * env, f_tickv tickv )
+{
+    // make sure we are importing a ugen
+    if( !env->class_def || !env->class_def->ugen_info )
+    {
+        // error
+        EM_error2( 0, "import: ugen_tickv called outside of a ugen import" );
+        return FALSE;
+    }
+
+    // set it
+    env->class_def->ugen_info->tickv = tickv;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: type_engine_import_ugen_tickvn()
+// desc: add a block tick over several instances to the ugen currently being
+//       imported; must follow type_engine_import_ugen_tickv(), and tick the
+//       instances exactly as that would one at a time -- the VM batches only
+//       instances that neither feed nor read each other within a block
+//       (added 1.5.5.3)
+//-----------------------------------------------------------------------------
+t_CKBOOL type_engine_import_ugen_tickvn( Chuck_Env * env, f_tickvn tickvn )
+{
+    // make sure we are importing a ugen with a block tick
+    if( !env->class_def || !env->class_def->ugen_info || !env->class_def->ugen_info->tickv )
+    {
+        // error
+        EM_error2( 0, "import: ugen_tickvn called outside of a ugen import with tickv" );
+        return FALSE;
+    }
+
+    // set it
+    env->class_def->ugen_info->tickvn = tickvn;
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: type_engine_import_ugen_serial()
+// desc: mark the ugen currently being imported as touching state shared
+//       beyond the instance when it ticks (e.g., a global random number
+//       generator); the VM then never ticks two such ugens concurrently,
+//       and keeps them in order (added 1.5.5.3)
+//-----------------------------------------------------------------------------
+t_CKBOOL type_engine_import_ugen_serial( Chuck_Env * env )
+{
+    // make sure we are importing a ugen
+    if( !env->class_def || !env->class_def->ugen_info )
+    {
+        // error
+        EM_error2( 0, "import: ugen_serial called outside of a ugen import" );
+        return FALSE;
+    }
+
+    // set it
+    env->class_def->ugen_info->serial = TRUE;
+
+    return TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: type_engine_import_uana_begin()
 // desc: ...
@@ -9341,6 +9445,11 @@ t_CKBOOL type_engine_add_class_from_dl( Chuck_Env * env, Chuck_DL_Class * c )
                                             c->ugen_num_in, c->ugen_num_out,
                                             c->doc.length() > 0 ? c->doc.c_str() : NULL ) )
             goto error;
+        // block tick, only meaningful next to a scalar tick | 1.5.5.3
+        if( c->ugen_tickv && c->ugen_tick && !type_engine_import_ugen_tickv( env, c->ugen_tickv ) )
+            goto error;
+        // helper threads only if the chugin says its ticks allow | 1.5.5.3
+        env->class_def->ugen_info->threadsafe = c->ugen_threadsafe;
     }
     else
     {
@@ -9523,7 +9632,8 @@ const char * howmuch2str( te_HowMuch how_much )
 
 // table of escape characters
 static char g_escape[256];
-static t_CKBOOL g_escape_ready = FALSE;
+// guards one-time construction of g_escape | 1.5.5.3
+static std::once_flag g_escape_once;
 
 //-----------------------------------------------------------------------------
 // name: escape_table()
@@ -9542,9 +9652,6 @@ void escape_table( )
     g_escape[(t_CKUINT)'r'] = (char)13; // carriage return
     g_escape[(t_CKUINT)'t'] = (char)9; // horizontal tab
     g_escape[(t_CKUINT)'v'] = (char)11; // vertical tab
-
-    // done
-    g_escape_ready = TRUE;
 }
 
 
@@ -9556,9 +9663,8 @@ void escape_table( )
 //-----------------------------------------------------------------------------
 t_CKBOOL escape_str( char * str_lit, int linepos )
 {
-    // create if not yet
-    if( !g_escape_ready )
-        escape_table( );
+    // create if not yet (safe when called from concurrent compiles)
+    std::call_once( g_escape_once, escape_table );
 
     // write pointer
     char * str = str_lit;
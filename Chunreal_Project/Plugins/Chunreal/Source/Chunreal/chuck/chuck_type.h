@@ -899,6 +899,15 @@ struct Chuck_UGen_Info : public Chuck_VM_Object
     f_tick tick;
     // multichannel/vector tick function pointer (added 1.3.0.0)
     f_tickf tickf;
+    // mono block tick function pointer; optional alongside tick (added 1.5.5.3)
+    f_tickv tickv;
+    // block tick over several instances; optional alongside tickv (added 1.5.5.3)
+    f_tickvn tickvn;
+    // ticks touch state shared beyond the instance (added 1.5.5.3)
+    t_CKBOOL serial;
+    // ticks may run on a helper thread; builtin ugens are, chugins only
+    // if they say so (added 1.5.5.3)
+    t_CKBOOL threadsafe;
     // pmsg function pointer
     f_pmsg pmsg;
     // number of incoming channels
@@ -915,7 +924,7 @@ struct Chuck_UGen_Info : public Chuck_VM_Object
 
     // constructor
     Chuck_UGen_Info()
-    { tick = NULL; tickf = NULL; pmsg = NULL; num_ins = num_outs = 1;
+    { tick = NULL; tickf = NULL; tickv = NULL; tickvn = NULL; serial = FALSE; threadsafe = TRUE; pmsg = NULL; num_ins = num_outs = 1;
       tock = NULL; num_ins_ana = num_outs_ana = 1; }
 };
 
@@ -1422,6 +1431,12 @@ t_CKBOOL type_engine_import_svar( Chuck_Env * env, const char * type,
                                   t_CKUINT addr, const char * doc = NULL );
 t_CKBOOL type_engine_import_ugen_ctrl( Chuck_Env * env, const char * type, const char * name,
                                        f_ctrl ctrl, t_CKBOOL write, t_CKBOOL read );
+// add block tick to the ugen being imported | 1.5.5.3 (added)
+t_CKBOOL type_engine_import_ugen_tickv( Chuck_Env * env, f_tickv tickv );
+// add multi-instance block tick to the ugen being imported | 1.5.5.3 (added)
+t_CKBOOL type_engine_import_ugen_tickvn( Chuck_Env * env, f_tickvn tickvn );
+// mark the ugen being imported as never to tick concurrently | 1.5.5.3 (added)
+t_CKBOOL type_engine_import_ugen_serial( Chuck_Env * env );
 t_CKBOOL type_engine_import_add_ex( Chuck_Env * env, const char * ex );
 t_CKBOOL type_engine_import_class_end( Chuck_Env * env );
 // add global operator overload | 1.5.1.5 (ge & andrew) chaos
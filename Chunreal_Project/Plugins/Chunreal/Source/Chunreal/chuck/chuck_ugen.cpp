@@ -41,8 +41,23 @@
 #include "chuck_lang.h"
 #include "chuck_errmsg.h"
 #include "ugen_xxx.h" // for subgraph ops
+#include <map>
+#include <set>
 using namespace std;
 
+// helper threads for parallel block ticks (CHUCK_PARAM_VM_UGEN_THREADS);
+// off in builds with __DISABLE_THREADS__ unless __ENABLE_UGEN_THREADS__
+// asks for them (they need only std::thread) | 1.5.5.3
+#if !defined(__DISABLE_THREADS__) || defined(__ENABLE_UGEN_THREADS__)
+#define __CHUCK_UGEN_WORKERS__
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+
+// skip ticking dormant ugens | 1.5.5.3
+t_CKBOOL Chuck_UGen::our_skip_dormant = TRUE;
 
 
 
@@ -182,6 +197,8 @@ void Chuck_UGen::init()
 {
     tick = NULL;
     tickf = NULL; // added 1.3.0.0
+    tickv = NULL; // added 1.5.5.3
+    tickvn = NULL; // added 1.5.5.3
     pmsg = NULL;
     m_multi_chan = NULL;
     m_multi_chan_size = 0;
@@ -207,6 +224,9 @@ void Chuck_UGen::init()
     m_next = 0.0f;
     m_use_next = FALSE;
     m_max_block_size = -1;
+    m_dormant = FALSE;
+    m_silent = FALSE;
+    m_sum_silent = FALSE;
     // if this is part of a stereo UGen, this parameter will be initialized
     // according to the underly panning law (1.4.1.0)
     m_pan = 1.0f;
@@ -229,6 +249,12 @@ void Chuck_UGen::init()
     m_is_buffered = FALSE;
     // buffer empty for any ugen that is not buffered
     m_buffer.resize( 0 );
+
+    // not in any schedule yet | 1.5.5.3
+    m_schedule_mark = 0;
+    m_serial = FALSE;
+    m_threadsafe = TRUE;
+    m_vm_tick = FALSE;
 }
 
 
@@ -318,6 +344,10 @@ t_CKBOOL Chuck_UGen::alloc_v( t_CKUINT size )
     {
         m_sum_v = new SAMPLE[size];
         m_current_v = new SAMPLE[size];
+        // zero: a feedback edge reads last block's output before the first
+        // block has written it
+        memset( m_sum_v, 0, size * sizeof(SAMPLE) );
+        memset( m_current_v, 0, size * sizeof(SAMPLE) );
 
         return ( m_sum_v != NULL && m_current_v != NULL );
     }
@@ -487,6 +517,36 @@ Chuck_UGen * Chuck_UGen::dst_for_src_chan( t_CKUINT chan )
 
 
 
+//-----------------------------------------------------------------------------
+// name: graph_changed() | 1.5.5.3 (added)
+// desc: invalidate the schedule of this ugen's VM after a connection change;
+//       other VMs' schedules are unaffected
+//-----------------------------------------------------------------------------
+void Chuck_UGen::graph_changed()
+{
+    // the VM, and its shreduler (gone once the VM is shut down)
+    Chuck_VM * vm = this->originVM();
+    Chuck_VM_Shreduler * shreduler = vm ? vm->shreduler() : NULL;
+    // rebuild on next tick
+    if( shreduler ) shreduler->m_ugen_schedule.graph_changed();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: wakes() | 1.5.5.3 (added)
+// desc: does calling 'func' wake the object it is called on, i.e., is it a
+//       member function of a ugen type? (see wake())
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_UGen::wakes( Chuck_Func * func, Chuck_VM * vm )
+{
+    return func && func->ownerType() && isa( func->ownerType(), vm->env()->ckt_ugen );
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: add()
 // dsec: from point of view of destination (RHS) Ugen, add source (LHS) ugen
@@ -530,6 +590,8 @@ t_CKBOOL Chuck_UGen::add( Chuck_UGen * src, t_CKBOOL isUpChuck )
         fa_push_back( m_src_list, m_src_cap, m_num_src, src );
         // increment source count
         m_num_src++;
+        // invalidate schedules | 1.5.5.3
+        graph_changed();
         // 1.5.4.2 (ge) removed as part of #ugen-refs
         // src->add_ref();
         // add from other side
@@ -675,6 +737,8 @@ t_CKBOOL Chuck_UGen::remove( Chuck_UGen * src )
 
                 m_src_list[--m_num_src] = NULL;
                 src->remove_by( this );
+                // invalidate schedules | 1.5.5.3
+                graph_changed();
                 // 1.5.4.2 (ge) removed as part of #ugen-refs
                 // src->release();
                 --k;
@@ -694,6 +758,8 @@ t_CKBOOL Chuck_UGen::remove( Chuck_UGen * src )
 
                 m_src_list[--m_num_src] = NULL;
                 src->remove_by( this );
+                // invalidate schedules | 1.5.5.3
+                graph_changed();
                 src->release();
             }
     } */
@@ -804,6 +870,8 @@ void Chuck_UGen::remove_all( )
 
             // null the last element
             m_src_list[--m_num_src] = NULL;
+            // invalidate schedules | 1.5.5.3
+            graph_changed();
         }
     }
 }
@@ -935,7 +1003,10 @@ t_CKBOOL Chuck_UGen::is_connected_from( Chuck_UGen * src )
 
 //-----------------------------------------------------------------------------
 // name: tick()
-// dsec: ...
+// dsec: pull this ugen and (recursively) everything upstream of it; the
+//       work for each ugen is done by tick_sum(), tick_gather(), and
+//       tick_synth() -- Chuck_UGen_Schedule calls these same phases in a
+//       flat pass, in the same order as this recursion would
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
 {
@@ -944,28 +1015,81 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
 
     t_CKUINT i;
     Chuck_UGen * ugen = NULL;
-    SAMPLE multi;
 
     // part 1: tick upstream ugens
     // inc time
     m_time = now;
-    // initial sum
-    m_sum = 0.0f;
     // NOTE: if this UGen has more than one input channel:
     // m_num_src would be zero, and m_src_list are handled in this
     // UGen's per-channel "sub-ugens" -- (ge + nshaheed, 1.5.0.0)
     // e.g., in=2 and out=2 (as in Identity2)
+    for( i = 0; i < m_num_src; i++ )
+    {
+        ugen = m_src_list[i];
+        if( ugen->m_time < now ) ugen->system_tick( now );
+    }
+    // sum the src list
+    tick_sum();
+
+    // tick multiple channels
+    if( m_multi_chan_size )
+    {
+        for( i = 0; i < m_multi_chan_size; i++ )
+        {
+            ugen = m_multi_chan[i];
+            // tick sub-ugens for individual channels
+            if( ugen->m_time < now ) ugen->system_tick( now );
+        }
+        // gather from channels
+        tick_gather();
+    }
+
+    // if owner (i.e., this ugen is one of the channels in a multi-channel ugen)
+    if( owner_ugen != NULL && owner_ugen->m_time < now )
+    {
+        // tick the owner
+        owner_ugen->system_tick( now );
+
+        // if the owner has a multichannel tick function (added 1.3.0.0)
+        if( owner_ugen->tickf )
+        {
+            // set the latest to the current
+            m_last = m_current;
+            // done, don't want multi-channel subchannels to synthesize
+            // it should be taken care of in the owner (added 1.3.0.0)
+            return TRUE;
+        }
+    }
+
+    // part 2: synthesize with tick function
+    tick_synth();
+
+    return m_valid;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_sum() | 1.5.5.3 (factored out of system_tick)
+// dsec: sum the src list into m_sum; sources must already be ticked
+//-----------------------------------------------------------------------------
+void Chuck_UGen::tick_sum()
+{
+    t_CKUINT i;
+    Chuck_UGen * ugen = NULL;
+
+    // initial sum
+    m_sum = 0.0f;
     if( m_num_src )
     {
         ugen = m_src_list[0];
-        if( ugen->m_time < now ) ugen->system_tick( now );
         m_sum = ugen->m_current;
 
-        // tick the src list
+        // sum the src list
         for( i = 1; i < m_num_src; i++ )
         {
             ugen = m_src_list[i];
-            if( ugen->m_time < now ) ugen->system_tick( now );
             if( ugen->m_valid )
             {
                 if( m_op <= 1 )
@@ -983,65 +1107,68 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
             }
         }
     }
+}
 
-    // tick multiple channels
-    multi = 0.0f;
-    if( m_multi_chan_size )
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_gather() | 1.5.5.3 (factored out of system_tick)
+// dsec: gather input from channels (multi-channel ugens only); channels must
+//       already be ticked
+//-----------------------------------------------------------------------------
+void Chuck_UGen::tick_gather()
+{
+    t_CKUINT i;
+    Chuck_UGen * ugen = NULL;
+    SAMPLE multi = 0.0f;
+
+    // spencer 2012 - use multichannel tick function (added 1.3.0.0)
+    if( tickf )
     {
-        // spencer 2012 - use multichannel tick function (added 1.3.0.0)
-        if( tickf )
-        {
-            // system tick each input channel (added 1.3.0.0)
-            for( i = 0; i < m_multi_chan_size; i++ )
-            {
-                ugen = m_multi_chan[i];
-                // tick sub-ugens for individual channels
-                if( ugen->m_time < now )
-                    ugen->system_tick( now );
-                // set to tickf input
-                // TODO: if op is not 1?
-                // 1.5.0.0 (nshaheed + ge) | why m_sum + ugen->m_sum?
-                // in our testing, it seems one of these two would always be 0, depending on channel size;
-                // e.g., if in=1 and out=2 (like LiSa2) then m_sum holds the input and ugen->m_sum is 0
-                // e.g., if in=2 and out=2 (like Identity2) then the reverse is true
-                // also see the 1.5.0.0 note regarding m_num_src earlier in this function
-                m_multi_in_v[i] = m_sum + ugen->m_sum;
-            }
-        }
-        else
+        for( i = 0; i < m_multi_chan_size; i++ )
         {
-            for( i = 0; i < m_multi_chan_size; i++ )
-            {
-                ugen = m_multi_chan[i];
-                if( ugen->m_time < now ) ugen->system_tick( now );
-                // multiple channels are added
-                multi += ugen->m_current;
-            }
-
-            // scale multi
-            multi /= m_multi_chan_size;
-            m_sum += multi;
+            ugen = m_multi_chan[i];
+            // set to tickf input
+            // TODO: if op is not 1?
+            // 1.5.0.0 (nshaheed + ge) | why m_sum + ugen->m_sum?
+            // in our testing, it seems one of these two would always be 0, depending on channel size;
+            // e.g., if in=1 and out=2 (like LiSa2) then m_sum holds the input and ugen->m_sum is 0
+            // e.g., if in=2 and out=2 (like Identity2) then the reverse is true
+            // also see the 1.5.0.0 note regarding m_num_src in system_tick()
+            m_multi_in_v[i] = m_sum + ugen->m_sum;
         }
     }
-
-    // if owner (i.e., this ugen is one of the channels in a multi-channel ugen)
-    if( owner_ugen != NULL && owner_ugen->m_time < now )
+    else
     {
-        // tick the owner
-        owner_ugen->system_tick( now );
-
-        // if the owner has a multichannel tick function (added 1.3.0.0)
-        if( owner_ugen->tickf )
+        for( i = 0; i < m_multi_chan_size; i++ )
         {
-            // set the latest to the current
-            m_last = m_current;
-            // done, don't want multi-channel subchannels to synthesize
-            // it should be taken care of in the owner (added 1.3.0.0)
-            return TRUE;
+            ugen = m_multi_chan[i];
+            // multiple channels are added
+            multi += ugen->m_current;
         }
+
+        // scale multi
+        multi /= m_multi_chan_size;
+        m_sum += multi;
     }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_synth() | 1.5.5.3 (factored out of system_tick)
+// dsec: synthesize m_current from m_sum (or m_multi_in_v); returns 1 if
+//       skipped, the ugen being dormant with no input, else 0
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_UGen::tick_synth()
+{
+    t_CKUINT i;
+    Chuck_UGen * ugen = NULL;
+    SAMPLE multi;
+    t_CKUINT skipped = 0;
 
-    // part 2: synthesize with tick function
     if( m_multi_chan_size && tickf )
     {
         // evaluate multi-channel tickf (added 1.3.0.0)
@@ -1104,11 +1231,23 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
     {
         /* evaluate single-channel tick */
 
-        if( m_op > 0 ) // UGEN_OP_TICK
+        if( m_op > 0 && m_dormant && m_sum == 0 ) // at rest | 1.5.5.3
+        {
+            // the tick would only output zero; skip it
+            m_current = 0.0f;
+            m_last = m_current;
+            skipped = 1;
+        }
+        else if( m_op > 0 ) // UGEN_OP_TICK
         {
             // tick the ugen (Chuck_DL_Api::instance() added 1.3.0.0)
             // REFACTOR-2017: removed NULL shred (ticks aren't outside shred)
-            if( tick ) m_valid = tick( this, m_sum, &m_current, Chuck_DL_Api::instance() );
+            if( tick )
+            {
+                t_CKBOOL r = tick( this, m_sum, &m_current, Chuck_DL_Api::instance() );
+                m_valid = r != FALSE;
+                m_dormant = (r & CK_TICK_DORMANT) && our_skip_dormant;
+            }
             if( !m_valid ) m_current = 0.0f;
             // apply gain and pan
             m_current *= m_gain * m_pan;
@@ -1139,7 +1278,7 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
         m_buffer.put( m_current );
     }
 
-    return m_valid;
+    return skipped;
 }
 
 
@@ -1147,35 +1286,91 @@ t_CKBOOL Chuck_UGen::system_tick( t_CKTIME now )
 
 //-----------------------------------------------------------------------------
 // name: tick_v()
-// dsec: ...
+// dsec: block version of system_tick()
 //-----------------------------------------------------------------------------
 t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
 {
     if( m_time >= now )
         return m_valid;
 
-    t_CKUINT i, j;
+    t_CKUINT i;
     Chuck_UGen * ugen = NULL;
-    SAMPLE factor;
-    SAMPLE multi;
 
     // inc time
     m_time = now;
 
     // part 1: tick upstream ugens
+    for( i = 0; i < m_num_src; i++ )
+    {
+        ugen = m_src_list[i];
+        if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
+    }
+    // sum the src list
+    tick_sum_v( numFrames );
+
+    // tick multiple channels
+    if( m_multi_chan_size )
+    {
+        for( i = 0; i < m_multi_chan_size; i++ )
+        {
+            ugen = m_multi_chan[i];
+            // tick sub-ugens for individual channels
+            if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
+        }
+        // gather from channels
+        tick_gather_v( numFrames );
+    }
+
+    // if owner
+    if( owner_ugen != NULL && owner_ugen->m_time < now )
+    {
+        owner_ugen->system_tick_v( now, numFrames );
+
+        // if the owner has a multichannel tick function (added 1.3.0.0)
+        if( owner_ugen->tickf )
+        {
+            // set the latest to the current
+            m_last = m_current_v[numFrames - 1];
+            // done, don't want multi-channel subchannels to synthesize
+            // it should be taken care of in the owner (added 1.3.0.0)
+            return TRUE;
+        }
+    }
+
+    // part 2: synthesize with tick function
+    tick_synth_v( numFrames );
+
+    return m_valid;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_sum_v() | 1.5.5.3 (factored out of system_tick_v)
+// dsec: sum the src list into m_sum_v; sources must already be ticked
+//-----------------------------------------------------------------------------
+void Chuck_UGen::tick_sum_v( t_CKUINT numFrames )
+{
+    t_CKUINT i, j;
+    Chuck_UGen * ugen = NULL;
+
+    // input is silent if every source is (0/0 is not) | 1.5.5.3
+    m_sum_silent = m_op != 4;
+
     if( m_num_src )
     {
         ugen = m_src_list[0];
-        if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
         memcpy( m_sum_v, ugen->m_current_v, numFrames * sizeof(SAMPLE) );
+        m_sum_silent = m_sum_silent && ugen->m_silent;
 
-        // tick the src list
+        // sum the src list
         for( i = 1; i < m_num_src; i++ )
         {
             ugen = m_src_list[i];
-            if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
             if( ugen->m_valid )
             {
+                m_sum_silent = m_sum_silent && ugen->m_silent;
                 if( m_op <= 1 )
                     for( j = 0; j < numFrames; j++ )
                         m_sum_v[j] += ugen->m_current_v[j];
@@ -1200,63 +1395,77 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
     {
         memset( m_sum_v, 0, numFrames * sizeof(SAMPLE) );
     }
+}
 
-    // tick multiple channels
-    if( m_multi_chan_size )
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_gather_v() | 1.5.5.3 (factored out of system_tick_v)
+// dsec: gather input from channels (multi-channel ugens only); channels must
+//       already be ticked
+//-----------------------------------------------------------------------------
+void Chuck_UGen::tick_gather_v( t_CKUINT numFrames )
+{
+    t_CKUINT i, j;
+    Chuck_UGen * ugen = NULL;
+    SAMPLE factor;
+
+    if( tickf )
     {
-        if( tickf )
-        {
-            // system tick each input channel (added 1.3.0.0)
-            for( int c = 0; c < m_multi_chan_size; c++ )
-            {
-                ugen = m_multi_chan[c];
-                // tick sub-ugens for individual channels
-                if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
-                // set to tickf input
-                for( int f = 0; f < numFrames; f++ )
-                {
-                    // 1.5.0.0 (ge + nshaheed) | added m_sum_v[f] to match system_tick
-                    m_multi_in_v[f*m_multi_chan_size+c] = m_sum_v[f] + ugen->m_sum_v[f];
-                }
-            }
-        }
-        else
+        // (not looked at: a tickf is never skipped)
+        m_sum_silent = FALSE;
+        // each input channel (added 1.3.0.0)
+        for( int c = 0; c < m_multi_chan_size; c++ )
         {
-            // initialize
-            factor = 1.0f / m_multi_chan_size;
-            // iterate
-            for( i = 0; i < m_multi_chan_size; i++ )
+            ugen = m_multi_chan[c];
+            // set to tickf input
+            for( int f = 0; f < numFrames; f++ )
             {
-                ugen = m_multi_chan[i];
-                if( ugen->m_time < now ) ugen->system_tick_v( now, numFrames );
-                for( j = 0; j < numFrames; j++ )
-                    m_sum_v[j] += ugen->m_current_v[j] * factor;
+                // 1.5.0.0 (ge + nshaheed) | added m_sum_v[f] to match system_tick
+                m_multi_in_v[f*m_multi_chan_size+c] = m_sum_v[f] + ugen->m_sum_v[f];
             }
         }
     }
-
-    // if owner
-    if( owner_ugen != NULL && owner_ugen->m_time < now )
+    else
     {
-        owner_ugen->system_tick_v( now, numFrames );
-
-        // if the owner has a multichannel tick function (added 1.3.0.0)
-        if( owner_ugen->tickf )
+        // initialize
+        factor = 1.0f / m_multi_chan_size;
+        // iterate
+        for( i = 0; i < m_multi_chan_size; i++ )
         {
-            // set the latest to the current
-            m_last = m_current_v[numFrames - 1];
-            // done, don't want multi-channel subchannels to synthesize
-            // it should be taken care of in the owner (added 1.3.0.0)
-            return TRUE;
+            ugen = m_multi_chan[i];
+            for( j = 0; j < numFrames; j++ )
+                m_sum_v[j] += ugen->m_current_v[j] * factor;
+            m_sum_silent = m_sum_silent && ugen->m_silent;
         }
     }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_synth_v() | 1.5.5.3 (factored out of system_tick_v)
+// dsec: synthesize m_current_v from m_sum_v (or m_multi_in_v); returns
+//       numFrames if skipped, the ugen being dormant with no input, else 0
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_UGen::tick_synth_v( t_CKUINT numFrames )
+{
+    t_CKUINT j;
+    Chuck_UGen * ugen = NULL;
+    SAMPLE factor;
+    SAMPLE multi;
+    t_CKUINT skipped = 0;
 
-    // part 2: synthesize with tick function
     if( m_multi_chan_size && tickf )
     {
         // evaluate multi-channel tick (added added 1.3.0.0)
         if( m_op > 0) // UGEN_OP_TICK
         {
+            // NOTE gain/pan below are those of the last channel, as left
+            // over from gathering input in system_tick_v() before 1.5.5.3
+            ugen = m_multi_chan[m_multi_chan_size-1];
             // compute samples with tickf
             // REFACTOR-2017: remove NULL shred
             m_valid = tickf( this, m_multi_in_v, m_multi_out_v, numFrames, Chuck_DL_Api::instance() );
@@ -1292,6 +1501,10 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
             m_last = m_current_v[numFrames-1];
             for( int c = 0; c < m_multi_chan_size; c++ )
                 m_multi_chan[c]->m_last = m_multi_chan[c]->m_current_v[numFrames-1];
+            // not tracked for multi-channel ticks
+            m_silent = FALSE;
+            for( t_CKUINT c = 0; c < m_multi_chan_size; c++ )
+                m_multi_chan[c]->m_silent = FALSE;
         }
         else
         {
@@ -1327,29 +1540,51 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
             m_last = m_current_v[numFrames-1];
             // save as last for subchannels
             for( int c = 0; c < m_multi_chan_size; c++ )
+            {
                 m_multi_chan[c]->m_last = m_multi_chan[c]->m_current_v[numFrames-1];
+                m_multi_chan[c]->m_silent = FALSE;
+            }
+            m_silent = FALSE;
         }
     }
     else
     {
         // evaluate single-channel tick
-        if( m_op > 0 )  // UGEN_OP_TICK
+        if( m_op > 0 && m_dormant && m_sum_silent ) // at rest | 1.5.5.3
         {
+            // the tick would only output zeros; skip it (zero every time:
+            // blocks vary in size, and m_silent may be from a shorter one)
+            memset( m_current_v, 0, numFrames * sizeof(SAMPLE) );
+            m_silent = TRUE;
+            skipped = numFrames;
+        }
+        else if( m_op > 0 )  // UGEN_OP_TICK
+        {
+            // TRUE, or CK_TICK_SILENT and/or CK_TICK_DORMANT | 1.5.5.3
+            t_CKBOOL r = TRUE;
+            t_CKBOOL silent = FALSE;
+            // tick the whole block at once, if the ugen can | 1.5.5.3
+            if( tickv )
+            {
+                r = tickv( this, m_sum_v, m_current_v, numFrames, Chuck_DL_Api::instance() );
+                silent = (r & CK_TICK_SILENT) != 0;
+            }
             // tick the ugen (Chuck_DL_Api::instance() added 1.3.0.0)
-            if( tick )
+            else if( tick )
+            {
+                // silent if every sample is
+                silent = TRUE;
                 for( j = 0; j < numFrames; j++ ) // REFACTOR-2017: remove NULL shred
-                    m_valid = tick( this, m_sum_v[j], &(m_current_v[j]), Chuck_DL_Api::instance() );
-            if( !m_valid )
-                for( j = 0; j < numFrames; j++ )
-                    m_current_v[j] = 0.0f;
-            else
-                for( j = 0; j < numFrames; j++ )
                 {
-                    // apply gain and pan
-                    m_current_v[j] *= m_gain * m_pan;
-                    // dedenormal
-                    CK_DDN( m_current_v[j] );
+                    r = tick( this, m_sum_v[j], &(m_current_v[j]), Chuck_DL_Api::instance() );
+                    silent = silent && (r & CK_TICK_SILENT);
                 }
+            }
+            m_valid = r != FALSE;
+            m_dormant = (r & CK_TICK_DORMANT) && our_skip_dormant;
+            m_silent = silent;
+            // gain and pan, or silence
+            tick_gain_v( numFrames );
         }
         else if( m_op < 0 ) // UGEN_OP_PASS
         {
@@ -1359,12 +1594,14 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
                 m_current_v[j] = m_sum_v[j];
             }
             m_valid = TRUE;
+            m_silent = m_sum_silent;
         }
         else // UGEN_OP_STOP
         {
             memset( m_current_v, 0, numFrames * sizeof(SAMPLE) );
             // m_current = 0.0f;
             m_valid = TRUE;
+            m_silent = TRUE;
         }
 
         // save as last
@@ -1381,7 +1618,1030 @@ t_CKBOOL Chuck_UGen::system_tick_v( t_CKTIME now, t_CKUINT numFrames )
         }
     }
 
-    return m_valid;
+    return skipped;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_gain_v() | 1.5.5.3 (added)
+// dsec: apply gain and pan to a mono tick's m_current_v, or zero it if the
+//       tick was not valid; notes if that leaves it silent
+//-----------------------------------------------------------------------------
+void Chuck_UGen::tick_gain_v( t_CKUINT numFrames )
+{
+    if( !m_valid )
+    {
+        memset( m_current_v, 0, numFrames * sizeof(SAMPLE) );
+        m_silent = TRUE;
+        return;
+    }
+
+    // apply gain and pan
+    SAMPLE gp = m_gain * m_pan;
+    if( gp == 0 ) m_silent = TRUE;
+    for( t_CKUINT j = 0; j < numFrames; j++ )
+    {
+        m_current_v[j] *= gp;
+        // dedenormal
+        CK_DDN( m_current_v[j] );
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_synth_vn() | 1.5.5.3 (added)
+// desc: tick_synth_v() for up to CK_UGEN_BATCH mono ugens sharing a tickvn,
+//       with one call to it; ugens not set to tick (see .op()) go one by one,
+//       as do those with silent input, which may be (or come to) rest;
+//       returns ugen-frames skipped
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_UGen::tick_synth_vn( Chuck_UGen ** ugens, t_CKUINT count, t_CKUINT numFrames )
+{
+    Chuck_Object * self[CK_UGEN_BATCH];
+    SAMPLE * in[CK_UGEN_BATCH];
+    SAMPLE * out[CK_UGEN_BATCH];
+    Chuck_UGen * batch[CK_UGEN_BATCH];
+    t_CKUINT i, j, n = 0;
+    t_CKUINT skipped = 0;
+
+    for( i = 0; i < count; i++ )
+    {
+        Chuck_UGen * ugen = ugens[i];
+        if( ugen->m_op <= 0 || ugen->m_sum_silent )
+        { skipped += ugen->tick_synth_v( numFrames ); continue; }
+        batch[n] = ugen;
+        self[n] = ugen;
+        in[n] = ugen->m_sum_v;
+        out[n] = ugen->m_current_v;
+        n++;
+    }
+    if( !n ) return skipped;
+
+    // tick them all
+    t_CKBOOL valid = batch[0]->tickvn( self, in, out, n, numFrames, Chuck_DL_Api::instance() );
+
+    // finish each as tick_synth_v() would
+    for( i = 0; i < n; i++ )
+    {
+        Chuck_UGen * ugen = batch[i];
+        ugen->m_valid = valid;
+        ugen->m_dormant = FALSE;
+        ugen->m_silent = FALSE;
+        ugen->tick_gain_v( numFrames );
+        ugen->m_last = ugen->m_current_v[numFrames-1];
+        if( ugen->m_is_buffered )
+            for( j = 0; j < numFrames; j++ )
+                ugen->m_buffer.put( ugen->m_current_v[j] );
+    }
+
+    return skipped;
+}
+
+
+
+
+#ifdef __CHUCK_UGEN_WORKERS__
+//-----------------------------------------------------------------------------
+// name: struct Chuck_UGen_Workers | 1.5.5.3 (added)
+// desc: helper threads for a schedule's STEP_PARALLEL steps; the caller
+//       takes tasks too, then waits until every helper that joined the job
+//       is done with it (so no helper is ever left holding a stale job)
+//-----------------------------------------------------------------------------
+struct Chuck_UGen_Workers
+{
+    Chuck_UGen_Workers( t_CKUINT helpers );
+    ~Chuck_UGen_Workers();
+    // tick tasks [first,first+count) of the schedule, in parallel
+    void run( Chuck_UGen_Schedule * schedule, t_CKUINT first, t_CKUINT count,
+              t_CKTIME now, t_CKUINT numFrames );
+
+protected:
+    // helper thread
+    void loop();
+    // take tasks of the current job until there are none left
+    void work();
+
+protected:
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    // a job is up (or quit)
+    std::condition_variable m_wake;
+    // the last helper left the job
+    std::condition_variable m_idle;
+    // bumped per job, so a helper joins each job at most once
+    t_CKUINT m_job;
+    // helpers in the job
+    t_CKUINT m_busy;
+    t_CKBOOL m_quit;
+    // the job
+    Chuck_UGen_Schedule * m_schedule;
+    t_CKUINT m_first;
+    t_CKUINT m_count;
+    t_CKTIME m_now;
+    t_CKUINT m_frames;
+    // next task to take
+    std::atomic<t_CKUINT> m_next;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: Chuck_UGen_Workers()
+// desc: start helper threads
+//-----------------------------------------------------------------------------
+Chuck_UGen_Workers::Chuck_UGen_Workers( t_CKUINT helpers )
+{
+    m_job = 0;
+    m_busy = 0;
+    m_quit = FALSE;
+    m_schedule = NULL;
+    m_first = m_count = m_frames = 0;
+    m_now = 0;
+    m_next = 0;
+
+    for( t_CKUINT i = 0; i < helpers; i++ )
+        m_threads.push_back( std::thread( &Chuck_UGen_Workers::loop, this ) );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_UGen_Workers()
+// desc: stop helper threads
+//-----------------------------------------------------------------------------
+Chuck_UGen_Workers::~Chuck_UGen_Workers()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_quit = TRUE;
+    }
+    m_wake.notify_all();
+    for( t_CKUINT i = 0; i < m_threads.size(); i++ )
+        m_threads[i].join();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: run()
+// desc: tick tasks [first,first+count) of the schedule, on this thread and
+//       any helpers that get to them
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Workers::run( Chuck_UGen_Schedule * schedule, t_CKUINT first,
+                              t_CKUINT count, t_CKTIME now, t_CKUINT numFrames )
+{
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        // a helper that woke too late for the last job may still be in it
+        while( m_busy ) m_idle.wait( lock );
+        m_schedule = schedule;
+        m_first = first;
+        m_count = count;
+        m_now = now;
+        m_frames = numFrames;
+        m_next = 0;
+        m_job++;
+    }
+    m_wake.notify_all();
+
+    // pitch in
+    work();
+
+    // tasks taken by helpers
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while( m_busy ) m_idle.wait( lock );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: loop()
+// desc: helper thread: join each job as it comes up
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Workers::loop()
+{
+    t_CKUINT seen = 0;
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while( TRUE )
+    {
+        while( !m_quit && m_job == seen ) m_wake.wait( lock );
+        if( m_quit ) break;
+        seen = m_job;
+        m_busy++;
+
+        lock.unlock();
+        work();
+        lock.lock();
+
+        if( --m_busy == 0 ) m_idle.notify_all();
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: work()
+// desc: take tasks of the current job until there are none left
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Workers::work()
+{
+    t_CKUINT task, skipped = 0;
+    while( (task = m_next++) < m_count )
+        skipped += m_schedule->tick_task_v( m_schedule->m_tasks[m_first + task], m_now, m_frames );
+    if( skipped ) m_schedule->m_skipped += skipped;
+}
+#endif // __CHUCK_UGEN_WORKERS__
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: Chuck_UGen_Schedule()
+// desc: constructor
+//-----------------------------------------------------------------------------
+Chuck_UGen_Schedule::Chuck_UGen_Schedule()
+{
+    m_roots[0] = m_roots[1] = NULL;
+    m_adc = NULL;
+    m_graph_version = 1;
+    m_version = 0;
+    m_num_ugens = 0;
+    m_frames = 0;
+    m_skipped = 0;
+    m_threads = 0;
+    m_parallel_min = 0;
+    m_workers = NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ~Chuck_UGen_Schedule()
+// desc: destructor
+//-----------------------------------------------------------------------------
+Chuck_UGen_Schedule::~Chuck_UGen_Schedule()
+{
+    #ifdef __CHUCK_UGEN_WORKERS__
+    CK_SAFE_DELETE( m_workers );
+    #endif
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: set_parallel()
+// desc: tick independent subgraphs of block passes on up to 'threads'
+//       threads, the caller's included, wherever at least 'min_ugens' ugens
+//       would tick at once; 0 or 1 thread ticks everything on the caller's,
+//       as does any thread count in a build without ugen workers (see
+//       __CHUCK_UGEN_WORKERS__ above)
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::set_parallel( t_CKUINT threads, t_CKUINT min_ugens )
+{
+    m_parallel_min = min_ugens;
+    #ifdef __CHUCK_UGEN_WORKERS__
+    m_threads = threads > 1 ? threads : 0;
+    // helpers
+    CK_SAFE_DELETE( m_workers );
+    if( m_threads ) m_workers = new Chuck_UGen_Workers( m_threads - 1 );
+    #else
+    // no helper threads in this build
+    m_threads = 0;
+    #endif
+    // re-plan on next tick (with a new version: ugens keep the old one as
+    // their visit mark, and would all look visited already)
+    graph_changed();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: set_roots()
+// desc: set ugens to pull from (dac, then blackhole), and the adc, which the
+//       caller ticks itself before each pass
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::set_roots( Chuck_UGen * dac, Chuck_UGen * bunghole,
+                                     Chuck_UGen * adc )
+{
+    m_roots[0] = dac;
+    m_roots[1] = bunghole;
+    m_adc = adc;
+    // rebuild on next tick, with a new version, as in set_parallel()
+    graph_changed();
+    m_steps.clear();
+    m_steps_v.clear();
+    m_batched.clear();
+    m_tasks.clear();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: rebuild()
+// desc: (re)build the schedule from the roots
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::rebuild()
+{
+    // the version doubles as the visit mark; two VMs may build with the same
+    // version, but never over the same ugens
+    m_version = m_graph_version;
+    m_steps.clear();
+    m_num_ugens = 0;
+
+    // the adc (and its channels) are ticked by the caller, so never pulled
+    if( m_adc )
+    {
+        m_adc->m_schedule_mark = m_version;
+        for( t_CKUINT i = 0; i < m_adc->m_multi_chan_size; i++ )
+            m_adc->m_multi_chan[i]->m_schedule_mark = m_version;
+    }
+
+    // pull from each root, in order
+    for( t_CKUINT i = 0; i < 2; i++ )
+        if( m_roots[i] && m_roots[i]->m_schedule_mark != m_version )
+            visit( m_roots[i] );
+
+    // and the block-pass version
+    plan_v();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: plan_v()
+// desc: build m_steps_v: steps of ugens without a builtin tickv (Chugens,
+//       channels, multi-channel ugens; anything that might run ChucK code
+//       or read another ugen) stay exactly where they are, and each run
+//       of builtin steps between them is reordered and batched by plan_run()
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::plan_v()
+{
+    m_steps_v.clear();
+    m_batched.clear();
+    m_tasks.clear();
+
+    t_CKUINT i = 0, j, N = m_steps.size();
+    while( i < N )
+    {
+        // builtin run
+        for( j = i; j < N; j++ )
+        {
+            const Step & s = m_steps[j];
+            if( s.what != STEP_SUM && s.what != STEP_SYNTH && s.what != STEP_TICK ) break;
+            if( !s.ugen->tickv || s.ugen->m_vm_tick || s.ugen->m_multi_chan_size || s.ugen->owner_ugen ) break;
+        }
+        if( j > i ) { plan_run( i, j ); i = j; continue; }
+
+        // anything else, as is
+        Step s = m_steps[i];
+        s.at = i;
+        m_steps_v.push_back( s );
+        i++;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: plan_run()
+// desc: list-schedule m_steps[begin,end) onto m_steps_v; a sum reads its
+//       sources' outputs and writes the ugen's sum, a synth reads the sum
+//       and writes the output, and each step waits for the last write to
+//       what it reads and writes, and for reads since of what it writes
+//       (so feedback keeps reading last block's output)
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::plan_run( t_CKUINT begin, t_CKUINT end )
+{
+    // per resource: last writer and reads since
+    struct Res { t_CKINT writer; std::vector<t_CKUINT> readers; Res() : writer(-1) { } };
+    std::vector<Node> nodes;
+    std::map<Chuck_UGen *, Res> sums, outs;
+    t_CKUINT i, k;
+
+    // nodes: a sum or a synth (ticks split in two)
+    for( i = begin; i < end; i++ )
+    {
+        Node n; n.ugen = m_steps[i].ugen; n.at = i; n.wait = 0;
+        if( m_steps[i].what != STEP_SYNTH ) { n.what = STEP_SUM; nodes.push_back( n ); }
+        if( m_steps[i].what != STEP_SUM ) { n.what = STEP_SYNTH; nodes.push_back( n ); }
+    }
+
+    // dependencies
+    for( i = 0; i < nodes.size(); i++ )
+    {
+        Chuck_UGen * ugen = nodes[i].ugen;
+        // reads
+        std::vector<Res *> reads;
+        if( nodes[i].what == STEP_SUM )
+            for( k = 0; k < ugen->m_num_src; k++ ) reads.push_back( &outs[ugen->m_src_list[k]] );
+        else reads.push_back( &sums[ugen] );
+        for( k = 0; k < reads.size(); k++ )
+        {
+            if( reads[k]->writer >= 0 ) { nodes[reads[k]->writer].next.push_back( i ); nodes[i].wait++; }
+            reads[k]->readers.push_back( i );
+        }
+        // write
+        Res & w = nodes[i].what == STEP_SUM ? sums[ugen] : outs[ugen];
+        if( w.writer >= 0 ) { nodes[w.writer].next.push_back( i ); nodes[i].wait++; }
+        for( k = 0; k < w.readers.size(); k++ )
+            if( w.readers[k] != i ) { nodes[w.readers[k]].next.push_back( i ); nodes[i].wait++; }
+        w.readers.clear();
+        w.writer = (t_CKINT)i;
+    }
+
+    // in parallel, if it pays
+    if( m_threads && plan_parallel( nodes ) ) return;
+
+    // all in one list
+    std::vector<t_CKINT> tags( nodes.size(), 0 );
+    plan_emit( nodes, tags, 0, m_steps_v );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: plan_emit()
+// desc: list-schedule the nodes tagged 'tag' onto 'out'; whatever else they
+//       wait on must be emitted already; of the nodes that are ready, those
+//       that can't batch go first, in schedule order, letting synths that
+//       can batch pile up
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::plan_emit( std::vector<Node> & nodes, const std::vector<t_CKINT> & tags,
+                                     t_CKINT tag, std::vector<Step> & out )
+{
+    t_CKUINT i, k;
+
+    // ready nodes, in schedule order; synths that can batch kept apart
+    std::set<t_CKUINT> ready, ready_batch;
+    #define CK_PLAN_READY( n ) \
+        ( nodes[n].what == STEP_SYNTH && nodes[n].ugen->tickvn ? ready_batch : ready ).insert( n )
+    for( i = 0; i < nodes.size(); i++ )
+        if( tags[i] == tag && !nodes[i].wait ) CK_PLAN_READY( i );
+
+    std::vector<t_CKUINT> pick;
+    while( ready.size() || ready_batch.size() )
+    {
+        pick.clear();
+        if( ready.size() )
+        {
+            pick.push_back( *ready.begin() );
+            ready.erase( ready.begin() );
+        }
+        else
+        {
+            // the earliest, and the next few like it
+            f_tickvn kind = nodes[*ready_batch.begin()].ugen->tickvn;
+            for( std::set<t_CKUINT>::iterator it = ready_batch.begin();
+                 it != ready_batch.end() && pick.size() < CK_UGEN_BATCH; )
+            {
+                if( nodes[*it].ugen->tickvn == kind ) { pick.push_back( *it ); ready_batch.erase( it++ ); }
+                else it++;
+            }
+        }
+
+        // emit
+        Step step;
+        step.count = 0;
+        if( pick.size() > 1 )
+        {
+            step.ugen = nodes[pick[0]].ugen;
+            step.what = STEP_BATCH;
+            step.at = m_batched.size();
+            step.count = pick.size();
+            for( k = 0; k < pick.size(); k++ ) m_batched.push_back( nodes[pick[k]].ugen );
+            out.push_back( step );
+        }
+        else
+        {
+            const Node & n = nodes[pick[0]];
+            // a synth right after its own sum folds back into a tick
+            if( n.what == STEP_SYNTH && out.size() && out.back().ugen == n.ugen
+                && out.back().what == STEP_SUM )
+                out.back().what = STEP_TICK;
+            else
+            {
+                step.ugen = n.ugen; step.what = n.what; step.at = n.at;
+                out.push_back( step );
+            }
+        }
+
+        // release what waited (nodes of other tags wait for their turn)
+        for( k = 0; k < pick.size(); k++ )
+        {
+            std::vector<t_CKUINT> & next = nodes[pick[k]].next;
+            for( i = 0; i < next.size(); i++ )
+                if( --nodes[next[i]].wait == 0 && tags[next[i]] == tag ) CK_PLAN_READY( next[i] );
+        }
+    }
+    #undef CK_PLAN_READY
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: plan_find()
+// desc: union-find root, halving the path on the way
+//-----------------------------------------------------------------------------
+static t_CKUINT plan_find( std::vector<t_CKUINT> & parent, t_CKUINT i )
+{
+    while( parent[i] != i ) i = parent[i] = parent[parent[i]];
+    return i;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: plan_parallel()
+// desc: split a run into subgraphs that share nothing: nodes joined by a
+//       dependency are in the same subgraph, except where a mix point (a
+//       sum of more than one source) reads; ugens that share state (e.g.,
+//       Noise and the C rand()) are all in one, and so are ugens that may
+//       only tick on the VM thread (chugins not declared thread-safe);
+//       subgraphs go in levels, each after those it waits on, and a level
+//       whose other subgraphs add up to m_parallel_min ugens or more is
+//       dealt out (in schedule order, evenly by ugens) to up to m_threads
+//       tasks of one STEP_PARALLEL, after the VM-thread subgraph, if there
+//       is one there; other levels go to m_steps_v as they would have
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_UGen_Schedule::plan_parallel( std::vector<Node> & nodes )
+{
+    t_CKUINT N = nodes.size(), i, k, c, g;
+    std::vector<t_CKUINT> parent( N );
+    t_CKINT serial = -1, pinned = -1;
+
+    // join
+    for( i = 0; i < N; i++ ) parent[i] = i;
+    for( i = 0; i < N; i++ )
+    {
+        if( nodes[i].ugen->m_serial )
+        {
+            if( serial < 0 ) serial = i;
+            else parent[plan_find( parent, i )] = plan_find( parent, serial );
+        }
+        if( !nodes[i].ugen->m_threadsafe )
+        {
+            if( pinned < 0 ) pinned = i;
+            else parent[plan_find( parent, i )] = plan_find( parent, pinned );
+        }
+        // a mix point's sum, cut off from all but its own synth
+        t_CKBOOL mix = nodes[i].what == STEP_SUM && nodes[i].ugen->m_num_src > 1;
+        for( k = 0; k < nodes[i].next.size(); k++ )
+        {
+            const Node & n = nodes[nodes[i].next[k]];
+            if( n.what == STEP_SUM && n.ugen->m_num_src > 1 ) continue;
+            if( mix && n.ugen != nodes[i].ugen ) continue;
+            parent[plan_find( parent, nodes[i].next[k] )] = plan_find( parent, i );
+        }
+    }
+
+    // subgraphs, numbered in schedule order, and their size in ugens
+    std::vector<t_CKUINT> comp( N ), size;
+    std::map<t_CKUINT, t_CKUINT> number;
+    for( i = 0; i < N; i++ )
+    {
+        t_CKUINT r = plan_find( parent, i );
+        if( !number.count( r ) ) { number[r] = size.size(); size.push_back( 0 ); }
+        comp[i] = number[r];
+        if( nodes[i].what == STEP_SYNTH ) size[comp[i]]++;
+    }
+    t_CKUINT C = size.size();
+    if( C < 2 ) return FALSE;
+
+    // levels: each subgraph one past the deepest it waits on
+    std::vector<t_CKUINT> wait( C, 0 ), level( C, 0 ), queue;
+    std::vector< std::vector<t_CKUINT> > next( C );
+    for( i = 0; i < N; i++ )
+        for( k = 0; k < nodes[i].next.size(); k++ )
+            if( comp[nodes[i].next[k]] != comp[i] )
+            { next[comp[i]].push_back( comp[nodes[i].next[k]] ); wait[comp[nodes[i].next[k]]]++; }
+    for( c = 0; c < C; c++ ) if( !wait[c] ) queue.push_back( c );
+    for( i = 0; i < queue.size(); i++ )
+        for( k = 0; k < next[queue[i]].size(); k++ )
+        {
+            c = next[queue[i]][k];
+            if( level[c] < level[queue[i]] + 1 ) level[c] = level[queue[i]] + 1;
+            if( --wait[c] == 0 ) queue.push_back( c );
+        }
+    // subgraphs waiting on each other (cut mix points can close a cycle)
+    if( queue.size() < C ) return FALSE;
+
+    // which levels pay (the VM-thread subgraph is set aside)
+    t_CKUINT L = 0;
+    t_CKINT vm = pinned < 0 ? -1 : (t_CKINT)comp[pinned];
+    for( c = 0; c < C; c++ ) if( level[c] + 1 > L ) L = level[c] + 1;
+    std::vector< std::vector<t_CKUINT> > levels( L );
+    std::vector<t_CKUINT> ugens( L, 0 );
+    for( c = 0; c < C; c++ )
+        if( (t_CKINT)c != vm ) { levels[level[c]].push_back( c ); ugens[level[c]] += size[c]; }
+    t_CKBOOL pays = FALSE;
+    for( k = 0; k < L; k++ )
+        if( levels[k].size() > 1 && ugens[k] >= m_parallel_min ) pays = TRUE;
+    if( !pays ) return FALSE;
+
+    // emit, level by level
+    std::vector<t_CKINT> tags( N, -1 ), group( C );
+    t_CKINT tag = 0;
+    for( k = 0; k < L; k++ )
+    {
+        // the VM-thread subgraph, on its own
+        if( vm >= 0 && level[vm] == k )
+        {
+            for( i = 0; i < N; i++ )
+                if( comp[i] == (t_CKUINT)vm ) tags[i] = tag;
+            plan_emit( nodes, tags, tag, m_steps_v );
+            tag++;
+        }
+        if( levels[k].empty() ) continue;
+
+        t_CKUINT T = levels[k].size() > 1 && ugens[k] >= m_parallel_min
+                   ? ck_min( (t_CKUINT)m_threads, (t_CKUINT)levels[k].size() ) : 1;
+        // deal subgraphs out to T groups, evenly by ugens
+        t_CKUINT sum = 0;
+        for( i = 0, g = 0; i < levels[k].size(); i++ )
+        {
+            c = levels[k][i];
+            group[c] = tag + g;
+            sum += size[c];
+            if( g + 1 < T && i + 1 < levels[k].size() && sum * T >= ugens[k] * (g + 1) ) g++;
+        }
+        for( i = 0; i < N; i++ )
+            if( level[comp[i]] == k && (t_CKINT)comp[i] != vm ) tags[i] = group[comp[i]];
+
+        // one group: as is
+        if( g == 0 )
+        {
+            plan_emit( nodes, tags, tag, m_steps_v );
+            tag++;
+            continue;
+        }
+
+        // tasks
+        Step step;
+        step.ugen = NULL;
+        step.what = STEP_PARALLEL;
+        step.at = m_tasks.size();
+        step.count = g + 1;
+        for( i = 0; i <= g; i++ )
+        {
+            std::vector<Step> task;
+            plan_emit( nodes, tags, tag + i, task );
+            m_tasks.push_back( task );
+        }
+        m_steps_v.push_back( step );
+        tag += g + 1;
+    }
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: visit()
+// desc: add ugen and its upstream to the schedule; this mirrors the control
+//       flow of Chuck_UGen::system_tick(), with the mark standing in for
+//       m_time (the flow depends only on the graph, never on sample values)
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::visit( Chuck_UGen * ugen )
+{
+    t_CKUINT i;
+    Chuck_UGen * up = NULL;
+    Step step;
+    step.at = step.count = 0;
+
+    // mark
+    ugen->m_schedule_mark = m_version;
+    m_num_ugens++;
+    step.ugen = ugen;
+
+    // upstream first
+    for( i = 0; i < ugen->m_num_src; i++ )
+    {
+        up = ugen->m_src_list[i];
+        if( up->m_schedule_mark != m_version ) visit( up );
+    }
+    // sum
+    step.what = STEP_SUM;
+    m_steps.push_back( step );
+
+    // channels
+    if( ugen->m_multi_chan_size )
+    {
+        for( i = 0; i < ugen->m_multi_chan_size; i++ )
+        {
+            up = ugen->m_multi_chan[i];
+            if( up->m_schedule_mark != m_version ) visit( up );
+        }
+        // gather
+        step.what = STEP_GATHER;
+        m_steps.push_back( step );
+    }
+
+    // owner (this ugen is one of its channels)
+    if( ugen->owner_ugen != NULL && ugen->owner_ugen->m_schedule_mark != m_version )
+    {
+        visit( ugen->owner_ugen );
+        // owner with a multichannel tick function synthesizes for us
+        if( ugen->owner_ugen->tickf )
+        {
+            step.what = STEP_OWNED;
+            m_steps.push_back( step );
+            return;
+        }
+    }
+
+    // synthesize; fold into the sum if nothing came in between
+    if( m_steps.back().ugen == ugen && m_steps.back().what == STEP_SUM )
+        m_steps.back().what = STEP_TICK;
+    else
+    {
+        step.what = STEP_SYNTH;
+        m_steps.push_back( step );
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick()
+// desc: tick one sample
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::tick( t_CKTIME now )
+{
+    // graph changed?
+    if( m_version != m_graph_version ) rebuild();
+
+    // ugen-frames skipped, this pass
+    t_CKUINT skipped = 0;
+    m_frames += m_num_ugens;
+
+    // one linear pass
+    Step * step = m_steps.empty() ? NULL : &m_steps[0];
+    Step * end = step + m_steps.size();
+    for( ; step != end; step++ )
+    {
+        Chuck_UGen * ugen = step->ugen;
+        switch( step->what )
+        {
+            case STEP_TICK:
+                ugen->m_time = now;
+                ugen->tick_sum();
+                skipped += ugen->tick_synth();
+                break;
+            case STEP_SUM:
+                ugen->m_time = now;
+                ugen->tick_sum();
+                break;
+            case STEP_GATHER:
+                ugen->tick_gather();
+                break;
+            case STEP_SYNTH:
+                skipped += ugen->tick_synth();
+                break;
+            case STEP_OWNED:
+                ugen->m_last = ugen->m_current;
+                break;
+        }
+
+        // a tick changed the graph (e.g., a Chugen); the schedule may now
+        // point to ugens that are gone -- finish by pulling
+        if( m_version != m_graph_version )
+        {
+            bail( step - &m_steps[0], now, 0 );
+            break;
+        }
+    }
+
+    if( skipped ) m_skipped += skipped;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_v()
+// desc: tick a block
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::tick_v( t_CKTIME now, t_CKUINT numFrames )
+{
+    // graph changed?
+    if( m_version != m_graph_version ) rebuild();
+
+    // ugen-frames skipped, this pass (helper threads add their own)
+    t_CKUINT skipped = 0;
+    m_frames += m_num_ugens * numFrames;
+
+    // one linear pass
+    Step * step = m_steps_v.empty() ? NULL : &m_steps_v[0];
+    Step * end = step + m_steps_v.size();
+    for( ; step != end; step++ )
+    {
+        Chuck_UGen * ugen = step->ugen;
+        switch( step->what )
+        {
+            case STEP_TICK:
+                ugen->m_time = now;
+                ugen->tick_sum_v( numFrames );
+                skipped += ugen->tick_synth_v( numFrames );
+                break;
+            case STEP_SUM:
+                ugen->m_time = now;
+                ugen->tick_sum_v( numFrames );
+                break;
+            case STEP_GATHER:
+                ugen->tick_gather_v( numFrames );
+                break;
+            case STEP_SYNTH:
+                skipped += ugen->tick_synth_v( numFrames );
+                break;
+            case STEP_OWNED:
+                ugen->m_last = ugen->m_current_v[numFrames-1];
+                break;
+            case STEP_BATCH:
+                skipped += Chuck_UGen::tick_synth_vn( &m_batched[step->at], step->count, numFrames );
+                break;
+            case STEP_PARALLEL:
+                #ifdef __CHUCK_UGEN_WORKERS__
+                m_workers->run( this, step->at, step->count, now, numFrames );
+                #endif
+                break;
+        }
+
+        // graph changed mid-pass; finish by pulling (see tick()); only ugens
+        // without a builtin tickv can get here, and those keep their place, so
+        // everything up to it in m_steps is done
+        if( m_version != m_graph_version )
+        {
+            bail( step->at, now, numFrames );
+            break;
+        }
+    }
+
+    if( skipped ) m_skipped += skipped;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: tick_task_v()
+// desc: tick one task of a STEP_PARALLEL (on any thread); its steps are all
+//       of builtin ugens, touching no ugen of another task; returns
+//       ugen-frames skipped
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_UGen_Schedule::tick_task_v( const std::vector<Step> & steps, t_CKTIME now,
+                                           t_CKUINT numFrames )
+{
+    t_CKUINT skipped = 0;
+    for( t_CKUINT i = 0; i < steps.size(); i++ )
+    {
+        const Step & step = steps[i];
+        Chuck_UGen * ugen = step.ugen;
+        switch( step.what )
+        {
+            case STEP_TICK:
+                ugen->m_time = now;
+                ugen->tick_sum_v( numFrames );
+                skipped += ugen->tick_synth_v( numFrames );
+                break;
+            case STEP_SUM:
+                ugen->m_time = now;
+                ugen->tick_sum_v( numFrames );
+                break;
+            case STEP_SYNTH:
+                skipped += ugen->tick_synth_v( numFrames );
+                break;
+            case STEP_BATCH:
+                skipped += Chuck_UGen::tick_synth_vn( &m_batched[step.at], step.count, numFrames );
+                break;
+        }
+    }
+    return skipped;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: bail()
+// desc: finish a pass cut short after step 'done' by pulling; numFrames is 0
+//       for single-sample ticks; ugens whose sum is in but whose synthesis
+//       is not (e.g., dac, while its channels were being ticked) are
+//       finished first, innermost first, as the recursion would unwind
+//-----------------------------------------------------------------------------
+void Chuck_UGen_Schedule::bail( t_CKUINT done, t_CKTIME now, t_CKUINT numFrames )
+{
+    t_CKUINT i, j;
+    Chuck_UGen * ugen = NULL;
+    std::vector<Chuck_UGen *> pending;
+    std::vector<t_CKBOOL> gathered;
+
+    // ugens cut off mid-visit (steps of a ugen nest like the recursion)
+    for( i = 0; i <= done; i++ )
+    {
+        switch( m_steps[i].what )
+        {
+            case STEP_SUM:
+                pending.push_back( m_steps[i].ugen );
+                gathered.push_back( FALSE );
+                break;
+            case STEP_GATHER:
+                gathered.back() = TRUE;
+                break;
+            case STEP_SYNTH:
+            case STEP_OWNED:
+                pending.pop_back();
+                gathered.pop_back();
+                break;
+        }
+    }
+
+    // finish them
+    while( pending.size() )
+    {
+        ugen = pending.back();
+        t_CKBOOL did_gather = gathered.back();
+        pending.pop_back();
+        gathered.pop_back();
+
+        // does its owner synthesize for it? (only compares pointers, since
+        // the rest of the schedule may be stale)
+        t_CKBOOL owned = FALSE;
+        for( j = done+1; j < m_steps.size(); j++ )
+        {
+            if( m_steps[j].ugen != ugen || m_steps[j].what == STEP_GATHER ) continue;
+            owned = m_steps[j].what == STEP_OWNED;
+            break;
+        }
+
+        // channels
+        if( !did_gather && ugen->m_multi_chan_size )
+        {
+            for( j = 0; j < ugen->m_multi_chan_size; j++ )
+            {
+                Chuck_UGen * chan = ugen->m_multi_chan[j];
+                if( chan->m_time >= now ) continue;
+                if( numFrames ) chan->system_tick_v( now, numFrames );
+                else chan->system_tick( now );
+            }
+            if( numFrames ) ugen->tick_gather_v( numFrames );
+            else ugen->tick_gather();
+        }
+
+        // owner
+        Chuck_UGen * owner = ugen->owner_ugen;
+        if( owner != NULL && owner->m_time < now )
+        {
+            if( numFrames ) owner->system_tick_v( now, numFrames );
+            else owner->system_tick( now );
+        }
+
+        // synthesize
+        if( owned ) ugen->m_last = numFrames ? ugen->m_current_v[numFrames-1] : ugen->m_current;
+        else if( numFrames ) ugen->tick_synth_v( numFrames );
+        else ugen->tick_synth();
+    }
+
+    // everything else, skipping what's already ticked
+    for( i = 0; i < 2; i++ )
+    {
+        if( !m_roots[i] ) continue;
+        if( numFrames ) m_roots[i]->system_tick_v( now, numFrames );
+        else m_roots[i]->system_tick( now );
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: size()
+// desc: number of ugens in the schedule
+//-----------------------------------------------------------------------------
+t_CKUINT Chuck_UGen_Schedule::size()
+{
+    if( m_version != m_graph_version ) rebuild();
+    return m_num_ugens;
 }
 
 
@@ -41,11 +41,14 @@
 #include "chuck_oo.h"
 #include "chuck_dl.h"
 #include "util_buffers.h"
+#include <vector>
+#include <atomic>
 
 
 // forward reference
 struct Chuck_VM_Shred;
 struct Chuck_UAnaBlobProxy;
+struct Chuck_UGen_Workers;
 
 
 // op mode
@@ -53,6 +56,9 @@ struct Chuck_UAnaBlobProxy;
 #define UGEN_OP_STOP    0
 #define UGEN_OP_TICK    1
 
+// most ugens ticked per tickvn call | 1.5.5.3
+#define CK_UGEN_BATCH   8
+
 
 
 
@@ -85,7 +91,34 @@ public: // src
     Chuck_UGen * src_chan( t_CKUINT chan );
     Chuck_UGen * dst_for_src_chan( t_CKUINT chan );
 
+public: // at rest | 1.5.5.3
+    // a member function was called on this ugen, and may have changed what
+    // its tick does; tick it again (see m_dormant)
+    void wake() { m_dormant = FALSE; }
+    // does calling 'func' wake the object it is called on (a ugen method)?
+    static t_CKBOOL wakes( Chuck_Func * func, Chuck_VM * vm );
+    // skip ticking dormant ugens (process-wide; FALSE ticks everything, to
+    // compare against, e.g., in scripts/test/block_regress.cpp)
+    static t_CKBOOL our_skip_dormant;
+
+public: // tick phases, without pulling upstream | 1.5.5.3
+    // (used by system_tick() and Chuck_UGen_Schedule; the synth phases
+    // return how many frames were skipped, the ugen being dormant)
+    void tick_sum();
+    void tick_gather();
+    t_CKUINT tick_synth();
+    void tick_sum_v( t_CKUINT numFrames );
+    void tick_gather_v( t_CKUINT numFrames );
+    t_CKUINT tick_synth_v( t_CKUINT numFrames );
+    // tick_synth_v() for several ugens with the same tickvn, at once
+    static t_CKUINT tick_synth_vn( Chuck_UGen ** ugens, t_CKUINT count, t_CKUINT numFrames );
+
 protected:
+    // invalidate the schedule of this ugen's VM (see Chuck_UGen_Schedule)
+    // after a connection change | 1.5.5.3
+    void graph_changed();
+    // gain/pan (or silence) over a mono block tick's output
+    void tick_gain_v( t_CKUINT numFrames );
     t_CKVOID add_by( Chuck_UGen * dest, t_CKBOOL isUpChuck );
     t_CKVOID remove_by( Chuck_UGen * dest );
 
@@ -94,6 +127,17 @@ public:
     f_tick tick;
     // multichannel/vectorized tick function (added 1.3.0.0)
     f_tickf tickf;
+    // mono block tick function, used by system_tick_v() if set (added 1.5.5.3)
+    f_tickv tickv;
+    // tickv over several instances, used by Chuck_UGen_Schedule if set (added 1.5.5.3)
+    f_tickvn tickvn;
+    // tick touches state shared beyond this ugen; never ticked concurrently (added 1.5.5.3)
+    t_CKBOOL m_serial;
+    // tick may run on a helper thread; otherwise only on the VM thread (added 1.5.5.3)
+    t_CKBOOL m_threadsafe;
+    // tick (or tickv) runs ChucK code, e.g., a Chugen; never reordered,
+    // batched, or ticked off the VM thread (added 1.5.5.3)
+    t_CKBOOL m_vm_tick;
     // msg function
     f_pmsg pmsg;
     // channels (if more than one is required)
@@ -134,6 +178,13 @@ public: // data
     SAMPLE m_pan;
     t_CKINT m_op;
     t_CKINT m_max_block_size;
+    // at rest (tick returned CK_TICK_DORMANT); skipped while its input is
+    // zero; cleared by any member function call (see wake()) | 1.5.5.3
+    t_CKBOOL m_dormant;
+    // last block output (m_current_v) is all zero | 1.5.5.3
+    t_CKBOOL m_silent;
+    // this block's input (m_sum_v) is all zero, from its sources' m_silent | 1.5.5.3
+    t_CKBOOL m_sum_silent;
 
     // SPENCERTODO: combine with block processing (added 1.3.0.0)
     SAMPLE * m_multi_in_v;
@@ -158,6 +209,120 @@ public: // data
     // what a hack! (added some time after REFACTOR-2017)
     t_CKBOOL m_is_buffered;
     AccumBuffer m_buffer;
+
+    // last Chuck_UGen_Schedule build to visit this ugen | 1.5.5.3
+    t_CKUINT m_schedule_mark;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct Chuck_UGen_Schedule | 1.5.5.3 (added)
+// desc: a VM's UGen graph flattened into a list of tick phases, in exactly
+//       the order the recursive pull from dac and blackhole would run them
+//       (including feedback cycles and multi-channel owners); rebuilt when
+//       a connection in its VM changes (see graph_changed()); if a tick
+//       (e.g., a Chugen) changes the graph mid-pass, the rest of the pass
+//       falls back to the recursive pull
+//
+//       block passes run a second list, in which builtin ugens (those with
+//       a tickv, which touches only its own ugen) may be reordered so long
+//       as every read of a ugen's sum or output still sees the same write;
+//       this brings together independent instances that share a tickvn,
+//       which then tick as a batch (e.g., 256 voices' filters, 8 at a time)
+//
+//       with more than one thread (see set_parallel()), such a run is also
+//       split into subgraphs that share nothing -- cutting at mix points,
+//       ugens with more than one source -- and subgraphs that wait on none
+//       of the others tick at the same time, each on one thread; mix points
+//       still sum their sources in order, so the output does not change
+//-----------------------------------------------------------------------------
+struct Chuck_UGen_Schedule
+{
+public:
+    Chuck_UGen_Schedule();
+    ~Chuck_UGen_Schedule();
+
+public:
+    // set ugens to pull from (in order) and one the caller ticks itself
+    void set_roots( Chuck_UGen * dac, Chuck_UGen * bunghole, Chuck_UGen * adc );
+    // tick one sample
+    void tick( t_CKTIME now );
+    // tick a block
+    void tick_v( t_CKTIME now, t_CKUINT numFrames );
+    // number of ugens in the schedule (rebuilding if needed)
+    t_CKUINT size();
+    // a connection between ugens of this VM changed; rebuild before the
+    // next tick (called by Chuck_UGen, possibly from a non-VM thread)
+    void graph_changed() { m_graph_version++; }
+    // tick independent subgraphs of block passes on up to 'threads' threads
+    // (counting the caller's), wherever at least 'min_ugens' ugens would
+    // tick at once; 0 or 1 thread: never
+    void set_parallel( t_CKUINT threads, t_CKUINT min_ugens );
+    // ugen-frames passed over so far, and how many of them were skipped
+    // (dormant ugens, see CK_TICK_DORMANT)
+    t_CKUINT frames() const { return m_frames; }
+    t_CKUINT skipped() const { return m_skipped; }
+
+protected:
+    // a step: one phase of one ugen, or (block passes only) the synth
+    // phase of a batch of ugens, or tasks to tick in parallel
+    enum { STEP_TICK, STEP_SUM, STEP_GATHER, STEP_SYNTH, STEP_OWNED, STEP_BATCH, STEP_PARALLEL };
+    // at: index in m_steps (block-pass steps map back through it when the
+    // graph changes mid-pass), or for STEP_BATCH, start in m_batched, or
+    // for STEP_PARALLEL, the first of 'count' in m_tasks
+    struct Step { Chuck_UGen * ugen; t_CKUINT what; t_CKUINT at; t_CKUINT count; };
+    // a node of plan_run(): the sum or the synth phase of one ugen
+    struct Node { Chuck_UGen * ugen; t_CKUINT what; t_CKUINT at; t_CKUINT wait; std::vector<t_CKUINT> next; };
+
+    // (re)build the schedule from the roots
+    void rebuild();
+    // build the block-pass list from m_steps
+    void plan_v();
+    // reorder and batch m_steps[begin,end), all builtin, onto m_steps_v
+    void plan_run( t_CKUINT begin, t_CKUINT end );
+    // list-schedule the nodes tagged 'tag' onto 'out'
+    void plan_emit( std::vector<Node> & nodes, const std::vector<t_CKINT> & tags,
+                    t_CKINT tag, std::vector<Step> & out );
+    // split a run into subgraphs to tick in parallel; FALSE if not worth it
+    t_CKBOOL plan_parallel( std::vector<Node> & nodes );
+    // tick a list of builtin steps (one task of a STEP_PARALLEL); returns
+    // ugen-frames skipped
+    t_CKUINT tick_task_v( const std::vector<Step> & steps, t_CKTIME now, t_CKUINT numFrames );
+    // add ugen and its upstream to the schedule
+    void visit( Chuck_UGen * ugen );
+    // finish a pass the graph changed under
+    void bail( t_CKUINT done, t_CKTIME now, t_CKUINT numFrames );
+
+protected:
+    // the schedule
+    std::vector<Step> m_steps;
+    // the same, as run by block passes
+    std::vector<Step> m_steps_v;
+    // ugens of STEP_BATCH steps
+    std::vector<Chuck_UGen *> m_batched;
+    // step lists of STEP_PARALLEL steps, one per task
+    std::vector< std::vector<Step> > m_tasks;
+    // most threads to tick a STEP_PARALLEL on, and fewest ugens for one
+    t_CKUINT m_threads;
+    t_CKUINT m_parallel_min;
+    // helper threads (m_threads-1 of them), if any
+    Chuck_UGen_Workers * m_workers;
+    friend struct Chuck_UGen_Workers;
+    // pulled from
+    Chuck_UGen * m_roots[2];
+    // ticked by the caller
+    Chuck_UGen * m_adc;
+    // bumped on every connection change in this VM; starts at 1
+    std::atomic<t_CKUINT> m_graph_version;
+    // m_graph_version when built; 0: not built
+    t_CKUINT m_version;
+    // number of ugens
+    t_CKUINT m_num_ugens;
+    // ugen-frames passed over, and skipped (tasks add theirs when done)
+    t_CKUINT m_frames;
+    std::atomic<t_CKUINT> m_skipped;
 };
 
 
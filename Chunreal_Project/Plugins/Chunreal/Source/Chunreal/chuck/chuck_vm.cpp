@@ -194,9 +194,17 @@ Chuck_VM::Chuck_VM()
     m_shreduler = NULL;
     m_num_dumped_shreds = 0;
     m_globals_manager = NULL; // 1.4.1.0 (jack)
+    m_pool = NULL; // 1.5.5.3
+    // created here, not on first profile(), so the VM thread never sees
+    // the pointer change under it | 1.5.5.3
+    m_profiler = new Chuck_VM_Profiler;
+    m_profiling = FALSE;
+    // per-VM shred statistics | 1.5.5.3
+    CK_TRACK( m_stats = new Chuck_Stats( this ) );
     m_msg_buffer = NULL;
     m_reply_buffer = NULL;
     m_event_buffer = NULL;
+    m_events_pending = FALSE;
     m_shred_id = 0;
     m_shred_check4dupes = FALSE; // 1.5.1.5 (ge)
     m_asap_remove_all_shreds = FALSE; // 1.5.4.4 (ge) added
@@ -228,6 +236,15 @@ Chuck_VM::~Chuck_VM()
         // cleanup
         shutdown();
     }
+
+    // discard profile (releases code it references) | 1.5.5.3
+    CK_SAFE_DELETE( m_profiler );
+    // discard shred statistics | 1.5.5.3
+    CK_TRACK( CK_SAFE_DELETE( m_stats ) );
+
+    // let go of object pool; it reclaims itself once any objects still
+    // referenced elsewhere are released | 1.5.5.3
+    if( m_pool ) { m_pool->detach(); m_pool = NULL; }
 }
 
 
@@ -282,6 +299,10 @@ t_CKBOOL Chuck_VM::initialize( t_CKUINT srate, t_CKUINT dac_chan,
     EM_log( CK_LOG_SYSTEM, "allocating globals manager..." );
     m_globals_manager = new Chuck_Globals_Manager( this );
 
+    // 1.5.5.3: added object pool
+    EM_log( CK_LOG_SYSTEM, "allocating object pool..." );
+    if( !m_pool ) m_pool = new Chuck_VM_Pool;
+
     // pop log
     EM_poplog();
 
@@ -367,12 +388,15 @@ t_CKBOOL Chuck_VM::initialize_synthesis()
     m_bunghole->lock();
     initialize_object( m_bunghole, env()->ckt_ugen, NULL, this );
     m_bunghole->tick = NULL;
+    m_bunghole->tickv = NULL;
     m_bunghole->alloc_v( m_shreduler->m_max_block_size );
     m_shreduler->m_dac = m_dac;
     m_shreduler->m_adc = m_adc;
     m_shreduler->m_bunghole = m_bunghole;
     m_shreduler->m_num_dac_channels = m_num_dac_channels;
     m_shreduler->m_num_adc_channels = m_num_adc_channels;
+    // the flattened graph is pulled from dac, then blackhole | 1.5.5.3
+    m_shreduler->m_ugen_schedule.set_roots( m_dac, m_bunghole, m_adc );
 
     return TRUE;
 }
@@ -484,6 +508,8 @@ t_CKBOOL Chuck_VM::shutdown()
         // reclaim
         CK_SAFE_DELETE_ARRAY( m_adc->m_multi_chan );
     }
+    // forget the flattened graph | 1.5.5.3
+    if( m_shreduler ) m_shreduler->m_ugen_schedule.set_roots( NULL, NULL, NULL );
     // release
     CK_SAFE_RELEASE( m_dac );
     CK_SAFE_RELEASE( m_adc );
@@ -580,7 +606,10 @@ t_CKBOOL Chuck_VM::compute()
     // REFACTOR-2017: spork queued shreds, handle global messages
     // this is called once per chuck time / sample / "tick"
     // global manager added 1.4.1.0 (jack)
-    m_globals_manager->handle_global_queue_messages();
+    // 1.5.5.3: only enter the handler if the host has queued something;
+    // retries are re-queued by the handler, so they still show up here
+    if( m_globals_manager->more_requests() )
+        m_globals_manager->handle_global_queue_messages();
 
     // iterate until no more shreds/events/messages
     while( iterate )
@@ -593,14 +622,14 @@ t_CKBOOL Chuck_VM::compute()
             // set the current time of the shred
             shred->now = shred->wake_time;
             // track shred activation
-            CK_TRACK( Chuck_Stats::instance()->activate_shred( shred ) );
+            CK_TRACK( m_stats->activate_shred( shred ) );
 
             // run the shred
             // 1.5.0.0 (ge) add check for shred->is_done, which flags a shred to exit
             if( shred->is_done || !shred->run( this ) )
             {
                 // track shred deactivation
-                CK_TRACK( Chuck_Stats::instance()->deactivate_shred( shred ) );
+                CK_TRACK( m_stats->deactivate_shred( shred ) );
 
                 this->free_shred( shred, TRUE );
                 shred = NULL;
@@ -608,7 +637,7 @@ t_CKBOOL Chuck_VM::compute()
             }
 
             // track shred deactivation
-            CK_TRACK( if( shred ) Chuck_Stats::instance()->deactivate_shred( shred ) );
+            CK_TRACK( if( shred ) m_stats->deactivate_shred( shred ) );
             // get next shred queued for 'now'
             shred = m_shreduler->get();
         }
@@ -616,29 +645,38 @@ t_CKBOOL Chuck_VM::compute()
         // set to false for now
         iterate = FALSE;
 
-        // broadcast queued events
-        while( m_event_buffer->get( &event, 1 ) )
+        // 1.5.5.3: event buffers are only polled if something was queued;
+        // the flag is cleared *before* draining, so a put that races with
+        // the drain below is either drained now or flagged for next time
+        if( m_events_pending.exchange( FALSE ) )
         {
-            event->broadcast_local();
-            event->broadcast_global();
-            iterate = TRUE;
-        }
-
-        // loop over thread-specific queued event buffers (added 1.3.0.0)
-        for( list<CBufferSimple *>::const_iterator i = m_event_buffers.begin();
-             i != m_event_buffers.end(); i++ )
-        {
-            while( (*i)->get( &event, 1 ) )
+            // broadcast queued events
+            while( m_event_buffer->get( &event, 1 ) )
             {
                 event->broadcast_local();
                 event->broadcast_global();
                 iterate = TRUE;
             }
+
+            // loop over thread-specific queued event buffers (added 1.3.0.0)
+            for( list<CBufferSimple *>::const_iterator i = m_event_buffers.begin();
+                 i != m_event_buffers.end(); i++ )
+            {
+                while( (*i)->get( &event, 1 ) )
+                {
+                    event->broadcast_local();
+                    event->broadcast_global();
+                    iterate = TRUE;
+                }
+            }
         }
 
         // process messages
-        while( m_msg_buffer->get( &msg, 1 ) )
-        { process_msg( msg ); iterate = TRUE; }
+        if( m_msg_buffer->more() )
+        {
+            while( m_msg_buffer->get( &msg, 1 ) )
+            { process_msg( msg ); iterate = TRUE; }
+        }
 
         // clear dumped shreds
         if( m_num_dumped_shreds > 0 )
@@ -654,6 +692,49 @@ t_CKBOOL Chuck_VM::compute()
 
 
 
+//-----------------------------------------------------------------------------
+// name: idle() | 1.5.5.3 (added)
+// desc: TRUE if compute() at the current time would neither run a shred
+//       nor drain a queue, and would not stop the VM; this lets run() skip
+//       straight to the next wake time in non-adaptive mode
+//-----------------------------------------------------------------------------
+t_CKBOOL Chuck_VM::idle()
+{
+    // shred due 'now'?
+    Chuck_VM_Shred * next = m_shreduler->shred_list;
+    if( next && m_shreduler->due( next, m_shreduler->now_system ) )
+        return FALSE;
+
+    // anything for compute() to handle or reclaim?
+    if( m_asap_remove_all_shreds || m_num_dumped_shreds > 0 )
+        return FALSE;
+    // anything queued by the host?
+    if( m_events_pending || m_msg_buffer->more() || m_globals_manager->more_requests() )
+        return FALSE;
+
+    // compute() would return FALSE; let it do so
+    return m_num_shreds || !m_halt;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: profile() | 1.5.5.3 (added)
+// desc: turn the instruction profiler on or off; takes effect at the next
+//       shred activation; data is kept across off/on until cleared
+//-----------------------------------------------------------------------------
+void Chuck_VM::profile( t_CKBOOL onOff )
+{
+    // log
+    EM_log( CK_LOG_SYSTEM, "instruction profiler: %s", onOff ? "ON" : "OFF" );
+    // set
+    m_profiling = onOff;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: run()
 // desc: run VM and compute the next N frames of audio
@@ -671,8 +752,15 @@ t_CKBOOL Chuck_VM::run( t_CKINT N, const SAMPLE * input, SAMPLE * output )
     // zero output buffer
     memset( output, 0, N*m_num_dac_channels*sizeof(SAMPLE) );
 
-    // for now, check for global variables once per sample (below)
-    // TODO: once per buffer instead? (place here then)
+    // this thread now owns the object pool; reclaim objects released
+    // from other threads since the last run | 1.5.5.3
+    if( m_pool ) m_pool->enter();
+
+    // host queues (globals, events, messages) are checked in compute(),
+    // each with a flag test, and drained only when non-empty; in
+    // non-adaptive mode compute() is skipped while the VM is idle (see
+    // below), but anything the host queues meanwhile ends the skip, and
+    // lands on the next sample | 1.5.5.3
 
     // loop it
     while( N )
@@ -685,6 +773,28 @@ t_CKBOOL Chuck_VM::run( t_CKINT N, const SAMPLE * input, SAMPLE * output )
         {
             m_shreduler->advance( frame++ );
             if( N > 0 ) N--;
+
+            // 1.5.5.3: if no shred is due and no host input is pending, skip
+            // compute() and only tick the UGen graph, up to the sample the
+            // next shred is due on; host input arriving meanwhile, and a
+            // wake-up caused by a UGen (e.g., a Chugen broadcasting an
+            // event), still run on the exact sample -- which is why this
+            // ticks a sample at a time, not a block (advance_v() would only
+            // see the wake-up at the end of the block; that is what adaptive
+            // mode is for)
+            if( N > 0 && idle() )
+            {
+                Chuck_VM_Shred * next = m_shreduler->shred_list;
+                t_CKINT n = m_shreduler->samps_until_due( N );
+                while( n-- > 0 )
+                {
+                    m_shreduler->advance( frame++ );
+                    N--;
+                    // woken by a tick, or input queued by a tick or the host
+                    if( m_shreduler->shred_list != next || m_events_pending ||
+                        m_msg_buffer->more() || m_globals_manager->more_requests() ) break;
+                }
+            }
         }
         else m_shreduler->advance_v( N, frame );
     }
@@ -765,6 +875,8 @@ t_CKBOOL Chuck_VM::queue_event( Chuck_Event * event, t_CKINT count,
     }
     // put into the buffer
     buffer->put( &event, count );
+    // flag for compute(); must come after the put | 1.5.5.3
+    m_events_pending = TRUE;
 
     // done
     return TRUE;
@@ -898,8 +1010,6 @@ t_CKUINT Chuck_VM::process_msg( Chuck_Msg * & msg )
             this->free_shred( out, TRUE, TRUE );
             // set return value to shred ID
             retval = shred->xid;
-            // tracking new shred
-            CK_TRACK( Chuck_Stats::instance()->add_shred( shred ) );
             goto done;
         }
         else
@@ -1266,9 +1376,6 @@ Chuck_VM_Shred * Chuck_VM::spork( Chuck_VM_Code * code, Chuck_VM_Shred * parent,
         m_globals_manager->add_request( spork_request );
     }
 
-    // track new shred
-    CK_TRACK( Chuck_Stats::instance()->add_shred( shred ) );
-
     return shred;
 }
 
@@ -1297,6 +1404,9 @@ Chuck_VM_Shred * Chuck_VM::spork( Chuck_VM_Shred * shred )
     m_shreduler->shredule( shred );
     // count
     m_num_shreds++;
+    // track new shred; done here since only the VM thread may claim
+    // stats slots (host-thread sporks arrive via spork_shred_request)
+    CK_TRACK( m_stats->add_shred( shred ) );
 
     // notify watcher | 1.5.1.5
     notify_watchers( ckvm_shreds_watch_SPORK, shred, m_shreds_watchers_spork );
@@ -1387,7 +1497,7 @@ t_CKBOOL Chuck_VM::free_shred( Chuck_VM_Shred * shred, t_CKBOOL cascade, t_CKBOO
         shred->parent->children.erase( shred->xid );
 
     // track remove shred
-    CK_TRACK( Chuck_Stats::instance()->remove_shred( shred ) );
+    CK_TRACK( m_stats->remove_shred( shred ) );
 
     // free!
     m_shreduler->remove( shred );
@@ -1772,6 +1882,11 @@ Chuck_VM_Code::~Chuck_VM_Code()
     }
 
     num_instr = 0;
+
+    // release what was loaded with us | 1.5.5.3
+    for( t_CKUINT i = 0; i < image_refs.size(); i++ )
+        CK_SAFE_RELEASE( image_refs[i] );
+    image_refs.clear();
 }
 
 
@@ -1902,6 +2017,8 @@ Chuck_VM_Shred::Chuck_VM_Shred()
 
     // set
     CK_TRACK( stat = NULL );
+    prof_node = NULL;
+    prof_generation = 0;
 }
 
 
@@ -2161,6 +2278,14 @@ t_CKBOOL Chuck_VM_Shred::shutdown()
         m_parent_objects.clear();
     }
 
+    // release scratch objects | 1.5.5.3
+    for( map<Chuck_Instr *, Chuck_Object *>::iterator it = m_scratch.begin();
+         it != m_scratch.end(); it++ )
+    {
+        CK_SAFE_RELEASE( it->second );
+    }
+    m_scratch.clear();
+
     // reclaim the stacks
     CK_SAFE_DELETE( mem );
     CK_SAFE_DELETE( reg );
@@ -2358,6 +2483,11 @@ t_CKBOOL Chuck_VM_Shred::run( Chuck_VM * vm )
     is_running = TRUE;
     // pointer to running state
     const t_CKBOOL * loop_running = &(vm_ref->runningState());
+    // instruction profiler, if on | 1.5.5.3
+    Chuck_VM_Profiler * profiler = vm_ref->profiling() ? vm_ref->profiler() : NULL;
+    if( profiler ) profiler->activate( this );
+    // instructions executed this run (tracking)
+    CK_TRACK( t_CKUINT cycles = 0 );
 
     // go!
     while( is_running && *loop_running && !is_abort )
@@ -2371,7 +2501,13 @@ CK_VM_STACK_DEBUG( t_CKBYTE * t_mem_sp = this->mem->sp );
 CK_VM_STACK_DEBUG( t_CKBYTE * t_reg_sp = this->reg->sp );
 //-----------------------------------------------------------------------------
         // execute the instruction
-        instr[pc]->execute( vm, this );
+        if( !profiler ) instr[pc]->execute( vm, this );
+        else
+        {
+            profiler->before( code, pc, mem->sp );
+            instr[pc]->execute( vm, this );
+            profiler->after( this );
+        }
 //-----------------------------------------------------------------------------
 CK_VM_STACK_DEBUG( CK_FPRINTF_STDERR( "CK_VM_DEBUG mem sp in: 0x%08lx out: 0x%08lx\n",
                    (unsigned long)t_mem_sp, (unsigned long)this->mem->sp ) );
@@ -2392,11 +2528,16 @@ CK_VM_STACK_DEBUG( CK_FPRINTF_STDERR( "CK_VM_DEBUG reg sp in: 0x%08lx out: 0x%08
         next_pc++;
 
         // track number of cycles
-        CK_TRACK( this->stat->cycles++ );
+        CK_TRACK( cycles++ );
         // if enabled, update shred stacks depth observation | 1.5.1.5
         CK_VM_STACK_OBSERVE( ckvm_observe_stackdepth_across_all_shreds( this ) );
     }
 
+    // done profiling this activation
+    if( profiler ) profiler->deactivate( this );
+    // tally cycles (published by Chuck_Stats::deactivate_shred())
+    CK_TRACK( if( stat ) stat->cycles_now += cycles );
+
     // check abort
     if( is_abort )
     {
@@ -2869,11 +3010,9 @@ void Chuck_VM_Shreduler::advance_v( t_CKINT & numLeft, t_CKINT & offset )
     // update time
     m_adc->m_time = this->now_system;
 
-    // PROCESSING
-    m_dac->system_tick_v( this->now_system, numFrames );
-
-    // suck samples
-    m_bunghole->system_tick_v( this->now_system, numFrames );
+    // PROCESSING: pull dac, then suck samples into blackhole, in one pass
+    // over the flattened graph | 1.5.5.3
+    m_ugen_schedule.tick_v( this->now_system, numFrames );
 
     // OUTPUT: adaptive block
     for( i = 0; i < numFrames; i++ )
@@ -2946,8 +3085,9 @@ void Chuck_VM_Shreduler::advance( t_CKINT N )
     m_adc->m_last = m_adc->m_current = sum / m_num_adc_channels;
     m_adc->m_time = this->now_system;
 
-    // PROCESSING
-    m_dac->system_tick( this->now_system );
+    // PROCESSING: pull dac, then suck samples into blackhole, in one pass
+    // over the flattened graph | 1.5.5.3
+    m_ugen_schedule.tick( this->now_system );
     // OUTPUT
     for( i = 0; i < m_num_dac_channels; i++ )
     {
@@ -2961,9 +3101,30 @@ void Chuck_VM_Shreduler::advance( t_CKINT N )
         output[i] = m_dac->m_multi_chan[i]->m_current; // * .5f;
         #endif
     }
+}
+
 
-    // suck samples
-    m_bunghole->system_tick( this->now_system );
+
+
+//-----------------------------------------------------------------------------
+// name: samps_until_due() | 1.5.5.3 (added)
+// desc: whole samples to advance before the next waiting shred is due, at
+//       most 'max' (also if none is waiting)
+//-----------------------------------------------------------------------------
+t_CKINT Chuck_VM_Shreduler::samps_until_due( t_CKINT max ) const
+{
+    // nothing waiting
+    Chuck_VM_Shred * shred = shred_list;
+    if( !shred || max <= 0 ) return ck_max( max, (t_CKINT)0 );
+
+    // solve due( shred, now_system + n ) for the smallest n
+    t_CKDUR d = shred->wake_time - this->now_system - .5;
+    t_CKINT n = d <= 0 ? 0 : ( d >= max ? max : (t_CKINT)ceil( d ) );
+    // settle on exactly what due() says, in case of rounding
+    while( n > 0 && due( shred, this->now_system + (n-1) ) ) n--;
+    while( n < max && !due( shred, this->now_system + n ) ) n++;
+
+    return n;
 }
 
 
@@ -2988,7 +3149,7 @@ Chuck_VM_Shred * Chuck_VM_Shreduler::get( )
     }
 
     // check the front of the shred wait-to-run list; ready to run?
-    if( shred->wake_time <= ( this->now_system + .5 ) )
+    if( due( shred, this->now_system ) )
     {
         // set beginning of list to next
         shred_list = shred->next;
@@ -3363,6 +3524,9 @@ void Chuck_VM_Shreduler::status( Chuck_VM_Status * status )
     status->t_second = sec;
     status->t_minute = m;
     status->t_hour = h;
+    // 1.5.5.3 (added)
+    status->ugen_frames = m_ugen_schedule.frames();
+    status->ugen_frames_skipped = m_ugen_schedule.skipped();
 
     // a vessel for shred pointers
     vector<Chuck_VM_Shred *> list;
@@ -3401,6 +3565,11 @@ void Chuck_VM_Shreduler::status()
     EM_print2magenta( "(VM status) # of shreds in VM: %ld", m_status.list.size() );
     EM_print2magenta( "local time: %s", timestamp_formatted().c_str() );
     EM_print2magenta( "chuck time: %.0f::samp (%ldh%ldm%lds)", m_status.now_system, h, m, sec );
+    // 1.5.5.3 (added)
+    if( m_status.ugen_frames )
+        EM_print2magenta( "ugen-frames skipped (dormant): %lu of %lu (%.1f%%)",
+            m_status.ugen_frames_skipped, m_status.ugen_frames,
+            100.0 * m_status.ugen_frames_skipped / m_status.ugen_frames );
 
     // print status
     if( m_status.list.size() ) EM_print2vanilla( "--------" );
@@ -3428,6 +3597,7 @@ Chuck_VM_Status::Chuck_VM_Status()
     srate = 0;
     now_system = 0;
     t_second = t_minute = t_hour = 0;
+    ugen_frames = ugen_frames_skipped = 0;
 }
 
 
@@ -3521,6 +3691,8 @@ t_CKBOOL Chuck_VM_MFunInvoker::setup( Chuck_Func * func, t_CKUINT func_vt_offset
             case kindof_INT:
                 // push value INT
                 instr_args.push_back( new Chuck_Instr_Reg_Push_Imm(0) );
+                // an Object reference? | 1.5.5.3
+                instr_args_obj.push_back( isobj( vm->env(), args->type ) );
                 break;
 
             case kindof_FLOAT:
@@ -3558,10 +3730,14 @@ t_CKBOOL Chuck_VM_MFunInvoker::setup( Chuck_Func * func, t_CKUINT func_vt_offset
                 for( t_CKUINT i = 0; i < instr_args.size(); i++ ) CK_SAFE_DELETE( instr_args[i] );
                 // clear the array
                 instr_args.clear();
+                instr_args_obj.clear();
                 // error out
                 return FALSE;
         }
 
+        // not an Object
+        instr_args_obj.resize( instr_args.size(), FALSE );
+
         // next arg
         args = args->next;
     }
@@ -3750,6 +3926,8 @@ Chuck_DL_Return Chuck_VM_MFunInvoker::invoke( Chuck_Object * obj, const vector<C
             case kindof_INT:
                 instr_pushInt = ckvm_next_instr_as_int(instr_args, index); if( !instr_pushInt ) goto error;
                 instr_pushInt->set( arg.value.v_int );
+                // the mfun releases its Object arguments on return | 1.5.5.3
+                if( instr_args_obj[index-1] ) CK_SAFE_ADD_REF( arg.value.v_object );
                 break;
             case kindof_FLOAT:
                 instr_pushFloat = ckvm_next_instr_as_float(instr_args, index); if( !instr_pushFloat ) goto error;
@@ -3795,10 +3973,54 @@ Chuck_DL_Return Chuck_VM_MFunInvoker::invoke( Chuck_Object * obj, const vector<C
         goto error;
     }
 
+    // run it
+    run( obj, parent_shred, &RETURN );
+
+    // done; by the point, return should have been filled with return value, if func has one
+    return RETURN;
+
+error:
+    // do the same thing for now
+    return RETURN;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: invoke()
+// desc: invoke an mfun taking one float | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+Chuck_DL_Return Chuck_VM_MFunInvoker::invoke( Chuck_Object * obj, t_CKFLOAT arg, Chuck_VM_Shred * parent_shred )
+{
+    // the return value
+    Chuck_DL_Return RETURN;
+    // no shred?
+    if( !invoker_shred ) return RETURN;
+    // verify
+    assert( instr_pushThis != NULL && instr_args.size() == 1 );
+
+    // set the argument
+    ((Chuck_Instr_Reg_Push_Imm2 *)instr_args[0])->set( arg );
+    // run it
+    run( obj, parent_shred, &RETURN );
+
+    return RETURN;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: run()
+// desc: run the invoker shred on obj, arguments already set
+//-----------------------------------------------------------------------------
+void Chuck_VM_MFunInvoker::run( Chuck_Object * obj, Chuck_VM_Shred * parent_shred, Chuck_DL_Return * RETURN )
+{
     // set this pointer
     instr_pushThis->set( (t_CKUINT)obj );
     // set the return var, if the function was set up to return a value
-    if( instr_pushReturnVar ) instr_pushReturnVar->set( (t_CKUINT)&RETURN );
+    if( instr_pushReturnVar ) instr_pushReturnVar->set( (t_CKUINT)RETURN );
 
     // reset shred: program counter
     invoker_shred->pc = 0;
@@ -3831,13 +4053,6 @@ Chuck_DL_Return Chuck_VM_MFunInvoker::invoke( Chuck_Object * obj, const vector<C
     invoker_shred->now = invoker_shred->vm_ref->now();
     // run shred on VM
     invoker_shred->run( invoker_shred->vm_ref );
-
-    // done; by the point, return should have been filled with return value, if func has one
-    return RETURN;
-
-error:
-    // do the same thing for now
-    return RETURN;
 }
 
 
@@ -3856,6 +4071,7 @@ void Chuck_VM_MFunInvoker::cleanup()
 
     // clear the arg instructions
     instr_args.clear();
+    instr_args_obj.clear();
 
     // zero out
     instr_pushThis = NULL;
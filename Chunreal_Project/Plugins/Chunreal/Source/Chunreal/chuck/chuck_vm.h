@@ -37,16 +37,15 @@
 #include <map>
 #include <vector>
 #include <list>
+#include <atomic>
 
 #include "chuck_oo.h"
 #include "chuck_ugen.h"
 #include "chuck_type.h"
 #include "chuck_carrier.h"
 
-// tracking
-#ifdef __CHUCK_STAT_TRACK__
+// tracking (and, since 1.5.5.3, instruction profiler)
 #include "chuck_stats.h"
-#endif
 
 
 
@@ -149,6 +148,11 @@ public:
 
     // filename this code came from (added 1.3.0.0)
     std::string filename;
+
+    // for top-level code loaded from a bytecode image: everything else the
+    // image created (other code, functions, string literals), released
+    // with this code | 1.5.5.3
+    std::vector<Chuck_VM_Object *> image_refs;
 };
 
 
@@ -277,6 +281,9 @@ public:
 public:
     // tracking
     CK_TRACK( Shred_Stat * stat );
+    // instruction profiler context (valid if generation matches) | 1.5.5.3
+    Chuck_Profile_Node * prof_node;
+    t_CKUINT prof_generation;
 
 public:
     // map of ugens for the shred
@@ -284,6 +291,9 @@ public:
     // references kept by the shred itself (e.g., when sporking member functions)
     // to be released when shred is done -- added 1.3.1.2
     std::vector<Chuck_Object *> m_parent_objects;
+    // scratch objects for non-escaping locals, by instantiating instruction;
+    // each holds a reference until the shred is done | 1.5.5.3
+    std::map<Chuck_Instr *, Chuck_Object *> m_scratch;
 
 public: // ge: 1.3.5.3
     // make and push new loop counter
@@ -406,6 +416,9 @@ public:
     t_CKUINT t_second;
     t_CKUINT t_minute;
     t_CKUINT t_hour;
+    // ugen-frames ticked or skipped so far, and skipped (dormant ugens) | 1.5.5.3
+    t_CKUINT ugen_frames;
+    t_CKUINT ugen_frames_skipped;
     // list of shred status
     std::vector<Chuck_VM_Shred_Status *> list;
 };
@@ -495,6 +508,13 @@ public: // shreduling (shred interface part 1)
     t_CKBOOL shredule( Chuck_VM_Shred * shred, t_CKTIME wake_time );
     // get next shred to run
     Chuck_VM_Shred * get();
+    // is a shred on the wait list due to run at time 'when'? wake times
+    // may fall between samples; a shred runs on the nearest one | 1.5.5.3
+    t_CKBOOL due( const Chuck_VM_Shred * shred, t_CKTIME when ) const
+    { return shred->wake_time <= ( when + .5 ); }
+    // whole samples to advance before the next waiting shred is due, at
+    // most 'max' (also if none is waiting) | 1.5.5.3
+    t_CKINT samps_until_due( t_CKINT max ) const;
     // advance shreduler
     void advance( t_CKINT N );
     // advance shreduler vectorized edition
@@ -581,6 +601,8 @@ public:
     Chuck_UGen * m_bunghole;
     t_CKUINT m_num_dac_channels;
     t_CKUINT m_num_adc_channels;
+    // the ugen graph, flattened for ticking | 1.5.5.3
+    Chuck_UGen_Schedule m_ugen_schedule;
 
     // status cache
     Chuck_VM_Status m_status;
@@ -645,6 +667,8 @@ public: // shredsuck
     t_CKUINT next_id( const Chuck_VM_Shred * shred = NULL );
     // the last used spork ID
     t_CKUINT last_id() const;
+    // number of shreds in the VM | 1.5.5.3
+    t_CKUINT num_shreds() const { return m_num_shreds; }
     // reset ID to highest current ID + 1; returns what next ID would be
     t_CKUINT reset_id();
     // the current chuck time | 1.5.0.8
@@ -658,6 +682,8 @@ public: // running the machine
     t_CKBOOL run( t_CKINT numFrames, const SAMPLE * input, SAMPLE * output );
     // compute all shreds for current time
     t_CKBOOL compute();
+    // would compute() have nothing to do at the current time? | 1.5.5.3
+    t_CKBOOL idle();
     // abort current running shred
     t_CKBOOL abort_current_shred();
     // get currently executing shred | 1.5.1.8 (ge) now in VM, in addition to shreduler
@@ -666,6 +692,19 @@ public: // running the machine
     // remove all shreds asap (thread-safe) | 1.5.4.4 (ge) added
     void remove_all_shreds();
 
+#if defined(__CHUCK_STAT_TRACK__)
+public: // shred statistics; per VM since 1.5.5.3 (was a singleton)
+    Chuck_Stats * stats() const { return m_stats; }
+#endif
+
+public: // instruction profiler | 1.5.5.3
+    // turn profiling on or off (collected data is kept until cleared)
+    void profile( t_CKBOOL onOff );
+    // is profiling on?
+    t_CKBOOL profiling() const { return m_profiling.load( std::memory_order_relaxed ); }
+    // the profiler; created with the VM
+    Chuck_VM_Profiler * profiler() const { return m_profiler; }
+
 public: // invoke functions
     t_CKBOOL invoke_static( Chuck_VM_Shred * shred );
 
@@ -706,6 +745,8 @@ public:
     Chuck_IO_Cherr * cherr() const { return m_carrier->cherr; }
     // 1.4.1.0 (jack): get associated globals manager
     Chuck_Globals_Manager * globals_manager() const { return m_globals_manager; }
+    // get per-VM object pool | 1.5.5.3 added
+    Chuck_VM_Pool * pool() const { return m_pool; }
 
 public:
     // subscribe shreds watcher callback | 1.5.1.5
@@ -797,6 +838,9 @@ protected:
 
     // TODO: vector? (added 1.3.0.0 to fix uber-crash)
     std::list<CBufferSimple *> m_event_buffers;
+    // set by queue_event() after a put into any of the event buffers;
+    // lets compute() skip polling them when nothing is pending | 1.5.5.3
+    std::atomic<t_CKBOOL> m_events_pending;
 
 protected:
     // 1.5.4.3 (ge) added static initializer run queue
@@ -808,6 +852,22 @@ protected:
     // 1.4.1.0 (jack): manager for global variables
     Chuck_Globals_Manager * m_globals_manager;
 
+protected:
+    // 1.5.5.3: slab pool for objects instantiated by shreds on this VM
+    Chuck_VM_Pool * m_pool;
+
+#if defined(__CHUCK_STAT_TRACK__)
+protected:
+    // 1.5.5.3: shred statistics for this VM
+    Chuck_Stats * m_stats;
+#endif
+
+protected:
+    // 1.5.5.3: opt-in instruction profiler; set from the host thread,
+    // read by the VM thread at each shred activation
+    Chuck_VM_Profiler * m_profiler;
+    std::atomic<t_CKBOOL> m_profiling;
+
 protected:
     // 1.5.1.5 (ge & andrew) shreds watchers
     std::list<Chuck_VM_Shreds_Watcher> m_shreds_watchers_spork;
@@ -944,14 +1004,26 @@ public:
     Chuck_DL_Return invoke( Chuck_Object * obj,
                             const std::vector<Chuck_DL_Arg> & args,
                             Chuck_VM_Shred * parent_shred );
+    // invoke a member function taking one float, e.g., Chugen tick();
+    // no argument vector to build or check | 1.5.5.3 (added)
+    Chuck_DL_Return invoke( Chuck_Object * obj, t_CKFLOAT arg,
+                            Chuck_VM_Shred * parent_shred );
     // clean up
     void cleanup();
 
+protected:
+    // run the invoker shred, arguments already set
+    void run( Chuck_Object * obj, Chuck_VM_Shred * parent_shred,
+              Chuck_DL_Return * RETURN );
+
 public:
     // dedicated shred to call the mfun on
     Chuck_VM_Shred * invoker_shred;
     // instructions for args (to be filled on invoke)
     std::vector<Chuck_Instr *> instr_args;
+    // for each of instr_args: pushes an Object, which the mfun will
+    // release on return, and so needs a reference for it | 1.5.5.3
+    std::vector<t_CKBOOL> instr_args_obj;
     // instruction to update on invoke: pushing this pointer
     Chuck_Instr_Reg_Push_Imm * instr_pushThis;
     // instruction to update on invoke: pushing the var to receive return
@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,275 +45,28 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.3"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
-
-/* Using locations.  */
-#define YYLSP_NEEDED 1
-
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     ID = 258,
-     STRING_LIT = 259,
-     CHAR_LIT = 260,
-     INT_VAL = 261,
-     FLOAT_VAL = 262,
-     POUND = 263,
-     COMMA = 264,
-     COLON = 265,
-     SEMICOLON = 266,
-     LPAREN = 267,
-     RPAREN = 268,
-     LBRACK = 269,
-     RBRACK = 270,
-     LBRACE = 271,
-     RBRACE = 272,
-     DOT = 273,
-     PLUS = 274,
-     MINUS = 275,
-     TIMES = 276,
-     DIVIDE = 277,
-     PERCENT = 278,
-     EQ = 279,
-     NEQ = 280,
-     LT = 281,
-     LE = 282,
-     GT = 283,
-     GE = 284,
-     AND = 285,
-     OR = 286,
-     ASSIGN = 287,
-     IF = 288,
-     THEN = 289,
-     ELSE = 290,
-     WHILE = 291,
-     FOR = 292,
-     DO = 293,
-     LOOP = 294,
-     BREAK = 295,
-     CONTINUE = 296,
-     NULL_TOK = 297,
-     FUNCTION = 298,
-     RETURN = 299,
-     QUESTION = 300,
-     EXCLAMATION = 301,
-     S_OR = 302,
-     S_AND = 303,
-     S_XOR = 304,
-     PLUSPLUS = 305,
-     MINUSMINUS = 306,
-     DOLLAR = 307,
-     POUNDPAREN = 308,
-     PERCENTPAREN = 309,
-     ATPAREN = 310,
-     SIMULT = 311,
-     PATTERN = 312,
-     CODE = 313,
-     TRANSPORT = 314,
-     HOST = 315,
-     TIME = 316,
-     WHENEVER = 317,
-     NEXT = 318,
-     UNTIL = 319,
-     EXTERNAL = 320,
-     GLOBAL = 321,
-     EVERY = 322,
-     BEFORE = 323,
-     AFTER = 324,
-     AT = 325,
-     AT_SYM = 326,
-     ATAT_SYM = 327,
-     NEW = 328,
-     SIZEOF = 329,
-     TYPEOF = 330,
-     SAME = 331,
-     PLUS_CHUCK = 332,
-     MINUS_CHUCK = 333,
-     TIMES_CHUCK = 334,
-     DIVIDE_CHUCK = 335,
-     S_AND_CHUCK = 336,
-     S_OR_CHUCK = 337,
-     S_XOR_CHUCK = 338,
-     SHIFT_RIGHT_CHUCK = 339,
-     SHIFT_LEFT_CHUCK = 340,
-     PERCENT_CHUCK = 341,
-     SHIFT_RIGHT = 342,
-     SHIFT_LEFT = 343,
-     TILDA = 344,
-     CHUCK = 345,
-     COLONCOLON = 346,
-     S_CHUCK = 347,
-     AT_CHUCK = 348,
-     LEFT_S_CHUCK = 349,
-     UNCHUCK = 350,
-     UPCHUCK = 351,
-     DOWNCHUCK = 352,
-     CLASS = 353,
-     INTERFACE = 354,
-     EXTENDS = 355,
-     IMPLEMENTS = 356,
-     PUBLIC = 357,
-     PROTECTED = 358,
-     PRIVATE = 359,
-     STATIC = 360,
-     ABSTRACT = 361,
-     CONST = 362,
-     SPORK = 363,
-     ARROW_RIGHT = 364,
-     ARROW_LEFT = 365,
-     L_HACK = 366,
-     R_HACK = 367,
-     GRUCK_RIGHT = 368,
-     GRUCK_LEFT = 369,
-     UNGRUCK_RIGHT = 370,
-     UNGRUCK_LEFT = 371,
-     AT_OP = 372,
-     AT_CTOR = 373,
-     AT_DTOR = 374,
-     AT_IMPORT = 375,
-     AT_DOC = 376
-   };
-#endif
-/* Tokens.  */
-#define ID 258
-#define STRING_LIT 259
-#define CHAR_LIT 260
-#define INT_VAL 261
-#define FLOAT_VAL 262
-#define POUND 263
-#define COMMA 264
-#define COLON 265
-#define SEMICOLON 266
-#define LPAREN 267
-#define RPAREN 268
-#define LBRACK 269
-#define RBRACK 270
-#define LBRACE 271
-#define RBRACE 272
-#define DOT 273
-#define PLUS 274
-#define MINUS 275
-#define TIMES 276
-#define DIVIDE 277
-#define PERCENT 278
-#define EQ 279
-#define NEQ 280
-#define LT 281
-#define LE 282
-#define GT 283
-#define GE 284
-#define AND 285
-#define OR 286
-#define ASSIGN 287
-#define IF 288
-#define THEN 289
-#define ELSE 290
-#define WHILE 291
-#define FOR 292
-#define DO 293
-#define LOOP 294
-#define BREAK 295
-#define CONTINUE 296
-#define NULL_TOK 297
-#define FUNCTION 298
-#define RETURN 299
-#define QUESTION 300
-#define EXCLAMATION 301
-#define S_OR 302
-#define S_AND 303
-#define S_XOR 304
-#define PLUSPLUS 305
-#define MINUSMINUS 306
-#define DOLLAR 307
-#define POUNDPAREN 308
-#define PERCENTPAREN 309
-#define ATPAREN 310
-#define SIMULT 311
-#define PATTERN 312
-#define CODE 313
-#define TRANSPORT 314
-#define HOST 315
-#define TIME 316
-#define WHENEVER 317
-#define NEXT 318
-#define UNTIL 319
-#define EXTERNAL 320
-#define GLOBAL 321
-#define EVERY 322
-#define BEFORE 323
-#define AFTER 324
-#define AT 325
-#define AT_SYM 326
-#define ATAT_SYM 327
-#define NEW 328
-#define SIZEOF 329
-#define TYPEOF 330
-#define SAME 331
-#define PLUS_CHUCK 332
-#define MINUS_CHUCK 333
-#define TIMES_CHUCK 334
-#define DIVIDE_CHUCK 335
-#define S_AND_CHUCK 336
-#define S_OR_CHUCK 337
-#define S_XOR_CHUCK 338
-#define SHIFT_RIGHT_CHUCK 339
-#define SHIFT_LEFT_CHUCK 340
-#define PERCENT_CHUCK 341
-#define SHIFT_RIGHT 342
-#define SHIFT_LEFT 343
-#define TILDA 344
-#define CHUCK 345
-#define COLONCOLON 346
-#define S_CHUCK 347
-#define AT_CHUCK 348
-#define LEFT_S_CHUCK 349
-#define UNCHUCK 350
-#define UPCHUCK 351
-#define DOWNCHUCK 352
-#define CLASS 353
-#define INTERFACE 354
-#define EXTENDS 355
-#define IMPLEMENTS 356
-#define PUBLIC 357
-#define PROTECTED 358
-#define PRIVATE 359
-#define STATIC 360
-#define ABSTRACT 361
-#define CONST 362
-#define SPORK 363
-#define ARROW_RIGHT 364
-#define ARROW_LEFT 365
-#define L_HACK 366
-#define R_HACK 367
-#define GRUCK_RIGHT 368
-#define GRUCK_LEFT 369
-#define UNGRUCK_RIGHT 370
-#define UNGRUCK_LEFT 371
-#define AT_OP 372
-#define AT_CTOR 373
-#define AT_DTOR 374
-#define AT_IMPORT 375
-#define AT_DOC 376
-
-
-
-
-/* Copy the first part of user declarations.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
 #line 1 "chuck.y"
 
 
@@ -358,123 +113,327 @@
 #include <stdio.h>
 #include <string.h>
 
-// function
-int yylex( void );
 
-void yyerror( char * s )
-{
-    EM_error( EM_tokPos, "%s", s );
-}
+#line 118 "chuck.tab.c"
 
-a_Program g_program = NULL;
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
+#include "chuck_yacc.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ID = 3,                         /* ID  */
+  YYSYMBOL_STRING_LIT = 4,                 /* STRING_LIT  */
+  YYSYMBOL_CHAR_LIT = 5,                   /* CHAR_LIT  */
+  YYSYMBOL_INT_VAL = 6,                    /* INT_VAL  */
+  YYSYMBOL_FLOAT_VAL = 7,                  /* FLOAT_VAL  */
+  YYSYMBOL_POUND = 8,                      /* POUND  */
+  YYSYMBOL_COMMA = 9,                      /* COMMA  */
+  YYSYMBOL_COLON = 10,                     /* COLON  */
+  YYSYMBOL_SEMICOLON = 11,                 /* SEMICOLON  */
+  YYSYMBOL_LPAREN = 12,                    /* LPAREN  */
+  YYSYMBOL_RPAREN = 13,                    /* RPAREN  */
+  YYSYMBOL_LBRACK = 14,                    /* LBRACK  */
+  YYSYMBOL_RBRACK = 15,                    /* RBRACK  */
+  YYSYMBOL_LBRACE = 16,                    /* LBRACE  */
+  YYSYMBOL_RBRACE = 17,                    /* RBRACE  */
+  YYSYMBOL_DOT = 18,                       /* DOT  */
+  YYSYMBOL_PLUS = 19,                      /* PLUS  */
+  YYSYMBOL_MINUS = 20,                     /* MINUS  */
+  YYSYMBOL_TIMES = 21,                     /* TIMES  */
+  YYSYMBOL_DIVIDE = 22,                    /* DIVIDE  */
+  YYSYMBOL_PERCENT = 23,                   /* PERCENT  */
+  YYSYMBOL_EQ = 24,                        /* EQ  */
+  YYSYMBOL_NEQ = 25,                       /* NEQ  */
+  YYSYMBOL_LT = 26,                        /* LT  */
+  YYSYMBOL_LE = 27,                        /* LE  */
+  YYSYMBOL_GT = 28,                        /* GT  */
+  YYSYMBOL_GE = 29,                        /* GE  */
+  YYSYMBOL_AND = 30,                       /* AND  */
+  YYSYMBOL_OR = 31,                        /* OR  */
+  YYSYMBOL_ASSIGN = 32,                    /* ASSIGN  */
+  YYSYMBOL_IF = 33,                        /* IF  */
+  YYSYMBOL_THEN = 34,                      /* THEN  */
+  YYSYMBOL_ELSE = 35,                      /* ELSE  */
+  YYSYMBOL_WHILE = 36,                     /* WHILE  */
+  YYSYMBOL_FOR = 37,                       /* FOR  */
+  YYSYMBOL_DO = 38,                        /* DO  */
+  YYSYMBOL_LOOP = 39,                      /* LOOP  */
+  YYSYMBOL_BREAK = 40,                     /* BREAK  */
+  YYSYMBOL_CONTINUE = 41,                  /* CONTINUE  */
+  YYSYMBOL_NULL_TOK = 42,                  /* NULL_TOK  */
+  YYSYMBOL_FUNCTION = 43,                  /* FUNCTION  */
+  YYSYMBOL_RETURN = 44,                    /* RETURN  */
+  YYSYMBOL_QUESTION = 45,                  /* QUESTION  */
+  YYSYMBOL_EXCLAMATION = 46,               /* EXCLAMATION  */
+  YYSYMBOL_S_OR = 47,                      /* S_OR  */
+  YYSYMBOL_S_AND = 48,                     /* S_AND  */
+  YYSYMBOL_S_XOR = 49,                     /* S_XOR  */
+  YYSYMBOL_PLUSPLUS = 50,                  /* PLUSPLUS  */
+  YYSYMBOL_MINUSMINUS = 51,                /* MINUSMINUS  */
+  YYSYMBOL_DOLLAR = 52,                    /* DOLLAR  */
+  YYSYMBOL_POUNDPAREN = 53,                /* POUNDPAREN  */
+  YYSYMBOL_PERCENTPAREN = 54,              /* PERCENTPAREN  */
+  YYSYMBOL_ATPAREN = 55,                   /* ATPAREN  */
+  YYSYMBOL_SIMULT = 56,                    /* SIMULT  */
+  YYSYMBOL_PATTERN = 57,                   /* PATTERN  */
+  YYSYMBOL_CODE = 58,                      /* CODE  */
+  YYSYMBOL_TRANSPORT = 59,                 /* TRANSPORT  */
+  YYSYMBOL_HOST = 60,                      /* HOST  */
+  YYSYMBOL_TIME = 61,                      /* TIME  */
+  YYSYMBOL_WHENEVER = 62,                  /* WHENEVER  */
+  YYSYMBOL_NEXT = 63,                      /* NEXT  */
+  YYSYMBOL_UNTIL = 64,                     /* UNTIL  */
+  YYSYMBOL_EXTERNAL = 65,                  /* EXTERNAL  */
+  YYSYMBOL_GLOBAL = 66,                    /* GLOBAL  */
+  YYSYMBOL_EVERY = 67,                     /* EVERY  */
+  YYSYMBOL_BEFORE = 68,                    /* BEFORE  */
+  YYSYMBOL_AFTER = 69,                     /* AFTER  */
+  YYSYMBOL_AT = 70,                        /* AT  */
+  YYSYMBOL_AT_SYM = 71,                    /* AT_SYM  */
+  YYSYMBOL_ATAT_SYM = 72,                  /* ATAT_SYM  */
+  YYSYMBOL_NEW = 73,                       /* NEW  */
+  YYSYMBOL_SIZEOF = 74,                    /* SIZEOF  */
+  YYSYMBOL_TYPEOF = 75,                    /* TYPEOF  */
+  YYSYMBOL_SAME = 76,                      /* SAME  */
+  YYSYMBOL_PLUS_CHUCK = 77,                /* PLUS_CHUCK  */
+  YYSYMBOL_MINUS_CHUCK = 78,               /* MINUS_CHUCK  */
+  YYSYMBOL_TIMES_CHUCK = 79,               /* TIMES_CHUCK  */
+  YYSYMBOL_DIVIDE_CHUCK = 80,              /* DIVIDE_CHUCK  */
+  YYSYMBOL_S_AND_CHUCK = 81,               /* S_AND_CHUCK  */
+  YYSYMBOL_S_OR_CHUCK = 82,                /* S_OR_CHUCK  */
+  YYSYMBOL_S_XOR_CHUCK = 83,               /* S_XOR_CHUCK  */
+  YYSYMBOL_SHIFT_RIGHT_CHUCK = 84,         /* SHIFT_RIGHT_CHUCK  */
+  YYSYMBOL_SHIFT_LEFT_CHUCK = 85,          /* SHIFT_LEFT_CHUCK  */
+  YYSYMBOL_PERCENT_CHUCK = 86,             /* PERCENT_CHUCK  */
+  YYSYMBOL_SHIFT_RIGHT = 87,               /* SHIFT_RIGHT  */
+  YYSYMBOL_SHIFT_LEFT = 88,                /* SHIFT_LEFT  */
+  YYSYMBOL_TILDA = 89,                     /* TILDA  */
+  YYSYMBOL_CHUCK = 90,                     /* CHUCK  */
+  YYSYMBOL_COLONCOLON = 91,                /* COLONCOLON  */
+  YYSYMBOL_S_CHUCK = 92,                   /* S_CHUCK  */
+  YYSYMBOL_AT_CHUCK = 93,                  /* AT_CHUCK  */
+  YYSYMBOL_LEFT_S_CHUCK = 94,              /* LEFT_S_CHUCK  */
+  YYSYMBOL_UNCHUCK = 95,                   /* UNCHUCK  */
+  YYSYMBOL_UPCHUCK = 96,                   /* UPCHUCK  */
+  YYSYMBOL_DOWNCHUCK = 97,                 /* DOWNCHUCK  */
+  YYSYMBOL_CLASS = 98,                     /* CLASS  */
+  YYSYMBOL_INTERFACE = 99,                 /* INTERFACE  */
+  YYSYMBOL_EXTENDS = 100,                  /* EXTENDS  */
+  YYSYMBOL_IMPLEMENTS = 101,               /* IMPLEMENTS  */
+  YYSYMBOL_PUBLIC = 102,                   /* PUBLIC  */
+  YYSYMBOL_PROTECTED = 103,                /* PROTECTED  */
+  YYSYMBOL_PRIVATE = 104,                  /* PRIVATE  */
+  YYSYMBOL_STATIC = 105,                   /* STATIC  */
+  YYSYMBOL_ABSTRACT = 106,                 /* ABSTRACT  */
+  YYSYMBOL_CONST = 107,                    /* CONST  */
+  YYSYMBOL_SPORK = 108,                    /* SPORK  */
+  YYSYMBOL_ARROW_RIGHT = 109,              /* ARROW_RIGHT  */
+  YYSYMBOL_ARROW_LEFT = 110,               /* ARROW_LEFT  */
+  YYSYMBOL_L_HACK = 111,                   /* L_HACK  */
+  YYSYMBOL_R_HACK = 112,                   /* R_HACK  */
+  YYSYMBOL_GRUCK_RIGHT = 113,              /* GRUCK_RIGHT  */
+  YYSYMBOL_GRUCK_LEFT = 114,               /* GRUCK_LEFT  */
+  YYSYMBOL_UNGRUCK_RIGHT = 115,            /* UNGRUCK_RIGHT  */
+  YYSYMBOL_UNGRUCK_LEFT = 116,             /* UNGRUCK_LEFT  */
+  YYSYMBOL_AT_OP = 117,                    /* AT_OP  */
+  YYSYMBOL_AT_CTOR = 118,                  /* AT_CTOR  */
+  YYSYMBOL_AT_DTOR = 119,                  /* AT_DTOR  */
+  YYSYMBOL_AT_IMPORT = 120,                /* AT_IMPORT  */
+  YYSYMBOL_AT_DOC = 121,                   /* AT_DOC  */
+  YYSYMBOL_YYACCEPT = 122,                 /* $accept  */
+  YYSYMBOL_program = 123,                  /* program  */
+  YYSYMBOL_program_section = 124,          /* program_section  */
+  YYSYMBOL_class_definition = 125,         /* class_definition  */
+  YYSYMBOL_class_ext = 126,                /* class_ext  */
+  YYSYMBOL_class_body = 127,               /* class_body  */
+  YYSYMBOL_class_body2 = 128,              /* class_body2  */
+  YYSYMBOL_class_section = 129,            /* class_section  */
+  YYSYMBOL_iface_ext = 130,                /* iface_ext  */
+  YYSYMBOL_id_list = 131,                  /* id_list  */
+  YYSYMBOL_id_dot = 132,                   /* id_dot  */
+  YYSYMBOL_function_definition = 133,      /* function_definition  */
+  YYSYMBOL_class_decl = 134,               /* class_decl  */
+  YYSYMBOL_function_decl = 135,            /* function_decl  */
+  YYSYMBOL_static_decl = 136,              /* static_decl  */
+  YYSYMBOL_type_decl_a = 137,              /* type_decl_a  */
+  YYSYMBOL_type_decl_b = 138,              /* type_decl_b  */
+  YYSYMBOL_type_decl = 139,                /* type_decl  */
+  YYSYMBOL_type_decl2 = 140,               /* type_decl2  */
+  YYSYMBOL_arg_list = 141,                 /* arg_list  */
+  YYSYMBOL_statement_list = 142,           /* statement_list  */
+  YYSYMBOL_statement = 143,                /* statement  */
+  YYSYMBOL_jump_statement = 144,           /* jump_statement  */
+  YYSYMBOL_selection_statement = 145,      /* selection_statement  */
+  YYSYMBOL_loop_statement = 146,           /* loop_statement  */
+  YYSYMBOL_code_segment = 147,             /* code_segment  */
+  YYSYMBOL_import_statement = 148,         /* import_statement  */
+  YYSYMBOL_import_list = 149,              /* import_list  */
+  YYSYMBOL_import_target = 150,            /* import_target  */
+  YYSYMBOL_doc_statement = 151,            /* doc_statement  */
+  YYSYMBOL_doc_list = 152,                 /* doc_list  */
+  YYSYMBOL_doc_target = 153,               /* doc_target  */
+  YYSYMBOL_expression_statement = 154,     /* expression_statement  */
+  YYSYMBOL_expression = 155,               /* expression  */
+  YYSYMBOL_chuck_expression = 156,         /* chuck_expression  */
+  YYSYMBOL_arrow_expression = 157,         /* arrow_expression  */
+  YYSYMBOL_array_exp = 158,                /* array_exp  */
+  YYSYMBOL_array_empty = 159,              /* array_empty  */
+  YYSYMBOL_decl_expression = 160,          /* decl_expression  */
+  YYSYMBOL_var_decl_list = 161,            /* var_decl_list  */
+  YYSYMBOL_var_decl = 162,                 /* var_decl  */
+  YYSYMBOL_complex_exp = 163,              /* complex_exp  */
+  YYSYMBOL_polar_exp = 164,                /* polar_exp  */
+  YYSYMBOL_vec_exp = 165,                  /* vec_exp  */
+  YYSYMBOL_chuck_operator = 166,           /* chuck_operator  */
+  YYSYMBOL_arrow_operator = 167,           /* arrow_operator  */
+  YYSYMBOL_conditional_expression = 168,   /* conditional_expression  */
+  YYSYMBOL_logical_or_expression = 169,    /* logical_or_expression  */
+  YYSYMBOL_logical_and_expression = 170,   /* logical_and_expression  */
+  YYSYMBOL_inclusive_or_expression = 171,  /* inclusive_or_expression  */
+  YYSYMBOL_exclusive_or_expression = 172,  /* exclusive_or_expression  */
+  YYSYMBOL_and_expression = 173,           /* and_expression  */
+  YYSYMBOL_equality_expression = 174,      /* equality_expression  */
+  YYSYMBOL_relational_expression = 175,    /* relational_expression  */
+  YYSYMBOL_shift_expression = 176,         /* shift_expression  */
+  YYSYMBOL_additive_expression = 177,      /* additive_expression  */
+  YYSYMBOL_multiplicative_expression = 178, /* multiplicative_expression  */
+  YYSYMBOL_tilda_expression = 179,         /* tilda_expression  */
+  YYSYMBOL_cast_expression = 180,          /* cast_expression  */
+  YYSYMBOL_unary_expression = 181,         /* unary_expression  */
+  YYSYMBOL_unary_operator = 182,           /* unary_operator  */
+  YYSYMBOL_overloadable_operator = 183,    /* overloadable_operator  */
+  YYSYMBOL_dur_expression = 184,           /* dur_expression  */
+  YYSYMBOL_postfix_expression = 185,       /* postfix_expression  */
+  YYSYMBOL_primary_expression = 186        /* primary_expression  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
+/* Unqualified %code blocks.  */
+#line 105 "chuck.y"
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
+// the scanner (chuck.lex)
+int yylex( YYSTYPE * lval, YYLTYPE * lloc, void * scanner );
+// the parse state the scanner was made with
+a_Parse yyget_extra( void * scanner );
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 77 "chuck.y"
+void yyerror( YYLTYPE * loc, void * scanner, const char * s )
 {
-    int pos;
-    int ival;
-    double fval;
-    c_str sval;
-
-    a_Program program;
-    a_Section program_section;
-    a_Stmt_List stmt_list;
-    a_Class_Def class_def;
-    a_Class_Ext class_ext;
-    a_Class_Body class_body;
-    a_Stmt stmt;
-    a_Exp exp;
-    a_Func_Def func_def;
-    a_Var_Decl_List var_decl_list;
-    a_Var_Decl var_decl;
-    a_Type_Decl type_decl;
-    a_Arg_List arg_list;
-    a_Id_List id_list;
-    a_Array_Sub array_sub;
-    a_Complex complex_exp;
-    a_Polar polar_exp;
-    a_Vec vec_exp; // ge: added 1.3.5.3
-    a_Import import; // 1.5.4.0 (ge) added
-    a_Doc doc; // 1.5.4.4 (ge) added
+    EM_error( EM_tokPos, "%s", s );
 }
-/* Line 193 of yacc.c.  */
-#line 423 "chuck.tab.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-# define YYSTYPE_IS_TRIVIAL 1
-#endif
 
-#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE
-{
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-} YYLTYPE;
-# define yyltype YYLTYPE /* obsolescent; will be withdrawn */
-# define YYLTYPE_IS_DECLARED 1
-# define YYLTYPE_IS_TRIVIAL 1
-#endif
+#line 351 "chuck.tab.c"
 
+#ifdef short
+# undef short
+#endif
 
-/* Copy the second part of user declarations.  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-/* Line 216 of yacc.c.  */
-#line 448 "chuck.tab.c"
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-typedef signed char yytype_int8;
-#else
-typedef short int yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -482,55 +441,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -547,11 +557,11 @@ YYID (i)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -559,8 +569,8 @@ YYID (i)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -574,90 +584,92 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
-	     && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-    YYLTYPE yyls;
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  135
 /* YYLAST -- Last index in YYTABLE.  */
@@ -669,18 +681,23 @@ union yyalloc
 #define YYNNTS  65
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  274
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  463
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   376
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -723,195 +740,72 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     8,    10,    12,    14,    21,    29,
-      36,    44,    47,    52,    55,    60,    62,    63,    65,    68,
-      70,    72,    74,    77,    79,    83,    85,    89,    98,   106,
-     114,   121,   128,   134,   140,   147,   156,   164,   174,   184,
-     196,   208,   210,   212,   213,   215,   217,   219,   221,   223,
-     225,   226,   228,   231,   235,   240,   242,   244,   246,   249,
-     252,   257,   259,   262,   264,   266,   268,   270,   272,   274,
-     276,   279,   283,   286,   289,   295,   303,   309,   317,   324,
-     332,   340,   346,   354,   360,   363,   367,   370,   374,   378,
-     383,   388,   390,   394,   396,   399,   404,   409,   411,   415,
-     417,   419,   422,   424,   428,   430,   434,   436,   440,   444,
-     449,   454,   460,   463,   467,   469,   472,   476,   480,   484,
-     487,   491,   493,   497,   499,   502,   505,   509,   514,   519,
-     525,   529,   533,   537,   539,   541,   543,   545,   547,   549,
-     551,   553,   555,   557,   559,   561,   563,   565,   567,   569,
-     571,   573,   575,   577,   579,   581,   587,   589,   593,   595,
-     599,   601,   605,   607,   611,   613,   617,   619,   623,   627,
-     629,   633,   637,   641,   645,   647,   651,   655,   657,   661,
-     665,   667,   671,   675,   679,   681,   685,   687,   691,   693,
-     696,   699,   702,   705,   708,   711,   715,   720,   726,   732,
-     739,   741,   743,   745,   747,   749,   752,   754,   756,   758,
-     760,   762,   764,   766,   768,   770,   772,   774,   776,   778,
-     780,   782,   784,   786,   788,   790,   792,   794,   796,   798,
-     800,   802,   804,   806,   808,   810,   812,   814,   816,   818,
-     820,   822,   824,   826,   828,   830,   832,   834,   836,   838,
-     840,   842,   844,   846,   848,   850,   854,   856,   859,   863,
-     868,   872,   875,   878,   880,   882,   884,   886,   888,   890,
-     892,   894,   896,   900,   904
+       0,   228,   228,   229,   233,   234,   235,   239,   241,   243,
+     245,   250,   251,   252,   253,   257,   258,   262,   263,   268,
+     269,   270,   274,   278,   279,   283,   284,   288,   290,   292,
+     294,   296,   298,   300,   302,   304,   306,   308,   310,   312,
+     314,   319,   320,   321,   325,   326,   327,   328,   332,   333,
+     334,   338,   339,   343,   344,   353,   354,   359,   360,   364,
+     365,   369,   370,   374,   375,   376,   377,   379,   380,   381,
+     385,   386,   387,   388,   392,   394,   399,   401,   403,   405,
+     407,   409,   411,   413,   418,   419,   423,   424,   425,   426,
+     427,   431,   432,   436,   441,   442,   443,   447,   448,   452,
+     456,   457,   461,   462,   466,   467,   472,   473,   478,   479,
+     480,   482,   487,   488,   492,   493,   494,   495,   496,   497,
+     498,   502,   503,   507,   508,   509,   510,   511,   512,   513,
+     517,   522,   527,   532,   533,   534,   535,   536,   537,   538,
+     539,   540,   541,   542,   543,   544,   545,   546,   550,   551,
+     552,   553,   554,   555,   559,   560,   565,   566,   571,   572,
+     577,   578,   583,   584,   589,   590,   595,   596,   598,   603,
+     604,   606,   608,   610,   615,   616,   618,   623,   624,   626,
+     631,   632,   634,   636,   641,   642,   647,   648,   653,   654,
+     656,   658,   660,   662,   664,   666,   668,   670,   672,   674,
+     681,   682,   683,   684,   685,   686,   687,   693,   694,   695,
+     696,   697,   698,   699,   700,   701,   702,   703,   704,   705,
+     706,   707,   708,   709,   710,   711,   712,   713,   714,   715,
+     716,   717,   718,   719,   720,   721,   722,   723,   724,   725,
+     726,   727,   728,   729,   730,   731,   732,   733,   734,   735,
+     736,   737,   738,   739,   743,   744,   749,   750,   752,   754,
+     756,   758,   760,   766,   767,   768,   769,   770,   771,   772,
+     773,   774,   775,   776,   777
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     123,     0,    -1,   124,    -1,   123,   124,    -1,   142,    -1,
-     133,    -1,   125,    -1,   134,    98,   131,    16,   127,    17,
-      -1,   134,    98,   131,   126,    16,   127,    17,    -1,   134,
-      99,   131,    16,   127,    17,    -1,   134,    99,   131,   130,
-      16,   127,    17,    -1,   101,   131,    -1,   101,   131,   100,
-     132,    -1,   100,   132,    -1,   100,   132,   101,   131,    -1,
-     128,    -1,    -1,   129,    -1,   129,   128,    -1,   142,    -1,
-     133,    -1,   125,    -1,   100,   131,    -1,     3,    -1,     3,
-       9,   131,    -1,     3,    -1,     3,    18,   132,    -1,   135,
-     136,   140,     3,    12,   141,    13,   147,    -1,   135,   136,
-     140,     3,    12,    13,   147,    -1,   135,   136,     3,    12,
-     141,    13,   147,    -1,   135,   136,     3,    12,    13,   147,
-      -1,   135,   118,    12,   141,    13,   147,    -1,   135,   118,
-      12,    13,   147,    -1,   135,   119,    12,    13,   147,    -1,
-     135,   119,    12,   141,    13,   147,    -1,   135,   136,   140,
-       3,    12,   141,    13,    11,    -1,   135,   136,   140,     3,
-      12,    13,    11,    -1,   135,   136,   140,   117,   183,    12,
-     141,    13,   147,    -1,   135,   136,   140,   117,    12,   141,
-      13,   183,   147,    -1,   135,   136,   140,   117,    12,   183,
-      13,    12,   141,    13,   147,    -1,   135,   136,   140,   117,
-      12,   141,    13,    12,   183,    13,   147,    -1,   102,    -1,
-     104,    -1,    -1,    43,    -1,   102,    -1,   103,    -1,   104,
-      -1,   105,    -1,   106,    -1,    -1,     3,    -1,     3,    71,
-      -1,    26,   132,    28,    -1,    26,   132,    28,    71,    -1,
-     137,    -1,   138,    -1,   139,    -1,   139,   159,    -1,   139,
-     162,    -1,   139,   162,     9,   141,    -1,   143,    -1,   142,
-     143,    -1,   154,    -1,   146,    -1,   145,    -1,   144,    -1,
-     147,    -1,   148,    -1,   151,    -1,    44,    11,    -1,    44,
-     155,    11,    -1,    40,    11,    -1,    41,    11,    -1,    33,
-      12,   155,    13,   143,    -1,    33,    12,   155,    13,   143,
-      35,   143,    -1,    36,    12,   155,    13,   143,    -1,    38,
-     143,    36,    12,   155,    13,    11,    -1,    37,    12,   154,
-     154,    13,   143,    -1,    37,    12,   154,   154,   155,    13,
-     143,    -1,    37,    12,   155,    10,   155,    13,   143,    -1,
-      64,    12,   155,    13,   143,    -1,    38,   143,    64,    12,
-     155,    13,    11,    -1,    39,    12,   155,    13,   143,    -1,
-      16,    17,    -1,    16,   142,    17,    -1,   120,   150,    -1,
-     120,    14,    15,    -1,   120,    16,    17,    -1,   120,    14,
-     149,    14,    -1,   120,    16,   149,    17,    -1,   150,    -1,
-     150,     9,   149,    -1,     4,    -1,   121,   153,    -1,   121,
-      14,   152,    15,    -1,   121,    16,   152,    17,    -1,   153,
-      -1,   153,     9,   152,    -1,     4,    -1,    11,    -1,   155,
-      11,    -1,   156,    -1,   155,     9,   156,    -1,   157,    -1,
-     156,   166,   157,    -1,   160,    -1,   157,   167,   160,    -1,
-      14,   155,    15,    -1,    14,   155,     9,    15,    -1,    14,
-     155,    15,   158,    -1,    14,   155,     9,    15,   158,    -1,
-      14,    15,    -1,   159,    14,    15,    -1,   168,    -1,   139,
-     161,    -1,    65,   139,   161,    -1,    66,   139,   161,    -1,
-     105,   139,   161,    -1,    76,   161,    -1,   105,    76,   161,
-      -1,   162,    -1,   162,     9,   161,    -1,     3,    -1,     3,
-     158,    -1,     3,   159,    -1,     3,    12,    13,    -1,     3,
-      12,   155,    13,    -1,     3,    12,    13,   158,    -1,     3,
-      12,   155,    13,   158,    -1,    53,   155,    13,    -1,    54,
-     155,    13,    -1,    55,   155,    13,    -1,    90,    -1,    93,
-      -1,    77,    -1,    78,    -1,    79,    -1,    80,    -1,    84,
-      -1,    85,    -1,    86,    -1,    95,    -1,    96,    -1,    97,
-      -1,    81,    -1,    82,    -1,    83,    -1,   110,    -1,   109,
-      -1,   114,    -1,   113,    -1,   116,    -1,   115,    -1,   169,
-      -1,   169,    45,   155,    10,   168,    -1,   170,    -1,   169,
-      31,   170,    -1,   171,    -1,   170,    30,   171,    -1,   172,
-      -1,   171,    47,   172,    -1,   173,    -1,   172,    49,   173,
-      -1,   174,    -1,   173,    48,   174,    -1,   175,    -1,   174,
-      24,   175,    -1,   174,    25,   175,    -1,   176,    -1,   175,
-      26,   176,    -1,   175,    28,   176,    -1,   175,    27,   176,
-      -1,   175,    29,   176,    -1,   177,    -1,   176,    88,   177,
-      -1,   176,    87,   177,    -1,   178,    -1,   177,    19,   178,
-      -1,   177,    20,   178,    -1,   179,    -1,   178,    21,   179,
-      -1,   178,    22,   179,    -1,   178,    23,   179,    -1,   180,
-      -1,   179,    89,   180,    -1,   181,    -1,   180,    52,   139,
-      -1,   184,    -1,    50,   181,    -1,    51,   181,    -1,   182,
-     181,    -1,    75,   181,    -1,    74,   181,    -1,    73,   139,
-      -1,    73,   139,   158,    -1,    73,   139,    12,    13,    -1,
-      73,   139,    12,   155,    13,    -1,    73,   139,    12,    13,
-     158,    -1,    73,   139,    12,   155,    13,   158,    -1,    19,
-      -1,    20,    -1,    89,    -1,    46,    -1,    21,    -1,   108,
-      89,    -1,    97,    -1,    90,    -1,    19,    -1,    20,    -1,
-      21,    -1,    22,    -1,    23,    -1,    24,    -1,    25,    -1,
-      26,    -1,    27,    -1,    28,    -1,    29,    -1,    30,    -1,
-      31,    -1,    32,    -1,    46,    -1,    47,    -1,    48,    -1,
-      49,    -1,    50,    -1,    51,    -1,    52,    -1,    72,    -1,
-      77,    -1,    78,    -1,    79,    -1,    80,    -1,    81,    -1,
-      82,    -1,    83,    -1,    84,    -1,    85,    -1,    86,    -1,
-      87,    -1,    88,    -1,    89,    -1,    91,    -1,    93,    -1,
-      95,    -1,    96,    -1,    97,    -1,   109,    -1,   110,    -1,
-     113,    -1,   114,    -1,   115,    -1,   116,    -1,   185,    -1,
-     184,    91,   185,    -1,   186,    -1,   185,   158,    -1,   185,
-      12,    13,    -1,   185,    12,   155,    13,    -1,   185,    18,
-       3,    -1,   185,    50,    -1,   185,    51,    -1,     3,    -1,
-       6,    -1,     7,    -1,     4,    -1,     5,    -1,   158,    -1,
-     163,    -1,   164,    -1,   165,    -1,   111,   155,   112,    -1,
-      12,   155,    13,    -1,    12,    13,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   216,   216,   217,   221,   222,   223,   227,   229,   231,
-     233,   238,   239,   240,   241,   245,   246,   250,   251,   256,
-     257,   258,   262,   266,   267,   271,   272,   276,   278,   280,
-     282,   284,   286,   288,   290,   292,   294,   296,   298,   300,
-     302,   307,   308,   309,   313,   314,   315,   316,   320,   321,
-     322,   326,   327,   331,   332,   341,   342,   347,   348,   352,
-     353,   357,   358,   362,   363,   364,   365,   367,   368,   369,
-     373,   374,   375,   376,   380,   382,   387,   389,   391,   393,
-     395,   397,   399,   401,   406,   407,   411,   412,   413,   414,
-     415,   419,   420,   424,   429,   430,   431,   435,   436,   440,
-     444,   445,   449,   450,   454,   455,   460,   461,   466,   467,
-     468,   470,   475,   476,   480,   481,   482,   483,   484,   485,
-     486,   490,   491,   495,   496,   497,   498,   499,   500,   501,
-     505,   510,   515,   520,   521,   522,   523,   524,   525,   526,
-     527,   528,   529,   530,   531,   532,   533,   534,   538,   539,
-     540,   541,   542,   543,   547,   548,   553,   554,   559,   560,
-     565,   566,   571,   572,   577,   578,   583,   584,   586,   591,
-     592,   594,   596,   598,   603,   604,   606,   611,   612,   614,
-     619,   620,   622,   624,   629,   630,   635,   636,   641,   642,
-     644,   646,   648,   650,   652,   654,   656,   658,   660,   662,
-     669,   670,   671,   672,   673,   674,   675,   681,   682,   683,
-     684,   685,   686,   687,   688,   689,   690,   691,   692,   693,
-     694,   695,   696,   697,   698,   699,   700,   701,   702,   703,
-     704,   705,   706,   707,   708,   709,   710,   711,   712,   713,
-     714,   715,   716,   717,   718,   719,   720,   721,   722,   723,
-     724,   725,   726,   727,   731,   732,   737,   738,   740,   742,
-     744,   746,   748,   754,   755,   756,   757,   758,   759,   760,
-     761,   762,   763,   764,   765
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "ID", "STRING_LIT", "CHAR_LIT",
-  "INT_VAL", "FLOAT_VAL", "POUND", "COMMA", "COLON", "SEMICOLON", "LPAREN",
-  "RPAREN", "LBRACK", "RBRACK", "LBRACE", "RBRACE", "DOT", "PLUS", "MINUS",
-  "TIMES", "DIVIDE", "PERCENT", "EQ", "NEQ", "LT", "LE", "GT", "GE", "AND",
-  "OR", "ASSIGN", "IF", "THEN", "ELSE", "WHILE", "FOR", "DO", "LOOP",
-  "BREAK", "CONTINUE", "NULL_TOK", "FUNCTION", "RETURN", "QUESTION",
-  "EXCLAMATION", "S_OR", "S_AND", "S_XOR", "PLUSPLUS", "MINUSMINUS",
-  "DOLLAR", "POUNDPAREN", "PERCENTPAREN", "ATPAREN", "SIMULT", "PATTERN",
-  "CODE", "TRANSPORT", "HOST", "TIME", "WHENEVER", "NEXT", "UNTIL",
-  "EXTERNAL", "GLOBAL", "EVERY", "BEFORE", "AFTER", "AT", "AT_SYM",
-  "ATAT_SYM", "NEW", "SIZEOF", "TYPEOF", "SAME", "PLUS_CHUCK",
-  "MINUS_CHUCK", "TIMES_CHUCK", "DIVIDE_CHUCK", "S_AND_CHUCK",
-  "S_OR_CHUCK", "S_XOR_CHUCK", "SHIFT_RIGHT_CHUCK", "SHIFT_LEFT_CHUCK",
-  "PERCENT_CHUCK", "SHIFT_RIGHT", "SHIFT_LEFT", "TILDA", "CHUCK",
-  "COLONCOLON", "S_CHUCK", "AT_CHUCK", "LEFT_S_CHUCK", "UNCHUCK",
-  "UPCHUCK", "DOWNCHUCK", "CLASS", "INTERFACE", "EXTENDS", "IMPLEMENTS",
-  "PUBLIC", "PROTECTED", "PRIVATE", "STATIC", "ABSTRACT", "CONST", "SPORK",
-  "ARROW_RIGHT", "ARROW_LEFT", "L_HACK", "R_HACK", "GRUCK_RIGHT",
-  "GRUCK_LEFT", "UNGRUCK_RIGHT", "UNGRUCK_LEFT", "AT_OP", "AT_CTOR",
-  "AT_DTOR", "AT_IMPORT", "AT_DOC", "$accept", "program",
+  "\"end of file\"", "error", "\"invalid token\"", "ID", "STRING_LIT",
+  "CHAR_LIT", "INT_VAL", "FLOAT_VAL", "POUND", "COMMA", "COLON",
+  "SEMICOLON", "LPAREN", "RPAREN", "LBRACK", "RBRACK", "LBRACE", "RBRACE",
+  "DOT", "PLUS", "MINUS", "TIMES", "DIVIDE", "PERCENT", "EQ", "NEQ", "LT",
+  "LE", "GT", "GE", "AND", "OR", "ASSIGN", "IF", "THEN", "ELSE", "WHILE",
+  "FOR", "DO", "LOOP", "BREAK", "CONTINUE", "NULL_TOK", "FUNCTION",
+  "RETURN", "QUESTION", "EXCLAMATION", "S_OR", "S_AND", "S_XOR",
+  "PLUSPLUS", "MINUSMINUS", "DOLLAR", "POUNDPAREN", "PERCENTPAREN",
+  "ATPAREN", "SIMULT", "PATTERN", "CODE", "TRANSPORT", "HOST", "TIME",
+  "WHENEVER", "NEXT", "UNTIL", "EXTERNAL", "GLOBAL", "EVERY", "BEFORE",
+  "AFTER", "AT", "AT_SYM", "ATAT_SYM", "NEW", "SIZEOF", "TYPEOF", "SAME",
+  "PLUS_CHUCK", "MINUS_CHUCK", "TIMES_CHUCK", "DIVIDE_CHUCK",
+  "S_AND_CHUCK", "S_OR_CHUCK", "S_XOR_CHUCK", "SHIFT_RIGHT_CHUCK",
+  "SHIFT_LEFT_CHUCK", "PERCENT_CHUCK", "SHIFT_RIGHT", "SHIFT_LEFT",
+  "TILDA", "CHUCK", "COLONCOLON", "S_CHUCK", "AT_CHUCK", "LEFT_S_CHUCK",
+  "UNCHUCK", "UPCHUCK", "DOWNCHUCK", "CLASS", "INTERFACE", "EXTENDS",
+  "IMPLEMENTS", "PUBLIC", "PROTECTED", "PRIVATE", "STATIC", "ABSTRACT",
+  "CONST", "SPORK", "ARROW_RIGHT", "ARROW_LEFT", "L_HACK", "R_HACK",
+  "GRUCK_RIGHT", "GRUCK_LEFT", "UNGRUCK_RIGHT", "UNGRUCK_LEFT", "AT_OP",
+  "AT_CTOR", "AT_DTOR", "AT_IMPORT", "AT_DOC", "$accept", "program",
   "program_section", "class_definition", "class_ext", "class_body",
   "class_body2", "class_section", "iface_ext", "id_list", "id_dot",
   "function_definition", "class_decl", "function_decl", "static_decl",
@@ -929,166 +823,28 @@ static const char *const yytname[] =
   "additive_expression", "multiplicative_expression", "tilda_expression",
   "cast_expression", "unary_expression", "unary_operator",
   "overloadable_operator", "dur_expression", "postfix_expression",
-  "primary_expression", 0
+  "primary_expression", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,   122,   123,   123,   124,   124,   124,   125,   125,   125,
-     125,   126,   126,   126,   126,   127,   127,   128,   128,   129,
-     129,   129,   130,   131,   131,   132,   132,   133,   133,   133,
-     133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
-     133,   134,   134,   134,   135,   135,   135,   135,   136,   136,
-     136,   137,   137,   138,   138,   139,   139,   140,   140,   141,
-     141,   142,   142,   143,   143,   143,   143,   143,   143,   143,
-     144,   144,   144,   144,   145,   145,   146,   146,   146,   146,
-     146,   146,   146,   146,   147,   147,   148,   148,   148,   148,
-     148,   149,   149,   150,   151,   151,   151,   152,   152,   153,
-     154,   154,   155,   155,   156,   156,   157,   157,   158,   158,
-     158,   158,   159,   159,   160,   160,   160,   160,   160,   160,
-     160,   161,   161,   162,   162,   162,   162,   162,   162,   162,
-     163,   164,   165,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   167,   167,
-     167,   167,   167,   167,   168,   168,   169,   169,   170,   170,
-     171,   171,   172,   172,   173,   173,   174,   174,   174,   175,
-     175,   175,   175,   175,   176,   176,   176,   177,   177,   177,
-     178,   178,   178,   178,   179,   179,   180,   180,   181,   181,
-     181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
-     182,   182,   182,   182,   182,   182,   182,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
-     183,   183,   183,   183,   184,   184,   185,   185,   185,   185,
-     185,   185,   185,   186,   186,   186,   186,   186,   186,   186,
-     186,   186,   186,   186,   186
-};
+#define YYPACT_NINF (-338)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     1,     2,     1,     1,     1,     6,     7,     6,
-       7,     2,     4,     2,     4,     1,     0,     1,     2,     1,
-       1,     1,     2,     1,     3,     1,     3,     8,     7,     7,
-       6,     6,     5,     5,     6,     8,     7,     9,     9,    11,
-      11,     1,     1,     0,     1,     1,     1,     1,     1,     1,
-       0,     1,     2,     3,     4,     1,     1,     1,     2,     2,
-       4,     1,     2,     1,     1,     1,     1,     1,     1,     1,
-       2,     3,     2,     2,     5,     7,     5,     7,     6,     7,
-       7,     5,     7,     5,     2,     3,     2,     3,     3,     4,
-       4,     1,     3,     1,     2,     4,     4,     1,     3,     1,
-       1,     2,     1,     3,     1,     3,     1,     3,     3,     4,
-       4,     5,     2,     3,     1,     2,     3,     3,     3,     2,
-       3,     1,     3,     1,     2,     2,     3,     4,     4,     5,
-       3,     3,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     5,     1,     3,     1,     3,
-       1,     3,     1,     3,     1,     3,     1,     3,     3,     1,
-       3,     3,     3,     3,     1,     3,     3,     1,     3,     3,
-       1,     3,     3,     3,     1,     3,     1,     3,     1,     2,
-       2,     2,     2,     2,     2,     3,     4,     5,     5,     6,
-       1,     1,     1,     1,     1,     2,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     3,     1,     2,     3,     4,
-       3,     2,     2,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     2
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint16 yydefact[] =
-{
-      43,   263,   266,   267,   264,   265,   100,     0,     0,     0,
-     200,   201,   204,     0,     0,     0,     0,     0,     0,     0,
-       0,    44,     0,   203,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   202,   206,    45,    46,
-      47,     0,     0,     0,     0,     0,    43,     2,     6,     5,
-       0,    50,    55,    56,     0,     4,    61,    66,    65,    64,
-      67,    68,    69,    63,     0,   102,   104,   268,   106,   269,
-     270,   271,   114,   154,   156,   158,   160,   162,   164,   166,
-     169,   174,   177,   180,   184,   186,     0,   188,   254,   256,
-      52,   274,     0,     0,    84,     0,    25,     0,     0,     0,
-       0,     0,     0,    72,    73,    70,     0,   263,   189,   190,
-       0,     0,     0,     0,    51,     0,     0,   194,   193,   192,
-     123,   119,   121,     0,     0,   205,     0,    93,     0,     0,
-      86,    99,     0,     0,    94,     1,     3,     0,     0,    48,
-      49,     0,     0,     0,   115,    62,     0,   101,   135,   136,
-     137,   138,   145,   146,   147,   139,   140,   141,   133,   134,
-     142,   143,   144,     0,   149,   148,   151,   150,   153,   152,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   191,     0,     0,     0,   261,   262,   257,   273,
-       0,   108,    85,     0,    53,     0,     0,     0,     0,     0,
-       0,     0,    71,   130,   131,   132,     0,   116,   117,     0,
-     195,     0,     0,   124,   125,     0,   120,   118,   272,    87,
-       0,    91,    88,     0,     0,    97,     0,    23,     0,     0,
-       0,     0,    51,    57,     0,   103,   105,   107,   157,     0,
-     159,   161,   163,   165,   167,   168,   170,   172,   171,   173,
-     176,   175,   178,   179,   181,   182,   183,   185,   187,   255,
-     258,     0,   260,   109,   110,    26,    54,     0,     0,     0,
-       0,     0,     0,     0,     0,   196,     0,   126,     0,   112,
-       0,   122,    89,     0,    90,    95,     0,    96,     0,    43,
-       0,     0,     0,    43,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    58,     0,     0,     0,   259,   111,    74,
-      76,     0,     0,     0,     0,     0,    83,    81,   198,   197,
-     128,   127,   113,    92,    98,    24,    21,     0,    15,    43,
-      20,    19,    13,    11,    43,     0,    22,    43,    32,    59,
-       0,    33,     0,     0,     0,     0,     0,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
-     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   207,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,     0,   155,     0,    78,     0,     0,
-       0,     0,   199,   129,     7,    18,     0,     0,     0,     9,
-       0,     0,    31,    34,    30,     0,     0,     0,   215,     0,
-       0,     0,    75,    79,    80,    77,    82,    14,    12,     8,
-      10,    60,    29,    36,    28,     0,     0,     0,     0,    35,
-      27,     0,     0,     0,     0,     0,    38,     0,    37,     0,
-       0,    40,    39
-};
+#define YYTABLE_NINF (-52)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,    46,    47,   336,   302,   337,   338,   339,   305,   238,
-      97,   340,    50,    51,   143,    52,    53,    54,   244,   308,
-     341,    56,    57,    58,    59,    60,    61,   230,   231,    62,
-     234,   235,    63,    64,    65,    66,    67,   224,    68,   121,
-     122,    69,    70,    71,   163,   170,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,   404,    87,    88,    89
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -338
 static const yytype_int16 yypact[] =
 {
      665,    15,  -338,  -338,  -338,  -338,  -338,  1215,  1893,   776,
@@ -1140,6 +896,60 @@ static const yytype_int16 yypact[] =
      305,  -338,  -338
 };
 
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+      43,   263,   266,   267,   264,   265,   100,     0,     0,     0,
+     200,   201,   204,     0,     0,     0,     0,     0,     0,     0,
+       0,    44,     0,   203,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   202,   206,    45,    46,
+      47,     0,     0,     0,     0,     0,    43,     2,     6,     5,
+       0,    50,    55,    56,     0,     4,    61,    66,    65,    64,
+      67,    68,    69,    63,     0,   102,   104,   268,   106,   269,
+     270,   271,   114,   154,   156,   158,   160,   162,   164,   166,
+     169,   174,   177,   180,   184,   186,     0,   188,   254,   256,
+      52,   274,     0,     0,    84,     0,    25,     0,     0,     0,
+       0,     0,     0,    72,    73,    70,     0,   263,   189,   190,
+       0,     0,     0,     0,    51,     0,     0,   194,   193,   192,
+     123,   119,   121,     0,     0,   205,     0,    93,     0,     0,
+      86,    99,     0,     0,    94,     1,     3,     0,     0,    48,
+      49,     0,     0,     0,   115,    62,     0,   101,   135,   136,
+     137,   138,   145,   146,   147,   139,   140,   141,   133,   134,
+     142,   143,   144,     0,   149,   148,   151,   150,   153,   152,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   191,     0,     0,     0,   261,   262,   257,   273,
+       0,   108,    85,     0,    53,     0,     0,     0,     0,     0,
+       0,     0,    71,   130,   131,   132,     0,   116,   117,     0,
+     195,     0,     0,   124,   125,     0,   120,   118,   272,    87,
+       0,    91,    88,     0,     0,    97,     0,    23,     0,     0,
+       0,     0,    51,    57,     0,   103,   105,   107,   157,     0,
+     159,   161,   163,   165,   167,   168,   170,   172,   171,   173,
+     176,   175,   178,   179,   181,   182,   183,   185,   187,   255,
+     258,     0,   260,   109,   110,    26,    54,     0,     0,     0,
+       0,     0,     0,     0,     0,   196,     0,   126,     0,   112,
+       0,   122,    89,     0,    90,    95,     0,    96,     0,    43,
+       0,     0,     0,    43,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    58,     0,     0,     0,   259,   111,    74,
+      76,     0,     0,     0,     0,     0,    83,    81,   198,   197,
+     128,   127,   113,    92,    98,    24,    21,     0,    15,    43,
+      20,    19,    13,    11,    43,     0,    22,    43,    32,    59,
+       0,    33,     0,     0,     0,     0,     0,   208,   209,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   207,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,     0,   155,     0,    78,     0,     0,
+       0,     0,   199,   129,     7,    18,     0,     0,     0,     9,
+       0,     0,    31,    34,    30,     0,     0,     0,   215,     0,
+       0,     0,    75,    79,    80,    77,    82,    14,    12,     8,
+      10,    60,    29,    36,    28,     0,     0,     0,     0,    35,
+      27,     0,     0,     0,     0,     0,    38,     0,    37,     0,
+       0,    40,    39
+};
+
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
@@ -1152,11 +962,21 @@ static const yytype_int16 yypgoto[] =
     -338,  -337,  -338,   188,  -338
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -52
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    46,    47,   336,   302,   337,   338,   339,   305,   238,
+      97,   340,    50,    51,   143,    52,    53,    54,   244,   308,
+     341,    56,    57,    58,    59,    60,    61,   230,   231,    62,
+     234,   235,    63,    64,    65,    66,    67,   224,    68,   121,
+     122,    69,    70,    71,   163,   170,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,   404,    87,    88,    89
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
      115,   116,   117,   101,   239,   275,   198,   144,   310,   233,
@@ -1641,8 +1461,8 @@ static const yytype_int16 yycheck[] =
      113,   114,   115,   116
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
        0,     3,     4,     5,     6,     7,    11,    12,    14,    16,
@@ -1694,95 +1514,133 @@ static const yytype_uint8 yystos[] =
       13,   147,   147
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   122,   123,   123,   124,   124,   124,   125,   125,   125,
+     125,   126,   126,   126,   126,   127,   127,   128,   128,   129,
+     129,   129,   130,   131,   131,   132,   132,   133,   133,   133,
+     133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
+     133,   134,   134,   134,   135,   135,   135,   135,   136,   136,
+     136,   137,   137,   138,   138,   139,   139,   140,   140,   141,
+     141,   142,   142,   143,   143,   143,   143,   143,   143,   143,
+     144,   144,   144,   144,   145,   145,   146,   146,   146,   146,
+     146,   146,   146,   146,   147,   147,   148,   148,   148,   148,
+     148,   149,   149,   150,   151,   151,   151,   152,   152,   153,
+     154,   154,   155,   155,   156,   156,   157,   157,   158,   158,
+     158,   158,   159,   159,   160,   160,   160,   160,   160,   160,
+     160,   161,   161,   162,   162,   162,   162,   162,   162,   162,
+     163,   164,   165,   166,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   166,   166,   166,   166,   166,   167,   167,
+     167,   167,   167,   167,   168,   168,   169,   169,   170,   170,
+     171,   171,   172,   172,   173,   173,   174,   174,   174,   175,
+     175,   175,   175,   175,   176,   176,   176,   177,   177,   177,
+     178,   178,   178,   178,   179,   179,   180,   180,   181,   181,
+     181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
+     182,   182,   182,   182,   182,   182,   182,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   184,   184,   185,   185,   185,   185,
+     185,   185,   185,   186,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   186,   186
+};
 
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     1,     1,     6,     7,     6,
+       7,     2,     4,     2,     4,     1,     0,     1,     2,     1,
+       1,     1,     2,     1,     3,     1,     3,     8,     7,     7,
+       6,     6,     5,     5,     6,     8,     7,     9,     9,    11,
+      11,     1,     1,     0,     1,     1,     1,     1,     1,     1,
+       0,     1,     2,     3,     4,     1,     1,     1,     2,     2,
+       4,     1,     2,     1,     1,     1,     1,     1,     1,     1,
+       2,     3,     2,     2,     5,     7,     5,     7,     6,     7,
+       7,     5,     7,     5,     2,     3,     2,     3,     3,     4,
+       4,     1,     3,     1,     2,     4,     4,     1,     3,     1,
+       1,     2,     1,     3,     1,     3,     1,     3,     3,     4,
+       4,     5,     2,     3,     1,     2,     3,     3,     3,     2,
+       3,     1,     3,     1,     2,     2,     3,     4,     4,     5,
+       3,     3,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     5,     1,     3,     1,     3,
+       1,     3,     1,     3,     1,     3,     1,     3,     3,     1,
+       3,     3,     3,     3,     1,     3,     3,     1,     3,     3,
+       1,     3,     3,     3,     1,     3,     1,     3,     1,     2,
+       2,     2,     2,     2,     2,     3,     4,     5,     5,     6,
+       1,     1,     1,     1,     1,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     1,     2,     3,     4,
+       3,     2,     2,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     3,     2
+};
 
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
 
-#define YYFAIL		goto yyerrlab
+enum { YYENOMEM = -2 };
 
-#define YYRECOVERING()  (!!yyerrstatus)
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
-#define YYTERROR	1
-#define YYERRCODE	256
+#define YYRECOVERING()  (!!yyerrstatus)
 
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, scanner, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
    the previous symbol: RHS[0] (always defined).  */
 
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
 #ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
-
-
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
-
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
 #endif
 
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
-
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -1792,85 +1650,119 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, Location); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
-#else
-static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    YYLTYPE const * const yylocationp;
-#endif
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
 {
-  if (!yyvaluep)
-    return;
-  YYUSE (yylocationp);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
     {
-      default:
-	break;
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
     }
+  return res;
 }
 
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, scanner); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
-#else
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, void * scanner)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, yylocationp)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    YYLTYPE const * const yylocationp;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, void * scanner)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyoutput, *yylocationp);
-  YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp);
-  YYFPRINTF (yyoutput, ")");
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, scanner);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1878,81 +1770,69 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, yylocationp)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
 static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yylsp, yyrule)
-    YYSTYPE *yyvsp;
-    YYLTYPE *yylsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, void * scanner)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       , &(yylsp[(yyi + 1) - (yynrhs)])		       );
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), scanner);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, yylsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, scanner); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1967,281 +1847,33 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
-
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
 
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
 
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep, yylocationp)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    YYLTYPE *yylocationp;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, void * scanner)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
-
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-  switch (yytype)
-    {
-
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
-
-/* Prevent warnings from -Wmissing-prototypes.  */
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
-
-
-/* The look-ahead symbol.  */
-int yychar;
 
-/* The semantic value of the look-ahead symbol.  */
-YYSTYPE yylval;
 
-/* Number of syntax errors so far.  */
-int yynerrs;
-/* Location data for the look-ahead symbol.  */
-YYLTYPE yylloc;
 
 
 
@@ -2249,211 +1881,224 @@ YYLTYPE yylloc;
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
+yyparse (void * scanner)
 {
-  
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
 
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
 
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-  /* The location stack.  */
-  YYLTYPE yylsa[YYINITDEPTH];
-  YYLTYPE *yyls = yylsa;
-  YYLTYPE *yylsp;
-  /* The locations where the error started and ended.  */
-  YYLTYPE yyerror_range[2];
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-  YYSIZE_T yystacksize = YYINITDEPTH;
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-
-  yyssp = yyss;
-  yyvsp = yyvs;
-  yylsp = yyls;
-#if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
-  /* Initialize the default location before parsing starts.  */
-  yylloc.first_line   = yylloc.last_line   = 1;
-  yylloc.first_column = yylloc.last_column = 0;
-#endif
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+
+/* User initialization code.  */
+#line 66 "chuck.y"
+{ yylloc.first_column = yylloc.last_column = 0; }
 
+#line 1964 "chuck.tab.c"
+
+  yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-	YYLTYPE *yyls1 = yyls;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yyls1, yysize * sizeof (*yylsp),
-		    &yystacksize);
-	yyls = yyls1;
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-	YYSTACK_RELOCATE (yyls);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, scanner);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2468,30 +2113,27 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2506,14 +2148,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -2522,1467 +2164,1717 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-  /* Default location.  */
+  /* Default location. */
   YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
-  YY_REDUCE_PRINT (yyn);
-  switch (yyn)
-    {
-        case 2:
-#line 216 "chuck.y"
-    { (yyval.program) = g_program = new_program( (yyvsp[(1) - (1)].program_section), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
-    break;
-
-  case 3:
-#line 217 "chuck.y"
-    { (yyval.program) = g_program = append_program( (yyvsp[(1) - (2)].program), (yyvsp[(2) - (2)].program_section), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
-    break;
-
-  case 4:
-#line 221 "chuck.y"
-    { (yyval.program_section) = new_section_stmt( (yyvsp[(1) - (1)].stmt_list), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
-    break;
-
-  case 5:
-#line 222 "chuck.y"
-    { (yyval.program_section) = new_section_func_def( (yyvsp[(1) - (1)].func_def), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
-    break;
-
-  case 6:
-#line 223 "chuck.y"
-    { (yyval.program_section) = new_section_class_def( (yyvsp[(1) - (1)].class_def), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
-    break;
-
-  case 7:
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: program_section  */
 #line 228 "chuck.y"
-    { (yyval.class_def) = new_class_def( (yyvsp[(1) - (6)].ival), (yyvsp[(3) - (6)].id_list), NULL, (yyvsp[(5) - (6)].class_body), (yylsp[(1) - (6)]).first_line, (yylsp[(1) - (6)]).first_column ); ;}
+                                            { (yyval.program) = yyget_extra( scanner )->program = new_program( (yyvsp[0].program_section), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2177 "chuck.tab.c"
     break;
 
-  case 8:
-#line 230 "chuck.y"
-    { (yyval.class_def) = new_class_def( (yyvsp[(1) - (7)].ival), (yyvsp[(3) - (7)].id_list), (yyvsp[(4) - (7)].class_ext), (yyvsp[(6) - (7)].class_body), (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+  case 3: /* program: program program_section  */
+#line 229 "chuck.y"
+                                            { (yyval.program) = yyget_extra( scanner )->program = append_program( (yyvsp[-1].program), (yyvsp[0].program_section), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2183 "chuck.tab.c"
     break;
 
-  case 9:
-#line 232 "chuck.y"
-    { (yyval.class_def) = new_iface_def( (yyvsp[(1) - (6)].ival), (yyvsp[(3) - (6)].id_list), NULL, (yyvsp[(5) - (6)].class_body), (yylsp[(1) - (6)]).first_line, (yylsp[(1) - (6)]).first_column ); ;}
+  case 4: /* program_section: statement_list  */
+#line 233 "chuck.y"
+                                            { (yyval.program_section) = new_section_stmt( (yyvsp[0].stmt_list), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2189 "chuck.tab.c"
     break;
 
-  case 10:
+  case 5: /* program_section: function_definition  */
 #line 234 "chuck.y"
-    { (yyval.class_def) = new_iface_def( (yyvsp[(1) - (7)].ival), (yyvsp[(3) - (7)].id_list), (yyvsp[(4) - (7)].class_ext), (yyvsp[(6) - (7)].class_body), (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
-    break;
-
-  case 11:
-#line 238 "chuck.y"
-    { (yyval.class_ext) = new_class_ext( NULL, (yyvsp[(2) - (2)].id_list), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.program_section) = new_section_func_def( (yyvsp[0].func_def), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2195 "chuck.tab.c"
     break;
 
-  case 12:
-#line 239 "chuck.y"
-    { (yyval.class_ext) = new_class_ext( (yyvsp[(4) - (4)].id_list), (yyvsp[(2) - (4)].id_list), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+  case 6: /* program_section: class_definition  */
+#line 235 "chuck.y"
+                                            { (yyval.program_section) = new_section_class_def( (yyvsp[0].class_def), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2201 "chuck.tab.c"
     break;
 
-  case 13:
+  case 7: /* class_definition: class_decl CLASS id_list LBRACE class_body RBRACE  */
 #line 240 "chuck.y"
-    { (yyval.class_ext) = new_class_ext( (yyvsp[(2) - (2)].id_list), NULL, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+            { (yyval.class_def) = new_class_def( (yyvsp[-5].ival), (yyvsp[-3].id_list), NULL, (yyvsp[-1].class_body), (yylsp[-5]).first_line, (yylsp[-5]).first_column ); }
+#line 2207 "chuck.tab.c"
     break;
 
-  case 14:
-#line 241 "chuck.y"
-    { (yyval.class_ext) = new_class_ext( (yyvsp[(2) - (4)].id_list), (yyvsp[(4) - (4)].id_list), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+  case 8: /* class_definition: class_decl CLASS id_list class_ext LBRACE class_body RBRACE  */
+#line 242 "chuck.y"
+            { (yyval.class_def) = new_class_def( (yyvsp[-6].ival), (yyvsp[-4].id_list), (yyvsp[-3].class_ext), (yyvsp[-1].class_body), (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2213 "chuck.tab.c"
     break;
 
-  case 15:
-#line 245 "chuck.y"
-    { (yyval.class_body) = (yyvsp[(1) - (1)].class_body); ;}
+  case 9: /* class_definition: class_decl INTERFACE id_list LBRACE class_body RBRACE  */
+#line 244 "chuck.y"
+            { (yyval.class_def) = new_iface_def( (yyvsp[-5].ival), (yyvsp[-3].id_list), NULL, (yyvsp[-1].class_body), (yylsp[-5]).first_line, (yylsp[-5]).first_column ); }
+#line 2219 "chuck.tab.c"
     break;
 
-  case 16:
+  case 10: /* class_definition: class_decl INTERFACE id_list iface_ext LBRACE class_body RBRACE  */
 #line 246 "chuck.y"
-    { (yyval.class_body) = NULL; ;}
+            { (yyval.class_def) = new_iface_def( (yyvsp[-6].ival), (yyvsp[-4].id_list), (yyvsp[-3].class_ext), (yyvsp[-1].class_body), (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2225 "chuck.tab.c"
     break;
 
-  case 17:
+  case 11: /* class_ext: IMPLEMENTS id_list  */
 #line 250 "chuck.y"
-    { (yyval.class_body) = new_class_body( (yyvsp[(1) - (1)].program_section), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+                                            { (yyval.class_ext) = new_class_ext( NULL, (yyvsp[0].id_list), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2231 "chuck.tab.c"
     break;
 
-  case 18:
+  case 12: /* class_ext: IMPLEMENTS id_list EXTENDS id_dot  */
 #line 251 "chuck.y"
-    { (yyval.class_body) = prepend_class_body( (yyvsp[(1) - (2)].program_section), (yyvsp[(2) - (2)].class_body), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.class_ext) = new_class_ext( (yyvsp[0].id_list), (yyvsp[-2].id_list), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2237 "chuck.tab.c"
+    break;
+
+  case 13: /* class_ext: EXTENDS id_dot  */
+#line 252 "chuck.y"
+                                            { (yyval.class_ext) = new_class_ext( (yyvsp[0].id_list), NULL, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2243 "chuck.tab.c"
     break;
 
-  case 19:
-#line 256 "chuck.y"
-    { (yyval.program_section) = new_section_stmt( (yyvsp[(1) - (1)].stmt_list), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 14: /* class_ext: EXTENDS id_dot IMPLEMENTS id_list  */
+#line 253 "chuck.y"
+                                            { (yyval.class_ext) = new_class_ext( (yyvsp[-2].id_list), (yyvsp[0].id_list), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2249 "chuck.tab.c"
     break;
 
-  case 20:
+  case 15: /* class_body: class_body2  */
 #line 257 "chuck.y"
-    { (yyval.program_section) = new_section_func_def( (yyvsp[(1) - (1)].func_def), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+                                            { (yyval.class_body) = (yyvsp[0].class_body); }
+#line 2255 "chuck.tab.c"
     break;
 
-  case 21:
+  case 16: /* class_body: %empty  */
 #line 258 "chuck.y"
-    { (yyval.program_section) = new_section_class_def( (yyvsp[(1) - (1)].class_def), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+                                                    { (yyval.class_body) = NULL; }
+#line 2261 "chuck.tab.c"
     break;
 
-  case 22:
+  case 17: /* class_body2: class_section  */
 #line 262 "chuck.y"
-    { (yyval.class_ext) = new_class_ext( NULL, (yyvsp[(2) - (2)].id_list), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.class_body) = new_class_body( (yyvsp[0].program_section), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2267 "chuck.tab.c"
     break;
 
-  case 23:
-#line 266 "chuck.y"
-    { (yyval.id_list) = new_id_list( (yyvsp[(1) - (1)].sval), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column  /*, &@1 */ ); ;}
+  case 18: /* class_body2: class_section class_body2  */
+#line 263 "chuck.y"
+                                            { (yyval.class_body) = prepend_class_body( (yyvsp[-1].program_section), (yyvsp[0].class_body), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2273 "chuck.tab.c"
     break;
 
-  case 24:
-#line 267 "chuck.y"
-    { (yyval.id_list) = prepend_id_list( (yyvsp[(1) - (3)].sval), (yyvsp[(3) - (3)].id_list), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column  /*, &@1 */ ); ;}
+  case 19: /* class_section: statement_list  */
+#line 268 "chuck.y"
+                                            { (yyval.program_section) = new_section_stmt( (yyvsp[0].stmt_list), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2279 "chuck.tab.c"
     break;
 
-  case 25:
-#line 271 "chuck.y"
-    { (yyval.id_list) = new_id_list( (yyvsp[(1) - (1)].sval), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column  /*, &@1*/ ); ;}
+  case 20: /* class_section: function_definition  */
+#line 269 "chuck.y"
+                                            { (yyval.program_section) = new_section_func_def( (yyvsp[0].func_def), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2285 "chuck.tab.c"
     break;
 
-  case 26:
-#line 272 "chuck.y"
-    { (yyval.id_list) = prepend_id_list( (yyvsp[(1) - (3)].sval), (yyvsp[(3) - (3)].id_list), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column  /*, &@1*/ ); ;}
+  case 21: /* class_section: class_definition  */
+#line 270 "chuck.y"
+                                            { (yyval.program_section) = new_section_class_def( (yyvsp[0].class_def), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2291 "chuck.tab.c"
     break;
 
-  case 27:
-#line 277 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (8)].ival), (yyvsp[(2) - (8)].ival), (yyvsp[(3) - (8)].type_decl), (yyvsp[(4) - (8)].sval), (yyvsp[(6) - (8)].arg_list), (yyvsp[(8) - (8)].stmt), TRUE, (yylsp[(1) - (8)]).first_line, (yylsp[(1) - (8)]).first_column ); ;}
+  case 22: /* iface_ext: EXTENDS id_list  */
+#line 274 "chuck.y"
+                                            { (yyval.class_ext) = new_class_ext( NULL, (yyvsp[0].id_list), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2297 "chuck.tab.c"
     break;
 
-  case 28:
-#line 279 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (7)].ival), (yyvsp[(2) - (7)].ival), (yyvsp[(3) - (7)].type_decl), (yyvsp[(4) - (7)].sval), NULL, (yyvsp[(7) - (7)].stmt), TRUE, (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+  case 23: /* id_list: ID  */
+#line 278 "chuck.y"
+                                            { (yyval.id_list) = new_id_list( (yyvsp[0].sval), (yylsp[0]).first_line, (yylsp[0]).first_column  /*, &@1 */ ); }
+#line 2303 "chuck.tab.c"
     break;
 
-  case 29:
-#line 281 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (7)].ival), (yyvsp[(2) - (7)].ival), NULL, (yyvsp[(3) - (7)].sval), (yyvsp[(5) - (7)].arg_list), (yyvsp[(7) - (7)].stmt), TRUE, (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+  case 24: /* id_list: ID COMMA id_list  */
+#line 279 "chuck.y"
+                                            { (yyval.id_list) = prepend_id_list( (yyvsp[-2].sval), (yyvsp[0].id_list), (yylsp[-2]).first_line, (yylsp[-2]).first_column  /*, &@1 */ ); }
+#line 2309 "chuck.tab.c"
     break;
 
-  case 30:
+  case 25: /* id_dot: ID  */
 #line 283 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (6)].ival), (yyvsp[(2) - (6)].ival), NULL, (yyvsp[(3) - (6)].sval), NULL, (yyvsp[(6) - (6)].stmt), TRUE, (yylsp[(1) - (6)]).first_line, (yylsp[(1) - (6)]).first_column ); ;}
-    break;
-
-  case 31:
-#line 285 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (6)].ival), ae_key_instance, NULL, "@construct", (yyvsp[(4) - (6)].arg_list), (yyvsp[(6) - (6)].stmt), TRUE, (yylsp[(1) - (6)]).first_line, (yylsp[(1) - (6)]).first_column ); ;}
+                                            { (yyval.id_list) = new_id_list( (yyvsp[0].sval), (yylsp[0]).first_line, (yylsp[0]).first_column  /*, &@1*/ ); }
+#line 2315 "chuck.tab.c"
     break;
 
-  case 32:
-#line 287 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (5)].ival), ae_key_instance, NULL, "@construct", NULL, (yyvsp[(5) - (5)].stmt), TRUE, (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+  case 26: /* id_dot: ID DOT id_dot  */
+#line 284 "chuck.y"
+                                            { (yyval.id_list) = prepend_id_list( (yyvsp[-2].sval), (yyvsp[0].id_list), (yylsp[-2]).first_line, (yylsp[-2]).first_column  /*, &@1*/ ); }
+#line 2321 "chuck.tab.c"
     break;
 
-  case 33:
+  case 27: /* function_definition: function_decl static_decl type_decl2 ID LPAREN arg_list RPAREN code_segment  */
 #line 289 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (5)].ival), ae_key_instance, NULL, "@destruct", NULL, (yyvsp[(5) - (5)].stmt), TRUE, (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+            { (yyval.func_def) = new_func_def( (yyvsp[-7].ival), (yyvsp[-6].ival), (yyvsp[-5].type_decl), (yyvsp[-4].sval), (yyvsp[-2].arg_list), (yyvsp[0].stmt), TRUE, (yylsp[-7]).first_line, (yylsp[-7]).first_column ); }
+#line 2327 "chuck.tab.c"
     break;
 
-  case 34:
+  case 28: /* function_definition: function_decl static_decl type_decl2 ID LPAREN RPAREN code_segment  */
 #line 291 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (6)].ival), ae_key_instance, NULL, "@destruct", (yyvsp[(4) - (6)].arg_list), (yyvsp[(6) - (6)].stmt), TRUE, (yylsp[(1) - (6)]).first_line, (yylsp[(1) - (6)]).first_column ); ;}
+            { (yyval.func_def) = new_func_def( (yyvsp[-6].ival), (yyvsp[-5].ival), (yyvsp[-4].type_decl), (yyvsp[-3].sval), NULL, (yyvsp[0].stmt), TRUE, (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2333 "chuck.tab.c"
     break;
 
-  case 35:
+  case 29: /* function_definition: function_decl static_decl ID LPAREN arg_list RPAREN code_segment  */
 #line 293 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (8)].ival), (yyvsp[(2) - (8)].ival), (yyvsp[(3) - (8)].type_decl), (yyvsp[(4) - (8)].sval), (yyvsp[(6) - (8)].arg_list), NULL, TRUE, (yylsp[(1) - (8)]).first_line, (yylsp[(1) - (8)]).first_column ); ;}
+            { (yyval.func_def) = new_func_def( (yyvsp[-6].ival), (yyvsp[-5].ival), NULL, (yyvsp[-4].sval), (yyvsp[-2].arg_list), (yyvsp[0].stmt), TRUE, (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2339 "chuck.tab.c"
     break;
 
-  case 36:
+  case 30: /* function_definition: function_decl static_decl ID LPAREN RPAREN code_segment  */
 #line 295 "chuck.y"
-    { (yyval.func_def) = new_func_def( (yyvsp[(1) - (7)].ival), (yyvsp[(2) - (7)].ival), (yyvsp[(3) - (7)].type_decl), (yyvsp[(4) - (7)].sval), NULL, NULL, TRUE, (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+            { (yyval.func_def) = new_func_def( (yyvsp[-5].ival), (yyvsp[-4].ival), NULL, (yyvsp[-3].sval), NULL, (yyvsp[0].stmt), TRUE, (yylsp[-5]).first_line, (yylsp[-5]).first_column ); }
+#line 2345 "chuck.tab.c"
     break;
 
-  case 37:
+  case 31: /* function_definition: function_decl AT_CTOR LPAREN arg_list RPAREN code_segment  */
 #line 297 "chuck.y"
-    { (yyval.func_def) = new_op_overload( (yyvsp[(1) - (9)].ival), (yyvsp[(2) - (9)].ival), (yyvsp[(3) - (9)].type_decl), (yyvsp[(5) - (9)].ival), (yyvsp[(7) - (9)].arg_list), (yyvsp[(9) - (9)].stmt), TRUE, FALSE, (yylsp[(1) - (9)]).first_line, (yylsp[(1) - (9)]).first_column, (yylsp[(5) - (9)]).first_column ); ;}
+            { (yyval.func_def) = new_func_def( (yyvsp[-5].ival), ae_key_instance, NULL, "@construct", (yyvsp[-2].arg_list), (yyvsp[0].stmt), TRUE, (yylsp[-5]).first_line, (yylsp[-5]).first_column ); }
+#line 2351 "chuck.tab.c"
     break;
 
-  case 38:
+  case 32: /* function_definition: function_decl AT_CTOR LPAREN RPAREN code_segment  */
 #line 299 "chuck.y"
-    { (yyval.func_def) = new_op_overload( (yyvsp[(1) - (9)].ival), (yyvsp[(2) - (9)].ival), (yyvsp[(3) - (9)].type_decl), (yyvsp[(8) - (9)].ival), (yyvsp[(6) - (9)].arg_list), (yyvsp[(9) - (9)].stmt), TRUE, TRUE, (yylsp[(1) - (9)]).first_line, (yylsp[(1) - (9)]).first_column, (yylsp[(8) - (9)]).first_column ); ;}
+            { (yyval.func_def) = new_func_def( (yyvsp[-4].ival), ae_key_instance, NULL, "@construct", NULL, (yyvsp[0].stmt), TRUE, (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 2357 "chuck.tab.c"
     break;
 
-  case 39:
+  case 33: /* function_definition: function_decl AT_DTOR LPAREN RPAREN code_segment  */
 #line 301 "chuck.y"
-    { (yyval.func_def) = new_op_overload( (yyvsp[(1) - (11)].ival), (yyvsp[(2) - (11)].ival), (yyvsp[(3) - (11)].type_decl), (yyvsp[(6) - (11)].ival), (yyvsp[(9) - (11)].arg_list), (yyvsp[(11) - (11)].stmt), TRUE, FALSE, (yylsp[(1) - (11)]).first_line, (yylsp[(1) - (11)]).first_column, (yylsp[(5) - (11)]).first_column ); ;}
+            { (yyval.func_def) = new_func_def( (yyvsp[-4].ival), ae_key_instance, NULL, "@destruct", NULL, (yyvsp[0].stmt), TRUE, (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 2363 "chuck.tab.c"
     break;
 
-  case 40:
+  case 34: /* function_definition: function_decl AT_DTOR LPAREN arg_list RPAREN code_segment  */
 #line 303 "chuck.y"
-    { (yyval.func_def) = new_op_overload( (yyvsp[(1) - (11)].ival), (yyvsp[(2) - (11)].ival), (yyvsp[(3) - (11)].type_decl), (yyvsp[(9) - (11)].ival), (yyvsp[(6) - (11)].arg_list), (yyvsp[(11) - (11)].stmt), TRUE, TRUE, (yylsp[(1) - (11)]).first_line, (yylsp[(1) - (11)]).first_column, (yylsp[(8) - (11)]).first_column ); ;}
+            { (yyval.func_def) = new_func_def( (yyvsp[-5].ival), ae_key_instance, NULL, "@destruct", (yyvsp[-2].arg_list), (yyvsp[0].stmt), TRUE, (yylsp[-5]).first_line, (yylsp[-5]).first_column ); }
+#line 2369 "chuck.tab.c"
     break;
 
-  case 41:
-#line 307 "chuck.y"
-    { (yyval.ival) = ae_key_public; ;}
+  case 35: /* function_definition: function_decl static_decl type_decl2 ID LPAREN arg_list RPAREN SEMICOLON  */
+#line 305 "chuck.y"
+            { (yyval.func_def) = new_func_def( (yyvsp[-7].ival), (yyvsp[-6].ival), (yyvsp[-5].type_decl), (yyvsp[-4].sval), (yyvsp[-2].arg_list), NULL, TRUE, (yylsp[-7]).first_line, (yylsp[-7]).first_column ); }
+#line 2375 "chuck.tab.c"
     break;
 
-  case 42:
-#line 308 "chuck.y"
-    { (yyval.ival) = ae_key_private; ;}
+  case 36: /* function_definition: function_decl static_decl type_decl2 ID LPAREN RPAREN SEMICOLON  */
+#line 307 "chuck.y"
+            { (yyval.func_def) = new_func_def( (yyvsp[-6].ival), (yyvsp[-5].ival), (yyvsp[-4].type_decl), (yyvsp[-3].sval), NULL, NULL, TRUE, (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2381 "chuck.tab.c"
     break;
 
-  case 43:
+  case 37: /* function_definition: function_decl static_decl type_decl2 AT_OP overloadable_operator LPAREN arg_list RPAREN code_segment  */
 #line 309 "chuck.y"
-    { (yyval.ival) = ae_key_private; ;}
+            { (yyval.func_def) = new_op_overload( (yyvsp[-8].ival), (yyvsp[-7].ival), (yyvsp[-6].type_decl), (yyvsp[-4].ival), (yyvsp[-2].arg_list), (yyvsp[0].stmt), TRUE, FALSE, (yylsp[-8]).first_line, (yylsp[-8]).first_column, (yylsp[-4]).first_column ); }
+#line 2387 "chuck.tab.c"
     break;
 
-  case 44:
-#line 313 "chuck.y"
-    { (yyval.ival) = ae_key_func; ;}
+  case 38: /* function_definition: function_decl static_decl type_decl2 AT_OP LPAREN arg_list RPAREN overloadable_operator code_segment  */
+#line 311 "chuck.y"
+            { (yyval.func_def) = new_op_overload( (yyvsp[-8].ival), (yyvsp[-7].ival), (yyvsp[-6].type_decl), (yyvsp[-1].ival), (yyvsp[-3].arg_list), (yyvsp[0].stmt), TRUE, TRUE, (yylsp[-8]).first_line, (yylsp[-8]).first_column, (yylsp[-1]).first_column ); }
+#line 2393 "chuck.tab.c"
     break;
 
-  case 45:
-#line 314 "chuck.y"
-    { (yyval.ival) = ae_key_public; ;}
+  case 39: /* function_definition: function_decl static_decl type_decl2 AT_OP LPAREN overloadable_operator RPAREN LPAREN arg_list RPAREN code_segment  */
+#line 313 "chuck.y"
+            { (yyval.func_def) = new_op_overload( (yyvsp[-10].ival), (yyvsp[-9].ival), (yyvsp[-8].type_decl), (yyvsp[-5].ival), (yyvsp[-2].arg_list), (yyvsp[0].stmt), TRUE, FALSE, (yylsp[-10]).first_line, (yylsp[-10]).first_column, (yylsp[-6]).first_column ); }
+#line 2399 "chuck.tab.c"
     break;
 
-  case 46:
+  case 40: /* function_definition: function_decl static_decl type_decl2 AT_OP LPAREN arg_list RPAREN LPAREN overloadable_operator RPAREN code_segment  */
 #line 315 "chuck.y"
-    { (yyval.ival) = ae_key_protected; ;}
+            { (yyval.func_def) = new_op_overload( (yyvsp[-10].ival), (yyvsp[-9].ival), (yyvsp[-8].type_decl), (yyvsp[-2].ival), (yyvsp[-5].arg_list), (yyvsp[0].stmt), TRUE, TRUE, (yylsp[-10]).first_line, (yylsp[-10]).first_column, (yylsp[-3]).first_column ); }
+#line 2405 "chuck.tab.c"
     break;
 
-  case 47:
-#line 316 "chuck.y"
-    { (yyval.ival) = ae_key_private; ;}
+  case 41: /* class_decl: PUBLIC  */
+#line 319 "chuck.y"
+                                            { (yyval.ival) = ae_key_public; }
+#line 2411 "chuck.tab.c"
     break;
 
-  case 48:
+  case 42: /* class_decl: PRIVATE  */
 #line 320 "chuck.y"
-    { (yyval.ival) = ae_key_static; ;}
+                                            { (yyval.ival) = ae_key_private; }
+#line 2417 "chuck.tab.c"
     break;
 
-  case 49:
+  case 43: /* class_decl: %empty  */
 #line 321 "chuck.y"
-    { (yyval.ival) = ae_key_abstract; ;}
+                                            { (yyval.ival) = ae_key_private; }
+#line 2423 "chuck.tab.c"
     break;
 
-  case 50:
-#line 322 "chuck.y"
-    { (yyval.ival) = ae_key_instance; ;}
+  case 44: /* function_decl: FUNCTION  */
+#line 325 "chuck.y"
+                                            { (yyval.ival) = ae_key_func; }
+#line 2429 "chuck.tab.c"
     break;
 
-  case 51:
+  case 45: /* function_decl: PUBLIC  */
 #line 326 "chuck.y"
-    { (yyval.type_decl) = new_type_decl( new_id_list( (yyvsp[(1) - (1)].sval), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column /*, &@1*/ ), 0, (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+                                            { (yyval.ival) = ae_key_public; }
+#line 2435 "chuck.tab.c"
     break;
 
-  case 52:
+  case 46: /* function_decl: PROTECTED  */
 #line 327 "chuck.y"
-    { (yyval.type_decl) = new_type_decl( new_id_list( (yyvsp[(1) - (2)].sval), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column /*, &@1*/ ), 1, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.ival) = ae_key_protected; }
+#line 2441 "chuck.tab.c"
     break;
 
-  case 53:
-#line 331 "chuck.y"
-    { (yyval.type_decl) = new_type_decl( (yyvsp[(2) - (3)].id_list), 0, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 47: /* function_decl: PRIVATE  */
+#line 328 "chuck.y"
+                                            { (yyval.ival) = ae_key_private; }
+#line 2447 "chuck.tab.c"
     break;
 
-  case 54:
+  case 48: /* static_decl: STATIC  */
 #line 332 "chuck.y"
-    { (yyval.type_decl) = new_type_decl( (yyvsp[(2) - (4)].id_list), 1, (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+                                            { (yyval.ival) = ae_key_static; }
+#line 2453 "chuck.tab.c"
     break;
 
-  case 55:
-#line 341 "chuck.y"
-    { (yyval.type_decl) = (yyvsp[(1) - (1)].type_decl); ;}
+  case 49: /* static_decl: ABSTRACT  */
+#line 333 "chuck.y"
+                                            { (yyval.ival) = ae_key_abstract; }
+#line 2459 "chuck.tab.c"
     break;
 
-  case 56:
-#line 342 "chuck.y"
-    { (yyval.type_decl) = (yyvsp[(1) - (1)].type_decl); ;}
+  case 50: /* static_decl: %empty  */
+#line 334 "chuck.y"
+                                            { (yyval.ival) = ae_key_instance; }
+#line 2465 "chuck.tab.c"
     break;
 
-  case 57:
-#line 347 "chuck.y"
-    { (yyval.type_decl) = (yyvsp[(1) - (1)].type_decl); ;}
+  case 51: /* type_decl_a: ID  */
+#line 338 "chuck.y"
+                                            { (yyval.type_decl) = new_type_decl( new_id_list( (yyvsp[0].sval), (yylsp[0]).first_line, (yylsp[0]).first_column /*, &@1*/ ), 0, (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2471 "chuck.tab.c"
     break;
 
-  case 58:
-#line 348 "chuck.y"
-    { (yyval.type_decl) = add_type_decl_array( (yyvsp[(1) - (2)].type_decl), (yyvsp[(2) - (2)].array_sub), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 52: /* type_decl_a: ID AT_SYM  */
+#line 339 "chuck.y"
+                                            { (yyval.type_decl) = new_type_decl( new_id_list( (yyvsp[-1].sval), (yylsp[-1]).first_line, (yylsp[-1]).first_column /*, &@1*/ ), 1, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2477 "chuck.tab.c"
     break;
 
-  case 59:
-#line 352 "chuck.y"
-    { (yyval.arg_list) = new_arg_list( (yyvsp[(1) - (2)].type_decl), (yyvsp[(2) - (2)].var_decl), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 53: /* type_decl_b: LT id_dot GT  */
+#line 343 "chuck.y"
+                                            { (yyval.type_decl) = new_type_decl( (yyvsp[-1].id_list), 0, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2483 "chuck.tab.c"
     break;
 
-  case 60:
-#line 353 "chuck.y"
-    { (yyval.arg_list) = prepend_arg_list( (yyvsp[(1) - (4)].type_decl), (yyvsp[(2) - (4)].var_decl), (yyvsp[(4) - (4)].arg_list), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+  case 54: /* type_decl_b: LT id_dot GT AT_SYM  */
+#line 344 "chuck.y"
+                                            { (yyval.type_decl) = new_type_decl( (yyvsp[-2].id_list), 1, (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2489 "chuck.tab.c"
     break;
 
-  case 61:
-#line 357 "chuck.y"
-    { (yyval.stmt_list) = new_stmt_list( (yyvsp[(1) - (1)].stmt), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 55: /* type_decl: type_decl_a  */
+#line 353 "chuck.y"
+                                            { (yyval.type_decl) = (yyvsp[0].type_decl); }
+#line 2495 "chuck.tab.c"
     break;
 
-  case 62:
-#line 358 "chuck.y"
-    { (yyval.stmt_list) = append_stmt_list( (yyvsp[(1) - (2)].stmt_list), (yyvsp[(2) - (2)].stmt), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 56: /* type_decl: type_decl_b  */
+#line 354 "chuck.y"
+                                            { (yyval.type_decl) = (yyvsp[0].type_decl); }
+#line 2501 "chuck.tab.c"
     break;
 
-  case 63:
-#line 362 "chuck.y"
-    { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
+  case 57: /* type_decl2: type_decl  */
+#line 359 "chuck.y"
+                                            { (yyval.type_decl) = (yyvsp[0].type_decl); }
+#line 2507 "chuck.tab.c"
     break;
 
-  case 64:
-#line 363 "chuck.y"
-    { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
+  case 58: /* type_decl2: type_decl array_empty  */
+#line 360 "chuck.y"
+                                            { (yyval.type_decl) = add_type_decl_array( (yyvsp[-1].type_decl), (yyvsp[0].array_sub), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2513 "chuck.tab.c"
     break;
 
-  case 65:
+  case 59: /* arg_list: type_decl var_decl  */
 #line 364 "chuck.y"
-    { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
+                                            { (yyval.arg_list) = new_arg_list( (yyvsp[-1].type_decl), (yyvsp[0].var_decl), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2519 "chuck.tab.c"
     break;
 
-  case 66:
+  case 60: /* arg_list: type_decl var_decl COMMA arg_list  */
 #line 365 "chuck.y"
-    { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
-    break;
-
-  case 67:
-#line 367 "chuck.y"
-    { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
-    break;
-
-  case 68:
-#line 368 "chuck.y"
-    { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
+                                            { (yyval.arg_list) = prepend_arg_list( (yyvsp[-3].type_decl), (yyvsp[-2].var_decl), (yyvsp[0].arg_list), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2525 "chuck.tab.c"
     break;
 
-  case 69:
+  case 61: /* statement_list: statement  */
 #line 369 "chuck.y"
-    { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
+                                            { (yyval.stmt_list) = new_stmt_list( (yyvsp[0].stmt), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2531 "chuck.tab.c"
     break;
 
-  case 70:
-#line 373 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_return( NULL, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 62: /* statement_list: statement_list statement  */
+#line 370 "chuck.y"
+                                            { (yyval.stmt_list) = append_stmt_list( (yyvsp[-1].stmt_list), (yyvsp[0].stmt), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2537 "chuck.tab.c"
     break;
 
-  case 71:
+  case 63: /* statement: expression_statement  */
 #line 374 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_return( (yyvsp[(2) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+                                            { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2543 "chuck.tab.c"
     break;
 
-  case 72:
+  case 64: /* statement: loop_statement  */
 #line 375 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_break( (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2549 "chuck.tab.c"
     break;
 
-  case 73:
+  case 65: /* statement: selection_statement  */
 #line 376 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_continue( (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2555 "chuck.tab.c"
     break;
 
-  case 74:
-#line 381 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_if( (yyvsp[(3) - (5)].exp), (yyvsp[(5) - (5)].stmt), NULL, (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+  case 66: /* statement: jump_statement  */
+#line 377 "chuck.y"
+                                            { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2561 "chuck.tab.c"
     break;
 
-  case 75:
-#line 383 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_if( (yyvsp[(3) - (7)].exp), (yyvsp[(5) - (7)].stmt), (yyvsp[(7) - (7)].stmt), (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+  case 67: /* statement: code_segment  */
+#line 379 "chuck.y"
+                                            { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2567 "chuck.tab.c"
     break;
 
-  case 76:
-#line 388 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_while( (yyvsp[(3) - (5)].exp), (yyvsp[(5) - (5)].stmt), (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+  case 68: /* statement: import_statement  */
+#line 380 "chuck.y"
+                                            { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2573 "chuck.tab.c"
+    break;
+
+  case 69: /* statement: doc_statement  */
+#line 381 "chuck.y"
+                                            { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2579 "chuck.tab.c"
+    break;
+
+  case 70: /* jump_statement: RETURN SEMICOLON  */
+#line 385 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_return( NULL, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2585 "chuck.tab.c"
     break;
 
-  case 77:
-#line 390 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_do_while( (yyvsp[(5) - (7)].exp), (yyvsp[(2) - (7)].stmt), (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+  case 71: /* jump_statement: RETURN expression SEMICOLON  */
+#line 386 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_return( (yyvsp[-1].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2591 "chuck.tab.c"
     break;
 
-  case 78:
-#line 392 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_for( (yyvsp[(3) - (6)].stmt), (yyvsp[(4) - (6)].stmt), NULL, (yyvsp[(6) - (6)].stmt), (yylsp[(1) - (6)]).first_line, (yylsp[(1) - (6)]).first_column ); ;}
+  case 72: /* jump_statement: BREAK SEMICOLON  */
+#line 387 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_break( (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2597 "chuck.tab.c"
     break;
 
-  case 79:
-#line 394 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_for( (yyvsp[(3) - (7)].stmt), (yyvsp[(4) - (7)].stmt), (yyvsp[(5) - (7)].exp), (yyvsp[(7) - (7)].stmt), (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+  case 73: /* jump_statement: CONTINUE SEMICOLON  */
+#line 388 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_continue( (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2603 "chuck.tab.c"
     break;
 
-  case 80:
-#line 396 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_foreach( (yyvsp[(3) - (7)].exp), (yyvsp[(5) - (7)].exp), (yyvsp[(7) - (7)].stmt), (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+  case 74: /* selection_statement: IF LPAREN expression RPAREN statement  */
+#line 393 "chuck.y"
+            { (yyval.stmt) = new_stmt_from_if( (yyvsp[-2].exp), (yyvsp[0].stmt), NULL, (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 2609 "chuck.tab.c"
     break;
 
-  case 81:
-#line 398 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_until( (yyvsp[(3) - (5)].exp), (yyvsp[(5) - (5)].stmt), (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+  case 75: /* selection_statement: IF LPAREN expression RPAREN statement ELSE statement  */
+#line 395 "chuck.y"
+            { (yyval.stmt) = new_stmt_from_if( (yyvsp[-4].exp), (yyvsp[-2].stmt), (yyvsp[0].stmt), (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2615 "chuck.tab.c"
     break;
 
-  case 82:
+  case 76: /* loop_statement: WHILE LPAREN expression RPAREN statement  */
 #line 400 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_do_until( (yyvsp[(5) - (7)].exp), (yyvsp[(2) - (7)].stmt), (yylsp[(1) - (7)]).first_line, (yylsp[(1) - (7)]).first_column ); ;}
+            { (yyval.stmt) = new_stmt_from_while( (yyvsp[-2].exp), (yyvsp[0].stmt), (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 2621 "chuck.tab.c"
     break;
 
-  case 83:
+  case 77: /* loop_statement: DO statement WHILE LPAREN expression RPAREN SEMICOLON  */
 #line 402 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_loop( (yyvsp[(3) - (5)].exp), (yyvsp[(5) - (5)].stmt), (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+            { (yyval.stmt) = new_stmt_from_do_while( (yyvsp[-2].exp), (yyvsp[-5].stmt), (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2627 "chuck.tab.c"
     break;
 
-  case 84:
-#line 406 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_code( NULL, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 78: /* loop_statement: FOR LPAREN expression_statement expression_statement RPAREN statement  */
+#line 404 "chuck.y"
+            { (yyval.stmt) = new_stmt_from_for( (yyvsp[-3].stmt), (yyvsp[-2].stmt), NULL, (yyvsp[0].stmt), (yylsp[-5]).first_line, (yylsp[-5]).first_column ); }
+#line 2633 "chuck.tab.c"
     break;
 
-  case 85:
-#line 407 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_code( (yyvsp[(2) - (3)].stmt_list), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 79: /* loop_statement: FOR LPAREN expression_statement expression_statement expression RPAREN statement  */
+#line 406 "chuck.y"
+            { (yyval.stmt) = new_stmt_from_for( (yyvsp[-4].stmt), (yyvsp[-3].stmt), (yyvsp[-2].exp), (yyvsp[0].stmt), (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2639 "chuck.tab.c"
     break;
 
-  case 86:
-#line 411 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_import( (yyvsp[(2) - (2)].import), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 80: /* loop_statement: FOR LPAREN expression COLON expression RPAREN statement  */
+#line 408 "chuck.y"
+            { (yyval.stmt) = new_stmt_from_foreach( (yyvsp[-4].exp), (yyvsp[-2].exp), (yyvsp[0].stmt), (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2645 "chuck.tab.c"
     break;
 
-  case 87:
-#line 412 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_import( NULL, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 81: /* loop_statement: UNTIL LPAREN expression RPAREN statement  */
+#line 410 "chuck.y"
+            { (yyval.stmt) = new_stmt_from_until( (yyvsp[-2].exp), (yyvsp[0].stmt), (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 2651 "chuck.tab.c"
     break;
 
-  case 88:
-#line 413 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_import( NULL, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 82: /* loop_statement: DO statement UNTIL LPAREN expression RPAREN SEMICOLON  */
+#line 412 "chuck.y"
+            { (yyval.stmt) = new_stmt_from_do_until( (yyvsp[-2].exp), (yyvsp[-5].stmt), (yylsp[-6]).first_line, (yylsp[-6]).first_column ); }
+#line 2657 "chuck.tab.c"
     break;
 
-  case 89:
+  case 83: /* loop_statement: LOOP LPAREN expression RPAREN statement  */
 #line 414 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_import( (yyvsp[(3) - (4)].import), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+            { (yyval.stmt) = new_stmt_from_loop( (yyvsp[-2].exp), (yyvsp[0].stmt), (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 2663 "chuck.tab.c"
     break;
 
-  case 90:
-#line 415 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_import( (yyvsp[(3) - (4)].import), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+  case 84: /* code_segment: LBRACE RBRACE  */
+#line 418 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_code( NULL, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2669 "chuck.tab.c"
     break;
 
-  case 91:
+  case 85: /* code_segment: LBRACE statement_list RBRACE  */
 #line 419 "chuck.y"
-    { (yyval.import) = (yyvsp[(1) - (1)].import); ;}
+                                            { (yyval.stmt) = new_stmt_from_code( (yyvsp[-1].stmt_list), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2675 "chuck.tab.c"
     break;
 
-  case 92:
-#line 420 "chuck.y"
-    { (yyval.import) = prepend_import( (yyvsp[(1) - (3)].import), (yyvsp[(3) - (3)].import), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 86: /* import_statement: AT_IMPORT import_target  */
+#line 423 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_import( (yyvsp[0].import), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2681 "chuck.tab.c"
     break;
 
-  case 93:
+  case 87: /* import_statement: AT_IMPORT LBRACK RBRACK  */
 #line 424 "chuck.y"
-    { (yyval.import) = new_import( (yyvsp[(1) - (1)].sval), NULL, (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+                                            { (yyval.stmt) = new_stmt_from_import( NULL, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2687 "chuck.tab.c"
+    break;
+
+  case 88: /* import_statement: AT_IMPORT LBRACE RBRACE  */
+#line 425 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_import( NULL, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2693 "chuck.tab.c"
     break;
 
-  case 94:
-#line 429 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_doc( (yyvsp[(2) - (2)].doc), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 89: /* import_statement: AT_IMPORT LBRACK import_list LBRACK  */
+#line 426 "chuck.y"
+                                              { (yyval.stmt) = new_stmt_from_import( (yyvsp[-1].import), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2699 "chuck.tab.c"
     break;
 
-  case 95:
-#line 430 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_doc( (yyvsp[(3) - (4)].doc), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+  case 90: /* import_statement: AT_IMPORT LBRACE import_list RBRACE  */
+#line 427 "chuck.y"
+                                              { (yyval.stmt) = new_stmt_from_import( (yyvsp[-1].import), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2705 "chuck.tab.c"
     break;
 
-  case 96:
+  case 91: /* import_list: import_target  */
 #line 431 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_doc( (yyvsp[(3) - (4)].doc), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+                                            { (yyval.import) = (yyvsp[0].import); }
+#line 2711 "chuck.tab.c"
     break;
 
-  case 97:
-#line 435 "chuck.y"
-    { (yyval.doc) = (yyvsp[(1) - (1)].doc); ;}
+  case 92: /* import_list: import_target COMMA import_list  */
+#line 432 "chuck.y"
+                                            { (yyval.import) = prepend_import( (yyvsp[-2].import), (yyvsp[0].import), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2717 "chuck.tab.c"
     break;
 
-  case 98:
+  case 93: /* import_target: STRING_LIT  */
 #line 436 "chuck.y"
-    { (yyval.doc) = prepend_doc( (yyvsp[(1) - (3)].doc), (yyvsp[(3) - (3)].doc), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+                                            { (yyval.import) = new_import( (yyvsp[0].sval), NULL, (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2723 "chuck.tab.c"
     break;
 
-  case 99:
-#line 440 "chuck.y"
-    { (yyval.doc) = new_doc( (yyvsp[(1) - (1)].sval), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 94: /* doc_statement: AT_DOC doc_target  */
+#line 441 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_doc( (yyvsp[0].doc), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2729 "chuck.tab.c"
     break;
 
-  case 100:
-#line 444 "chuck.y"
-    { (yyval.stmt) = NULL; ;}
+  case 95: /* doc_statement: AT_DOC LBRACK doc_list RBRACK  */
+#line 442 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_doc( (yyvsp[-1].doc), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2735 "chuck.tab.c"
     break;
 
-  case 101:
-#line 445 "chuck.y"
-    { (yyval.stmt) = new_stmt_from_expression( (yyvsp[(1) - (2)].exp), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 96: /* doc_statement: AT_DOC LBRACE doc_list RBRACE  */
+#line 443 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_doc( (yyvsp[-1].doc), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2741 "chuck.tab.c"
     break;
 
-  case 102:
-#line 449 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 97: /* doc_list: doc_target  */
+#line 447 "chuck.y"
+                                            { (yyval.doc) = (yyvsp[0].doc); }
+#line 2747 "chuck.tab.c"
     break;
 
-  case 103:
-#line 450 "chuck.y"
-    { (yyval.exp) = append_expression( (yyvsp[(1) - (3)].exp), (yyvsp[(3) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 98: /* doc_list: doc_target COMMA doc_list  */
+#line 448 "chuck.y"
+                                            { (yyval.doc) = prepend_doc( (yyvsp[-2].doc), (yyvsp[0].doc), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2753 "chuck.tab.c"
     break;
 
-  case 104:
-#line 454 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 99: /* doc_target: STRING_LIT  */
+#line 452 "chuck.y"
+                                            { (yyval.doc) = new_doc( (yyvsp[0].sval), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2759 "chuck.tab.c"
     break;
 
-  case 105:
+  case 100: /* expression_statement: SEMICOLON  */
 #line 456 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), (yyvsp[(2) - (3)].ival), (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+                                            { (yyval.stmt) = NULL; }
+#line 2765 "chuck.tab.c"
     break;
 
-  case 106:
-#line 460 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 101: /* expression_statement: expression SEMICOLON  */
+#line 457 "chuck.y"
+                                            { (yyval.stmt) = new_stmt_from_expression( (yyvsp[-1].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2771 "chuck.tab.c"
     break;
 
-  case 107:
-#line 462 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), (yyvsp[(2) - (3)].ival), (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+  case 102: /* expression: chuck_expression  */
+#line 461 "chuck.y"
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 2777 "chuck.tab.c"
     break;
 
-  case 108:
-#line 466 "chuck.y"
-    { (yyval.array_sub) = new_array_sub( (yyvsp[(2) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 103: /* expression: expression COMMA chuck_expression  */
+#line 462 "chuck.y"
+                                            { (yyval.exp) = append_expression( (yyvsp[-2].exp), (yyvsp[0].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2783 "chuck.tab.c"
     break;
 
-  case 109:
-#line 467 "chuck.y"
-    { (yyval.array_sub) = new_array_sub( (yyvsp[(2) - (4)].exp), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+  case 104: /* chuck_expression: arrow_expression  */
+#line 466 "chuck.y"
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 2789 "chuck.tab.c"
     break;
 
-  case 110:
-#line 469 "chuck.y"
-    { (yyval.array_sub) = prepend_array_sub( (yyvsp[(4) - (4)].array_sub), (yyvsp[(2) - (4)].exp), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+  case 105: /* chuck_expression: chuck_expression chuck_operator arrow_expression  */
+#line 468 "chuck.y"
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), (yyvsp[-1].ival), (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2795 "chuck.tab.c"
     break;
 
-  case 111:
-#line 471 "chuck.y"
-    { (yyval.array_sub) = prepend_array_sub( (yyvsp[(5) - (5)].array_sub), (yyvsp[(2) - (5)].exp), (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+  case 106: /* arrow_expression: decl_expression  */
+#line 472 "chuck.y"
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 2801 "chuck.tab.c"
     break;
 
-  case 112:
-#line 475 "chuck.y"
-    { (yyval.array_sub) = new_array_sub( NULL, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 107: /* arrow_expression: arrow_expression arrow_operator decl_expression  */
+#line 474 "chuck.y"
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), (yyvsp[-1].ival), (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2807 "chuck.tab.c"
     break;
 
-  case 113:
-#line 476 "chuck.y"
-    { (yyval.array_sub) = prepend_array_sub( (yyvsp[(1) - (3)].array_sub), NULL, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 108: /* array_exp: LBRACK expression RBRACK  */
+#line 478 "chuck.y"
+                                            { (yyval.array_sub) = new_array_sub( (yyvsp[-1].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2813 "chuck.tab.c"
     break;
 
-  case 114:
-#line 480 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 109: /* array_exp: LBRACK expression COMMA RBRACK  */
+#line 479 "chuck.y"
+                                            { (yyval.array_sub) = new_array_sub( (yyvsp[-2].exp), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2819 "chuck.tab.c"
     break;
 
-  case 115:
+  case 110: /* array_exp: LBRACK expression RBRACK array_exp  */
 #line 481 "chuck.y"
-    { (yyval.exp) = new_exp_decl( (yyvsp[(1) - (2)].type_decl), (yyvsp[(2) - (2)].var_decl_list), 0, 0, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
-    break;
-
-  case 116:
-#line 482 "chuck.y"
-    { (yyval.exp) = new_exp_decl_external( (yyvsp[(2) - (3)].type_decl), (yyvsp[(3) - (3)].var_decl_list), 0, 0, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+            { (yyval.array_sub) = prepend_array_sub( (yyvsp[0].array_sub), (yyvsp[-2].exp), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2825 "chuck.tab.c"
     break;
 
-  case 117:
+  case 111: /* array_exp: LBRACK expression COMMA RBRACK array_exp  */
 #line 483 "chuck.y"
-    { (yyval.exp) = new_exp_decl_global( (yyvsp[(2) - (3)].type_decl), (yyvsp[(3) - (3)].var_decl_list), 0, 0, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+            { (yyval.array_sub) = prepend_array_sub( (yyvsp[0].array_sub), (yyvsp[-3].exp), (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 2831 "chuck.tab.c"
     break;
 
-  case 118:
-#line 484 "chuck.y"
-    { (yyval.exp) = new_exp_decl( (yyvsp[(2) - (3)].type_decl), (yyvsp[(3) - (3)].var_decl_list), 1, 0, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 112: /* array_empty: LBRACK RBRACK  */
+#line 487 "chuck.y"
+                                            { (yyval.array_sub) = new_array_sub( NULL, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2837 "chuck.tab.c"
     break;
 
-  case 119:
-#line 485 "chuck.y"
-    { (yyval.exp) = new_exp_decl( NULL, (yyvsp[(2) - (2)].var_decl_list), 0, 0, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 113: /* array_empty: array_empty LBRACK RBRACK  */
+#line 488 "chuck.y"
+                                            { (yyval.array_sub) = prepend_array_sub( (yyvsp[-2].array_sub), NULL, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2843 "chuck.tab.c"
     break;
 
-  case 120:
-#line 486 "chuck.y"
-    { (yyval.exp) = new_exp_decl( NULL, (yyvsp[(3) - (3)].var_decl_list), 1, 0, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 114: /* decl_expression: conditional_expression  */
+#line 492 "chuck.y"
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 2849 "chuck.tab.c"
     break;
 
-  case 121:
-#line 490 "chuck.y"
-    { (yyval.var_decl_list) = new_var_decl_list( (yyvsp[(1) - (1)].var_decl), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 115: /* decl_expression: type_decl var_decl_list  */
+#line 493 "chuck.y"
+                                            { (yyval.exp) = new_exp_decl( (yyvsp[-1].type_decl), (yyvsp[0].var_decl_list), 0, 0, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2855 "chuck.tab.c"
     break;
 
-  case 122:
-#line 491 "chuck.y"
-    { (yyval.var_decl_list) = prepend_var_decl_list( (yyvsp[(1) - (3)].var_decl), (yyvsp[(3) - (3)].var_decl_list), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 116: /* decl_expression: EXTERNAL type_decl var_decl_list  */
+#line 494 "chuck.y"
+                                            { (yyval.exp) = new_exp_decl_external( (yyvsp[-1].type_decl), (yyvsp[0].var_decl_list), 0, 0, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2861 "chuck.tab.c"
     break;
 
-  case 123:
+  case 117: /* decl_expression: GLOBAL type_decl var_decl_list  */
 #line 495 "chuck.y"
-    { (yyval.var_decl) = new_var_decl( (yyvsp[(1) - (1)].sval), FALSE, NULL, NULL, (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+                                            { (yyval.exp) = new_exp_decl_global( (yyvsp[-1].type_decl), (yyvsp[0].var_decl_list), 0, 0, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2867 "chuck.tab.c"
     break;
 
-  case 124:
+  case 118: /* decl_expression: STATIC type_decl var_decl_list  */
 #line 496 "chuck.y"
-    { (yyval.var_decl) = new_var_decl( (yyvsp[(1) - (2)].sval), FALSE, NULL, (yyvsp[(2) - (2)].array_sub), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.exp) = new_exp_decl( (yyvsp[-1].type_decl), (yyvsp[0].var_decl_list), 1, 0, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2873 "chuck.tab.c"
     break;
 
-  case 125:
+  case 119: /* decl_expression: SAME var_decl_list  */
 #line 497 "chuck.y"
-    { (yyval.var_decl) = new_var_decl( (yyvsp[(1) - (2)].sval), FALSE, NULL, (yyvsp[(2) - (2)].array_sub), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.exp) = new_exp_decl( NULL, (yyvsp[0].var_decl_list), 0, 0, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2879 "chuck.tab.c"
     break;
 
-  case 126:
+  case 120: /* decl_expression: STATIC SAME var_decl_list  */
 #line 498 "chuck.y"
-    { (yyval.var_decl) = new_var_decl( (yyvsp[(1) - (3)].sval), TRUE, NULL, NULL, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
-    break;
-
-  case 127:
-#line 499 "chuck.y"
-    { (yyval.var_decl) = new_var_decl( (yyvsp[(1) - (4)].sval), TRUE, (yyvsp[(3) - (4)].exp), NULL, (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
-    break;
-
-  case 128:
-#line 500 "chuck.y"
-    { (yyval.var_decl) = new_var_decl( (yyvsp[(1) - (4)].sval), TRUE, NULL, (yyvsp[(4) - (4)].array_sub), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
-    break;
-
-  case 129:
-#line 501 "chuck.y"
-    { (yyval.var_decl) = new_var_decl( (yyvsp[(1) - (5)].sval), TRUE, (yyvsp[(3) - (5)].exp), (yyvsp[(5) - (5)].array_sub), (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+                                            { (yyval.exp) = new_exp_decl( NULL, (yyvsp[0].var_decl_list), 1, 0, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2885 "chuck.tab.c"
     break;
 
-  case 130:
-#line 506 "chuck.y"
-    { (yyval.complex_exp) = new_complex( (yyvsp[(2) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 121: /* var_decl_list: var_decl  */
+#line 502 "chuck.y"
+                                            { (yyval.var_decl_list) = new_var_decl_list( (yyvsp[0].var_decl), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2891 "chuck.tab.c"
     break;
 
-  case 131:
-#line 511 "chuck.y"
-    { (yyval.polar_exp) = new_polar( (yyvsp[(2) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 122: /* var_decl_list: var_decl COMMA var_decl_list  */
+#line 503 "chuck.y"
+                                            { (yyval.var_decl_list) = prepend_var_decl_list( (yyvsp[-2].var_decl), (yyvsp[0].var_decl_list), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2897 "chuck.tab.c"
     break;
 
-  case 132:
-#line 516 "chuck.y"
-    { (yyval.vec_exp) = new_vec( (yyvsp[(2) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 123: /* var_decl: ID  */
+#line 507 "chuck.y"
+                                            { (yyval.var_decl) = new_var_decl( (yyvsp[0].sval), FALSE, NULL, NULL, (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 2903 "chuck.tab.c"
     break;
 
-  case 133:
-#line 520 "chuck.y"
-    { (yyval.ival) = ae_op_chuck; ;}
+  case 124: /* var_decl: ID array_exp  */
+#line 508 "chuck.y"
+                                            { (yyval.var_decl) = new_var_decl( (yyvsp[-1].sval), FALSE, NULL, (yyvsp[0].array_sub), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2909 "chuck.tab.c"
     break;
 
-  case 134:
-#line 521 "chuck.y"
-    { (yyval.ival) = ae_op_at_chuck; ;}
+  case 125: /* var_decl: ID array_empty  */
+#line 509 "chuck.y"
+                                            { (yyval.var_decl) = new_var_decl( (yyvsp[-1].sval), FALSE, NULL, (yyvsp[0].array_sub), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 2915 "chuck.tab.c"
     break;
 
-  case 135:
-#line 522 "chuck.y"
-    { (yyval.ival) = ae_op_plus_chuck; ;}
+  case 126: /* var_decl: ID LPAREN RPAREN  */
+#line 510 "chuck.y"
+                                            { (yyval.var_decl) = new_var_decl( (yyvsp[-2].sval), TRUE, NULL, NULL, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2921 "chuck.tab.c"
     break;
 
-  case 136:
-#line 523 "chuck.y"
-    { (yyval.ival) = ae_op_minus_chuck; ;}
+  case 127: /* var_decl: ID LPAREN expression RPAREN  */
+#line 511 "chuck.y"
+                                            { (yyval.var_decl) = new_var_decl( (yyvsp[-3].sval), TRUE, (yyvsp[-1].exp), NULL, (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2927 "chuck.tab.c"
     break;
 
-  case 137:
-#line 524 "chuck.y"
-    { (yyval.ival) = ae_op_times_chuck; ;}
+  case 128: /* var_decl: ID LPAREN RPAREN array_exp  */
+#line 512 "chuck.y"
+                                            { (yyval.var_decl) = new_var_decl( (yyvsp[-3].sval), TRUE, NULL, (yyvsp[0].array_sub), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 2933 "chuck.tab.c"
     break;
 
-  case 138:
-#line 525 "chuck.y"
-    { (yyval.ival) = ae_op_divide_chuck; ;}
+  case 129: /* var_decl: ID LPAREN expression RPAREN array_exp  */
+#line 513 "chuck.y"
+                                                 { (yyval.var_decl) = new_var_decl( (yyvsp[-4].sval), TRUE, (yyvsp[-2].exp), (yyvsp[0].array_sub), (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 2939 "chuck.tab.c"
     break;
 
-  case 139:
-#line 526 "chuck.y"
-    { (yyval.ival) = ae_op_shift_right_chuck; ;}
+  case 130: /* complex_exp: POUNDPAREN expression RPAREN  */
+#line 518 "chuck.y"
+            { (yyval.complex_exp) = new_complex( (yyvsp[-1].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2945 "chuck.tab.c"
     break;
 
-  case 140:
-#line 527 "chuck.y"
-    { (yyval.ival) = ae_op_shift_left_chuck; ;}
+  case 131: /* polar_exp: PERCENTPAREN expression RPAREN  */
+#line 523 "chuck.y"
+            { (yyval.polar_exp) = new_polar( (yyvsp[-1].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2951 "chuck.tab.c"
     break;
 
-  case 141:
+  case 132: /* vec_exp: ATPAREN expression RPAREN  */
 #line 528 "chuck.y"
-    { (yyval.ival) = ae_op_percent_chuck; ;}
+            { (yyval.vec_exp) = new_vec( (yyvsp[-1].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 2957 "chuck.tab.c"
     break;
 
-  case 142:
-#line 529 "chuck.y"
-    { (yyval.ival) = ae_op_unchuck; ;}
+  case 133: /* chuck_operator: CHUCK  */
+#line 532 "chuck.y"
+                                            { (yyval.ival) = ae_op_chuck; }
+#line 2963 "chuck.tab.c"
     break;
 
-  case 143:
-#line 530 "chuck.y"
-    { (yyval.ival) = ae_op_upchuck; ;}
+  case 134: /* chuck_operator: AT_CHUCK  */
+#line 533 "chuck.y"
+                                            { (yyval.ival) = ae_op_at_chuck; }
+#line 2969 "chuck.tab.c"
     break;
 
-  case 144:
-#line 531 "chuck.y"
-    { (yyval.ival) = ae_op_downchuck; ;}
+  case 135: /* chuck_operator: PLUS_CHUCK  */
+#line 534 "chuck.y"
+                                            { (yyval.ival) = ae_op_plus_chuck; }
+#line 2975 "chuck.tab.c"
     break;
 
-  case 145:
-#line 532 "chuck.y"
-    { (yyval.ival) = ae_op_s_and_chuck; ;}
+  case 136: /* chuck_operator: MINUS_CHUCK  */
+#line 535 "chuck.y"
+                                            { (yyval.ival) = ae_op_minus_chuck; }
+#line 2981 "chuck.tab.c"
     break;
 
-  case 146:
-#line 533 "chuck.y"
-    { (yyval.ival) = ae_op_s_or_chuck; ;}
+  case 137: /* chuck_operator: TIMES_CHUCK  */
+#line 536 "chuck.y"
+                                            { (yyval.ival) = ae_op_times_chuck; }
+#line 2987 "chuck.tab.c"
     break;
 
-  case 147:
-#line 534 "chuck.y"
-    { (yyval.ival) = ae_op_s_xor_chuck; ;}
+  case 138: /* chuck_operator: DIVIDE_CHUCK  */
+#line 537 "chuck.y"
+                                            { (yyval.ival) = ae_op_divide_chuck; }
+#line 2993 "chuck.tab.c"
     break;
 
-  case 148:
+  case 139: /* chuck_operator: SHIFT_RIGHT_CHUCK  */
 #line 538 "chuck.y"
-    { (yyval.ival) = ae_op_arrow_left; ;}
+                                            { (yyval.ival) = ae_op_shift_right_chuck; }
+#line 2999 "chuck.tab.c"
     break;
 
-  case 149:
+  case 140: /* chuck_operator: SHIFT_LEFT_CHUCK  */
 #line 539 "chuck.y"
-    { (yyval.ival) = ae_op_arrow_right; ;}
+                                            { (yyval.ival) = ae_op_shift_left_chuck; }
+#line 3005 "chuck.tab.c"
     break;
 
-  case 150:
+  case 141: /* chuck_operator: PERCENT_CHUCK  */
 #line 540 "chuck.y"
-    { (yyval.ival) = ae_op_gruck_left; ;}
+                                            { (yyval.ival) = ae_op_percent_chuck; }
+#line 3011 "chuck.tab.c"
     break;
 
-  case 151:
+  case 142: /* chuck_operator: UNCHUCK  */
 #line 541 "chuck.y"
-    { (yyval.ival) = ae_op_gruck_right; ;}
+                                            { (yyval.ival) = ae_op_unchuck; }
+#line 3017 "chuck.tab.c"
     break;
 
-  case 152:
+  case 143: /* chuck_operator: UPCHUCK  */
 #line 542 "chuck.y"
-    { (yyval.ival) = ae_op_ungruck_left; ;}
+                                            { (yyval.ival) = ae_op_upchuck; }
+#line 3023 "chuck.tab.c"
     break;
 
-  case 153:
+  case 144: /* chuck_operator: DOWNCHUCK  */
 #line 543 "chuck.y"
-    { (yyval.ival) = ae_op_ungruck_right; ;}
+                                            { (yyval.ival) = ae_op_downchuck; }
+#line 3029 "chuck.tab.c"
+    break;
+
+  case 145: /* chuck_operator: S_AND_CHUCK  */
+#line 544 "chuck.y"
+                                            { (yyval.ival) = ae_op_s_and_chuck; }
+#line 3035 "chuck.tab.c"
+    break;
+
+  case 146: /* chuck_operator: S_OR_CHUCK  */
+#line 545 "chuck.y"
+                                            { (yyval.ival) = ae_op_s_or_chuck; }
+#line 3041 "chuck.tab.c"
+    break;
+
+  case 147: /* chuck_operator: S_XOR_CHUCK  */
+#line 546 "chuck.y"
+                                            { (yyval.ival) = ae_op_s_xor_chuck; }
+#line 3047 "chuck.tab.c"
+    break;
+
+  case 148: /* arrow_operator: ARROW_LEFT  */
+#line 550 "chuck.y"
+                                            { (yyval.ival) = ae_op_arrow_left; }
+#line 3053 "chuck.tab.c"
     break;
 
-  case 154:
-#line 547 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 149: /* arrow_operator: ARROW_RIGHT  */
+#line 551 "chuck.y"
+                                            { (yyval.ival) = ae_op_arrow_right; }
+#line 3059 "chuck.tab.c"
     break;
 
-  case 155:
-#line 549 "chuck.y"
-    { (yyval.exp) = new_exp_from_if( (yyvsp[(1) - (5)].exp), (yyvsp[(3) - (5)].exp), (yyvsp[(5) - (5)].exp), (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+  case 150: /* arrow_operator: GRUCK_LEFT  */
+#line 552 "chuck.y"
+                                            { (yyval.ival) = ae_op_gruck_left; }
+#line 3065 "chuck.tab.c"
     break;
 
-  case 156:
+  case 151: /* arrow_operator: GRUCK_RIGHT  */
 #line 553 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+                                            { (yyval.ival) = ae_op_gruck_right; }
+#line 3071 "chuck.tab.c"
+    break;
+
+  case 152: /* arrow_operator: UNGRUCK_LEFT  */
+#line 554 "chuck.y"
+                                            { (yyval.ival) = ae_op_ungruck_left; }
+#line 3077 "chuck.tab.c"
     break;
 
-  case 157:
+  case 153: /* arrow_operator: UNGRUCK_RIGHT  */
 #line 555 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_or, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+                                            { (yyval.ival) = ae_op_ungruck_right; }
+#line 3083 "chuck.tab.c"
     break;
 
-  case 158:
+  case 154: /* conditional_expression: logical_or_expression  */
 #line 559 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3089 "chuck.tab.c"
     break;
 
-  case 159:
+  case 155: /* conditional_expression: logical_or_expression QUESTION expression COLON conditional_expression  */
 #line 561 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_and, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_if( (yyvsp[-4].exp), (yyvsp[-2].exp), (yyvsp[0].exp), (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 3095 "chuck.tab.c"
     break;
 
-  case 160:
+  case 156: /* logical_or_expression: logical_and_expression  */
 #line 565 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3101 "chuck.tab.c"
     break;
 
-  case 161:
+  case 157: /* logical_or_expression: logical_or_expression OR logical_and_expression  */
 #line 567 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_s_or, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_or, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3107 "chuck.tab.c"
     break;
 
-  case 162:
+  case 158: /* logical_and_expression: inclusive_or_expression  */
 #line 571 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3113 "chuck.tab.c"
     break;
 
-  case 163:
+  case 159: /* logical_and_expression: logical_and_expression AND inclusive_or_expression  */
 #line 573 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_s_xor, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_and, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3119 "chuck.tab.c"
     break;
 
-  case 164:
+  case 160: /* inclusive_or_expression: exclusive_or_expression  */
 #line 577 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3125 "chuck.tab.c"
     break;
 
-  case 165:
+  case 161: /* inclusive_or_expression: inclusive_or_expression S_OR exclusive_or_expression  */
 #line 579 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_s_and, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_s_or, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3131 "chuck.tab.c"
     break;
 
-  case 166:
+  case 162: /* exclusive_or_expression: and_expression  */
 #line 583 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3137 "chuck.tab.c"
     break;
 
-  case 167:
+  case 163: /* exclusive_or_expression: exclusive_or_expression S_XOR and_expression  */
 #line 585 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_eq, (yyvsp[(3) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_s_xor, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3143 "chuck.tab.c"
     break;
 
-  case 168:
-#line 587 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_neq, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+  case 164: /* and_expression: equality_expression  */
+#line 589 "chuck.y"
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3149 "chuck.tab.c"
     break;
 
-  case 169:
+  case 165: /* and_expression: and_expression S_AND equality_expression  */
 #line 591 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
-    break;
-
-  case 170:
-#line 593 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_lt, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_s_and, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3155 "chuck.tab.c"
     break;
 
-  case 171:
+  case 166: /* equality_expression: relational_expression  */
 #line 595 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_gt, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3161 "chuck.tab.c"
     break;
 
-  case 172:
+  case 167: /* equality_expression: equality_expression EQ relational_expression  */
 #line 597 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_le, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_eq, (yyvsp[0].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 3167 "chuck.tab.c"
     break;
 
-  case 173:
+  case 168: /* equality_expression: equality_expression NEQ relational_expression  */
 #line 599 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_ge, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_neq, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3173 "chuck.tab.c"
     break;
 
-  case 174:
+  case 169: /* relational_expression: shift_expression  */
 #line 603 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3179 "chuck.tab.c"
     break;
 
-  case 175:
+  case 170: /* relational_expression: relational_expression LT shift_expression  */
 #line 605 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_shift_left, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_lt, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3185 "chuck.tab.c"
     break;
 
-  case 176:
+  case 171: /* relational_expression: relational_expression GT shift_expression  */
 #line 607 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_shift_right, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_gt, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3191 "chuck.tab.c"
     break;
 
-  case 177:
-#line 611 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 172: /* relational_expression: relational_expression LE shift_expression  */
+#line 609 "chuck.y"
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_le, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3197 "chuck.tab.c"
     break;
 
-  case 178:
-#line 613 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_plus, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+  case 173: /* relational_expression: relational_expression GE shift_expression  */
+#line 611 "chuck.y"
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_ge, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3203 "chuck.tab.c"
     break;
 
-  case 179:
+  case 174: /* shift_expression: additive_expression  */
 #line 615 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_minus, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3209 "chuck.tab.c"
     break;
 
-  case 180:
-#line 619 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 175: /* shift_expression: shift_expression SHIFT_LEFT additive_expression  */
+#line 617 "chuck.y"
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_shift_left, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3215 "chuck.tab.c"
     break;
 
-  case 181:
-#line 621 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_times, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+  case 176: /* shift_expression: shift_expression SHIFT_RIGHT additive_expression  */
+#line 619 "chuck.y"
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_shift_right, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3221 "chuck.tab.c"
     break;
 
-  case 182:
+  case 177: /* additive_expression: multiplicative_expression  */
 #line 623 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_divide, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+                                             { (yyval.exp) = (yyvsp[0].exp); }
+#line 3227 "chuck.tab.c"
     break;
 
-  case 183:
+  case 178: /* additive_expression: additive_expression PLUS multiplicative_expression  */
 #line 625 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_percent, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_plus, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3233 "chuck.tab.c"
     break;
 
-  case 184:
-#line 629 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 179: /* additive_expression: additive_expression MINUS multiplicative_expression  */
+#line 627 "chuck.y"
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_minus, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3239 "chuck.tab.c"
     break;
 
-  case 185:
+  case 180: /* multiplicative_expression: tilda_expression  */
 #line 631 "chuck.y"
-    { (yyval.exp) = new_exp_from_binary( (yyvsp[(1) - (3)].exp), ae_op_tilda, (yyvsp[(3) - (3)].exp), (yylsp[(2) - (3)]).first_line, (yylsp[(2) - (3)]).first_column ); ;}
+                                             { (yyval.exp) = (yyvsp[0].exp); }
+#line 3245 "chuck.tab.c"
+    break;
+
+  case 181: /* multiplicative_expression: multiplicative_expression TIMES tilda_expression  */
+#line 633 "chuck.y"
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_times, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3251 "chuck.tab.c"
     break;
 
-  case 186:
+  case 182: /* multiplicative_expression: multiplicative_expression DIVIDE tilda_expression  */
 #line 635 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_divide, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3257 "chuck.tab.c"
     break;
 
-  case 187:
+  case 183: /* multiplicative_expression: multiplicative_expression PERCENT tilda_expression  */
 #line 637 "chuck.y"
-    { (yyval.exp) = new_exp_from_cast( (yyvsp[(3) - (3)].type_decl), (yyvsp[(1) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column, (yylsp[(2) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_percent, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3263 "chuck.tab.c"
     break;
 
-  case 188:
+  case 184: /* tilda_expression: cast_expression  */
 #line 641 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3269 "chuck.tab.c"
     break;
 
-  case 189:
+  case 185: /* tilda_expression: tilda_expression TILDA cast_expression  */
 #line 643 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary( ae_op_plusplus, (yyvsp[(2) - (2)].exp), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
-    break;
-
-  case 190:
-#line 645 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary( ae_op_minusminus, (yyvsp[(2) - (2)].exp), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_binary( (yyvsp[-2].exp), ae_op_tilda, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3275 "chuck.tab.c"
     break;
 
-  case 191:
+  case 186: /* cast_expression: unary_expression  */
 #line 647 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary( (yyvsp[(1) - (2)].ival), (yyvsp[(2) - (2)].exp), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3281 "chuck.tab.c"
     break;
 
-  case 192:
+  case 187: /* cast_expression: cast_expression DOLLAR type_decl  */
 #line 649 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary( ae_op_typeof, (yyvsp[(2) - (2)].exp), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
-    break;
-
-  case 193:
-#line 651 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary( ae_op_sizeof, (yyvsp[(2) - (2)].exp), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_cast( (yyvsp[0].type_decl), (yyvsp[-2].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column, (yylsp[-1]).first_column ); }
+#line 3287 "chuck.tab.c"
     break;
 
-  case 194:
+  case 188: /* unary_expression: dur_expression  */
 #line 653 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[(2) - (2)].type_decl), FALSE, NULL, NULL, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3293 "chuck.tab.c"
     break;
 
-  case 195:
+  case 189: /* unary_expression: PLUSPLUS unary_expression  */
 #line 655 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[(2) - (3)].type_decl), FALSE, NULL, (yyvsp[(3) - (3)].array_sub), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_unary( ae_op_plusplus, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3299 "chuck.tab.c"
     break;
 
-  case 196:
+  case 190: /* unary_expression: MINUSMINUS unary_expression  */
 #line 657 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[(2) - (4)].type_decl), TRUE, NULL, NULL, (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_unary( ae_op_minusminus, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3305 "chuck.tab.c"
     break;
 
-  case 197:
+  case 191: /* unary_expression: unary_operator unary_expression  */
 #line 659 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[(2) - (5)].type_decl), TRUE, (yyvsp[(4) - (5)].exp), NULL, (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_unary( (yyvsp[-1].ival), (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3311 "chuck.tab.c"
     break;
 
-  case 198:
+  case 192: /* unary_expression: TYPEOF unary_expression  */
 #line 661 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[(2) - (5)].type_decl), TRUE, NULL, (yyvsp[(5) - (5)].array_sub), (yylsp[(1) - (5)]).first_line, (yylsp[(1) - (5)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_unary( ae_op_typeof, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3317 "chuck.tab.c"
     break;
 
-  case 199:
+  case 193: /* unary_expression: SIZEOF unary_expression  */
 #line 663 "chuck.y"
-    { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[(2) - (6)].type_decl), TRUE, (yyvsp[(4) - (6)].exp), (yyvsp[(6) - (6)].array_sub), (yylsp[(1) - (6)]).first_line, (yylsp[(1) - (6)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_unary( ae_op_sizeof, (yyvsp[0].exp), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3323 "chuck.tab.c"
     break;
 
-  case 200:
-#line 669 "chuck.y"
-    { (yyval.ival) = ae_op_plus; ;}
+  case 194: /* unary_expression: NEW type_decl  */
+#line 665 "chuck.y"
+            { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[0].type_decl), FALSE, NULL, NULL, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3329 "chuck.tab.c"
     break;
 
-  case 201:
-#line 670 "chuck.y"
-    { (yyval.ival) = ae_op_minus; ;}
+  case 195: /* unary_expression: NEW type_decl array_exp  */
+#line 667 "chuck.y"
+            { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[-1].type_decl), FALSE, NULL, (yyvsp[0].array_sub), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 3335 "chuck.tab.c"
     break;
 
-  case 202:
-#line 671 "chuck.y"
-    { (yyval.ival) = ae_op_tilda; ;}
+  case 196: /* unary_expression: NEW type_decl LPAREN RPAREN  */
+#line 669 "chuck.y"
+            { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[-2].type_decl), TRUE, NULL, NULL, (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 3341 "chuck.tab.c"
     break;
 
-  case 203:
-#line 672 "chuck.y"
-    { (yyval.ival) = ae_op_exclamation; ;}
+  case 197: /* unary_expression: NEW type_decl LPAREN expression RPAREN  */
+#line 671 "chuck.y"
+            { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[-3].type_decl), TRUE, (yyvsp[-1].exp), NULL, (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 3347 "chuck.tab.c"
     break;
 
-  case 204:
+  case 198: /* unary_expression: NEW type_decl LPAREN RPAREN array_exp  */
 #line 673 "chuck.y"
-    { (yyval.ival) = ae_op_times; ;}
-    break;
-
-  case 205:
-#line 674 "chuck.y"
-    { (yyval.ival) = ae_op_spork; ;}
+            { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[-3].type_decl), TRUE, NULL, (yyvsp[0].array_sub), (yylsp[-4]).first_line, (yylsp[-4]).first_column ); }
+#line 3353 "chuck.tab.c"
     break;
 
-  case 206:
+  case 199: /* unary_expression: NEW type_decl LPAREN expression RPAREN array_exp  */
 #line 675 "chuck.y"
-    { (yyval.ival) = ae_op_downchuck; ;}
+            { (yyval.exp) = new_exp_from_unary2( ae_op_new, (yyvsp[-4].type_decl), TRUE, (yyvsp[-2].exp), (yyvsp[0].array_sub), (yylsp[-5]).first_line, (yylsp[-5]).first_column ); }
+#line 3359 "chuck.tab.c"
     break;
 
-  case 207:
+  case 200: /* unary_operator: PLUS  */
 #line 681 "chuck.y"
-    { (yyval.ival) = ae_op_chuck; ;}
+                                            { (yyval.ival) = ae_op_plus; }
+#line 3365 "chuck.tab.c"
     break;
 
-  case 208:
+  case 201: /* unary_operator: MINUS  */
 #line 682 "chuck.y"
-    { (yyval.ival) = ae_op_plus; ;}
+                                            { (yyval.ival) = ae_op_minus; }
+#line 3371 "chuck.tab.c"
     break;
 
-  case 209:
+  case 202: /* unary_operator: TILDA  */
 #line 683 "chuck.y"
-    { (yyval.ival) = ae_op_minus; ;}
+                                            { (yyval.ival) = ae_op_tilda; }
+#line 3377 "chuck.tab.c"
     break;
 
-  case 210:
+  case 203: /* unary_operator: EXCLAMATION  */
 #line 684 "chuck.y"
-    { (yyval.ival) = ae_op_times; ;}
+                                            { (yyval.ival) = ae_op_exclamation; }
+#line 3383 "chuck.tab.c"
     break;
 
-  case 211:
+  case 204: /* unary_operator: TIMES  */
 #line 685 "chuck.y"
-    { (yyval.ival) = ae_op_divide; ;}
+                                            { (yyval.ival) = ae_op_times; }
+#line 3389 "chuck.tab.c"
     break;
 
-  case 212:
+  case 205: /* unary_operator: SPORK TILDA  */
 #line 686 "chuck.y"
-    { (yyval.ival) = ae_op_percent; ;}
+                                            { (yyval.ival) = ae_op_spork; }
+#line 3395 "chuck.tab.c"
     break;
 
-  case 213:
+  case 206: /* unary_operator: DOWNCHUCK  */
 #line 687 "chuck.y"
-    { (yyval.ival) = ae_op_eq; ;}
-    break;
-
-  case 214:
-#line 688 "chuck.y"
-    { (yyval.ival) = ae_op_neq; ;}
-    break;
-
-  case 215:
-#line 689 "chuck.y"
-    { (yyval.ival) = ae_op_lt; ;}
-    break;
-
-  case 216:
-#line 690 "chuck.y"
-    { (yyval.ival) = ae_op_le; ;}
-    break;
-
-  case 217:
-#line 691 "chuck.y"
-    { (yyval.ival) = ae_op_gt; ;}
-    break;
-
-  case 218:
-#line 692 "chuck.y"
-    { (yyval.ival) = ae_op_ge; ;}
+                                            { (yyval.ival) = ae_op_downchuck; }
+#line 3401 "chuck.tab.c"
     break;
 
-  case 219:
+  case 207: /* overloadable_operator: CHUCK  */
 #line 693 "chuck.y"
-    { (yyval.ival) = ae_op_and; ;}
+                                            { (yyval.ival) = ae_op_chuck; }
+#line 3407 "chuck.tab.c"
     break;
 
-  case 220:
+  case 208: /* overloadable_operator: PLUS  */
 #line 694 "chuck.y"
-    { (yyval.ival) = ae_op_or; ;}
+                                            { (yyval.ival) = ae_op_plus; }
+#line 3413 "chuck.tab.c"
     break;
 
-  case 221:
+  case 209: /* overloadable_operator: MINUS  */
 #line 695 "chuck.y"
-    { (yyval.ival) = ae_op_assign; ;}
+                                            { (yyval.ival) = ae_op_minus; }
+#line 3419 "chuck.tab.c"
     break;
 
-  case 222:
+  case 210: /* overloadable_operator: TIMES  */
 #line 696 "chuck.y"
-    { (yyval.ival) = ae_op_exclamation; ;}
+                                            { (yyval.ival) = ae_op_times; }
+#line 3425 "chuck.tab.c"
     break;
 
-  case 223:
+  case 211: /* overloadable_operator: DIVIDE  */
 #line 697 "chuck.y"
-    { (yyval.ival) = ae_op_s_or; ;}
+                                            { (yyval.ival) = ae_op_divide; }
+#line 3431 "chuck.tab.c"
     break;
 
-  case 224:
+  case 212: /* overloadable_operator: PERCENT  */
 #line 698 "chuck.y"
-    { (yyval.ival) = ae_op_s_and; ;}
+                                            { (yyval.ival) = ae_op_percent; }
+#line 3437 "chuck.tab.c"
     break;
 
-  case 225:
+  case 213: /* overloadable_operator: EQ  */
 #line 699 "chuck.y"
-    { (yyval.ival) = ae_op_s_xor; ;}
+                                            { (yyval.ival) = ae_op_eq; }
+#line 3443 "chuck.tab.c"
     break;
 
-  case 226:
+  case 214: /* overloadable_operator: NEQ  */
 #line 700 "chuck.y"
-    { (yyval.ival) = ae_op_plusplus; ;}
+                                            { (yyval.ival) = ae_op_neq; }
+#line 3449 "chuck.tab.c"
     break;
 
-  case 227:
+  case 215: /* overloadable_operator: LT  */
 #line 701 "chuck.y"
-    { (yyval.ival) = ae_op_minusminus; ;}
+                                            { (yyval.ival) = ae_op_lt; }
+#line 3455 "chuck.tab.c"
     break;
 
-  case 228:
+  case 216: /* overloadable_operator: LE  */
 #line 702 "chuck.y"
-    { (yyval.ival) = ae_op_dollar; ;}
+                                            { (yyval.ival) = ae_op_le; }
+#line 3461 "chuck.tab.c"
     break;
 
-  case 229:
+  case 217: /* overloadable_operator: GT  */
 #line 703 "chuck.y"
-    { (yyval.ival) = ae_op_at_at; ;}
+                                            { (yyval.ival) = ae_op_gt; }
+#line 3467 "chuck.tab.c"
     break;
 
-  case 230:
+  case 218: /* overloadable_operator: GE  */
 #line 704 "chuck.y"
-    { (yyval.ival) = ae_op_plus_chuck; ;}
+                                            { (yyval.ival) = ae_op_ge; }
+#line 3473 "chuck.tab.c"
     break;
 
-  case 231:
+  case 219: /* overloadable_operator: AND  */
 #line 705 "chuck.y"
-    { (yyval.ival) = ae_op_minus_chuck; ;}
+                                            { (yyval.ival) = ae_op_and; }
+#line 3479 "chuck.tab.c"
     break;
 
-  case 232:
+  case 220: /* overloadable_operator: OR  */
 #line 706 "chuck.y"
-    { (yyval.ival) = ae_op_times_chuck; ;}
+                                            { (yyval.ival) = ae_op_or; }
+#line 3485 "chuck.tab.c"
     break;
 
-  case 233:
+  case 221: /* overloadable_operator: ASSIGN  */
 #line 707 "chuck.y"
-    { (yyval.ival) = ae_op_divide_chuck; ;}
+                                            { (yyval.ival) = ae_op_assign; }
+#line 3491 "chuck.tab.c"
     break;
 
-  case 234:
+  case 222: /* overloadable_operator: EXCLAMATION  */
 #line 708 "chuck.y"
-    { (yyval.ival) = ae_op_s_and_chuck; ;}
+                                            { (yyval.ival) = ae_op_exclamation; }
+#line 3497 "chuck.tab.c"
     break;
 
-  case 235:
+  case 223: /* overloadable_operator: S_OR  */
 #line 709 "chuck.y"
-    { (yyval.ival) = ae_op_s_or_chuck; ;}
+                                            { (yyval.ival) = ae_op_s_or; }
+#line 3503 "chuck.tab.c"
     break;
 
-  case 236:
+  case 224: /* overloadable_operator: S_AND  */
 #line 710 "chuck.y"
-    { (yyval.ival) = ae_op_s_xor_chuck; ;}
+                                            { (yyval.ival) = ae_op_s_and; }
+#line 3509 "chuck.tab.c"
     break;
 
-  case 237:
+  case 225: /* overloadable_operator: S_XOR  */
 #line 711 "chuck.y"
-    { (yyval.ival) = ae_op_shift_right_chuck; ;}
+                                            { (yyval.ival) = ae_op_s_xor; }
+#line 3515 "chuck.tab.c"
     break;
 
-  case 238:
+  case 226: /* overloadable_operator: PLUSPLUS  */
 #line 712 "chuck.y"
-    { (yyval.ival) = ae_op_shift_left_chuck; ;}
+                                            { (yyval.ival) = ae_op_plusplus; }
+#line 3521 "chuck.tab.c"
     break;
 
-  case 239:
+  case 227: /* overloadable_operator: MINUSMINUS  */
 #line 713 "chuck.y"
-    { (yyval.ival) = ae_op_percent_chuck; ;}
+                                            { (yyval.ival) = ae_op_minusminus; }
+#line 3527 "chuck.tab.c"
     break;
 
-  case 240:
+  case 228: /* overloadable_operator: DOLLAR  */
 #line 714 "chuck.y"
-    { (yyval.ival) = ae_op_shift_right; ;}
+                                            { (yyval.ival) = ae_op_dollar; }
+#line 3533 "chuck.tab.c"
     break;
 
-  case 241:
+  case 229: /* overloadable_operator: ATAT_SYM  */
 #line 715 "chuck.y"
-    { (yyval.ival) = ae_op_shift_left; ;}
+                                            { (yyval.ival) = ae_op_at_at; }
+#line 3539 "chuck.tab.c"
     break;
 
-  case 242:
+  case 230: /* overloadable_operator: PLUS_CHUCK  */
 #line 716 "chuck.y"
-    { (yyval.ival) = ae_op_tilda; ;}
+                                            { (yyval.ival) = ae_op_plus_chuck; }
+#line 3545 "chuck.tab.c"
     break;
 
-  case 243:
+  case 231: /* overloadable_operator: MINUS_CHUCK  */
 #line 717 "chuck.y"
-    { (yyval.ival) = ae_op_coloncolon; ;}
+                                            { (yyval.ival) = ae_op_minus_chuck; }
+#line 3551 "chuck.tab.c"
     break;
 
-  case 244:
+  case 232: /* overloadable_operator: TIMES_CHUCK  */
 #line 718 "chuck.y"
-    { (yyval.ival) = ae_op_at_chuck; ;}
+                                            { (yyval.ival) = ae_op_times_chuck; }
+#line 3557 "chuck.tab.c"
     break;
 
-  case 245:
+  case 233: /* overloadable_operator: DIVIDE_CHUCK  */
 #line 719 "chuck.y"
-    { (yyval.ival) = ae_op_unchuck; ;}
+                                            { (yyval.ival) = ae_op_divide_chuck; }
+#line 3563 "chuck.tab.c"
     break;
 
-  case 246:
+  case 234: /* overloadable_operator: S_AND_CHUCK  */
 #line 720 "chuck.y"
-    { (yyval.ival) = ae_op_upchuck; ;}
+                                            { (yyval.ival) = ae_op_s_and_chuck; }
+#line 3569 "chuck.tab.c"
     break;
 
-  case 247:
+  case 235: /* overloadable_operator: S_OR_CHUCK  */
 #line 721 "chuck.y"
-    { (yyval.ival) = ae_op_downchuck; ;}
+                                            { (yyval.ival) = ae_op_s_or_chuck; }
+#line 3575 "chuck.tab.c"
     break;
 
-  case 248:
+  case 236: /* overloadable_operator: S_XOR_CHUCK  */
 #line 722 "chuck.y"
-    { (yyval.ival) = ae_op_arrow_right; ;}
+                                            { (yyval.ival) = ae_op_s_xor_chuck; }
+#line 3581 "chuck.tab.c"
     break;
 
-  case 249:
+  case 237: /* overloadable_operator: SHIFT_RIGHT_CHUCK  */
 #line 723 "chuck.y"
-    { (yyval.ival) = ae_op_arrow_left; ;}
+                                            { (yyval.ival) = ae_op_shift_right_chuck; }
+#line 3587 "chuck.tab.c"
     break;
 
-  case 250:
+  case 238: /* overloadable_operator: SHIFT_LEFT_CHUCK  */
 #line 724 "chuck.y"
-    { (yyval.ival) = ae_op_gruck_right; ;}
+                                            { (yyval.ival) = ae_op_shift_left_chuck; }
+#line 3593 "chuck.tab.c"
     break;
 
-  case 251:
+  case 239: /* overloadable_operator: PERCENT_CHUCK  */
 #line 725 "chuck.y"
-    { (yyval.ival) = ae_op_gruck_left; ;}
+                                            { (yyval.ival) = ae_op_percent_chuck; }
+#line 3599 "chuck.tab.c"
     break;
 
-  case 252:
+  case 240: /* overloadable_operator: SHIFT_RIGHT  */
 #line 726 "chuck.y"
-    { (yyval.ival) = ae_op_ungruck_right; ;}
+                                            { (yyval.ival) = ae_op_shift_right; }
+#line 3605 "chuck.tab.c"
     break;
 
-  case 253:
+  case 241: /* overloadable_operator: SHIFT_LEFT  */
 #line 727 "chuck.y"
-    { (yyval.ival) = ae_op_ungruck_left; ;}
+                                            { (yyval.ival) = ae_op_shift_left; }
+#line 3611 "chuck.tab.c"
+    break;
+
+  case 242: /* overloadable_operator: TILDA  */
+#line 728 "chuck.y"
+                                            { (yyval.ival) = ae_op_tilda; }
+#line 3617 "chuck.tab.c"
+    break;
+
+  case 243: /* overloadable_operator: COLONCOLON  */
+#line 729 "chuck.y"
+                                            { (yyval.ival) = ae_op_coloncolon; }
+#line 3623 "chuck.tab.c"
+    break;
+
+  case 244: /* overloadable_operator: AT_CHUCK  */
+#line 730 "chuck.y"
+                                            { (yyval.ival) = ae_op_at_chuck; }
+#line 3629 "chuck.tab.c"
+    break;
+
+  case 245: /* overloadable_operator: UNCHUCK  */
+#line 731 "chuck.y"
+                                            { (yyval.ival) = ae_op_unchuck; }
+#line 3635 "chuck.tab.c"
+    break;
+
+  case 246: /* overloadable_operator: UPCHUCK  */
+#line 732 "chuck.y"
+                                            { (yyval.ival) = ae_op_upchuck; }
+#line 3641 "chuck.tab.c"
     break;
 
-  case 255:
+  case 247: /* overloadable_operator: DOWNCHUCK  */
 #line 733 "chuck.y"
-    { (yyval.exp) = new_exp_from_dur( (yyvsp[(1) - (3)].exp), (yyvsp[(3) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+                                            { (yyval.ival) = ae_op_downchuck; }
+#line 3647 "chuck.tab.c"
     break;
 
-  case 256:
-#line 737 "chuck.y"
-    { (yyval.exp) = (yyvsp[(1) - (1)].exp); ;}
+  case 248: /* overloadable_operator: ARROW_RIGHT  */
+#line 734 "chuck.y"
+                                            { (yyval.ival) = ae_op_arrow_right; }
+#line 3653 "chuck.tab.c"
     break;
 
-  case 257:
-#line 739 "chuck.y"
-    { (yyval.exp) = new_exp_from_array( (yyvsp[(1) - (2)].exp), (yyvsp[(2) - (2)].array_sub), (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 249: /* overloadable_operator: ARROW_LEFT  */
+#line 735 "chuck.y"
+                                            { (yyval.ival) = ae_op_arrow_left; }
+#line 3659 "chuck.tab.c"
+    break;
+
+  case 250: /* overloadable_operator: GRUCK_RIGHT  */
+#line 736 "chuck.y"
+                                            { (yyval.ival) = ae_op_gruck_right; }
+#line 3665 "chuck.tab.c"
     break;
 
-  case 258:
-#line 741 "chuck.y"
-    { (yyval.exp) = new_exp_from_func_call( (yyvsp[(1) - (3)].exp), NULL, (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 251: /* overloadable_operator: GRUCK_LEFT  */
+#line 737 "chuck.y"
+                                            { (yyval.ival) = ae_op_gruck_left; }
+#line 3671 "chuck.tab.c"
     break;
 
-  case 259:
-#line 743 "chuck.y"
-    { (yyval.exp) = new_exp_from_func_call( (yyvsp[(1) - (4)].exp), (yyvsp[(3) - (4)].exp), (yylsp[(1) - (4)]).first_line, (yylsp[(1) - (4)]).first_column ); ;}
+  case 252: /* overloadable_operator: UNGRUCK_RIGHT  */
+#line 738 "chuck.y"
+                                            { (yyval.ival) = ae_op_ungruck_right; }
+#line 3677 "chuck.tab.c"
     break;
 
-  case 260:
-#line 745 "chuck.y"
-    { (yyval.exp) = new_exp_from_member_dot( (yyvsp[(1) - (3)].exp), (yyvsp[(3) - (3)].sval), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column, (yylsp[(3) - (3)]).first_column ); ;}
+  case 253: /* overloadable_operator: UNGRUCK_LEFT  */
+#line 739 "chuck.y"
+                                            { (yyval.ival) = ae_op_ungruck_left; }
+#line 3683 "chuck.tab.c"
     break;
 
-  case 261:
-#line 747 "chuck.y"
-    { (yyval.exp) = new_exp_from_postfix( (yyvsp[(1) - (2)].exp), ae_op_plusplus, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 255: /* dur_expression: dur_expression COLONCOLON postfix_expression  */
+#line 745 "chuck.y"
+            { (yyval.exp) = new_exp_from_dur( (yyvsp[-2].exp), (yyvsp[0].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 3689 "chuck.tab.c"
     break;
 
-  case 262:
+  case 256: /* postfix_expression: primary_expression  */
 #line 749 "chuck.y"
-    { (yyval.exp) = new_exp_from_postfix( (yyvsp[(1) - (2)].exp), ae_op_minusminus, (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+                                            { (yyval.exp) = (yyvsp[0].exp); }
+#line 3695 "chuck.tab.c"
     break;
 
-  case 263:
-#line 754 "chuck.y"
-    { (yyval.exp) = new_exp_from_id( (yyvsp[(1) - (1)].sval), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 257: /* postfix_expression: postfix_expression array_exp  */
+#line 751 "chuck.y"
+            { (yyval.exp) = new_exp_from_array( (yyvsp[-1].exp), (yyvsp[0].array_sub), (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3701 "chuck.tab.c"
     break;
 
-  case 264:
-#line 755 "chuck.y"
-    { (yyval.exp) = new_exp_from_int( (yyvsp[(1) - (1)].ival), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 258: /* postfix_expression: postfix_expression LPAREN RPAREN  */
+#line 753 "chuck.y"
+            { (yyval.exp) = new_exp_from_func_call( (yyvsp[-2].exp), NULL, (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 3707 "chuck.tab.c"
     break;
 
-  case 265:
-#line 756 "chuck.y"
-    { (yyval.exp) = new_exp_from_float( (yyvsp[(1) - (1)].fval), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 259: /* postfix_expression: postfix_expression LPAREN expression RPAREN  */
+#line 755 "chuck.y"
+            { (yyval.exp) = new_exp_from_func_call( (yyvsp[-3].exp), (yyvsp[-1].exp), (yylsp[-3]).first_line, (yylsp[-3]).first_column ); }
+#line 3713 "chuck.tab.c"
     break;
 
-  case 266:
+  case 260: /* postfix_expression: postfix_expression DOT ID  */
 #line 757 "chuck.y"
-    { (yyval.exp) = new_exp_from_str( (yyvsp[(1) - (1)].sval), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+            { (yyval.exp) = new_exp_from_member_dot( (yyvsp[-2].exp), (yyvsp[0].sval), (yylsp[-2]).first_line, (yylsp[-2]).first_column, (yylsp[0]).first_column ); }
+#line 3719 "chuck.tab.c"
     break;
 
-  case 267:
-#line 758 "chuck.y"
-    { (yyval.exp) = new_exp_from_char( (yyvsp[(1) - (1)].sval), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 261: /* postfix_expression: postfix_expression PLUSPLUS  */
+#line 759 "chuck.y"
+            { (yyval.exp) = new_exp_from_postfix( (yyvsp[-1].exp), ae_op_plusplus, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3725 "chuck.tab.c"
     break;
 
-  case 268:
-#line 759 "chuck.y"
-    { (yyval.exp) = new_exp_from_array_lit( (yyvsp[(1) - (1)].array_sub), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 262: /* postfix_expression: postfix_expression MINUSMINUS  */
+#line 761 "chuck.y"
+            { (yyval.exp) = new_exp_from_postfix( (yyvsp[-1].exp), ae_op_minusminus, (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3731 "chuck.tab.c"
     break;
 
-  case 269:
-#line 760 "chuck.y"
-    { (yyval.exp) = new_exp_from_complex( (yyvsp[(1) - (1)].complex_exp), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 263: /* primary_expression: ID  */
+#line 766 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_id( (yyvsp[0].sval), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3737 "chuck.tab.c"
     break;
 
-  case 270:
-#line 761 "chuck.y"
-    { (yyval.exp) = new_exp_from_polar( (yyvsp[(1) - (1)].polar_exp), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 264: /* primary_expression: INT_VAL  */
+#line 767 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_int( (yyvsp[0].ival), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3743 "chuck.tab.c"
+    break;
+
+  case 265: /* primary_expression: FLOAT_VAL  */
+#line 768 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_float( (yyvsp[0].fval), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3749 "chuck.tab.c"
+    break;
+
+  case 266: /* primary_expression: STRING_LIT  */
+#line 769 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_str( (yyvsp[0].sval), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3755 "chuck.tab.c"
+    break;
+
+  case 267: /* primary_expression: CHAR_LIT  */
+#line 770 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_char( (yyvsp[0].sval), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3761 "chuck.tab.c"
+    break;
+
+  case 268: /* primary_expression: array_exp  */
+#line 771 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_array_lit( (yyvsp[0].array_sub), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3767 "chuck.tab.c"
+    break;
+
+  case 269: /* primary_expression: complex_exp  */
+#line 772 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_complex( (yyvsp[0].complex_exp), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3773 "chuck.tab.c"
+    break;
+
+  case 270: /* primary_expression: polar_exp  */
+#line 773 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_polar( (yyvsp[0].polar_exp), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3779 "chuck.tab.c"
     break;
 
-  case 271:
-#line 762 "chuck.y"
-    { (yyval.exp) = new_exp_from_vec( (yyvsp[(1) - (1)].vec_exp), (yylsp[(1) - (1)]).first_line, (yylsp[(1) - (1)]).first_column ); ;}
+  case 271: /* primary_expression: vec_exp  */
+#line 774 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_vec( (yyvsp[0].vec_exp), (yylsp[0]).first_line, (yylsp[0]).first_column ); }
+#line 3785 "chuck.tab.c"
     break;
 
-  case 272:
-#line 763 "chuck.y"
-    { (yyval.exp) = new_exp_from_hack( (yyvsp[(2) - (3)].exp), (yylsp[(1) - (3)]).first_line, (yylsp[(1) - (3)]).first_column ); ;}
+  case 272: /* primary_expression: L_HACK expression R_HACK  */
+#line 775 "chuck.y"
+                                            { (yyval.exp) = new_exp_from_hack( (yyvsp[-1].exp), (yylsp[-2]).first_line, (yylsp[-2]).first_column ); }
+#line 3791 "chuck.tab.c"
     break;
 
-  case 273:
-#line 764 "chuck.y"
-    { (yyval.exp) = (yyvsp[(2) - (3)].exp); ;}
+  case 273: /* primary_expression: LPAREN expression RPAREN  */
+#line 776 "chuck.y"
+                                            { (yyval.exp) = (yyvsp[-1].exp); }
+#line 3797 "chuck.tab.c"
     break;
 
-  case 274:
-#line 765 "chuck.y"
-    { (yyval.exp) = new_exp_from_nil( (yylsp[(1) - (2)]).first_line, (yylsp[(1) - (2)]).first_column ); ;}
+  case 274: /* primary_expression: LPAREN RPAREN  */
+#line 777 "chuck.y"
+                                                    { (yyval.exp) = new_exp_from_nil( (yylsp[-1]).first_line, (yylsp[-1]).first_column ); }
+#line 3803 "chuck.tab.c"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 3893 "chuck.tab.c"
+#line 3807 "chuck.tab.c"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
+      yyerror (&yylloc, scanner, YY_("syntax error"));
     }
 
-  yyerror_range[0] = yylloc;
-
+  yyerror_range[1] = yylloc;
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, &yylloc);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, scanner);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -3991,15 +3883,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  yyerror_range[0] = yylsp[1-yylen];
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -4012,47 +3902,45 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
-      yyerror_range[0] = *yylsp;
+      yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, scanner);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
-  yyerror_range[1] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the look-ahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, (yyerror_range - 1), 2);
-  *++yylsp = yyloc;
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4063,52 +3951,55 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (&yylloc, scanner, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval, &yylloc);
-  /* Do not reclaim the symbols of the rule which action triggered
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, scanner);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, scanner);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
-
 
+  return yyresult;
+}
 
 #line 1 "chuck.yy.c"
 
@@ -4224,21 +4115,38 @@ typedef unsigned int flex_uint32_t;
  */
 #define YY_SC_TO_UI(c) ((YY_CHAR) (c))
 
+/* An opaque pointer. */
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+
+/* For convenience, these vars (plus the bison vars far below)
+   are macros in the reentrant scanner. */
+#define yyin yyg->yyin_r
+#define yyout yyg->yyout_r
+#define yyextra yyg->yyextra_r
+#define yyleng yyg->yyleng_r
+#define yytext yyg->yytext_r
+#define yylineno (YY_CURRENT_BUFFER_LVALUE->yy_bs_lineno)
+#define yycolumn (YY_CURRENT_BUFFER_LVALUE->yy_bs_column)
+#define yy_flex_debug yyg->yy_flex_debug_r
+
 /* Enter a start condition.  This macro really ought to take a parameter,
  * but we do it the disgusting crufty way forced on us by the ()-less
  * definition of BEGIN.
  */
-#define BEGIN (yy_start) = 1 + 2 *
+#define BEGIN yyg->yy_start = 1 + 2 *
 /* Translate the current start state into a value that can be later handed
  * to BEGIN to return to the state.  The YYSTATE alias is for lex
  * compatibility.
  */
-#define YY_START (((yy_start) - 1) / 2)
+#define YY_START ((yyg->yy_start - 1) / 2)
 #define YYSTATE YY_START
 /* Action number for EOF rule of a given start state. */
 #define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
 /* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart( yyin  )
+#define YY_NEW_FILE yyrestart( yyin , yyscanner )
 #define YY_END_OF_BUFFER_CHAR 0
 
 /* Size of default input buffer. */
@@ -4268,10 +4176,6 @@ typedef struct yy_buffer_state *YY_BUFFER_STATE;
 typedef size_t yy_size_t;
 #endif
 
-extern yy_size_t yyleng;
-
-extern FILE *yyin, *yyout;
-
 #define EOB_ACT_CONTINUE_SCAN 0
 #define EOB_ACT_END_OF_FILE 1
 #define EOB_ACT_LAST_MATCH 2
@@ -4305,13 +4209,13 @@ extern FILE *yyin, *yyout;
 		/* Undo effects of setting up yytext. */ \
         int yyless_macro_arg = (n); \
         YY_LESS_LINENO(yyless_macro_arg);\
-		*yy_cp = (yy_hold_char); \
+		*yy_cp = yyg->yy_hold_char; \
 		YY_RESTORE_YY_MORE_OFFSET \
-		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
+		yyg->yy_c_buf_p = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
 		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
 		} \
 	while ( 0 )
-#define unput(c) yyunput( c, (yytext_ptr)  )
+#define unput(c) yyunput( c, yyg->yytext_ptr , yyscanner )
 
 #ifndef YY_STRUCT_YY_BUFFER_STATE
 #define YY_STRUCT_YY_BUFFER_STATE
@@ -4378,77 +4282,57 @@ struct yy_buffer_state
 	};
 #endif /* !YY_STRUCT_YY_BUFFER_STATE */
 
-/* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = NULL; /**< Stack as an array. */
-
 /* We provide macros for accessing buffer states in case in the
  * future we want to put the buffer states in a more general
  * "scanner state".
  *
  * Returns the top of the stack, or NULL.
  */
-#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
-                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
+#define YY_CURRENT_BUFFER ( yyg->yy_buffer_stack \
+                          ? yyg->yy_buffer_stack[yyg->yy_buffer_stack_top] \
                           : NULL)
 /* Same as previous macro, but useful when we know that the buffer stack is not
  * NULL or when we need an lvalue. For internal use only.
  */
-#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
-
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-static yy_size_t yy_n_chars;		/* number of characters read into yy_ch_buf */
-yy_size_t yyleng;
-
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = NULL;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
-
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
+#define YY_CURRENT_BUFFER_LVALUE yyg->yy_buffer_stack[yyg->yy_buffer_stack_top]
 
-void yyrestart ( FILE *input_file  );
-void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer  );
-YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size  );
-void yy_delete_buffer ( YY_BUFFER_STATE b  );
-void yy_flush_buffer ( YY_BUFFER_STATE b  );
-void yypush_buffer_state ( YY_BUFFER_STATE new_buffer  );
-void yypop_buffer_state ( void );
+void yyrestart ( FILE *input_file , yyscan_t yyscanner );
+void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size , yyscan_t yyscanner );
+void yy_delete_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yy_flush_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yypush_buffer_state ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+void yypop_buffer_state ( yyscan_t yyscanner );
 
-static void yyensure_buffer_stack ( void );
-static void yy_load_buffer_state ( void );
-static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file  );
-#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER )
+static void yyensure_buffer_stack ( yyscan_t yyscanner );
+static void yy_load_buffer_state ( yyscan_t yyscanner );
+static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file , yyscan_t yyscanner );
+#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER , yyscanner)
 
-YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size  );
-YY_BUFFER_STATE yy_scan_string ( const char *yy_str  );
-YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, yy_size_t len  );
+YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_string ( const char *yy_str , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, yy_size_t len , yyscan_t yyscanner );
 
-void *yyalloc ( yy_size_t  );
-void *yyrealloc ( void *, yy_size_t  );
-void yyfree ( void *  );
+void *yyalloc ( yy_size_t , yyscan_t yyscanner );
+void *yyrealloc ( void *, yy_size_t , yyscan_t yyscanner );
+void yyfree ( void * , yyscan_t yyscanner );
 
 #define yy_new_buffer yy_create_buffer
 #define yy_set_interactive(is_interactive) \
 	{ \
 	if ( ! YY_CURRENT_BUFFER ){ \
-        yyensure_buffer_stack (); \
+        yyensure_buffer_stack (yyscanner); \
 		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner); \
 	} \
 	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
 	}
 #define yy_set_bol(at_bol) \
 	{ \
 	if ( ! YY_CURRENT_BUFFER ){\
-        yyensure_buffer_stack (); \
+        yyensure_buffer_stack (yyscanner); \
 		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner); \
 	} \
 	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
 	}
@@ -4457,33 +4341,24 @@ void yyfree ( void *  );
 /* Begin user sect3 */
 typedef flex_uint8_t YY_CHAR;
 
-FILE *yyin = NULL, *yyout = NULL;
-
 typedef int yy_state_type;
 
-extern int yylineno;
-int yylineno = 1;
-
-extern char *yytext;
-#ifdef yytext_ptr
-#undef yytext_ptr
-#endif
-#define yytext_ptr yytext
+#define yytext_ptr yytext_r
 
-static yy_state_type yy_get_previous_state ( void );
-static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  );
-static int yy_get_next_buffer ( void );
-static void yynoreturn yy_fatal_error ( const char* msg  );
+static yy_state_type yy_get_previous_state ( yyscan_t yyscanner );
+static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  , yyscan_t yyscanner);
+static int yy_get_next_buffer ( yyscan_t yyscanner );
+static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
 
 /* Done after the current pattern has been matched and before the
  * corresponding action - sets up yytext.
  */
 #define YY_DO_BEFORE_ACTION \
-	(yytext_ptr) = yy_bp; \
+	yyg->yytext_ptr = yy_bp; \
 	yyleng = (yy_size_t) (yy_cp - yy_bp); \
-	(yy_hold_char) = *yy_cp; \
+	yyg->yy_hold_char = *yy_cp; \
 	*yy_cp = '\0'; \
-	(yy_c_buf_p) = yy_cp;
+	yyg->yy_c_buf_p = yy_cp;
 #define YY_NUM_RULES 116
 #define YY_END_OF_BUFFER 117
 /* This struct is not used in this scanner,
@@ -4850,12 +4725,6 @@ static const flex_int32_t yy_rule_can_match_eol[117] =
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,     };
 
-static yy_state_type yy_last_accepting_state;
-static char *yy_last_accepting_cpos;
-
-extern int yy_flex_debug;
-int yy_flex_debug = 0;
-
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
  */
@@ -4863,7 +4732,6 @@ int yy_flex_debug = 0;
 #define yymore() yymore_used_but_not_detected
 #define YY_MORE_ADJ 0
 #define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
 #line 1 "chuck.lex"
 #line 10 "chuck.lex"
 
@@ -4917,12 +4785,11 @@ char *yytext;
                         // created by `make chuck_yacc.h` and `make chuck_yacc.c` in core/
 #endif
 
-// globals
-extern YYSTYPE yylval;
-// 1.5.0.5 (ge) added for precise location tracking
-extern YYLTYPE yylloc;
-// 1.5.0.5 (ge) added
-t_CKINT yycolumn = 1;
+// 1.5.5.3: no globals; the scanner is reentrant (see %option reentrant
+// below) and the parser pure (chuck.y): yyin, yytext, yylineno, yycolumn,
+// the buffers, and the parser's yylval / yylloc are all reached through the
+// scanner, so compiles can run in parallel; to regenerate chuck_yacc.c and
+// chuck_yacc.h, run scripts/GenerateChuckYacc.sh
 
 // define error handling
 #define YY_FATAL_ERROR(msg) EM_error2( 0, msg )
@@ -4932,85 +4799,23 @@ extern "C" {
 #endif
 
   // function prototypes
-  int yywrap(void);
-  void adjust();
+  int yywrap( yyscan_t yyscanner );
+  void adjust( yyscan_t yyscanner );
   c_str strip_lit( c_str str );
   c_str alloc_str( c_str str );
   long htol( c_str str );
 
   // 1.5.0.5 (ge) added
-  void a_newline( void );
-  void yycleanup( void );
-  void yyinitial( void );
-  void yyflush( void );
+  void a_newline( yyscan_t yyscanner );
+  void advance_m( yyscan_t yyscanner );
+  void yycleanup( yyscan_t yyscanner );
+  void yyinitial( yyscan_t yyscanner );
+  void yyflush( yyscan_t yyscanner );
 
 #if defined(_cplusplus) || defined(__cplusplus)
 }
 #endif
 
-// yycleanup | 1.5.0.5 (ge)
-void yycleanup( void )
-{
-    // clean up the FILE
-    if( yyin )
-    {
-        fclose( yyin );
-        yyin = NULL;
-    }
-}
-
-// yyflush | 1.5.0.5 (ge)
-void yyflush( void )
-{
-    // flush the buffer
-    YY_FLUSH_BUFFER;
-}
-
-// yyinitial | 1.5.0.5 (ge)
-void yyinitial( void )
-{
-    // set to initial
-    BEGIN(YY_START);
-    // reset
-    yycolumn = 1;
-    EM_tokPos = yycolumn;
-    yylloc.first_line   = yylloc.last_line   = 1;
-    yylloc.first_column = yylloc.last_column = 0;
-    // 1.5.2.4 (ge) added
-    yylineno = 1;
-}
-
-// yywrap()
-int yywrap( void )
-{
-    yycolumn = 1;
-    return 1;
-}
-
-// new line
-void a_newline()
-{
-    EM_newline( yylloc.last_column, yylloc.last_line );
-}
-
-// manually advance
-void advance_m()
-{
-    yycolumn++;
-    yylloc.first_column++;
-    yylloc.last_column++;
-}
-
-// adjust()
-void adjust()
-{
-    // update tok pos
-    EM_tokPos = yylloc.first_column;
-
-    // handy debug print for precise position and bounds of each token
-    // fprintf( stderr, "yylloc: %d %ld %d %d ------ %s\n", yylloc.first_line, yycolumn, yylloc.last_line, yylloc.last_column, yytext );
-}
-
 // strip
 c_str strip_lit( c_str str )
 {
@@ -5021,7 +4826,8 @@ c_str strip_lit( c_str str )
 // alloc_str()
 c_str alloc_str( c_str str )
 {
-    c_str s = (c_str)malloc( strlen(str) + 1 );
+    // from the AST arena, if one is current | 1.5.5.3
+    c_str s = (c_str)ast_malloc( strlen(str) + 1 );
     strcpy( s, str );
 
     return s;
@@ -5059,46 +4865,40 @@ long htol( c_str str )
     return n;
 }
 
-// for debugging (string literals, especially multi-line strings)
-void testLineNumPrint()
-{
-    fprintf( stderr, "TEST: %ld %i\n", EM_lineNum, yylloc.last_line );
-}
-
-
 // block comment hack
 #define block_comment_hack loop: \
-    while ((c = input()) != '*' && c != 0 && c != EOF ) { \
-        if( c == '\n' ) { a_newline(); } \
-        else { advance_m(); adjust(); } \
+    while ((c = input( yyscanner )) != '*' && c != 0 && c != EOF ) { \
+        if( c == '\n' ) { a_newline( yyscanner ); } \
+        else { advance_m( yyscanner ); adjust( yyscanner ); } \
     } \
-    if( c == EOF || c == 0 ) /* EOF; return 0 */ { adjust(); return 0; } \
-    if( (c1 = input()) != '/' && c != 0 && c != EOF ) { \
-        advance_m(); \
-        adjust(); \
+    if( c == EOF || c == 0 ) /* EOF; return 0 */ { adjust( yyscanner ); return 0; } \
+    if( (c1 = input( yyscanner )) != '/' && c != 0 && c != EOF ) { \
+        advance_m( yyscanner ); \
+        adjust( yyscanner ); \
         unput(c1); \
         goto loop; \
     } \
-    if( c1 == EOF || c1 == 0 ) /* EOF; return 0 */ { adjust(); return 0; } \
-    else { advance_m(); advance_m(); adjust(); };
+    if( c1 == EOF || c1 == 0 ) /* EOF; return 0 */ { adjust( yyscanner ); return 0; } \
+    else { advance_m( yyscanner ); advance_m( yyscanner ); adjust( yyscanner ); };
 
 
 // comment hack
 #define comment_hack \
-    while( (c = input()) != '\n' && c != '\r' && c != 0 && c != EOF ) ; \
-    if( c == EOF || c == 0 ) /* EOF; return 0 */ { adjust(); return 0; } \
-    if( c == '\n' ) { a_newline(); }
+    while( (c = input( yyscanner )) != '\n' && c != '\r' && c != 0 && c != EOF ) ; \
+    if( c == EOF || c == 0 ) /* EOF; return 0 */ { adjust( yyscanner ); return 0; } \
+    if( c == '\n' ) { a_newline( yyscanner ); }
 
 
 // 1.5.0.5 added for tracking | (thanks ekeyser + Becca Royal-Gordon)
 // https://stackoverflow.com/questions/656703/how-does-flex-support-bison-location-exactly
 // https://www.gnu.org/software/bison/manual/html_node/Tracking-Locations.html
-#define YY_USER_ACTION yylloc.first_line = yylloc.last_line = yylineno; \
-    yylloc.first_column = yycolumn; yylloc.last_column = yycolumn + yyleng - 1; \
+#define YY_USER_ACTION yylloc->first_line = yylloc->last_line = yylineno; \
+    yylloc->first_column = yycolumn; yylloc->last_column = yycolumn + yyleng - 1; \
     yycolumn += yyleng;
 
 
-#line 989 "chuck.yy.c"
+
+#line 899 "chuck.yy.c"
 /* generate line number */
 /* 1.5.0.7 (ge) added to remove dependecy on isatty() and unistd.h
  without the above option, flex/bison will check isatty() to determine
@@ -5110,81 +4910,141 @@ void testLineNumPrint()
  if neither `never-interactive` nor `interactive` is specified, bison
  will test using isatty()) */
 /* 1.5.1.5 (ge) reentrant lexer */
-/* %option reentrant */
+/* 1.5.5.3 on: all scanner state is in the yyscan_t made by yylex_init_extra(),
+ whose extra data is the parse state (a_Parse); bison-bridge / bison-locations
+ take yylval and yylloc from the pure parser (chuck.y) on each yylex() call */
 /* float exponent | 1.5.0.5 (ge) */
 /* universal character name */
 /* thanks O'Reilly book for the above recipes for STRING_LIT / CHAR_LIT / FLOAT_VAL
    https://web.iitd.ac.in/~sumeet/flex__bison.pdf */
-#line 1006 "chuck.yy.c"
+#line 918 "chuck.yy.c"
 
 #define INITIAL 0
 
-#ifndef YY_EXTRA_TYPE
-#define YY_EXTRA_TYPE void *
-#endif
+#define YY_EXTRA_TYPE a_Parse
+
+/* Holds the entire state of the reentrant scanner. */
+struct yyguts_t
+    {
+
+    /* User-defined. Not touched by flex. */
+    YY_EXTRA_TYPE yyextra_r;
+
+    /* The rest are the same as the globals declared in the non-reentrant scanner. */
+    FILE *yyin_r, *yyout_r;
+    size_t yy_buffer_stack_top; /**< index of top of stack. */
+    size_t yy_buffer_stack_max; /**< capacity of stack. */
+    YY_BUFFER_STATE * yy_buffer_stack; /**< Stack as an array. */
+    char yy_hold_char;
+    yy_size_t yy_n_chars;
+    yy_size_t yyleng_r;
+    char *yy_c_buf_p;
+    int yy_init;
+    int yy_start;
+    int yy_did_buffer_switch_on_eof;
+    int yy_start_stack_ptr;
+    int yy_start_stack_depth;
+    int *yy_start_stack;
+    yy_state_type yy_last_accepting_state;
+    char* yy_last_accepting_cpos;
+
+    int yylineno_r;
+    int yy_flex_debug_r;
+
+    char *yytext_r;
+    int yy_more_flag;
+    int yy_more_len;
+
+    YYSTYPE * yylval_r;
+
+    YYLTYPE * yylloc_r;
+
+    }; /* end struct yyguts_t */
+
+static int yy_init_globals ( yyscan_t yyscanner );
+
+    /* This must go here because YYSTYPE and YYLTYPE are included
+     * from bison output in section 1.*/
+    #    define yylval yyg->yylval_r
+
+    #    define yylloc yyg->yylloc_r
+
+int yylex_init (yyscan_t* scanner);
 
-static int yy_init_globals ( void );
+int yylex_init_extra ( YY_EXTRA_TYPE user_defined, yyscan_t* scanner);
 
 /* Accessor methods to globals.
    These are made visible to non-reentrant scanners for convenience. */
 
-int yylex_destroy ( void );
+int yylex_destroy ( yyscan_t yyscanner );
 
-int yyget_debug ( void );
+int yyget_debug ( yyscan_t yyscanner );
 
-void yyset_debug ( int debug_flag  );
+void yyset_debug ( int debug_flag , yyscan_t yyscanner );
 
-YY_EXTRA_TYPE yyget_extra ( void );
+YY_EXTRA_TYPE yyget_extra ( yyscan_t yyscanner );
 
-void yyset_extra ( YY_EXTRA_TYPE user_defined  );
+void yyset_extra ( YY_EXTRA_TYPE user_defined , yyscan_t yyscanner );
 
-FILE *yyget_in ( void );
+FILE *yyget_in ( yyscan_t yyscanner );
 
-void yyset_in  ( FILE * _in_str  );
+void yyset_in  ( FILE * _in_str , yyscan_t yyscanner );
 
-FILE *yyget_out ( void );
+FILE *yyget_out ( yyscan_t yyscanner );
 
-void yyset_out  ( FILE * _out_str  );
+void yyset_out  ( FILE * _out_str , yyscan_t yyscanner );
 
-			yy_size_t yyget_leng ( void );
+			yy_size_t yyget_leng ( yyscan_t yyscanner );
 
-char *yyget_text ( void );
+char *yyget_text ( yyscan_t yyscanner );
 
-int yyget_lineno ( void );
+int yyget_lineno ( yyscan_t yyscanner );
 
-void yyset_lineno ( int _line_number  );
+void yyset_lineno ( int _line_number , yyscan_t yyscanner );
 
+int yyget_column  ( yyscan_t yyscanner );
+
+void yyset_column ( int _column_no , yyscan_t yyscanner );
+
+YYSTYPE * yyget_lval ( yyscan_t yyscanner );
+
+void yyset_lval ( YYSTYPE * yylval_param , yyscan_t yyscanner );
+
+       YYLTYPE *yyget_lloc ( yyscan_t yyscanner );
+
+        void yyset_lloc ( YYLTYPE * yylloc_param , yyscan_t yyscanner );
+    
 /* Macros after this point can all be overridden by user definitions in
  * section 1.
  */
 
 #ifndef YY_SKIP_YYWRAP
 #ifdef __cplusplus
-extern "C" int yywrap ( void );
+extern "C" int yywrap ( yyscan_t yyscanner );
 #else
-extern int yywrap ( void );
+extern int yywrap ( yyscan_t yyscanner );
 #endif
 #endif
 
 #ifndef YY_NO_UNPUT
     
-    static void yyunput ( int c, char *buf_ptr  );
+    static void yyunput ( int c, char *buf_ptr  , yyscan_t yyscanner);
     
 #endif
 
 #ifndef yytext_ptr
-static void yy_flex_strncpy ( char *, const char *, int );
+static void yy_flex_strncpy ( char *, const char *, int , yyscan_t yyscanner);
 #endif
 
 #ifdef YY_NEED_STRLEN
-static int yy_flex_strlen ( const char * );
+static int yy_flex_strlen ( const char * , yyscan_t yyscanner);
 #endif
 
 #ifndef YY_NO_INPUT
 #ifdef __cplusplus
-static int yyinput ( void );
+static int yyinput ( yyscan_t yyscanner );
 #else
-static int input ( void );
+static int input ( yyscan_t yyscanner );
 #endif
 
 #endif
@@ -5258,7 +5118,7 @@ static int input ( void );
 
 /* Report a fatal error. */
 #ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
+#define YY_FATAL_ERROR(msg) yy_fatal_error( msg , yyscanner)
 #endif
 
 /* end tables serialization structures and prototypes */
@@ -5269,9 +5129,11 @@ static int input ( void );
 #ifndef YY_DECL
 #define YY_DECL_IS_OURS 1
 
-extern int yylex (void);
+extern int yylex \
+               (YYSTYPE * yylval_param, YYLTYPE * yylloc_param , yyscan_t yyscanner);
 
-#define YY_DECL int yylex (void)
+#define YY_DECL int yylex \
+               (YYSTYPE * yylval_param, YYLTYPE * yylloc_param , yyscan_t yyscanner)
 #endif /* !YY_DECL */
 
 /* Code executed at the beginning of each rule, after yytext and yyleng
@@ -5296,17 +5158,22 @@ YY_DECL
 	yy_state_type yy_current_state;
 	char *yy_cp, *yy_bp;
 	int yy_act;
-    
-	if ( !(yy_init) )
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+    yylval = yylval_param;
+
+    yylloc = yylloc_param;
+
+	if ( !yyg->yy_init )
 		{
-		(yy_init) = 1;
+		yyg->yy_init = 1;
 
 #ifdef YY_USER_INIT
 		YY_USER_INIT;
 #endif
 
-		if ( ! (yy_start) )
-			(yy_start) = 1;	/* first start state */
+		if ( ! yyg->yy_start )
+			yyg->yy_start = 1;	/* first start state */
 
 		if ( ! yyin )
 			yyin = stdin;
@@ -5315,18 +5182,18 @@ YY_DECL
 			yyout = stdout;
 
 		if ( ! YY_CURRENT_BUFFER ) {
-			yyensure_buffer_stack ();
+			yyensure_buffer_stack( yyscanner );
 			YY_CURRENT_BUFFER_LVALUE =
-				yy_create_buffer( yyin, YY_BUF_SIZE );
+				yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
 		}
 
-		yy_load_buffer_state(  );
+		yy_load_buffer_state( yyscanner );
 		}
 
 	{
-#line 268 "chuck.lex"
+#line 204 "chuck.lex"
 
-#line 270 "chuck.lex"
+#line 206 "chuck.lex"
  /* --------------------- RULES SECTION --------------------------
     NOTE in this section, begin comments on a new line AND
          with one or more whitespaces before comment
@@ -5334,33 +5201,33 @@ YY_DECL
     NOTE since . matches anything except a newline,
          .* will gobble up the rest of the line
     (from /Flex & Bison/ by John Levin, published O'Reilly 2009)
-    ALTERNATIVE "//".* { char c; adjust(); continue; }
+    ALTERNATIVE "//".* { char c; adjust( yyscanner ); continue; }
   ---------------------------------------------------------------*/
- /* "<--"               { char c; adjust(); comment_hack; continue; } */
+ /* "<--"               { char c; adjust( yyscanner ); comment_hack; continue; } */
  /* ------------------------------------------------------------ */
-#line 1229 "chuck.yy.c"
+#line 1206 "chuck.yy.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
-		yy_cp = (yy_c_buf_p);
+		yy_cp = yyg->yy_c_buf_p;
 
 		/* Support of yytext. */
-		*yy_cp = (yy_hold_char);
+		*yy_cp = yyg->yy_hold_char;
 
 		/* yy_bp points to the position in yy_ch_buf of the start of
 		 * the current run.
 		 */
 		yy_bp = yy_cp;
 
-		yy_current_state = (yy_start);
+		yy_current_state = yyg->yy_start;
 yy_match:
 		do
 			{
 			YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)] ;
 			if ( yy_accept[yy_current_state] )
 				{
-				(yy_last_accepting_state) = yy_current_state;
-				(yy_last_accepting_cpos) = yy_cp;
+				yyg->yy_last_accepting_state = yy_current_state;
+				yyg->yy_last_accepting_cpos = yy_cp;
 				}
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
@@ -5372,8 +5239,8 @@ yy_match:
 			++yy_cp;
 			}
 		while ( yy_current_state != 351 );
-		yy_cp = (yy_last_accepting_cpos);
-		yy_current_state = (yy_last_accepting_state);
+		yy_cp = yyg->yy_last_accepting_cpos;
+		yy_current_state = yyg->yy_last_accepting_state;
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -5396,607 +5263,607 @@ do_action:	/* This label is used only to access EOF actions. */
 	{ /* beginning of action switch */
 			case 0: /* must back up */
 			/* undo the effects of YY_DO_BEFORE_ACTION */
-			*yy_cp = (yy_hold_char);
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
+			*yy_cp = yyg->yy_hold_char;
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
 			goto yy_find_action;
 
 case 1:
 YY_RULE_SETUP
-#line 281 "chuck.lex"
-{ char c; adjust(); comment_hack; continue; }
+#line 215 "chuck.lex"
+{ char c; adjust( yyscanner ); comment_hack; continue; }
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 282 "chuck.lex"
-{ char c, c1; adjust(); block_comment_hack; continue; }
+#line 216 "chuck.lex"
+{ char c, c1; adjust( yyscanner ); block_comment_hack; continue; }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 283 "chuck.lex"
-{ adjust(); continue; }
+#line 217 "chuck.lex"
+{ adjust( yyscanner ); continue; }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 284 "chuck.lex"
-{ adjust(); continue; }
+#line 218 "chuck.lex"
+{ adjust( yyscanner ); continue; }
 	YY_BREAK
 case 5:
 /* rule 5 can match eol */
 YY_RULE_SETUP
-#line 285 "chuck.lex"
-{ adjust(); a_newline(); continue; }
+#line 219 "chuck.lex"
+{ adjust( yyscanner ); a_newline( yyscanner ); continue; }
 	YY_BREAK
 case 6:
 /* rule 6 can match eol */
 YY_RULE_SETUP
-#line 286 "chuck.lex"
-{ adjust(); a_newline(); continue; }
+#line 220 "chuck.lex"
+{ adjust( yyscanner ); a_newline( yyscanner ); continue; }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 288 "chuck.lex"
-{ adjust(); return PLUSPLUS; }
+#line 222 "chuck.lex"
+{ adjust( yyscanner ); return PLUSPLUS; }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 289 "chuck.lex"
-{ adjust(); return MINUSMINUS; }
+#line 223 "chuck.lex"
+{ adjust( yyscanner ); return MINUSMINUS; }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 290 "chuck.lex"
-{ adjust(); return POUNDPAREN; }
+#line 224 "chuck.lex"
+{ adjust( yyscanner ); return POUNDPAREN; }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 291 "chuck.lex"
-{ adjust(); return PERCENTPAREN; }
+#line 225 "chuck.lex"
+{ adjust( yyscanner ); return PERCENTPAREN; }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 292 "chuck.lex"
-{ adjust(); return ATPAREN; }
+#line 226 "chuck.lex"
+{ adjust( yyscanner ); return ATPAREN; }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 294 "chuck.lex"
-{ adjust(); return COMMA; }
+#line 228 "chuck.lex"
+{ adjust( yyscanner ); return COMMA; }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 295 "chuck.lex"
-{ adjust(); return COLON; }
+#line 229 "chuck.lex"
+{ adjust( yyscanner ); return COLON; }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 296 "chuck.lex"
-{ adjust(); return DOT; }
+#line 230 "chuck.lex"
+{ adjust( yyscanner ); return DOT; }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 297 "chuck.lex"
-{ adjust(); return PLUS; }
+#line 231 "chuck.lex"
+{ adjust( yyscanner ); return PLUS; }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 298 "chuck.lex"
-{ adjust(); return MINUS; }
+#line 232 "chuck.lex"
+{ adjust( yyscanner ); return MINUS; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 299 "chuck.lex"
-{ adjust(); return TIMES; }
+#line 233 "chuck.lex"
+{ adjust( yyscanner ); return TIMES; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 300 "chuck.lex"
-{ adjust(); return DIVIDE; }
+#line 234 "chuck.lex"
+{ adjust( yyscanner ); return DIVIDE; }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 301 "chuck.lex"
-{ adjust(); return PERCENT; }
+#line 235 "chuck.lex"
+{ adjust( yyscanner ); return PERCENT; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 302 "chuck.lex"
-{ adjust(); return POUND; }
+#line 236 "chuck.lex"
+{ adjust( yyscanner ); return POUND; }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 303 "chuck.lex"
-{ adjust(); return DOLLAR; }
+#line 237 "chuck.lex"
+{ adjust( yyscanner ); return DOLLAR; }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 305 "chuck.lex"
-{ adjust(); return COLONCOLON; }
+#line 239 "chuck.lex"
+{ adjust( yyscanner ); return COLONCOLON; }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 306 "chuck.lex"
-{ adjust(); return EQ; }
+#line 240 "chuck.lex"
+{ adjust( yyscanner ); return EQ; }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 307 "chuck.lex"
-{ adjust(); return NEQ; }
+#line 241 "chuck.lex"
+{ adjust( yyscanner ); return NEQ; }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 308 "chuck.lex"
-{ adjust(); return LT; }
+#line 242 "chuck.lex"
+{ adjust( yyscanner ); return LT; }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 309 "chuck.lex"
-{ adjust(); return GT; }
+#line 243 "chuck.lex"
+{ adjust( yyscanner ); return GT; }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 310 "chuck.lex"
-{ adjust(); return LE; }
+#line 244 "chuck.lex"
+{ adjust( yyscanner ); return LE; }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 311 "chuck.lex"
-{ adjust(); return GE; }
+#line 245 "chuck.lex"
+{ adjust( yyscanner ); return GE; }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 312 "chuck.lex"
-{ adjust(); return AND; }
+#line 246 "chuck.lex"
+{ adjust( yyscanner ); return AND; }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 313 "chuck.lex"
-{ adjust(); return OR; }
+#line 247 "chuck.lex"
+{ adjust( yyscanner ); return OR; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 314 "chuck.lex"
-{ adjust(); return S_AND; }
+#line 248 "chuck.lex"
+{ adjust( yyscanner ); return S_AND; }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 315 "chuck.lex"
-{ adjust(); return S_OR; }
+#line 249 "chuck.lex"
+{ adjust( yyscanner ); return S_OR; }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 316 "chuck.lex"
-{ adjust(); return S_XOR; }
+#line 250 "chuck.lex"
+{ adjust( yyscanner ); return S_XOR; }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 317 "chuck.lex"
-{ adjust(); return SHIFT_RIGHT; }
+#line 251 "chuck.lex"
+{ adjust( yyscanner ); return SHIFT_RIGHT; }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 318 "chuck.lex"
-{ adjust(); return SHIFT_LEFT; }
+#line 252 "chuck.lex"
+{ adjust( yyscanner ); return SHIFT_LEFT; }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 319 "chuck.lex"
-{ adjust(); return ASSIGN; }
+#line 253 "chuck.lex"
+{ adjust( yyscanner ); return ASSIGN; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 320 "chuck.lex"
-{ adjust(); return LPAREN; }
+#line 254 "chuck.lex"
+{ adjust( yyscanner ); return LPAREN; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 321 "chuck.lex"
-{ adjust(); return RPAREN; }
+#line 255 "chuck.lex"
+{ adjust( yyscanner ); return RPAREN; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 322 "chuck.lex"
-{ adjust(); return LBRACK; }
+#line 256 "chuck.lex"
+{ adjust( yyscanner ); return LBRACK; }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 323 "chuck.lex"
-{ adjust(); return RBRACK; }
+#line 257 "chuck.lex"
+{ adjust( yyscanner ); return RBRACK; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 324 "chuck.lex"
-{ adjust(); return LBRACE; }
+#line 258 "chuck.lex"
+{ adjust( yyscanner ); return LBRACE; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 325 "chuck.lex"
-{ adjust(); return RBRACE; }
+#line 259 "chuck.lex"
+{ adjust( yyscanner ); return RBRACE; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 326 "chuck.lex"
-{ adjust(); return SEMICOLON; }
+#line 260 "chuck.lex"
+{ adjust( yyscanner ); return SEMICOLON; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 327 "chuck.lex"
-{ adjust(); return QUESTION; }
+#line 261 "chuck.lex"
+{ adjust( yyscanner ); return QUESTION; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 328 "chuck.lex"
-{ adjust(); return EXCLAMATION; }
+#line 262 "chuck.lex"
+{ adjust( yyscanner ); return EXCLAMATION; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 329 "chuck.lex"
-{ adjust(); return TILDA; }
+#line 263 "chuck.lex"
+{ adjust( yyscanner ); return TILDA; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 330 "chuck.lex"
-{ adjust(); return FOR; }
+#line 264 "chuck.lex"
+{ adjust( yyscanner ); return FOR; }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 331 "chuck.lex"
-{ adjust(); return WHILE; }
+#line 265 "chuck.lex"
+{ adjust( yyscanner ); return WHILE; }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 332 "chuck.lex"
-{ adjust(); return UNTIL; }
+#line 266 "chuck.lex"
+{ adjust( yyscanner ); return UNTIL; }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 333 "chuck.lex"
-{ adjust(); return LOOP; }
+#line 267 "chuck.lex"
+{ adjust( yyscanner ); return LOOP; }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 334 "chuck.lex"
-{ adjust(); return CONTINUE; }
+#line 268 "chuck.lex"
+{ adjust( yyscanner ); return CONTINUE; }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 335 "chuck.lex"
-{ adjust(); return BREAK; }
+#line 269 "chuck.lex"
+{ adjust( yyscanner ); return BREAK; }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 336 "chuck.lex"
-{ adjust(); return IF; }
+#line 270 "chuck.lex"
+{ adjust( yyscanner ); return IF; }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 337 "chuck.lex"
-{ adjust(); return ELSE; }
+#line 271 "chuck.lex"
+{ adjust( yyscanner ); return ELSE; }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 338 "chuck.lex"
-{ adjust(); return DO; }
+#line 272 "chuck.lex"
+{ adjust( yyscanner ); return DO; }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 339 "chuck.lex"
-{ adjust(); return L_HACK; }
+#line 273 "chuck.lex"
+{ adjust( yyscanner ); return L_HACK; }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-#line 340 "chuck.lex"
-{ adjust(); return R_HACK; }
+#line 274 "chuck.lex"
+{ adjust( yyscanner ); return R_HACK; }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 342 "chuck.lex"
-{ adjust(); return RETURN; }
+#line 276 "chuck.lex"
+{ adjust( yyscanner ); return RETURN; }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-#line 344 "chuck.lex"
-{ adjust(); return FUNCTION; }
+#line 278 "chuck.lex"
+{ adjust( yyscanner ); return FUNCTION; }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-#line 345 "chuck.lex"
-{ adjust(); return FUNCTION; }
+#line 279 "chuck.lex"
+{ adjust( yyscanner ); return FUNCTION; }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 346 "chuck.lex"
-{ adjust(); return NEW; }
+#line 280 "chuck.lex"
+{ adjust( yyscanner ); return NEW; }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-#line 347 "chuck.lex"
-{ adjust(); return CLASS; }
+#line 281 "chuck.lex"
+{ adjust( yyscanner ); return CLASS; }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-#line 348 "chuck.lex"
-{ adjust(); return INTERFACE; }
+#line 282 "chuck.lex"
+{ adjust( yyscanner ); return INTERFACE; }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-#line 349 "chuck.lex"
-{ adjust(); return EXTENDS; }
+#line 283 "chuck.lex"
+{ adjust( yyscanner ); return EXTENDS; }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 350 "chuck.lex"
-{ adjust(); return IMPLEMENTS; }
+#line 284 "chuck.lex"
+{ adjust( yyscanner ); return IMPLEMENTS; }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 351 "chuck.lex"
-{ adjust(); return PUBLIC; }
+#line 285 "chuck.lex"
+{ adjust( yyscanner ); return PUBLIC; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 352 "chuck.lex"
-{ adjust(); return PROTECTED; }
+#line 286 "chuck.lex"
+{ adjust( yyscanner ); return PROTECTED; }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 353 "chuck.lex"
-{ adjust(); return PRIVATE; }
+#line 287 "chuck.lex"
+{ adjust( yyscanner ); return PRIVATE; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 354 "chuck.lex"
-{ adjust(); return STATIC; }
+#line 288 "chuck.lex"
+{ adjust( yyscanner ); return STATIC; }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 355 "chuck.lex"
-{ adjust(); return ABSTRACT; }
+#line 289 "chuck.lex"
+{ adjust( yyscanner ); return ABSTRACT; }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 356 "chuck.lex"
-{ adjust(); return CONST; }
+#line 290 "chuck.lex"
+{ adjust( yyscanner ); return CONST; }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 357 "chuck.lex"
-{ adjust(); return SPORK; }
+#line 291 "chuck.lex"
+{ adjust( yyscanner ); return SPORK; }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 358 "chuck.lex"
-{ adjust(); return TYPEOF; }
+#line 292 "chuck.lex"
+{ adjust( yyscanner ); return TYPEOF; }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 359 "chuck.lex"
-{ adjust(); return EXTERNAL; }
+#line 293 "chuck.lex"
+{ adjust( yyscanner ); return EXTERNAL; }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-#line 360 "chuck.lex"
-{ adjust(); return GLOBAL; }
+#line 294 "chuck.lex"
+{ adjust( yyscanner ); return GLOBAL; }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-#line 362 "chuck.lex"
-{ adjust(); return CHUCK; }
+#line 296 "chuck.lex"
+{ adjust( yyscanner ); return CHUCK; }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
-#line 363 "chuck.lex"
-{ adjust(); return UNCHUCK; }
+#line 297 "chuck.lex"
+{ adjust( yyscanner ); return UNCHUCK; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
-#line 364 "chuck.lex"
-{ adjust(); return UNCHUCK; }
+#line 298 "chuck.lex"
+{ adjust( yyscanner ); return UNCHUCK; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
-#line 365 "chuck.lex"
-{ adjust(); return UPCHUCK; }
+#line 299 "chuck.lex"
+{ adjust( yyscanner ); return UPCHUCK; }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
-#line 366 "chuck.lex"
-{ adjust(); return DOWNCHUCK; }
+#line 300 "chuck.lex"
+{ adjust( yyscanner ); return DOWNCHUCK; }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
-#line 367 "chuck.lex"
-{ adjust(); return AT_CHUCK; }
+#line 301 "chuck.lex"
+{ adjust( yyscanner ); return AT_CHUCK; }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
-#line 368 "chuck.lex"
-{ adjust(); return PLUS_CHUCK; }
+#line 302 "chuck.lex"
+{ adjust( yyscanner ); return PLUS_CHUCK; }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
-#line 369 "chuck.lex"
-{ adjust(); return MINUS_CHUCK; }
+#line 303 "chuck.lex"
+{ adjust( yyscanner ); return MINUS_CHUCK; }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
-#line 370 "chuck.lex"
-{ adjust(); return TIMES_CHUCK; }
+#line 304 "chuck.lex"
+{ adjust( yyscanner ); return TIMES_CHUCK; }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
-#line 371 "chuck.lex"
-{ adjust(); return DIVIDE_CHUCK; }
+#line 305 "chuck.lex"
+{ adjust( yyscanner ); return DIVIDE_CHUCK; }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
-#line 372 "chuck.lex"
-{ adjust(); return S_AND_CHUCK; }
+#line 306 "chuck.lex"
+{ adjust( yyscanner ); return S_AND_CHUCK; }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
-#line 373 "chuck.lex"
-{ adjust(); return S_OR_CHUCK; }
+#line 307 "chuck.lex"
+{ adjust( yyscanner ); return S_OR_CHUCK; }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
-#line 374 "chuck.lex"
-{ adjust(); return S_XOR_CHUCK; }
+#line 308 "chuck.lex"
+{ adjust( yyscanner ); return S_XOR_CHUCK; }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
-#line 375 "chuck.lex"
-{ adjust(); return SHIFT_RIGHT_CHUCK; }
+#line 309 "chuck.lex"
+{ adjust( yyscanner ); return SHIFT_RIGHT_CHUCK; }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
-#line 376 "chuck.lex"
-{ adjust(); return SHIFT_LEFT_CHUCK; }
+#line 310 "chuck.lex"
+{ adjust( yyscanner ); return SHIFT_LEFT_CHUCK; }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
-#line 377 "chuck.lex"
-{ adjust(); return PERCENT_CHUCK; }
+#line 311 "chuck.lex"
+{ adjust( yyscanner ); return PERCENT_CHUCK; }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
-#line 378 "chuck.lex"
-{ adjust(); return AT_SYM; }
+#line 312 "chuck.lex"
+{ adjust( yyscanner ); return AT_SYM; }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
-#line 379 "chuck.lex"
-{ adjust(); return ATAT_SYM; }
+#line 313 "chuck.lex"
+{ adjust( yyscanner ); return ATAT_SYM; }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
-#line 380 "chuck.lex"
-{ adjust(); return AT_OP; }
+#line 314 "chuck.lex"
+{ adjust( yyscanner ); return AT_OP; }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
-#line 381 "chuck.lex"
-{ adjust(); return AT_CTOR; }
+#line 315 "chuck.lex"
+{ adjust( yyscanner ); return AT_CTOR; }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
-#line 382 "chuck.lex"
-{ adjust(); return AT_DTOR; }
+#line 316 "chuck.lex"
+{ adjust( yyscanner ); return AT_DTOR; }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
-#line 383 "chuck.lex"
-{ adjust(); return AT_IMPORT; }
+#line 317 "chuck.lex"
+{ adjust( yyscanner ); return AT_IMPORT; }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
-#line 384 "chuck.lex"
-{ adjust(); return AT_DOC; }
+#line 318 "chuck.lex"
+{ adjust( yyscanner ); return AT_DOC; }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
-#line 385 "chuck.lex"
-{ adjust(); return ARROW_RIGHT; }
+#line 319 "chuck.lex"
+{ adjust( yyscanner ); return ARROW_RIGHT; }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
-#line 386 "chuck.lex"
-{ adjust(); return ARROW_LEFT; }
+#line 320 "chuck.lex"
+{ adjust( yyscanner ); return ARROW_LEFT; }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
-#line 387 "chuck.lex"
-{ adjust(); return GRUCK_RIGHT; }
+#line 321 "chuck.lex"
+{ adjust( yyscanner ); return GRUCK_RIGHT; }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
-#line 388 "chuck.lex"
-{ adjust(); return GRUCK_LEFT; }
+#line 322 "chuck.lex"
+{ adjust( yyscanner ); return GRUCK_LEFT; }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
-#line 389 "chuck.lex"
-{ adjust(); return UNGRUCK_RIGHT; }
+#line 323 "chuck.lex"
+{ adjust( yyscanner ); return UNGRUCK_RIGHT; }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
-#line 390 "chuck.lex"
-{ adjust(); return UNGRUCK_LEFT; }
+#line 324 "chuck.lex"
+{ adjust( yyscanner ); return UNGRUCK_LEFT; }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
-#line 392 "chuck.lex"
-{ adjust(); yylval.sval=alloc_str(yytext); return ID; }
+#line 326 "chuck.lex"
+{ adjust( yyscanner ); yylval->sval=alloc_str(yytext); return ID; }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
-#line 394 "chuck.lex"
-{ adjust(); yylval.ival=atoi(yytext); return INT_VAL; }
+#line 328 "chuck.lex"
+{ adjust( yyscanner ); yylval->ival=atoi(yytext); return INT_VAL; }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
-#line 395 "chuck.lex"
-{ adjust(); yylval.ival=atoi(yytext); return INT_VAL; }
+#line 329 "chuck.lex"
+{ adjust( yyscanner ); yylval->ival=atoi(yytext); return INT_VAL; }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
-#line 396 "chuck.lex"
-{ adjust(); yylval.ival=htol(yytext); return INT_VAL; }
+#line 330 "chuck.lex"
+{ adjust( yyscanner ); yylval->ival=htol(yytext); return INT_VAL; }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
-#line 398 "chuck.lex"
-{ adjust(); yylval.fval=atof(yytext); return FLOAT_VAL; }
+#line 332 "chuck.lex"
+{ adjust( yyscanner ); yylval->fval=atof(yytext); return FLOAT_VAL; }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
-#line 399 "chuck.lex"
-{ adjust(); yylval.fval=atof(yytext); return FLOAT_VAL; }
+#line 333 "chuck.lex"
+{ adjust( yyscanner ); yylval->fval=atof(yytext); return FLOAT_VAL; }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
-#line 400 "chuck.lex"
-{ adjust(); yylval.fval=atof(yytext); return FLOAT_VAL; }
+#line 334 "chuck.lex"
+{ adjust( yyscanner ); yylval->fval=atof(yytext); return FLOAT_VAL; }
 	YY_BREAK
 case 112:
 /* rule 112 can match eol */
 YY_RULE_SETUP
-#line 402 "chuck.lex"
-{ adjust(); yylval.sval=alloc_str(strip_lit(yytext)); return STRING_LIT; }
+#line 336 "chuck.lex"
+{ adjust( yyscanner ); yylval->sval=alloc_str(strip_lit(yytext)); return STRING_LIT; }
 	YY_BREAK
 case 113:
 /* rule 113 can match eol */
 YY_RULE_SETUP
-#line 403 "chuck.lex"
-{ adjust(); yylval.sval=alloc_str(strip_lit(yytext)); return STRING_LIT; }
+#line 337 "chuck.lex"
+{ adjust( yyscanner ); yylval->sval=alloc_str(strip_lit(yytext)); return STRING_LIT; }
 	YY_BREAK
 case 114:
 /* rule 114 can match eol */
 YY_RULE_SETUP
-#line 404 "chuck.lex"
-{ adjust(); yylval.sval=alloc_str(strip_lit(yytext)); return CHAR_LIT; }
+#line 338 "chuck.lex"
+{ adjust( yyscanner ); yylval->sval=alloc_str(strip_lit(yytext)); return CHAR_LIT; }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
-#line 406 "chuck.lex"
-{ adjust(); EM_error( EM_tokPos, "illegal token" ); }
+#line 340 "chuck.lex"
+{ adjust( yyscanner ); EM_error( EM_tokPos, "illegal token" ); }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
-#line 408 "chuck.lex"
+#line 343 "chuck.lex"
 ECHO;
 	YY_BREAK
-#line 1877 "chuck.yy.c"
+#line 1854 "chuck.yy.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
 	case YY_END_OF_BUFFER:
 		{
 		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
+		int yy_amount_of_matched_text = (int) (yy_cp - yyg->yytext_ptr) - 1;
 
 		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = (yy_hold_char);
+		*yy_cp = yyg->yy_hold_char;
 		YY_RESTORE_YY_MORE_OFFSET
 
 		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
@@ -6010,7 +5877,7 @@ case YY_STATE_EOF(INITIAL):
 			 * this is the first action (other than possibly a
 			 * back-up) that will match for the new input source.
 			 */
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+			yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
 			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
 			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
 			}
@@ -6022,13 +5889,13 @@ case YY_STATE_EOF(INITIAL):
 		 * end-of-buffer state).  Contrast this with the test
 		 * in input().
 		 */
-		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+		if ( yyg->yy_c_buf_p <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
 			{ /* This was really a NUL. */
 			yy_state_type yy_next_state;
 
-			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
+			yyg->yy_c_buf_p = yyg->yytext_ptr + yy_amount_of_matched_text;
 
-			yy_current_state = yy_get_previous_state(  );
+			yy_current_state = yy_get_previous_state( yyscanner );
 
 			/* Okay, we're now positioned to make the NUL
 			 * transition.  We couldn't have
@@ -6039,33 +5906,33 @@ case YY_STATE_EOF(INITIAL):
 			 * will run more slowly).
 			 */
 
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
+			yy_next_state = yy_try_NUL_trans( yy_current_state , yyscanner);
 
-			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+			yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 
 			if ( yy_next_state )
 				{
 				/* Consume the NUL. */
-				yy_cp = ++(yy_c_buf_p);
+				yy_cp = ++yyg->yy_c_buf_p;
 				yy_current_state = yy_next_state;
 				goto yy_match;
 				}
 
 			else
 				{
-				yy_cp = (yy_last_accepting_cpos);
-				yy_current_state = (yy_last_accepting_state);
+				yy_cp = yyg->yy_last_accepting_cpos;
+				yy_current_state = yyg->yy_last_accepting_state;
 				goto yy_find_action;
 				}
 			}
 
-		else switch ( yy_get_next_buffer(  ) )
+		else switch ( yy_get_next_buffer( yyscanner ) )
 			{
 			case EOB_ACT_END_OF_FILE:
 				{
-				(yy_did_buffer_switch_on_eof) = 0;
+				yyg->yy_did_buffer_switch_on_eof = 0;
 
-				if ( yywrap(  ) )
+				if ( yywrap( yyscanner ) )
 					{
 					/* Note: because we've taken care in
 					 * yy_get_next_buffer() to have set up
@@ -6076,7 +5943,7 @@ case YY_STATE_EOF(INITIAL):
 					 * YY_NULL, it'll still work - another
 					 * YY_NULL will get returned.
 					 */
-					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
+					yyg->yy_c_buf_p = yyg->yytext_ptr + YY_MORE_ADJ;
 
 					yy_act = YY_STATE_EOF(YY_START);
 					goto do_action;
@@ -6084,30 +5951,30 @@ case YY_STATE_EOF(INITIAL):
 
 				else
 					{
-					if ( ! (yy_did_buffer_switch_on_eof) )
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
 						YY_NEW_FILE;
 					}
 				break;
 				}
 
 			case EOB_ACT_CONTINUE_SCAN:
-				(yy_c_buf_p) =
-					(yytext_ptr) + yy_amount_of_matched_text;
+				yyg->yy_c_buf_p =
+					yyg->yytext_ptr + yy_amount_of_matched_text;
 
-				yy_current_state = yy_get_previous_state(  );
+				yy_current_state = yy_get_previous_state( yyscanner );
 
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 				goto yy_match;
 
 			case EOB_ACT_LAST_MATCH:
-				(yy_c_buf_p) =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
+				yyg->yy_c_buf_p =
+				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars];
 
-				yy_current_state = yy_get_previous_state(  );
+				yy_current_state = yy_get_previous_state( yyscanner );
 
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 				goto yy_find_action;
 			}
 		break;
@@ -6128,20 +5995,21 @@ case YY_STATE_EOF(INITIAL):
  *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
  *	EOB_ACT_END_OF_FILE - end of file
  */
-static int yy_get_next_buffer (void)
+static int yy_get_next_buffer (yyscan_t yyscanner)
 {
-    	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
-	char *source = (yytext_ptr);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
+	char *source = yyg->yytext_ptr;
 	int number_to_move, i;
 	int ret_val;
 
-	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
+	if ( yyg->yy_c_buf_p > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] )
 		YY_FATAL_ERROR(
 		"fatal flex scanner internal error--end of buffer missed" );
 
 	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
 		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
+		if ( yyg->yy_c_buf_p - yyg->yytext_ptr - YY_MORE_ADJ == 1 )
 			{
 			/* We matched a single character, the EOB, so
 			 * treat this as a final EOF.
@@ -6161,7 +6029,7 @@ static int yy_get_next_buffer (void)
 	/* Try to read more data. */
 
 	/* First move last chars to start of buffer. */
-	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr) - 1);
+	number_to_move = (int) (yyg->yy_c_buf_p - yyg->yytext_ptr - 1);
 
 	for ( i = 0; i < number_to_move; ++i )
 		*(dest++) = *(source++);
@@ -6170,7 +6038,7 @@ static int yy_get_next_buffer (void)
 		/* don't do the read, it's not guaranteed to return an EOF,
 		 * just force an EOF
 		 */
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars = 0;
 
 	else
 		{
@@ -6184,7 +6052,7 @@ static int yy_get_next_buffer (void)
 			YY_BUFFER_STATE b = YY_CURRENT_BUFFER_LVALUE;
 
 			int yy_c_buf_p_offset =
-				(int) ((yy_c_buf_p) - b->yy_ch_buf);
+				(int) (yyg->yy_c_buf_p - b->yy_ch_buf);
 
 			if ( b->yy_is_our_buffer )
 				{
@@ -6198,7 +6066,7 @@ static int yy_get_next_buffer (void)
 				b->yy_ch_buf = (char *)
 					/* Include room in for 2 EOB chars. */
 					yyrealloc( (void *) b->yy_ch_buf,
-							 (yy_size_t) (b->yy_buf_size + 2)  );
+							 (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
 				}
 			else
 				/* Can't grow it, we don't own it. */
@@ -6208,7 +6076,7 @@ static int yy_get_next_buffer (void)
 				YY_FATAL_ERROR(
 				"fatal error - scanner input buffer overflow" );
 
-			(yy_c_buf_p) = &b->yy_ch_buf[yy_c_buf_p_offset];
+			yyg->yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
 
 			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
 						number_to_move - 1;
@@ -6220,17 +6088,17 @@ static int yy_get_next_buffer (void)
 
 		/* Read in more data. */
 		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
-			(yy_n_chars), num_to_read );
+			yyg->yy_n_chars, num_to_read );
 
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
-	if ( (yy_n_chars) == 0 )
+	if ( yyg->yy_n_chars == 0 )
 		{
 		if ( number_to_move == YY_MORE_ADJ )
 			{
 			ret_val = EOB_ACT_END_OF_FILE;
-			yyrestart( yyin  );
+			yyrestart( yyin  , yyscanner);
 			}
 
 		else
@@ -6244,42 +6112,42 @@ static int yy_get_next_buffer (void)
 	else
 		ret_val = EOB_ACT_CONTINUE_SCAN;
 
-	if (((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
+	if ((yyg->yy_n_chars + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
 		/* Extend the array by 50%, plus the number we really need. */
-		yy_size_t new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
+		yy_size_t new_size = yyg->yy_n_chars + number_to_move + (yyg->yy_n_chars >> 1);
 		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc(
-			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size  );
+			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size , yyscanner );
 		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
 			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
 		/* "- 2" to take care of EOB's */
 		YY_CURRENT_BUFFER_LVALUE->yy_buf_size = (int) (new_size - 2);
 	}
 
-	(yy_n_chars) += number_to_move;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
+	yyg->yy_n_chars += number_to_move;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] = YY_END_OF_BUFFER_CHAR;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
 
-	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
+	yyg->yytext_ptr = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
 
 	return ret_val;
 }
 
 /* yy_get_previous_state - get the state just before the EOB char was reached */
 
-    static yy_state_type yy_get_previous_state (void)
+    static yy_state_type yy_get_previous_state (yyscan_t yyscanner)
 {
 	yy_state_type yy_current_state;
 	char *yy_cp;
-    
-	yy_current_state = (yy_start);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	yy_current_state = yyg->yy_start;
 
-	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
+	for ( yy_cp = yyg->yytext_ptr + YY_MORE_ADJ; yy_cp < yyg->yy_c_buf_p; ++yy_cp )
 		{
 		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
 		if ( yy_accept[yy_current_state] )
 			{
-			(yy_last_accepting_state) = yy_current_state;
-			(yy_last_accepting_cpos) = yy_cp;
+			yyg->yy_last_accepting_state = yy_current_state;
+			yyg->yy_last_accepting_cpos = yy_cp;
 			}
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
@@ -6298,16 +6166,17 @@ static int yy_get_next_buffer (void)
  * synopsis
  *	next_state = yy_try_NUL_trans( current_state );
  */
-    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
+    static yy_state_type yy_try_NUL_trans (yy_state_type yy_current_state , yyscan_t yyscanner)
 {
 	int yy_is_jam;
-    	char *yy_cp = (yy_c_buf_p);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	char *yy_cp = yyg->yy_c_buf_p;
 
 	YY_CHAR yy_c = 1;
 	if ( yy_accept[yy_current_state] )
 		{
-		(yy_last_accepting_state) = yy_current_state;
-		(yy_last_accepting_cpos) = yy_cp;
+		yyg->yy_last_accepting_state = yy_current_state;
+		yyg->yy_last_accepting_cpos = yy_cp;
 		}
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
@@ -6323,19 +6192,19 @@ static int yy_get_next_buffer (void)
 
 #ifndef YY_NO_UNPUT
 
-    static void yyunput (int c, char * yy_bp )
+    static void yyunput (int c, char * yy_bp , yyscan_t yyscanner)
 {
 	char *yy_cp;
-    
-    yy_cp = (yy_c_buf_p);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yy_cp = yyg->yy_c_buf_p;
 
 	/* undo effects of setting up yytext */
-	*yy_cp = (yy_hold_char);
+	*yy_cp = yyg->yy_hold_char;
 
 	if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
 		{ /* need to shift things up to make room */
 		/* +2 for EOB chars. */
-		yy_size_t number_to_move = (yy_n_chars) + 2;
+		yy_size_t number_to_move = yyg->yy_n_chars + 2;
 		char *dest = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[
 					YY_CURRENT_BUFFER_LVALUE->yy_buf_size + 2];
 		char *source =
@@ -6347,7 +6216,7 @@ static int yy_get_next_buffer (void)
 		yy_cp += (int) (dest - source);
 		yy_bp += (int) (dest - source);
 		YY_CURRENT_BUFFER_LVALUE->yy_n_chars =
-			(yy_n_chars) = (int) YY_CURRENT_BUFFER_LVALUE->yy_buf_size;
+			yyg->yy_n_chars = (int) YY_CURRENT_BUFFER_LVALUE->yy_buf_size;
 
 		if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
 			YY_FATAL_ERROR( "flex scanner push-back overflow" );
@@ -6359,41 +6228,42 @@ static int yy_get_next_buffer (void)
         --yylineno;
     }
 
-	(yytext_ptr) = yy_bp;
-	(yy_hold_char) = *yy_cp;
-	(yy_c_buf_p) = yy_cp;
+	yyg->yytext_ptr = yy_bp;
+	yyg->yy_hold_char = *yy_cp;
+	yyg->yy_c_buf_p = yy_cp;
 }
 
 #endif
 
 #ifndef YY_NO_INPUT
 #ifdef __cplusplus
-    static int yyinput (void)
+    static int yyinput (yyscan_t yyscanner)
 #else
-    static int input  (void)
+    static int input  (yyscan_t yyscanner)
 #endif
 
 {
 	int c;
-    
-	*(yy_c_buf_p) = (yy_hold_char);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	*yyg->yy_c_buf_p = yyg->yy_hold_char;
 
-	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
+	if ( *yyg->yy_c_buf_p == YY_END_OF_BUFFER_CHAR )
 		{
 		/* yy_c_buf_p now points to the character we want to return.
 		 * If this occurs *before* the EOB characters, then it's a
 		 * valid NUL; if not, then we've hit the end of the buffer.
 		 */
-		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+		if ( yyg->yy_c_buf_p < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
 			/* This was really a NUL. */
-			*(yy_c_buf_p) = '\0';
+			*yyg->yy_c_buf_p = '\0';
 
 		else
 			{ /* need more input */
-			yy_size_t offset = (yy_c_buf_p) - (yytext_ptr);
-			++(yy_c_buf_p);
+			yy_size_t offset = yyg->yy_c_buf_p - yyg->yytext_ptr;
+			++yyg->yy_c_buf_p;
 
-			switch ( yy_get_next_buffer(  ) )
+			switch ( yy_get_next_buffer( yyscanner ) )
 				{
 				case EOB_ACT_LAST_MATCH:
 					/* This happens because yy_g_n_b()
@@ -6407,34 +6277,34 @@ static int yy_get_next_buffer (void)
 					 */
 
 					/* Reset buffer status. */
-					yyrestart( yyin );
+					yyrestart( yyin , yyscanner);
 
 					/*FALLTHROUGH*/
 
 				case EOB_ACT_END_OF_FILE:
 					{
-					if ( yywrap(  ) )
+					if ( yywrap( yyscanner ) )
 						return 0;
 
-					if ( ! (yy_did_buffer_switch_on_eof) )
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
 						YY_NEW_FILE;
 #ifdef __cplusplus
-					return yyinput();
+					return yyinput( yyscanner );
 #else
-					return input();
+					return input( yyscanner );
 #endif
 					}
 
 				case EOB_ACT_CONTINUE_SCAN:
-					(yy_c_buf_p) = (yytext_ptr) + offset;
+					yyg->yy_c_buf_p = yyg->yytext_ptr + offset;
 					break;
 				}
 			}
 		}
 
-	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
-	*(yy_c_buf_p) = '\0';	/* preserve yytext */
-	(yy_hold_char) = *++(yy_c_buf_p);
+	c = *(unsigned char *) yyg->yy_c_buf_p;	/* cast for 8-bit char's */
+	*yyg->yy_c_buf_p = '\0';	/* preserve yytext */
+	yyg->yy_hold_char = *++yyg->yy_c_buf_p;
 
 	if ( c == '\n' )
 		
@@ -6450,60 +6320,61 @@ static int yy_get_next_buffer (void)
  * 
  * @note This function does not reset the start condition to @c INITIAL .
  */
-    void yyrestart  (FILE * input_file )
+    void yyrestart (FILE * input_file , yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	if ( ! YY_CURRENT_BUFFER ){
-        yyensure_buffer_stack ();
+        yyensure_buffer_stack( yyscanner );
 		YY_CURRENT_BUFFER_LVALUE =
-            yy_create_buffer( yyin, YY_BUF_SIZE );
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
 	}
 
-	yy_init_buffer( YY_CURRENT_BUFFER, input_file );
-	yy_load_buffer_state(  );
+	yy_init_buffer( YY_CURRENT_BUFFER, input_file , yyscanner);
+	yy_load_buffer_state( yyscanner );
 }
 
 /** Switch to a different input buffer.
  * @param new_buffer The new input buffer.
  * 
  */
-    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
+    void yy_switch_to_buffer (YY_BUFFER_STATE  new_buffer , yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	/* TODO. We should be able to replace this entire function body
 	 * with
 	 *		yypop_buffer_state();
 	 *		yypush_buffer_state(new_buffer);
      */
-	yyensure_buffer_stack ();
+	yyensure_buffer_stack( yyscanner );
 	if ( YY_CURRENT_BUFFER == new_buffer )
 		return;
 
 	if ( YY_CURRENT_BUFFER )
 		{
 		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
 	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-	yy_load_buffer_state(  );
+	yy_load_buffer_state( yyscanner );
 
 	/* We don't actually know whether we did this switch during
 	 * EOF (yywrap()) processing, but the only time this flag
 	 * is looked at is after yywrap() is called, so it's safe
 	 * to go ahead and always set it.
 	 */
-	(yy_did_buffer_switch_on_eof) = 1;
+	yyg->yy_did_buffer_switch_on_eof = 1;
 }
 
-static void yy_load_buffer_state  (void)
+static void yy_load_buffer_state (yyscan_t yyscanner)
 {
-    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+	yyg->yytext_ptr = yyg->yy_c_buf_p = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
 	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
-	(yy_hold_char) = *(yy_c_buf_p);
+	yyg->yy_hold_char = *yyg->yy_c_buf_p;
 }
 
 /** Allocate and initialize an input buffer state.
@@ -6512,11 +6383,11 @@ static void yy_load_buffer_state  (void)
  * 
  * @return the allocated buffer state.
  */
-    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size )
+    YY_BUFFER_STATE yy_create_buffer (FILE * file, int  size , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
     
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  , yyscanner);
 	if ( ! b )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
 
@@ -6525,13 +6396,13 @@ static void yy_load_buffer_state  (void)
 	/* yy_ch_buf has to be 2 characters longer than the size given because
 	 * we need to put in 2 end-of-buffer characters.
 	 */
-	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2)  );
+	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2)  , yyscanner);
 	if ( ! b->yy_ch_buf )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
 
 	b->yy_is_our_buffer = 1;
 
-	yy_init_buffer( b, file );
+	yy_init_buffer( b, file , yyscanner);
 
 	return b;
 }
@@ -6540,9 +6411,9 @@ static void yy_load_buffer_state  (void)
  * @param b a buffer created with yy_create_buffer()
  * 
  */
-    void yy_delete_buffer (YY_BUFFER_STATE  b )
+    void yy_delete_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	if ( ! b )
 		return;
 
@@ -6550,21 +6421,21 @@ static void yy_load_buffer_state  (void)
 		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
 
 	if ( b->yy_is_our_buffer )
-		yyfree( (void *) b->yy_ch_buf  );
+		yyfree( (void *) b->yy_ch_buf  , yyscanner);
 
-	yyfree( (void *) b  );
+	yyfree( (void *) b  , yyscanner);
 }
 
 /* Initializes or reinitializes a buffer.
  * This function is sometimes called more than once on the same buffer,
  * such as during a yyrestart() or at EOF.
  */
-    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
+    static void yy_init_buffer (YY_BUFFER_STATE  b, FILE * file , yyscan_t yyscanner)
 
 {
 	int oerrno = errno;
-    
-	yy_flush_buffer( b );
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	yy_flush_buffer( b , yyscanner);
 
 	b->yy_input_file = file;
 	b->yy_fill_buffer = 1;
@@ -6587,9 +6458,10 @@ static void yy_load_buffer_state  (void)
  * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
  * 
  */
-    void yy_flush_buffer (YY_BUFFER_STATE  b )
+    void yy_flush_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
 {
-    	if ( ! b )
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if ( ! b )
 		return;
 
 	b->yy_n_chars = 0;
@@ -6607,7 +6479,7 @@ static void yy_load_buffer_state  (void)
 	b->yy_buffer_status = YY_BUFFER_NEW;
 
 	if ( b == YY_CURRENT_BUFFER )
-		yy_load_buffer_state(  );
+		yy_load_buffer_state( yyscanner );
 }
 
 /** Pushes the new state onto the stack. The new state becomes
@@ -6616,95 +6488,97 @@ static void yy_load_buffer_state  (void)
  *  @param new_buffer The new state.
  *  
  */
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer )
+void yypush_buffer_state (YY_BUFFER_STATE new_buffer , yyscan_t yyscanner)
 {
-    	if (new_buffer == NULL)
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (new_buffer == NULL)
 		return;
 
-	yyensure_buffer_stack();
+	yyensure_buffer_stack( yyscanner );
 
 	/* This block is copied from yy_switch_to_buffer. */
 	if ( YY_CURRENT_BUFFER )
 		{
 		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
 	/* Only push if top exists. Otherwise, replace top. */
 	if (YY_CURRENT_BUFFER)
-		(yy_buffer_stack_top)++;
+		yyg->yy_buffer_stack_top++;
 	YY_CURRENT_BUFFER_LVALUE = new_buffer;
 
 	/* copied from yy_switch_to_buffer. */
-	yy_load_buffer_state(  );
-	(yy_did_buffer_switch_on_eof) = 1;
+	yy_load_buffer_state( yyscanner );
+	yyg->yy_did_buffer_switch_on_eof = 1;
 }
 
 /** Removes and deletes the top of the stack, if present.
  *  The next element becomes the new top.
  *  
  */
-void yypop_buffer_state (void)
+void yypop_buffer_state (yyscan_t yyscanner)
 {
-    	if (!YY_CURRENT_BUFFER)
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (!YY_CURRENT_BUFFER)
 		return;
 
-	yy_delete_buffer(YY_CURRENT_BUFFER );
+	yy_delete_buffer(YY_CURRENT_BUFFER , yyscanner);
 	YY_CURRENT_BUFFER_LVALUE = NULL;
-	if ((yy_buffer_stack_top) > 0)
-		--(yy_buffer_stack_top);
+	if (yyg->yy_buffer_stack_top > 0)
+		--yyg->yy_buffer_stack_top;
 
 	if (YY_CURRENT_BUFFER) {
-		yy_load_buffer_state(  );
-		(yy_did_buffer_switch_on_eof) = 1;
+		yy_load_buffer_state( yyscanner );
+		yyg->yy_did_buffer_switch_on_eof = 1;
 	}
 }
 
 /* Allocates the stack if it does not exist.
  *  Guarantees space for at least one push.
  */
-static void yyensure_buffer_stack (void)
+static void yyensure_buffer_stack (yyscan_t yyscanner)
 {
 	yy_size_t num_to_alloc;
-    
-	if (!(yy_buffer_stack)) {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (!yyg->yy_buffer_stack) {
 
 		/* First allocation is just for 2 elements, since we don't know if this
 		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
 		 * immediate realloc on the next call.
          */
       num_to_alloc = 1; /* After all that talk, this was set to 1 anyways... */
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyalloc
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyalloc
 								(num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
 			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
 
-		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
+		memset(yyg->yy_buffer_stack, 0, num_to_alloc * sizeof(struct yy_buffer_state*));
 
-		(yy_buffer_stack_max) = num_to_alloc;
-		(yy_buffer_stack_top) = 0;
+		yyg->yy_buffer_stack_max = num_to_alloc;
+		yyg->yy_buffer_stack_top = 0;
 		return;
 	}
 
-	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
+	if (yyg->yy_buffer_stack_top >= (yyg->yy_buffer_stack_max) - 1){
 
 		/* Increase the buffer to prepare for a possible push. */
 		yy_size_t grow_size = 8 /* arbitrary grow size */;
 
-		num_to_alloc = (yy_buffer_stack_max) + grow_size;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyrealloc
-								((yy_buffer_stack),
+		num_to_alloc = yyg->yy_buffer_stack_max + grow_size;
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyrealloc
+								(yyg->yy_buffer_stack,
 								num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
 			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
 
 		/* zero only the new slots.*/
-		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
-		(yy_buffer_stack_max) = num_to_alloc;
+		memset(yyg->yy_buffer_stack + yyg->yy_buffer_stack_max, 0, grow_size * sizeof(struct yy_buffer_state*));
+		yyg->yy_buffer_stack_max = num_to_alloc;
 	}
 }
 
@@ -6714,7 +6588,7 @@ static void yyensure_buffer_stack (void)
  * 
  * @return the newly allocated buffer state object.
  */
-YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
+YY_BUFFER_STATE yy_scan_buffer (char * base, yy_size_t  size , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
     
@@ -6724,7 +6598,7 @@ YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
 		/* They forgot to leave room for the EOB's. */
 		return NULL;
 
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  , yyscanner);
 	if ( ! b )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
 
@@ -6738,7 +6612,7 @@ YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
 	b->yy_fill_buffer = 0;
 	b->yy_buffer_status = YY_BUFFER_NEW;
 
-	yy_switch_to_buffer( b  );
+	yy_switch_to_buffer( b  , yyscanner);
 
 	return b;
 }
@@ -6751,10 +6625,10 @@ YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
  * @note If you want to scan bytes that may contain NUL values, then use
  *       yy_scan_bytes() instead.
  */
-YY_BUFFER_STATE yy_scan_string (const char * yystr )
+YY_BUFFER_STATE yy_scan_string (const char * yystr , yyscan_t yyscanner)
 {
     
-	return yy_scan_bytes( yystr, (int) strlen(yystr) );
+	return yy_scan_bytes( yystr, (int) strlen(yystr) , yyscanner);
 }
 
 /** Setup the input buffer state to scan the given bytes. The next call to yylex() will
@@ -6764,7 +6638,7 @@ YY_BUFFER_STATE yy_scan_string (const char * yystr )
  * 
  * @return the newly allocated buffer state object.
  */
-YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, yy_size_t  _yybytes_len )
+YY_BUFFER_STATE yy_scan_bytes (const char * yybytes, yy_size_t  _yybytes_len , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
 	char *buf;
@@ -6773,7 +6647,7 @@ YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, yy_size_t  _yybytes_len )
     
 	/* Get memory for full buffer, including space for trailing EOB's. */
 	n = (yy_size_t) (_yybytes_len + 2);
-	buf = (char *) yyalloc( n  );
+	buf = (char *) yyalloc( n  , yyscanner);
 	if ( ! buf )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
 
@@ -6782,7 +6656,7 @@ YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, yy_size_t  _yybytes_len )
 
 	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
 
-	b = yy_scan_buffer( buf, n );
+	b = yy_scan_buffer( buf, n , yyscanner);
 	if ( ! b )
 		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
 
@@ -6798,9 +6672,11 @@ YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, yy_size_t  _yybytes_len )
 #define YY_EXIT_FAILURE 2
 #endif
 
-static void yynoreturn yy_fatal_error (const char* msg )
+static void yynoreturn yy_fatal_error (const char* msg , yyscan_t yyscanner)
 {
-			fprintf( stderr, "%s\n", msg );
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	fprintf( stderr, "%s\n", msg );
 	exit( YY_EXIT_FAILURE );
 }
 
@@ -6813,109 +6689,261 @@ static void yynoreturn yy_fatal_error (const char* msg )
 		/* Undo effects of setting up yytext. */ \
         yy_size_t yyless_macro_arg = (n); \
         YY_LESS_LINENO(yyless_macro_arg);\
-		yytext[yyleng] = (yy_hold_char); \
-		(yy_c_buf_p) = yytext + yyless_macro_arg; \
-		(yy_hold_char) = *(yy_c_buf_p); \
-		*(yy_c_buf_p) = '\0'; \
+		yytext[yyleng] = yyg->yy_hold_char; \
+		yyg->yy_c_buf_p = yytext + yyless_macro_arg; \
+		yyg->yy_hold_char = *yyg->yy_c_buf_p; \
+		*yyg->yy_c_buf_p = '\0'; \
 		yyleng = yyless_macro_arg; \
 		} \
 	while ( 0 )
 
 /* Accessor  methods (get/set functions) to struct members. */
 
+/** Get the user-defined data for this scanner.
+ * @param yyscanner The scanner object.
+ */
+YY_EXTRA_TYPE yyget_extra  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyextra;
+}
+
 /** Get the current line number.
- * 
+ * @param yyscanner The scanner object.
  */
-int yyget_lineno  (void)
+int yyget_lineno  (yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+
     return yylineno;
 }
 
+/** Get the current column number.
+ * @param yyscanner The scanner object.
+ */
+int yyget_column  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+
+    return yycolumn;
+}
+
 /** Get the input stream.
- * 
+ * @param yyscanner The scanner object.
  */
-FILE *yyget_in  (void)
+FILE *yyget_in  (yyscan_t yyscanner)
 {
-        return yyin;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyin;
 }
 
 /** Get the output stream.
- * 
+ * @param yyscanner The scanner object.
  */
-FILE *yyget_out  (void)
+FILE *yyget_out  (yyscan_t yyscanner)
 {
-        return yyout;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyout;
 }
 
 /** Get the length of the current token.
- * 
+ * @param yyscanner The scanner object.
  */
-yy_size_t yyget_leng  (void)
+yy_size_t yyget_leng  (yyscan_t yyscanner)
 {
-        return yyleng;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyleng;
 }
 
 /** Get the current token.
- * 
+ * @param yyscanner The scanner object.
  */
 
-char *yyget_text  (void)
+char *yyget_text  (yyscan_t yyscanner)
 {
-        return yytext;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yytext;
+}
+
+/** Set the user-defined data. This data is never touched by the scanner.
+ * @param user_defined The data to be associated with this scanner.
+ * @param yyscanner The scanner object.
+ */
+void yyset_extra (YY_EXTRA_TYPE  user_defined , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyextra = user_defined ;
 }
 
 /** Set the current line number.
  * @param _line_number line number
- * 
+ * @param yyscanner The scanner object.
  */
-void yyset_lineno (int  _line_number )
+void yyset_lineno (int  _line_number , yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        /* lineno is only valid if an input buffer exists. */
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_lineno called with no buffer" );
+
     yylineno = _line_number;
 }
 
+/** Set the current column.
+ * @param _column_no column number
+ * @param yyscanner The scanner object.
+ */
+void yyset_column (int  _column_no , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        /* column is only valid if an input buffer exists. */
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_column called with no buffer" );
+
+    yycolumn = _column_no;
+}
+
 /** Set the input stream. This does not discard the current
  * input buffer.
  * @param _in_str A readable stream.
- * 
+ * @param yyscanner The scanner object.
  * @see yy_switch_to_buffer
  */
-void yyset_in (FILE *  _in_str )
+void yyset_in (FILE *  _in_str , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyin = _in_str ;
+}
+
+void yyset_out (FILE *  _out_str , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyout = _out_str ;
+}
+
+int yyget_debug  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yy_flex_debug;
+}
+
+void yyset_debug (int  _bdebug , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yy_flex_debug = _bdebug ;
+}
+
+/* Accessor methods for yylval and yylloc */
+
+YYSTYPE * yyget_lval  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yylval;
+}
+
+void yyset_lval (YYSTYPE *  yylval_param , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yylval = yylval_param;
+}
+
+YYLTYPE *yyget_lloc  (yyscan_t yyscanner)
 {
-        yyin = _in_str ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yylloc;
 }
 
-void yyset_out (FILE *  _out_str )
+void yyset_lloc (YYLTYPE *  yylloc_param , yyscan_t yyscanner)
 {
-        yyout = _out_str ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yylloc = yylloc_param;
 }
 
-int yyget_debug  (void)
+/* User-visible API */
+
+/* yylex_init is special because it creates the scanner itself, so it is
+ * the ONLY reentrant function that doesn't take the scanner as the last argument.
+ * That's why we explicitly handle the declaration, instead of using our macros.
+ */
+int yylex_init(yyscan_t* ptr_yy_globals)
 {
-        return yy_flex_debug;
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), NULL );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    /* By setting to 0xAA, we expose bugs in yy_init_globals. Leave at 0x00 for releases. */
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    return yy_init_globals ( *ptr_yy_globals );
 }
 
-void yyset_debug (int  _bdebug )
+/* yylex_init_extra has the same functionality as yylex_init, but follows the
+ * convention of taking the scanner as the last argument. Note however, that
+ * this is a *pointer* to a scanner, as it will be allocated by this call (and
+ * is the reason, too, why this function also must handle its own declaration).
+ * The user defined value in the first argument will be available to yyalloc in
+ * the yyextra field.
+ */
+int yylex_init_extra( YY_EXTRA_TYPE yy_user_defined, yyscan_t* ptr_yy_globals )
 {
-        yy_flex_debug = _bdebug ;
+    struct yyguts_t dummy_yyguts;
+
+    yyset_extra (yy_user_defined, &dummy_yyguts);
+
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), &dummy_yyguts );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    /* By setting to 0xAA, we expose bugs in
+    yy_init_globals. Leave at 0x00 for releases. */
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    yyset_extra (yy_user_defined, *ptr_yy_globals);
+
+    return yy_init_globals ( *ptr_yy_globals );
 }
 
-static int yy_init_globals (void)
+static int yy_init_globals (yyscan_t yyscanner)
 {
-        /* Initialization is the same as for the non-reentrant scanner.
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    /* Initialization is the same as for the non-reentrant scanner.
      * This function is called from yylex_destroy(), so don't allocate here.
      */
 
-    /* We do not touch yylineno unless the option is enabled. */
-    yylineno =  1;
-    
-    (yy_buffer_stack) = NULL;
-    (yy_buffer_stack_top) = 0;
-    (yy_buffer_stack_max) = 0;
-    (yy_c_buf_p) = NULL;
-    (yy_init) = 0;
-    (yy_start) = 0;
+    yyg->yy_buffer_stack = NULL;
+    yyg->yy_buffer_stack_top = 0;
+    yyg->yy_buffer_stack_max = 0;
+    yyg->yy_c_buf_p = NULL;
+    yyg->yy_init = 0;
+    yyg->yy_start = 0;
+
+    yyg->yy_start_stack_ptr = 0;
+    yyg->yy_start_stack_depth = 0;
+    yyg->yy_start_stack =  NULL;
 
 /* Defined in main.c */
 #ifdef YY_STDINIT
@@ -6933,24 +6961,32 @@ static int yy_init_globals (void)
 }
 
 /* yylex_destroy is for both reentrant and non-reentrant scanners. */
-int yylex_destroy  (void)
+int yylex_destroy  (yyscan_t yyscanner)
 {
-    
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
     /* Pop the buffer stack, destroying each element. */
 	while(YY_CURRENT_BUFFER){
-		yy_delete_buffer( YY_CURRENT_BUFFER  );
+		yy_delete_buffer( YY_CURRENT_BUFFER , yyscanner );
 		YY_CURRENT_BUFFER_LVALUE = NULL;
-		yypop_buffer_state();
+		yypop_buffer_state(yyscanner);
 	}
 
 	/* Destroy the stack itself. */
-	yyfree((yy_buffer_stack) );
-	(yy_buffer_stack) = NULL;
+	yyfree(yyg->yy_buffer_stack , yyscanner);
+	yyg->yy_buffer_stack = NULL;
+
+    /* Destroy the start condition stack. */
+        yyfree( yyg->yy_start_stack , yyscanner );
+        yyg->yy_start_stack = NULL;
 
     /* Reset the globals. This is important in a non-reentrant scanner so the next time
      * yylex() is called, initialization will occur. */
-    yy_init_globals( );
+    yy_init_globals( yyscanner);
 
+    /* Destroy the main struct (reentrant only). */
+    yyfree ( yyscanner , yyscanner );
+    yyscanner = NULL;
     return 0;
 }
 
@@ -6959,7 +6995,7 @@ int yylex_destroy  (void)
  */
 
 #ifndef yytext_ptr
-static void yy_flex_strncpy (char* s1, const char * s2, int n )
+static void yy_flex_strncpy (char* s1, const char * s2, int n , yyscan_t yyscanner)
 {
 		
 	int i;
@@ -6969,7 +7005,7 @@ static void yy_flex_strncpy (char* s1, const char * s2, int n )
 #endif
 
 #ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (const char * s )
+static int yy_flex_strlen (const char * s , yyscan_t yyscanner)
 {
 	int n;
 	for ( n = 0; s[n]; ++n )
@@ -6979,14 +7015,17 @@ static int yy_flex_strlen (const char * s )
 }
 #endif
 
-void *yyalloc (yy_size_t  size )
+void *yyalloc (yy_size_t  size , yyscan_t yyscanner)
 {
-			return malloc(size);
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	return malloc(size);
 }
 
-void *yyrealloc  (void * ptr, yy_size_t  size )
+void *yyrealloc (void * ptr, yy_size_t  size , yyscan_t yyscanner)
 {
-		
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
 	/* The cast to (char *) in the following accommodates both
 	 * implementations that use char* generic pointers, and those
 	 * that use void* generic pointers.  It works with the latter
@@ -6997,19 +7036,97 @@ void *yyrealloc  (void * ptr, yy_size_t  size )
 	return realloc(ptr, size);
 }
 
-void yyfree (void * ptr )
+void yyfree (void * ptr , yyscan_t yyscanner)
 {
-			free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
 }
 
 #define YYTABLES_NAME "yytables"
 
-#line 408 "chuck.lex"
-
+#line 343 "chuck.lex"
 
 // older
-// ([0-9]+"."[0-9]*)|([0-9]*"."[0-9]+) { adjust(); yylval.fval=atof(yytext); return FLOAT_VAL; }
-// \"(\\.|[^\\"])*\"       { adjust(); yylval.sval=alloc_str(strip_lit(yytext)); return STRING_LIT; }
-// `(\\.|[^\\`])*`         { adjust(); yylval.sval=alloc_str(strip_lit(yytext)); return STRING_LIT; }
-// '(\\.|[^\\'])'          { adjust(); yylval.sval=alloc_str(strip_lit(yytext)); return CHAR_LIT; }
+// ([0-9]+"."[0-9]*)|([0-9]*"."[0-9]+) { adjust( yyscanner ); yylval->fval=atof(yytext); return FLOAT_VAL; }
+// \"(\\.|[^\\"])*\"       { adjust( yyscanner ); yylval->sval=alloc_str(strip_lit(yytext)); return STRING_LIT; }
+// `(\\.|[^\\`])*`         { adjust( yyscanner ); yylval->sval=alloc_str(strip_lit(yytext)); return STRING_LIT; }
+// '(\\.|[^\\'])'          { adjust( yyscanner ); yylval->sval=alloc_str(strip_lit(yytext)); return CHAR_LIT; }
+
+
+// yycleanup | 1.5.0.5 (ge)
+void yycleanup( yyscan_t yyscanner )
+{
+    struct yyguts_t * yyg = (struct yyguts_t *)yyscanner;
+    // clean up the FILE
+    if( yyin )
+    {
+        fclose( yyin );
+        yyin = NULL;
+    }
+}
+
+// yyflush | 1.5.0.5 (ge)
+void yyflush( yyscan_t yyscanner )
+{
+    struct yyguts_t * yyg = (struct yyguts_t *)yyscanner;
+    // flush the buffer
+    YY_FLUSH_BUFFER;
+}
+
+// yyinitial | 1.5.0.5 (ge)
+// 1.5.5.3: call once the input is set (line and column belong to the
+// current buffer); the parser starts yylloc at line 1, column 0 itself
+void yyinitial( yyscan_t yyscanner )
+{
+    struct yyguts_t * yyg = (struct yyguts_t *)yyscanner;
+    // set to initial
+    BEGIN(YY_START);
+    // reset
+    yycolumn = 1;
+    EM_tokPos = yycolumn;
+    // 1.5.2.4 (ge) added
+    yylineno = 1;
+}
+
+// yywrap()
+int yywrap( yyscan_t yyscanner )
+{
+    struct yyguts_t * yyg = (struct yyguts_t *)yyscanner;
+    yycolumn = 1;
+    return 1;
+}
+
+// new line
+void a_newline( yyscan_t yyscanner )
+{
+    struct yyguts_t * yyg = (struct yyguts_t *)yyscanner;
+    EM_newline( yylloc->last_column, yylloc->last_line );
+}
+
+// manually advance
+void advance_m( yyscan_t yyscanner )
+{
+    struct yyguts_t * yyg = (struct yyguts_t *)yyscanner;
+    yycolumn++;
+    yylloc->first_column++;
+    yylloc->last_column++;
+}
+
+// adjust()
+void adjust( yyscan_t yyscanner )
+{
+    struct yyguts_t * yyg = (struct yyguts_t *)yyscanner;
+    // update tok pos
+    EM_tokPos = yylloc->first_column;
+
+    // handy debug print for precise position and bounds of each token
+    // fprintf( stderr, "yylloc: %d %d %d %d ------ %s\n", yylloc->first_line, yycolumn, yylloc->last_line, yylloc->last_column, yytext );
+}
 
+// for debugging (string literals, especially multi-line strings)
+void testLineNumPrint( yyscan_t yyscanner )
+{
+    struct yyguts_t * yyg = (struct yyguts_t *)yyscanner;
+    fprintf( stderr, "TEST: %ld %i\n", EM_lineNum, yylloc->last_line );
+}
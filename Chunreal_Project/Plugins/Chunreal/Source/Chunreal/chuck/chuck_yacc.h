@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton interface for Bison's Yacc-like parsers in C
+/* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,261 +31,158 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Tokens.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_CHUCK_TAB_H_INCLUDED
+# define YY_YY_CHUCK_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     ID = 258,
-     STRING_LIT = 259,
-     CHAR_LIT = 260,
-     INT_VAL = 261,
-     FLOAT_VAL = 262,
-     POUND = 263,
-     COMMA = 264,
-     COLON = 265,
-     SEMICOLON = 266,
-     LPAREN = 267,
-     RPAREN = 268,
-     LBRACK = 269,
-     RBRACK = 270,
-     LBRACE = 271,
-     RBRACE = 272,
-     DOT = 273,
-     PLUS = 274,
-     MINUS = 275,
-     TIMES = 276,
-     DIVIDE = 277,
-     PERCENT = 278,
-     EQ = 279,
-     NEQ = 280,
-     LT = 281,
-     LE = 282,
-     GT = 283,
-     GE = 284,
-     AND = 285,
-     OR = 286,
-     ASSIGN = 287,
-     IF = 288,
-     THEN = 289,
-     ELSE = 290,
-     WHILE = 291,
-     FOR = 292,
-     DO = 293,
-     LOOP = 294,
-     BREAK = 295,
-     CONTINUE = 296,
-     NULL_TOK = 297,
-     FUNCTION = 298,
-     RETURN = 299,
-     QUESTION = 300,
-     EXCLAMATION = 301,
-     S_OR = 302,
-     S_AND = 303,
-     S_XOR = 304,
-     PLUSPLUS = 305,
-     MINUSMINUS = 306,
-     DOLLAR = 307,
-     POUNDPAREN = 308,
-     PERCENTPAREN = 309,
-     ATPAREN = 310,
-     SIMULT = 311,
-     PATTERN = 312,
-     CODE = 313,
-     TRANSPORT = 314,
-     HOST = 315,
-     TIME = 316,
-     WHENEVER = 317,
-     NEXT = 318,
-     UNTIL = 319,
-     EXTERNAL = 320,
-     GLOBAL = 321,
-     EVERY = 322,
-     BEFORE = 323,
-     AFTER = 324,
-     AT = 325,
-     AT_SYM = 326,
-     ATAT_SYM = 327,
-     NEW = 328,
-     SIZEOF = 329,
-     TYPEOF = 330,
-     SAME = 331,
-     PLUS_CHUCK = 332,
-     MINUS_CHUCK = 333,
-     TIMES_CHUCK = 334,
-     DIVIDE_CHUCK = 335,
-     S_AND_CHUCK = 336,
-     S_OR_CHUCK = 337,
-     S_XOR_CHUCK = 338,
-     SHIFT_RIGHT_CHUCK = 339,
-     SHIFT_LEFT_CHUCK = 340,
-     PERCENT_CHUCK = 341,
-     SHIFT_RIGHT = 342,
-     SHIFT_LEFT = 343,
-     TILDA = 344,
-     CHUCK = 345,
-     COLONCOLON = 346,
-     S_CHUCK = 347,
-     AT_CHUCK = 348,
-     LEFT_S_CHUCK = 349,
-     UNCHUCK = 350,
-     UPCHUCK = 351,
-     DOWNCHUCK = 352,
-     CLASS = 353,
-     INTERFACE = 354,
-     EXTENDS = 355,
-     IMPLEMENTS = 356,
-     PUBLIC = 357,
-     PROTECTED = 358,
-     PRIVATE = 359,
-     STATIC = 360,
-     ABSTRACT = 361,
-     CONST = 362,
-     SPORK = 363,
-     ARROW_RIGHT = 364,
-     ARROW_LEFT = 365,
-     L_HACK = 366,
-     R_HACK = 367,
-     GRUCK_RIGHT = 368,
-     GRUCK_LEFT = 369,
-     UNGRUCK_RIGHT = 370,
-     UNGRUCK_LEFT = 371,
-     AT_OP = 372,
-     AT_CTOR = 373,
-     AT_DTOR = 374,
-     AT_IMPORT = 375,
-     AT_DOC = 376
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ID = 258,                      /* ID  */
+    STRING_LIT = 259,              /* STRING_LIT  */
+    CHAR_LIT = 260,                /* CHAR_LIT  */
+    INT_VAL = 261,                 /* INT_VAL  */
+    FLOAT_VAL = 262,               /* FLOAT_VAL  */
+    POUND = 263,                   /* POUND  */
+    COMMA = 264,                   /* COMMA  */
+    COLON = 265,                   /* COLON  */
+    SEMICOLON = 266,               /* SEMICOLON  */
+    LPAREN = 267,                  /* LPAREN  */
+    RPAREN = 268,                  /* RPAREN  */
+    LBRACK = 269,                  /* LBRACK  */
+    RBRACK = 270,                  /* RBRACK  */
+    LBRACE = 271,                  /* LBRACE  */
+    RBRACE = 272,                  /* RBRACE  */
+    DOT = 273,                     /* DOT  */
+    PLUS = 274,                    /* PLUS  */
+    MINUS = 275,                   /* MINUS  */
+    TIMES = 276,                   /* TIMES  */
+    DIVIDE = 277,                  /* DIVIDE  */
+    PERCENT = 278,                 /* PERCENT  */
+    EQ = 279,                      /* EQ  */
+    NEQ = 280,                     /* NEQ  */
+    LT = 281,                      /* LT  */
+    LE = 282,                      /* LE  */
+    GT = 283,                      /* GT  */
+    GE = 284,                      /* GE  */
+    AND = 285,                     /* AND  */
+    OR = 286,                      /* OR  */
+    ASSIGN = 287,                  /* ASSIGN  */
+    IF = 288,                      /* IF  */
+    THEN = 289,                    /* THEN  */
+    ELSE = 290,                    /* ELSE  */
+    WHILE = 291,                   /* WHILE  */
+    FOR = 292,                     /* FOR  */
+    DO = 293,                      /* DO  */
+    LOOP = 294,                    /* LOOP  */
+    BREAK = 295,                   /* BREAK  */
+    CONTINUE = 296,                /* CONTINUE  */
+    NULL_TOK = 297,                /* NULL_TOK  */
+    FUNCTION = 298,                /* FUNCTION  */
+    RETURN = 299,                  /* RETURN  */
+    QUESTION = 300,                /* QUESTION  */
+    EXCLAMATION = 301,             /* EXCLAMATION  */
+    S_OR = 302,                    /* S_OR  */
+    S_AND = 303,                   /* S_AND  */
+    S_XOR = 304,                   /* S_XOR  */
+    PLUSPLUS = 305,                /* PLUSPLUS  */
+    MINUSMINUS = 306,              /* MINUSMINUS  */
+    DOLLAR = 307,                  /* DOLLAR  */
+    POUNDPAREN = 308,              /* POUNDPAREN  */
+    PERCENTPAREN = 309,            /* PERCENTPAREN  */
+    ATPAREN = 310,                 /* ATPAREN  */
+    SIMULT = 311,                  /* SIMULT  */
+    PATTERN = 312,                 /* PATTERN  */
+    CODE = 313,                    /* CODE  */
+    TRANSPORT = 314,               /* TRANSPORT  */
+    HOST = 315,                    /* HOST  */
+    TIME = 316,                    /* TIME  */
+    WHENEVER = 317,                /* WHENEVER  */
+    NEXT = 318,                    /* NEXT  */
+    UNTIL = 319,                   /* UNTIL  */
+    EXTERNAL = 320,                /* EXTERNAL  */
+    GLOBAL = 321,                  /* GLOBAL  */
+    EVERY = 322,                   /* EVERY  */
+    BEFORE = 323,                  /* BEFORE  */
+    AFTER = 324,                   /* AFTER  */
+    AT = 325,                      /* AT  */
+    AT_SYM = 326,                  /* AT_SYM  */
+    ATAT_SYM = 327,                /* ATAT_SYM  */
+    NEW = 328,                     /* NEW  */
+    SIZEOF = 329,                  /* SIZEOF  */
+    TYPEOF = 330,                  /* TYPEOF  */
+    SAME = 331,                    /* SAME  */
+    PLUS_CHUCK = 332,              /* PLUS_CHUCK  */
+    MINUS_CHUCK = 333,             /* MINUS_CHUCK  */
+    TIMES_CHUCK = 334,             /* TIMES_CHUCK  */
+    DIVIDE_CHUCK = 335,            /* DIVIDE_CHUCK  */
+    S_AND_CHUCK = 336,             /* S_AND_CHUCK  */
+    S_OR_CHUCK = 337,              /* S_OR_CHUCK  */
+    S_XOR_CHUCK = 338,             /* S_XOR_CHUCK  */
+    SHIFT_RIGHT_CHUCK = 339,       /* SHIFT_RIGHT_CHUCK  */
+    SHIFT_LEFT_CHUCK = 340,        /* SHIFT_LEFT_CHUCK  */
+    PERCENT_CHUCK = 341,           /* PERCENT_CHUCK  */
+    SHIFT_RIGHT = 342,             /* SHIFT_RIGHT  */
+    SHIFT_LEFT = 343,              /* SHIFT_LEFT  */
+    TILDA = 344,                   /* TILDA  */
+    CHUCK = 345,                   /* CHUCK  */
+    COLONCOLON = 346,              /* COLONCOLON  */
+    S_CHUCK = 347,                 /* S_CHUCK  */
+    AT_CHUCK = 348,                /* AT_CHUCK  */
+    LEFT_S_CHUCK = 349,            /* LEFT_S_CHUCK  */
+    UNCHUCK = 350,                 /* UNCHUCK  */
+    UPCHUCK = 351,                 /* UPCHUCK  */
+    DOWNCHUCK = 352,               /* DOWNCHUCK  */
+    CLASS = 353,                   /* CLASS  */
+    INTERFACE = 354,               /* INTERFACE  */
+    EXTENDS = 355,                 /* EXTENDS  */
+    IMPLEMENTS = 356,              /* IMPLEMENTS  */
+    PUBLIC = 357,                  /* PUBLIC  */
+    PROTECTED = 358,               /* PROTECTED  */
+    PRIVATE = 359,                 /* PRIVATE  */
+    STATIC = 360,                  /* STATIC  */
+    ABSTRACT = 361,                /* ABSTRACT  */
+    CONST = 362,                   /* CONST  */
+    SPORK = 363,                   /* SPORK  */
+    ARROW_RIGHT = 364,             /* ARROW_RIGHT  */
+    ARROW_LEFT = 365,              /* ARROW_LEFT  */
+    L_HACK = 366,                  /* L_HACK  */
+    R_HACK = 367,                  /* R_HACK  */
+    GRUCK_RIGHT = 368,             /* GRUCK_RIGHT  */
+    GRUCK_LEFT = 369,              /* GRUCK_LEFT  */
+    UNGRUCK_RIGHT = 370,           /* UNGRUCK_RIGHT  */
+    UNGRUCK_LEFT = 371,            /* UNGRUCK_LEFT  */
+    AT_OP = 372,                   /* AT_OP  */
+    AT_CTOR = 373,                 /* AT_CTOR  */
+    AT_DTOR = 374,                 /* AT_DTOR  */
+    AT_IMPORT = 375,               /* AT_IMPORT  */
+    AT_DOC = 376                   /* AT_DOC  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
-#define ID 258
-#define STRING_LIT 259
-#define CHAR_LIT 260
-#define INT_VAL 261
-#define FLOAT_VAL 262
-#define POUND 263
-#define COMMA 264
-#define COLON 265
-#define SEMICOLON 266
-#define LPAREN 267
-#define RPAREN 268
-#define LBRACK 269
-#define RBRACK 270
-#define LBRACE 271
-#define RBRACE 272
-#define DOT 273
-#define PLUS 274
-#define MINUS 275
-#define TIMES 276
-#define DIVIDE 277
-#define PERCENT 278
-#define EQ 279
-#define NEQ 280
-#define LT 281
-#define LE 282
-#define GT 283
-#define GE 284
-#define AND 285
-#define OR 286
-#define ASSIGN 287
-#define IF 288
-#define THEN 289
-#define ELSE 290
-#define WHILE 291
-#define FOR 292
-#define DO 293
-#define LOOP 294
-#define BREAK 295
-#define CONTINUE 296
-#define NULL_TOK 297
-#define FUNCTION 298
-#define RETURN 299
-#define QUESTION 300
-#define EXCLAMATION 301
-#define S_OR 302
-#define S_AND 303
-#define S_XOR 304
-#define PLUSPLUS 305
-#define MINUSMINUS 306
-#define DOLLAR 307
-#define POUNDPAREN 308
-#define PERCENTPAREN 309
-#define ATPAREN 310
-#define SIMULT 311
-#define PATTERN 312
-#define CODE 313
-#define TRANSPORT 314
-#define HOST 315
-#define TIME 316
-#define WHENEVER 317
-#define NEXT 318
-#define UNTIL 319
-#define EXTERNAL 320
-#define GLOBAL 321
-#define EVERY 322
-#define BEFORE 323
-#define AFTER 324
-#define AT 325
-#define AT_SYM 326
-#define ATAT_SYM 327
-#define NEW 328
-#define SIZEOF 329
-#define TYPEOF 330
-#define SAME 331
-#define PLUS_CHUCK 332
-#define MINUS_CHUCK 333
-#define TIMES_CHUCK 334
-#define DIVIDE_CHUCK 335
-#define S_AND_CHUCK 336
-#define S_OR_CHUCK 337
-#define S_XOR_CHUCK 338
-#define SHIFT_RIGHT_CHUCK 339
-#define SHIFT_LEFT_CHUCK 340
-#define PERCENT_CHUCK 341
-#define SHIFT_RIGHT 342
-#define SHIFT_LEFT 343
-#define TILDA 344
-#define CHUCK 345
-#define COLONCOLON 346
-#define S_CHUCK 347
-#define AT_CHUCK 348
-#define LEFT_S_CHUCK 349
-#define UNCHUCK 350
-#define UPCHUCK 351
-#define DOWNCHUCK 352
-#define CLASS 353
-#define INTERFACE 354
-#define EXTENDS 355
-#define IMPLEMENTS 356
-#define PUBLIC 357
-#define PROTECTED 358
-#define PRIVATE 359
-#define STATIC 360
-#define ABSTRACT 361
-#define CONST 362
-#define SPORK 363
-#define ARROW_RIGHT 364
-#define ARROW_LEFT 365
-#define L_HACK 366
-#define R_HACK 367
-#define GRUCK_RIGHT 368
-#define GRUCK_LEFT 369
-#define UNGRUCK_RIGHT 370
-#define UNGRUCK_LEFT 371
-#define AT_OP 372
-#define AT_CTOR 373
-#define AT_DTOR 374
-#define AT_IMPORT 375
-#define AT_DOC 376
-
-
-
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 77 "chuck.y"
+union YYSTYPE
 {
+#line 76 "chuck.y"
+
     int pos;
     int ival;
     double fval;
@@ -313,28 +208,33 @@ typedef union YYSTYPE
     a_Vec vec_exp; // ge: added 1.3.5.3
     a_Import import; // 1.5.4.0 (ge) added
     a_Doc doc; // 1.5.4.4 (ge) added
-}
-/* Line 1529 of yacc.c.  */
-#line 319 "chuck.tab.h"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+
+#line 213 "chuck.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
-extern YYSTYPE yylval;
-
+/* Location type.  */
 #if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
 {
   int first_line;
   int first_column;
   int last_line;
   int last_column;
-} YYLTYPE;
-# define yyltype YYLTYPE /* obsolescent; will be withdrawn */
+};
 # define YYLTYPE_IS_DECLARED 1
 # define YYLTYPE_IS_TRIVIAL 1
 #endif
 
-extern YYLTYPE yylloc;
+
+
+
+int yyparse (void * scanner);
+
+
+#endif /* !YY_YY_CHUCK_TAB_H_INCLUDED  */
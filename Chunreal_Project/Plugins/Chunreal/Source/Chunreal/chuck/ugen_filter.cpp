@@ -36,6 +36,7 @@
 #include "chuck_type.h"
 #include "chuck_compile.h"
 #include "chuck_instr.h"
+#include "util_simd.h" // 1.5.5.3
 #include <math.h>
 #include <stdlib.h>
 
@@ -127,6 +128,15 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     func->doc = "set filter frequency and resonance at the same time.";
     if( !type_engine_import_mfun( env, func ) ) goto error;
 
+    // smooth | 1.5.5.3 (added)
+    func = make_new_mfun( "dur", "smooth", FilterBasic_ctrl_smooth );
+    func->add_arg( "dur", "value" );
+    func->doc = "set how long changes to freq and Q take to glide in, in whole samples; the default, 0, applies them at once.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "dur", "smooth", FilterBasic_cget_smooth );
+    func->doc = "get how long changes to freq and Q take to glide in.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
     // end the class import
     type_engine_import_class_end( env );
 
@@ -176,6 +186,9 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "BPF", "FilterBasic", env->global(),
                                         BPF_ctor, NULL, BPF_tick, BPF_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, FilterBasic_tickv ) ) goto error;
+    if( !type_engine_import_ugen_tickvn( env, FilterBasic_tickvn ) ) goto error;
 
     type_engine_import_add_ex(env, "filter/bpf.ck");
 
@@ -215,6 +228,9 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "BRF", "FilterBasic", env->global(),
                                         BRF_ctor, NULL, BRF_tick, BRF_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, FilterBasic_tickv ) ) goto error;
+    if( !type_engine_import_ugen_tickvn( env, FilterBasic_tickvn ) ) goto error;
 
     type_engine_import_add_ex(env, "filter/brf.ck");
 
@@ -254,6 +270,9 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "LPF", "FilterBasic", env->global(),
                                         RLPF_ctor, NULL, RLPF_tick, RLPF_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, FilterBasic_tickv ) ) goto error;
+    if( !type_engine_import_ugen_tickvn( env, FilterBasic_tickvn ) ) goto error;
 
     // add examples
     type_engine_import_add_ex(env, "filter/lpf.ck");
@@ -296,6 +315,9 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "HPF", "FilterBasic", env->global(),
                                         RHPF_ctor, NULL, RHPF_tick, RHPF_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, FilterBasic_tickv ) ) goto error;
+    if( !type_engine_import_ugen_tickvn( env, FilterBasic_tickvn ) ) goto error;
 
     // add examples
     type_engine_import_add_ex(env, "filter/hpf.ck");
@@ -337,6 +359,9 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "ResonZ", "FilterBasic", env->global(),
                                         ResonZ_ctor, NULL, ResonZ_tick, ResonZ_pmsg, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, FilterBasic_tickv ) ) goto error;
+    if( !type_engine_import_ugen_tickvn( env, FilterBasic_tickvn ) ) goto error;
 
     // freq
     func = make_new_mfun( "float", "freq", ResonZ_ctrl_freq );
@@ -377,6 +402,9 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "BiQuad", "UGen", env->global(),
                                         biquad_ctor, biquad_dtor, biquad_tick, NULL, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, biquad_tickv ) ) goto error;
+    if( !type_engine_import_ugen_tickvn( env, biquad_tickvn ) ) goto error;
 
     // member variable
     biquad_offset_data = type_engine_import_mvar ( env, "int", "@biquad_data", FALSE );
@@ -500,6 +528,15 @@ DLL_QUERY filter_query( Chuck_DL_Query * QUERY )
     func->doc = "get filter coefficient.";
     if( !type_engine_import_mfun( env, func ) ) goto error;
 
+    // smooth | 1.5.5.3 (added)
+    func = make_new_mfun( "dur", "smooth", biquad_ctrl_smooth );
+    func->add_arg( "dur", "value" );
+    func->doc = "set how long coefficient changes take to glide in, in whole samples; the default, 0, applies them at once.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+    func = make_new_mfun( "dur", "smooth", biquad_cget_smooth );
+    func->doc = "get how long coefficient changes take to glide in.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
     // end the class import
     type_engine_import_class_end( env );
 
@@ -728,145 +765,142 @@ struct Filter_data
 
 
 //-----------------------------------------------------------------------------
-// name: FilterBasic_data
-// desc: ...
+// name: Filter_biquad | 1.5.5.3 (added)
+// desc: a biquad section (see ck_biquad in util_simd.h) whose coefficients
+//       can glide to new values, linearly over a set number of samples;
+//       every point on a line between two stable biquads is stable (the
+//       stability triangle is convex); without a glide, new coefficients
+//       take over the state as is, as they did before 1.5.5.3
 //-----------------------------------------------------------------------------
-struct FilterBasic_data
+struct Filter_biquad
 {
-    // much of this implementation is adapted or copied outright from SC3
-    SAMPLE m_y1;
-    SAMPLE m_y2;
-    SAMPLE m_a0;
-    SAMPLE m_b1;
-    SAMPLE m_b2;
-    t_CKFLOAT m_freq;
-    t_CKFLOAT m_Q;
-    t_CKFLOAT m_db;
+    // state and coefficients now
+    ck_biquad bq;
+    // glide target and per-sample step, as g n0 n1 n2 d1 d2
+    t_CKFLOAT to[6];
+    t_CKFLOAT step[6];
+    // samples to glide over; samples left
+    t_CKUINT glide;
+    t_CKUINT left;
+    // set at least once (the first coefficients don't glide)
+    t_CKBOOL primed;
 
-    // desperation debug tools
-    /*
-    bool blowup;
-    t_CKFLOAT XQ;
-    t_CKFLOAT Xpbw;
-    t_CKFLOAT Xqres;
-    t_CKFLOAT Xpfreq;
-    t_CKFLOAT XD;
-    t_CKFLOAT XC;
-    t_CKFLOAT Xcosf;
-    t_CKFLOAT Xnext_b1;
-    t_CKFLOAT Xnext_b2;
-    t_CKFLOAT Xnext_a0;
-    */
+    // new coefficients, as g n0 n1 n2 d1 d2
+    void retarget( const t_CKFLOAT * c )
+    {
+        for( t_CKUINT i = 0; i < 6; i++ ) to[i] = c[i];
+        if( !glide || !primed )
+        {
+            set( c );
+            left = 0; primed = TRUE;
+            return;
+        }
+        step[0] = (c[0] - bq.g) / glide; step[1] = (c[1] - bq.n0) / glide;
+        step[2] = (c[2] - bq.n1) / glide; step[3] = (c[3] - bq.n2) / glide;
+        step[4] = (c[4] - bq.d1) / glide; step[5] = (c[5] - bq.d2) / glide;
+        left = glide;
+    }
 
-    // tick_lpf
-    inline SAMPLE tick_lpf( SAMPLE in )
+    // coefficients now
+    inline void set( const t_CKFLOAT * c )
     {
-        SAMPLE y0, result;
+        bq.g = c[0]; bq.n0 = c[1]; bq.n1 = c[2]; bq.n2 = c[3]; bq.d1 = c[4]; bq.d2 = c[5];
+    }
 
-        // go: adapted from SC3's LPF
-        y0 = in + m_b1 * m_y1 + m_b2 * m_y2;
-        result = m_a0 * (y0 + 2 * m_y1 + m_y2);
-        m_y2 = m_y1;
-        m_y1 = y0;
+    // one sample further along the glide; lands exactly on the target
+    inline void advance()
+    {
+        if( --left == 0 ) { set( to ); return; }
+        bq.g += step[0]; bq.n0 += step[1]; bq.n1 += step[2]; bq.n2 += step[3];
+        bq.d1 += step[4]; bq.d2 += step[5];
+    }
 
-        // be normal
-        CK_DDN(m_y1);
-        CK_DDN(m_y2);
+    // one sample
+    inline SAMPLE tick( SAMPLE in )
+    {
+        if( left ) advance();
+        SAMPLE y = ck_biquad_tick( &bq, in );
+        ck_biquad_ddn( &bq );
+        return y;
+    }
 
-        return result;
+    // a block; per sample only while gliding
+    inline void tickv( const SAMPLE * in, SAMPLE * out, t_CKUINT n )
+    {
+        t_CKUINT i = 0;
+        for( ; i < n && left; i++ )
+        {
+            advance();
+            out[i] = ck_biquad_tick( &bq, in[i] );
+        }
+        if( i < n ) ck_biquad_v( &bq, in + i, out + i, n - i );
+        else ck_biquad_ddn( &bq );
     }
 
-    // tick_hpf
-    inline SAMPLE tick_hpf( SAMPLE in )
+    // at rest: not gliding, and the state has decayed below CK_TICK_FLOOR
+    // (then flushed to zero), so zero input gives zero output from here on
+    inline t_CKBOOL rest()
     {
-        SAMPLE y0, result;
+        if( left || fabs( bq.w1 ) >= CK_TICK_FLOOR || fabs( bq.w2 ) >= CK_TICK_FLOOR
+            || fabs( bq.y1 ) >= CK_TICK_FLOOR || fabs( bq.y2 ) >= CK_TICK_FLOOR )
+            return FALSE;
+        bq.w1 = bq.w2 = bq.y1 = bq.y2 = 0;
+        return TRUE;
+    }
+};
 
-        // go: adapted from SC3's HPF
-        y0 = in + m_b1 * m_y1 + m_b2 * m_y2;
-        result = m_a0 * (y0 - 2 * m_y1 + m_y2);
-        m_y2 = m_y1;
-        m_y1 = y0;
 
-        // be normal
-        CK_DDN(m_y1);
-        CK_DDN(m_y2);
 
-        return result;
-    }
 
-    // set_bpf
-    inline void set_bpf( t_CKFLOAT freq, t_CKFLOAT Q )
-    {
-        t_CKFLOAT pfreq = freq * g_radians_per_sample;
-        t_CKFLOAT pbw = 1.0 / Q * pfreq * .5;
+//-----------------------------------------------------------------------------
+// name: FilterBasic_data
+// desc: ...
+//-----------------------------------------------------------------------------
+struct FilterBasic_data
+{
+    // much of this implementation is adapted or copied outright from SC3;
+    // 1.5.5.3: set_*() only note the parameters, and the coefficients are
+    // designed at the next tick, so a burst of changes (or a change every
+    // sample, in a block) costs one design; the SC3 forms all run as a
+    // direct form II section, as before (see design())
+    Filter_biquad m_f;
+    t_CKFLOAT m_freq;
+    t_CKFLOAT m_Q;
+    t_CKFLOAT m_db;
+    // which design; design pending
+    t_CKUINT m_kind;
+    t_CKBOOL m_stale;
 
-        t_CKFLOAT C = 1.0 / ::tan(pbw);
-        t_CKFLOAT D = 2.0 * ::cos(pfreq);
-        t_CKFLOAT next_a0 = 1.0 / (1.0 + C);
-        t_CKFLOAT next_b1 = C * D * next_a0 ;
-        t_CKFLOAT next_b2 = (1.0 - C) * next_a0;
+    enum { NONE = 0, LPF, HPF, BPF, BRF, RLPF, RHPF, RESONZ };
 
+    // set_lpf (butterworth; the old LPF)
+    inline void set_lpf( t_CKFLOAT freq )
+    {
         m_freq = freq;
-        m_Q = Q;
-        m_a0 = (SAMPLE)next_a0;
-        m_b1 = (SAMPLE)next_b1;
-        m_b2 = (SAMPLE)next_b2;
+        m_kind = LPF; m_stale = TRUE;
     }
 
-    // tick_bpf
-    inline SAMPLE tick_bpf( SAMPLE in )
+    // set_hpf (butterworth; the old HPF)
+    inline void set_hpf( t_CKFLOAT freq )
     {
-        SAMPLE y0, result;
-
-        // go: adapted from SC3's LPF
-        y0 = in + m_b1 * m_y1 + m_b2 * m_y2;
-        result = m_a0 * (y0 - m_y2);
-        m_y2 = m_y1;
-        m_y1 = y0;
-
-        // be normal
-        CK_DDN(m_y1);
-        CK_DDN(m_y2);
-
-        return result;
+        m_freq = freq;
+        m_kind = HPF; m_stale = TRUE;
     }
 
-    // set_brf
-    inline void set_brf( t_CKFLOAT freq, t_CKFLOAT Q )
+    // set_bpf
+    inline void set_bpf( t_CKFLOAT freq, t_CKFLOAT Q )
     {
-        t_CKFLOAT pfreq = freq * g_radians_per_sample;
-        t_CKFLOAT pbw = 1.0 / Q * pfreq * .5;
-
-        t_CKFLOAT C = ::tan(pbw);
-        t_CKFLOAT D = 2.0 * ::cos(pfreq);
-        t_CKFLOAT next_a0 = 1.0 / (1.0 + C);
-        t_CKFLOAT next_b1 = -D * next_a0 ;
-        t_CKFLOAT next_b2 = (1.f - C) * next_a0;
-
         m_freq = freq;
         m_Q = Q;
-        m_a0 = (SAMPLE)next_a0;
-        m_b1 = (SAMPLE)next_b1;
-        m_b2 = (SAMPLE)next_b2;
+        m_kind = BPF; m_stale = TRUE;
     }
 
-    // tick_brf
-    inline SAMPLE tick_brf( SAMPLE in )
+    // set_brf
+    inline void set_brf( t_CKFLOAT freq, t_CKFLOAT Q )
     {
-        SAMPLE y0, result;
-
-        // go: adapted from SC3's HPF
-        // b1 is actually a1
-        y0 = in - m_b1 * m_y1 - m_b2 * m_y2;
-        result = m_a0 * (y0 + m_y2) + m_b1 * m_y1;
-        m_y2 = m_y1;
-        m_y1 = y0;
-
-        // be normal
-        CK_DDN(m_y1);
-        CK_DDN(m_y2);
-
-        return result;
+        m_freq = freq;
+        m_Q = Q;
+        m_kind = BRF; m_stale = TRUE;
     }
 
     // set_rlpf
@@ -877,73 +911,9 @@ struct FilterBasic_data
         freq = ck_min(g_srateFilter /2, freq );
         Q = ck_max( 1, Q );
 
-        t_CKFLOAT qres = ck_max( .001, 1.0/Q );
-        t_CKFLOAT pfreq = freq * g_radians_per_sample;
-
-        t_CKFLOAT D = ::tan(pfreq * qres * 0.5);
-        t_CKFLOAT C = (1.0 - D) / (1.0 + D);
-        t_CKFLOAT cosf = ::cos(pfreq);
-        t_CKFLOAT next_b1 = (1.0 + C) * cosf;
-        t_CKFLOAT next_b2 = -C;
-        t_CKFLOAT next_a0 = (1.0 + C - next_b1) * 0.25;
-
         m_freq = freq;
-        m_Q = 1.0 / qres;
-        m_a0 = (SAMPLE)next_a0;
-        m_b1 = (SAMPLE)next_b1;
-        m_b2 = (SAMPLE)next_b2;
-
-        // desperation debug measure part 1
-        /*
-        XQ = Q;
-        Xqres = qres;
-        Xpfreq = pfreq;
-        XD = D;
-        XC = C;
-        Xcosf = cosf;
-        Xnext_b1 = next_b1;
-        Xnext_b2 = next_b2;
-        Xnext_a0 = next_a0;
-        */
-    }
-
-    // tick_rlpf
-    inline SAMPLE tick_rlpf( SAMPLE in )
-    {
-        SAMPLE y0, result;
-
-        // go: adapated from SC3's RLPF
-        y0 = m_a0 * in + m_b1 * m_y1 + m_b2 * m_y2;
-        result = y0 + 2 * m_y1 + m_y2;
-        m_y2 = m_y1;
-        m_y1 = y0;
-
-        // be normal
-        CK_DDN(m_y1);
-        CK_DDN(m_y2);
-
-        // desperation debug measure part 2
-        // --> finding: LPF and HPF seen to be blow up when freq < 1
-        /*
-        if( fabs(result) > 1 )
-        {
-            std::cerr << "blow up: " << result << " " << m_freq << " " << m_Q << std::endl;
-            blowup = true;
-
-            std::cerr
-            << " Q: " << XQ
-            << " qres: " << Xqres
-            << " pfreq: " << Xpfreq
-            << " D: " << XD
-            << " C: " << XC
-            << " cosf: " << Xcosf
-            << " next_b1: " << Xnext_b1
-            << " next_b2: " << Xnext_b2
-            << " next_a0: " << Xnext_a0 << std::endl;
-        }
-        */
-
-        return result;
+        m_Q = 1.0 / ck_max( .001, 1.0/Q );
+        m_kind = RLPF; m_stale = TRUE;
     }
 
     // set_rhpf
@@ -954,79 +924,120 @@ struct FilterBasic_data
         freq = ck_min(g_srateFilter /2, freq );
         Q = ck_max( 1, Q );
 
-        t_CKFLOAT qres = ck_max( .001, 1.0/Q );
-        t_CKFLOAT pfreq = freq * g_radians_per_sample;
-
-        t_CKFLOAT D = ::tan(pfreq * qres * 0.5);
-        t_CKFLOAT C = (1.0 - D) / (1.0 + D);
-        t_CKFLOAT cosf = ::cos(pfreq);
-        t_CKFLOAT next_b1 = (1.0 + C) * cosf;
-        t_CKFLOAT next_b2 = -C;
-        t_CKFLOAT next_a0 = (1.0 + C + next_b1) * 0.25;
-
         m_freq = freq;
-        m_Q = 1.0 / qres;
-        m_a0 = (SAMPLE)next_a0;
-        m_b1 = (SAMPLE)next_b1;
-        m_b2 = (SAMPLE)next_b2;
-    }
-
-    // tick_rhpf
-    inline SAMPLE tick_rhpf( SAMPLE in )
-    {
-        SAMPLE y0, result;
-
-        // go: adapted from SC3's RHPF
-        y0 = m_a0 * in + m_b1 * m_y1 + m_b2 * m_y2;
-        result = y0 - 2 * m_y1 + m_y2;
-        m_y2 = m_y1;
-        m_y1 = y0;
-
-        // be normal
-        CK_DDN(m_y1);
-        CK_DDN(m_y2);
-
-        return result;
+        m_Q = 1.0 / ck_max( .001, 1.0/Q );
+        m_kind = RHPF; m_stale = TRUE;
     }
 
     // set_resonz
     inline void set_resonz( t_CKFLOAT freq, t_CKFLOAT Q )
     {
-        t_CKFLOAT pfreq = freq * g_radians_per_sample;
-        t_CKFLOAT B = pfreq / Q;
-        t_CKFLOAT R = 1.0 - B * 0.5;
-        t_CKFLOAT R2 = 2.0 * R;
-        t_CKFLOAT R22 = R * R;
-        t_CKFLOAT cost = (R2 * ::cos(pfreq)) / (1.0 + R22);
-        t_CKFLOAT next_b1 = R2 * cost;
-        t_CKFLOAT next_b2 = -R22;
-        t_CKFLOAT next_a0 = (1.0 - R22) * 0.5;
-
         m_freq = freq;
         m_Q = Q;
-        m_a0 = (SAMPLE)next_a0;
-        m_b1 = (SAMPLE)next_b1;
-        m_b2 = (SAMPLE)next_b2;
+        m_kind = RESONZ; m_stale = TRUE;
     }
 
-    // tick_resonz
-    inline SAMPLE tick_resonz( SAMPLE in )
+    // design: the coefficients for m_kind at m_freq and m_Q
+    void design()
     {
-        SAMPLE y0, result;
+        // SC3 coefficients: y0 = (a0) in + b1 y1 + b2 y2, then a feed-forward
+        t_CKFLOAT a0 = 0, b1 = 0, b2 = 0, pfreq, pbw, qres, C, C2, D;
+        // g n0 n1 n2 d1 d2
+        t_CKFLOAT c[6] = { 1, 0, 0, 0, 0, 0 };
 
-        // go: adapted from SC3's ResonZ
-        y0 = in + m_b1 * m_y1 + m_b2 * m_y2;
-        result = m_a0 * (y0 - m_y2);
-        m_y2 = m_y1;
-        m_y1 = y0;
+        switch( m_kind )
+        {
+        case LPF:
+            pfreq = m_freq * g_radians_per_sample * 0.5;
+            C = 1.0 / ::tan(pfreq);
+            C2 = C * C;
+            a0 = 1.0 / (1.0 + C * CK_SQRT2 + C2);
+            b1 = -2.0 * (1.0 - C2) * a0;
+            b2 = -(1.0 - C * CK_SQRT2 + C2) * a0;
+            c[1] = a0; c[2] = 2 * a0; c[3] = a0; c[4] = b1; c[5] = b2;
+            break;
+        case HPF:
+            pfreq = m_freq * g_radians_per_sample * 0.5;
+            C = ::tan(pfreq);
+            C2 = C * C;
+            a0 = 1.0 / (1.0 + C * CK_SQRT2 + C2);
+            b1 = 2.0 * (1.0 - C2) * a0;
+            b2 = -(1.0 - C * CK_SQRT2 + C2) * a0;
+            c[1] = a0; c[2] = -2 * a0; c[3] = a0; c[4] = b1; c[5] = b2;
+            break;
+        case BPF:
+            pfreq = m_freq * g_radians_per_sample;
+            pbw = 1.0 / m_Q * pfreq * .5;
+            C = 1.0 / ::tan(pbw);
+            D = 2.0 * ::cos(pfreq);
+            a0 = 1.0 / (1.0 + C);
+            b1 = C * D * a0;
+            b2 = (1.0 - C) * a0;
+            c[1] = a0; c[2] = 0; c[3] = -a0; c[4] = b1; c[5] = b2;
+            break;
+        case BRF:
+            pfreq = m_freq * g_radians_per_sample;
+            pbw = 1.0 / m_Q * pfreq * .5;
+            C = ::tan(pbw);
+            D = 2.0 * ::cos(pfreq);
+            a0 = 1.0 / (1.0 + C);
+            b1 = -D * a0;
+            b2 = (1.0 - C) * a0;
+            // (SC3's BRF feeds b1 forward, too)
+            c[1] = a0; c[2] = b1; c[3] = a0; c[4] = -b1; c[5] = -b2;
+            break;
+        case RLPF:
+        case RHPF:
+            qres = 1.0 / m_Q;
+            pfreq = m_freq * g_radians_per_sample;
+            D = ::tan(pfreq * qres * 0.5);
+            C = (1.0 - D) / (1.0 + D);
+            b1 = (1.0 + C) * ::cos(pfreq);
+            b2 = -C;
+            // (the gain goes on the input)
+            if( m_kind == RLPF )
+            {
+                a0 = (1.0 + C - b1) * 0.25;
+                c[0] = a0; c[1] = 1; c[2] = 2; c[3] = 1;
+            }
+            else
+            {
+                a0 = (1.0 + C + b1) * 0.25;
+                c[0] = a0; c[1] = 1; c[2] = -2; c[3] = 1;
+            }
+            c[4] = b1; c[5] = b2;
+            break;
+        case RESONZ:
+        {
+            pfreq = m_freq * g_radians_per_sample;
+            t_CKFLOAT R = 1.0 - pfreq / m_Q * 0.5;
+            t_CKFLOAT R22 = R * R;
+            t_CKFLOAT cost = (2.0 * R * ::cos(pfreq)) / (1.0 + R22);
+            a0 = (1.0 - R22) * 0.5;
+            b1 = 2.0 * R * cost;
+            b2 = -R22;
+            c[1] = a0; c[2] = 0; c[3] = -a0; c[4] = b1; c[5] = b2;
+            break;
+        }
+        }
 
-        // be normal
-        CK_DDN(m_y1);
-        CK_DDN(m_y2);
+        m_f.retarget( c );
+        m_stale = FALSE;
+    }
 
-        return result;
+    // tick
+    inline SAMPLE tick( SAMPLE in )
+    {
+        if( m_stale ) design();
+        return m_f.tick( in );
     }
 
+    // tick a block
+    inline void tickv( const SAMPLE * in, SAMPLE * out, t_CKUINT n )
+    {
+        if( m_stale ) design();
+        m_f.tickv( in, out, n );
+    }
 };
 
 struct Teabox_data
@@ -1167,6 +1178,73 @@ CK_DLL_CTRL( FilterBasic_ctrl_set )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: FilterBasic_tickv()
+// desc: TICKV function, for each of the biquad-based subclasses | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( FilterBasic_tickv )
+{
+    FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
+    d->tickv( in, out, nframes );
+    return d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: FilterBasic_tickvn()
+// desc: TICKVN function: filters not gliding go through the SIMD kernel,
+//       four at a time, as ck_simd_biquad_n() takes them | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKVN( FilterBasic_tickvn )
+{
+    ck_biquad * f[4];
+    SAMPLE * x[4];
+    SAMPLE * y[4];
+    t_CKUINT n = 0;
+
+    for( t_CKUINT k = 0; k < count; k++ )
+    {
+        FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF[k], FilterBasic_offset_data);
+        if( d->m_stale ) d->design();
+        // gliding; on its own
+        if( d->m_f.left ) { d->m_f.tickv( in[k], out[k], nframes ); continue; }
+        f[n] = &d->m_f.bq; x[n] = in[k]; y[n] = out[k];
+        if( ++n == 4 ) { ck_simd_biquad_n( f, x, y, n, nframes ); n = 0; }
+    }
+    if( n ) ck_simd_biquad_n( f, x, y, n, nframes );
+
+    return TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: FilterBasic_ctrl_smooth()
+// desc: CTRL function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_CTRL( FilterBasic_ctrl_smooth )
+{
+    FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
+    t_CKDUR glide = GET_NEXT_DUR(ARGS);
+    // (abstract, or not biquad-based)
+    if( !d ) { RETURN->v_dur = 0; return; }
+
+    // in whole samples
+    d->m_f.glide = glide > 0 ? (t_CKUINT)(glide + .5) : 0;
+    RETURN->v_dur = (t_CKDUR)d->m_f.glide;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: FilterBasic_cget_smooth()
+// desc: CGET function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_CGET( FilterBasic_cget_smooth )
+{
+    FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
+    RETURN->v_dur = d ? (t_CKDUR)d->m_f.glide : 0;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: FilterBasic_pmsg()
 // desc: PMSG function ...
@@ -1198,8 +1276,8 @@ CK_DLL_CTOR( LPF_ctor )
 CK_DLL_TICK( LPF_tick )
 {
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
-    *out = d->tick_lpf( in );
-    return TRUE;
+    *out = d->tick( in );
+    return in == 0 && d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -1212,19 +1290,9 @@ CK_DLL_CTRL( LPF_ctrl_freq )
     // implementation: adapted from SC3's LPF
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
     t_CKFLOAT freq = GET_NEXT_FLOAT(ARGS);
-    t_CKFLOAT pfreq = freq * g_radians_per_sample * 0.5;
 
-    t_CKFLOAT C = 1.0 / ::tan(pfreq);
-    t_CKFLOAT C2 = C * C;
-    t_CKFLOAT sqrt2C = C * CK_SQRT2;
-    t_CKFLOAT next_a0 = 1.0 / (1.0 + sqrt2C + C2);
-    t_CKFLOAT next_b1 = -2.0 * (1.0 - C2) * next_a0 ;
-    t_CKFLOAT next_b2 = -(1.f - sqrt2C + C2) * next_a0;
-
-    d->m_freq = freq;
-    d->m_a0 = (SAMPLE)next_a0;
-    d->m_b1 = (SAMPLE)next_b1;
-    d->m_b2 = (SAMPLE)next_b2;
+    // set (designed at the next tick)
+    d->set_lpf( freq );
 
     RETURN->v_float = freq;
 }
@@ -1274,8 +1342,8 @@ CK_DLL_CTOR( HPF_ctor )
 CK_DLL_TICK( HPF_tick )
 {
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
-    *out = d->tick_hpf( in );
-    return TRUE;
+    *out = d->tick( in );
+    return in == 0 && d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -1288,19 +1356,9 @@ CK_DLL_CTRL( HPF_ctrl_freq )
     // implementation: adapted from SC3's HPF
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
     t_CKFLOAT freq = GET_NEXT_FLOAT(ARGS);
-    t_CKFLOAT pfreq = freq * g_radians_per_sample * 0.5;
-
-    t_CKFLOAT C = ::tan(pfreq);
-    t_CKFLOAT C2 = C * C;
-    t_CKFLOAT sqrt2C = C * CK_SQRT2;
-    t_CKFLOAT next_a0 = 1.0 / (1.0 + sqrt2C + C2);
-    t_CKFLOAT next_b1 = 2.0 * (1.0 - C2) * next_a0 ;
-    t_CKFLOAT next_b2 = -(1.0 - sqrt2C + C2) * next_a0;
 
-    d->m_freq = freq;
-    d->m_a0 = (SAMPLE)next_a0;
-    d->m_b1 = (SAMPLE)next_b1;
-    d->m_b2 = (SAMPLE)next_b2;
+    // set (designed at the next tick)
+    d->set_hpf( freq );
 
     RETURN->v_float = freq;
 }
@@ -1350,8 +1408,8 @@ CK_DLL_CTOR( BPF_ctor )
 CK_DLL_TICK( BPF_tick )
 {
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
-    *out = d->tick_bpf( in );
-    return TRUE;
+    *out = d->tick( in );
+    return in == 0 && d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -1486,8 +1544,8 @@ CK_DLL_CTOR( BRF_ctor )
 CK_DLL_TICK( BRF_tick )
 {
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
-    *out = d->tick_brf( in );
-    return TRUE;
+    *out = d->tick( in );
+    return in == 0 && d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -1627,8 +1685,8 @@ CK_DLL_CTOR( RLPF_ctor )
 CK_DLL_TICK( RLPF_tick )
 {
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
-    *out = d->tick_rlpf( in );
-    return TRUE;
+    *out = d->tick( in );
+    return in == 0 && d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -1765,8 +1823,8 @@ CK_DLL_CTOR( ResonZ_ctor )
 CK_DLL_TICK( ResonZ_tick )
 {
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
-    *out = d->tick_resonz( in );
-    return TRUE;
+    *out = d->tick( in );
+    return in == 0 && d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -1912,8 +1970,8 @@ CK_DLL_CTOR( RHPF_ctor )
 CK_DLL_TICK( RHPF_tick )
 {
     FilterBasic_data * d = (FilterBasic_data *)OBJ_MEMBER_UINT(SELF, FilterBasic_offset_data);
-    *out = d->tick_rhpf( in );
-    return TRUE;
+    *out = d->tick( in );
+    return in == 0 && d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -2120,6 +2178,12 @@ struct biquad_data
     t_CKBOOL norm;
     t_CKUINT srate;
 
+    // what ticks: a0..b2 in direct form I, as before, picked up at the
+    // next tick after any of them change | 1.5.5.3
+    // (m_input*, m_output* are only for the legacy one/two pole/zero ticks)
+    Filter_biquad m_f;
+    t_CKBOOL stale;
+
     biquad_data()
     {
         m_a0 = m_b0 = 1.0f;
@@ -2133,6 +2197,18 @@ struct biquad_data
         prad = zrad = 0.0f;
         norm = FALSE;
         srate = g_srateFilter;
+
+        memset( &m_f, 0, sizeof(m_f) );
+        m_f.bq.df1 = TRUE;
+        stale = TRUE;
+    }
+
+    // a0..b2 to the section's coefficients
+    void design()
+    {
+        t_CKFLOAT c[6] = { m_a0, m_b0, m_b1, m_b2, -m_a1, -m_a2 };
+        m_f.retarget( c );
+        stale = FALSE;
     }
 };
 
@@ -2168,23 +2244,72 @@ CK_DLL_TICK( biquad_tick )
 {
     biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
 
-    d->m_input0 = d->m_a0 * in;
-    d->m_output0 = d->m_b0 * d->m_input0 + d->m_b1 * d->m_input1 + d->m_b2 * d->m_input2;
-    d->m_output0 -= d->m_a2 * d->m_output2 + d->m_a1 * d->m_output1;
-    d->m_input2 = d->m_input1;
-    d->m_input1 = d->m_input0;
-    d->m_output2 = d->m_output1;
-    d->m_output1 = d->m_output0;
+    if( d->stale ) d->design();
+    *out = d->m_f.tick( in );
+
+    return in == 0 && d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
+}
+
+//-----------------------------------------------------------------------------
+// name: biquad_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( biquad_tickv )
+{
+    biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
 
-    // be normal
-    CK_DDN(d->m_output1);
-    CK_DDN(d->m_output2);
+    if( d->stale ) d->design();
+    d->m_f.tickv( in, out, nframes );
 
-    *out = (SAMPLE)d->m_output0;
+    return d->m_f.rest() ? CK_TICK_DORMANT : TRUE;
+}
+
+//-----------------------------------------------------------------------------
+// name: biquad_tickvn()
+// desc: TICKVN function; see FilterBasic_tickvn() | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKVN( biquad_tickvn )
+{
+    ck_biquad * f[4];
+    SAMPLE * x[4];
+    SAMPLE * y[4];
+    t_CKUINT n = 0;
+
+    for( t_CKUINT k = 0; k < count; k++ )
+    {
+        biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF[k], biquad_offset_data );
+        if( d->stale ) d->design();
+        if( d->m_f.left ) { d->m_f.tickv( in[k], out[k], nframes ); continue; }
+        f[n] = &d->m_f.bq; x[n] = in[k]; y[n] = out[k];
+        if( ++n == 4 ) { ck_simd_biquad_n( f, x, y, n, nframes ); n = 0; }
+    }
+    if( n ) ck_simd_biquad_n( f, x, y, n, nframes );
 
     return TRUE;
 }
 
+//-----------------------------------------------------------------------------
+// name: biquad_ctrl_smooth()
+// desc: CTRL function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_CTRL( biquad_ctrl_smooth )
+{
+    biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
+    t_CKDUR glide = GET_NEXT_DUR(ARGS);
+    d->m_f.glide = glide > 0 ? (t_CKUINT)(glide + .5) : 0;
+    RETURN->v_dur = (t_CKDUR)d->m_f.glide;
+}
+
+//-----------------------------------------------------------------------------
+// name: biquad_cget_smooth()
+// desc: CGET function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_CGET( biquad_cget_smooth )
+{
+    biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
+    RETURN->v_dur = (t_CKDUR)d->m_f.glide;
+}
+
 void biquad_set_reson( biquad_data * d )
 {
     d->m_a2 = (SAMPLE)(d->prad * d->prad);
@@ -2196,6 +2321,8 @@ void biquad_set_reson( biquad_data * d )
         d->m_b1 = -1.0f;
         d->m_b2 = -d->m_b0;
     }
+
+    d->stale = TRUE;
 }
 
 //-----------------------------------------------------------------------------
@@ -2246,6 +2373,7 @@ void biquad_set_notch( biquad_data * d )
 {
     d->m_b2 = (SAMPLE)(d->zrad * d->zrad);
     d->m_b1 = (SAMPLE)(-2.0 * d->zrad * cos(2.0 * CK_ONE_PI * d->zfreq / (double)d->srate));
+    d->stale = TRUE;
 }
 
 //-----------------------------------------------------------------------------
@@ -2322,6 +2450,7 @@ CK_DLL_CTRL( biquad_ctrl_pregain )
 {
     biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
     d->m_a0 = (SAMPLE)GET_CK_FLOAT(ARGS);
+    d->stale = TRUE;
     RETURN->v_float = d->m_a0;
 }
 
@@ -2347,6 +2476,7 @@ CK_DLL_CTRL( biquad_ctrl_eqzs )
         d->m_b0 = 1.0f;
         d->m_b1 = 0.0f;
         d->m_b2 = -1.0f;
+        d->stale = TRUE;
     }
     RETURN->v_int = *(t_CKUINT *)ARGS;
 }
@@ -2359,6 +2489,7 @@ CK_DLL_CTRL( biquad_ctrl_b0 )
 {
     biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
     d->m_b0 = (SAMPLE)GET_CK_FLOAT(ARGS);
+    d->stale = TRUE;
     RETURN->v_float = d->m_b0;
 }
 
@@ -2380,6 +2511,7 @@ CK_DLL_CTRL( biquad_ctrl_b1 )
 {
     biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
     d->m_b1 = (SAMPLE)GET_CK_FLOAT(ARGS);
+    d->stale = TRUE;
     RETURN->v_float = d->m_b1;
 }
 
@@ -2401,6 +2533,7 @@ CK_DLL_CTRL( biquad_ctrl_b2 )
 {
     biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
     d->m_b2 = (SAMPLE)GET_CK_FLOAT(ARGS);
+    d->stale = TRUE;
     RETURN->v_float = d->m_b2;
 }
 
@@ -2422,6 +2555,7 @@ CK_DLL_CTRL( biquad_ctrl_a0 )
 {
     biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
     d->m_a0 = (SAMPLE)GET_CK_FLOAT(ARGS);
+    d->stale = TRUE;
     RETURN->v_float = d->m_a0;
 }
 
@@ -2443,6 +2577,7 @@ CK_DLL_CTRL( biquad_ctrl_a1 )
 {
     biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
     d->m_a1 = (SAMPLE)GET_CK_FLOAT(ARGS);
+    d->stale = TRUE;
     RETURN->v_float = d->m_a1;
 }
 
@@ -2464,6 +2599,7 @@ CK_DLL_CTRL( biquad_ctrl_a2 )
 {
     biquad_data * d = (biquad_data *)OBJ_MEMBER_UINT(SELF, biquad_offset_data );
     d->m_a2 = (SAMPLE)GET_CK_FLOAT(ARGS);
+    d->stale = TRUE;
     RETURN->v_float = d->m_a2;
 }
 
@@ -51,6 +51,10 @@ CK_DLL_CGET( FilterBasic_cget_freq );
 CK_DLL_CTRL( FilterBasic_ctrl_Q );
 CK_DLL_CGET( FilterBasic_cget_Q );
 CK_DLL_CTRL( FilterBasic_ctrl_set );
+CK_DLL_TICKV( FilterBasic_tickv ); // 1.5.5.3
+CK_DLL_TICKVN( FilterBasic_tickvn ); // 1.5.5.3
+CK_DLL_CTRL( FilterBasic_ctrl_smooth ); // 1.5.5.3
+CK_DLL_CGET( FilterBasic_cget_smooth ); // 1.5.5.3
 
 // LPF
 CK_DLL_CTOR( LPF_ctor );
@@ -135,6 +139,8 @@ CK_DLL_PMSG( filter_pmsg );
 CK_DLL_CTOR( biquad_ctor );
 CK_DLL_DTOR( biquad_dtor );
 CK_DLL_TICK( biquad_tick );
+CK_DLL_TICKV( biquad_tickv );
+CK_DLL_TICKVN( biquad_tickvn ); // 1.5.5.3
 
 CK_DLL_CTRL( biquad_ctrl_pfreq );
 CK_DLL_CGET( biquad_cget_pfreq );
@@ -162,6 +168,8 @@ CK_DLL_CTRL( biquad_ctrl_a1 );
 CK_DLL_CGET( biquad_cget_a1 );
 CK_DLL_CTRL( biquad_ctrl_a2 );
 CK_DLL_CGET( biquad_cget_a2 );
+CK_DLL_CTRL( biquad_ctrl_smooth ); // 1.5.5.3
+CK_DLL_CGET( biquad_cget_smooth ); // 1.5.5.3
 
 //Teabox
 CK_DLL_CTOR( teabox_ctor );
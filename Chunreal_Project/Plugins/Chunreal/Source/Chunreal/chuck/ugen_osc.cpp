@@ -37,6 +37,7 @@
 #include "chuck_type.h"
 #include "chuck_ugen.h"
 #include "chuck_compile.h"
+#include "util_simd.h" // 1.5.5.3
 #include <math.h>
 #include <stdio.h>
 
@@ -86,6 +87,8 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         osc_ctor, osc_dtor, osc_tick, osc_pmsg,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, osc_tickv ) ) goto error;
 
     // add member variable
     osc_offset_data = type_engine_import_mvar( env, "int", "@osc_data", FALSE );
@@ -158,6 +161,8 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         NULL, NULL, osc_tick, NULL,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, osc_tickv ) ) goto error;
 
     // overload constructor (float freq)
     func = make_new_ctor( oscx_ctor_1 );
@@ -186,6 +191,8 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         NULL, NULL, sinosc_tick, NULL,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, sinosc_tickv ) ) goto error;
 
     // overload constructor (float freq)
     func = make_new_ctor( oscx_ctor_1 );
@@ -222,6 +229,8 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         NULL, NULL, triosc_tick, NULL,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, triosc_tickv ) ) goto error;
 
     // overload constructor (float freq)
     func = make_new_ctor( oscx_ctor_1 );
@@ -301,6 +310,8 @@ DLL_QUERY osc_query( Chuck_DL_Query * QUERY )
                                         NULL, NULL, pulseosc_tick, NULL,
                                         doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, pulseosc_tickv ) ) goto error;
 
     // overload constructor (float freq)
     func = make_new_ctor( oscx_ctor_1 );
@@ -412,6 +423,131 @@ struct Osc_Data
 
 
 
+//-----------------------------------------------------------------------------
+// block ticks | 1.5.5.3 (added)
+// each block is walked in chunks: the phase every frame ticks at goes to a
+// stack buffer first, accumulated exactly as the scalar ticks accumulate it,
+// then the waveshape runs over the buffer two frames at a time. the wrap
+// keeps its branches; they predict well, and the branch-free form puts
+// two more ops on the one serial dependency in the loop
+//-----------------------------------------------------------------------------
+#define CK_OSC_CHUNK 64
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_phase_v()
+// desc: write the phase of each of n frames to ph[], honoring sync exactly
+//       as the scalar ticks do; phasor selects osc_tick()'s bounding over
+//       the one shared by sinosc/triosc/pulseosc_tick()
+//-----------------------------------------------------------------------------
+static void osc_phase_v( Osc_Data * d, t_CKBOOL has_src, const SAMPLE * in,
+                         t_CKFLOAT * ph, t_CKUINT n, t_CKBOOL phasor )
+{
+    t_CKFLOAT phase = d->phase;
+    t_CKFLOAT num = d->num;
+
+    // sync phase to input: output follows input, no increment
+    if( has_src && d->sync == 1 )
+    {
+        for( t_CKUINT i = 0; i < n; i++ )
+        {
+            phase = in[i];
+            if( phasor && (phase > 1.0 || phase < 0.0) ) phase -= floor( phase );
+            ph[i] = phase;
+        }
+    }
+    // sync freq to input / FM: new increment every frame
+    else if( has_src && (d->sync == 0 || d->sync == 2) )
+    {
+        t_CKFLOAT base = d->sync == 0 ? 0 : d->freq;
+        for( t_CKUINT i = 0; i < n; i++ )
+        {
+            num = (base + in[i]) / d->srate;
+            // bound it
+            if( phasor ) { if( num >= 1.0 || num < 0.0 ) num -= floor( num ); }
+            else if( num >= 1.0 ) num -= floor( num );
+            else if( num <= -1.0 ) num += floor( num );
+            ph[i] = phase;
+            // step the phase, keep it between 0 and 1
+            phase += num;
+            if( phase > 1.0 ) phase -= 1.0;
+            else if( phase < 0.0 ) phase += 1.0;
+        }
+        if( d->sync == 0 && n ) d->freq = in[n-1];
+        d->num = num;
+    }
+    // free-running
+    else
+    {
+        for( t_CKUINT i = 0; i < n; i++ )
+        {
+            ph[i] = phase;
+            phase += num;
+            if( phase > 1.0 ) phase -= 1.0;
+            else if( phase < 0.0 ) phase += 1.0;
+        }
+    }
+
+    d->phase = phase;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_tri_v()
+// desc: triosc_tick()'s shape over ph[]; the width == 0 / width == 1 special
+//       cases fold into per-block slope and offset
+//-----------------------------------------------------------------------------
+static void osc_tri_v( SAMPLE * out, const t_CKFLOAT * ph, t_CKUINT n, t_CKFLOAT width )
+{
+    // rising: ro + p*rk; falling: fo + (p-width)*fk
+    t_CKFLOAT ro = -1.0, rk = 0, fo = 1.0, fk = 0;
+    if( width == 0.0 ) ro = 1.0; else rk = 2.0 / width;
+    if( width == 1.0 ) fo = 0; else fk = -2.0 / (1.0 - width);
+
+    const ck_f64x2 one = ck_f64x2_set1( 1.0 ), quarter = ck_f64x2_set1( .25 );
+    const ck_f64x2 w = ck_f64x2_set1( width );
+    const ck_f64x2 vro = ck_f64x2_set1( ro ), vrk = ck_f64x2_set1( rk );
+    const ck_f64x2 vfo = ck_f64x2_set1( fo ), vfk = ck_f64x2_set1( fk );
+    t_CKUINT i = 0;
+    for( ; i + 2 <= n; i += 2 )
+    {
+        ck_f64x2 p = ck_f64x2_add( ck_f64x2_load( ph+i ), quarter );
+        p = ck_f64x2_select( ck_f64x2_gt( p, one ), ck_f64x2_sub( p, one ), p );
+        ck_f64x2 rise = ck_f64x2_add( vro, ck_f64x2_mul( p, vrk ) );
+        ck_f64x2 fall = ck_f64x2_add( vfo, ck_f64x2_mul( ck_f64x2_sub( p, w ), vfk ) );
+        ck_f64x2_store_sample( out+i, ck_f64x2_select( ck_f64x2_lt( p, w ), rise, fall ) );
+    }
+    for( ; i < n; i++ )
+    {
+        t_CKFLOAT p = ph[i] + .25; if( p > 1.0 ) p -= 1.0;
+        out[i] = (SAMPLE)( p < width ? ro + p*rk : fo + (p-width)*fk );
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: osc_pulse_v()
+// desc: pulseosc_tick()'s shape over ph[]
+//-----------------------------------------------------------------------------
+static void osc_pulse_v( SAMPLE * out, const t_CKFLOAT * ph, t_CKUINT n, t_CKFLOAT width )
+{
+    const ck_f64x2 w = ck_f64x2_set1( width );
+    const ck_f64x2 hi = ck_f64x2_set1( 1.0 ), lo = ck_f64x2_set1( -1.0 );
+    t_CKUINT i = 0;
+    for( ; i + 2 <= n; i += 2 )
+        ck_f64x2_store_sample( out+i, ck_f64x2_select( ck_f64x2_lt( ck_f64x2_load(ph+i), w ), hi, lo ) );
+    for( ; i < n; i++ ) out[i] = ph[i] < width ? 1.0f : -1.0f;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: osc_ctor()
 // desc: default cosntructor
@@ -562,6 +698,45 @@ CK_DLL_TICK( osc_tick )
 
 
 
+//-----------------------------------------------------------------------------
+// name: osc_tickv()
+// desc: block tick; same as osc_tick() over nframes
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( osc_tickv )
+{
+    // get the data
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    Chuck_UGen * ugen = (Chuck_UGen *)SELF;
+    t_CKFLOAT ph[CK_OSC_CHUNK];
+
+    // free-running, the phase is the output; skip the buffer
+    if( !ugen->m_num_src || d->sync < 0 || d->sync > 2 )
+    {
+        t_CKFLOAT phase = d->phase;
+        for( t_CKUINT i = 0; i < nframes; i++ )
+        {
+            out[i] = (SAMPLE)phase;
+            phase += d->num;
+            if( phase > 1.0 ) phase -= 1.0;
+            else if( phase < 0.0 ) phase += 1.0;
+        }
+        d->phase = phase;
+        return TRUE;
+    }
+
+    for( t_CKUINT i = 0; i < nframes; i += CK_OSC_CHUNK )
+    {
+        t_CKUINT n = nframes - i < CK_OSC_CHUNK ? nframes - i : CK_OSC_CHUNK;
+        osc_phase_v( d, ugen->m_num_src > 0, in+i, ph, n, TRUE );
+        for( t_CKUINT j = 0; j < n; j++ ) out[i+j] = (SAMPLE)ph[j];
+    }
+
+    return TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: sinosc_tick()
 // desc: ...
@@ -631,6 +806,31 @@ CK_DLL_TICK( sinosc_tick )
 
 
 
+//-----------------------------------------------------------------------------
+// name: sinosc_tickv()
+// desc: block tick; sinosc_tick() over nframes, with the polynomial sine
+//       from util_simd (within 7e-10 of ::sin)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( sinosc_tickv )
+{
+    // get the data
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    Chuck_UGen * ugen = (Chuck_UGen *)SELF;
+    t_CKFLOAT ph[CK_OSC_CHUNK];
+
+    for( t_CKUINT i = 0; i < nframes; i += CK_OSC_CHUNK )
+    {
+        t_CKUINT n = nframes - i < CK_OSC_CHUNK ? nframes - i : CK_OSC_CHUNK;
+        osc_phase_v( d, ugen->m_num_src > 0, in+i, ph, n, FALSE );
+        ck_simd_sin2pi( out+i, ph, n );
+    }
+
+    return TRUE;
+}
+
+
+
+
 //-----------------------------------------------------------------------------
 // name: triosc_tick()
 // desc: ...
@@ -700,6 +900,30 @@ CK_DLL_TICK( triosc_tick )
 }
 
 
+
+
+//-----------------------------------------------------------------------------
+// name: triosc_tickv()
+// desc: block tick; same as triosc_tick() over nframes
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( triosc_tickv )
+{
+    // get the data
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    Chuck_UGen * ugen = (Chuck_UGen *)SELF;
+    t_CKFLOAT ph[CK_OSC_CHUNK];
+
+    for( t_CKUINT i = 0; i < nframes; i += CK_OSC_CHUNK )
+    {
+        t_CKUINT n = nframes - i < CK_OSC_CHUNK ? nframes - i : CK_OSC_CHUNK;
+        osc_phase_v( d, ugen->m_num_src > 0, in+i, ph, n, FALSE );
+        osc_tri_v( out+i, ph, n, d->width );
+    }
+
+    return TRUE;
+}
+
+
 // sawosc_tick is tri_osc tick with width=0.0 or width=1.0  -pld
 
 
@@ -770,6 +994,30 @@ CK_DLL_TICK( pulseosc_tick )
 }
 
 
+
+
+//-----------------------------------------------------------------------------
+// name: pulseosc_tickv()
+// desc: block tick; same as pulseosc_tick() over nframes
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( pulseosc_tickv )
+{
+    // get the data
+    Osc_Data * d = (Osc_Data *)OBJ_MEMBER_UINT(SELF, osc_offset_data );
+    Chuck_UGen * ugen = (Chuck_UGen *)SELF;
+    t_CKFLOAT ph[CK_OSC_CHUNK];
+
+    for( t_CKUINT i = 0; i < nframes; i += CK_OSC_CHUNK )
+    {
+        t_CKUINT n = nframes - i < CK_OSC_CHUNK ? nframes - i : CK_OSC_CHUNK;
+        osc_phase_v( d, ugen->m_num_src > 0, in+i, ph, n, FALSE );
+        osc_pulse_v( out+i, ph, n, d->width );
+    }
+
+    return TRUE;
+}
+
+
 // sqrosc_tick is pulseosc_tick at width=0.5 -pld;
 
 
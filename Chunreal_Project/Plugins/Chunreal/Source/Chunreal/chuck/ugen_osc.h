@@ -46,6 +46,7 @@ DLL_QUERY osc_query( Chuck_DL_Query * query );
 CK_DLL_CTOR( osc_ctor );
 CK_DLL_DTOR( osc_dtor );
 CK_DLL_TICK( osc_tick );
+CK_DLL_TICKV( osc_tickv );
 CK_DLL_PMSG( osc_pmsg );
 CK_DLL_CTRL( osc_ctrl_freq );
 CK_DLL_CGET( osc_cget_freq );
@@ -65,12 +66,15 @@ CK_DLL_CTOR( oscx_ctor_2 );
 
 // sinosc
 CK_DLL_TICK( sinosc_tick );
+CK_DLL_TICKV( sinosc_tickv );
 
 // pulseosc
 CK_DLL_TICK( pulseosc_tick );
+CK_DLL_TICKV( pulseosc_tickv );
 
 // triosc
 CK_DLL_TICK( triosc_tick );
+CK_DLL_TICKV( triosc_tickv );
 
 // sawosc
 CK_DLL_CTOR( sawosc_ctor );
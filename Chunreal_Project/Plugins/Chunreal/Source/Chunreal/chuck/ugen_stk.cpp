@@ -149,6 +149,7 @@ horn ok please -> written at the back of trucks, always, makes no sense.
 CK_DLL_CTOR( ADSR_ctor );
 CK_DLL_DTOR( ADSR_dtor );
 CK_DLL_TICK( ADSR_tick );
+CK_DLL_TICKV( ADSR_tickv );
 CK_DLL_PMSG( ADSR_pmsg );
 CK_DLL_CTOR( ADSR_ctor_floats );
 CK_DLL_CTOR( ADSR_ctor_durs );
@@ -219,6 +220,7 @@ CK_DLL_CTOR( Delay_ctor_delay );
 CK_DLL_CTOR( Delay_ctor_delay_max );
 CK_DLL_DTOR( Delay_dtor );
 CK_DLL_TICK( Delay_tick );
+CK_DLL_TICKV( Delay_tickv );
 CK_DLL_PMSG( Delay_pmsg );
 CK_DLL_CTRL( Delay_ctrl_set );
 CK_DLL_CTRL( Delay_ctrl_delay );
@@ -233,6 +235,7 @@ CK_DLL_CTOR( DelayA_ctor_delay );
 CK_DLL_CTOR( DelayA_ctor_delay_max );
 CK_DLL_DTOR( DelayA_dtor );
 CK_DLL_TICK( DelayA_tick );
+CK_DLL_TICKV( DelayA_tickv );
 CK_DLL_PMSG( DelayA_pmsg );
 CK_DLL_CTRL( DelayA_ctrl_set );
 CK_DLL_CTRL( DelayA_ctrl_delay );
@@ -247,6 +250,7 @@ CK_DLL_CTOR( DelayL_ctor_delay );
 CK_DLL_CTOR( DelayL_ctor_delay_max );
 CK_DLL_DTOR( DelayL_dtor );
 CK_DLL_TICK( DelayL_tick );
+CK_DLL_TICKV( DelayL_tickv );
 CK_DLL_PMSG( DelayL_pmsg );
 CK_DLL_CTRL( DelayL_ctrl_set );
 CK_DLL_CTRL( DelayL_ctrl_delay );
@@ -274,6 +278,7 @@ CK_DLL_CGET( Echo_cget_mix );
 CK_DLL_CTOR( Envelope_ctor );
 CK_DLL_DTOR( Envelope_dtor );
 CK_DLL_TICK( Envelope_tick );
+CK_DLL_TICKV( Envelope_tickv );
 CK_DLL_PMSG( Envelope_pmsg );
 CK_DLL_CTOR( Envelope_ctor_duration );
 CK_DLL_CTOR( Envelope_ctor_float );
@@ -310,6 +315,7 @@ CK_DLL_CGET( FilterStk_cget_coefs );
 CK_DLL_CTOR( OnePole_ctor );
 CK_DLL_DTOR( OnePole_dtor );
 CK_DLL_TICK( OnePole_tick );
+CK_DLL_TICKV( OnePole_tickv );
 CK_DLL_PMSG( OnePole_pmsg );
 CK_DLL_CTRL( OnePole_ctrl_a1 );
 CK_DLL_CTRL( OnePole_ctrl_b0 );
@@ -322,6 +328,7 @@ CK_DLL_CGET( OnePole_cget_pole );
 CK_DLL_CTOR( TwoPole_ctor );
 CK_DLL_DTOR( TwoPole_dtor );
 CK_DLL_TICK( TwoPole_tick );
+CK_DLL_TICKV( TwoPole_tickv );
 CK_DLL_PMSG( TwoPole_pmsg );
 CK_DLL_CTRL( TwoPole_ctrl_a1 );
 CK_DLL_CTRL( TwoPole_ctrl_a2 );
@@ -341,6 +348,7 @@ CK_DLL_CGET( TwoPole_cget_norm );
 CK_DLL_CTOR( OneZero_ctor );
 CK_DLL_DTOR( OneZero_dtor );
 CK_DLL_TICK( OneZero_tick );
+CK_DLL_TICKV( OneZero_tickv );
 CK_DLL_PMSG( OneZero_pmsg );
 CK_DLL_CTRL( OneZero_ctrl_zero );
 CK_DLL_CTRL( OneZero_ctrl_b0 );
@@ -353,6 +361,7 @@ CK_DLL_CGET( OneZero_cget_b1 );
 CK_DLL_CTOR( TwoZero_ctor );
 CK_DLL_DTOR( TwoZero_dtor );
 CK_DLL_TICK( TwoZero_tick );
+CK_DLL_TICKV( TwoZero_tickv );
 CK_DLL_PMSG( TwoZero_pmsg );
 CK_DLL_CTRL( TwoZero_ctrl_b0 );
 CK_DLL_CTRL( TwoZero_ctrl_b1 );
@@ -369,6 +378,7 @@ CK_DLL_CGET( TwoZero_cget_radius );
 CK_DLL_CTOR( PoleZero_ctor );
 CK_DLL_DTOR( PoleZero_dtor );
 CK_DLL_TICK( PoleZero_tick );
+CK_DLL_TICKV( PoleZero_tickv );
 CK_DLL_PMSG( PoleZero_pmsg );
 CK_DLL_CTRL( PoleZero_ctrl_a1 );
 CK_DLL_CTRL( PoleZero_ctrl_b0 );
@@ -3546,6 +3556,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Delay", "UGen", env->global(),
                         Delay_ctor, Delay_dtor,
                         Delay_tick, Delay_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, Delay_tickv ) ) goto error;
 
     // add examples
     if( !type_engine_import_add_ex( env, "basic/comb.ck" ) ) goto error;
@@ -3614,6 +3626,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "DelayA", "UGen", env->global(),
                         DelayA_ctor, DelayA_dtor,
                         DelayA_tick, DelayA_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, DelayA_tickv ) ) goto error;
     // add examples
     if( !type_engine_import_add_ex( env, "deep/ks-chord.ck" ) ) goto error;
 
@@ -3679,6 +3693,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "DelayL", "UGen", env->global(),
                         DelayL_ctor, DelayL_dtor,
                         DelayL_tick, DelayL_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, DelayL_tickv ) ) goto error;
 
     type_engine_import_add_ex(env, "basic/delay.ck");
     type_engine_import_add_ex(env, "basic/delay2.ck");
@@ -3819,6 +3835,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "Envelope", "UGen", env->global(),
                         Envelope_ctor, Envelope_dtor,
                         Envelope_tick, Envelope_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, Envelope_tickv ) ) goto error;
 
     type_engine_import_add_ex(env, "basic/envelope.ck");
     type_engine_import_add_ex(env, "basic/envelope2.ck");
@@ -3949,6 +3967,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "ADSR", "Envelope", env->global(),
                                         ADSR_ctor, ADSR_dtor,
                                         ADSR_tick, ADSR_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, ADSR_tickv ) ) goto error;
 
     type_engine_import_add_ex(env, "basic/adsr.ck");
     type_engine_import_add_ex(env, "basic/blit2.ck");
@@ -4198,6 +4218,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "OnePole", "UGen", env->global(),
                         OnePole_ctor, OnePole_dtor,
                         OnePole_tick, OnePole_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, OnePole_tickv ) ) goto error;
 
     // member variable
     OnePole_offset_data = type_engine_import_mvar ( env, "int", "@OnePole_data", FALSE );
@@ -4247,6 +4269,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "TwoPole", "UGen", env->global(),
                         TwoPole_ctor, TwoPole_dtor,
                         TwoPole_tick, TwoPole_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, TwoPole_tickv ) ) goto error;
 
     type_engine_import_add_ex(env, "shred/powerup.ck");
 
@@ -4322,6 +4346,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "OneZero", "UGen", env->global(),
                         OneZero_ctor, OneZero_dtor,
                         OneZero_tick, OneZero_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, OneZero_tickv ) ) goto error;
 
     //member variable
     OneZero_offset_data = type_engine_import_mvar ( env, "int", "@OneZero_data", FALSE );
@@ -4373,6 +4399,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "TwoZero", "UGen", env->global(),
                         TwoZero_ctor, TwoZero_dtor,
                         TwoZero_tick, TwoZero_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, TwoZero_tickv ) ) goto error;
 
     //member variable
     TwoZero_offset_data = type_engine_import_mvar ( env, "int", "@TwoZero_data", FALSE );
@@ -4441,6 +4469,8 @@ by Perry R. Cook and Gary P. Scavone, 1995 - 2002.";
     if( !type_engine_import_ugen_begin( env, "PoleZero", "UGen", env->global(),
                         PoleZero_ctor, PoleZero_dtor,
                         PoleZero_tick, PoleZero_pmsg, doc.c_str() ) ) return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, PoleZero_tickv ) ) goto error;
 
     //member variable
     PoleZero_offset_data = type_engine_import_mvar ( env, "int", "@PoleZero_data", FALSE );
@@ -8078,6 +8108,8 @@ void DelayBase :: clear(void)
   long i;
   for (i=0;i<length;i++) inputs[i] = 0.0;
   outputs[0] = 0.0;
+  // all zeros, as if after a line's worth of silence | 1.5.5.3
+  quiet = length;
 }
 
 void DelayBase :: setDelay(long theDelay)
@@ -10669,6 +10701,12 @@ JCRev :: JCRev(MY_FLOAT T60)
   allpassCoefficient = 0.7;
   effectMix = 0.3;
   this->clear();
+
+  // tail to -180dB (see rest()): 3 x T60 through the combs, 60 passes
+  // around each allpass (0.7^60 < 1e-9), and once through the outputs
+  tailFrames = (unsigned long)(3 * T60 * Stk::sampleRate());
+  for (i=0; i<9; i++) tailFrames += (i>=4 && i<7 ? 60 : 1) * lengths[i];
+  quietFrames = tailFrames + 1;
 }
 
 JCRev :: ~JCRev()
@@ -12127,6 +12165,11 @@ NRev :: NRev(MY_FLOAT T60)
   allpassCoefficient = 0.7;
   effectMix = 0.3;
   this->clear();
+
+  // tail to -180dB; see JCRev
+  tailFrames = (unsigned long)(3 * T60 * Stk::sampleRate());
+  for (i=0; i<14; i++) tailFrames += (i<6 ? 1 : 60) * lengths[i];
+  quietFrames = tailFrames + 1;
 }
 
 NRev :: ~NRev()
@@ -12512,6 +12555,11 @@ PRCRev :: PRCRev(MY_FLOAT T60)
   allpassCoefficient = 0.7;
   effectMix = 0.5;
   this->clear();
+
+  // tail to -180dB; see JCRev
+  tailFrames = (unsigned long)(3 * T60 * Stk::sampleRate());
+  for (i=0; i<4; i++) tailFrames += (i<2 ? 60 : 1) * lengths[i];
+  quietFrames = tailFrames + 1;
 }
 
 PRCRev :: ~PRCRev()
@@ -13670,6 +13718,8 @@ Reverb :: Reverb()
     // 1.5.0.4 (ge) add initialization
     effectMix = 0;
     lastOutput[0] = lastOutput[1] = 0;
+    // 1.5.5.3 (set by subclasses)
+    quietFrames = tailFrames = 0;
 }
 
 Reverb :: ~Reverb()
@@ -13704,6 +13754,21 @@ MY_FLOAT *Reverb :: tick(MY_FLOAT *vec, unsigned int vectorSize)
   return vec;
 }
 
+bool Reverb :: rest(MY_FLOAT input)
+{
+  if ( input != 0.0 ) {
+    quietFrames = 0;
+    return false;
+  }
+  if ( quietFrames > tailFrames ) return true;
+  // what is left is below -180dB; drop it
+  if ( ++quietFrames > tailFrames ) {
+    this->clear();
+    return true;
+  }
+  return false;
+}
+
 bool Reverb :: isPrime(int number)
 {
   if (number == 2) return true;
@@ -23875,14 +23940,43 @@ CK_DLL_CTRL( Delay_ctrl_set )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: delay_rest() | 1.5.5.3 (added)
+// desc: count the zero input in a row through the end of a block (of one or
+//       more samples); the line is at rest once that covers its length
+//-----------------------------------------------------------------------------
+static t_CKBOOL delay_rest( DelayBase * d, const SAMPLE * in, t_CKUINT n )
+{
+    t_CKUINT i = n;
+    while( i && in[i-1] == 0 ) i--;
+    d->quiet = i ? n - i : d->quiet + n;
+    return d->quiet >= (unsigned long)d->length;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: Delay_tick()
 // desc: TICK function ...
 //-----------------------------------------------------------------------------
 CK_DLL_TICK( Delay_tick )
 {
-    *out = (SAMPLE)((DelayBase *)OBJ_MEMBER_UINT(SELF, Delay_offset_data))->tick( in );
-    return TRUE;
+    DelayBase * d = (DelayBase *)OBJ_MEMBER_UINT(SELF, Delay_offset_data);
+    *out = (SAMPLE)d->tick( in );
+    return delay_rest( d, &in, 1 ) ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: Delay_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( Delay_tickv )
+{
+    DelayBase * d = (DelayBase *)OBJ_MEMBER_UINT(SELF, Delay_offset_data);
+    // the object is always exactly a DelayBase; skip the virtual dispatch
+    for( t_CKUINT i = 0; i < nframes; i++ )
+        out[i] = (SAMPLE)d->DelayBase::tick( in[i] );
+    return delay_rest( d, in, nframes ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -24025,14 +24119,42 @@ CK_DLL_CTRL( DelayA_ctrl_set )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: delayA_rest() | 1.5.5.3 (added)
+// desc: delay_rest(), once the allpass interpolator has also died away
+//-----------------------------------------------------------------------------
+static t_CKBOOL delayA_rest( DelayA * d, const SAMPLE * in, t_CKUINT n )
+{
+    if( !delay_rest( d, in, n ) || fabs( d->outputs[0] ) >= CK_TICK_FLOOR )
+        return FALSE;
+    d->outputs[0] = 0;
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: DelayA_tick()
 // desc: TICK function ...
 //-----------------------------------------------------------------------------
 CK_DLL_TICK( DelayA_tick )
 {
-    *out = (SAMPLE)((DelayA *)OBJ_MEMBER_UINT(SELF, DelayA_offset_data))->tick( in );
-    return TRUE;
+    DelayA * d = (DelayA *)OBJ_MEMBER_UINT(SELF, DelayA_offset_data);
+    *out = (SAMPLE)d->tick( in );
+    return delayA_rest( d, &in, 1 ) ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: DelayA_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( DelayA_tickv )
+{
+    DelayA * d = (DelayA *)OBJ_MEMBER_UINT(SELF, DelayA_offset_data);
+    // the object is always exactly a DelayA; skip the virtual dispatch
+    for( t_CKUINT i = 0; i < nframes; i++ )
+        out[i] = (SAMPLE)d->DelayA::tick( in[i] );
+    return delayA_rest( d, in, nframes ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -24181,8 +24303,23 @@ CK_DLL_DTOR( DelayL_dtor )
 //-----------------------------------------------------------------------------
 CK_DLL_TICK( DelayL_tick )
 {
-    *out = (SAMPLE)((DelayL *)OBJ_MEMBER_UINT(SELF, DelayL_offset_data))->tick( in );
-    return TRUE;
+    DelayL * d = (DelayL *)OBJ_MEMBER_UINT(SELF, DelayL_offset_data);
+    *out = (SAMPLE)d->tick( in );
+    return delay_rest( d, &in, 1 ) ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: DelayL_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( DelayL_tickv )
+{
+    DelayL * d = (DelayL *)OBJ_MEMBER_UINT(SELF, DelayL_offset_data);
+    // the object is always exactly a DelayL; skip the virtual dispatch
+    for( t_CKUINT i = 0; i < nframes; i++ )
+        out[i] = (SAMPLE)d->DelayL::tick( in[i] );
+    return delay_rest( d, in, nframes ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -24449,7 +24586,31 @@ CK_DLL_TICK( Envelope_tick )
 {
     Envelope * d = (Envelope *)OBJ_MEMBER_UINT(SELF, Envelope_offset_data);
     *out = in * d->tick();
-    return TRUE;
+    // holding: zero at zero, or zero whatever the input | 1.5.5.3
+    if( d->state ) return TRUE;
+    return d->value == 0 ? CK_TICK_SILENT | CK_TICK_DORMANT : CK_TICK_DORMANT;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: Envelope_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( Envelope_tickv )
+{
+    Envelope * d = (Envelope *)OBJ_MEMBER_UINT(SELF, Envelope_offset_data);
+    t_CKUINT i = 0;
+    // ramp until the target is reached (if it is within this block)
+    for( ; i < nframes && d->state; i++ )
+        out[i] = in[i] * d->Envelope::tick();
+    // (how many samples ramped)
+    t_CKUINT ramped = i;
+    // at target: the value holds for the rest of the block
+    for( ; i < nframes; i++ )
+        out[i] = in[i] * d->value;
+    // holding: zero at zero (all block), or zero whatever the input | 1.5.5.3
+    if( d->state ) return TRUE;
+    return d->value == 0 && !ramped ? CK_TICK_SILENT | CK_TICK_DORMANT : CK_TICK_DORMANT;
 }
 
 
@@ -24755,7 +24916,30 @@ CK_DLL_TICK( ADSR_tick )
 {
     ADSR * d = (ADSR *)OBJ_MEMBER_UINT(SELF, Envelope_offset_data);
     *out = in * d->tick();
-    return TRUE;
+    // sustain and done hold: as Envelope_tick() | 1.5.5.3
+    if( d->state != ADSR::SUSTAIN && d->state != ADSR::DONE ) return TRUE;
+    return d->value == 0 ? CK_TICK_SILENT | CK_TICK_DORMANT : CK_TICK_DORMANT;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: ADSR_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( ADSR_tickv )
+{
+    ADSR * d = (ADSR *)OBJ_MEMBER_UINT(SELF, Envelope_offset_data);
+    t_CKUINT i = 0;
+    // attack, decay, or release stages move the value
+    for( ; i < nframes && d->state != ADSR::SUSTAIN && d->state != ADSR::DONE; i++ )
+        out[i] = in[i] * d->ADSR::tick();
+    t_CKUINT ramped = i;
+    // sustain and done hold the value until the next keyOn/keyOff
+    for( ; i < nframes; i++ )
+        out[i] = in[i] * d->value;
+    // holding: as Envelope_tickv() | 1.5.5.3
+    if( d->state != ADSR::SUSTAIN && d->state != ADSR::DONE ) return TRUE;
+    return d->value == 0 && !ramped ? CK_TICK_SILENT | CK_TICK_DORMANT : CK_TICK_DORMANT;
 }
 
 
@@ -25099,6 +25283,23 @@ CK_DLL_DTOR( OnePole_dtor  )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: filter_rest() | 1.5.5.3 (added)
+// desc: whether a filter's past inputs and outputs have all decayed below
+//       CK_TICK_FLOOR; if so they are flushed to zero, and zero input gives
+//       zero output from here on
+//-----------------------------------------------------------------------------
+static t_CKBOOL filter_rest( FilterStk * f )
+{
+    int i;
+    for( i = 0; i < f->nB; i++ ) if( fabs( f->inputs[i] ) >= CK_TICK_FLOOR ) return FALSE;
+    for( i = 0; i < f->nA; i++ ) if( fabs( f->outputs[i] ) >= CK_TICK_FLOOR ) return FALSE;
+    for( i = 0; i < f->nB; i++ ) f->inputs[i] = 0;
+    for( i = 0; i < f->nA; i++ ) f->outputs[i] = 0;
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: OnePole_tick()
 // desc: TICK function ...
@@ -25107,7 +25308,30 @@ CK_DLL_TICK( OnePole_tick )
 {
     OnePole * m = (OnePole *)OBJ_MEMBER_UINT(SELF, OnePole_offset_data);
     *out = m->tick( in );
-    return TRUE;
+    return in == 0 && filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: OnePole_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( OnePole_tickv )
+{
+    OnePole * m = (OnePole *)OBJ_MEMBER_UINT(SELF, OnePole_offset_data);
+    // OnePole::tick(), with the state in locals for the block
+    const MY_FLOAT g = m->gain, b0 = m->b[0], a1 = m->a[1];
+    MY_FLOAT x0 = m->inputs[0], y0 = m->outputs[0], y1 = m->outputs[1];
+    for( t_CKUINT i = 0; i < nframes; i++ )
+    {
+        x0 = g * in[i];
+        y0 = b0 * x0 - a1 * y1;
+        y1 = y0;
+        CK_STK_DDN(y1);
+        out[i] = (SAMPLE)y0;
+    }
+    m->inputs[0] = x0; m->outputs[0] = y0; m->outputs[1] = y1;
+    return filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -25226,7 +25450,32 @@ CK_DLL_TICK( TwoPole_tick )
 {
     TwoPole * m = (TwoPole *)OBJ_MEMBER_UINT(SELF, TwoPole_offset_data);
     *out = m->tick( in );
-    return TRUE;
+    return in == 0 && filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: TwoPole_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( TwoPole_tickv )
+{
+    TwoPole * m = (TwoPole *)OBJ_MEMBER_UINT(SELF, TwoPole_offset_data);
+    // TwoPole::tick(), with the state in locals for the block
+    const MY_FLOAT g = m->gain, b0 = m->b[0], a1 = m->a[1], a2 = m->a[2];
+    MY_FLOAT x0 = m->inputs[0], y0 = m->outputs[0], y1 = m->outputs[1], y2 = m->outputs[2];
+    for( t_CKUINT i = 0; i < nframes; i++ )
+    {
+        x0 = g * in[i];
+        y0 = b0 * x0 - a2 * y2 - a1 * y1;
+        y2 = y1;
+        y1 = y0;
+        CK_STK_DDN(y1);
+        CK_STK_DDN(y2);
+        out[i] = (SAMPLE)y0;
+    }
+    m->inputs[0] = x0; m->outputs[0] = y0; m->outputs[1] = y1; m->outputs[2] = y2;
+    return filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -25418,7 +25667,29 @@ CK_DLL_TICK( OneZero_tick )
 {
     OneZero * m = (OneZero *)OBJ_MEMBER_UINT(SELF, OneZero_offset_data);
     *out = m->tick( in );
-    return TRUE;
+    return in == 0 && filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: OneZero_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( OneZero_tickv )
+{
+    OneZero * m = (OneZero *)OBJ_MEMBER_UINT(SELF, OneZero_offset_data);
+    // OneZero::tick(), with the state in locals for the block
+    const MY_FLOAT g = m->gain, b0 = m->b[0], b1 = m->b[1];
+    MY_FLOAT x0 = m->inputs[0], x1 = m->inputs[1], y0 = m->outputs[0];
+    for( t_CKUINT i = 0; i < nframes; i++ )
+    {
+        x0 = g * in[i];
+        y0 = b1 * x1 + b0 * x0;
+        x1 = x0;
+        out[i] = (SAMPLE)y0;
+    }
+    m->inputs[0] = x0; m->inputs[1] = x1; m->outputs[0] = y0;
+    return filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -25539,7 +25810,30 @@ CK_DLL_TICK( TwoZero_tick )
 {
     TwoZero * m = (TwoZero *)OBJ_MEMBER_UINT(SELF, TwoZero_offset_data);
     *out = m->tick( in );
-    return TRUE;
+    return in == 0 && filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: TwoZero_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( TwoZero_tickv )
+{
+    TwoZero * m = (TwoZero *)OBJ_MEMBER_UINT(SELF, TwoZero_offset_data);
+    // TwoZero::tick(), with the state in locals for the block
+    const MY_FLOAT g = m->gain, b0 = m->b[0], b1 = m->b[1], b2 = m->b[2];
+    MY_FLOAT x0 = m->inputs[0], x1 = m->inputs[1], x2 = m->inputs[2], y0 = m->outputs[0];
+    for( t_CKUINT i = 0; i < nframes; i++ )
+    {
+        x0 = g * in[i];
+        y0 = b2 * x2 + b1 * x1 + b0 * x0;
+        x2 = x1;
+        x1 = x0;
+        out[i] = (SAMPLE)y0;
+    }
+    m->inputs[0] = x0; m->inputs[1] = x1; m->inputs[2] = x2; m->outputs[0] = y0;
+    return filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -25698,7 +25992,31 @@ CK_DLL_TICK( PoleZero_tick )
 {
     PoleZero * m = (PoleZero *)OBJ_MEMBER_UINT(SELF, PoleZero_offset_data);
     *out = m->tick( in );
-    return TRUE;
+    return in == 0 && filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// name: PoleZero_tickv()
+// desc: TICKV function | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( PoleZero_tickv )
+{
+    PoleZero * m = (PoleZero *)OBJ_MEMBER_UINT(SELF, PoleZero_offset_data);
+    // PoleZero::tick(), with the state in locals for the block
+    const MY_FLOAT g = m->gain, b0 = m->b[0], b1 = m->b[1], a1 = m->a[1];
+    MY_FLOAT x0 = m->inputs[0], x1 = m->inputs[1], y0 = m->outputs[0], y1 = m->outputs[1];
+    for( t_CKUINT i = 0; i < nframes; i++ )
+    {
+        x0 = g * in[i];
+        y0 = b0 * x0 + b1 * x1 - a1 * y1;
+        x1 = x0;
+        y1 = y0;
+        CK_STK_DDN(y1);
+        out[i] = (SAMPLE)y0;
+    }
+    m->inputs[0] = x0; m->inputs[1] = x1; m->outputs[0] = y0; m->outputs[1] = y1;
+    return filter_rest( m ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -26897,7 +27215,8 @@ CK_DLL_TICK( JCRev_tick )
 {
     JCRev * j = (JCRev *)OBJ_MEMBER_UINT(SELF, JCRev_offset_data);
     *out = j->tick( in );
-    return TRUE;
+    // tail died away (and cleared) | 1.5.5.3
+    return j->rest( in ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -26960,6 +27279,38 @@ CK_DLL_DTOR( Mandolin_dtor  )
 }
 
 
+//-----------------------------------------------------------------------------
+// name: pluck_rest() | 1.5.5.3 (added)
+// desc: whether a string loop has died away: count samples in a row its
+//       filter feeds the line less than CK_TICK_FLOOR; once that covers the
+//       line's length, nothing audible is left in it, and it is flushed
+//-----------------------------------------------------------------------------
+static t_CKBOOL pluck_rest( DelayA * d, OneZero * f )
+{
+    if( fabs( f->lastOut() ) >= CK_TICK_FLOOR ) { d->quiet = 0; return FALSE; }
+    if( d->quiet < (unsigned long)d->length )
+    {
+        if( ++d->quiet < (unsigned long)d->length ) return FALSE;
+        // (sets quiet back to length)
+        d->clear();
+    }
+    return filter_rest( f );
+}
+
+
+//-----------------------------------------------------------------------------
+// name: pluck_still() | 1.5.5.3 (added)
+// desc: whether a string loop is still at rest, as pluck_rest() left it
+//-----------------------------------------------------------------------------
+static t_CKBOOL pluck_still( DelayA * d, OneZero * f )
+{
+    if( d->quiet < (unsigned long)d->length ) return FALSE;
+    for( int i = 0; i < f->nB; i++ ) if( f->inputs[i] != 0 ) return FALSE;
+    for( int i = 0; i < f->nA; i++ ) if( f->outputs[i] != 0 ) return FALSE;
+    return TRUE;
+}
+
+
 //-----------------------------------------------------------------------------
 // name: Mandolin_tick()
 // desc: TICK function ...
@@ -26967,8 +27318,20 @@ CK_DLL_DTOR( Mandolin_dtor  )
 CK_DLL_TICK( Mandolin_tick )
 {
     Mandolin * m = (Mandolin *)OBJ_MEMBER_UINT(SELF, Instrmnt_offset_data);
+    // still at rest: a tick would output zero, and only move the empty
+    // string lines along; but where they are changes how a later setDelay()
+    // rounds, so hold them, as when the VM skips the tick | 1.5.5.3
+    if( m->waveDone && m->dampTime < 0 && pluck_still( m->delayLine, m->filter ) &&
+        pluck_still( m->delayLine2, m->filter2 ) )
+    {
+        *out = 0;
+        return CK_TICK_DORMANT;
+    }
     *out = m->tick();
-    return TRUE;
+    // both strings have died away, after the pluck | 1.5.5.3
+    t_CKBOOL rest = pluck_rest( m->delayLine, m->filter );
+    rest = pluck_rest( m->delayLine2, m->filter2 ) && rest;
+    return rest && m->waveDone && m->dampTime < 0 ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -27534,7 +27897,8 @@ CK_DLL_TICK( NRev_tick )
 {
     NRev * j = (NRev *)OBJ_MEMBER_UINT(SELF, NRev_offset_data);
     *out = j->tick( in );
-    return TRUE;
+    // tail died away (and cleared) | 1.5.5.3
+    return j->rest( in ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -27698,7 +28062,8 @@ CK_DLL_TICK( PRCRev_tick )
 {
     PRCRev * j = (PRCRev *)OBJ_MEMBER_UINT(SELF, PRCRev_offset_data);
     *out = j->tick( in );
-    return TRUE;
+    // tail died away (and cleared) | 1.5.5.3
+    return j->rest( in ) ? CK_TICK_DORMANT : TRUE;
 }
 
 
@@ -769,6 +769,9 @@ public:
   long outPoint;
   long length;
   MY_FLOAT delay;
+  // zero samples in a row at the input (the line is all zeros once this
+  // reaches length); kept by the ugen glue | 1.5.5.3
+  unsigned long quiet;
 };
 
 #endif
@@ -3434,6 +3437,9 @@ class Reverb : public Stk
   //! Take \e vectorSize inputs, compute the same number of outputs and return them in \e vector.
   virtual MY_FLOAT *tick(MY_FLOAT *vector, unsigned int vectorSize);
 
+  //! Count one sample of input; true once the tail has died away under silent input (and been cleared). (added 1.5.5.3)
+  bool rest(MY_FLOAT input);
+
  public: // SWAP formerly protected
 
   // Returns true if argument value is prime.
@@ -3441,6 +3447,10 @@ class Reverb : public Stk
 
   MY_FLOAT lastOutput[2];
   MY_FLOAT effectMix;
+  // zero input in a row; how much of it takes the tail to -180dB (set by
+  // each reverb from its T60 and delay lengths) | 1.5.5.3
+  unsigned long quietFrames;
+  unsigned long tailFrames;
 
 };
 
@@ -64,7 +64,12 @@
 #include "util_platforms.h"
 #endif
 
+#include <atomic>
 #include <fstream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
 using namespace std;
 
 
@@ -75,6 +80,7 @@ CK_DLL_CTOR( subgraph_ctor );
 CK_DLL_CTOR( foogen_ctor );
 CK_DLL_DTOR( foogen_dtor );
 CK_DLL_TICK( foogen_tick );
+CK_DLL_TICKV( foogen_tickv );
 
 
 // LiSa query
@@ -87,6 +93,7 @@ static t_CKUINT g_srateXxx;
 static t_CKUINT subgraph_offset_inlet = 0;
 static t_CKUINT subgraph_offset_outlet = 0;
 static t_CKUINT foogen_offset_data = 0;
+static t_CKUINT voicepool_offset_data = 0;
 static t_CKUINT stereo_offset_left = 0;
 static t_CKUINT stereo_offset_right = 0;
 static t_CKUINT stereo_offset_pan = 0;
@@ -110,6 +117,19 @@ enum PanTypesEnum
     PAN_LINEAR // not supported
 };
 
+// VoicePool steal policies | 1.5.5.3 (added)
+enum VoicePoolStealEnum
+{
+    VOICEPOOL_STEAL_OLDEST = 0,
+    VOICEPOOL_STEAL_LOWEST,
+    VOICEPOOL_STEAL_HIGHEST,
+    VOICEPOOL_STEAL_NONE
+};
+static t_CKINT voicepool_steal_OLDEST = VOICEPOOL_STEAL_OLDEST;
+static t_CKINT voicepool_steal_LOWEST = VOICEPOOL_STEAL_LOWEST;
+static t_CKINT voicepool_steal_HIGHEST = VOICEPOOL_STEAL_HIGHEST;
+static t_CKINT voicepool_steal_NONE = VOICEPOOL_STEAL_NONE;
+
 //-----------------------------------------------------------------------------
 // this is called for this module to know when sample rate changes | 1.5.4.2 (ge) added
 //-----------------------------------------------------------------------------
@@ -185,7 +205,7 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
     //-------------------------------------------------------------------------
     // init as base class: FooGen
     //-------------------------------------------------------------------------
-    doc = "base class for user-created in-language unit generators.";
+    doc = "base class for user-created in-language unit generators; define `fun float tick( float in )`, or `fun void tickBlock( float in[], float out[] )` to compute a block of samples per call.";
     if( !type_engine_import_ugen_begin( env, "Chugen", "UGen", env->global(),
                                         foogen_ctor, foogen_dtor, foogen_tick, NULL, 1, 1,
                                         doc.c_str() ) )
@@ -201,6 +221,75 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
         return FALSE;
 
 
+    //-------------------------------------------------------------------------
+    // init as base class: VoicePool | 1.5.5.3 (added)
+    //-------------------------------------------------------------------------
+    doc = "a fixed pool of voices (StkInstruments, or any UGen with noteOn( float ), and optionally freq( float ) and noteOff( float )), mixed to this ugen's output; noteOn() goes to a free voice, or steals one, without allocating or changing the graph.";
+    if( !type_engine_import_ugen_begin( env, "VoicePool", "Chugraph", env->global(),
+                                        voicepool_ctor, voicepool_dtor, NULL, NULL, doc.c_str() ) )
+        return FALSE;
+
+    voicepool_offset_data = type_engine_import_mvar( env, "int", "@voicepool_data", FALSE );
+    if( voicepool_offset_data == CK_INVALID_OFFSET ) goto error;
+
+    func = make_new_mfun( "int", "voices", voicepool_ctrl_voices );
+    func->add_arg( "UGen[]", "voices" );
+    func->doc = "use these ugens as the pool (replacing any previous voices), connected to this ugen's outlet; returns the number of usable voices.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "int", "voices", voicepool_cget_voices );
+    func->doc = "get the number of voices in the pool.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "UGen", "voice", voicepool_cget_voice );
+    func->add_arg( "int", "which" );
+    func->doc = "get a voice of the pool, or null if no such voice.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "int", "steal", voicepool_ctrl_steal );
+    func->add_arg( "int", "policy" );
+    func->doc = "set which held voice a noteOn() takes when no voice is free: VoicePool.OLDEST (default), LOWEST, HIGHEST, or NONE (drop the note).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "int", "steal", voicepool_cget_steal );
+    func->doc = "get the voice stealing policy.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "int", "held", voicepool_cget_held );
+    func->doc = "get the number of voices holding a note (on, not yet off).";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "int", "noteOn", voicepool_noteOn );
+    func->add_arg( "float", "freq" );
+    func->add_arg( "float", "velocity" );
+    func->doc = "play a note on a free voice (the one released longest ago) or a stolen one: sets the voice's freq, then calls its noteOn( velocity ); returns the voice index, or -1 if the note was dropped.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "int", "noteOff", voicepool_noteOff );
+    func->add_arg( "float", "freq" );
+    func->add_arg( "float", "velocity" );
+    func->doc = "release the most recent note held at this freq (calling the voice's noteOff( velocity )); returns the voice index, or -1 if no voice holds that note.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    func = make_new_mfun( "void", "allNotesOff", voicepool_allNotesOff );
+    func->add_arg( "float", "velocity" );
+    func->doc = "release all held notes.";
+    if( !type_engine_import_mfun( env, func ) ) goto error;
+
+    if( !type_engine_import_svar( env, "int", "OLDEST", TRUE, (t_CKUINT)&voicepool_steal_OLDEST,
+        "see steal(); take the voice holding the oldest note") ) goto error;
+    if( !type_engine_import_svar( env, "int", "LOWEST", TRUE, (t_CKUINT)&voicepool_steal_LOWEST,
+        "see steal(); take the voice holding the lowest note") ) goto error;
+    if( !type_engine_import_svar( env, "int", "HIGHEST", TRUE, (t_CKUINT)&voicepool_steal_HIGHEST,
+        "see steal(); take the voice holding the highest note") ) goto error;
+    if( !type_engine_import_svar( env, "int", "NONE", TRUE, (t_CKUINT)&voicepool_steal_NONE,
+        "see steal(); never steal; drop the new note") ) goto error;
+
+    // end import
+    if( !type_engine_import_class_end( env ) )
+        return FALSE;
+
+
     //-------------------------------------------------------------------------
     // init as base class: UGen_Multi
     //-------------------------------------------------------------------------
@@ -402,6 +491,10 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
     if( !type_engine_import_ugen_begin( env, "Noise", "UGen", env->global(),
                                         NULL, NULL, noise_tick, NULL, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, noise_tickv ) ) goto error;
+    // shares the random number generator | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_serial( env ) ) goto error;
 
     if( !type_engine_import_add_ex( env, "basic/wind.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "deep/smb.ck" ) ) goto error;
@@ -729,6 +822,8 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
                                         sndbuf_ctor, sndbuf_dtor,
                                         sndbuf_tick, NULL, 1, 1, doc.c_str() ) )
         return FALSE;
+    // block tick | 1.5.5.3 (added)
+    if( !type_engine_import_ugen_tickv( env, sndbuf_tickv ) ) goto error;
 
     if( !type_engine_import_add_ex( env, "basic/sndbuf.ck" ) ) goto error;
     if( !type_engine_import_add_ex( env, "basic/doh.ck" ) ) goto error;
@@ -908,6 +1003,42 @@ DLL_QUERY xxx_query( Chuck_DL_Query * QUERY )
     func->doc = "get sample value at given position (in samples).";
     if( !type_engine_import_mfun( env, func ) ) goto error;
 
+    // add sfun: cacheLimit | 1.5.5.3 (added)
+    func = make_new_sfun( "int", "cacheLimit", sndbuf_cache_ctrl_limit );
+    func->add_arg( "int", "bytes" );
+    func->doc = "set the memory limit (in bytes) of the sample cache shared by all SndBufs in the process; files in use are never evicted; 0 stops caching new files.";
+    if( !type_engine_import_sfun( env, func ) ) goto error;
+
+    // add sfun: cacheLimit | 1.5.5.3 (added)
+    func = make_new_sfun( "int", "cacheLimit", sndbuf_cache_cget_limit );
+    func->doc = "get the memory limit (in bytes) of the shared sample cache.";
+    if( !type_engine_import_sfun( env, func ) ) goto error;
+
+    // add sfun: cacheFiles | 1.5.5.3 (added)
+    func = make_new_sfun( "int", "cacheFiles", sndbuf_cache_cget_files );
+    func->doc = "get the number of decoded files in the shared sample cache.";
+    if( !type_engine_import_sfun( env, func ) ) goto error;
+
+    // add sfun: cacheBytes | 1.5.5.3 (added)
+    func = make_new_sfun( "int", "cacheBytes", sndbuf_cache_cget_bytes );
+    func->doc = "get the memory (in bytes) held by the shared sample cache.";
+    if( !type_engine_import_sfun( env, func ) ) goto error;
+
+    // add sfun: cacheHits | 1.5.5.3 (added)
+    func = make_new_sfun( "int", "cacheHits", sndbuf_cache_cget_hits );
+    func->doc = "get the number of reads served from the shared sample cache.";
+    if( !type_engine_import_sfun( env, func ) ) goto error;
+
+    // add sfun: cacheMisses | 1.5.5.3 (added)
+    func = make_new_sfun( "int", "cacheMisses", sndbuf_cache_cget_misses );
+    func->doc = "get the number of file reads not found in the shared sample cache.";
+    if( !type_engine_import_sfun( env, func ) ) goto error;
+
+    // add sfun: cacheEvictions | 1.5.5.3 (added)
+    func = make_new_sfun( "int", "cacheEvictions", sndbuf_cache_cget_evictions );
+    func->doc = "get the number of files evicted from the shared sample cache.";
+    if( !type_engine_import_sfun( env, func ) ) goto error;
+
     // end import
     if( !type_engine_import_class_end( env ) )
         return FALSE;
@@ -1619,12 +1750,19 @@ struct FooGen_Data
     Chuck_VM * vm;
     // invoker of member functions
     Chuck_VM_MFunInvoker * invoker;
+    // invoker of tickBlock(), if defined | 1.5.5.3
+    Chuck_VM_MFunInvoker * invoker_block;
+    // tickBlock() arguments, reused from block to block
+    Chuck_ArrayFloat * block_in;
+    Chuck_ArrayFloat * block_out;
+    std::vector<Chuck_DL_Arg> block_args;
 
     t_CKFLOAT input;
     t_CKFLOAT output;
 
     // constructor
-    FooGen_Data() : vm(NULL), invoker(NULL), input(0), output(0) { }
+    FooGen_Data() : vm(NULL), invoker(NULL), invoker_block(NULL),
+        block_in(NULL), block_out(NULL), input(0), output(0) { }
 };
 
 
@@ -1646,8 +1784,58 @@ CK_DLL_CTOR( foogen_ctor )
     Chuck_UGen * ugen = (Chuck_UGen *)SELF;
     // a chuck function ref
     Chuck_Func * func = NULL;
+    Chuck_Func * block_func = NULL;
     // function vtable offset
     t_CKINT tick_fun_index = -1;
+    t_CKINT block_fun_index = -1;
+    // float[]
+    Chuck_Type * arg_type = NULL;
+
+    // ticks run ChucK code; keep to the VM thread, in order | 1.5.5.3
+    ugen->m_vm_tick = TRUE;
+    ugen->tickv = foogen_tickv;
+
+    // look for tickBlock( float[], float[] ) | 1.5.5.3
+    for( t_CKUINT i = 0; i < ugen->vtable->funcs.size(); i++ )
+    {
+        // the function
+        block_func = ugen->vtable->funcs[i];
+        if( block_func->base_name != "tickBlock" ) continue;
+        // two float[] arguments
+        a_Arg_List args = block_func->def()->arg_list;
+        t_CKINT n = 0;
+        for( ; args; args = args->next, n++ )
+        {
+            arg_type = args->type;
+            if( !isa( arg_type, SHRED->vm_ref->env()->ckt_array ) ||
+                arg_type->array_depth != 1 ||
+                arg_type->array_type != SHRED->vm_ref->env()->ckt_float )
+                break;
+        }
+        if( args || n != 2 ) continue;
+        block_fun_index = (t_CKINT)i;
+        break;
+    }
+
+    // set up the block invoker
+    if( block_fun_index >= 0 )
+    {
+        data->block_in = new Chuck_ArrayFloat( 0 );
+        initialize_object( data->block_in, SHRED->vm_ref->env()->ckt_array, SHRED, VM );
+        CK_SAFE_ADD_REF( data->block_in );
+        data->block_out = new Chuck_ArrayFloat( 0 );
+        initialize_object( data->block_out, SHRED->vm_ref->env()->ckt_array, SHRED, VM );
+        CK_SAFE_ADD_REF( data->block_out );
+        // the arguments never change
+        data->block_args.resize( 2 );
+        data->block_args[0].kind = kindof_INT;
+        data->block_args[0].value.v_object = data->block_in;
+        data->block_args[1].kind = kindof_INT;
+        data->block_args[1].value.v_object = data->block_out;
+        // create invoker
+        data->invoker_block = new Chuck_VM_MFunInvoker();
+        data->invoker_block->setup( block_func, block_fun_index, VM, SHRED );
+    }
 
     // iterate over functions in the virtual table
     for( t_CKINT i = 0; i < ugen->vtable->funcs.size(); i++ )
@@ -1673,6 +1861,8 @@ CK_DLL_CTOR( foogen_ctor )
     // if we have a valid
     if( tick_fun_index < 0 )
     {
+        // tickBlock() will do, for single samples too | 1.5.5.3
+        if( data->invoker_block ) return;
         // SPENCERTODO: warn on Chugen definition instead of instantiation?
         EM_error3( "ChuGen '%s' does not define a `fun float tick( float int )` function...",
                    ugen->type_ref->base_name.c_str());
@@ -1695,6 +1885,9 @@ CK_DLL_DTOR( foogen_dtor )
     FooGen_Data * data = (FooGen_Data *)OBJ_MEMBER_UINT(SELF, foogen_offset_data);
     OBJ_MEMBER_UINT( SELF, foogen_offset_data ) = 0;
     CK_SAFE_DELETE( data->invoker );
+    CK_SAFE_DELETE( data->invoker_block );
+    CK_SAFE_RELEASE( data->block_in );
+    CK_SAFE_RELEASE( data->block_out );
     CK_SAFE_DELETE( data );
 }
 
@@ -1707,11 +1900,6 @@ CK_DLL_TICK( foogen_tick )
     // get internal data
     FooGen_Data * data = (FooGen_Data *) OBJ_MEMBER_UINT(SELF, foogen_offset_data);
 
-    // set up argument into tick
-    vector<Chuck_DL_Arg> args;
-    args.push_back( Chuck_DL_Arg() );
-    args[0].kind = kindof_FLOAT;
-    args[0].value.v_float = in;
     // the return value
     Chuck_DL_Return ret;
 
@@ -1723,10 +1911,18 @@ CK_DLL_TICK( foogen_tick )
         // set input
         data->input = in;
         // invoke the function | 1.5.1.5 (ge) encapsulated into invoker
-        ret = data->invoker->invoke( SELF, args, SELF->originShred() );
+        // 1.5.5.3: one float argument, no vector to set up per sample
+        ret = data->invoker->invoke( SELF, data->input, SELF->originShred() );
         // set output
         data->output = ret.v_float;
     }
+    // no tick(), only tickBlock(); a block of one | 1.5.5.3
+    else if( data->invoker_block )
+    {
+        SAMPLE v = in;
+        foogen_tickv( SELF, &v, &v, 1, API );
+        data->output = v;
+    }
     // set out for tick function
     *out = data->output;
 
@@ -1736,6 +1932,468 @@ CK_DLL_TICK( foogen_tick )
 
 
 
+
+//-----------------------------------------------------------------------------
+// name: foogen_tickv()
+// desc: Chugen block tick; calls user provided tickBlock() once for the
+//       whole block if there is one, else tick() for each sample
+//       (added 1.5.5.3)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( foogen_tickv )
+{
+    // get internal data
+    FooGen_Data * data = (FooGen_Data *) OBJ_MEMBER_UINT(SELF, foogen_offset_data);
+    t_CKUINT i;
+
+    // no tickBlock(): one tick() at a time
+    if( !data->invoker_block )
+    {
+        for( i = 0; i < nframes; i++ )
+            foogen_tick( SELF, in[i], out+i, API );
+        return TRUE;
+    }
+
+    // the arrays; resized only when the block size changes, so tickBlock()
+    // can use in.size() and keep the arrays between calls
+    std::vector<t_CKFLOAT> & vin = data->block_in->m_vector;
+    std::vector<t_CKFLOAT> & vout = data->block_out->m_vector;
+    if( vin.size() != nframes ) vin.resize( nframes );
+    if( vout.size() != nframes ) vout.assign( nframes, 0 );
+    for( i = 0; i < nframes; i++ ) vin[i] = in[i];
+
+    // invoke
+    data->input = in[nframes-1];
+    data->invoker_block->invoke( SELF, data->block_args, SELF->originShred() );
+
+    // out[] may have been resized by tickBlock()
+    t_CKUINT n = ck_min( nframes, (t_CKUINT)vout.size() );
+    for( i = 0; i < n; i++ ) out[i] = (SAMPLE)vout[i];
+    for( ; i < nframes; i++ ) out[i] = 0;
+    data->output = out[nframes-1];
+
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: VoicePool_Method
+// desc: a voice's member function taking one float; a native mfun is
+//       called directly, a ChucK-defined one through its own invoker
+//-----------------------------------------------------------------------------
+struct VoicePool_Method
+{
+    Chuck_Func * func;
+    Chuck_VM_MFunInvoker * invoker;
+
+    VoicePool_Method() : func(NULL), invoker(NULL) { }
+};
+
+
+//-----------------------------------------------------------------------------
+// name: VoicePool_Voice
+// desc: one voice of a VoicePool; it sits on the held list (in noteOn order)
+//       or the released list (in noteOff order), linked by index
+//-----------------------------------------------------------------------------
+struct VoicePool_Voice
+{
+    Chuck_UGen * ugen;
+    // freq( float ), noteOn( float ), noteOff( float )
+    VoicePool_Method freq;
+    VoicePool_Method on;
+    VoicePool_Method off;
+    // freq of the current (or last) note
+    t_CKFLOAT pitch;
+    // holding a note?
+    t_CKBOOL held;
+    // neighbors on its list; -1 for none
+    t_CKINT prev;
+    t_CKINT next;
+
+    VoicePool_Voice() : ugen(NULL), pitch(0), held(FALSE), prev(-1), next(-1) { }
+};
+
+
+//-----------------------------------------------------------------------------
+// name: VoicePool_List
+// desc: a list of voices by index, oldest first
+//-----------------------------------------------------------------------------
+struct VoicePool_List
+{
+    t_CKINT head;
+    t_CKINT tail;
+    t_CKINT count;
+
+    VoicePool_List() : head(-1), tail(-1), count(0) { }
+};
+
+
+//-----------------------------------------------------------------------------
+// name: VoicePool_Data
+// desc: ...
+//-----------------------------------------------------------------------------
+struct VoicePool_Data
+{
+    std::vector<VoicePool_Voice> voices;
+    // voices holding a note, oldest noteOn first
+    VoicePool_List held;
+    // voices not holding a note, oldest noteOff first
+    VoicePool_List released;
+    // steal policy
+    t_CKINT steal;
+
+    VoicePool_Data() : steal(VOICEPOOL_STEAL_OLDEST) { }
+
+    // take voice i off its list
+    void unlink( VoicePool_List & list, t_CKINT i )
+    {
+        VoicePool_Voice & v = voices[i];
+        if( v.prev >= 0 ) voices[v.prev].next = v.next; else list.head = v.next;
+        if( v.next >= 0 ) voices[v.next].prev = v.prev; else list.tail = v.prev;
+        v.prev = v.next = -1;
+        list.count--;
+    }
+
+    // put voice i at the end of a list
+    void append( VoicePool_List & list, t_CKINT i )
+    {
+        VoicePool_Voice & v = voices[i];
+        v.prev = list.tail;
+        v.next = -1;
+        if( list.tail >= 0 ) voices[list.tail].next = i; else list.head = i;
+        list.tail = i;
+        list.count++;
+    }
+
+    // the voice for a new note, or -1 to drop it
+    t_CKINT take()
+    {
+        // free voice released longest ago; its tail has decayed the most
+        if( released.head >= 0 ) return released.head;
+
+        t_CKINT i, pick = held.head;
+        switch( steal )
+        {
+            case VOICEPOOL_STEAL_OLDEST:
+                break;
+            case VOICEPOOL_STEAL_LOWEST:
+                for( i = held.head; i >= 0; i = voices[i].next )
+                    if( voices[i].pitch < voices[pick].pitch ) pick = i;
+                break;
+            case VOICEPOOL_STEAL_HIGHEST:
+                for( i = held.head; i >= 0; i = voices[i].next )
+                    if( voices[i].pitch > voices[pick].pitch ) pick = i;
+                break;
+            default:
+                pick = -1;
+                break;
+        }
+        return pick;
+    }
+
+    // drop all voices
+    void clear( Chuck_UGen * pool )
+    {
+        for( t_CKUINT i = 0; i < voices.size(); i++ )
+        {
+            VoicePool_Voice & v = voices[i];
+            if( pool->outlet() ) pool->outlet()->remove( v.ugen );
+            CK_SAFE_DELETE( v.freq.invoker );
+            CK_SAFE_DELETE( v.on.invoker );
+            CK_SAFE_DELETE( v.off.invoker );
+            CK_SAFE_RELEASE( v.ugen );
+        }
+        voices.clear();
+        held = VoicePool_List();
+        released = VoicePool_List();
+    }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_find()
+// desc: find a voice's non-static member function 'name' taking one float
+//-----------------------------------------------------------------------------
+static void voicepool_find( VoicePool_Method & m, Chuck_UGen * ugen, const char * name,
+                            Chuck_VM * VM, Chuck_VM_Shred * SHRED )
+{
+    Chuck_Func * func = NULL;
+    a_Arg_List args = NULL;
+
+    // iterate over functions in the virtual table
+    for( t_CKUINT i = 0; i < ugen->vtable->funcs.size(); i++ )
+    {
+        func = ugen->vtable->funcs[i];
+        if( func->base_name != name || !func->is_member || !func->code ) continue;
+        // one float argument
+        args = func->def()->arg_list;
+        if( !args || args->next || args->type != VM->env()->ckt_float ) continue;
+
+        m.func = func;
+        // defined in ChucK code?
+        if( !func->code->native_func )
+        {
+            m.invoker = new Chuck_VM_MFunInvoker();
+            m.invoker->setup( func, i, VM, SHRED );
+        }
+        return;
+    }
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_call()
+// desc: call a voice's member function, if it has it
+//-----------------------------------------------------------------------------
+static void voicepool_call( VoicePool_Voice & v, VoicePool_Method & m, t_CKFLOAT arg,
+                            Chuck_VM * VM, Chuck_VM_Shred * SHRED, CK_DL_API API )
+{
+    if( !m.func ) return;
+
+    if( m.invoker ) m.invoker->invoke( v.ugen, arg, SHRED );
+    else
+    {
+        Chuck_DL_Return ret;
+        ((f_mfun)m.func->code->native_func)( v.ugen, &arg, &ret, VM, SHRED, API );
+    }
+
+    // as for any member call on a ugen, it may no longer be at rest
+    v.ugen->wake();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_release()
+// desc: noteOff voice i and put it on the released list
+//-----------------------------------------------------------------------------
+static void voicepool_release( VoicePool_Data * d, t_CKINT i, t_CKFLOAT velocity,
+                               Chuck_VM * VM, Chuck_VM_Shred * SHRED, CK_DL_API API )
+{
+    VoicePool_Voice & v = d->voices[i];
+    voicepool_call( v, v.off, velocity, VM, SHRED, API );
+    d->unlink( d->held, i );
+    d->append( d->released, i );
+    v.held = FALSE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_ctor()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_CTOR( voicepool_ctor )
+{
+    OBJ_MEMBER_UINT(SELF, voicepool_offset_data) = (t_CKUINT)new VoicePool_Data;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_dtor()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_DTOR( voicepool_dtor )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    OBJ_MEMBER_UINT(SELF, voicepool_offset_data) = 0;
+    if( d ) d->clear( (Chuck_UGen *)SELF );
+    CK_SAFE_DELETE( d );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_ctrl_voices()
+// desc: set up the pool; all lookups and allocation happen here
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_ctrl_voices )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    Chuck_UGen * pool = (Chuck_UGen *)SELF;
+    Chuck_ArrayInt * arr = (Chuck_ArrayInt *)GET_NEXT_OBJECT(ARGS);
+    Chuck_UGen * ugen = NULL;
+    t_CKUINT val = 0;
+
+    // out with the old
+    d->clear( pool );
+
+    for( t_CKINT i = 0; arr && i < arr->size(); i++ )
+    {
+        arr->get( i, &val );
+        ugen = (Chuck_UGen *)val;
+        if( !ugen ) continue;
+
+        VoicePool_Voice v;
+        voicepool_find( v.on, ugen, "noteOn", VM, SHRED );
+        if( !v.on.func )
+        {
+            EM_error3( "VoicePool: '%s' does not define a `noteOn( float )` function; skipping voice...",
+                       ugen->type_ref->base_name.c_str() );
+            continue;
+        }
+        voicepool_find( v.freq, ugen, "freq", VM, SHRED );
+        voicepool_find( v.off, ugen, "noteOff", VM, SHRED );
+
+        // hold on to it, and mix it
+        v.ugen = ugen;
+        CK_SAFE_ADD_REF( ugen );
+        pool->outlet()->add( ugen, FALSE );
+
+        d->voices.push_back( v );
+        d->append( d->released, d->voices.size()-1 );
+    }
+
+    RETURN->v_int = d->voices.size();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_cget_voices()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_cget_voices )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    RETURN->v_int = d->voices.size();
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_cget_voice()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_cget_voice )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    t_CKINT i = GET_NEXT_INT(ARGS);
+    RETURN->v_object = i >= 0 && i < (t_CKINT)d->voices.size() ? d->voices[i].ugen : NULL;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_ctrl_steal()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_ctrl_steal )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    t_CKINT policy = GET_NEXT_INT(ARGS);
+    if( policy >= VOICEPOOL_STEAL_OLDEST && policy <= VOICEPOOL_STEAL_NONE ) d->steal = policy;
+    RETURN->v_int = d->steal;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_cget_steal()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_cget_steal )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    RETURN->v_int = d->steal;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_cget_held()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_cget_held )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    RETURN->v_int = d->held.count;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_noteOn()
+// desc: O(1) but for LOWEST/HIGHEST stealing, which scan the held voices
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_noteOn )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    t_CKFLOAT freq = GET_NEXT_FLOAT(ARGS);
+    t_CKFLOAT velocity = GET_NEXT_FLOAT(ARGS);
+
+    t_CKINT i = d->take();
+    RETURN->v_int = i;
+    if( i < 0 ) return;
+
+    // to the end of the held list
+    VoicePool_Voice & v = d->voices[i];
+    d->unlink( v.held ? d->held : d->released, i );
+    d->append( d->held, i );
+    v.held = TRUE;
+    v.pitch = freq;
+
+    // play it
+    voicepool_call( v, v.freq, freq, VM, SHRED, API );
+    voicepool_call( v, v.on, velocity, VM, SHRED, API );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_noteOff()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_noteOff )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    t_CKFLOAT freq = GET_NEXT_FLOAT(ARGS);
+    t_CKFLOAT velocity = GET_NEXT_FLOAT(ARGS);
+
+    // most recent first
+    t_CKINT i = d->held.tail;
+    while( i >= 0 && d->voices[i].pitch != freq ) i = d->voices[i].prev;
+    RETURN->v_int = i;
+    if( i < 0 ) return;
+
+    voicepool_release( d, i, velocity, VM, SHRED, API );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: voicepool_allNotesOff()
+// desc: ...
+//-----------------------------------------------------------------------------
+CK_DLL_MFUN( voicepool_allNotesOff )
+{
+    VoicePool_Data * d = (VoicePool_Data *)OBJ_MEMBER_UINT(SELF, voicepool_offset_data);
+    t_CKFLOAT velocity = GET_NEXT_FLOAT(ARGS);
+
+    while( d->held.head >= 0 )
+        voicepool_release( d, d->held.head, velocity, VM, SHRED, API );
+}
+
+
+
 //-----------------------------------------------------------------------------
 // name: multi_ctor()
 // desc: ...
@@ -2028,6 +2686,20 @@ CK_DLL_TICK( noise_tick )
 }
 
 
+
+
+//-----------------------------------------------------------------------------
+// name: noise_tickv()
+// desc: block tick | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+CK_DLL_TICKV( noise_tickv )
+{
+    for( t_CKUINT i = 0; i < nframes; i++ )
+        out[i] = (SAMPLE)( -1.0 + 2.0 * ck_random_f() );
+    return TRUE;
+}
+
+
 enum { NOISE_WHITE=0, NOISE_PINK, NOISE_BROWN, NOISE_FBM, NOISE_FLIP, NOISE_XOR };
 
 class CNoise_Data
@@ -2774,6 +3446,8 @@ processing time is linearly related to this width */
 
 // default chunk size
 #define CK_SNDBUF_DEFAULT_CHUNK_SIZE (32768) // a little less than 1s of 44.1kHz
+// default memory limit of the shared sample cache | 1.5.5.3
+#define CK_SNDBUF_CACHE_LIMIT (128*1024*1024)
 
 #define USE_TABLE TRUE          /* this controls whether a linearly interpolated lookup
 table is used for sinc function calculation, or the
@@ -2969,10 +3643,241 @@ protected:
 };
 #endif /* CK_SNDBUF_MEMORY_BUFFER */
 
+
+
+
+//-----------------------------------------------------------------------------
+// name: struct SndBuf_Cache_Entry | 1.5.5.3 (added)
+// desc: a decoded sound file, shared by every SndBuf that reads it; the
+//       samples never change once in the cache; a file read in chunks
+//       (see SndBuf.chunks()) is filled in a chunk at a time, by whichever
+//       SndBuf first needs each one, and published with that chunk's flag
+//-----------------------------------------------------------------------------
+struct SndBuf_Cache_Entry
+{
+    // state of each chunk
+    enum { CHUNK_EMPTY = 0, CHUNK_READING, CHUNK_READY };
+
+    // path, size, and modification time of the file
+    std::string key;
+    // num_frames+1 frames of interleaved samples; the last is zero
+    SAMPLE * buffer;
+    t_CKUINT num_frames;
+    t_CKUINT num_channels;
+    t_CKUINT samplerate;
+    // size of buffer
+    t_CKUINT bytes;
+    // SndBufs using it; may be evicted only at 0
+    t_CKUINT refs;
+    // place in the LRU list
+    std::list<SndBuf_Cache_Entry *>::iterator lru;
+    // chunk size in samples (0 if read whole), the state of each chunk,
+    // and how many are not yet ready
+    t_CKUINT chunks;
+    std::atomic<t_CKUINT> * loaded;
+    std::atomic<t_CKUINT> missing;
+
+    SndBuf_Cache_Entry() : buffer( NULL ), loaded( NULL ), missing( 0 ) { }
+    ~SndBuf_Cache_Entry() { CK_SAFE_DELETE_ARRAY( loaded ); }
+
+    // whether all of buffer has been read (and can be read by this thread)
+    t_CKBOOL complete()
+    {
+        return missing.load( std::memory_order_acquire ) == 0;
+    }
+
+    // where chunk i goes in buffer
+    SAMPLE * shared_chunk( t_CKUINT i )
+    {
+        return buffer + i*chunks;
+    }
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: class SndBuf_Cache | 1.5.5.3 (added)
+// desc: process-wide cache of decoded sound files, across ChucK instances;
+//       unused files are evicted least recently used first once over the
+//       limit; only called from SndBuf.read() and SndBuf cleanup, never
+//       from a tick
+//-----------------------------------------------------------------------------
+class SndBuf_Cache
+{
+public:
+    SndBuf_Cache() : m_limit( CK_SNDBUF_CACHE_LIMIT ), m_bytes( 0 ),
+        m_hits( 0 ), m_misses( 0 ), m_evictions( 0 ) { }
+
+    // in-use entries (if any are left at exit) stay allocated
+    ~SndBuf_Cache()
+    {
+        std::list<SndBuf_Cache_Entry *>::iterator it;
+        for( it = m_lru.begin(); it != m_lru.end(); it++ )
+        {
+            if( (*it)->refs ) continue;
+            CK_SAFE_DELETE_ARRAY( (*it)->buffer );
+            CK_SAFE_DELETE( *it );
+        }
+    }
+
+    // the one cache
+    static SndBuf_Cache & instance()
+    {
+        static SndBuf_Cache cache;
+        return cache;
+    }
+
+public:
+    // a reference to the entry for key, or NULL; an entry still being read
+    // in chunks is only for SndBufs with the same chunk size
+    SndBuf_Cache_Entry * acquire( const std::string & key, t_CKUINT chunks )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        std::map<std::string, SndBuf_Cache_Entry *>::iterator it = m_entries.find( key );
+        if( it == m_entries.end() ||
+            ( it->second->chunks != chunks && !it->second->complete() ) )
+        { m_misses++; return NULL; }
+        m_hits++;
+        SndBuf_Cache_Entry * e = it->second;
+        e->refs++;
+        m_lru.splice( m_lru.begin(), m_lru, e->lru );
+        return e;
+    }
+
+    // is a file of this many bytes worth caching? (so that one long file
+    // does not push out everything else)
+    t_CKBOOL fits( t_CKUINT bytes )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        return bytes <= m_limit / 4;
+    }
+
+    // add buffer (new[]'d; the cache takes it) as key; returns a reference;
+    // chunks is 0 if buffer is read in full, else its chunk size, in samples
+    // (none read yet); if another thread got there first, buffer is deleted
+    // and theirs returned, if it is complete or read in the same chunks;
+    // otherwise NULL is returned, and buffer is left to the caller
+    SndBuf_Cache_Entry * insert( const std::string & key, SAMPLE * buffer,
+                                 t_CKUINT num_frames, t_CKUINT num_channels,
+                                 t_CKUINT samplerate, t_CKUINT chunks )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        std::map<std::string, SndBuf_Cache_Entry *>::iterator it = m_entries.find( key );
+        if( it != m_entries.end() )
+        {
+            if( it->second->chunks != chunks && !it->second->complete() )
+                return NULL;
+            delete [] buffer;
+            it->second->refs++;
+            return it->second;
+        }
+
+        SndBuf_Cache_Entry * e = new SndBuf_Cache_Entry;
+        e->key = key;
+        e->buffer = buffer;
+        e->num_frames = num_frames;
+        e->num_channels = num_channels;
+        e->samplerate = samplerate;
+        e->bytes = (num_frames+1) * num_channels * sizeof(SAMPLE);
+        e->refs = 1;
+        e->chunks = chunks;
+        t_CKUINT n = chunks ? (num_frames*num_channels + chunks-1) / chunks : 0;
+        e->missing.store( n );
+        e->loaded = new std::atomic<t_CKUINT>[n];
+        for( t_CKUINT i = 0; i < n; i++ ) e->loaded[i].store( SndBuf_Cache_Entry::CHUNK_EMPTY );
+        m_lru.push_front( e );
+        e->lru = m_lru.begin();
+        m_entries[key] = e;
+        m_bytes += e->bytes;
+        trim();
+        return e;
+    }
+
+    // drop a reference
+    void release( SndBuf_Cache_Entry * e )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        e->refs--;
+        if( !e->refs ) trim();
+    }
+
+    // set the memory limit, in bytes; 0 stops caching new files
+    void limit( t_CKUINT bytes )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_limit = bytes;
+        trim();
+    }
+
+    // metrics
+    void stats( SndBuf_Cache_Stats * stats )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        stats->files = m_entries.size();
+        stats->bytes = m_bytes;
+        stats->limit = m_limit;
+        stats->hits = m_hits;
+        stats->misses = m_misses;
+        stats->evictions = m_evictions;
+    }
+
+protected:
+    // evict unused entries, oldest use first, until under the limit
+    // (entries in use cost the same memory whether cached or not)
+    void trim()
+    {
+        std::list<SndBuf_Cache_Entry *>::iterator it = m_lru.end();
+        while( m_bytes > m_limit && it != m_lru.begin() )
+        {
+            SndBuf_Cache_Entry * e = *(--it);
+            if( e->refs ) continue;
+            it = m_lru.erase( it );
+            m_entries.erase( e->key );
+            m_bytes -= e->bytes;
+            m_evictions++;
+            CK_SAFE_DELETE_ARRAY( e->buffer );
+            CK_SAFE_DELETE( e );
+        }
+    }
+
+protected:
+    std::mutex m_mutex;
+    std::map<std::string, SndBuf_Cache_Entry *> m_entries;
+    // most recently used first
+    std::list<SndBuf_Cache_Entry *> m_lru;
+    t_CKUINT m_limit;
+    t_CKUINT m_bytes;
+    t_CKUINT m_hits;
+    t_CKUINT m_misses;
+    t_CKUINT m_evictions;
+};
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_sndbuf_cache_stats() / ck_sndbuf_cache_limit() | 1.5.5.3 (added)
+// desc: host access to the SndBuf cache
+//-----------------------------------------------------------------------------
+void ck_sndbuf_cache_stats( SndBuf_Cache_Stats * stats )
+{
+    SndBuf_Cache::instance().stats( stats );
+}
+void ck_sndbuf_cache_limit( t_CKUINT bytes )
+{
+    SndBuf_Cache::instance().limit( bytes );
+}
+
+
+
+
 // data for each sndbuf
 struct sndbuf_data
 {
     SAMPLE * buffer;
+    // the cache entry buffer belongs to, if shared | 1.5.5.3
+    SndBuf_Cache_Entry * cached;
     t_CKUINT num_samples;
     t_CKUINT num_channels;
     t_CKUINT num_frames;
@@ -3016,6 +3921,7 @@ struct sndbuf_data
     sndbuf_data()
     {
         buffer = NULL;
+        cached = NULL;
         interp = SNDBUF_INTERP;
         num_channels = 0;
         num_frames = 0;
@@ -3060,14 +3966,26 @@ struct sndbuf_data
             this->fd = NULL;
         }
 
-        CK_SAFE_DELETE_ARRAY( buffer );
+        free_buffer();
+    }
 
+    // let go of buffer and chunks, shared or not | 1.5.5.3
+    void free_buffer()
+    {
+        // clean up chunk map
         if( chunk_map )
         {
+            // shared chunks are in the cache entry's buffer
             for(int i = 0; i < chunk_num; i++)
-                CK_SAFE_DELETE_ARRAY(chunk_map[i]);
+                if( !cached || chunk_map[i] != cached->shared_chunk( i ) )
+                    CK_SAFE_DELETE_ARRAY(chunk_map[i]);
             CK_SAFE_DELETE_ARRAY(chunk_map);
+            chunk_num = 0;
         }
+        if( cached ) SndBuf_Cache::instance().release( cached );
+        else CK_SAFE_DELETE_ARRAY( buffer );
+        cached = NULL;
+        buffer = NULL;
     }
 
     inline void sampleIndex2FrameIndexAndChannel(t_CKINT sample, t_CKINT *frame, t_CKINT *channel)
@@ -3171,6 +4089,32 @@ inline t_CKUINT sndbuf_read( sndbuf_data * d, t_CKUINT frame, t_CKUINT num_frame
     return n;
 }
 
+// cache key for a sound file: absolute path, size, and modification time,
+// to the nanosecond where the platform has it | 1.5.5.3
+static t_CKBOOL sndbuf_cache_key( const char * filename, std::string & key )
+{
+#ifdef __ANDROID__
+    // copied out of the JAR on each read
+    if( strstr(filename, "jar:") == filename ) return FALSE;
+#endif
+    struct stat s;
+    if( stat( filename, &s ) ) return FALSE;
+
+#if defined(__PLATFORM_APPLE__)
+    long long nsec = s.st_mtimespec.tv_nsec;
+#elif defined(__PLATFORM_WINDOWS__)
+    long long nsec = 0; // whole seconds only
+#else
+    long long nsec = s.st_mtim.tv_nsec;
+#endif
+
+    char buf[96];
+    snprintf( buf, sizeof(buf), "|%lld|%lld.%09lld", (long long)s.st_size, (long long)s.st_mtime, nsec );
+    // same file however it was named (relative, via links, ...)
+    key = normalize_filepath( filename ) + buf;
+    return TRUE;
+}
+
 inline t_CKINT sndbuf_load( sndbuf_data * d, t_CKUINT sample )
 {
     // map to bin
@@ -3181,6 +4125,49 @@ inline t_CKINT sndbuf_load( sndbuf_data * d, t_CKUINT sample )
     // already loaded
     if( d->chunk_map[bin] ) return 0;
 
+    // shared: read into the cache entry, unless another SndBuf has; no
+    // lock is held while reading, so SndBufs in other VMs never wait on
+    // this one's disk | 1.5.5.3
+    if( d->cached )
+    {
+        SndBuf_Cache_Entry * e = d->cached;
+        t_CKINT ret = 0;
+        t_CKUINT state = SndBuf_Cache_Entry::CHUNK_EMPTY;
+        if( e->loaded[bin].load( std::memory_order_acquire ) == SndBuf_Cache_Entry::CHUNK_READY )
+        {
+            d->chunk_map[bin] = e->shared_chunk( bin );
+        }
+        else if( e->loaded[bin].compare_exchange_strong( state, SndBuf_Cache_Entry::CHUNK_READING,
+                                                         std::memory_order_acquire ) )
+        {
+            // ours to read, in place
+            d->chunk_map[bin] = e->shared_chunk( bin );
+            ret = sndbuf_read( d, bin*d->chunks/d->num_channels, d->chunks/d->num_channels );
+            e->loaded[bin].store( SndBuf_Cache_Entry::CHUNK_READY, std::memory_order_release );
+            e->missing.fetch_sub( 1, std::memory_order_acq_rel );
+        }
+        else
+        {
+            // another SndBuf is reading it: read our own copy
+            d->chunk_map[bin] = new SAMPLE[d->chunks];
+            ret = sndbuf_read( d, bin*d->chunks/d->num_channels, d->chunks/d->num_channels );
+        }
+
+        // all read, by one SndBuf or another: no more need for the file
+        if( d->fd && e->complete() )
+        {
+            for( t_CKUINT i = 0; i < d->chunk_num; i++ )
+            {
+                if( d->chunk_map[i] != e->shared_chunk( i ) )
+                    CK_SAFE_DELETE_ARRAY( d->chunk_map[i] );
+                d->chunk_map[i] = e->shared_chunk( i );
+            }
+            sf_close( d->fd );
+            d->fd = NULL;
+        }
+        return ret;
+    }
+
     // allocate
     d->chunk_map[bin] = new SAMPLE[d->chunks];
 
@@ -3386,6 +4373,22 @@ double sndbuf_sinc( sndbuf_data * d, double x )
     }
 }
 
+// done playing (not looping), and moving away from the file, so only zeros
+// follow until a member function changes that | 1.5.5.3 (added)
+static t_CKBOOL sndbuf_done( sndbuf_data * d )
+{
+    return !d->loop && ( (d->curf >= d->num_frames && d->rate >= 0) ||
+                         (d->curf < 0 && d->rate <= 0) );
+}
+
+// done, and not moving: only then may ticks be skipped, as the position
+// keeps advancing past either end while rate != 0 (see 1.4.1.0 below),
+// e.g., for .pos() or a later negative .rate() | 1.5.5.3 (added)
+static t_CKBOOL sndbuf_at_rest( sndbuf_data * d )
+{
+    return d->rate == 0 && sndbuf_done( d );
+}
+
 CK_DLL_TICK( sndbuf_tick )
 {
     sndbuf_data * d = (sndbuf_data *)OBJ_MEMBER_UINT(SELF, sndbuf_offset_data);
@@ -3443,7 +4446,7 @@ CK_DLL_TICK( sndbuf_tick )
     if( d->buffer == NULL && d->chunk_map == NULL )
     {
         *out = 0;
-        return TRUE;
+        return CK_TICK_SILENT | CK_TICK_DORMANT;
     }
 
     // we're ticking once per sample ( system )
@@ -3476,7 +4479,34 @@ CK_DLL_TICK( sndbuf_tick )
     d->curf += d->rate;
     sndbuf_setpos(d, d->curf);
 
-    return TRUE;
+    return sndbuf_at_rest( d ) ? CK_TICK_DORMANT : TRUE;
+}
+
+/* block tick | 1.5.5.3 (added) */
+CK_DLL_TICKV( sndbuf_tickv )
+{
+    sndbuf_data * d = (sndbuf_data *)OBJ_MEMBER_UINT(SELF, sndbuf_offset_data);
+    t_CKBOOL valid = TRUE;
+
+#ifndef CK_SNDBUF_MEMORY_BUFFER
+    // nothing loaded: silence, and nothing to advance
+    if( d->buffer == NULL && d->chunk_map == NULL )
+    {
+        memset( out, 0, nframes * sizeof(SAMPLE) );
+        return CK_TICK_SILENT | CK_TICK_DORMANT;
+    }
+    // already done: all zeros
+    t_CKBOOL done = sndbuf_done( d );
+#endif
+
+    // per-frame, as interpolation and chunked reads depend on position
+    for( t_CKUINT i = 0; i < nframes; i++ )
+        valid = sndbuf_tick( SELF, in[i], &out[i], API );
+
+#ifndef CK_SNDBUF_MEMORY_BUFFER
+    if( done ) valid |= CK_TICK_SILENT;
+#endif
+    return valid;
 }
 
 /* multi-chan tick */
@@ -3560,20 +4590,14 @@ CK_DLL_CTRL( sndbuf_ctrl_read )
     sndbuf_data * d = (sndbuf_data *)OBJ_MEMBER_UINT(SELF, sndbuf_offset_data);
     Chuck_String * ckfilename = GET_CK_STRING(ARGS);
     const char * filename = NULL;
+    // shared sample cache key, if the file can be cached
+    std::string key;
 
     // set return value
     RETURN->v_string = ckfilename;
 
-    // cleanup
-    CK_SAFE_DELETE_ARRAY(d->buffer);
-    // clean up chunk map
-    if( d->chunk_map )
-    {
-        for(int i = 0; i < d->chunk_num; i++)
-            CK_SAFE_DELETE_ARRAY(d->chunk_map[i]);
-        CK_SAFE_DELETE_ARRAY(d->chunk_map);
-        d->chunk_num = 0;
-    }
+    // cleanup (buffer and chunk map)
+    d->free_buffer();
     // close file descriptor
     if( d->fd )
     {
@@ -3710,6 +4734,23 @@ CK_DLL_CTRL( sndbuf_ctrl_read )
 
         d->buffer[rawsize] = d->buffer[0];
     }
+    // already decoded for another SndBuf | 1.5.5.3
+    else if( sndbuf_cache_key( filename, key ) &&
+             (d->cached = SndBuf_Cache::instance().acquire( key, d->chunks )) &&
+             d->cached->complete() )
+    {
+        d->buffer = d->cached->buffer;
+        d->chunk_map = NULL;
+        d->chan = 0;
+        d->num_frames = d->cached->num_frames;
+        d->num_channels = d->cached->num_channels;
+        d->samplerate = d->cached->samplerate;
+        d->num_samples = d->num_frames * d->num_channels;
+        d->chunks_read = d->num_samples;
+
+        // log
+        EM_log( CK_LOG_INFO, "(sndbuf): sharing cached samples for '%s'...", filename );
+    }
     else // read file
     {
 #ifdef __ANDROID__
@@ -3775,7 +4816,11 @@ CK_DLL_CTRL( sndbuf_ctrl_read )
 
         // allocate
         t_CKINT size = info.channels * info.frames;
-        if(d->chunks)
+        // small enough to share? (chunks must be whole frames, so that
+        // they line up in one buffer)
+        t_CKBOOL share = d->cached || ( key.length() && d->chunks % info.channels == 0 &&
+            SndBuf_Cache::instance().fits( (size+info.channels) * sizeof(SAMPLE) ) );
+        if( d->chunks )
         {
             // split into small allocations
             d->chunk_num = ceil(((t_CKFLOAT) size) / ((t_CKFLOAT) d->chunks)); // 1.5.0.0 (ge) | ceilf => ceil
@@ -3783,6 +4828,16 @@ CK_DLL_CTRL( sndbuf_ctrl_read )
             d->chunk_map = new SAMPLE*[d->chunk_num];
             memset(d->chunk_map, 0, d->chunk_num * sizeof(SAMPLE *));
             d->chunks_read = 0;
+
+            // or into one buffer in the cache, read as any SndBuf needs | 1.5.5.3
+            if( share && !d->cached )
+            {
+                SAMPLE * buffer = new SAMPLE[size+info.channels];
+                memset( buffer+size, 0, info.channels*sizeof(SAMPLE) );
+                d->cached = SndBuf_Cache::instance().insert( key, buffer,
+                    info.frames, info.channels, info.samplerate, d->chunks );
+                if( !d->cached ) delete [] buffer;
+            }
         }
         else
         {
@@ -3790,6 +4845,7 @@ CK_DLL_CTRL( sndbuf_ctrl_read )
             d->buffer = new SAMPLE[size+info.channels];
             memset( d->buffer, 0, (size+info.channels)*sizeof(SAMPLE) );
             d->chunk_map = NULL;
+            d->chunks_read = 0;
         }
 
         d->chan = 0;
@@ -3810,7 +4866,7 @@ CK_DLL_CTRL( sndbuf_ctrl_read )
         sf_seek( d->fd, 0, SEEK_SET );
 
         // no chunk
-        if( !d->chunks )
+        if( !d->chunk_map )
         {
             // read all
             t_CKUINT f = sndbuf_read( d, 0, d->num_frames );
@@ -3824,6 +4880,14 @@ CK_DLL_CTRL( sndbuf_ctrl_read )
             }
 
             assert( d->fd == NULL );
+
+            // hand it to the cache | 1.5.5.3
+            if( share )
+            {
+                d->cached = SndBuf_Cache::instance().insert( key, d->buffer,
+                    d->num_frames, d->num_channels, d->samplerate, 0 );
+                if( d->cached ) d->buffer = d->cached->buffer;
+            }
         }
     }
 
@@ -4022,6 +5086,56 @@ CK_DLL_CGET( sndbuf_cget_valueAt )
     RETURN->v_float = ( frame >= d->num_frames || frame < 0 ) ? 0 : sndbuf_sampleAt(d, frame, channel);
 }
 
+CK_DLL_SFUN( sndbuf_cache_ctrl_limit )
+{
+    t_CKINT bytes = GET_NEXT_INT(ARGS);
+    if( bytes < 0 ) bytes = 0;
+    ck_sndbuf_cache_limit( bytes );
+    RETURN->v_int = bytes;
+}
+
+CK_DLL_SFUN( sndbuf_cache_cget_limit )
+{
+    SndBuf_Cache_Stats stats;
+    ck_sndbuf_cache_stats( &stats );
+    RETURN->v_int = stats.limit;
+}
+
+CK_DLL_SFUN( sndbuf_cache_cget_files )
+{
+    SndBuf_Cache_Stats stats;
+    ck_sndbuf_cache_stats( &stats );
+    RETURN->v_int = stats.files;
+}
+
+CK_DLL_SFUN( sndbuf_cache_cget_bytes )
+{
+    SndBuf_Cache_Stats stats;
+    ck_sndbuf_cache_stats( &stats );
+    RETURN->v_int = stats.bytes;
+}
+
+CK_DLL_SFUN( sndbuf_cache_cget_hits )
+{
+    SndBuf_Cache_Stats stats;
+    ck_sndbuf_cache_stats( &stats );
+    RETURN->v_int = stats.hits;
+}
+
+CK_DLL_SFUN( sndbuf_cache_cget_misses )
+{
+    SndBuf_Cache_Stats stats;
+    ck_sndbuf_cache_stats( &stats );
+    RETURN->v_int = stats.misses;
+}
+
+CK_DLL_SFUN( sndbuf_cache_cget_evictions )
+{
+    SndBuf_Cache_Stats stats;
+    ck_sndbuf_cache_stats( &stats );
+    RETURN->v_int = stats.evictions;
+}
+
 #endif // __DISABLE_SNDBUF__
 
 
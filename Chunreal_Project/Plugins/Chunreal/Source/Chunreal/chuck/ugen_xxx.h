@@ -81,6 +81,7 @@ CK_DLL_MFUN( gain_ctor_1 );
 
 // noise
 CK_DLL_TICK( noise_tick );
+CK_DLL_TICKV( noise_tickv );
 
 // cnoise
 CK_DLL_CTOR( cnoise_ctor );
@@ -169,6 +170,7 @@ CK_DLL_CTOR( sndbuf_ctor_path_rate );
 CK_DLL_CTOR( sndbuf_ctor_path_rate_pos );
 CK_DLL_DTOR( sndbuf_dtor );
 CK_DLL_TICK( sndbuf_tick );
+CK_DLL_TICKV( sndbuf_tickv );
 CK_DLL_TICKF( sndbuf_tickf );
 CK_DLL_CTRL( sndbuf_ctrl_read );
 CK_DLL_CGET( sndbuf_cget_ready );
@@ -197,6 +199,41 @@ CK_DLL_CGET( sndbuf_cget_samples );
 CK_DLL_CGET( sndbuf_cget_length );
 CK_DLL_CGET( sndbuf_cget_channels );
 CK_DLL_CGET( sndbuf_cget_valueAt );
+CK_DLL_SFUN( sndbuf_cache_ctrl_limit );
+CK_DLL_SFUN( sndbuf_cache_cget_limit );
+CK_DLL_SFUN( sndbuf_cache_cget_files );
+CK_DLL_SFUN( sndbuf_cache_cget_bytes );
+CK_DLL_SFUN( sndbuf_cache_cget_hits );
+CK_DLL_SFUN( sndbuf_cache_cget_misses );
+CK_DLL_SFUN( sndbuf_cache_cget_evictions );
+
+// sndbuf cache, shared by all ChucK instances in the process | 1.5.5.3
+struct SndBuf_Cache_Stats
+{
+    t_CKUINT files;
+    t_CKUINT bytes;
+    t_CKUINT limit;
+    t_CKUINT hits;
+    t_CKUINT misses;
+    t_CKUINT evictions;
+};
+// get current cache metrics
+void ck_sndbuf_cache_stats( SndBuf_Cache_Stats * stats );
+// set cache memory limit, in bytes (0 disables caching)
+void ck_sndbuf_cache_limit( t_CKUINT bytes );
+
+// voicepool
+CK_DLL_CTOR( voicepool_ctor );
+CK_DLL_DTOR( voicepool_dtor );
+CK_DLL_MFUN( voicepool_ctrl_voices );
+CK_DLL_MFUN( voicepool_cget_voices );
+CK_DLL_MFUN( voicepool_cget_voice );
+CK_DLL_MFUN( voicepool_ctrl_steal );
+CK_DLL_MFUN( voicepool_cget_steal );
+CK_DLL_MFUN( voicepool_cget_held );
+CK_DLL_MFUN( voicepool_noteOn );
+CK_DLL_MFUN( voicepool_noteOff );
+CK_DLL_MFUN( voicepool_allNotesOff );
 
 // Identity2
 CK_DLL_TICKF( Identity2_tickf );
@@ -130,6 +130,8 @@ public:
 public:
     UINT__ get( void * data, UINT__ num_elem );
     void put( void * data, UINT__ num_elem );
+    // anything left to get? (cheap; no lock) | 1.5.5.3
+    BOOL__ more() const { return m_read_offset != m_write_offset; }
 
 protected:
     BYTE__ * m_data;
@@ -0,0 +1,400 @@
+/*----------------------------------------------------------------------------
+  ChucK Strongly-timed Audio Programming Language
+    Compiler, Virtual Machine, and Synthesis Engine
+
+  Copyright (c) 2003 Ge Wang and Perry R. Cook. All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the dual-license terms of EITHER the MIT License OR the GNU
+  General Public License (the latter as published by the Free Software
+  Foundation; either version 2 of the License or, at your option, any
+  later version).
+
+  This program is distributed in the hope that it will be useful and/or
+  interesting, but WITHOUT ANY WARRANTY; without even the implied warranty
+  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  MIT Licence and/or the GNU General Public License for details.
+
+  You should have received a copy of the MIT License and the GNU General
+  Public License (GPL) along with this program; a copy of the GPL can also
+  be obtained by writing to the Free Software Foundation, Inc., 59 Temple
+  Place, Suite 330, Boston, MA 02111-1307 U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// name: util_simd.cpp
+// desc: bulk kernels over t_CKFLOAT and SAMPLE buffers; see util_simd.h
+//
+//       reductions (dot, sum) keep four partial sums, so results may differ
+//       from a left-to-right scalar loop in the last bits
+//
+// date: Autumn 2026 | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#include "util_simd.h"
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_add() / ck_simd_sub() / ck_simd_mul()
+// desc: element-wise y op= x
+//-----------------------------------------------------------------------------
+#define CK_SIMD_BINARY( name, op )                                          \
+void name( t_CKFLOAT * y, const t_CKFLOAT * x, t_CKUINT n )                 \
+{                                                                           \
+    t_CKUINT i = 0;                                                         \
+    for( ; i + 4 <= n; i += 4 )                                             \
+    {                                                                       \
+        ck_f64x2 a = ck_f64x2_##op( ck_f64x2_load(y+i), ck_f64x2_load(x+i) );     \
+        ck_f64x2 b = ck_f64x2_##op( ck_f64x2_load(y+i+2), ck_f64x2_load(x+i+2) ); \
+        ck_f64x2_store( y+i, a ); ck_f64x2_store( y+i+2, b );               \
+    }                                                                       \
+    for( ; i + 2 <= n; i += 2 )                                             \
+        ck_f64x2_store( y+i, ck_f64x2_##op( ck_f64x2_load(y+i), ck_f64x2_load(x+i) ) ); \
+    if( i < n )                                                             \
+    {                                                                       \
+        ck_f64x2 r = ck_f64x2_##op( ck_f64x2_set1(y[i]), ck_f64x2_set1(x[i]) ); \
+        y[i] = ck_f64x2_lo( r );                                            \
+    }                                                                       \
+}
+
+CK_SIMD_BINARY( ck_simd_add, add )
+CK_SIMD_BINARY( ck_simd_sub, sub )
+CK_SIMD_BINARY( ck_simd_mul, mul )
+
+#undef CK_SIMD_BINARY
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_scale()
+// desc: y[i] *= s
+//-----------------------------------------------------------------------------
+void ck_simd_scale( t_CKFLOAT * y, t_CKFLOAT s, t_CKUINT n )
+{
+    ck_f64x2 vs = ck_f64x2_set1( s );
+    t_CKUINT i = 0;
+    for( ; i + 4 <= n; i += 4 )
+    {
+        ck_f64x2_store( y+i, ck_f64x2_mul( ck_f64x2_load(y+i), vs ) );
+        ck_f64x2_store( y+i+2, ck_f64x2_mul( ck_f64x2_load(y+i+2), vs ) );
+    }
+    for( ; i < n; i++ ) y[i] *= s;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_axpy()
+// desc: y[i] += a * x[i]
+//-----------------------------------------------------------------------------
+void ck_simd_axpy( t_CKFLOAT * y, t_CKFLOAT a, const t_CKFLOAT * x, t_CKUINT n )
+{
+    ck_f64x2 va = ck_f64x2_set1( a );
+    t_CKUINT i = 0;
+    for( ; i + 4 <= n; i += 4 )
+    {
+        ck_f64x2 p = ck_f64x2_add( ck_f64x2_load(y+i), ck_f64x2_mul( va, ck_f64x2_load(x+i) ) );
+        ck_f64x2 q = ck_f64x2_add( ck_f64x2_load(y+i+2), ck_f64x2_mul( va, ck_f64x2_load(x+i+2) ) );
+        ck_f64x2_store( y+i, p ); ck_f64x2_store( y+i+2, q );
+    }
+    for( ; i < n; i++ ) y[i] += a * x[i];
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_fill()
+// desc: y[i] = v
+//-----------------------------------------------------------------------------
+void ck_simd_fill( t_CKFLOAT * y, t_CKFLOAT v, t_CKUINT n )
+{
+    ck_f64x2 vv = ck_f64x2_set1( v );
+    t_CKUINT i = 0;
+    for( ; i + 2 <= n; i += 2 ) ck_f64x2_store( y+i, vv );
+    if( i < n ) y[i] = v;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_dot()
+// desc: sum of a[i] * b[i]
+//-----------------------------------------------------------------------------
+t_CKFLOAT ck_simd_dot( const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKUINT n )
+{
+    ck_f64x2 s0 = ck_f64x2_set1( 0 ), s1 = ck_f64x2_set1( 0 );
+    t_CKUINT i = 0;
+    for( ; i + 4 <= n; i += 4 )
+    {
+        s0 = ck_f64x2_add( s0, ck_f64x2_mul( ck_f64x2_load(a+i), ck_f64x2_load(b+i) ) );
+        s1 = ck_f64x2_add( s1, ck_f64x2_mul( ck_f64x2_load(a+i+2), ck_f64x2_load(b+i+2) ) );
+    }
+    s0 = ck_f64x2_add( s0, s1 );
+    t_CKFLOAT sum = ck_f64x2_lo( s0 ) + ck_f64x2_hi( s0 );
+    for( ; i < n; i++ ) sum += a[i] * b[i];
+    return sum;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_sum()
+// desc: sum of x[i]
+//-----------------------------------------------------------------------------
+t_CKFLOAT ck_simd_sum( const t_CKFLOAT * x, t_CKUINT n )
+{
+    ck_f64x2 s0 = ck_f64x2_set1( 0 ), s1 = ck_f64x2_set1( 0 );
+    t_CKUINT i = 0;
+    for( ; i + 4 <= n; i += 4 )
+    {
+        s0 = ck_f64x2_add( s0, ck_f64x2_load(x+i) );
+        s1 = ck_f64x2_add( s1, ck_f64x2_load(x+i+2) );
+    }
+    s0 = ck_f64x2_add( s0, s1 );
+    t_CKFLOAT sum = ck_f64x2_lo( s0 ) + ck_f64x2_hi( s0 );
+    for( ; i < n; i++ ) sum += x[i];
+    return sum;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_argmin() / ck_simd_argmax()
+// desc: find the extreme value two lanes at a time, then its first index
+//-----------------------------------------------------------------------------
+#define CK_SIMD_ARGEXT( name, op, cmp )                                     \
+t_CKUINT name( const t_CKFLOAT * x, t_CKUINT n )                            \
+{                                                                           \
+    if( n == 0 ) return 0;                                                  \
+    t_CKFLOAT ext = x[0];                                                   \
+    t_CKUINT i = 0;                                                         \
+    if( n >= 2 )                                                            \
+    {                                                                       \
+        ck_f64x2 e = ck_f64x2_load( x );                                    \
+        for( i = 2; i + 2 <= n; i += 2 )                                    \
+            e = ck_f64x2_##op( e, ck_f64x2_load(x+i) );                     \
+        ext = ck_f64x2_lo( e );                                             \
+        if( ck_f64x2_hi( e ) cmp ext ) ext = ck_f64x2_hi( e );              \
+    }                                                                       \
+    for( ; i < n; i++ ) if( x[i] cmp ext ) ext = x[i];                      \
+    for( i = 0; i < n; i++ ) if( x[i] == ext ) return i;                    \
+    /* no match only if NaNs are involved; fall back to a scalar scan */    \
+    t_CKUINT at = 0;                                                        \
+    for( i = 1; i < n; i++ ) if( x[i] cmp x[at] ) at = i;                   \
+    return at;                                                              \
+}
+
+CK_SIMD_ARGEXT( ck_simd_argmin, min, < )
+CK_SIMD_ARGEXT( ck_simd_argmax, max, > )
+
+#undef CK_SIMD_ARGEXT
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_is_zero()
+// desc: test eight at a time (which the compiler vectorizes), stopping at
+//       the first run with anything in it
+//-----------------------------------------------------------------------------
+t_CKBOOL ck_simd_is_zero( const SAMPLE * x, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+    for( ; i + 8 <= n; i += 8 )
+    {
+        t_CKUINT any = 0;
+        for( t_CKUINT k = 0; k < 8; k++ ) any |= x[i+k] != 0;
+        if( any ) return FALSE;
+    }
+    for( ; i < n; i++ ) if( x[i] != 0 ) return FALSE;
+    return TRUE;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_sin2pi()
+// desc: y[i] = sin( 2 pi x[i] ); x is reduced to [-.5,.5] in cycles, folded
+//       into [-.25,.25] by symmetry (sin(pi-a) = sin(a)), and evaluated as
+//       the odd Taylor polynomial through a^13; its worst case is the
+//       truncated a^15/15! term at pi/2, about 6.7e-10
+//-----------------------------------------------------------------------------
+static inline ck_f64x2 ck_sin2pi_x2( ck_f64x2 v )
+{
+    const ck_f64x2 half = ck_f64x2_set1( .5 );
+    // nearest whole cycle out
+    v = ck_f64x2_sub( v, ck_f64x2_floor( ck_f64x2_add( v, half ) ) );
+    // fold the outer quarters back in, without branches
+    v = ck_f64x2_max( ck_f64x2_min( v, ck_f64x2_sub( half, v ) ),
+                      ck_f64x2_sub( ck_f64x2_set1( -.5 ), v ) );
+    // radians, then Horner in a^2 over (-1)^k / (2k+1)!
+    ck_f64x2 a = ck_f64x2_mul( v, ck_f64x2_set1( CK_TWO_PI ) );
+    ck_f64x2 a2 = ck_f64x2_mul( a, a );
+    ck_f64x2 p = ck_f64x2_add( ck_f64x2_set1( -1.0 / 39916800.0 ),
+                               ck_f64x2_mul( a2, ck_f64x2_set1( 1.0 / 6227020800.0 ) ) );
+    p = ck_f64x2_add( ck_f64x2_set1( 1.0 / 362880.0 ), ck_f64x2_mul( a2, p ) );
+    p = ck_f64x2_add( ck_f64x2_set1( -1.0 / 5040.0 ), ck_f64x2_mul( a2, p ) );
+    p = ck_f64x2_add( ck_f64x2_set1( 1.0 / 120.0 ), ck_f64x2_mul( a2, p ) );
+    p = ck_f64x2_add( ck_f64x2_set1( -1.0 / 6.0 ), ck_f64x2_mul( a2, p ) );
+    p = ck_f64x2_add( ck_f64x2_set1( 1 ), ck_f64x2_mul( a2, p ) );
+    return ck_f64x2_mul( a, p );
+}
+
+void ck_simd_sin2pi( SAMPLE * y, const t_CKFLOAT * x, t_CKUINT n )
+{
+    t_CKUINT i = 0;
+    for( ; i + 2 <= n; i += 2 )
+        ck_f64x2_store_sample( y+i, ck_sin2pi_x2( ck_f64x2_load(x+i) ) );
+    // odd one out, same polynomial
+    if( i < n ) y[i] = (SAMPLE)ck_f64x2_lo( ck_sin2pi_x2( ck_f64x2_set1(x[i]) ) );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_biquad_v()
+// desc: a block through one biquad; the state stays in registers
+//-----------------------------------------------------------------------------
+void ck_biquad_v( ck_biquad * f, const SAMPLE * in, SAMPLE * out, t_CKUINT n )
+{
+    const t_CKFLOAT g = f->g, n0 = f->n0, n1 = f->n1, n2 = f->n2, d1 = f->d1, d2 = f->d2;
+    t_CKFLOAT w1 = f->w1, w2 = f->w2, y1 = f->y1, y2 = f->y2;
+    t_CKUINT i;
+    if( f->df1 )
+    {
+        for( i = 0; i < n; i++ )
+        {
+            t_CKFLOAT w = g * in[i];
+            t_CKFLOAT y = n0 * w + n1 * w1 + n2 * w2 + d1 * y1 + d2 * y2;
+            w2 = w1; w1 = w; y2 = y1; y1 = y;
+            out[i] = (SAMPLE)y;
+        }
+    }
+    else
+    {
+        for( i = 0; i < n; i++ )
+        {
+            t_CKFLOAT w = g * in[i] + d1 * w1 + d2 * w2;
+            t_CKFLOAT y = n0 * w + n1 * w1 + n2 * w2;
+            w2 = w1; w1 = w;
+            out[i] = (SAMPLE)y;
+        }
+    }
+    f->w1 = w1; f->w2 = w2; f->y1 = y1; f->y2 = y2;
+    ck_biquad_ddn( f );
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// name: ck_simd_biquad_n()
+// desc: a block through each of count independent biquads; each lane runs
+//       one filter, in the same order of operations as ck_biquad_v()
+//-----------------------------------------------------------------------------
+struct ck_biquad_x2
+{
+    ck_f64x2 g, n0, n1, n2, d1, d2, w1, w2, y1, y2;
+    ck_biquad * lo, * hi;
+
+    void load( ck_biquad * a, ck_biquad * b )
+    {
+        lo = a; hi = b;
+        g = ck_f64x2_set( a->g, b->g );
+        n0 = ck_f64x2_set( a->n0, b->n0 ); n1 = ck_f64x2_set( a->n1, b->n1 );
+        n2 = ck_f64x2_set( a->n2, b->n2 ); d1 = ck_f64x2_set( a->d1, b->d1 );
+        d2 = ck_f64x2_set( a->d2, b->d2 );
+        w1 = ck_f64x2_set( a->w1, b->w1 ); w2 = ck_f64x2_set( a->w2, b->w2 );
+        y1 = ck_f64x2_set( a->y1, b->y1 ); y2 = ck_f64x2_set( a->y2, b->y2 );
+    }
+
+    // direct form II
+    inline ck_f64x2 tick2( ck_f64x2 x )
+    {
+        ck_f64x2 w = ck_f64x2_add( ck_f64x2_add( ck_f64x2_mul( g, x ), ck_f64x2_mul( d1, w1 ) ), ck_f64x2_mul( d2, w2 ) );
+        ck_f64x2 y = ck_f64x2_add( ck_f64x2_add( ck_f64x2_mul( n0, w ), ck_f64x2_mul( n1, w1 ) ), ck_f64x2_mul( n2, w2 ) );
+        w2 = w1; w1 = w;
+        return y;
+    }
+
+    // direct form I
+    inline ck_f64x2 tick1( ck_f64x2 x )
+    {
+        ck_f64x2 w = ck_f64x2_mul( g, x );
+        ck_f64x2 y = ck_f64x2_add( ck_f64x2_add( ck_f64x2_mul( n0, w ), ck_f64x2_mul( n1, w1 ) ), ck_f64x2_mul( n2, w2 ) );
+        y = ck_f64x2_add( ck_f64x2_add( y, ck_f64x2_mul( d1, y1 ) ), ck_f64x2_mul( d2, y2 ) );
+        w2 = w1; w1 = w; y2 = y1; y1 = y;
+        return y;
+    }
+
+    void save()
+    {
+        lo->w1 = ck_f64x2_lo( w1 ); lo->w2 = ck_f64x2_lo( w2 );
+        lo->y1 = ck_f64x2_lo( y1 ); lo->y2 = ck_f64x2_lo( y2 );
+        hi->w1 = ck_f64x2_hi( w1 ); hi->w2 = ck_f64x2_hi( w2 );
+        hi->y1 = ck_f64x2_hi( y1 ); hi->y2 = ck_f64x2_hi( y2 );
+        ck_biquad_ddn( lo ); ck_biquad_ddn( hi );
+    }
+};
+
+// the loops, for one form (fixed per batch, so not tested per sample)
+template<t_CKBOOL DF1>
+static void ck_biquad_n( ck_biquad * const * f, SAMPLE * const * in,
+                         SAMPLE * const * out, t_CKUINT count, t_CKUINT n )
+{
+    ck_biquad_x2 a, b;
+    t_CKUINT k = 0, i;
+
+    // four at a time: two independent feedback chains in flight
+    for( ; k + 4 <= count; k += 4 )
+    {
+        a.load( f[k], f[k+1] ); b.load( f[k+2], f[k+3] );
+        const SAMPLE * x0 = in[k], * x1 = in[k+1], * x2 = in[k+2], * x3 = in[k+3];
+        SAMPLE * y0 = out[k], * y1 = out[k+1], * y2 = out[k+2], * y3 = out[k+3];
+        for( i = 0; i < n; i++ )
+        {
+            ck_f64x2 xa = ck_f64x2_set( x0[i], x1[i] ), xb = ck_f64x2_set( x2[i], x3[i] );
+            ck_f64x2 ya = DF1 ? a.tick1( xa ) : a.tick2( xa );
+            ck_f64x2 yb = DF1 ? b.tick1( xb ) : b.tick2( xb );
+            y0[i] = (SAMPLE)ck_f64x2_lo( ya ); y1[i] = (SAMPLE)ck_f64x2_hi( ya );
+            y2[i] = (SAMPLE)ck_f64x2_lo( yb ); y3[i] = (SAMPLE)ck_f64x2_hi( yb );
+        }
+        a.save(); b.save();
+    }
+    // a pair
+    if( k + 2 <= count )
+    {
+        a.load( f[k], f[k+1] );
+        const SAMPLE * x0 = in[k], * x1 = in[k+1];
+        SAMPLE * y0 = out[k], * y1 = out[k+1];
+        for( i = 0; i < n; i++ )
+        {
+            ck_f64x2 xa = ck_f64x2_set( x0[i], x1[i] );
+            ck_f64x2 ya = DF1 ? a.tick1( xa ) : a.tick2( xa );
+            y0[i] = (SAMPLE)ck_f64x2_lo( ya ); y1[i] = (SAMPLE)ck_f64x2_hi( ya );
+        }
+        a.save();
+        k += 2;
+    }
+    // odd one out
+    if( k < count ) ck_biquad_v( f[k], in[k], out[k], n );
+}
+
+void ck_simd_biquad_n( ck_biquad * const * f, SAMPLE * const * in,
+                       SAMPLE * const * out, t_CKUINT count, t_CKUINT n )
+{
+    if( !count ) return;
+    if( f[0]->df1 ) ck_biquad_n<TRUE>( f, in, out, count, n );
+    else ck_biquad_n<FALSE>( f, in, out, count, n );
+}
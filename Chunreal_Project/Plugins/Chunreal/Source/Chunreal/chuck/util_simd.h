@@ -0,0 +1,243 @@
+/*----------------------------------------------------------------------------
+  ChucK Strongly-timed Audio Programming Language
+    Compiler, Virtual Machine, and Synthesis Engine
+
+  Copyright (c) 2003 Ge Wang and Perry R. Cook. All rights reserved.
+    http://chuck.stanford.edu/
+    http://chuck.cs.princeton.edu/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the dual-license terms of EITHER the MIT License OR the GNU
+  General Public License (the latter as published by the Free Software
+  Foundation; either version 2 of the License or, at your option, any
+  later version).
+
+  This program is distributed in the hope that it will be useful and/or
+  interesting, but WITHOUT ANY WARRANTY; without even the implied warranty
+  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  MIT Licence and/or the GNU General Public License for details.
+
+  You should have received a copy of the MIT License and the GNU General
+  Public License (GPL) along with this program; a copy of the GPL can also
+  be obtained by writing to the Free Software Foundation, Inc., 59 Temple
+  Place, Suite 330, Boston, MA 02111-1307 U.S.A.
+-----------------------------------------------------------------------------*/
+
+//-----------------------------------------------------------------------------
+// name: util_simd.h
+// desc: two-lane double-precision SIMD (SSE2 on x86/x64, NEON on arm64,
+//       plain C++ elsewhere or with __DISABLE_SIMD__), and bulk kernels
+//       over t_CKFLOAT and SAMPLE buffers built on it
+//
+// date: Autumn 2026 | 1.5.5.3 (added)
+//-----------------------------------------------------------------------------
+#ifndef __UTIL_SIMD_H__
+#define __UTIL_SIMD_H__
+
+#include "chuck_def.h"
+#include <math.h>
+
+#if !defined(__DISABLE_SIMD__)
+  #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define __CK_SIMD_SSE2__
+    #include <emmintrin.h>
+  #elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+    #define __CK_SIMD_NEON__
+    #include <arm_neon.h>
+  #endif
+#endif
+
+
+
+
+//-----------------------------------------------------------------------------
+// ck_f64x2: two t_CKFLOATs; loads and stores are unaligned
+//-----------------------------------------------------------------------------
+#if defined(__CK_SIMD_SSE2__)
+
+typedef __m128d ck_f64x2;
+inline ck_f64x2 ck_f64x2_load( const t_CKFLOAT * p ) { return _mm_loadu_pd( p ); }
+inline void ck_f64x2_store( t_CKFLOAT * p, ck_f64x2 a ) { _mm_storeu_pd( p, a ); }
+inline ck_f64x2 ck_f64x2_set1( t_CKFLOAT v ) { return _mm_set1_pd( v ); }
+inline ck_f64x2 ck_f64x2_set( t_CKFLOAT lo, t_CKFLOAT hi ) { return _mm_set_pd( hi, lo ); }
+inline ck_f64x2 ck_f64x2_add( ck_f64x2 a, ck_f64x2 b ) { return _mm_add_pd( a, b ); }
+inline ck_f64x2 ck_f64x2_sub( ck_f64x2 a, ck_f64x2 b ) { return _mm_sub_pd( a, b ); }
+inline ck_f64x2 ck_f64x2_mul( ck_f64x2 a, ck_f64x2 b ) { return _mm_mul_pd( a, b ); }
+inline ck_f64x2 ck_f64x2_div( ck_f64x2 a, ck_f64x2 b ) { return _mm_div_pd( a, b ); }
+inline ck_f64x2 ck_f64x2_min( ck_f64x2 a, ck_f64x2 b ) { return _mm_min_pd( a, b ); }
+inline ck_f64x2 ck_f64x2_max( ck_f64x2 a, ck_f64x2 b ) { return _mm_max_pd( a, b ); }
+inline t_CKFLOAT ck_f64x2_lo( ck_f64x2 a ) { return _mm_cvtsd_f64( a ); }
+inline t_CKFLOAT ck_f64x2_hi( ck_f64x2 a ) { return _mm_cvtsd_f64( _mm_unpackhi_pd( a, a ) ); }
+// comparisons give a per-lane mask for ck_f64x2_select( m, if-set, if-clear )
+typedef __m128d ck_m64x2;
+inline ck_m64x2 ck_f64x2_lt( ck_f64x2 a, ck_f64x2 b ) { return _mm_cmplt_pd( a, b ); }
+inline ck_m64x2 ck_f64x2_gt( ck_f64x2 a, ck_f64x2 b ) { return _mm_cmpgt_pd( a, b ); }
+inline ck_f64x2 ck_f64x2_select( ck_m64x2 m, ck_f64x2 a, ck_f64x2 b ) { return _mm_or_pd( _mm_and_pd( m, a ), _mm_andnot_pd( m, b ) ); }
+inline ck_f64x2 ck_f64x2_abs( ck_f64x2 a ) { return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a ); }
+// SSE2 has no floor: round to nearest through a signed 2^52, then step
+// down where that rounded up; anything at or beyond 2^52 in magnitude is
+// already an integer and passes through
+inline ck_f64x2 ck_f64x2_floor( ck_f64x2 a )
+{
+    const __m128d big = _mm_set1_pd( 4503599627370496.0 );
+    __m128d sbig = _mm_or_pd( big, _mm_and_pd( _mm_set1_pd( -0.0 ), a ) );
+    __m128d r = _mm_sub_pd( _mm_add_pd( a, sbig ), sbig );
+    r = _mm_sub_pd( r, _mm_and_pd( _mm_cmpgt_pd( r, a ), _mm_set1_pd( 1.0 ) ) );
+    return ck_f64x2_select( _mm_cmplt_pd( ck_f64x2_abs( a ), big ), r, a );
+}
+// store both lanes as SAMPLEs
+inline void ck_f64x2_store_sample( SAMPLE * p, ck_f64x2 a )
+{
+#ifdef __CHUCK_USE_64_BIT_SAMPLE__
+    _mm_storeu_pd( p, a );
+#else
+    _mm_storel_pi( (__m64 *)p, _mm_cvtpd_ps( a ) );
+#endif
+}
+
+#elif defined(__CK_SIMD_NEON__)
+
+typedef float64x2_t ck_f64x2;
+inline ck_f64x2 ck_f64x2_load( const t_CKFLOAT * p ) { return vld1q_f64( p ); }
+inline void ck_f64x2_store( t_CKFLOAT * p, ck_f64x2 a ) { vst1q_f64( p, a ); }
+inline ck_f64x2 ck_f64x2_set1( t_CKFLOAT v ) { return vdupq_n_f64( v ); }
+inline ck_f64x2 ck_f64x2_set( t_CKFLOAT lo, t_CKFLOAT hi ) { return vsetq_lane_f64( hi, vdupq_n_f64( lo ), 1 ); }
+inline ck_f64x2 ck_f64x2_add( ck_f64x2 a, ck_f64x2 b ) { return vaddq_f64( a, b ); }
+inline ck_f64x2 ck_f64x2_sub( ck_f64x2 a, ck_f64x2 b ) { return vsubq_f64( a, b ); }
+inline ck_f64x2 ck_f64x2_mul( ck_f64x2 a, ck_f64x2 b ) { return vmulq_f64( a, b ); }
+inline ck_f64x2 ck_f64x2_div( ck_f64x2 a, ck_f64x2 b ) { return vdivq_f64( a, b ); }
+inline ck_f64x2 ck_f64x2_min( ck_f64x2 a, ck_f64x2 b ) { return vminq_f64( a, b ); }
+inline ck_f64x2 ck_f64x2_max( ck_f64x2 a, ck_f64x2 b ) { return vmaxq_f64( a, b ); }
+inline t_CKFLOAT ck_f64x2_lo( ck_f64x2 a ) { return vgetq_lane_f64( a, 0 ); }
+inline t_CKFLOAT ck_f64x2_hi( ck_f64x2 a ) { return vgetq_lane_f64( a, 1 ); }
+// comparisons give a per-lane mask for ck_f64x2_select( m, if-set, if-clear )
+typedef uint64x2_t ck_m64x2;
+inline ck_m64x2 ck_f64x2_lt( ck_f64x2 a, ck_f64x2 b ) { return vcltq_f64( a, b ); }
+inline ck_m64x2 ck_f64x2_gt( ck_f64x2 a, ck_f64x2 b ) { return vcgtq_f64( a, b ); }
+inline ck_f64x2 ck_f64x2_select( ck_m64x2 m, ck_f64x2 a, ck_f64x2 b ) { return vbslq_f64( m, a, b ); }
+inline ck_f64x2 ck_f64x2_abs( ck_f64x2 a ) { return vabsq_f64( a ); }
+inline ck_f64x2 ck_f64x2_floor( ck_f64x2 a ) { return vrndmq_f64( a ); }
+// store both lanes as SAMPLEs
+inline void ck_f64x2_store_sample( SAMPLE * p, ck_f64x2 a )
+{
+#ifdef __CHUCK_USE_64_BIT_SAMPLE__
+    vst1q_f64( p, a );
+#else
+    vst1_f32( p, vcvt_f32_f64( a ) );
+#endif
+}
+
+#else
+
+struct ck_f64x2 { t_CKFLOAT lo, hi; };
+inline ck_f64x2 ck_f64x2_load( const t_CKFLOAT * p ) { ck_f64x2 r = { p[0], p[1] }; return r; }
+inline void ck_f64x2_store( t_CKFLOAT * p, ck_f64x2 a ) { p[0] = a.lo; p[1] = a.hi; }
+inline ck_f64x2 ck_f64x2_set1( t_CKFLOAT v ) { ck_f64x2 r = { v, v }; return r; }
+inline ck_f64x2 ck_f64x2_set( t_CKFLOAT lo, t_CKFLOAT hi ) { ck_f64x2 r = { lo, hi }; return r; }
+inline ck_f64x2 ck_f64x2_add( ck_f64x2 a, ck_f64x2 b ) { ck_f64x2 r = { a.lo+b.lo, a.hi+b.hi }; return r; }
+inline ck_f64x2 ck_f64x2_sub( ck_f64x2 a, ck_f64x2 b ) { ck_f64x2 r = { a.lo-b.lo, a.hi-b.hi }; return r; }
+inline ck_f64x2 ck_f64x2_mul( ck_f64x2 a, ck_f64x2 b ) { ck_f64x2 r = { a.lo*b.lo, a.hi*b.hi }; return r; }
+inline ck_f64x2 ck_f64x2_div( ck_f64x2 a, ck_f64x2 b ) { ck_f64x2 r = { a.lo/b.lo, a.hi/b.hi }; return r; }
+inline ck_f64x2 ck_f64x2_min( ck_f64x2 a, ck_f64x2 b ) { ck_f64x2 r = { a.lo<b.lo?a.lo:b.lo, a.hi<b.hi?a.hi:b.hi }; return r; }
+inline ck_f64x2 ck_f64x2_max( ck_f64x2 a, ck_f64x2 b ) { ck_f64x2 r = { a.lo>b.lo?a.lo:b.lo, a.hi>b.hi?a.hi:b.hi }; return r; }
+inline t_CKFLOAT ck_f64x2_lo( ck_f64x2 a ) { return a.lo; }
+inline t_CKFLOAT ck_f64x2_hi( ck_f64x2 a ) { return a.hi; }
+// comparisons give a per-lane mask for ck_f64x2_select( m, if-set, if-clear )
+struct ck_m64x2 { t_CKBOOL lo, hi; };
+inline ck_m64x2 ck_f64x2_lt( ck_f64x2 a, ck_f64x2 b ) { ck_m64x2 r = { a.lo<b.lo, a.hi<b.hi }; return r; }
+inline ck_m64x2 ck_f64x2_gt( ck_f64x2 a, ck_f64x2 b ) { ck_m64x2 r = { a.lo>b.lo, a.hi>b.hi }; return r; }
+inline ck_f64x2 ck_f64x2_select( ck_m64x2 m, ck_f64x2 a, ck_f64x2 b ) { ck_f64x2 r = { m.lo?a.lo:b.lo, m.hi?a.hi:b.hi }; return r; }
+inline ck_f64x2 ck_f64x2_abs( ck_f64x2 a ) { ck_f64x2 r = { ::fabs(a.lo), ::fabs(a.hi) }; return r; }
+inline ck_f64x2 ck_f64x2_floor( ck_f64x2 a ) { ck_f64x2 r = { ::floor(a.lo), ::floor(a.hi) }; return r; }
+// store both lanes as SAMPLEs
+inline void ck_f64x2_store_sample( SAMPLE * p, ck_f64x2 a ) { p[0] = (SAMPLE)a.lo; p[1] = (SAMPLE)a.hi; }
+
+#endif
+
+
+
+
+//-----------------------------------------------------------------------------
+// bulk kernels over n elements; y may alias x
+//-----------------------------------------------------------------------------
+// y[i] += x[i]
+void ck_simd_add( t_CKFLOAT * y, const t_CKFLOAT * x, t_CKUINT n );
+// y[i] -= x[i]
+void ck_simd_sub( t_CKFLOAT * y, const t_CKFLOAT * x, t_CKUINT n );
+// y[i] *= x[i]
+void ck_simd_mul( t_CKFLOAT * y, const t_CKFLOAT * x, t_CKUINT n );
+// y[i] *= s
+void ck_simd_scale( t_CKFLOAT * y, t_CKFLOAT s, t_CKUINT n );
+// y[i] += a * x[i]
+void ck_simd_axpy( t_CKFLOAT * y, t_CKFLOAT a, const t_CKFLOAT * x, t_CKUINT n );
+// y[i] = v
+void ck_simd_fill( t_CKFLOAT * y, t_CKFLOAT v, t_CKUINT n );
+// sum of a[i] * b[i]
+t_CKFLOAT ck_simd_dot( const t_CKFLOAT * a, const t_CKFLOAT * b, t_CKUINT n );
+// sum of x[i]
+t_CKFLOAT ck_simd_sum( const t_CKFLOAT * x, t_CKUINT n );
+// index of the first smallest / largest element (n > 0)
+t_CKUINT ck_simd_argmin( const t_CKFLOAT * x, t_CKUINT n );
+t_CKUINT ck_simd_argmax( const t_CKFLOAT * x, t_CKUINT n );
+// whether every x[i] is zero
+t_CKBOOL ck_simd_is_zero( const SAMPLE * x, t_CKUINT n );
+// y[i] = sin( 2 pi x[i] ), by polynomial; within 7e-10 of libm's sin()
+// for any finite x, i.e., exact to a 32-bit SAMPLE's resolution
+void ck_simd_sin2pi( SAMPLE * y, const t_CKFLOAT * x, t_CKUINT n );
+
+
+
+
+//-----------------------------------------------------------------------------
+// biquad with double-precision state, in the form each filter had before
+// 1.5.5.3, so a coefficient change starts the same transient it always did
+// | 1.5.5.3
+//   direct form II (df1 == FALSE; the SC3 filters: LPF, HPF, BPF, ...):
+//     w = g x + d1 w1 + d2 w2;  y = n0 w + n1 w1 + n2 w2
+//   direct form I (df1 == TRUE; BiQuad):
+//     w = g x;  y = n0 w + n1 w1 + n2 w2 + d1 y1 + d2 y2
+// either way H(z) = g (n0 + n1 z^-1 + n2 z^-2) / (1 - d1 z^-1 - d2 z^-2)
+//-----------------------------------------------------------------------------
+struct ck_biquad
+{
+    t_CKFLOAT g, n0, n1, n2, d1, d2;
+    t_CKFLOAT w1, w2, y1, y2;
+    t_CKBOOL df1;
+};
+
+// one sample
+inline SAMPLE ck_biquad_tick( ck_biquad * f, SAMPLE in )
+{
+    t_CKFLOAT w, y;
+    if( f->df1 )
+    {
+        w = f->g * in;
+        y = f->n0 * w + f->n1 * f->w1 + f->n2 * f->w2 + f->d1 * f->y1 + f->d2 * f->y2;
+        f->y2 = f->y1; f->y1 = y;
+    }
+    else
+    {
+        w = f->g * in + f->d1 * f->w1 + f->d2 * f->w2;
+        y = f->n0 * w + f->n1 * f->w1 + f->n2 * f->w2;
+    }
+    f->w2 = f->w1; f->w1 = w;
+    return (SAMPLE)y;
+}
+
+// flush denormal (and runaway) state; the block kernels do this once per
+// block, single-sample callers once per sample
+inline void ck_biquad_ddn( ck_biquad * f )
+{ CK_DDN_DOUBLE( f->w1 ); CK_DDN_DOUBLE( f->w2 ); CK_DDN_DOUBLE( f->y1 ); CK_DDN_DOUBLE( f->y2 ); }
+
+// a block through one filter; out may alias in
+void ck_biquad_v( ck_biquad * f, const SAMPLE * in, SAMPLE * out, t_CKUINT n );
+// a block through each of count independent filters, all of one form; the
+// recurrence keeps one filter from vectorizing over time, so filters go two
+// to a vector, two vectors at a time to cover the latency of the feedback
+void ck_simd_biquad_n( ck_biquad * const * f, SAMPLE * const * in,
+                       SAMPLE * const * out, t_CKUINT count, t_CKUINT n );
+
+
+
+
+#endif
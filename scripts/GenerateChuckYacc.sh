@@ -0,0 +1,62 @@
+#!/bin/bash
+# regenerates chuck_yacc.c / chuck_yacc.h (what the plugin compiles, see
+# __USE_CHUCK_YACC__) from chuck.y and chuck.lex, and checks them; with
+# --check, only checks the files already there
+#
+# compiles run in parallel, one per ChucK instance, so the parser must be pure
+# and the scanner reentrant: no parser or scanner state (yychar, yylval,
+# yy_c_buf_p, ...) may be left at file scope; fails otherwise, and leaves the
+# old files alone
+#
+# needs bison 3 and flex 2.6 (and a C compiler for the check)
+#
+#   bash GenerateChuckYacc.sh [--check]
+set -e
+
+SCRIPTS="$(cd "$(dirname "$0")" && pwd)"
+CHUNREAL_SRC="${SCRIPTS}/../Chunreal_Project/Plugins/Chunreal/Source/Chunreal/chuck"
+TMP="$(mktemp -d)"
+trap 'rm -rf "${TMP}"' EXIT
+
+# check DIR: chuck_yacc.c / chuck_yacc.h in DIR
+check()
+{
+    local c="$1/chuck_yacc.c" ok=1
+
+    grep -q '^#define YYPURE [12]$' "$c" ||
+        { echo "$c: the parser is not pure (chuck.y: %define api.pure full)"; ok=0; }
+    grep -q '^typedef void\* yyscan_t;$' "$c" ||
+        { echo "$c: the scanner is not reentrant (chuck.lex: %option reentrant)"; ok=0; }
+    grep -q 'CK_THREAD_LOCAL' "$c" &&
+        { echo "$c: hand-edited for thread-local globals; regenerate it"; ok=0; }
+
+    # nothing writable at file scope (but bison's yyval_default / yyloc_default,
+    # statics yyparse() only reads, to initialize yylval / yylloc)
+    local defs="-D__USE_CHUCK_YACC__ -DYY_NO_UNISTD_H"
+    if [ "$(uname)" = Darwin ]; then defs="${defs} -D__PLATFORM_APPLE__"
+    else defs="${defs} -D__PLATFORM_LINUX__"; fi
+    ${CC:-cc} -c ${defs} -I"$1" -I"${CHUNREAL_SRC}" "$c" -o "${TMP}/chuck_yacc.o"
+    local globals="$(nm "${TMP}/chuck_yacc.o" | awk '$(NF-1) ~ /^[BbCDd]$/ && $NF !~ /^yy(val|loc)_default/ { print $NF }')"
+    [ -z "${globals}" ] ||
+        { echo "$c: parser / scanner state at file scope:" ${globals}; ok=0; }
+
+    [ ${ok} = 1 ] && echo "$c: pure parser, reentrant scanner"
+    [ ${ok} = 1 ]
+}
+
+if [ "$1" = "--check" ]; then
+    check "${CHUNREAL_SRC}"
+    exit
+fi
+
+# generate in TMP (names relative, for the #line directives)
+cp "${CHUNREAL_SRC}/chuck.y" "${CHUNREAL_SRC}/chuck.lex" "${TMP}"
+( cd "${TMP}" &&
+  bison -d -o chuck.tab.c chuck.y &&
+  flex -o chuck.yy.c chuck.lex &&
+  sed 's|#include "chuck.tab.h"|#include "chuck_yacc.h"|' chuck.tab.c > chuck_yacc.c &&
+  cat chuck.yy.c >> chuck_yacc.c &&
+  cp chuck.tab.h chuck_yacc.h )
+
+check "${TMP}"
+cp "${TMP}/chuck_yacc.c" "${TMP}/chuck_yacc.h" "${CHUNREAL_SRC}"
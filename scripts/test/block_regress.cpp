@@ -0,0 +1,244 @@
+//-----------------------------------------------------------------------------
+// file: block_regress.cpp
+// desc: block-mode regression patches for the UGen schedule: each patch is
+//       rendered in block mode (adaptive 64) with 0, 2, 3 and 4 ugen
+//       threads, twice per thread count, with the heap dirtied before every
+//       render; all renders of a patch must be bit-identical and bounded,
+//       and match a render with dormant skipping turned off, as must its
+//       sample-mode renders with skipping on and off; patches that come to
+//       rest must skip some ticks; exits non-zero on any mismatch
+//
+// usage: block_regress [seconds=2] [patch]
+//        (patches that need longer to come to rest take longer)
+//        (built by the Makefile in this directory; make run-block_regress)
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+#include "chuck_vm.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Patch
+{
+    const char * name;
+    const char * code;
+    // at least this long (0: as given)
+    double seconds;
+    // comes to rest: some ticks must be skipped
+    bool rests;
+};
+
+static const Patch PATCHES[] = {
+    // plain chain
+    { "chain",
+      "SinOsc s => LPF f => Gain g => dac; 440 => s.freq; 2000 => f.freq; 0.5 => g.gain;\n"
+      "while( true ) 1::second => now;\n", 0, false },
+    // independent subgraphs (parallel when threads > 0)
+    { "voices",
+      "SinOsc s[8]; LPF f[8]; Gain m => dac; 0.1 => m.gain;\n"
+      "for( 0 => int i; i < 8; i++ ) { s[i] => f[i] => m; 110*(i+1) => s[i].freq; 1000 => f[i].freq; }\n"
+      "while( true ) 1::second => now;\n", 0, false },
+    // self-loop: first block reads fb's own (never written) last output
+    { "self-loop",
+      "SinOsc a => Gain fb => fb; 0.3 => fb.gain; fb => dac;\n"
+      "while( true ) 1::second => now;\n", 0, false },
+    // delay loop
+    { "delay-loop",
+      "Impulse i => Delay d => dac; d => Gain g => d; 0.5 => g.gain;\n"
+      "10::ms => d.max => d.delay; 1 => i.next;\n"
+      "while( true ) 1::second => now;\n", 0, false },
+    // delay loops in parallel voices, retriggered
+    { "delay-voices",
+      "Noise n => Gain in; 0.2 => in.gain; Gain m => dac; 0.2 => m.gain;\n"
+      "Delay d[4]; Gain g[4];\n"
+      "for( 0 => int k; k < 4; k++ ) { in => d[k] => m; d[k] => g[k] => d[k];\n"
+      "    0.6 => g[k].gain; (3+k)::ms => d[k].max => d[k].delay; }\n"
+      "while( true ) { 1 => in.gain; 5::ms => now; 0 => in.gain; 95::ms => now; }\n", 0, false },
+    // envelopes released on a gated (silent) source
+    { "envelopes",
+      "SinOsc s => Gain g => ADSR a => Envelope e => dac; a.set( 5::ms, 20::ms, 0.5, 50::ms );\n"
+      "30::ms => e.duration;\n"
+      "while( true ) { 1 => g.gain; a.keyOn(); e.keyOn(); 150::ms => now; a.keyOff(); e.keyOff();\n"
+      "    100::ms => now; 0 => g.gain; 250::ms => now; s.freq() + 10 => s.freq; }\n", 0, true },
+    // reverb tails (T60 4 s) on a burst
+    { "reverbs",
+      "SinOsc s => Gain g => JCRev a => dac; g => NRev b => dac; g => PRCRev c => dac;\n"
+      "50::ms => now; 0 => g.gain;\n"
+      "while( true ) 1::second => now;\n", 16, true },
+    // STK and builtin filters, and a delay, with changing coefficients
+    { "stk-filters",
+      "SinOsc s => Gain g => OnePole a => TwoPole b => OneZero c => TwoZero d => PoleZero e\n"
+      "    => LPF f => BiQuad q => DelayL dl => DelayA da => Delay dd => dac;\n"
+      "20::ms => dl.max => dl.delay => da.max => da.delay => dd.max => dd.delay;\n"
+      "0.9 => q.prad; 0.9 => q.zrad; 0.95 => b.radius; 0.5 => c.zero; 0.95 => e.blockZero;\n"
+      "while( true ) { 1 => g.gain; Math.random2f( 0.5, 0.95 ) => a.pole;\n"
+      "    Math.random2f( 200, 2000 ) => b.freq => f.freq => q.pfreq;\n"
+      "    Math.random2f( 1, 19 )::ms => dl.delay => da.delay => dd.delay; 20::ms => now;\n"
+      "    0 => g.gain; 480::ms => now; }\n", 0, true },
+    // interpolating delays fed zeros (not flagged silent), moved while at rest
+    { "delay-moves",
+      "Noise n => Envelope e => DelayL dl => dac; e => DelayA da => dac; 50::ms => dl.max => da.max;\n"
+      "while( true ) { Math.random2f( 1, 49 )::ms => dl.delay => da.delay; 1::ms => e.duration;\n"
+      "    e.keyOn(); 5::ms => now; e.keyOff(); Math.random2f( 100, 300 )::ms => now; }\n", 0, true },
+    // plucked and damped mandolins
+    { "mandolin",
+      "Mandolin m[16]; Gain bus => dac; 0.1 => bus.gain;\n"
+      "for( 0 => int i; i < 16; i++ ) { m[i] => bus; 110 * (1 + i % 5) + i => m[i].freq; }\n"
+      "while( true ) { for( 0 => int i; i < 16; i++ ) { 0.8 => m[i].noteOn; 10::ms => now; }\n"
+      "    200::ms => now; for( 0 => int i; i < 16; i++ ) 1 => m[i].noteOff; 1500::ms => now; }\n", 4, true },
+    // SndBuf past its end: the position keeps moving until rate is 0
+    { "sndbuf",
+      "SndBuf b => dac; \"special:dope\" => b.read;\n"
+      "while( true ) { 0 => b.pos; 1 => b.rate; 500::ms => now; -1 => b.rate; 700::ms => now;\n"
+      "    0 => b.rate; 300::ms => now; }\n", 0, true },
+};
+
+static const int NUM_PATCHES = sizeof(PATCHES) / sizeof(PATCHES[0]);
+static const int THREADS[] = { 0, 2, 3, 4 };
+
+// allocate and scribble over blocks the size ugen buffers use, then free
+// them, so reads of uninitialized buffers see garbage
+static void dirty_heap( unsigned seed )
+{
+    std::vector<SAMPLE *> blocks;
+    for( int i = 0; i < 256; i++ )
+    {
+        SAMPLE * b = new SAMPLE[64];
+        for( int k = 0; k < 64; k++ ) b[k] = (SAMPLE)( (seed + i * 64 + k) * 1e9 );
+        blocks.push_back( b );
+    }
+    for( size_t i = 0; i < blocks.size(); i++ ) delete [] blocks[i];
+}
+
+// how to render
+struct Mode
+{
+    // VM_ADAPTIVE (0: sample mode)
+    int adaptive;
+    // VM_UGEN_THREADS
+    int threads;
+    // skip dormant ugens
+    bool skip;
+};
+
+// ugen-frames ticked and skipped in the last render
+static t_CKUINT g_frames = 0, g_skipped = 0;
+
+static std::vector<SAMPLE> render( const char * code, const Mode & mode, int frames, unsigned seed )
+{
+    dirty_heap( seed );
+    Chuck_UGen::our_skip_dormant = mode.skip;
+
+    ChucK * ck = new ChucK();
+    ck->setParam( CHUCK_PARAM_SAMPLE_RATE, (t_CKINT)44100 );
+    ck->setParam( CHUCK_PARAM_INPUT_CHANNELS, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, (t_CKINT)1 );
+    ck->setParam( CHUCK_PARAM_VM_ADAPTIVE, (t_CKINT)mode.adaptive );
+    ck->setParam( CHUCK_PARAM_VM_HALT, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_VM_UGEN_THREADS, (t_CKINT)mode.threads );
+    ck->setParam( CHUCK_PARAM_VM_UGEN_PARALLEL_MIN, (t_CKINT)1 );
+    ck->setParam( CHUCK_PARAM_CHUGIN_ENABLE, (t_CKINT)0 );
+    ck->init();
+    ck->start();
+
+    // same noise in every render
+    ck->compileCode( "Math.srandom( 1234 );", "", 1, TRUE );
+    std::vector<SAMPLE> out( frames, 0 );
+    if( ck->compileCode( code, "", 1 ) )
+    {
+        const int N = 512;
+        for( int i = 0; i < frames; i += N )
+            ck->run( NULL, &out[i], frames - i < N ? frames - i : N );
+    }
+    else out.clear();
+    g_frames = ck->vm()->shreduler()->m_ugen_schedule.frames();
+    g_skipped = ck->vm()->shreduler()->m_ugen_schedule.skipped();
+
+    delete ck;
+    Chuck_UGen::our_skip_dormant = TRUE;
+    return out;
+}
+
+// render, and check against ref (or make it ref); returns FALSE on mismatch
+static bool check( const Patch & patch, const Mode & mode, int frames, unsigned seed,
+                   std::vector<SAMPLE> & ref )
+{
+    std::vector<SAMPLE> out = render( patch.code, mode, frames, seed );
+    if( out.empty() ) { fprintf( stderr, "[%s] compile failed\n", patch.name ); return false; }
+
+    // bounded: no garbage leaking through feedback
+    for( int i = 0; i < frames; i++ )
+    {
+        if( !std::isfinite( out[i] ) || std::fabs( out[i] ) > 100 )
+        {
+            fprintf( stderr, "[%s] adaptive=%d threads=%d skip=%d: sample %d is %g\n",
+                     patch.name, mode.adaptive, mode.threads, mode.skip, i, out[i] );
+            return false;
+        }
+    }
+
+    if( ref.empty() ) { ref = out; return true; }
+    if( memcmp( &ref[0], &out[0], frames * sizeof(SAMPLE) ) )
+    {
+        int i = 0; while( ref[i] == out[i] ) i++;
+        fprintf( stderr, "[%s] adaptive=%d threads=%d skip=%d: differs at sample %d (%g vs %g)\n",
+                 patch.name, mode.adaptive, mode.threads, mode.skip, i, ref[i], out[i] );
+        return false;
+    }
+    return true;
+}
+
+int main( int argc, char ** argv )
+{
+    double seconds = argc > 1 ? atof( argv[1] ) : 2;
+    const char * only = argc > 2 ? argv[2] : NULL;
+    int wrong = 0;
+
+    for( int p = 0; p < NUM_PATCHES; p++ )
+    {
+        const Patch & patch = PATCHES[p];
+        if( only && strcmp( only, patch.name ) ) continue;
+        int frames = (int)( ( patch.seconds > seconds ? patch.seconds : seconds ) * 44100 );
+        int renders = 0, bad = 0;
+        t_CKUINT total = 0, skipped = 0;
+
+        // block mode, every thread count, twice; then without skipping
+        std::vector<SAMPLE> ref;
+        for( int t = 0; t < 4; t++ )
+        {
+            for( int r = 0; r < 2; r++ )
+            {
+                Mode mode = { 64, THREADS[t], true };
+                bad += !check( patch, mode, frames, p * 16 + t * 2 + r, ref );
+                if( !t && !r ) { total = g_frames; skipped = g_skipped; }
+                renders++;
+            }
+        }
+        Mode unskipped = { 64, 0, false };
+        bad += !check( patch, unskipped, frames, p * 16 + 8, ref );
+        renders++;
+
+        // sample mode, with and without skipping
+        std::vector<SAMPLE> sref;
+        Mode sample = { 0, 0, true }, sample_unskipped = { 0, 0, false };
+        bad += !check( patch, sample, frames, p * 16 + 9, sref );
+        bad += !check( patch, sample_unskipped, frames, p * 16 + 10, sref );
+        renders += 2;
+
+        // came to rest?
+        if( patch.rests && !skipped )
+        {
+            bad++;
+            fprintf( stderr, "[%s] no ticks skipped\n", patch.name );
+        }
+
+        printf( "%-14s %2d renders, %s; %5.1f%% of ugen-frames skipped\n", patch.name, renders,
+                bad ? "MISMATCH" : "identical", total ? 100.0 * skipped / total : 0.0 );
+        wrong += bad;
+    }
+
+    return wrong ? 1 : 0;
+}
@@ -0,0 +1,265 @@
+//-----------------------------------------------------------------------------
+// file: bytecode_regress.cpp
+// desc: regression test and benchmark for bytecode images: each program in
+//       the content folder is compiled to an image in one ChucK instance
+//       and loaded in another; its render must be bit-identical to a render
+//       compiled from source; truncated images, images with a corrupt
+//       header, table, or bad version, and images loaded at another sample
+//       rate must be rejected; random single-byte corruptions must be loaded
+//       or rejected without crashing; programs with a class or @import must
+//       fall back to a source image that renders like source; then times
+//       loading an image against compiling the source; exits non-zero on
+//       any mismatch
+//
+// usage: bytecode_regress [seconds=2] [content dir=../../Chunreal_Project/Content/ChuckFiles]
+//        (built by the Makefile in this directory; make run-bytecode_regress)
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#define SRATE 44100
+
+static const char * PROGRAMS[] = { "chant.ck", "hevymetl-dance-now.ck" };
+static const int NUM_PROGRAMS = sizeof(PROGRAMS) / sizeof(PROGRAMS[0]);
+
+// what chuck printed to stderr since the last clear
+static std::string g_errors;
+static void on_stderr( const char * text ) { g_errors += text; }
+
+static ChucK * make( int srate = SRATE )
+{
+    ChucK * ck = new ChucK();
+    ck->setParam( CHUCK_PARAM_SAMPLE_RATE, (t_CKINT)srate );
+    ck->setParam( CHUCK_PARAM_INPUT_CHANNELS, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, (t_CKINT)2 );
+    ck->setParam( CHUCK_PARAM_VM_HALT, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_CHUGIN_ENABLE, (t_CKINT)0 );
+    ck->init();
+    ck->start();
+    // same random numbers in every render
+    ck->compileCode( "Math.srandom( 1234 );", "", 1, TRUE );
+    return ck;
+}
+
+// render from source (image empty) or from an image; empty on failure
+static std::vector<SAMPLE> render( const std::string & code, const std::string & image, int frames )
+{
+    ChucK * ck = make();
+    std::vector<SAMPLE> out( frames * 2, 0 );
+    if( image.empty() ? ck->compileCode( code, "", 1 ) : ck->loadBytecode( image ) )
+    {
+        const int N = 512;
+        for( int i = 0; i < frames; i += N )
+            ck->run( NULL, &out[i*2], frames - i < N ? frames - i : N );
+    }
+    else out.clear();
+    delete ck;
+    return out;
+}
+
+// image of code, built in its own instance; empty on failure
+static std::string compile( const std::string & code, const std::string & path = "" )
+{
+    ChucK * ck = make();
+    std::string image;
+    if( !ck->compileCodeToBytecode( code, image, path ) ) image.clear();
+    delete ck;
+    return image;
+}
+
+// try to load image; returns whether it loaded (nothing is run)
+static bool loads( ChucK * ck, const std::string & image )
+{
+    g_errors.clear();
+    return ck->loadBytecode( image );
+}
+
+static bool same( const char * what, const std::vector<SAMPLE> & ref, const std::vector<SAMPLE> & out )
+{
+    if( ref.empty() || out.empty() ) { fprintf( stderr, "[%s] did not compile or load\n", what ); return false; }
+    if( ref.size() == out.size() && !memcmp( &ref[0], &out[0], ref.size() * sizeof(SAMPLE) ) ) return true;
+    size_t i = 0; while( i < ref.size() && ref[i] == out[i] ) i++;
+    fprintf( stderr, "[%s] differs from source at sample %lu\n", what, (unsigned long)i );
+    return false;
+}
+
+// must be rejected, with a reason
+static bool rejected( ChucK * ck, const char * program, const char * what, const std::string & image )
+{
+    if( loads( ck, image ) )
+    {
+        fprintf( stderr, "[%s] %s: image loaded\n", program, what );
+        return false;
+    }
+    if( g_errors.find( "cannot load bytecode image" ) == std::string::npos )
+    {
+        fprintf( stderr, "[%s] %s: rejected without a reason\n", program, what );
+        return false;
+    }
+    return true;
+}
+
+// image with the first occurrence of name changed
+static std::string rename( const std::string & image, const std::string & name )
+{
+    size_t at = image.find( name );
+    std::string bad = image;
+    if( at != std::string::npos ) bad[at + name.size() - 1] ^= 0x20;
+    else fprintf( stderr, "'%s' not in image\n", name.c_str() );
+    return bad;
+}
+
+// name of the first instruction class in the image's table (after the
+// header: magic, five 32-bit fields, version string, table size)
+static std::string first_op( const std::string & image )
+{
+    size_t at = 4 + 5*4 + sizeof(t_CKUINT) + strlen( CHUCK_VERSION_STRING ) + sizeof(t_CKUINT);
+    t_CKUINT n = 0;
+    if( at + sizeof(n) <= image.size() ) memcpy( &n, &image[at], sizeof(n) );
+    at += sizeof(n);
+    return n && at + n <= image.size() ? image.substr( at, n ) : "(none)";
+}
+
+// seconds per call of f, best of a few batches
+template< class F >
+static double timed( F f, int calls )
+{
+    double best = -1;
+    for( int r = 0; r < 3; r++ )
+    {
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        for( int i = 0; i < calls; i++ ) f();
+        double t = std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count() / calls;
+        if( best < 0 || t < best ) best = t;
+    }
+    return best;
+}
+
+int main( int argc, char ** argv )
+{
+    double seconds = argc > 1 ? atof( argv[1] ) : 2;
+    std::string dir = argc > 2 ? argv[2] : "../../Chunreal_Project/Content/ChuckFiles";
+    int frames = (int)( seconds * SRATE );
+    int wrong = 0;
+
+    ChucK::setStderrCallback( on_stderr );
+
+    for( int p = 0; p < NUM_PROGRAMS; p++ )
+    {
+        const char * name = PROGRAMS[p];
+        std::ifstream f( ( dir + "/" + name ).c_str() );
+        if( !f ) { fprintf( stderr, "[%s] cannot open in '%s'\n", name, dir.c_str() ); wrong++; continue; }
+        std::stringstream ss; ss << f.rdbuf();
+        std::string code = ss.str();
+
+        // round trip
+        std::string image = compile( code );
+        if( image.empty() || ChucK::isSourceImage( image ) )
+        {
+            fprintf( stderr, "[%s] not precompiled\n%s", name, g_errors.c_str() );
+            wrong++; continue;
+        }
+        wrong += !same( name, render( code, "", frames ), render( "", image, frames ) );
+
+        // rejected: truncated (every length through the tables, then spread
+        // over the rest), corrupt header and tables, bad version
+        int bad = 0, tried = 0;
+        ChucK * ck = make();
+        size_t step = image.size() / 400 + 1;
+        for( size_t n = 0; n < image.size(); n += n < 512 ? 1 : step, tried++ )
+            bad += !rejected( ck, name, "truncated", image.substr( 0, n ) );
+        std::string b;
+        b = image; b[0] ^= 0xff;      bad += !rejected( ck, name, "bad magic", b );
+        b = image; b[4] += 1;         bad += !rejected( ck, name, "bad version", b );
+        b = image; b[8] += 1;         bad += !rejected( ck, name, "bad word size", b );
+        b = rename( image, CHUCK_VERSION_STRING );
+        bad += !rejected( ck, name, "other chuck version", b );
+        b = rename( image, first_op( image ) ); bad += !rejected( ck, name, "unknown instruction", b );
+        b = rename( image, p ? "NRev" : "TwoPole" );
+        bad += !rejected( ck, name, "unknown type", b );
+        tried += 6;
+        delete ck;
+
+        // at another sample rate
+        ck = make( 48000 );
+        bad += !rejected( ck, name, "other sample rate", image );
+        tried++;
+        delete ck;
+
+        // any single corrupt byte: loaded or rejected, never a crash
+        ck = make();
+        srand( 1234 + p );
+        int loaded = 0;
+        for( int i = 0; i < 2000; i++ )
+        {
+            b = image;
+            b[rand() % b.size()] ^= (char)( 1 + rand() % 255 );
+            loaded += loads( ck, b );
+        }
+        delete ck;
+
+        printf( "%-22s image %6lu bytes; %d/%d bad images rejected; %d of 2000 corrupt bytes loaded\n",
+                name, (unsigned long)image.size(), tried - bad, tried, loaded );
+        wrong += bad;
+
+        // load against compile, each into a running instance
+        ck = make();
+        double tc = timed( [&]() { ck->compileCode( code, "", 1 ); }, 20 );
+        double tl = timed( [&]() { ck->loadBytecode( image ); }, 20 );
+        ck->removeAllShreds();
+        delete ck;
+        printf( "%-22s compile %7.3f ms, load %7.3f ms (%.1fx faster)\n", name, tc * 1000, tl * 1000, tc / tl );
+    }
+
+    // a class: source image, renders like source
+    std::string cls =
+        "class Voice { SinOsc s => dac; fun void play( float f ) { f => s.freq; 0.2 => s.gain; } }\n"
+        "Voice v; while( true ) { v.play( Math.random2f( 200, 800 ) ); 100::ms => now; }\n";
+    std::string image = compile( cls );
+    if( !ChucK::isSourceImage( image ) ) { fprintf( stderr, "[class] not a source image\n" ); wrong++; }
+    else wrong += !same( "class", render( cls, "", frames ), render( "", image, frames ) );
+
+    // @import: source image, resolved against its path when loaded
+    const char * tmp = getenv( "TMPDIR" );
+    std::string tmpdir = std::string( tmp ? tmp : "/tmp" ) + "/bytecode_regress.XXXXXX";
+    if( !mkdtemp( &tmpdir[0] ) ) { perror( "mkdtemp" ); return 1; }
+    std::ofstream( ( tmpdir + "/lib.ck" ).c_str() ) <<
+        "public class Blip { fun static void blip( UGen u, float f ) { f => ((u $ SinOsc)).freq; } }\n";
+    std::string imp = "@import \"lib.ck\"\n"
+        "SinOsc s => dac; 0.2 => s.gain;\n"
+        "while( true ) { Blip.blip( s, Math.random2f( 200, 800 ) ); 50::ms => now; }\n";
+    std::string path = tmpdir + "/main.ck";
+    image = compile( imp, path );
+    if( image.empty() || !ChucK::isSourceImage( image ) )
+    { fprintf( stderr, "[@import] not a source image\n%s", g_errors.c_str() ); wrong++; }
+    else
+    {
+        // source image of a bad version: rejected
+        std::string b = image; b[4] += 1;
+        ChucK * ck = make();
+        wrong += !rejected( ck, "@import", "source image, bad version", b );
+        delete ck;
+        // compiled in a fresh instance, as the source is
+        ck = make();
+        std::vector<SAMPLE> ref( frames * 2, 0 ), out( frames * 2, 0 );
+        if( ck->compileCode( imp, "", 1, FALSE, NULL, path ) )
+            for( int i = 0; i < frames; i += 512 )
+                ck->run( NULL, &ref[i*2], frames - i < 512 ? frames - i : 512 );
+        else ref.clear();
+        delete ck;
+        wrong += !same( "@import", ref, render( "", image, frames ) );
+    }
+    unlink( ( tmpdir + "/lib.ck" ).c_str() );
+    rmdir( tmpdir.c_str() );
+
+    printf( "class, @import: %s\n", wrong ? "MISMATCH" : "source images, identical to source" );
+    return wrong ? 1 : 0;
+}
@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// file: compile_stress.cpp
+// desc: parallel-compile stress test for the ChucK core: one ChucK instance
+//       per thread, each compiling the same programs over and over; every
+//       fifth program has a type error, which must be reported on its own
+//       line; exits non-zero on any wrong result
+//
+// usage: compile_stress [threads=16] [compiles=100]
+//        (built by the Makefile in this directory; make run-compile_stress)
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+#include "chuck_errmsg.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// parallel compiles need the pure parser / reentrant scanner (chuck_yacc.c)
+static_assert( std::is_same<decltype(&yyparse), int (*)( void * )>::value,
+               "chuck_yacc.c must be the reentrant parser: regenerate it with scripts/GenerateChuckYacc.sh" );
+
+// compiles cleanly
+static const char * GOOD =
+    "SinOsc s => LPF f => dac; 440 => s.freq;\n"
+    "class Foo { int x; float y[4]; fun int get() { return x; } }\n"
+    "fun float sum( float a[] ) { 0.0 => float t; for( auto v : a ) v +=> t; return t; }\n"
+    "Foo foo; 5 => foo.x; [1.0, 2.0, 3.0] @=> float a[];\n"
+    "fun void voice( int n ) { while( true ) { n::ms => now; } }\n"
+    "spork ~ voice( foo.get() ); sum( a ) => f.freq;\n"
+    "while( true ) { 100::ms => now; }\n";
+
+// type error on line 4
+static const char * BAD =
+    "SinOsc s => dac;\n"
+    "1::second => now;\n"
+    "int x;\n"
+    "\"foo\" => x;\n";
+
+int main( int argc, char ** argv )
+{
+    int T = argc > 1 ? atoi( argv[1] ) : 16;
+    int K = argc > 2 ? atoi( argv[2] ) : 100;
+
+    std::vector<ChucK *> cks;
+    for( int i = 0; i < T; i++ )
+    {
+        ChucK * ck = new ChucK();
+        ck->setParam( CHUCK_PARAM_SAMPLE_RATE, (t_CKINT)44100 );
+        ck->setParam( CHUCK_PARAM_INPUT_CHANNELS, (t_CKINT)2 );
+        ck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, (t_CKINT)2 );
+        ck->setParam( CHUCK_PARAM_VM_HALT, (t_CKINT)0 );
+        ck->setParam( CHUCK_PARAM_CHUGIN_ENABLE, (t_CKINT)0 );
+        ck->init();
+        ck->start();
+        cks.push_back( ck );
+    }
+
+    std::atomic<int> ok( 0 ), errors( 0 ), wrong( 0 );
+    auto work = [&]( int i )
+    {
+        for( int k = 0; k < K; k++ )
+        {
+            if( k % 5 == 4 )
+            {
+                // must fail, and say where
+                std::string e;
+                if( !cks[i]->compileCode( BAD, "", 1 ) ) e = EM_lasterror();
+                if( e.find( ":4:" ) == std::string::npos )
+                {
+                    wrong++;
+                    fprintf( stderr, "[%d:%d] wrong error: '%s'\n", i, k, e.c_str() );
+                }
+                else errors++;
+            }
+            else if( cks[i]->compileCode( GOOD, "", 1 ) ) ok++;
+            else
+            {
+                wrong++;
+                fprintf( stderr, "[%d:%d] failed: '%s'\n", i, k, EM_lasterror() );
+            }
+            cks[i]->removeAllShreds();
+        }
+    };
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for( int i = 0; i < T; i++ ) threads.emplace_back( work, i );
+    for( size_t i = 0; i < threads.size(); i++ ) threads[i].join();
+    auto t1 = std::chrono::steady_clock::now();
+
+    printf( "%d threads x %d compiles: %d ok, %d errors as expected, %d wrong (%.1f ms)\n",
+            T, K, ok.load(), errors.load(), wrong.load(),
+            std::chrono::duration<double, std::milli>( t1 - t0 ).count() );
+
+    for( size_t i = 0; i < cks.size(); i++ ) delete cks[i];
+    return wrong.load() ? 1 : 0;
+}
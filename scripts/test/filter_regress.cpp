@@ -0,0 +1,216 @@
+//-----------------------------------------------------------------------------
+// file: filter_regress.cpp
+// desc: modulated-filter regression test: four filters of one type, fed
+//       Noise, get new coefficients every 44 samples; the output must match
+//       the filters as they were before 1.5.5.3 (single-precision direct
+//       form II for the SC3 filters, direct form I for BiQuad; ported below;
+//       LPF and HPF are SC3's resonant RLPF and RHPF)
+//       to within rounding, in sample mode and in block mode (adaptive 64);
+//       in particular, each coefficient change must start the same transient;
+//       exits non-zero on any mismatch
+//
+// usage: filter_regress [seconds=2]
+//        (built by the Makefile in this directory; make run-filter_regress)
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#define NUM_FILTERS 4
+#define SRATE 44100
+#define STEP 44
+
+// parameters for instance i at step k (the patches below do the same math)
+static double param_freq( int k, int i ) { return 100 + (k * 7919 + i * 1237) % 4900; }
+static double param_Q( int k, int i ) { return 0.7 + ((k * 31 + i * 17) % 73) / 10.0; }
+static double param_rad( int k, int i ) { return 0.9 + ((k * 13 + i * 7) % 99) / 1000.0; }
+
+// shared by all patches: noise on channel 0, filter i on channel i+1
+static const char * PRELUDE =
+    "Noise n => dac.chan(0);\n"
+    "fun float pfreq( int k, int i ) { return 100 + (k * 7919 + i * 1237) % 4900; }\n"
+    "fun float pQ( int k, int i ) { return 0.7 + ((k * 31 + i * 17) % 73) / 10.0; }\n"
+    "fun float prad( int k, int i ) { return 0.9 + ((k * 13 + i * 7) % 99) / 1000.0; }\n";
+
+//-----------------------------------------------------------------------------
+// the filters before 1.5.5.3 (SC3 forms; BiQuad), float state
+//-----------------------------------------------------------------------------
+enum Kind { RLPF, RHPF, BPF, BRF, RESONZ, BIQUAD };
+
+struct Ref
+{
+    Kind kind;
+    float a0, b1, b2;       // SC3
+    float y1, y2;           // SC3 state
+    float ba0, ba1, ba2, bb0, bb1, bb2;    // BiQuad
+    float in1, in2, out1, out2;            // BiQuad state
+
+    Ref( Kind k ) : kind( k ), a0( 0 ), b1( 0 ), b2( 0 ), y1( 0 ), y2( 0 ),
+        ba0( 1 ), ba1( 0 ), ba2( 0 ), bb0( 1 ), bb1( 0 ), bb2( -1 ),
+        in1( 0 ), in2( 0 ), out1( 0 ), out2( 0 ) { }
+
+    void set( double freq, double Q, double rad )
+    {
+        double rps = 2 * M_PI / SRATE, pfreq, pbw, C, D;
+        switch( kind )
+        {
+        case RLPF:
+        case RHPF:
+        {
+            freq = freq < 1 ? 1 : freq > SRATE / 2 ? SRATE / 2 : freq;
+            Q = Q < 1 ? 1 : Q;
+            double qres = 1.0 / Q < .001 ? .001 : 1.0 / Q;
+            pfreq = freq * rps;
+            D = ::tan( pfreq * qres * 0.5 ); C = (1.0 - D) / (1.0 + D);
+            double cosf = ::cos( pfreq ), nb1 = (1.0 + C) * cosf;
+            a0 = (float)((kind == RLPF ? 1.0 + C - nb1 : 1.0 + C + nb1) * 0.25);
+            b1 = (float)nb1; b2 = (float)(-C);
+            break;
+        }
+        case BPF:
+            pfreq = freq * rps; pbw = 1.0 / Q * pfreq * .5;
+            C = 1.0 / ::tan( pbw ); D = 2.0 * ::cos( pfreq );
+            a0 = (float)(1.0 / (1.0 + C)); b1 = (float)(C * D / (1.0 + C)); b2 = (float)((1.0 - C) / (1.0 + C));
+            break;
+        case BRF:
+            pfreq = freq * rps; pbw = 1.0 / Q * pfreq * .5;
+            C = ::tan( pbw ); D = 2.0 * ::cos( pfreq );
+            a0 = (float)(1.0 / (1.0 + C)); b1 = (float)(-D / (1.0 + C)); b2 = (float)((1.0 - C) / (1.0 + C));
+            break;
+        case RESONZ:
+        {
+            pfreq = freq * rps;
+            double R = 1.0 - pfreq / Q * 0.5, R22 = R * R;
+            double cost = (2.0 * R * ::cos( pfreq )) / (1.0 + R22);
+            a0 = (float)((1.0 - R22) * 0.5); b1 = (float)(2.0 * R * cost); b2 = (float)(-R22);
+            break;
+        }
+        case BIQUAD:
+            ba2 = (float)(rad * rad);
+            ba1 = (float)(-2.0 * rad * ::cos( 2.0 * M_PI * freq / SRATE ));
+            break;
+        }
+    }
+
+    float tick( float in )
+    {
+        float y0 = 0, result = 0;
+        switch( kind )
+        {
+        case RLPF: y0 = a0 * in + b1 * y1 + b2 * y2; result = y0 + 2 * y1 + y2; break;
+        case RHPF: y0 = a0 * in + b1 * y1 + b2 * y2; result = y0 - 2 * y1 + y2; break;
+        case BPF: case RESONZ: y0 = in + b1 * y1 + b2 * y2; result = a0 * (y0 - y2); break;
+        case BRF: y0 = in - b1 * y1 - b2 * y2; result = a0 * (y0 + y2) + b1 * y1; break;
+        case BIQUAD:
+        {
+            float in0 = ba0 * in;
+            float out0 = bb0 * in0 + bb1 * in1 + bb2 * in2;
+            out0 -= ba2 * out2 + ba1 * out1;
+            in2 = in1; in1 = in0; out2 = out1; out1 = out0;
+            return out0;
+        }
+        }
+        y2 = y1; y1 = y0;
+        return result;
+    }
+};
+
+struct Patch { const char * name; Kind kind; const char * code; };
+
+static const Patch PATCHES[] = {
+    { "LPF", RLPF,
+      "LPF f[4]; for( 0 => int i; i < 4; i++ ) n => f[i] => dac.chan(i+1);\n"
+      "for( 0 => int k; true; k++ ) { for( 0 => int i; i < 4; i++ ) f[i].set( pfreq(k,i), pQ(k,i) ); 44::samp => now; }\n" },
+    { "HPF", RHPF,
+      "HPF f[4]; for( 0 => int i; i < 4; i++ ) n => f[i] => dac.chan(i+1);\n"
+      "for( 0 => int k; true; k++ ) { for( 0 => int i; i < 4; i++ ) f[i].set( pfreq(k,i), pQ(k,i) ); 44::samp => now; }\n" },
+    { "BPF", BPF,
+      "BPF f[4]; for( 0 => int i; i < 4; i++ ) n => f[i] => dac.chan(i+1);\n"
+      "for( 0 => int k; true; k++ ) { for( 0 => int i; i < 4; i++ ) f[i].set( pfreq(k,i), pQ(k,i) ); 44::samp => now; }\n" },
+    { "BRF", BRF,
+      "BRF f[4]; for( 0 => int i; i < 4; i++ ) n => f[i] => dac.chan(i+1);\n"
+      "for( 0 => int k; true; k++ ) { for( 0 => int i; i < 4; i++ ) f[i].set( pfreq(k,i), pQ(k,i) ); 44::samp => now; }\n" },
+    { "ResonZ", RESONZ,
+      "ResonZ f[4]; for( 0 => int i; i < 4; i++ ) n => f[i] => dac.chan(i+1);\n"
+      "for( 0 => int k; true; k++ ) { for( 0 => int i; i < 4; i++ ) f[i].set( pfreq(k,i), pQ(k,i) ); 44::samp => now; }\n" },
+    { "BiQuad", BIQUAD,
+      "BiQuad f[4]; for( 0 => int i; i < 4; i++ ) { n => f[i] => dac.chan(i+1); 1 => f[i].eqzs; }\n"
+      "for( 0 => int k; true; k++ ) { for( 0 => int i; i < 4; i++ ) { prad(k,i) => f[i].prad; pfreq(k,i) => f[i].pfreq; } 44::samp => now; }\n" },
+};
+
+static const int NUM_PATCHES = sizeof(PATCHES) / sizeof(PATCHES[0]);
+static const int CHANS = NUM_FILTERS + 1;
+
+static std::vector<SAMPLE> render( const std::string & code, int adaptive, int frames )
+{
+    ChucK * ck = new ChucK();
+    ck->setParam( CHUCK_PARAM_SAMPLE_RATE, (t_CKINT)SRATE );
+    ck->setParam( CHUCK_PARAM_INPUT_CHANNELS, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, (t_CKINT)CHANS );
+    ck->setParam( CHUCK_PARAM_VM_ADAPTIVE, (t_CKINT)adaptive );
+    ck->setParam( CHUCK_PARAM_VM_HALT, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_CHUGIN_ENABLE, (t_CKINT)0 );
+    ck->init();
+    ck->start();
+
+    std::vector<SAMPLE> out( frames * CHANS, 0 );
+    if( ck->compileCode( code, "", 1 ) )
+    {
+        const int N = 512;
+        for( int i = 0; i < frames; i += N )
+            ck->run( NULL, &out[i * CHANS], frames - i < N ? frames - i : N );
+    }
+    else out.clear();
+
+    delete ck;
+    return out;
+}
+
+int main( int argc, char ** argv )
+{
+    double seconds = argc > 1 ? atof( argv[1] ) : 2;
+    int frames = (int)( seconds * SRATE );
+    int wrong = 0;
+
+    for( int p = 0; p < NUM_PATCHES; p++ )
+    {
+        for( int adaptive = 0; adaptive <= 64; adaptive += 64 )
+        {
+            std::vector<SAMPLE> out = render( std::string( PRELUDE ) + PATCHES[p].code, adaptive, frames );
+            if( out.empty() )
+            {
+                wrong++;
+                fprintf( stderr, "[%s] compile failed\n", PATCHES[p].name );
+                continue;
+            }
+
+            // the old filters, on the same noise
+            std::vector<Ref> refs( NUM_FILTERS, Ref( PATCHES[p].kind ) );
+            double peak = 0, maxdiff = 0;
+            int at = -1;
+            for( int t = 0; t < frames; t++ )
+            {
+                for( int i = 0; i < NUM_FILTERS; i++ )
+                {
+                    if( t % STEP == 0 )
+                        refs[i].set( param_freq( t / STEP, i ), param_Q( t / STEP, i ), param_rad( t / STEP, i ) );
+                    float want = refs[i].tick( out[t * CHANS] );
+                    double d = std::fabs( (double)want - out[t * CHANS + i + 1] );
+                    if( std::fabs( want ) > peak ) peak = std::fabs( want );
+                    if( !( d <= maxdiff ) ) { maxdiff = d; at = t; }
+                }
+            }
+
+            // float rounding in the old filters: well under 1e-3 of the peak
+            t_CKBOOL ok = maxdiff <= 1e-3 * ( peak > 1 ? peak : 1 );
+            printf( "%-7s %-6s peak %8.3f, max difference %.2g (sample %d): %s\n", PATCHES[p].name,
+                    adaptive ? "block" : "sample", peak, maxdiff, at, ok ? "ok" : "MISMATCH" );
+            if( !ok ) wrong++;
+        }
+    }
+
+    return wrong ? 1 : 0;
+}
@@ -0,0 +1,252 @@
+//-----------------------------------------------------------------------------
+// file: sndbuf_cache.cpp
+// desc: regression test for the shared SndBuf sample cache: writes a few
+//       .wav files to a temporary directory, then renders a patch of
+//       SndBufs reading them (chunk sizes 0, 4096 and the default; looping,
+//       reversed, jumping, and read again while playing; the same files
+//       named by different paths); with the cache on, in sample mode and
+//       in block mode (adaptive 64), and in several ChucK instances
+//       rendering at once on their own threads, the output must match a
+//       render with the cache off; a file rewritten within the same second
+//       (same size) must not be served from the cache, and nothing may be
+//       left in use once every patch has ended; exits non-zero on any
+//       mismatch
+//
+// usage: sndbuf_cache [seconds=3] [instances=6]
+//        (built by the Makefile in this directory; make run-sndbuf_cache)
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+#include "ugen_xxx.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SRATE 44100
+
+// a 16-bit PCM .wav of a few partials and some noise; seed picks the sound;
+// its modification time is set to mtime (seconds) + nsec
+static bool write_wav( const std::string & path, int channels, int frames, int seed,
+                       time_t mtime, long nsec )
+{
+    FILE * f = fopen( path.c_str(), "wb" );
+    if( !f ) return false;
+
+    unsigned data = frames * channels * 2;
+    unsigned char h[44] = { 'R','I','F','F', 0,0,0,0, 'W','A','V','E', 'f','m','t',' ',
+        16,0,0,0, 1,0, 0,0, 0,0,0,0, 0,0,0,0, 0,0, 16,0, 'd','a','t','a', 0,0,0,0 };
+    unsigned riff = 36 + data, rate = SRATE, bytes = SRATE * channels * 2;
+    for( int i = 0; i < 4; i++ )
+    {
+        h[4+i] = riff >> (8*i); h[24+i] = rate >> (8*i);
+        h[28+i] = bytes >> (8*i); h[40+i] = data >> (8*i);
+    }
+    h[22] = channels; h[32] = channels * 2;
+    fwrite( h, 1, sizeof(h), f );
+
+    unsigned noise = 12345 + seed;
+    for( int i = 0; i < frames; i++ )
+    {
+        for( int c = 0; c < channels; c++ )
+        {
+            noise = noise * 1664525 + 1013904223;
+            double x = 0.4 * sin( 2 * M_PI * (220 + 110 * seed + 55 * c) * i / SRATE )
+                     + 0.2 * sin( 2 * M_PI * (1250 + 31 * seed) * i / SRATE )
+                     + 0.1 * ( (noise >> 16) / 32768.0 - 1 );
+            short s = (short)( x * 32767 );
+            fputc( s & 0xff, f ); fputc( (s >> 8) & 0xff, f );
+        }
+    }
+    fclose( f );
+
+    struct timespec times[2] = { { mtime, nsec }, { mtime, nsec } };
+    return utimensat( AT_FDCWD, path.c_str(), times, 0 ) == 0;
+}
+
+// the test patch, for frames samples; D is the directory, named two ways
+static std::string make_patch( const std::string & dir, int frames )
+{
+    char end[64];
+    snprintf( end, sizeof(end), "now + %d::samp => time end;\n", frames );
+    std::string d = "\"" + dir + "\" => string D; \"" + dir + "/../" +
+        dir.substr( dir.rfind( '/' ) + 1 ) + "\" => string E;\n";
+    return end + d +
+        "SndBuf b[6]; Gain bus => dac; 0.2 => bus.gain;\n"
+        "for( 0 => int i; i < 6; i++ ) { b[i] => bus; 1 => b[i].loop; }\n"
+        "0 => b[0].chunks; 4096 => b[1].chunks; 4096 => b[3].chunks; 0 => b[5].chunks;\n"
+        "D + \"/mono.wav\" => b[0].read; D + \"/mono.wav\" => b[1].read; E + \"/mono.wav\" => b[2].read;\n"
+        "1.5 => b[1].rate; -0.75 => b[2].rate;\n"
+        "100::ms => now;\n"
+        "E + \"/stereo.wav\" => b[3].read; D + \"/stereo.wav\" => b[4].read; E + \"/short.wav\" => b[5].read;\n"
+        "-1.25 => b[3].rate; 0.5 => b[4].rate; 2 => b[5].rate;\n"
+        "0 => int k;\n"
+        "while( now < end ) {\n"
+        "    250::ms => now; k++;\n"
+        "    (k * 7919) % b[1].samples() => b[1].pos; (k * 104729) % b[4].samples() => b[4].pos;\n"
+        "    if( k % 3 == 0 ) { 4096 => b[0].chunks; E + \"/stereo.wav\" => b[0].read; }\n"
+        "    if( k % 3 == 1 ) { D + \"/mono.wav\" => b[0].read; }\n"
+        "    if( k % 4 == 2 ) { E + \"/mono.wav\" => b[3].read; -1 => b[3].rate; }\n"
+        "}\n";
+}
+
+// cache limit: off, or the default
+static void cache( bool on )
+{
+    static t_CKUINT limit = 0;
+    SndBuf_Cache_Stats stats;
+    ck_sndbuf_cache_stats( &stats );
+    if( stats.limit ) limit = stats.limit;
+    // evicts everything not in use
+    ck_sndbuf_cache_limit( 0 );
+    if( on ) ck_sndbuf_cache_limit( limit );
+}
+
+// render frames, then on until the patch is done (shreds still running when
+// a ChucK instance is deleted keep their SndBufs, and cache entries, for good)
+static void render( const std::string & code, int adaptive, int frames, std::vector<SAMPLE> * out )
+{
+    ChucK * ck = new ChucK();
+    ck->setParam( CHUCK_PARAM_SAMPLE_RATE, (t_CKINT)SRATE );
+    ck->setParam( CHUCK_PARAM_INPUT_CHANNELS, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, (t_CKINT)1 );
+    ck->setParam( CHUCK_PARAM_VM_ADAPTIVE, (t_CKINT)adaptive );
+    ck->setParam( CHUCK_PARAM_VM_HALT, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_CHUGIN_ENABLE, (t_CKINT)0 );
+    ck->init();
+    ck->start();
+
+    out->assign( frames, 0 );
+    if( ck->compileCode( code, "", 1 ) )
+    {
+        const int N = 512;
+        for( int i = 0; i < frames; i += N )
+            ck->run( NULL, &(*out)[i], frames - i < N ? frames - i : N );
+        SAMPLE rest[N];
+        for( int i = 0; i < SRATE && ck->vm()->shreduler()->highest(); i += N )
+            ck->run( NULL, rest, N );
+    }
+    else out->clear();
+
+    delete ck;
+}
+
+// out must be ref; returns FALSE (and says so) if not
+static bool same( const char * what, const std::vector<SAMPLE> & ref, const std::vector<SAMPLE> & out )
+{
+    if( out.empty() ) { fprintf( stderr, "[%s] compile failed\n", what ); return false; }
+    if( out.size() == ref.size() && !memcmp( &ref[0], &out[0], ref.size() * sizeof(SAMPLE) ) )
+        return true;
+    size_t i = 0; while( i < ref.size() && ref[i] == out[i] ) i++;
+    fprintf( stderr, "[%s] differs from the render without cache at sample %lu\n",
+             what, (unsigned long)i );
+    return false;
+}
+
+int main( int argc, char ** argv )
+{
+    double seconds = argc > 1 ? atof( argv[1] ) : 3;
+    int instances = argc > 2 ? atoi( argv[2] ) : 6;
+    int frames = (int)( seconds * SRATE );
+    int wrong = 0;
+
+    const char * tmp = getenv( "TMPDIR" );
+    std::string dir = std::string( tmp ? tmp : "/tmp" ) + "/sndbuf_cache.XXXXXX";
+    if( !mkdtemp( &dir[0] ) ) { perror( "mkdtemp" ); return 1; }
+
+    time_t now = time( NULL );
+    bool ok = write_wav( dir + "/mono.wav", 1, 2 * SRATE, 0, now, 0 ) &&
+              write_wav( dir + "/stereo.wav", 2, 3 * SRATE / 2, 1, now, 0 ) &&
+              write_wav( dir + "/short.wav", 1, SRATE / 10, 2, now, 0 );
+    if( !ok ) { perror( "write_wav" ); return 1; }
+    std::string code = make_patch( dir, frames );
+
+    // without the cache
+    std::vector<SAMPLE> ref;
+    cache( false );
+    render( code, 0, frames, &ref );
+    if( ref.empty() ) { fprintf( stderr, "compile failed\n" ); return 1; }
+
+    // with it, starting empty and then full, sample and block mode
+    SndBuf_Cache_Stats before, after;
+    cache( true );
+    ck_sndbuf_cache_stats( &before );
+    const int ADAPTIVE[] = { 0, 64, 0, 64 };
+    for( int i = 0; i < 4; i++ )
+    {
+        std::vector<SAMPLE> out;
+        render( code, ADAPTIVE[i], frames, &out );
+        char what[64];
+        snprintf( what, sizeof(what), "adaptive=%d, cache %s", ADAPTIVE[i], i < 2 ? "filling" : "full" );
+        wrong += !same( what, ref, out );
+    }
+    ck_sndbuf_cache_stats( &after );
+    // three files however named; read from the cache (the stereo file is
+    // read by SndBufs with different chunk sizes, some before it is complete)
+    if( after.files != 3 || after.hits == before.hits )
+    {
+        fprintf( stderr, "[cache] %lu files, %lu hits (expected 3 files, some hits)\n",
+                 (unsigned long)after.files, (unsigned long)(after.hits - before.hits) );
+        wrong++;
+    }
+
+    // many instances at once, each filling the same entries in chunks
+    cache( false );
+    cache( true );
+    std::vector< std::vector<SAMPLE> > outs( instances );
+    std::vector<std::thread> threads;
+    for( int i = 0; i < instances; i++ )
+        threads.push_back( std::thread( render, code, ADAPTIVE[i % 2], frames, &outs[i] ) );
+    for( int i = 0; i < instances; i++ )
+        threads[i].join();
+    for( int i = 0; i < instances; i++ )
+    {
+        char what[64];
+        snprintf( what, sizeof(what), "instance %d of %d, adaptive=%d", i, instances, ADAPTIVE[i % 2] );
+        wrong += !same( what, ref, outs[i] );
+    }
+
+    // rewritten in the same second, same size: must be read again
+    char dur[32];
+    snprintf( dur, sizeof(dur), "%d::samp => now;\n", frames );
+    std::string one = "SndBuf b => dac; \"" + dir + "/mono.wav\" => b.read; 1 => b.loop;\n" + dur;
+    std::vector<SAMPLE> old_out, new_out, new_ref;
+    cache( true );
+    render( one, 0, frames, &old_out );
+    ok = write_wav( dir + "/mono.wav", 1, 2 * SRATE, 3, now, 500000000 );
+    if( !ok ) { perror( "write_wav" ); return 1; }
+    render( one, 0, frames, &new_out );
+    cache( false );
+    render( one, 0, frames, &new_ref );
+    wrong += !same( "rewritten file", new_ref, new_out );
+    if( old_out == new_out )
+    {
+        fprintf( stderr, "[rewritten file] still plays the old samples\n" );
+        wrong++;
+    }
+
+    // every SndBuf let go of its entry
+    SndBuf_Cache_Stats left;
+    ck_sndbuf_cache_stats( &left );
+    if( left.files )
+    {
+        fprintf( stderr, "[cache] %lu files still in use after every patch ended\n",
+                 (unsigned long)left.files );
+        wrong++;
+    }
+    cache( true );
+
+    unlink( ( dir + "/mono.wav" ).c_str() );
+    unlink( ( dir + "/stereo.wav" ).c_str() );
+    unlink( ( dir + "/short.wav" ).c_str() );
+    rmdir( dir.c_str() );
+
+    printf( "sndbuf cache: %d instances, %g s; %s\n", instances, seconds,
+            wrong ? "MISMATCH" : "identical to the render without cache" );
+    return wrong ? 1 : 0;
+}
@@ -0,0 +1,97 @@
+//-----------------------------------------------------------------------------
+// file: ugen_bench.cpp
+// desc: scaling benchmark for parallel block ticks: renders a patch of
+//       independent voices in block mode (adaptive 64) with 0, 2, 4 and 8
+//       ugen threads, best of three runs each, and prints the time and
+//       speedup over 0 threads; every thread count must render the same
+//       output as 0 threads; exits non-zero on any mismatch
+//
+// usage: ugen_bench [voices=256] [seconds=10]
+//        (built by the Makefile in this directory; make run-ugen_bench)
+//-----------------------------------------------------------------------------
+#include "chuck.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const int THREADS[] = { 0, 2, 4, 8 };
+static const int NUM_THREADS = sizeof(THREADS) / sizeof(THREADS[0]);
+static const int RUNS = 3;
+
+// render; returns seconds spent in run()
+static double render( const std::string & code, int threads, int frames, std::vector<SAMPLE> & out )
+{
+    ChucK * ck = new ChucK();
+    ck->setParam( CHUCK_PARAM_SAMPLE_RATE, (t_CKINT)44100 );
+    ck->setParam( CHUCK_PARAM_INPUT_CHANNELS, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_OUTPUT_CHANNELS, (t_CKINT)1 );
+    ck->setParam( CHUCK_PARAM_VM_ADAPTIVE, (t_CKINT)64 );
+    ck->setParam( CHUCK_PARAM_VM_HALT, (t_CKINT)0 );
+    ck->setParam( CHUCK_PARAM_VM_UGEN_THREADS, (t_CKINT)threads );
+    ck->setParam( CHUCK_PARAM_CHUGIN_ENABLE, (t_CKINT)0 );
+    ck->init();
+    ck->start();
+
+    out.assign( frames, 0 );
+    double elapsed = -1;
+    if( ck->compileCode( code, "", 1 ) )
+    {
+        const int N = 512;
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        for( int i = 0; i < frames; i += N )
+            ck->run( NULL, &out[i], frames - i < N ? frames - i : N );
+        elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count();
+    }
+
+    delete ck;
+    return elapsed;
+}
+
+int main( int argc, char ** argv )
+{
+    int voices = argc > 1 ? atoi( argv[1] ) : 256;
+    double seconds = argc > 2 ? atof( argv[2] ) : 10;
+    int frames = (int)( seconds * 44100 );
+
+    // one voice per subgraph, mixed on one bus; the envelopes stay open so
+    // nothing goes dormant
+    char buffer[512];
+    snprintf( buffer, sizeof(buffer),
+        "%d => int V; SinOsc s[V]; LPF f[V]; ADSR e[V]; Gain bus => dac; 1.0/V => bus.gain;\n"
+        "for( 0 => int i; i < V; i++ ) {\n"
+        "    s[i] => f[i] => e[i] => bus; 100 + i * 7 => s[i].freq;\n"
+        "    500 + i * 11 => f[i].freq; e[i].set( 5::ms, 10::ms, 0.8, 50::ms ); e[i].keyOn(); }\n"
+        "while( true ) 1::second => now;\n", voices );
+    std::string code = buffer;
+
+    printf( "%d voices, %g s, block 64, best of %d; %u hardware threads\n",
+            voices, seconds, RUNS, std::thread::hardware_concurrency() );
+
+    std::vector<SAMPLE> ref, out;
+    double base = 0;
+    int wrong = 0;
+    for( int t = 0; t < NUM_THREADS; t++ )
+    {
+        double best = -1;
+        for( int r = 0; r < RUNS; r++ )
+        {
+            double elapsed = render( code, THREADS[t], frames, out );
+            if( elapsed < 0 ) { fprintf( stderr, "compile failed\n" ); return 1; }
+            if( best < 0 || elapsed < best ) best = elapsed;
+            if( ref.empty() ) ref = out;
+            else if( memcmp( &ref[0], &out[0], frames * sizeof(SAMPLE) ) )
+            {
+                wrong++;
+                fprintf( stderr, "threads=%d run=%d: output differs from 0 threads\n", THREADS[t], r );
+            }
+        }
+        if( t == 0 ) base = best;
+        printf( "threads %d: %8.1f ms  speedup %.2fx\n", THREADS[t], best * 1000, base / best );
+    }
+
+    return wrong ? 1 : 0;
+}